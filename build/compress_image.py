@@ -0,0 +1,242 @@
+
+# Compresses the tile data in an image that grit has already converted, e.g.
+# data/tilesheet.s and data/tilesheet.h, in place. We try both of the gba bios
+# formats, LZ77 (type 0x10) and RLE (type 0x30), and keep whichever comes out
+# smaller. See source/compression.hpp for the decoder.
+#
+# usage: compress_image.py <image.s> <image.h>
+#        compress_image.py --report <data dir>
+#
+# With --report, prints the rom space saved by all of the compressed images in
+# the data directory.
+
+import os
+import re
+import sys
+
+
+# Sixteen bit vram writes mean that a decoder writing straight to vram cannot
+# copy from the byte that it just wrote, so we never emit a displacement of
+# one. The bios' LZ77UnCompVram has the same restriction.
+LZ_MIN_DISP = 2
+LZ_MAX_DISP = 4096
+LZ_MIN_LEN = 3
+LZ_MAX_LEN = 18
+LZ_MAX_CANDIDATES = 128
+
+
+def header(kind, size):
+    return bytes([kind, size & 0xff, (size >> 8) & 0xff, (size >> 16) & 0xff])
+
+
+def lz77_compress(data):
+    out = bytearray(header(0x10, len(data)))
+
+    # Positions of each three byte prefix, most recent last.
+    chains = {}
+
+    def insert(pos):
+        if pos + LZ_MIN_LEN <= len(data):
+            chains.setdefault(data[pos:pos + LZ_MIN_LEN], []).append(pos)
+
+    pos = 0
+    while pos < len(data):
+        flag_index = len(out)
+        out.append(0)
+
+        for bit in range(8):
+            if pos >= len(data):
+                break
+
+            best_len = 0
+            best_disp = 0
+
+            candidates = chains.get(data[pos:pos + LZ_MIN_LEN], [])
+            for start in reversed(candidates[-LZ_MAX_CANDIDATES:]):
+                disp = pos - start
+                if disp > LZ_MAX_DISP:
+                    break
+                if disp < LZ_MIN_DISP:
+                    continue
+                length = 0
+                limit = min(LZ_MAX_LEN, len(data) - pos)
+                while (length < limit and
+                       data[start + length] == data[pos + length]):
+                    length += 1
+                if length > best_len:
+                    best_len = length
+                    best_disp = disp
+                    if length == LZ_MAX_LEN:
+                        break
+
+            if best_len >= LZ_MIN_LEN:
+                out[flag_index] |= 0x80 >> bit
+                d = best_disp - 1
+                out.append(((best_len - LZ_MIN_LEN) << 4) | (d >> 8))
+                out.append(d & 0xff)
+                for i in range(best_len):
+                    insert(pos + i)
+                pos += best_len
+            else:
+                out.append(data[pos])
+                insert(pos)
+                pos += 1
+
+    return bytes(out)
+
+
+def rle_compress(data):
+    out = bytearray(header(0x30, len(data)))
+
+    literals = bytearray()
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literals[:128]
+
+    pos = 0
+    while pos < len(data):
+        run = 1
+        while (pos + run < len(data) and run < 130 and
+               data[pos + run] == data[pos]):
+            run += 1
+
+        if run >= 3:
+            flush_literals()
+            out.append(0x80 | (run - 3))
+            out.append(data[pos])
+            pos += run
+        else:
+            literals.append(data[pos])
+            pos += 1
+
+    flush_literals()
+
+    return bytes(out)
+
+
+def compress(data):
+    lz = lz77_compress(data)
+    rle = rle_compress(data)
+    if len(rle) < len(lz):
+        return 'rle', rle
+    return 'lz77', lz
+
+
+def to_words(data):
+    data = data + bytes((-len(data)) % 4)
+    return [int.from_bytes(data[i:i + 4], 'little')
+            for i in range(0, len(data), 4)]
+
+
+RAW_NOTE = re.compile(r'compressed, (\d+) bytes raw')
+
+
+def compress_image(s_path, h_path):
+    name = os.path.splitext(os.path.basename(s_path))[0]
+    symbol = name + 'Tiles'
+
+    with open(s_path) as f:
+        s_lines = f.read().split('\n')
+    with open(h_path) as f:
+        h_text = f.read()
+
+    if RAW_NOTE.search(h_text):
+        print('%s: already compressed' % name)
+        return
+
+    # Grit writes eight lines of eight words, then a blank line, and so on.
+    start = s_lines.index(symbol + ':') + 1
+    end = start
+    while (s_lines[end].strip().startswith('.word') or
+           not s_lines[end].strip()):
+        end += 1
+    while not s_lines[end - 1].strip():
+        end -= 1
+
+    words = []
+    for line in s_lines[start:end]:
+        if line.strip():
+            words += [int(w, 16)
+                      for w in line.strip()[len('.word'):].split(',')]
+
+    raw = b''.join(w.to_bytes(4, 'little') for w in words)
+
+    kind, packed = compress(raw)
+    packed_words = to_words(packed)
+    packed_len = len(packed_words) * 4
+
+    note = '%s compressed, %d bytes raw' % (kind, len(raw))
+
+    def fix_comments(text, comment):
+        text = re.sub(r'(%s\t\+ \d+ tiles.*?)not compressed' % comment,
+                      r'\1' + note, text)
+        return re.sub(r'(%s\tTotal size: \d+ \+ )\d+ = (\d+)' % comment,
+                      lambda m: '%s%d = %d' % (m.group(1), packed_len,
+                                               int(m.group(2)) - len(raw) +
+                                               packed_len),
+                      text)
+
+    packed_lines = []
+    for i in range(0, len(packed_words), 8):
+        if i and i % 64 == 0:
+            packed_lines.append('')
+        packed_lines.append('\t.word ' + ','.join(
+            '0x%08X' % w for w in packed_words[i:i + 8]))
+
+    s_lines[start:end] = packed_lines
+
+    s_text = '\n'.join(s_lines)
+    s_text = s_text.replace('.global %s\t\t@ %d unsigned chars' %
+                            (symbol, len(raw)),
+                            '.global %s\t\t@ %d unsigned chars' %
+                            (symbol, packed_len))
+    s_text = fix_comments(s_text, '@')
+
+    h_text = h_text.replace('#define %sLen %d' % (symbol, len(raw)),
+                            '#define %sLen %d' % (symbol, packed_len))
+    h_text = h_text.replace('%s[%d]' % (symbol, len(words)),
+                            '%s[%d]' % (symbol, len(packed_words)))
+    h_text = fix_comments(h_text, '//')
+
+    with open(s_path, 'w') as f:
+        f.write(s_text)
+    with open(h_path, 'w') as f:
+        f.write(h_text)
+
+    print('%s: %s, %d -> %d bytes' % (name, kind, len(raw), packed_len))
+
+
+def report(data_dir):
+    raw_total = 0
+    packed_total = 0
+    count = 0
+
+    for filename in sorted(os.listdir(data_dir)):
+        if not filename.endswith('.h'):
+            continue
+        with open(os.path.join(data_dir, filename)) as f:
+            text = f.read()
+        note = RAW_NOTE.search(text)
+        length = re.search(r'#define \w+TilesLen (\d+)', text)
+        if note and length:
+            raw_total += int(note.group(1))
+            packed_total += int(length.group(1))
+            count += 1
+
+    print('compressed images: %d, %d -> %d bytes, %d bytes of rom saved' %
+          (count, raw_total, packed_total, raw_total - packed_total))
+
+
+if __name__ == '__main__':
+    if len(sys.argv) == 3 and sys.argv[1] == '--report':
+        report(sys.argv[2])
+    elif len(sys.argv) == 3:
+        compress_image(sys.argv[1], sys.argv[2])
+    else:
+        print('usage: compress_image.py <image.s> <image.h>')
+        print('       compress_image.py --report <data dir>')
+        sys.exit(1)
@@ -0,0 +1,199 @@
+
+# Converts a music track of eight bit signed pcm samples, e.g.
+# data/music_waves.s and data/music_waves.hpp, to four bit ima adpcm, in place.
+# See source/platform/adpcm.hpp for the block layout, and for the decoder, which
+# the encoder below mirrors exactly.
+#
+# usage: encode_adpcm.py <track.s> <track.hpp>
+#        encode_adpcm.py --report <data dir>
+#
+# The build doesn't run the conversion. Convert a track by hand, check in the
+# new .s and .hpp, and switch the track from DEF_PCM_MUSIC to DEF_MUSIC in
+# source/platform/gba/gba_platform.cpp.
+#
+# When converting a track, prints the signal to noise ratio of the decoded
+# samples, measured against the original pcm. With --report, prints the rom
+# space saved by all of the adpcm tracks in the data directory.
+
+import math
+import os
+import re
+import sys
+
+
+BLOCK_WORDS = 512
+BLOCK_SAMPLES = BLOCK_WORDS * 8
+
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767]
+
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def encode(samples):
+    """Returns the encoded track, and the samples that the decoder will
+    produce from it."""
+    out = bytearray()
+    decoded = []
+
+    predictor = 0
+    index = 0
+
+    # Pad to a whole number of words, with silence.
+    samples = samples + [0] * ((-len(samples)) % 8)
+
+    for block in range(0, len(samples), BLOCK_SAMPLES):
+        out += (predictor & 0xffff).to_bytes(2, 'little')
+        out += bytes([index, 0])
+
+        nibbles = []
+        for sample in samples[block:block + BLOCK_SAMPLES]:
+            target = (sample << 8) + 128
+            step = STEP_TABLE[index]
+
+            diff = target - predictor
+            nibble = 0
+            if diff < 0:
+                nibble = 8
+                diff = -diff
+            if diff >= step:
+                nibble |= 4
+                diff -= step
+            if diff >= step >> 1:
+                nibble |= 2
+                diff -= step >> 1
+            if diff >= step >> 2:
+                nibble |= 1
+
+            # Same as adpcm::step().
+            diff = step >> 3
+            if nibble & 4:
+                diff += step
+            if nibble & 2:
+                diff += step >> 1
+            if nibble & 1:
+                diff += step >> 2
+            if nibble & 8:
+                predictor = max(predictor - diff, -32768)
+            else:
+                predictor = min(predictor + diff, 32767)
+            index = min(max(index + INDEX_TABLE[nibble & 7], 0),
+                        len(STEP_TABLE) - 1)
+
+            nibbles.append(nibble)
+            decoded.append(predictor >> 8)
+
+        for i in range(0, len(nibbles), 2):
+            out.append(nibbles[i] | (nibbles[i + 1] << 4))
+
+    return bytes(out), decoded
+
+
+def snr(original, decoded):
+    signal = sum(s * s for s in original)
+    noise = sum((a - b) ** 2 for a, b in zip(original, decoded))
+    if noise == 0:
+        return float('inf')
+    return 10 * math.log10(signal / noise)
+
+
+def parse_bytes(lines, symbol):
+    start = lines.index(symbol + ':') + 1
+    result = []
+    for line in lines[start:]:
+        line = line.strip()
+        if not line:
+            continue
+        if not line.startswith('.byte'):
+            break
+        result += [int(b, 16) for b in line[len('.byte'):].split(',')]
+    return result
+
+
+def encode_track(s_path, h_path):
+    name = os.path.splitext(os.path.basename(s_path))[0]
+
+    with open(h_path) as f:
+        h_text = f.read()
+
+    if '%sSamples' % name in h_text:
+        print('%s: already adpcm' % name)
+        return
+
+    length = int(re.search(r'constexpr int %sLen = (\d+);' % name,
+                           h_text).group(1))
+
+    with open(s_path) as f:
+        s_lines = f.read().split('\n')
+
+    raw = parse_bytes(s_lines, name)[:length]
+    samples = [b - 256 if b > 127 else b for b in raw]
+
+    packed, decoded = encode(samples)
+
+    # Like the pcm tracks, sixteen bytes to a line, with a blank line every
+    # eight lines.
+    lines = ['\t.section .rodata',
+             '\t.align\t2',
+             '\t.global %s\t\t@ %d bytes' % (name, len(packed)),
+             '%s:' % name]
+    for i in range(0, len(packed), 16):
+        if i and i % 128 == 0:
+            lines.append('')
+        lines.append('\t.byte ' + ','.join('0x%02X' % b
+                                           for b in packed[i:i + 16]))
+    lines += ['\t.size\t%s, .-%s' % (name, name), '']
+
+    with open(s_path, 'w') as f:
+        f.write('\n'.join(lines))
+
+    with open(h_path, 'w') as f:
+        f.write('#pragma once\n')
+        f.write('// ima adpcm, see platform/adpcm.hpp\n')
+        f.write('constexpr int %sLen = %d;\n' % (name, len(packed)))
+        f.write('constexpr int %sSamples = %d;\n' % (name, len(samples)))
+        f.write('extern const unsigned char %s[%sLen];\n' % (name, name))
+
+    print('%s: %d -> %d bytes, snr %.1f dB' %
+          (name, len(samples), len(packed),
+           snr(samples, decoded[:len(samples)])))
+
+
+def report(data_dir):
+    raw_total = 0
+    packed_total = 0
+    count = 0
+
+    for filename in sorted(os.listdir(data_dir)):
+        if not filename.endswith('.hpp'):
+            continue
+        with open(os.path.join(data_dir, filename)) as f:
+            text = f.read()
+        samples = re.search(r'constexpr int \w+Samples = (\d+);', text)
+        length = re.search(r'constexpr int \w+Len = (\d+);', text)
+        if samples and length:
+            raw_total += int(samples.group(1))
+            packed_total += int(length.group(1))
+            count += 1
+
+    print('adpcm tracks: %d, %d -> %d bytes, %d bytes of rom saved' %
+          (count, raw_total, packed_total, raw_total - packed_total))
+
+
+if __name__ == '__main__':
+    if len(sys.argv) == 3 and sys.argv[1] == '--report':
+        report(sys.argv[2])
+    elif len(sys.argv) == 3:
+        encode_track(sys.argv[1], sys.argv[2])
+    else:
+        print('usage: encode_adpcm.py <track.s> <track.hpp>')
+        print('       encode_adpcm.py --report <data dir>')
+        sys.exit(1)
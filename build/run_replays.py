@@ -0,0 +1,124 @@
+# Plays back each replay listed in replays/budgets.txt, with a desktop build of
+# the game, and checks the frame time percentiles that the game reports at the
+# end of playback (see source/start.cpp) against the replay's budget.
+#
+# usage: run_replays.py <BlindJump executable> <replays dir> [timeout seconds]
+#
+# The game opens a window, so run this somewhere with a display. Each replay
+# runs in a temporary working directory, so playback doesn't touch the save
+# file, or the log, of whoever runs the script. Exits with a nonzero status if
+# a replay fails to play, or runs over budget.
+
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+
+RESULT = re.compile(
+    r'(update|render) us: p50 (\d+), p99 (\d+), max (\d+) \((\d+) frames\)')
+
+
+def read_budgets(path):
+    """Returns a list of (replay, {(kind, percentile): microseconds}). A missing
+    budgets file has no replays."""
+    budgets = []
+    if not os.path.exists(path):
+        return budgets
+    with open(path) as f:
+        for line in f:
+            fields = line.split('#', 1)[0].split()
+            if not fields:
+                continue
+            if len(fields) != 5:
+                raise ValueError('bad budget line: ' + line.strip())
+            limits = [int(field) for field in fields[1:]]
+            budgets.append((fields[0], {
+                ('update', 'p50'): limits[0],
+                ('update', 'p99'): limits[1],
+                ('render', 'p50'): limits[2],
+                ('render', 'p99'): limits[3],
+            }))
+    return budgets
+
+
+def play(executable, replay, timeout):
+    """Returns {(kind, percentile): microseconds} for the replay, or None if
+    the game didn't report any frame times."""
+    with tempfile.TemporaryDirectory() as cwd:
+        try:
+            output = subprocess.run([executable, '--replay', replay],
+                                    cwd=cwd,
+                                    stdout=subprocess.PIPE,
+                                    stderr=subprocess.STDOUT,
+                                    universal_newlines=True,
+                                    timeout=timeout).stdout
+        except subprocess.TimeoutExpired:
+            print('%s: timed out after %d seconds' % (replay, timeout))
+            return None
+
+    times = {}
+    for match in RESULT.finditer(output):
+        kind = match.group(1)
+        times[(kind, 'p50')] = int(match.group(2))
+        times[(kind, 'p99')] = int(match.group(3))
+        times[(kind, 'max')] = int(match.group(4))
+
+    if not times:
+        for line in output.splitlines():
+            if line.startswith('[error]'):
+                print('%s: %s' % (replay, line))
+        return None
+
+    return times
+
+
+def main():
+    if len(sys.argv) not in (3, 4):
+        print('usage: run_replays.py <BlindJump executable> <replays dir> '
+              '[timeout seconds]')
+        sys.exit(1)
+
+    executable = os.path.abspath(sys.argv[1])
+    budgets = read_budgets(os.path.join(sys.argv[2], 'budgets.txt'))
+    timeout = int(sys.argv[3]) if len(sys.argv) == 4 else 600
+
+    if not budgets:
+        print('no replays listed in %s' % os.path.join(sys.argv[2],
+                                                       'budgets.txt'))
+        sys.exit(0)
+
+    ok = True
+
+    for replay, limits in budgets:
+        times = play(executable, replay, timeout)
+        if times is None:
+            print('%s: FAILED, no frame times reported' % replay)
+            ok = False
+            continue
+
+        over = []
+        for key, limit in sorted(limits.items()):
+            if times.get(key, 0) > limit:
+                over.append('%s %s %d us > %d us' %
+                            (key[0], key[1], times[key], limit))
+
+        print('%s: update p50 %d p99 %d max %d, render p50 %d p99 %d max %d'
+              % (replay,
+                 times.get(('update', 'p50'), 0),
+                 times.get(('update', 'p99'), 0),
+                 times.get(('update', 'max'), 0),
+                 times.get(('render', 'p50'), 0),
+                 times.get(('render', 'p99'), 0),
+                 times.get(('render', 'max'), 0)))
+
+        if over:
+            print('%s: OVER BUDGET, %s' % (replay, ', '.join(over)))
+            ok = False
+
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
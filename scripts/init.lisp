@@ -77,7 +77,14 @@
 
       (register-controller 1356 616 1 0 9 4 5) ;; Sony PS3 Controller
       (register-controller 1356 1476 2 1 9 4 5)   ;; Sony PS4 Controller
-      (set 'network-port 50001)))
+      (set 'network-port 50001)
+
+      ;; Hint: set network-loopback to connect multiplayer peers over a
+      ;; simulated serial link within one process, rather than over tcp.
+      ;; Optional link parameters: loopback-interval, loopback-latency,
+      ;; loopback-jitter (microseconds), and loopback-loss (percent).
+      ;; (set 'network-loopback 1)
+      ))
 
 
 ;; Parameters to control the cellular automata for level generation
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "number/int.h"
+#include <array>
+
+
+// The platform looks up sounds, music, textures, and files by name. Rather than
+// comparing strings against each entry in an asset table, we identify assets
+// by a hash of their names, and index each table with a perfect hash, built at
+// compile time, so that resolving an asset costs one multiply and a single
+// integer compare.
+//
+// Write names known at compile time as literals, e.g. "explosion1"_asset. A
+// plain string, e.g. a name passed in from a script, converts implicitly, and
+// hashes the name at runtime.
+
+
+// 32 bit FNV-1a.
+constexpr u32 asset_hash(const char* name, u32 hash = 2166136261u)
+{
+    while (*name) {
+        hash ^= (u8)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+
+// Hash of the path folder/name, for asset tables keyed by directory.
+constexpr u32 asset_path_hash(const char* folder, const char* name)
+{
+    return asset_hash(name, asset_hash("/", asset_hash(folder)));
+}
+
+
+struct AssetId {
+    constexpr AssetId(const char* name) : name_(name), hash_(asset_hash(name))
+    {
+    }
+
+    // Kept around for error messages, and for platforms that load assets from
+    // the filesystem by name.
+    const char* name_;
+    u32 hash_;
+};
+
+
+constexpr AssetId operator""_asset(const char* name, std::size_t)
+{
+    return AssetId(name);
+}
+
+
+// Deliberately not constexpr: calling it while building an index at compile
+// time halts compilation.
+inline void duplicate_asset_hash()
+{
+}
+
+
+// A perfect hash over an asset table's name hashes. We search for a seed that
+// maps every entry to a distinct slot, with at least count^2/2 slots, so that
+// we usually find one within a few attempts.
+//
+// NOTE: Like any hash lookup, a name missing from the table could collide with
+// the hash of an entry. With 32 bit hashes, and tables of a few dozen assets,
+// we accept the risk.
+template <u32 count> class AssetIndex {
+public:
+    static_assert(count > 0 and count < 255, "slots hold an 8 bit index");
+
+
+    template <typename Key> constexpr AssetIndex(Key key)
+    {
+        for (u32 i = 0; i < count; ++i) {
+            hashes_[i] = key(i);
+
+            for (u32 j = 0; j < i; ++j) {
+                if (hashes_[j] == hashes_[i]) {
+                    duplicate_asset_hash();
+                }
+            }
+        }
+
+        // We checked for duplicates above, so we'll eventually find a seed.
+        for (seed_ = 0;; ++seed_) {
+            if (place_all()) {
+                return;
+            }
+        }
+    }
+
+
+    // Returns the table index of the asset, or -1.
+    constexpr s32 find(u32 hash) const
+    {
+        const u8 slot = slots_[slot_of(hash, seed_)];
+        if (slot and hashes_[slot - 1] == hash) {
+            return slot - 1;
+        }
+        return -1;
+    }
+
+
+private:
+    static constexpr u32 slot_bits()
+    {
+        const u32 min_slots =
+            count * count / 2 > count * 2 ? count * count / 2 : count * 2;
+
+        u32 bits = 1;
+        while ((u32(1) << bits) < min_slots) {
+            ++bits;
+        }
+        return bits;
+    }
+
+
+    static constexpr const u32 slot_count = 1 << slot_bits();
+
+
+    static constexpr u32 slot_of(u32 hash, u32 seed)
+    {
+        return ((hash ^ seed) * 2654435769u) >> (32 - slot_bits());
+    }
+
+
+    constexpr bool place_all()
+    {
+        for (auto& slot : slots_) {
+            slot = 0;
+        }
+
+        for (u32 i = 0; i < count; ++i) {
+            auto& slot = slots_[slot_of(hashes_[i], seed_)];
+            if (slot) {
+                return false;
+            }
+            slot = i + 1;
+        }
+
+        return true;
+    }
+
+
+    std::array<u32, count> hashes_{};
+    std::array<u8, slot_count> slots_{};
+    u32 seed_ = 0;
+};
+
+
+// Indexes a table of entries, keyed by the hash that key(entry) returns.
+template <typename T, u32 count, typename Key>
+constexpr AssetIndex<count> make_asset_index(const T (&entries)[count], Key key)
+{
+    return AssetIndex<count>([&](u32 i) { return key(entries[i]); });
+}
+
+
+// Indexes a table of structs with a name_ member.
+template <typename T, u32 count>
+constexpr AssetIndex<count> make_asset_index(const T (&entries)[count])
+{
+    return make_asset_index(
+        entries, [](const T& entry) { return asset_hash(entry.name_); });
+}
+
+
+template <typename T, u32 count>
+constexpr const T* find_asset(const T (&entries)[count],
+                              const AssetIndex<count>& index,
+                              AssetId id)
+{
+    const auto i = index.find(id.hash_);
+    return i == -1 ? nullptr : &entries[i];
+}
@@ -0,0 +1,303 @@
+#include "dataStream.hpp"
+
+
+// The gba link cable manages roughly eighty messages per second in each
+// direction, so we leave about half of the link for gameplay messages.
+static const int serial_cable_messages_per_second = 40;
+static const int internet_messages_per_second = 480;
+
+// Caps the budget that a stream can save up while idle.
+static const int max_budget = 8;
+
+// When the receiver stops getting chunks for this long, it re-requests the ones
+// that it's missing. The timeout doubles each time it expires without
+// progress.
+static const Microseconds initial_timeout = milliseconds(250);
+static const Microseconds max_timeout = seconds(2);
+
+static const Microseconds announce_interval = seconds(1);
+
+
+bool DataStreams::send(u16 stream_id, const byte* data, u32 length)
+{
+    if (outgoing_) {
+        return false;
+    }
+
+    outgoing_.emplace();
+    outgoing_->stream_id_ = stream_id;
+    outgoing_->data_ = data;
+    outgoing_->length_ = length;
+
+    return true;
+}
+
+
+void DataStreams::reset()
+{
+    outgoing_.reset();
+    incoming_.reset();
+    last_completed_.reset();
+}
+
+
+bool DataStreams::spend_budget()
+{
+    if (budget_ > 0) {
+        --budget_;
+        return true;
+    }
+    return false;
+}
+
+
+bool DataStreams::request(Platform& pfrm, u32 first, u32 count)
+{
+    if (not spend_budget()) {
+        return false;
+    }
+
+    net_event::DataStreamReadRequest r;
+    r.header_.message_type_ = net_event::DataStreamReadRequest::mt;
+    r.stream_id_.set(incoming_->stream_id_);
+    r.stream_index_.set(first);
+    r.chunk_count_ = count;
+
+    return pfrm.network_peer().send_message({(byte*)&r, sizeof r});
+}
+
+
+void DataStreams::update(Platform& pfrm, Microseconds delta)
+{
+    const auto rate = pfrm.network_peer().interface() ==
+                              Platform::NetworkPeer::Interface::serial_cable
+                          ? serial_cable_messages_per_second
+                          : internet_messages_per_second;
+
+    refill_timer_ += delta;
+    while (refill_timer_ >= seconds(1) / rate) {
+        refill_timer_ -= seconds(1) / rate;
+        budget_ = std::min(budget_ + 1, max_budget);
+    }
+
+    if (incoming_) {
+        auto& in = *incoming_;
+
+        const auto total = chunk_count(in.length_);
+
+        in.timer_ -= delta;
+
+        if (in.timer_ <= 0 and in.next_request_ > in.base_) {
+            // Selective retransmit: ask again for each run of missing chunks.
+            for (u32 i = in.base_; i < in.next_request_;) {
+                if (in.received_.get(i % window_size)) {
+                    ++i;
+                    continue;
+                }
+
+                u32 count = 1;
+                while (i + count < in.next_request_ and
+                       not in.received_.get((i + count) % window_size)) {
+                    ++count;
+                }
+
+                if (not request(pfrm, i, count)) {
+                    break;
+                }
+
+                i += count;
+            }
+
+            in.timeout_ = std::min(in.timeout_ * 2, max_timeout);
+            in.timer_ = in.timeout_;
+        }
+
+        // Open up the window. We wait until a quarter of the window is free,
+        // rather than requesting chunks one at a time, to save on requests.
+        const auto window_end = std::min(in.base_ + window_size, total);
+        const auto available = window_end - in.next_request_;
+
+        if (available >= window_size / 4 or
+            (available and window_end == total)) {
+            if (request(pfrm, in.next_request_, available)) {
+                in.next_request_ = window_end;
+                in.timer_ = in.timeout_;
+            }
+        }
+    }
+
+    if (outgoing_) {
+        auto& out = *outgoing_;
+
+        if (out.runs_.empty()) {
+            out.announce_timer_ -= delta;
+
+            if (out.announce_timer_ <= 0 and spend_budget()) {
+                out.announce_timer_ = announce_interval;
+
+                net_event::DataStreamAvail a;
+                a.header_.message_type_ = net_event::DataStreamAvail::mt;
+                a.stream_id_.set(out.stream_id_);
+                a.stream_length_.set(out.length_);
+
+                pfrm.network_peer().send_message({(byte*)&a, sizeof a});
+            }
+        }
+
+        while (not out.runs_.empty() and budget_ > 0) {
+            auto& run = *out.runs_.begin();
+
+            Chunk c;
+            c.header_.message_type_ = Chunk::mt;
+            c.sequence_ = run.first_;
+
+            const auto offset = run.first_ * Chunk::chunk_size;
+            const auto len = std::min(out.length_ - offset, Chunk::chunk_size);
+
+            __builtin_memset(c.data_, 0, sizeof c.data_);
+            __builtin_memcpy(c.data_, out.data_ + offset, len);
+
+            if (not pfrm.network_peer().send_message({(byte*)&c, sizeof c})) {
+                break;
+            }
+
+            --budget_;
+
+            ++run.first_;
+            if (--run.count_ == 0) {
+                out.runs_.erase(out.runs_.begin());
+            }
+        }
+    }
+}
+
+
+void DataStreams::receive(Platform& pfrm, const net_event::DataStreamAvail& m)
+{
+    const auto id = m.stream_id_.get();
+
+    if (incoming_) {
+        // Either a repeat announcement of the current stream, or someone's
+        // trying to send us a second stream. The sender will announce it
+        // again later.
+        return;
+    }
+
+    if (last_completed_ and *last_completed_ == id) {
+        // The sender must have missed our done message.
+        net_event::DataStreamDoneReading d;
+        d.stream_id_.set(id);
+        net_event::transmit(pfrm, d);
+        return;
+    }
+
+    const auto length = m.stream_length_.get();
+
+    byte* dest = sink_ ? sink_->accept(id, length) : nullptr;
+    if (dest == nullptr) {
+        return;
+    }
+
+    incoming_.emplace();
+    incoming_->stream_id_ = id;
+    incoming_->data_ = dest;
+    incoming_->length_ = length;
+    incoming_->timeout_ = initial_timeout;
+    incoming_->timer_ = initial_timeout;
+
+    if (length == 0) {
+        net_event::DataStreamDoneReading d;
+        d.stream_id_.set(id);
+        net_event::transmit(pfrm, d);
+
+        incoming_.reset();
+        last_completed_ = id;
+        sink_->complete(id);
+    }
+}
+
+
+void DataStreams::receive(Platform&, const net_event::DataStreamReadRequest& m)
+{
+    if (not outgoing_ or m.stream_id_.get() not_eq outgoing_->stream_id_) {
+        return;
+    }
+
+    auto& out = *outgoing_;
+
+    const auto total = chunk_count(out.length_);
+    const auto first = m.stream_index_.get();
+
+    if (first >= total) {
+        return;
+    }
+
+    const u32 count = std::min(u32(m.chunk_count_), total - first);
+
+    // If we're too far behind, drop the request. The receiver will ask again.
+    out.runs_.push_back({first, count});
+
+    out.announce_timer_ = announce_interval;
+}
+
+
+void DataStreams::receive(Platform& pfrm,
+                          const net_event::DataStreamReadResponse& m)
+{
+    if (not incoming_) {
+        return;
+    }
+
+    auto& in = *incoming_;
+
+    const u8 offset = m.sequence_ - u8(in.base_);
+    if (offset >= window_size) {
+        return; // A duplicate of a chunk that we already have.
+    }
+
+    const auto total = chunk_count(in.length_);
+    const auto chunk = in.base_ + offset;
+
+    if (chunk >= total or in.received_.get(chunk % window_size)) {
+        return;
+    }
+
+    const auto pos = chunk * Chunk::chunk_size;
+    __builtin_memcpy(in.data_ + pos,
+                     m.data_,
+                     std::min(in.length_ - pos, Chunk::chunk_size));
+
+    in.received_.set(chunk % window_size, true);
+
+    while (in.base_ < total and in.received_.get(in.base_ % window_size)) {
+        in.received_.set(in.base_ % window_size, false);
+        ++in.base_;
+    }
+
+    // We're making progress, so give the sender more time.
+    in.timeout_ = initial_timeout;
+    in.timer_ = initial_timeout;
+
+    if (in.base_ == total) {
+        const auto id = in.stream_id_;
+
+        net_event::DataStreamDoneReading d;
+        d.stream_id_.set(id);
+        net_event::transmit(pfrm, d);
+
+        incoming_.reset();
+        last_completed_ = id;
+
+        if (sink_) {
+            sink_->complete(id);
+        }
+    }
+}
+
+
+void DataStreams::receive(Platform&, const net_event::DataStreamDoneReading& m)
+{
+    if (outgoing_ and m.stream_id_.get() == outgoing_->stream_id_) {
+        outgoing_.reset();
+    }
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "bitvector.hpp"
+#include "memory/buffer.hpp"
+#include "network_event.hpp"
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// DataStreams transfer buffers of arbitrary size between multiplayer peers,
+// over the twelve byte message channel, without stalling gameplay. The
+// receiver drives the protocol:
+//
+// 1) The sender announces a stream with DataStreamAvail.
+//
+// 2) The receiver requests runs of ten byte chunks with DataStreamReadRequest,
+//    never asking for chunks beyond window_size past the oldest chunk that it's
+//    still missing. The window serves as flow control: the sender only
+//    transmits chunks that the receiver asked for.
+//
+// 3) The sender answers with one DataStreamReadResponse per chunk, tagged with
+//    the low bits of the chunk index.
+//
+// 4) If responses stop arriving, the receiver re-requests only the chunks that
+//    it's missing, backing off if the link stays quiet.
+//
+// 5) Once the receiver has every chunk, it sends DataStreamDoneReading. Until
+//    then, an idle sender periodically re-announces the stream, in case the
+//    announcement (or the done message) went missing.
+//
+// Both ends draw from a small per-frame message budget, so that streams never
+// crowd gameplay messages off of the link.
+//
+// We only support one outgoing and one incoming stream at a time.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+class DataStreams {
+public:
+    using Chunk = net_event::DataStreamReadResponse;
+
+    static constexpr const u32 window_size = 32;
+
+    // Accepts incoming streams.
+    class Sink {
+    public:
+        virtual ~Sink()
+        {
+        }
+
+        // Return a buffer with room for at least length bytes to accept the
+        // stream, or nullptr to reject it.
+        virtual byte* accept(u16 stream_id, u32 length) = 0;
+
+        virtual void complete(u16 stream_id) = 0;
+    };
+
+    void set_sink(Sink* sink)
+    {
+        sink_ = sink;
+    }
+
+    // NOTE: The data must remain valid until sending() returns false.
+    bool send(u16 stream_id, const byte* data, u32 length);
+
+    bool sending() const
+    {
+        return static_cast<bool>(outgoing_);
+    }
+
+    bool receiving() const
+    {
+        return static_cast<bool>(incoming_);
+    }
+
+    // Abandons any streams in progress, e.g. after a disconnect.
+    void reset();
+
+    void update(Platform& pfrm, Microseconds delta);
+
+    void receive(Platform& pfrm, const net_event::DataStreamAvail& m);
+    void receive(Platform& pfrm, const net_event::DataStreamReadRequest& m);
+    void receive(Platform& pfrm, const net_event::DataStreamReadResponse& m);
+    void receive(Platform& pfrm, const net_event::DataStreamDoneReading& m);
+
+private:
+    static u32 chunk_count(u32 length)
+    {
+        return (length + Chunk::chunk_size - 1) / Chunk::chunk_size;
+    }
+
+    bool spend_budget();
+
+    bool request(Platform& pfrm, u32 first, u32 count);
+
+    struct Run {
+        u32 first_;
+        u32 count_;
+    };
+
+    struct Outgoing {
+        u16 stream_id_;
+        const byte* data_;
+        u32 length_;
+
+        // Chunks requested by the receiver, but not yet sent.
+        Buffer<Run, 8> runs_;
+
+        Microseconds announce_timer_ = 0;
+    };
+
+    struct Incoming {
+        u16 stream_id_;
+        byte* data_;
+        u32 length_;
+
+        u32 base_ = 0;         // The oldest chunk that we're still missing.
+        u32 next_request_ = 0; // The first chunk that we haven't asked for.
+
+        // Chunks received within the window, indexed by chunk % window_size.
+        Bitvector<window_size> received_;
+
+        Microseconds timeout_;
+        Microseconds timer_;
+    };
+
+    std::optional<Outgoing> outgoing_;
+    std::optional<Incoming> incoming_;
+    std::optional<u16> last_completed_;
+
+    Sink* sink_ = nullptr;
+
+    // Number of messages that we may transmit right now. Refills at a rate that
+    // depends on the network interface, see update().
+    int budget_ = 0;
+    Microseconds refill_timer_ = 0;
+};
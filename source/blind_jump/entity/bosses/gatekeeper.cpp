@@ -569,7 +569,7 @@ void Gatekeeper::update(Platform& pfrm, Game& game, Microseconds dt)
 void Gatekeeper::injured(Platform& pfrm, Game& game, Health amount)
 {
     if (sprite_.get_mix().amount_ < 180) {
-        pfrm.sleep(2);
+        game.freeze(2);
     }
 
     damage_ += amount;
@@ -579,7 +579,7 @@ void Gatekeeper::injured(Platform& pfrm, Game& game, Health amount)
     debit_health(pfrm, amount);
 
     if (alive()) {
-        pfrm.speaker().play_sound("click", 1, position_);
+        pfrm.speaker().play_sound("click"_asset, 1, position_);
     }
 
     if (not was_second_form and second_form()) {
@@ -834,7 +834,7 @@ void GatekeeperShield::on_collision(Platform& pfrm, Game& game, AlliedOrbShot&)
 
 void GatekeeperShield::on_death(Platform& pfrm, Game& game)
 {
-    pfrm.sleep(5);
+    game.freeze(5);
 
     static const Item::Type item_drop_vec[] = {Item::Type::coin,
                                                Item::Type::null};
@@ -19,6 +19,7 @@ public:
 
     static constexpr bool multiface_sprite = true;
     static constexpr bool has_shadow = true;
+    static constexpr SpritePriority sprite_priority = SpritePriority::boss;
 
     inline LocaleString defeated_text() const
     {
@@ -101,6 +102,8 @@ private:
 
 class GatekeeperShield : public Enemy {
 public:
+    static constexpr SpritePriority sprite_priority = SpritePriority::boss;
+
     // enum class State { orbit, encircle, detached };
 
     class AttackPattern {
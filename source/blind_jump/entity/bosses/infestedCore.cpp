@@ -109,7 +109,7 @@ void InfestedCore::update(Platform& pfrm, Game& game, Microseconds dt)
             }
 
             if (game.enemies().get<InfestedCore>().begin()->get() == this) {
-                pfrm.speaker().play_music("omega", 0);
+                pfrm.speaker().play_music("omega"_asset, 0);
             }
         }
         break;
@@ -258,13 +258,13 @@ void InfestedCore::injured(Platform& pfrm, Game& game, Health amount)
     }
 
     if (sprite_.get_mix().amount_ < 180) {
-        pfrm.sleep(2);
+        game.freeze(2);
     }
 
     damage_ += amount;
 
     if (alive()) {
-        pfrm.speaker().play_sound("click", 1, position_);
+        pfrm.speaker().play_sound("click"_asset, 1, position_);
     }
 
     if (get_health() > 1) {
@@ -273,7 +273,7 @@ void InfestedCore::injured(Platform& pfrm, Game& game, Health amount)
         if (sprite_.get_texture_index() not_eq 48) {
             game.effects().clear();
             big_explosion(pfrm, game, position_);
-            pfrm.speaker().play_sound("explosion1", 3, position_);
+            pfrm.speaker().play_sound("explosion1"_asset, 3, position_);
             sprite_.set_texture_index(48);
             push_notification(
                 pfrm,
@@ -17,6 +17,7 @@ public:
 
     static constexpr bool multiface_sprite = true;
     static constexpr bool has_shadow = true;
+    static constexpr SpritePriority sprite_priority = SpritePriority::boss;
 
     Buffer<const Sprite*, 2> get_sprites() const
     {
@@ -121,7 +121,7 @@ void Twin::Helper::update(Platform& pf,
     case Helper::State::shoot1:
         if (timer_ > milliseconds(150)) {
             timer_ = 0;
-            pf.speaker().play_sound("laser1", 4, sprite_.get_position());
+            pf.speaker().play_sound("laser1"_asset, 4, sprite_.get_position());
             if (game.effects().spawn<OrbShot>(
                     shoot_pos, target.get_position(), 0.00015f, seconds(2))) {
             }
@@ -135,7 +135,7 @@ void Twin::Helper::update(Platform& pf,
     case Helper::State::shoot2:
         if (timer_ > milliseconds(150)) {
             timer_ = 0;
-            pf.speaker().play_sound("laser1", 4, sprite_.get_position());
+            pf.speaker().play_sound("laser1"_asset, 4, sprite_.get_position());
             if (game.effects().spawn<OrbShot>(
                     shoot_pos, target.get_position(), 0.00015f, seconds(2))) {
             }
@@ -149,7 +149,7 @@ void Twin::Helper::update(Platform& pf,
     case Helper::State::shoot3:
         if (timer_ > milliseconds(150)) {
             timer_ = 0;
-            pf.speaker().play_sound("laser1", 4, sprite_.get_position());
+            pf.speaker().play_sound("laser1"_asset, 4, sprite_.get_position());
             if (game.effects().spawn<OrbShot>(
                     shoot_pos, target.get_position(), 0.00015f, seconds(2))) {
             }
@@ -257,7 +257,7 @@ void Twin::update(Platform& pf, Game& game, Microseconds dt)
             if (timer_ > seconds(2)) {
                 if (auto s = sibling(game)) {
                     if (s->id() < id()) {
-                        pf.speaker().play_music("omega", 0);
+                        pf.speaker().play_music("omega"_asset, 0);
                     }
                 }
                 state_ = State::idle;
@@ -274,7 +274,7 @@ void Twin::update(Platform& pf, Game& game, Microseconds dt)
         if (sprite_.get_mix().amount_ == 0) {
             set_health(std::max(get_health(), Health(20)));
             state_ = State::mutate;
-            pf.load_sprite_texture("spritesheet_boss2_mutate");
+            pf.load_sprite_texture("spritesheet_boss2_mutate"_asset);
         }
         break;
 
@@ -291,14 +291,14 @@ void Twin::update(Platform& pf, Game& game, Microseconds dt)
                 set_sprite(index + 2);
             } else {
                 state_ = State::mutate_done;
-                pf.load_sprite_texture("spritesheet_boss2_final");
+                pf.load_sprite_texture("spritesheet_boss2_final"_asset);
                 helper_.sprite_.set_texture_index(65);
             }
         }
         break;
 
     case State::mutate_done:
-        pf.speaker().play_music("omega", 0);
+        pf.speaker().play_music("omega"_asset, 0);
         state_ = State::mode2_idle;
         break;
 
@@ -798,11 +798,11 @@ void Twin::update(Platform& pf, Game& game, Microseconds dt)
 void Twin::injured(Platform& pfrm, Game& game, Health amount)
 {
     if (sprite_.get_mix().amount_ < 180) {
-        pfrm.sleep(2);
+        game.freeze(2);
     }
 
     if (alive()) {
-        pfrm.speaker().play_sound("click", 1, position_);
+        pfrm.speaker().play_sound("click"_asset, 1, position_);
     }
 
     damage_ += amount;
@@ -872,11 +872,11 @@ void Twin::on_death(Platform& pf, Game& game)
     if (sibling(game) == nullptr) {
         sprite_.set_alpha(Sprite::Alpha::transparent);
         head_.set_alpha(Sprite::Alpha::transparent);
-        pf.load_sprite_texture("spritesheet_boss2_done");
+        pf.load_sprite_texture("spritesheet_boss2_done"_asset);
         return;
     }
 
-    pf.speaker().play_sound("explosion1", 3, position_);
+    pf.speaker().play_sound("explosion1"_asset, 3, position_);
 
     for (int i = 0; i < 2; ++i) {
         game.details().spawn<Item>(
@@ -17,6 +17,7 @@ public:
 
     static constexpr bool multiface_sprite = true;
     static constexpr bool multiface_shadow = true;
+    static constexpr SpritePriority sprite_priority = SpritePriority::boss;
 
     constexpr bool is_allied()
     {
@@ -552,7 +552,7 @@ void Wanderer::injured(Platform& pf, Game& game, Health amount)
     const bool was_second_form = second_form(game);
 
     if (sprite_.get_mix().amount_ < 180) {
-        pf.sleep(2);
+        game.freeze(2);
     }
 
     damage_ += amount;
@@ -560,7 +560,7 @@ void Wanderer::injured(Platform& pf, Game& game, Health amount)
     debit_health(pf, amount);
 
     if (alive()) {
-        pf.speaker().play_sound("click", 1, position_);
+        pf.speaker().play_sound("click"_asset, 1, position_);
     }
 
     if (not was_second_form and second_form(game)) {
@@ -16,6 +16,7 @@ public:
     Wanderer(const Vec2<Float>& position);
 
     static constexpr bool multiface_sprite = true;
+    static constexpr SpritePriority sprite_priority = SpritePriority::boss;
 
     constexpr bool is_allied()
     {
@@ -51,7 +51,7 @@ void Item::on_collision(Platform& pf, Game& game, Player&)
     }
 #endif
 
-    pf.sleep(5);
+    game.freeze(5);
 }
 
 
@@ -99,7 +99,7 @@ void Item::update(Platform&, Game& game, Microseconds dt)
 
         constexpr auto duration = seconds(1);
 
-        const auto wc = check_wall_collisions(game.tiles(), *this);
+        const auto wc = check_wall_collisions(game.wall_field(), *this);
         if (wc.any()) {
             if ((wc.left and step_.x < 0.f) or (wc.right and step_.x > 0.f)) {
                 step_.x = -step_.x;
@@ -10,6 +10,8 @@ class Player;
 
 class Item : public Entity {
 public:
+    static constexpr SpritePriority sprite_priority = SpritePriority::actor;
+
     enum class Type : u8 {
         null = 0,
         heart = 1,
@@ -111,7 +111,7 @@ void ItemChest::update(Platform& pfrm, Game& game, Microseconds dt)
                             game.score() += 100;
                         }
 
-                        pfrm.sleep(10);
+                        game.freeze(10);
                         state_ = State::opening;
 
                         if (length(game.effects().get<DialogBubble>())) {
@@ -122,7 +122,7 @@ void ItemChest::update(Platform& pfrm, Game& game, Microseconds dt)
                         o.id_.set(id());
                         net_event::transmit(pfrm, o);
 
-                        pfrm.speaker().play_sound("creak", 1, position_);
+                        pfrm.speaker().play_sound("creak"_asset, 1, position_);
                     }
                 }
             } else {
@@ -171,7 +171,7 @@ void ItemChest::sync(Platform& pfrm, const net_event::ItemChestOpened&)
 {
     if (state_ == State::closed_locked or state_ == State::closed_unlocked) {
         animation_.bind(sprite_);
-        pfrm.speaker().play_sound("creak", 1, position_);
+        pfrm.speaker().play_sound("creak"_asset, 1, position_);
         state_ = State::sync_opening;
     }
 }
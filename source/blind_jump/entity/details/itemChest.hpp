@@ -15,6 +15,7 @@ public:
     void update(Platform&, Game&, Microseconds dt);
 
     static constexpr bool has_shadow = true;
+    static constexpr SpritePriority sprite_priority = SpritePriority::actor;
 
     const Sprite& get_shadow() const
     {
@@ -10,6 +10,7 @@ public:
     Scavenger(const Vec2<Float>& pos);
 
     static constexpr bool has_shadow = true;
+    static constexpr SpritePriority sprite_priority = SpritePriority::actor;
 
     const Sprite& get_shadow() const
     {
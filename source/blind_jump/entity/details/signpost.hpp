@@ -15,6 +15,7 @@ public:
     static constexpr bool has_shadow = true;
     static constexpr bool multiface_shadow = true;
     static constexpr bool multiface_sprite = true;
+    static constexpr SpritePriority sprite_priority = SpritePriority::actor;
 
     Type get_type() const
     {
@@ -9,6 +9,8 @@ class Platform;
 
 class Transporter : public Entity {
 public:
+    static constexpr SpritePriority sprite_priority = SpritePriority::actor;
+
     Transporter()
     {
         sprite_.set_texture_index(TextureMap::transporter);
@@ -99,5 +99,5 @@ void ConglomerateShot::on_death(Platform& pf, Game& game)
     game.camera().shake();
 
     medium_explosion(pf, game, position_);
-    pf.speaker().play_sound("explosion1", 3, position_);
+    pf.speaker().play_sound("explosion1"_asset, 3, position_);
 }
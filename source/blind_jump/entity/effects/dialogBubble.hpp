@@ -5,6 +5,8 @@
 
 class DialogBubble : public Entity {
 public:
+    static constexpr SpritePriority sprite_priority = SpritePriority::actor;
+
     DialogBubble(const Vec2<Float>& position, Entity& owner);
 
     void update(Platform& pfrm, Game& game, Microseconds dt);
@@ -13,6 +13,9 @@ class Drone;
 
 class Laser : public Entity {
 public:
+    static constexpr SpritePriority sprite_priority =
+        SpritePriority::projectile;
+
     enum class Mode { normal, explosive };
 
     Laser(const Vec2<Float>& position, Cardinal dir, Mode mode);
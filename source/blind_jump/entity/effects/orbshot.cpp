@@ -1,4 +1,5 @@
 #include "orbshot.hpp"
+#include "blind_jump/game.hpp"
 #include "platform/platform.hpp"
 
 
@@ -50,8 +51,8 @@ void OrbShot::update(Platform& pf, Game& game, Microseconds dt)
 }
 
 
-void OrbShot::on_collision(Platform& pf, Game&, Player&)
+void OrbShot::on_collision(Platform& pf, Game& game, Player&)
 {
     Entity::kill();
-    pf.sleep(5);
+    game.freeze(5);
 }
@@ -6,6 +6,9 @@
 
 class Projectile : public Entity {
 public:
+    static constexpr SpritePriority sprite_priority =
+        SpritePriority::projectile;
+
     Projectile(const Vec2<Float>& position,
                const Vec2<Float>& target,
                Float speed)
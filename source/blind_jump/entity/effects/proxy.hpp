@@ -42,6 +42,7 @@ public:
     }
 
     static constexpr bool multiface_sprite = true;
+    static constexpr SpritePriority sprite_priority = SpritePriority::actor;
 
     auto get_sprites() const
     {
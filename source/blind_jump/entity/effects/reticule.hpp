@@ -6,6 +6,8 @@
 
 class Reticule : public Entity {
 public:
+    static constexpr SpritePriority sprite_priority = SpritePriority::actor;
+
     Reticule(const Vec2<Float>& position)
     {
         set_position(position);
@@ -8,6 +8,7 @@ public:
     UINumber(const Vec2<Float>& position, s8 val, Id parent);
 
     static constexpr bool multiface_sprite = true;
+    static constexpr SpritePriority sprite_priority = SpritePriority::actor;
 
     std::array<const Sprite*, 3> get_sprites() const
     {
@@ -1,4 +1,5 @@
 #include "wandererBigLaser.hpp"
+#include "blind_jump/game.hpp"
 #include "number/random.hpp"
 #include "platform/platform.hpp"
 
@@ -49,8 +50,8 @@ void WandererBigLaser::update(Platform& pf, Game& game, Microseconds dt)
 }
 
 
-void WandererBigLaser::on_collision(Platform& pf, Game&, Player&)
+void WandererBigLaser::on_collision(Platform& pf, Game& game, Player&)
 {
     Entity::kill();
-    pf.sleep(5);
+    game.freeze(5);
 }
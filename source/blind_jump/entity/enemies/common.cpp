@@ -42,7 +42,7 @@ void on_enemy_destroyed(Platform& pfrm,
     }
 
 
-    pfrm.speaker().play_sound("explosion1", 3, position);
+    pfrm.speaker().play_sound("explosion1"_asset, 3, position);
 
 
     const auto tile_coord = to_tile_coord(position.cast<s32>());
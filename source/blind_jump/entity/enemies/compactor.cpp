@@ -110,9 +110,9 @@ void Compactor::update(Platform& pfrm, Game& game, Microseconds dt)
             sprite_.set_position(position_);
             state_ = State::landing;
 
-            pfrm.speaker().play_sound("thud", 5);
+            pfrm.speaker().play_sound("thud"_asset, 5);
 
-            pfrm.sleep(4);
+            game.freeze(4);
             medium_explosion(pfrm, game, position_);
             sprite_.set_mix({current_zone(game).energy_glow_color_, 255});
             sprite_.set_texture_index(107);
@@ -232,14 +232,14 @@ void Compactor::update(Platform& pfrm, Game& game, Microseconds dt)
 
 void Compactor::injured(Platform& pf, Game& game, Health amount)
 {
-    pf.sleep(2);
+    game.freeze(2);
 
     sprite_.set_mix({current_zone(game).injury_glow_color_, 255});
 
     debit_health(pf, amount);
 
     if (alive()) {
-        pf.speaker().play_sound("click", 1, position_);
+        pf.speaker().play_sound("click"_asset, 1, position_);
     } else {
         const auto add_score = 30;
 
@@ -250,7 +250,7 @@ void Compactor::injured(Platform& pf, Game& game, Health amount)
 
 void Compactor::on_death(Platform& pf, Game& game)
 {
-    pf.sleep(5);
+    game.freeze(5);
 
     static const Item::Type item_drop_vec[] = {Item::Type::coin,
                                                Item::Type::null};
@@ -166,7 +166,7 @@ void Dasher::update(Platform& pf, Game& game, Microseconds dt)
                 state_ = State::shot2;
             }
 
-            pf.speaker().play_sound("laser1", 4, position_);
+            pf.speaker().play_sound("laser1"_asset, 4, position_);
             this->shoot(
                 pf,
                 game,
@@ -194,7 +194,7 @@ void Dasher::update(Platform& pf, Game& game, Microseconds dt)
                 state_ = State::pause;
             }
 
-            pf.speaker().play_sound("laser1", 4, position_);
+            pf.speaker().play_sound("laser1"_asset, 4, position_);
             this->shoot(
                 pf,
                 game,
@@ -210,7 +210,7 @@ void Dasher::update(Platform& pf, Game& game, Microseconds dt)
             timer_ -= milliseconds(150);
             state_ = State::pause;
 
-            pf.speaker().play_sound("laser1", 4, position_);
+            pf.speaker().play_sound("laser1"_asset, 4, position_);
             this->shoot(
                 pf,
                 game,
@@ -250,7 +250,7 @@ void Dasher::update(Platform& pf, Game& game, Microseconds dt)
             timer_ -= milliseconds(350);
             next_state();
         }
-        const auto wc = check_wall_collisions(game.tiles(), *this);
+        const auto wc = check_wall_collisions(game.wall_field(), *this);
         if (wc.any()) {
             if ((wc.left and speed_.x < 0.f) or (wc.right and speed_.x > 0.f)) {
                 speed_.x = 0.f;
@@ -279,7 +279,7 @@ void Dasher::update(Platform& pf, Game& game, Microseconds dt)
 
 
         {
-            const auto wc = check_wall_collisions(game.tiles(), *this);
+            const auto wc = check_wall_collisions(game.wall_field(), *this);
             if (wc.any()) {
                 if ((wc.left and speed_.x < 0.f) or
                     (wc.right and speed_.x > 0.f)) {
@@ -347,7 +347,7 @@ void Dasher::update(Platform& pf, Game& game, Microseconds dt)
 void Dasher::injured(Platform& pf, Game& game, Health amount)
 {
     if (sprite_.get_mix().amount_ < 180) {
-        pf.sleep(2);
+        game.freeze(2);
     }
 
     damage_ += amount;
@@ -357,7 +357,7 @@ void Dasher::injured(Platform& pf, Game& game, Health amount)
     const auto c = current_zone(game).injury_glow_color_;
 
     if (alive()) {
-        pf.speaker().play_sound("click", 1, position_);
+        pf.speaker().play_sound("click"_asset, 1, position_);
     } else {
         const auto add_score = 15;
 
@@ -394,7 +394,7 @@ void Dasher::on_collision(Platform& pf, Game& game, AlliedOrbShot&)
 
 void Dasher::on_death(Platform& pf, Game& game)
 {
-    pf.sleep(6);
+    game.freeze(6);
 
     static const Item::Type item_drop_vec[] = {Item::Type::coin,
                                                Item::Type::coin,
@@ -215,7 +215,7 @@ void Drone::update(Platform& pfrm, Game& game, Microseconds dt)
 void Drone::injured(Platform& pf, Game& game, Health amount)
 {
     if (sprite_.get_mix().amount_ < 180) {
-        pf.sleep(2);
+        game.freeze(2);
     }
 
     damage_ += amount;
@@ -225,7 +225,7 @@ void Drone::injured(Platform& pf, Game& game, Health amount)
     debit_health(pf, amount);
 
     if (alive()) {
-        pf.speaker().play_sound("click", 1, position_);
+        pf.speaker().play_sound("click"_asset, 1, position_);
     } else {
         const auto add_score = 10;
 
@@ -266,7 +266,7 @@ void Drone::on_collision(Platform& pf, Game& game, Player& player)
 
 void Drone::on_death(Platform& pf, Game& game)
 {
-    pf.sleep(6);
+    game.freeze(6);
 
     static const Item::Type item_drop_vec[] = {Item::Type::coin,
                                                Item::Type::null};
@@ -126,7 +126,7 @@ void Enemy::health_changed(const net_event::EnemyHealthChanged& hc,
         damage_ = get_health() - hc.new_health_.get();
 
         if (alive()) {
-            pfrm.speaker().play_sound("click", 1, position_);
+            pfrm.speaker().play_sound("click"_asset, 1, position_);
         }
     }
 
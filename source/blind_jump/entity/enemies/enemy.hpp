@@ -29,6 +29,7 @@ public:
     }
 
     static constexpr bool has_shadow = true;
+    static constexpr SpritePriority sprite_priority = SpritePriority::actor;
 
     const Sprite& get_shadow() const
     {
@@ -27,7 +27,7 @@ Golem::Golem(const Vec2<Float>& pos)
 void Golem::injured(Platform& pfrm, Game& game, Health amount)
 {
     if (sprite_.get_mix().amount_ < 180) {
-        pfrm.sleep(2);
+        game.freeze(2);
     }
 
     damage_ += amount;
@@ -37,7 +37,7 @@ void Golem::injured(Platform& pfrm, Game& game, Health amount)
     const auto c = current_zone(game).injury_glow_color_;
 
     if (alive()) {
-        pfrm.speaker().play_sound("click", 1, position_);
+        pfrm.speaker().play_sound("click"_asset, 1, position_);
     } else {
         const auto add_score = 20;
 
@@ -108,7 +108,7 @@ void Golem::update(Platform& pfrm, Game& game, Microseconds dt)
     };
 
     auto check_wall = [&] {
-        const auto wc = check_wall_collisions(game.tiles(), *this);
+        const auto wc = check_wall_collisions(game.wall_field(), *this);
         if (wc.any()) {
             if ((wc.left and speed_.x < 0.f) or (wc.right and speed_.x > 0.f)) {
                 speed_.x = 0.f;
@@ -241,7 +241,7 @@ void Golem::update(Platform& pfrm, Game& game, Microseconds dt)
             }();
 
 
-            pfrm.speaker().play_sound("laser1", 4, position_);
+            pfrm.speaker().play_sound("laser1"_asset, 4, position_);
             this->shoot(pfrm,
                         game,
                         position_,
@@ -295,7 +295,7 @@ void Golem::update(Platform& pfrm, Game& game, Microseconds dt)
 
 void Golem::on_death(Platform& pfrm, Game& game)
 {
-    pfrm.sleep(6);
+    game.freeze(6);
 
     static const Item::Type item_drop_vec[] = {
         Item::Type::coin, Item::Type::heart, Item::Type::null};
@@ -233,8 +233,7 @@ void Scarecrow::update(Platform& pfrm, Game& game, Microseconds dt)
                 move_vec_ = direction(position_, target) * long_jump_speed;
 
                 const auto vec = target - position_;
-                const auto magnitude =
-                    sqrt_approx(vec.x * vec.x + vec.y * vec.y);
+                const auto magnitude = hypot_approx(vec.x, vec.y);
 
                 timer_ = abs(magnitude) / long_jump_speed;
 
@@ -321,7 +320,7 @@ void Scarecrow::update(Platform& pfrm, Game& game, Microseconds dt)
             }()) {
             timer_ = 0;
             if (visible()) {
-                pfrm.speaker().play_sound("laser1", 4, position_);
+                pfrm.speaker().play_sound("laser1"_asset, 4, position_);
 
                 const auto conglomerate_shot_level = [&] {
                     if (game.difficulty() == Settings::Difficulty::easy) {
@@ -385,7 +384,7 @@ void Scarecrow::sync(const net_event::EnemyStateSync& state, Game&)
 void Scarecrow::injured(Platform& pf, Game& game, Health amount)
 {
     if (sprite_.get_mix().amount_ < 180) {
-        pf.sleep(2);
+        game.freeze(2);
     }
 
     damage_ += amount;
@@ -393,7 +392,7 @@ void Scarecrow::injured(Platform& pf, Game& game, Health amount)
     debit_health(pf, amount);
 
     if (alive()) {
-        pf.speaker().play_sound("click", 1, position_);
+        pf.speaker().play_sound("click"_asset, 1, position_);
     } else {
         const auto add_score = 15;
 
@@ -431,7 +430,7 @@ void Scarecrow::on_collision(Platform& pf, Game& game, AlliedOrbShot&)
 
 void Scarecrow::on_death(Platform& pf, Game& game)
 {
-    pf.sleep(6);
+    game.freeze(6);
 
     static const Item::Type item_drop_vec[] = {Item::Type::coin,
                                                Item::Type::coin,
@@ -333,7 +333,7 @@ void SnakeTail::update(Platform& pfrm, Game& game, Microseconds dt)
 
 void SnakeTail::on_death(Platform& pf, Game& game)
 {
-    pf.sleep(5);
+    game.freeze(5);
 
     static const Item::Type item_drop_vec[] = {Item::Type::null};
     on_enemy_destroyed(pf, game, 0, position_, 0, item_drop_vec);
@@ -372,7 +372,7 @@ void SnakeTail::on_collision(Platform& pf, Game& game, AlliedOrbShot&)
 {
     if (not is_allied()) {
         if (sprite_.get_mix().amount_ < 180) {
-            pf.sleep(2);
+            game.freeze(2);
         }
 
         sprite_.set_mix({current_zone(game).injury_glow_color_, 255});
@@ -179,7 +179,7 @@ void Theif::injured(Platform& pfrm, Game& game, Health amount)
     debit_health(pfrm, amount);
 
     if (alive()) {
-        pfrm.speaker().play_sound("click", 1, position_);
+        pfrm.speaker().play_sound("click"_asset, 1, position_);
     } else {
         game.score() += 10;
     }
@@ -188,7 +188,7 @@ void Theif::injured(Platform& pfrm, Game& game, Health amount)
 
 void Theif::on_death(Platform& pf, Game& game)
 {
-    pf.sleep(5);
+    game.freeze(5);
 
     static const Item::Type item_drop_vec[] = {Item::Type::coin,
                                                Item::Type::heart};
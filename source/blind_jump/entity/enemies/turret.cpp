@@ -160,7 +160,7 @@ void Turret::update(Platform& pfrm, Game& game, Microseconds dt)
         if (timer_ > 0) {
             timer_ -= dt;
         } else {
-            pfrm.speaker().play_sound("laser1", 4, position_);
+            pfrm.speaker().play_sound("laser1"_asset, 4, position_);
 
             this->shoot(pfrm, game, origin(), aim(), bullet_speed);
             timer_ = reload(game.level());
@@ -182,7 +182,7 @@ void Turret::update(Platform& pfrm, Game& game, Microseconds dt)
         if (timer_ > 0) {
             timer_ -= dt;
         } else {
-            pfrm.speaker().play_sound("laser1", 4, position_);
+            pfrm.speaker().play_sound("laser1"_asset, 4, position_);
 
             const auto angle = 25;
 
@@ -219,7 +219,7 @@ void Turret::update(Platform& pfrm, Game& game, Microseconds dt)
 void Turret::injured(Platform& pf, Game& game, Health amount)
 {
     if (sprite_.get_mix().amount_ < 180) {
-        pf.sleep(2);
+        game.freeze(2);
     }
 
     damage_ += amount;
@@ -228,7 +228,7 @@ void Turret::injured(Platform& pf, Game& game, Health amount)
     debit_health(pf, amount);
 
     if (alive()) {
-        pf.speaker().play_sound("click", 1, position_);
+        pf.speaker().play_sound("click"_asset, 1, position_);
     } else {
         const auto add_score = 12;
 
@@ -260,7 +260,7 @@ void Turret::on_collision(Platform& pf, Game& game, AlliedOrbShot&)
 
 void Turret::on_death(Platform& pf, Game& game)
 {
-    pf.sleep(6);
+    game.freeze(6);
 
     static const Item::Type item_drop_vec[] = {Item::Type::coin,
                                                Item::Type::coin,
@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include "graphics/sprite.hpp"
+#include "graphics/spriteBudget.hpp"
 
 
 class Platform;
@@ -46,6 +47,11 @@ public:
     static constexpr bool has_shadow = false;
     static constexpr bool multiface_shadow = false;
 
+    // Decides which sprites to drop first, in scenes with more sprites than
+    // the screen can draw (see SpriteBudget).
+    static constexpr SpritePriority sprite_priority =
+        SpritePriority::decoration;
+
 
     void set_health(Health health)
     {
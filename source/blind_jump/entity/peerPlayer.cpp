@@ -3,6 +3,31 @@
 #include "wallCollision.hpp"
 
 
+// Matches the movement rate in Player::update().
+static const Float player_movement_rate = 0.000054f;
+
+
+// How far past the newest snapshot we're willing to guess where the peer went.
+static const Microseconds max_extrapolation = milliseconds(250);
+
+
+static Vec2<Float> peer_velocity(const net_event::PlayerInfo& info)
+{
+    return {-(Float(info.x_speed_) / 10) * player_movement_rate,
+            -(Float(info.y_speed_) / 10) * player_movement_rate};
+}
+
+
+Vec2<Float> PeerPlayer::extrapolate(const net_event::PlayerInfo& info,
+                                    Microseconds elapsed)
+{
+    elapsed = std::min(elapsed, max_extrapolation);
+
+    return Vec2<Float>{Float(info.x_.get()), Float(info.y_.get())} +
+           peer_velocity(info) * Float(elapsed);
+}
+
+
 PeerPlayer::PeerPlayer(Platform& pfrm)
     : dynamic_texture_(pfrm.make_dynamic_texture())
 {
@@ -28,16 +53,35 @@ void PeerPlayer::sync(Platform& pfrm,
         return;
     }
 
-    Vec2<Float> new_pos{static_cast<Float>(info.x_.get()),
-                        static_cast<Float>(info.y_.get())};
-
-    if (distance(position_, new_pos) > 6) {
-        interp_offset_ = position_ - new_pos;
-        position_ = new_pos;
+    Snapshot snapshot;
+    snapshot.position_ = {Float(info.x_.get()), Float(info.y_.get())};
+    snapshot.velocity_ = peer_velocity(info);
+
+    // The timestamps wrap around after a couple of seconds, so after a long
+    // silence, we start over from scratch.
+    if (snapshots_.empty() or since_last_snapshot_ > seconds(1)) {
+        snapshots_.clear();
+        snapshot.time_ = 0;
+        jitter_ = 0;
+        interp_offset_ = {0.f, 0.f};
+        position_ = snapshot.position_;
     } else {
-        position_ = new_pos;
+        const u8 ticks = info.timestamp_ - last_timestamp_;
+        snapshot.time_ = snapshots_.back().time_ +
+                         ticks * net_event::PlayerInfo::timestamp_unit;
     }
 
+    last_timestamp_ = info.timestamp_;
+    since_last_snapshot_ = 0;
+
+    push_snapshot(snapshot);
+
+    // Rather than snapping to the new estimate, carry the difference over into
+    // the offset, which update() gradually decays.
+    const auto displayed = position_ + interp_offset_;
+    position_ = sample(-playout_delay());
+    interp_offset_ = displayed - position_;
+
     if (info.get_visible()) {
         head_.set_alpha(Sprite::Alpha::opaque);
         sprite_.set_alpha(Sprite::Alpha::opaque);
@@ -193,8 +237,6 @@ void PeerPlayer::sync(Platform& pfrm,
     }
 
     sprite_.set_size(Sprite::Size::w32_h32);
-    speed_.x = Float(info.x_speed_) / 10;
-    speed_.y = Float(info.y_speed_) / 10;
 
     update_sprite_position();
 
@@ -211,6 +253,77 @@ void PeerPlayer::sync(Platform& pfrm,
 }
 
 
+void PeerPlayer::push_snapshot(const Snapshot& snapshot)
+{
+    // Snapshot times are estimates: we know how far apart the peer sent each
+    // message, but not the absolute transit delay. A snapshot that seems to
+    // have been sent in the future arrived faster than the ones before it, so
+    // we shift our estimates to match. Otherwise, the snapshot's age on
+    // arrival tells us how much the transit delay varies.
+    Snapshot s = snapshot;
+
+    if (s.time_ > 0) {
+        for (auto& other : snapshots_) {
+            other.time_ -= s.time_;
+        }
+        s.time_ = 0;
+    } else {
+        const auto lateness = -s.time_;
+        jitter_ += (lateness - jitter_) / 8;
+
+        // Drift slowly towards later arrivals, in case the transit delay
+        // increased for good.
+        for (auto& other : snapshots_) {
+            other.time_ += lateness / 16;
+        }
+        s.time_ += lateness / 16;
+    }
+
+    if (snapshots_.full()) {
+        snapshots_.erase(snapshots_.begin());
+    }
+
+    snapshots_.push_back(s);
+}
+
+
+Microseconds PeerPlayer::playout_delay() const
+{
+    return std::min(jitter_ * 2, milliseconds(100));
+}
+
+
+Vec2<Float> PeerPlayer::sample(Microseconds time) const
+{
+    if (snapshots_.empty()) {
+        return position_;
+    }
+
+    auto& newest = snapshots_.back();
+    if (time >= newest.time_) {
+        const auto elapsed = std::min(time - newest.time_, max_extrapolation);
+        return newest.position_ + newest.velocity_ * Float(elapsed);
+    }
+
+    if (time <= snapshots_.front().time_) {
+        return snapshots_.front().position_;
+    }
+
+    for (u32 i = 1; i < snapshots_.size(); ++i) {
+        auto& before = snapshots_[i - 1];
+        auto& after = snapshots_[i];
+
+        if (time < after.time_) {
+            const Float t =
+                Float(time - before.time_) / (after.time_ - before.time_);
+            return interpolate(after.position_, before.position_, t);
+        }
+    }
+
+    return newest.position_;
+}
+
+
 void PeerPlayer::update_sprite_position()
 {
     // Note: head has origin shifted, with corresponding adjustment here. This
@@ -233,37 +346,44 @@ void PeerPlayer::update(Platform& pfrm, Game& game, Microseconds dt)
         shadow_.set_alpha(Sprite::Alpha::transparent);
     }
 
-    // Intentionally moves a bit slower than our player character. This actually reduces choppiness.
-    static const float MOVEMENT_RATE_CONSTANT = 0.000044f;
+    since_last_snapshot_ += dt;
 
-    const auto wc = check_wall_collisions(game.tiles(), *this);
-
-    if (wc.up and speed_.y < 0) {
-        speed_.y = 0;
+    for (auto& s : snapshots_) {
+        s.time_ -= dt;
     }
 
-    if (wc.down and speed_.y > 0) {
-        speed_.y = 0;
-    }
+    const auto render_time = -playout_delay();
 
-    if (wc.right and speed_.x > 0) {
-        speed_.x = 0;
+    // Keep one snapshot older than the render time, to interpolate from.
+    while (snapshots_.size() > 2 and snapshots_[1].time_ <= render_time) {
+        snapshots_.erase(snapshots_.begin());
     }
 
-    if (wc.left and speed_.x < 0) {
-        speed_.x = 0;
+    // Don't extrapolate the peer through walls.
+    if (not snapshots_.empty()) {
+        const auto wc = check_wall_collisions(game.wall_field(), *this);
+
+        const auto prev_estimate = sample(render_time);
+
+        auto& velocity = snapshots_.back().velocity_;
+
+        if ((wc.up and velocity.y < 0) or (wc.down and velocity.y > 0)) {
+            velocity.y = 0;
+        }
+
+        if ((wc.left and velocity.x < 0) or (wc.right and velocity.x > 0)) {
+            velocity.x = 0;
+        }
+
+        interp_offset_ = interp_offset_ + (prev_estimate - sample(render_time));
     }
 
     auto texture_index = sprite_.get_texture_index();
 
-    Vec2<Float> new_pos{
-        position_.x - ((speed_.x) * dt * MOVEMENT_RATE_CONSTANT),
-        position_.y - ((speed_.y) * dt * MOVEMENT_RATE_CONSTANT)};
-
     interp_offset_ =
         interpolate(Vec2<Float>{0.f, 0.f}, interp_offset_, dt * 0.00004f);
 
-    set_position(new_pos);
+    set_position(sample(render_time));
 
     update_sprite_position();
 
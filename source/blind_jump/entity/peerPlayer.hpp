@@ -23,6 +23,12 @@ public:
 
     void sync(Platform& pfrm, Game& game, const net_event::PlayerInfo& info);
 
+    // Where the peer should expect to find the player described by info, after
+    // elapsed time, assuming that the player keeps moving at the same speed
+    // (for a little while).
+    static Vec2<Float> extrapolate(const net_event::PlayerInfo& info,
+                                   Microseconds elapsed);
+
     void update(Platform& pfrm, Game& game, Microseconds dt);
 
     auto get_sprites() const
@@ -51,8 +57,32 @@ public:
 private:
     void update_sprite_position();
 
+    // A snapshot of the peer's position, received in a PlayerInfo message.
+    // Times are relative to the current frame, so a snapshot's time counts
+    // down as it ages.
+    struct Snapshot {
+        Vec2<Float> position_;
+        Vec2<Float> velocity_; // pixels per microsecond
+        Microseconds time_;    // when the peer sent the snapshot
+    };
+
+    // Where the peer player was, at the given time. Interpolates between
+    // snapshots, or extrapolates past the newest one.
+    Vec2<Float> sample(Microseconds time) const;
+
+    void push_snapshot(const Snapshot& snapshot);
+
+    // We render the peer a little bit in the past, so that we usually have a
+    // snapshot on either side of the render time, even when messages arrive
+    // unevenly.
+    Microseconds playout_delay() const;
+
+    Buffer<Snapshot, 4> snapshots_;
+    Microseconds since_last_snapshot_ = 0;
+    Microseconds jitter_ = 0;
+    u8 last_timestamp_ = 0;
+
     std::optional<Platform::DynamicTexturePtr> dynamic_texture_;
-    Vec2<Float> speed_;
     Sprite shadow_;
     Sprite head_;
     Vec2<Float> interp_offset_;
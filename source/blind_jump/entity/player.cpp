@@ -77,7 +77,7 @@ void Player::apply_force(const Vec2<Float>& force)
 void Player::injured(Platform& pf, Game& game, Health damage)
 {
     if (not Player::is_invulnerable()) {
-        pf.sleep(4);
+        game.freeze(4);
         debit_health(damage);
         sprite_.set_mix({current_zone(game).injury_glow_color_, 255});
         blaster_.get_sprite().set_mix(sprite_.get_mix());
@@ -199,7 +199,7 @@ void Player::on_collision(Platform& pf, Game& game, Theif&)
     }
 
     if (get_health() > 1) {
-        pf.sleep(8);
+        game.freeze(8);
         sprite_.set_mix({current_zone(game).injury_glow_color_, 255});
         blaster_.get_sprite().set_mix(sprite_.get_mix());
         invulnerability_timer_ = milliseconds(700);
@@ -220,7 +220,7 @@ void Player::heal(Platform& pfrm, Game& game, Health amount)
 {
     sprite_.set_mix({ColorConstant::spanish_crimson, 255});
     add_health(amount);
-    pfrm.speaker().play_sound("pop", 1);
+    pfrm.speaker().play_sound("pop"_asset, 1);
     // game.effects().spawn<UINumber>(get_position(), amount, id());
 }
 
@@ -253,7 +253,7 @@ void Player::get_score(Platform& pf, Game& game, u32 score)
 {
     sprite_.set_mix({current_zone(game).energy_glow_color_, 255});
     game.score() += score;
-    pf.speaker().play_sound("coin", 1);
+    pf.speaker().play_sound("coin"_asset, 1);
 }
 
 
@@ -261,7 +261,7 @@ template <Player::ResourceLoc L>
 void Player::altKeyResponse(bool k1,
                             bool k2,
                             bool k3,
-                            float& speed,
+                            Float& speed,
                             bool collision)
 {
     if (k1) {
@@ -286,7 +286,7 @@ void Player::key_response(bool k1,
                           bool k2,
                           bool k3,
                           bool k4,
-                          float& speed,
+                          Float& speed,
                           bool collision)
 {
     if (k1) {
@@ -508,7 +508,7 @@ void Player::update(Platform& pfrm, Game& game, Microseconds dt)
     }();
 
 
-    auto wc = check_wall_collisions(game.tiles(), *this);
+    auto wc = check_wall_collisions(game.wall_field(), *this);
 
     int collision_count = 0;
     if (wc.up) {
@@ -721,9 +721,9 @@ void Player::update(Platform& pfrm, Game& game, Microseconds dt)
             r_speed_ *= 3;
             u_speed_ *= 3;
             d_speed_ *= 3;
-            pfrm.sleep(4);
+            game.freeze(4);
             game.camera().shake(8);
-            pfrm.speaker().play_sound("dodge", 1);
+            pfrm.speaker().play_sound("dodge"_asset, 1);
             //sprite_.set_mix({current_zone(game).energy_glow_color_, 255});
             sprite_.set_mix({dodge_flicker_light_color, 255});
             blaster_.set_visible(false);
@@ -811,16 +811,16 @@ void Player::update(Platform& pfrm, Game& game, Microseconds dt)
             r_speed_ = 0;
         }
         if (l_speed_) {
-            l_speed_ = interpolate(0.f, l_speed_, 0.000000175f * dt);
+            l_speed_ = interpolate(Float(0), l_speed_, 0.000000175f * dt);
         }
         if (r_speed_) {
-            r_speed_ = interpolate(0.f, r_speed_, 0.000000175f * dt);
+            r_speed_ = interpolate(Float(0), r_speed_, 0.000000175f * dt);
         }
         if (u_speed_) {
-            u_speed_ = interpolate(0.f, u_speed_, 0.000000175f * dt);
+            u_speed_ = interpolate(Float(0), u_speed_, 0.000000175f * dt);
         }
         if (d_speed_) {
-            d_speed_ = interpolate(0.f, d_speed_, 0.000000175f * dt);
+            d_speed_ = interpolate(Float(0), d_speed_, 0.000000175f * dt);
         }
         if (dodge_timer_ > milliseconds(150)) {
             state_ = State::normal;
@@ -1037,19 +1037,19 @@ void Player::footstep(Platform& pf)
 {
     switch (rng::choice<4>(rng::utility_state)) {
     case 0:
-        pf.speaker().play_sound("footstep1", 0);
+        pf.speaker().play_sound("footstep1"_asset, 0);
         break;
 
     case 1:
-        pf.speaker().play_sound("footstep2", 0);
+        pf.speaker().play_sound("footstep2"_asset, 0);
         break;
 
     case 2:
-        pf.speaker().play_sound("footstep3", 0);
+        pf.speaker().play_sound("footstep3"_asset, 0);
         break;
 
     case 3:
-        pf.speaker().play_sound("footstep4", 0);
+        pf.speaker().play_sound("footstep4"_asset, 0);
         break;
     }
 }
@@ -1091,7 +1091,7 @@ void Blaster::shoot(Platform& pf, Game& game)
 
             reload_ = reload_interval;
 
-            pf.speaker().play_sound("blaster", 4);
+            pf.speaker().play_sound("blaster"_asset, 4);
 
             if (not [&] {
                     if (expl_rounds > 0) {
@@ -115,12 +115,12 @@ private:
                       bool k2,
                       bool k3,
                       bool k4,
-                      float& speed,
+                      Float& speed,
                       bool collision);
 
     template <ResourceLoc L>
     void
-    altKeyResponse(bool k1, bool k2, bool k3, float& speed, bool collision);
+    altKeyResponse(bool k1, bool k2, bool k3, Float& speed, bool collision);
 
     template <Player::ResourceLoc S, uint8_t maxIndx>
     void on_key_released(bool k2, bool k3, bool k4, bool x);
@@ -1,4 +1,5 @@
 #include "game.hpp"
+#include "bitvector.hpp"
 #include "bulkAllocator.hpp"
 #include "function.hpp"
 #include "globals.hpp"
@@ -18,6 +19,9 @@ bool within_view_frustum(const Platform::Screen& screen,
                          const Vec2<Float>& pos);
 
 
+static void on_set_var(const char* name);
+
+
 bool Game::load_save_data(Platform& pfrm)
 {
     alignas(PersistentData) u8 save_buffer[sizeof(PersistentData)] = {0};
@@ -68,7 +72,7 @@ void newgame(Platform& pfrm, Game& game)
 }
 
 
-Game::Game(Platform& pfrm)
+Game::Game(Platform& pfrm, const PersistentData* save)
     : player_(pfrm),
       enemies_(std::get<BlindJumpGlobalData>(globals()).enemy_pool_,
                std::get<BlindJumpGlobalData>(globals()).enemy_node_pool_),
@@ -77,9 +81,13 @@ Game::Game(Platform& pfrm)
       effects_(std::get<BlindJumpGlobalData>(globals()).effect_pool_,
                std::get<BlindJumpGlobalData>(globals()).effect_node_pool_),
       score_(0), next_state_(null_state()), state_(null_state()),
-      boss_target_(0)
+      boss_target_(0), highscore_sync_(persistent_data_.highscores_)
 {
-    if (not this->load_save_data(pfrm)) {
+    data_streams_.set_sink(&highscore_sync_);
+
+    if (save) {
+        persistent_data_ = *save;
+    } else if (not this->load_save_data(pfrm)) {
         info(pfrm, "no save file found");
         newgame(pfrm, *this);
         if (auto tm = pfrm.startup_time()) {
@@ -111,6 +119,7 @@ Game::Game(Platform& pfrm)
     rng::critical_state = persistent_data_.seed_.get();
 
     init_script(pfrm);
+    lisp::set_var_hook(on_set_var);
 
     if (auto eval_opt = pfrm.get_opt('e')) {
         lisp::dostring(eval_opt, [&pfrm](lisp::Value& err) {
@@ -135,7 +144,7 @@ Game::Game(Platform& pfrm)
 
     state_ = State::initial(pfrm, *this);
 
-    pfrm.load_overlay_texture("overlay");
+    pfrm.load_overlay_texture("overlay"_asset);
 
 
     // NOTE: Because we're the initial state, unclear what to pass as a previous
@@ -191,6 +200,56 @@ COLD void on_remote_console_text(Platform& pfrm,
 }
 
 
+PerfSummary perf_summary(Platform& pfrm, Game& game)
+{
+    const auto& frames = game.frame_stats();
+    const auto gc = lisp::gc_stats();
+
+    PerfSummary result;
+
+    if (frames.frames_) {
+        result += "frame us avg ";
+        result += to_string<10>(frames.total_ / frames.frames_);
+        result += " min ";
+        result += to_string<10>(frames.min_);
+        result += " max ";
+        result += to_string<10>(frames.max_);
+        result += ", ";
+    }
+
+    if (game.level_gen_time()) {
+        result += "levelgen us ";
+        result += to_string<10>(game.level_gen_time());
+        result += ", ";
+    }
+
+    if (frames.sprites_dropped_) {
+        result += "sprites dropped ";
+        result += to_string<10>(frames.sprites_dropped_);
+        result += " max ";
+        result += to_string<10>(frames.max_sprites_dropped_);
+        result += ", ";
+    }
+
+    result += "scratch ";
+    result += to_string<10>(pfrm.scratch_buffers_remaining());
+    result += ", lisp ";
+    result += to_string<10>(gc.live_);
+    result += "/";
+    result += to_string<10>(gc.pool_size_);
+    result += " gc ";
+    result += to_string<10>(gc.runs_);
+    result += ", entities ";
+    result += to_string<10>(entity_count(game.enemies()));
+    result += "/";
+    result += to_string<10>(entity_count(game.details()));
+    result += "/";
+    result += to_string<10>(entity_count(game.effects()));
+
+    return result;
+}
+
+
 HOT void Game::update(Platform& pfrm, Microseconds delta)
 {
     if (next_state_) {
@@ -206,23 +265,44 @@ HOT void Game::update(Platform& pfrm, Microseconds delta)
         on_remote_console_text(pfrm, *line);
     }
 
-    for (auto it = deferred_callbacks_.begin();
-         it not_eq deferred_callbacks_.end();) {
+    frame_stats_.record(delta);
 
-        it->second -= delta;
+    if (UNLIKELY(perf_watch_interval_ and
+                 frame_stats_.frames_ >= perf_watch_interval_)) {
+        pfrm.remote_console().printline(perf_summary(pfrm, *this).c_str(),
+                                        false);
+        frame_stats_ = {};
+    }
 
-        if (not(it->second > 0)) {
-            it->first(pfrm, *this);
-            it = deferred_callbacks_.erase(it);
-        } else {
-            ++it;
-        }
+    if (pfrm.network_peer().is_connected()) {
+        data_streams_.update(pfrm, delta);
+    } else {
+        data_streams_.reset();
     }
 
     pfrm.speaker().set_position(
         {camera_.center().x + pfrm.screen().size().x / 2,
          camera_.center().y + pfrm.screen().size().y / 2});
 
+    state_->realtime_update(pfrm, *this, delta);
+
+    // Everything above runs in real time, everything below on game time, which
+    // stops during hit-stop, and slows down in slow motion.
+    const bool frozen = time_scale_.frozen();
+    delta = time_scale_.apply(delta);
+
+    if (frozen and delta == 0) {
+        track_frozen_keys(pfrm);
+        return;
+    }
+
+    if (UNLIKELY(static_cast<bool>(frozen_keys_))) {
+        restore_frozen_keys(pfrm);
+    }
+
+    deferred_callbacks_.update(
+        delta, [&](DeferredCallback& callback) { callback(pfrm, *this); });
+
     next_state_ = state_->update(pfrm, *this, delta);
 
     if (next_state_) {
@@ -231,6 +311,51 @@ HOT void Game::update(Platform& pfrm, Microseconds delta)
 }
 
 
+// The current state doesn't see input while the game's frozen, so we remember
+// any keys pressed in the meantime, and replay them afterwards, otherwise a
+// quick tap during hit-stop would go missing.
+void Game::track_frozen_keys(Platform& pfrm)
+{
+    auto& kb = pfrm.keyboard();
+
+    if (not frozen_keys_) {
+        frozen_keys_.emplace();
+        missed_keys_ = {};
+
+        // The key states from before this frame's poll.
+        for (int i = 0; i < (int)Key::count; ++i) {
+            const auto key = Key(i);
+            frozen_keys_->set(i,
+                              kb.pressed(key) ? not kb.down_transition(key)
+                                              : kb.up_transition(key));
+        }
+    }
+
+    for (int i = 0; i < (int)Key::count; ++i) {
+        if (kb.down_transition(Key(i))) {
+            missed_keys_.set(i, true);
+        }
+    }
+}
+
+
+void Game::restore_frozen_keys(Platform& pfrm)
+{
+    auto& kb = pfrm.keyboard();
+
+    auto keys = kb.dump_state();
+    for (u32 i = 0; i < keys.size(); ++i) {
+        if (missed_keys_[i]) {
+            keys.set(i, true);
+        }
+    }
+
+    kb.override_state(*frozen_keys_, keys);
+
+    frozen_keys_.reset();
+}
+
+
 void Game::rumble(Platform& pfrm, Microseconds duration)
 {
     if (persistent_data_.settings_.rumble_enabled_) {
@@ -239,7 +364,10 @@ void Game::rumble(Platform& pfrm, Microseconds duration)
 }
 
 
-static void show_offscreen_player_icon(Platform& pfrm, Game& game)
+// Returns false if the arrow has nowhere to go, e.g. when the peer sits
+// straight above or below the center of the screen.
+static bool
+show_offscreen_player_icon(Platform& pfrm, Game& game, Sprite& arrow_spr)
 {
     // Basically, this code draws an imaginary line between the center of the
     // window, and the coordinate of the offscreen player character. The
@@ -248,7 +376,6 @@ static void show_offscreen_player_icon(Platform& pfrm, Game& game)
 
     const auto peer_pos = game.peer()->get_position().cast<int>();
 
-    Sprite arrow_spr;
     arrow_spr.set_texture_index(119);
     arrow_spr.set_size(Sprite::Size::w16_h32);
 
@@ -261,7 +388,7 @@ static void show_offscreen_player_icon(Platform& pfrm, Game& game)
     const auto dx = view_center.x - peer_pos.x;
 
     if (dx == 0) {
-        return;
+        return false;
     }
 
     const auto slope = Float(dy) / dx;
@@ -277,12 +404,14 @@ static void show_offscreen_player_icon(Platform& pfrm, Game& game)
                 {Float(view_tl.x + view_size.x - 24), Float(y)});
             // right edge
             arrow_spr.set_rotation((std::numeric_limits<s16>::max() * 3) / 4);
+            return true;
         } else {
             const auto y =
                 clamp(peer_pos.y, view_tl.y, view_tl.y + view_size.y - 32);
             arrow_spr.set_position({Float(view_tl.x + 8), Float(y)});
             // left edge
             arrow_spr.set_rotation((std::numeric_limits<s16>::max() * 1) / 4);
+            return true;
         }
     } else if (-center_x <= center_y / slope and center_y / slope <= center_x) {
         if (view_center.y < peer_pos.y) {
@@ -291,44 +420,49 @@ static void show_offscreen_player_icon(Platform& pfrm, Game& game)
             arrow_spr.set_position(
                 {Float(x), Float(view_tl.y + view_size.y - 32)});
             arrow_spr.set_rotation(std::numeric_limits<s16>::max() / 2);
+            return true;
         } else {
             const auto x =
                 clamp(peer_pos.x, view_tl.x, view_tl.x + view_size.x - 32);
             arrow_spr.set_position({Float(x), Float(view_tl.y)});
             arrow_spr.set_rotation(0);
+            return true;
         }
     }
 
-    pfrm.screen().draw(arrow_spr);
+    return false;
 }
 
 
 HOT void Game::render(Platform& pfrm)
 {
-    Buffer<const Sprite*, Platform::Screen::sprite_limit> display_buffer;
-
-    Buffer<const Sprite*, 30> shadows_buffer;
+    // Everything that we draw this frame goes through the budget, which
+    // decides what to drop, when the scene holds more sprites than the
+    // hardware can display.
+    SpriteBudget<Platform::Screen::sprite_limit + 64> budget;
 
     auto show_sprite = [&](auto& e) {
         if (within_view_frustum(pfrm.screen(), e.get_sprite().get_position())) {
             using T = typename std::remove_reference<decltype(e)>::type;
 
+            constexpr auto priority = T::sprite_priority;
+
             if constexpr (T::has_shadow) {
                 if constexpr (T::multiface_shadow) {
                     for (const auto& spr : e.get_shadow()) {
-                        shadows_buffer.push_back(spr);
+                        budget.push_shadow(*spr, priority);
                     }
                 } else {
-                    shadows_buffer.push_back(&e.get_shadow());
+                    budget.push_shadow(e.get_shadow(), priority);
                 }
             }
 
             if constexpr (T::multiface_sprite) {
                 for (const auto& spr : e.get_sprites()) {
-                    display_buffer.push_back(spr);
+                    budget.push(*spr, priority);
                 }
             } else {
-                display_buffer.push_back(&e.get_sprite());
+                budget.push(e.get_sprite(), priority);
             }
 
             e.mark_visible(true);
@@ -365,25 +499,31 @@ HOT void Game::render(Platform& pfrm)
         }
     });
 
-    // effects_.transform(show_sprites);
-    for (auto spr : display_buffer) {
-        pfrm.screen().draw(*spr);
+    const bool peer_visible =
+        peer_player_ and
+        within_view_frustum(pfrm.screen(), peer_player_->get_position());
+
+    Sprite arrow_spr;
+    if (peer_player_ and not peer_visible) {
+        peer_player_->mark_visible(false);
+        if (show_offscreen_player_icon(pfrm, *this, arrow_spr)) {
+            budget.push(arrow_spr, SpritePriority::peer);
+        }
     }
-    display_buffer.clear();
 
-    display_buffer.push_back(&player_.get_sprite());
-    display_buffer.push_back(&player_.weapon().get_sprite());
+    // Overworld objects, layered by their y position.
+    const auto sorted = budget.size();
 
-    if (peer_player_) {
-        if (within_view_frustum(pfrm.screen(), peer_player_->get_position())) {
-            display_buffer.push_back(&peer_player_->get_sprite());
-            display_buffer.push_back(peer_player_->get_sprites()[1]);
-            display_buffer.push_back(&peer_player_->get_blaster_sprite());
-            shadows_buffer.push_back(&peer_player_->get_shadow());
-            peer_player_->mark_visible(true);
-        } else {
-            peer_player_->mark_visible(false);
-        }
+    budget.push(player_.get_sprite(), SpritePriority::player);
+    budget.push(player_.weapon().get_sprite(), SpritePriority::player);
+
+    if (peer_visible) {
+        const auto peer = SpritePriority::peer;
+        budget.push(peer_player_->get_sprite(), peer);
+        budget.push(*peer_player_->get_sprites()[1], peer);
+        budget.push(peer_player_->get_blaster_sprite(), peer);
+        budget.push_shadow(peer_player_->get_shadow(), peer);
+        peer_player_->mark_visible(true);
     }
 
     enemies_.transform(show_sprites);
@@ -393,11 +533,9 @@ HOT void Game::render(Platform& pfrm)
         show_sprite(*scavenger_);
     }
 
-    std::sort(display_buffer.begin(),
-              display_buffer.end(),
-              [](const auto& l, const auto& r) {
-                  return l->get_position().y > r->get_position().y;
-              });
+    budget.sort(sorted, [](const Sprite& l, const Sprite& r) {
+        return l.get_position().y > r.get_position().y;
+    });
 
     for (auto& e : effects_.get<DynamicEffect>()) {
         if (e->is_backdrop()) {
@@ -413,21 +551,14 @@ HOT void Game::render(Platform& pfrm)
 
     show_sprite(transporter_);
 
-    display_buffer.push_back(&player_.get_shadow());
+    budget.push(player_.get_shadow(), SpritePriority::player);
 
-    if (peer_player_ and not peer_player_->visible()) {
-        show_offscreen_player_icon(pfrm, *this);
-    }
-
-    for (auto spr : display_buffer) {
-        pfrm.screen().draw(*spr);
-    }
-
-    for (auto spr : shadows_buffer) {
-        pfrm.screen().draw(*spr);
-    }
+    const auto dropped =
+        budget.draw(Platform::Screen::sprite_limit,
+                    Platform::Screen::affine_transform_limit,
+                    [&](const Sprite& spr) { pfrm.screen().draw(spr); });
 
-    display_buffer.clear();
+    frame_stats_.record_sprites(dropped);
 }
 
 
@@ -435,45 +566,21 @@ static void cell_automata_advance(TileMap& map, TileMap& maptemp)
 {
     auto& thresh = lisp::get_var("cell-thresh")->expect<lisp::Cons>();
 
-    // At the start, whether each tile is filled or unfilled is completely
-    // random. The cell_automata_advance function causes each tile to
-    // appear/disappear based on how many neighbors that tile has, which
-    // ultimately causes tiles to coalesce into blobs.
-    map.for_each([&](const u8& tile, int x, int y) {
-        uint8_t count = 0;
-        auto collect = [&](int x, int y) {
-            if (map.get_tile(x, y) == Tile::none) {
-                count++;
-            }
-        };
-        collect(x - 1, y - 1);
-        collect(x + 1, y - 1);
-        collect(x - 1, y + 1);
-        collect(x + 1, y + 1);
-        collect(x - 1, y);
-        collect(x + 1, y);
-        collect(x, y - 1);
-        collect(x, y + 1);
-        if (tile == Tile::none) {
-            if (count < thresh.cdr()->integer().value_) {
-                maptemp.set_tile(x, y, Tile::plate);
-            } else {
-                maptemp.set_tile(x, y, Tile::none);
-            }
-        } else {
-            if (count > thresh.car()->integer().value_) {
-                maptemp.set_tile(x, y, Tile::none);
-            } else {
-                maptemp.set_tile(x, y, Tile::plate);
-            }
-        }
-    });
-    maptemp.for_each(
-        [&](const u8& tile, int x, int y) { map.set_tile(x, y, tile); });
+    cell_automata_advance(map,
+                          maptemp,
+                          thresh.car()->integer().value_,
+                          thresh.cdr()->integer().value_);
 }
 
 
-using BossLevelMap = Bitmatrix<TileMap::width, TileMap::height>;
+// The hand-drawn levels are laid out for the gba's sixteen by twenty tile map,
+// regardless of the configured map dimensions. In larger maps, they occupy the
+// upper left corner.
+static constexpr const int fixed_map_width = 16;
+static constexpr const int fixed_map_height = 20;
+
+
+using BossLevelMap = Bitmatrix<fixed_map_width, fixed_map_height>;
 
 
 READ_ONLY_DATA
@@ -722,6 +829,18 @@ bool is_boss_level(Level level)
 }
 
 
+static void load_fixed_map(TileMap& tiles, const BossLevelMap& map)
+{
+    tiles.for_each([&](u8& tile, int x, int y) {
+        if (x < fixed_map_width and y < fixed_map_height) {
+            tile = map.get(x, y);
+        } else {
+            tile = Tile::none;
+        }
+    });
+}
+
+
 enum { star_empty = 60, star_1 = 70, star_2 = 71 };
 
 
@@ -945,27 +1064,84 @@ bool operator==(const ZoneInfo& lhs, const ZoneInfo& rhs)
 }
 
 
-static bool contains(lisp::Value* tiles_list, u8 t)
-{
-    while (tiles_list not_eq L_NIL) {
-        if (tiles_list->type() not_eq lisp::Value::Type::cons) {
-            while (true)
-                ; // TODO: raise error...
+// Scripts configure which tile indices count as walls and edges, by setting
+// wall-tiles-list and edge-tiles-list. Map generation classifies every tile of
+// the map many times over, and walking a lisp list for each query adds up, so
+// we compile each list into a mask of tile indices, and only recompile after a
+// script sets the variable again (see on_set_var()).
+class TileClass {
+public:
+    TileClass(const char* var_name) : var_name_(var_name)
+    {
+    }
+
+    bool contains(u8 t)
+    {
+        if (UNLIKELY(not valid_)) {
+            compile();
         }
+        return mask_.get(t);
+    }
 
-        if (tiles_list->cons().car()->type() not_eq lisp::Value::Type::integer) {
-            while (true)
-                ; // TODO: raise error
+    void on_set_var(const char* name)
+    {
+        if (name == interned_name_) {
+            valid_ = false;
         }
+    }
 
-        if (static_cast<int>(t) == tiles_list->cons().car()->integer().value_) {
-            return true;
+private:
+    void compile()
+    {
+        interned_name_ = lisp::intern(var_name_);
+
+        mask_ = Bitvector<256>{};
+
+        auto lat = lisp::get_var(var_name_);
+        while (lat->type() == lisp::Value::Type::cons) {
+            auto elem = lat->cons().car();
+            if (elem->type() == lisp::Value::Type::integer) {
+                mask_.set(u8(elem->integer().value_), true);
+            }
+            lat = lat->cons().cdr();
         }
 
-        tiles_list = tiles_list->cons().cdr();
+        valid_ = true;
     }
 
-    return false;
+    const char* var_name_;
+    const char* interned_name_ = nullptr;
+    Bitvector<256> mask_;
+    bool valid_ = false;
+};
+
+
+static TileClass wall_tiles("wall-tiles-list");
+static TileClass edge_tiles("edge-tiles-list");
+
+
+static void on_set_var(const char* name)
+{
+    wall_tiles.on_set_var(name);
+    edge_tiles.on_set_var(name);
+}
+
+
+static bool is_wall_tile(u8 t)
+{
+    return wall_tiles.contains(t);
+}
+
+
+static bool is_center_tile(u8 t)
+{
+    return not wall_tiles.contains(t) and not edge_tiles.contains(t);
+}
+
+
+static bool is_edge_tile(u8 t)
+{
+    return not wall_tiles.contains(t) and edge_tiles.contains(t);
 }
 
 
@@ -1016,12 +1192,16 @@ COLD void Game::next_level(Platform& pfrm, std::optional<Level> set_level)
 
     } else {
         if (level() == 0) {
-            pfrm.load_sprite_texture("spritesheet_intro_cutscene");
+            pfrm.load_sprite_texture("spritesheet_intro_cutscene"_asset);
         } else {
             pfrm.load_sprite_texture(current_zone(*this).spritesheet_name_);
         }
     }
 
+    // Level generation time grows with the map area, so we measure it, to keep
+    // an eye on builds configured with larger maps. See perf_summary().
+    const auto gen_start = pfrm.delta_clock().sample();
+
 RETRY:
     Game::regenerate_map(pfrm);
 
@@ -1048,12 +1228,10 @@ RETRY:
     // all of the enumerations. At this point, we've already pushed the tilemap
     // to the platform for rendering, so we can simplify to just the data that
     // we absolutely need.
-    auto wall_tiles = lisp::get_var("wall-tiles-list");
-    auto edge_tiles = lisp::get_var("edge-tiles-list");
 
     tiles_.for_each([&](u8& tile, int, int) {
-        if (not contains(wall_tiles, tile)) {
-            if (contains(edge_tiles, tile)) {
+        if (not is_wall_tile(tile)) {
+            if (is_edge_tile(tile)) {
                 tile = Tile::plate;
             } else {
                 tile = Tile::sand;
@@ -1063,6 +1241,11 @@ RETRY:
         }
     });
 
+    wall_field_.build(tiles_);
+
+    const auto gen_stop = pfrm.delta_clock().sample();
+    level_gen_time_ = Platform::DeltaClock::duration(gen_start, gen_stop);
+
     const auto player_pos = player_.get_position();
     const auto ssize = pfrm.screen().size();
     camera_.set_position(
@@ -1070,70 +1253,14 @@ RETRY:
 }
 
 
-COLD static u32
-flood_fill(Platform& pfrm, TileMap& map, u8 replace, TIdx x, TIdx y)
-{
-    using Coord = Vec2<s8>;
-
-    ScratchBufferBulkAllocator mem(pfrm);
-
-    auto stack = mem.alloc<Buffer<Coord, TileMap::width * TileMap::height>>();
-
-    if (UNLIKELY(not stack)) {
-        pfrm.fatal("fatal error in floodfill");
-    }
-
-    const u8 target = map.get_tile(x, y);
-
-    u32 count = 0;
-
-    const auto action = [&](const Coord& c, TIdx x_off, TIdx y_off) {
-        const TIdx x = c.x + x_off;
-        const TIdx y = c.y + y_off;
-        if (x > 0 and x < TileMap::width and y > 0 and y < TileMap::height) {
-            if (map.get_tile(x, y) == target) {
-                map.set_tile(x, y, replace);
-                stack->push_back({x, y});
-                count += 1;
-            }
-        }
-    };
-
-    action({x, y}, 0, 0);
-
-    while (not stack->empty()) {
-        Coord c = stack->back();
-        stack->pop_back();
-        action(c, -1, 0);
-        action(c, 0, 1);
-        action(c, 0, -1);
-        action(c, 1, 0);
-    }
-
-    return count;
-}
-
-
 COLD void Game::seed_map(Platform& pfrm, TileMap& workspace)
 {
     if (auto l = get_boss_level(level())) {
-        for (int x = 0; x < TileMap::width; ++x) {
-            for (int y = 0; y < TileMap::height; ++y) {
-                tiles_.set_tile(x, y, l->map_->get(x, y));
-            }
-        }
+        load_fixed_map(tiles_, *l->map_);
     } else if (level() == 0) {
-        for (int x = 0; x < TileMap::width; ++x) {
-            for (int y = 0; y < TileMap::height; ++y) {
-                tiles_.set_tile(x, y, level_0.get(x, y));
-            }
-        }
+        load_fixed_map(tiles_, level_0);
     } else if (level() == boss_0_level + 1) {
-        for (int x = 0; x < TileMap::width; ++x) {
-            for (int y = 0; y < TileMap::height; ++y) {
-                tiles_.set_tile(x, y, memorial_area.get(x, y));
-            }
-        }
+        load_fixed_map(tiles_, memorial_area);
     } else {
         // Just for the sake of variety, intentionally generate
         // smaller maps sometimes.
@@ -1173,21 +1300,6 @@ COLD void Game::seed_map(Platform& pfrm, TileMap& workspace)
 }
 
 
-static bool
-is_center_tile(lisp::Value* wall_tiles_list, lisp::Value* edge_tiles_list, u8 t)
-{
-    return not contains(wall_tiles_list, t) and
-           not contains(edge_tiles_list, t);
-}
-
-
-static bool
-is_edge_tile(lisp::Value* wall_tiles_list, lisp::Value* edge_tiles_list, u8 t)
-{
-    return not contains(wall_tiles_list, t) and contains(edge_tiles_list, t);
-}
-
-
 static void add_map_decorations(Level level,
                                 Platform& pfrm,
                                 const TileMap& map,
@@ -1204,13 +1316,11 @@ static void add_map_decorations(Level level,
         return false;
     };
 
-    auto wall_tiles = lisp::get_var("wall-tiles-list");
-    auto edge_tiles = lisp::get_var("edge-tiles-list");
 
     grass_overlay.for_each([&](u8 t, s8 x, s8 y) {
         pfrm.set_tile(Layer::map_1, x, y, t);
         if (t == Tile::none) {
-            if (is_center_tile(wall_tiles, edge_tiles, map.get_tile(x, y))) {
+            if (is_center_tile(map.get_tile(x, y))) {
                 if (not adjacent_decor(x, y)) {
                     pfrm.set_tile(
                         Layer::map_1,
@@ -1277,13 +1387,11 @@ COLD void Game::regenerate_map(Platform& pfrm)
         }
     });
 
-    auto wall_tiles = lisp::get_var("wall-tiles-list");
-    auto edge_tiles = lisp::get_var("edge-tiles-list");
 
     // Create a mask of the tileset by filling the temporary tileset
     // with all walkable tiles from the tilemap.
     tiles_.for_each([&](const u8& tile, TIdx x, TIdx y) {
-        if (not contains(wall_tiles, tile)) {
+        if (not is_wall_tile(tile)) {
             temporary->set_tile(x, y, 1);
         } else {
             temporary->set_tile(x, y, 0);
@@ -1449,19 +1557,10 @@ COLD void Game::regenerate_map(Platform& pfrm)
 
     if (auto info = get_boss_level(level())) {
         if (info->grass_pattern_) {
-            for (int x = 0; x < TileMap::width; ++x) {
-                for (int y = 0; y < TileMap::height; ++y) {
-                    grass_overlay->set_tile(
-                        x, y, info->grass_pattern_->get(x, y));
-                }
-            }
+            load_fixed_map(*grass_overlay, *info->grass_pattern_);
         }
     } else if (level() - 1 == boss_0_level) {
-        for (int x = 0; x < TileMap::width; ++x) {
-            for (int y = 0; y < TileMap::height; ++y) {
-                grass_overlay->set_tile(x, y, memorial_area_gr.get(x, y));
-            }
-        }
+        load_fixed_map(*grass_overlay, memorial_area_gr);
     }
 
     // All tiles with four neighbors become sand tiles.
@@ -1632,13 +1731,13 @@ COLD void Game::regenerate_map(Platform& pfrm)
             const auto down = tiles_.get_tile(x, y - 1);
             const auto left = tiles_.get_tile(x - 1, y);
             const auto right = tiles_.get_tile(x + 1, y);
-            if (tile == 0 and not contains(wall_tiles, left) and
+            if (tile == 0 and not is_wall_tile(left) and
                 (up == 0 or up == 18 or down == 0 or down == 18) and
                 (tiles_.get_tile(x - 2, y) == 0 or
                  tiles_.get_tile(x - 2, y) == 19)) {
                 tiles_.set_tile(x, y, 18);
             }
-            if (tile == 0 and not contains(wall_tiles, right) and
+            if (tile == 0 and not is_wall_tile(right) and
                 (up == 0 or up == 19 or down == 0 or down == 19) and
                 (tiles_.get_tile(x + 2, y) == 0 or
                  tiles_.get_tile(x + 2, y) == 18)) {
@@ -1666,8 +1765,8 @@ COLD void Game::regenerate_map(Platform& pfrm)
 
     if (zone_info(level()) == zone_3) {
         tiles_.for_each([&](u8& tile, int x, int y) {
-            if (contains(wall_tiles, tile)) {
-                if (not contains(wall_tiles, tiles_.get_tile(x, y + 1))) {
+            if (is_wall_tile(tile)) {
+                if (not is_wall_tile(tiles_.get_tile(x, y + 1))) {
                     grass_overlay->set_tile(x, y, 17);
                 }
             }
@@ -1683,39 +1782,31 @@ COLD void Game::regenerate_map(Platform& pfrm)
             if (tile == Tile::plate and
                 grass_overlay->get_tile(x, y) == Tile::none) {
 
-                if (is_center_tile(
-                        wall_tiles, edge_tiles, tiles_.get_tile(x + 1, y)) and
-                    not contains(wall_tiles, up) and
-                    not contains(wall_tiles, down) and
-                    not(is_center_tile(wall_tiles, edge_tiles, up) and
-                        is_center_tile(wall_tiles, edge_tiles, down))) {
+                if (is_center_tile(tiles_.get_tile(x + 1, y)) and
+                    not is_wall_tile(up) and
+                    not is_wall_tile(down) and
+                    not(is_center_tile(up) and is_center_tile(down))) {
 
                     tiles_.set_tile(x, y, Tile::plate_left);
                 }
-                if (is_center_tile(
-                        wall_tiles, edge_tiles, tiles_.get_tile(x - 1, y)) and
-                    not contains(wall_tiles, up) and
-                    not contains(wall_tiles, down) and
-                    not(is_center_tile(wall_tiles, edge_tiles, up) and
-                        is_center_tile(wall_tiles, edge_tiles, down))) {
+                if (is_center_tile(tiles_.get_tile(x - 1, y)) and
+                    not is_wall_tile(up) and
+                    not is_wall_tile(down) and
+                    not(is_center_tile(up) and is_center_tile(down))) {
 
                     tiles_.set_tile(x, y, Tile::plate_right);
                 }
-                if (is_center_tile(
-                        wall_tiles, edge_tiles, tiles_.get_tile(x, y + 1)) and
-                    not contains(wall_tiles, right) and
-                    not contains(wall_tiles, left) and
-                    not(is_center_tile(wall_tiles, edge_tiles, left) and
-                        is_center_tile(wall_tiles, edge_tiles, right))) {
+                if (is_center_tile(tiles_.get_tile(x, y + 1)) and
+                    not is_wall_tile(right) and
+                    not is_wall_tile(left) and
+                    not(is_center_tile(left) and is_center_tile(right))) {
 
                     tiles_.set_tile(x, y, Tile::plate_top);
                 }
-                if (is_center_tile(
-                        wall_tiles, edge_tiles, tiles_.get_tile(x, y - 1)) and
-                    not contains(wall_tiles, right) and
-                    not contains(wall_tiles, left) and
-                    not(is_center_tile(wall_tiles, edge_tiles, left) and
-                        is_center_tile(wall_tiles, edge_tiles, right))) {
+                if (is_center_tile(tiles_.get_tile(x, y - 1)) and
+                    not is_wall_tile(right) and
+                    not is_wall_tile(left) and
+                    not(is_center_tile(left) and is_center_tile(right))) {
 
                     tiles_.set_tile(x, y, Tile::plate_bottom);
                 }
@@ -1765,10 +1856,9 @@ COLD static MapCoordBuf get_free_map_slots(const TileMap& map)
 {
     MapCoordBuf output;
 
-    auto wall_tiles = lisp::get_var("wall-tiles-list");
 
     map.for_each([&](const u8& tile, TIdx x, TIdx y) {
-        if (not contains(wall_tiles, tile)) {
+        if (not is_wall_tile(tile)) {
             output.push_back({x, y});
         }
     });
@@ -1841,8 +1931,6 @@ spawn_compactors(Platform& pfrm, Game& game, MapCoordBuf& free_spots)
                                    }()),
                                    free_spots.size() / 25);
 
-        auto wall_tiles = lisp::get_var("wall-tiles-list");
-        auto edge_tiles = lisp::get_var("edge-tiles-list");
 
         for (int i = 0; i < count and free_spots.size() > 0; ++i) {
             if (rng::choice<2>(rng::critical_state)) {
@@ -1862,11 +1950,11 @@ spawn_compactors(Platform& pfrm, Game& game, MapCoordBuf& free_spots)
                     int edge_count = 0;
                     auto detect_edge = [&](int x, int y) {
                         auto tile = game.tiles().get_tile(x, y);
-                        if (is_edge_tile(wall_tiles, edge_tiles, tile)) {
+                        if (is_edge_tile(tile)) {
                             ++edge_count;
                         }
                     };
-                    if (not is_edge_tile(wall_tiles, edge_tiles, t)) {
+                    if (not is_edge_tile(t)) {
                         detect_edge(x - 1, y);
                         detect_edge(x + 1, y);
                         detect_edge(x, y - 1);
@@ -1890,7 +1978,7 @@ spawn_compactors(Platform& pfrm, Game& game, MapCoordBuf& free_spots)
                         rng::choice<TileMap::height>(rng::critical_state);
 
                     const auto t = game.tiles().get_tile(x, y);
-                    if (is_edge_tile(wall_tiles, edge_tiles, t)) {
+                    if (is_edge_tile(t)) {
                         const auto wc = to_world_coord(Vec2<TIdx>{x, y});
                         game.enemies().spawn<Compactor>(wc);
                     }
@@ -2197,8 +2285,6 @@ COLD bool Game::respawn_entities(Platform& pfrm)
 {
     auto clear_entities = [&](auto& buf) { buf.clear(); };
 
-    auto wall_tiles = lisp::get_var("wall-tiles-list");
-    auto edge_tiles = lisp::get_var("edge-tiles-list");
 
     enemies_.transform(clear_entities);
     details_.transform(clear_entities);
@@ -2405,7 +2491,7 @@ COLD bool Game::respawn_entities(Platform& pfrm)
             const s8 x = rng::choice<TileMap::width>(rng::critical_state);
             const s8 y = rng::choice<TileMap::height>(rng::critical_state);
 
-            if (is_edge_tile(wall_tiles, edge_tiles, tiles_.get_tile(x, y))) {
+            if (is_edge_tile(tiles_.get_tile(x, y))) {
 
                 auto wc = to_world_coord({x, y});
                 wc.x += 16;
@@ -2446,11 +2532,11 @@ COLD bool Game::respawn_entities(Platform& pfrm)
     // there's no sand nearby, and no items eiher, potentially place
     // an item.
     tiles_.for_each([&](u8 t, s8 x, s8 y) {
-        if (is_edge_tile(wall_tiles, edge_tiles, t)) {
+        if (is_edge_tile(t)) {
             for (int i = x - 1; i < x + 2; ++i) {
                 for (int j = y - 1; j < y + 2; ++j) {
                     const auto curr = tiles_.get_tile(i, j);
-                    if (is_center_tile(wall_tiles, edge_tiles, curr)) {
+                    if (is_center_tile(curr)) {
                         return;
                     }
                 }
@@ -2493,7 +2579,7 @@ COLD bool Game::respawn_entities(Platform& pfrm)
     // For map locations with nothing nearby, potentially place an item or
     // something
     tiles_.for_each([&](u8 t, s8 x, s8 y) {
-        if (is_center_tile(wall_tiles, edge_tiles, t)) {
+        if (is_center_tile(t)) {
             const auto pos = to_world_coord({x, y});
 
             bool entity_nearby = false;
@@ -2521,9 +2607,7 @@ COLD bool Game::respawn_entities(Platform& pfrm)
                 int adj_sand_tiles = 0;
                 for (int i = x - 1; i < x + 1; ++i) {
                     for (int j = y - 1; j < y + 1; ++j) {
-                        if (is_center_tile(wall_tiles,
-                                           edge_tiles,
-                                           tiles_.get_tile(i, j))) {
+                        if (is_center_tile(tiles_.get_tile(i, j))) {
                             adj_sand_tiles++;
                         }
                     }
@@ -2617,8 +2701,8 @@ bool share_item(Platform& pfrm,
 
         net_event::transmit(pfrm, s);
 
-        pfrm.sleep(
-            20); // Wait for the item to arrive at the other player's game
+        // Wait for the item to arrive at the other player's game.
+        game.freeze(20);
         return true;
     }
     return false;
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <algorithm>
+#include <limits>
 
 #include "camera.hpp"
+#include "dataStream.hpp"
 #include "entity/bosses/gatekeeper.hpp"
 #include "entity/bosses/infestedCore.hpp"
 #include "entity/bosses/theTwins.hpp"
@@ -43,17 +45,24 @@
 #include "entity/peerPlayer.hpp"
 #include "entity/player.hpp"
 #include "function.hpp"
+#include "highscoreSync.hpp"
 #include "localeString.hpp"
 #include "persistentData.hpp"
 #include "platform/platform.hpp"
+#include "playerReplication.hpp"
 #include "powerup.hpp"
 #include "rumble.hpp"
 #include "state.hpp"
+#include "timeScale.hpp"
+#include "timeoutQueue.hpp"
+#include "wallCollision.hpp"
 
 
 class Game {
 public:
-    Game(Platform& platform);
+    // Pass save data to start from, rather than the save data stored on the
+    // platform, e.g. when playing back a replay.
+    Game(Platform& platform, const PersistentData* save = nullptr);
 
     void update(Platform& platform, Microseconds delta);
 
@@ -74,6 +83,21 @@ public:
         return peer_player_;
     }
 
+    inline PlayerReplication& player_replication()
+    {
+        return player_replication_;
+    }
+
+    inline DataStreams& data_streams()
+    {
+        return data_streams_;
+    }
+
+    inline HighscoreSync& highscore_sync()
+    {
+        return highscore_sync_;
+    }
+
     inline std::optional<Scavenger>& scavenger()
     {
         return scavenger_;
@@ -84,6 +108,14 @@ public:
         return tiles_;
     }
 
+    // NOTE: Built from tiles() after level generation. If you edit the map
+    // afterwards, rebuild the wall field, or entities will walk through the
+    // old walls.
+    const WallField& wall_field() const
+    {
+        return wall_field_;
+    }
+
     using EnemyGroup = EntityGroup<20,
                                    Drone,
                                    Turret,
@@ -155,6 +187,18 @@ public:
 
     void rumble(Platform& pfrm, Microseconds duration);
 
+    // Hit-stop: holds the game simulation still for some number of frames,
+    // without blocking input, rendering, or the network (see timeScale.hpp).
+    void freeze(Platform::Frame frames)
+    {
+        time_scale_.freeze(frames * (seconds(1) / 60));
+    }
+
+    TimeScale& time_scale()
+    {
+        return time_scale_;
+    }
+
     void next_level(Platform& platform, std::optional<Level> set_level = {});
 
     Level level() const
@@ -189,13 +233,22 @@ public:
                     Microseconds expire_time,
                     const DeferredCallback& callback)
     {
-        if (not deferred_callbacks_.push_back({callback, expire_time})) {
-            warning(pfrm, "failed to enq timeout");
+        if (not deferred_callbacks_.push(expire_time, callback)) {
+            StringBuffer<64> msg = "failed to enq timeout, overflows: ";
+            msg += to_string<10>(deferred_callbacks_.stats().overflow_count_);
+            warning(pfrm, msg.c_str());
             return false;
         }
         return true;
     }
 
+    using DeferredCallbacks = TimeoutQueue<DeferredCallback, 48>;
+
+    const DeferredCallbacks& deferred_callbacks() const
+    {
+        return deferred_callbacks_;
+    }
+
     PersistentData& persistent_data()
     {
         return persistent_data_;
@@ -226,12 +279,58 @@ public:
         boss_target_ = target;
     }
 
+    // Frame times, and sprites that didn't fit on screen, accumulated since
+    // the last perf report (see perf_summary()).
+    struct FrameStats {
+        u64 total_ = 0;
+        Microseconds min_ = std::numeric_limits<Microseconds>::max();
+        Microseconds max_ = 0;
+        u32 frames_ = 0;
+
+        u32 sprites_dropped_ = 0;
+        u32 max_sprites_dropped_ = 0;
+
+        void record(Microseconds delta)
+        {
+            total_ += delta;
+            min_ = std::min(min_, delta);
+            max_ = std::max(max_, delta);
+            ++frames_;
+        }
+
+        void record_sprites(u32 dropped)
+        {
+            sprites_dropped_ += dropped;
+            max_sprites_dropped_ = std::max(max_sprites_dropped_, dropped);
+        }
+    };
+
+    const FrameStats& frame_stats() const
+    {
+        return frame_stats_;
+    }
+
+    // How long the most recent call to next_level() spent generating the map.
+    Microseconds level_gen_time() const
+    {
+        return level_gen_time_;
+    }
+
+    // Prints a perf summary to the remote console every interval frames, or
+    // stops printing, if interval is zero.
+    void watch_perf(u32 interval)
+    {
+        perf_watch_interval_ = interval;
+        frame_stats_ = {};
+    }
+
 private:
     bool load_save_data(Platform& pfrm);
 
     void init_script(Platform& pfrm);
 
     TileMap tiles_;
+    WallField wall_field_;
     Camera camera_;
     Player player_;
     EnemyGroup enemies_;
@@ -245,25 +344,57 @@ private:
     StatePtr state_;
     Powerups powerups_;
     Rumble rumble_;
+    TimeScale time_scale_;
+
+    // Keys that the current state last saw, and keys pressed since then,
+    // while the simulation was frozen.
+    std::optional<Platform::Keyboard::RestoreState> frozen_keys_;
+    Platform::Keyboard::RestoreState missed_keys_;
 
     u16 boss_target_;
 
     std::optional<PeerPlayer> peer_player_;
+    PlayerReplication player_replication_;
     std::optional<Scavenger> scavenger_;
 
-    Buffer<std::pair<DeferredCallback, Microseconds>, 10> deferred_callbacks_;
+    DataStreams data_streams_;
+    HighscoreSync highscore_sync_;
+
+    DeferredCallbacks deferred_callbacks_;
+
+    FrameStats frame_stats_;
+    u32 perf_watch_interval_ = 0;
+    Microseconds level_gen_time_ = 0;
 
     void seed_map(Platform& platform, TileMap& workspace);
     void regenerate_map(Platform& platform);
     bool respawn_entities(Platform& platform);
 
     void update_transitions(Platform& pf, Microseconds dt);
+
+    void track_frozen_keys(Platform& pf);
+    void restore_frozen_keys(Platform& pf);
 };
 
 
 bool is_boss_level(Level level);
 
 
+template <typename Group> int entity_count(Group& group)
+{
+    int count = 0;
+    group.transform([&](auto& buf) { count += length(buf); });
+    return count;
+}
+
+
+// One line of frame time, memory, and entity stats, which the game streams to
+// the remote console (see the perf-watch lisp function), so that we can profile
+// a running session without pausing it.
+using PerfSummary = StringBuffer<192>;
+PerfSummary perf_summary(Platform& pfrm, Game& game);
+
+
 using BackgroundGenerator = void (*)(Platform&, Game&);
 using DecorationGenerator = int (*)(int x, int y, const TileMap&);
 
@@ -335,8 +466,8 @@ Float apply_gravity_well(const Vec2<Float>& center_pos,
             }();
 
             if (falloff not_eq 0.f) {
-                target.apply_force(interpolate(0.f, strength, dist / falloff) *
-                                   dir);
+                target.apply_force(
+                    interpolate(Float(0), strength, dist / falloff) * dir);
             } else {
                 target.apply_force(strength * dir);
             }
@@ -1,5 +1,6 @@
 #include "game.hpp"
 #include "script/lisp.hpp"
+#include "script/listBuilder.hpp"
 
 
 // We're storing a pointer to the C++ game class instance in a userdata object,
@@ -499,6 +500,154 @@ void Game::init_script(Platform& pfrm)
                       return L_NIL;
                   }));
 
+    lisp::set_var("timeout-stats", lisp::make_function([](int argc) {
+                      auto game = interp_get_game();
+                      if (not game) {
+                          return L_NIL;
+                      }
+
+                      const auto& timeouts = game->deferred_callbacks();
+
+                      lisp::ListBuilder list;
+                      list.push_back(lisp::make_integer(timeouts.size()));
+                      list.push_back(lisp::make_integer(
+                          timeouts.stats().high_water_));
+                      list.push_back(lisp::make_integer(
+                          timeouts.stats().overflow_count_));
+
+                      return list.result();
+                  }));
+
+    // Returns a list, starting with the number of free scratch buffers, then
+    // (live high-water) for scratch buffers allocated whole, then (size live
+    // high-water slabs) for each of the arena's size classes, and finally
+    // (tag live high-water) for each allocate_dynamic() call site.
+    lisp::set_var(
+        "alloc-stats", lisp::make_function([](int argc) {
+            auto pfrm = interp_get_pfrm();
+            if (not pfrm) {
+                return L_NIL;
+            }
+
+            auto& arena = size_class_arena;
+            const auto& whole = arena.buffer_stats();
+
+            lisp::ListBuilder list;
+            list.push_back(
+                lisp::make_integer(pfrm->scratch_buffers_remaining()));
+
+            lisp::ListBuilder w;
+            w.push_back(lisp::make_integer(whole.live_));
+            w.push_back(lisp::make_integer(whole.high_water_));
+            list.push_back(w.result());
+
+            for (int i = 0; i < SizeClassArena::class_count; ++i) {
+                auto& stats = arena.class_stats(i);
+                lisp::ListBuilder c;
+                c.push_back(lisp::make_integer(SizeClassArena::class_size(i)));
+                c.push_back(lisp::make_integer(stats.cells_.live_));
+                c.push_back(lisp::make_integer(stats.cells_.high_water_));
+                c.push_back(lisp::make_integer(stats.slabs_.live_));
+                list.push_back(c.result());
+            }
+
+            arena.for_each_site([&](const SizeClassArena::SiteStats& site) {
+                lisp::ListBuilder s;
+                s.push_back(lisp::make_symbol(
+                    site.tag_, lisp::Symbol::ModeBits::stable_pointer));
+                s.push_back(lisp::make_integer(site.allocs_.live_));
+                s.push_back(lisp::make_integer(site.allocs_.high_water_));
+                list.push_back(s.result());
+            });
+
+            return list.result();
+        }));
+
+    // Returns a list: (frames avg-us min-us max-us), the number of free scratch
+    // buffers, the interpreter's (live pool-size gc-runs) values, the
+    // (enemies details effects) entity counts, and (dropped max-dropped)
+    // sprite counts. Frame times and sprite counts cover the frames since the
+    // last perf-watch report.
+    lisp::set_var(
+        "perf-stats", lisp::make_function([](int argc) {
+            auto pfrm = interp_get_pfrm();
+            auto game = interp_get_game();
+            if (not pfrm or not game) {
+                return L_NIL;
+            }
+
+            const auto& frames = game->frame_stats();
+            const auto gc = lisp::gc_stats();
+
+            lisp::ListBuilder list;
+
+            lisp::ListBuilder f;
+            f.push_back(lisp::make_integer(frames.frames_));
+            if (frames.frames_) {
+                f.push_back(
+                    lisp::make_integer(frames.total_ / frames.frames_));
+                f.push_back(lisp::make_integer(frames.min_));
+                f.push_back(lisp::make_integer(frames.max_));
+            }
+            list.push_back(f.result());
+
+            list.push_back(
+                lisp::make_integer(pfrm->scratch_buffers_remaining()));
+
+            lisp::ListBuilder g;
+            g.push_back(lisp::make_integer(gc.live_));
+            g.push_back(lisp::make_integer(gc.pool_size_));
+            g.push_back(lisp::make_integer(gc.runs_));
+            list.push_back(g.result());
+
+            lisp::ListBuilder e;
+            e.push_back(lisp::make_integer(entity_count(game->enemies())));
+            e.push_back(lisp::make_integer(entity_count(game->details())));
+            e.push_back(lisp::make_integer(entity_count(game->effects())));
+            list.push_back(e.result());
+
+            lisp::ListBuilder s;
+            s.push_back(lisp::make_integer(frames.sprites_dropped_));
+            s.push_back(lisp::make_integer(frames.max_sprites_dropped_));
+            list.push_back(s.result());
+
+            return list.result();
+        }));
+
+    // (perf-watch n) prints a line of perf stats to the remote console every n
+    // frames. (perf-watch 0) stops.
+    lisp::set_var("perf-watch", lisp::make_function([](int argc) {
+                      L_EXPECT_ARGC(argc, 1);
+                      L_EXPECT_OP(0, integer);
+
+                      if (auto game = interp_get_game()) {
+                          const auto interval =
+                              lisp::get_op(0)->integer().value_;
+                          game->watch_perf(std::max(0, interval));
+                      }
+
+                      return L_NIL;
+                  }));
+
+    // (time-scale percent ms) runs the game at percent of normal speed, for
+    // the next ms milliseconds, e.g. (time-scale 25 2000) for slow motion.
+    lisp::set_var("time-scale", lisp::make_function([](int argc) {
+                      L_EXPECT_ARGC(argc, 2);
+                      L_EXPECT_OP(1, integer);
+                      L_EXPECT_OP(0, integer);
+
+                      if (auto game = interp_get_game()) {
+                          const auto percent =
+                              lisp::get_op(1)->integer().value_;
+                          const auto ms = lisp::get_op(0)->integer().value_;
+                          game->time_scale().dilate(
+                              std::max(0, percent) / 100.f,
+                              milliseconds(std::max(0, ms)));
+                      }
+
+                      return L_NIL;
+                  }));
+
     lisp::set_var(
         "pattern-replace-tile", lisp::make_function([](int argc) {
             L_EXPECT_ARGC(argc, 2);
@@ -0,0 +1,37 @@
+#include "highscoreSync.hpp"
+#include <algorithm>
+
+
+bool HighscoreSync::send(DataStreams& streams)
+{
+    // A new connection, maybe to a different peer.
+    received_ = false;
+
+    if (streams.sending()) {
+        return false;
+    }
+
+    std::copy(std::begin(table_), std::end(table_), std::begin(outgoing_));
+
+    return streams.send(stream_id, (const byte*)outgoing_, sizeof outgoing_);
+}
+
+
+byte* HighscoreSync::accept(u16 id, u32 length)
+{
+    if (id not_eq stream_id or length not_eq sizeof incoming_) {
+        return nullptr;
+    }
+
+    return (byte*)incoming_;
+}
+
+
+void HighscoreSync::complete(u16 id)
+{
+    if (id == stream_id) {
+        std::copy(
+            std::begin(incoming_), std::end(incoming_), std::begin(peer_));
+        received_ = true;
+    }
+}
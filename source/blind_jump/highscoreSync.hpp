@@ -0,0 +1,42 @@
+#pragma once
+
+#include "dataStream.hpp"
+#include "persistentData.hpp"
+
+
+// When two players connect, each game streams its highscore table to the
+// other. We keep the peer's table next to our own, and leave our save data
+// alone. The table doesn't fit in a single twelve byte message, so it goes
+// over a DataStream.
+class HighscoreSync : public DataStreams::Sink {
+public:
+    static constexpr const u16 stream_id = 1;
+
+    HighscoreSync(PersistentData::HighScores& table) : table_(table)
+    {
+    }
+
+    // Streams a snapshot of our highscore table to the peer.
+    bool send(DataStreams& streams);
+
+    byte* accept(u16 stream_id, u32 length) override;
+
+    void complete(u16 stream_id) override;
+
+    // The peer's highscores, or nullptr if they haven't arrived yet.
+    const PersistentData::HighScores* peer_highscores() const
+    {
+        return received_ ? &peer_ : nullptr;
+    }
+
+private:
+    PersistentData::HighScores& table_;
+
+    // The table may change while the streams are in flight, so we send and
+    // receive copies.
+    PersistentData::HighScores outgoing_;
+    PersistentData::HighScores incoming_;
+
+    PersistentData::HighScores peer_;
+    bool received_ = false;
+};
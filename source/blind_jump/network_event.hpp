@@ -162,7 +162,12 @@ struct PlayerInfo {
 
     u8 player_id_;
 
-    u8 unused2_[1];
+    // The sender's clock, in units of timestamp_unit. Wraps around every couple
+    // of seconds, so the receiver should only compare timestamps of messages
+    // that arrived close together.
+    u8 timestamp_;
+
+    static constexpr const Microseconds timestamp_unit = milliseconds(8);
 
     // For speed values, the player's speed ranges from float -1.5 to
     // 1.5. Therefore, we can save a lot of space in the message by using single
@@ -333,7 +338,8 @@ struct NewLevelIdle {
 };
 
 
-// Currently unused, reserved for future use.
+// Data streams transfer buffers larger than a single message. See
+// dataStream.hpp for a description of the protocol.
 struct DataStreamAvail {
     Header header_;
     host_u16 stream_id_;
@@ -345,12 +351,13 @@ struct DataStreamAvail {
 };
 
 
-// Currently unused, reserved for future use.
+// Asks the sender to transmit chunk_count_ consecutive chunks, starting from
+// chunk stream_index_.
 struct DataStreamReadRequest {
     Header header_;
     host_u16 stream_id_;
     host_u32 stream_index_;
-    u8 request_id_;
+    u8 chunk_count_;
 
     u8 unused_[4];
 
@@ -358,18 +365,21 @@ struct DataStreamReadRequest {
 };
 
 
-// Currently unused, reserved for future use.
 struct DataStreamReadResponse {
     Header header_;
-    u8 request_id_;
 
-    u8 data_[10];
+    // The low eight bits of the chunk index. The receiver never has more than
+    // a few dozen chunks outstanding, so the sequence number is unambiguous.
+    u8 sequence_;
+
+    static constexpr const u32 chunk_size = 10;
+
+    u8 data_[chunk_size];
 
     static const auto mt = Header::MessageType::data_stream_read_response;
 };
 
 
-// Currently unused, reserved for future use.
 struct DataStreamDoneReading {
     Header header_;
     host_u16 stream_id_;
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "entity/peerPlayer.hpp"
+#include "number/random.hpp"
+
+
+// We used to transmit a PlayerInfo (and, from the host, a SyncSeed) twenty
+// times per second, whether or not anything changed, which used up most of the
+// gba link cable's bandwidth. Now, we only transmit player info when the
+// message would differ from the last one that we sent, along with an
+// occasional keyframe, so that the peer recovers from lost messages. The
+// minimum interval between updates adapts to the link: we back off
+// multiplicatively when the link saturates or drops messages, and speed back up
+// gradually when there's headroom.
+//
+// NOTE: All messages occupy a full max_message_size frame on the wire, so
+// there's nothing to gain by encoding a partial PlayerInfo. Skipping redundant
+// messages is where the savings come from. The peer extrapolates our position
+// from the last message that we sent (see PeerPlayer), so while we're moving in
+// a straight line, we only need to send an update when the peer's estimate
+// drifts too far.
+//
+// Belongs to the Game, rather than to the OverworldState, so that it outlives
+// state transitions. Reset it whenever we connect to a new peer, otherwise,
+// we would start out comparing against a snapshot that the peer never saw.
+struct PlayerReplication {
+    static constexpr const Microseconds min_interval = seconds(1) / 20;
+    static constexpr const Microseconds max_interval = seconds(1) / 4;
+    static constexpr const Microseconds keyframe_interval = seconds(1);
+    static constexpr const Microseconds stats_interval = milliseconds(500);
+
+    net_event::PlayerInfo last_sent_;
+    Microseconds since_sent_ = 0;
+    rng::LinearGenerator last_seed_ = 0;
+
+    // Timestamps for PlayerInfo messages. Wraps along with the timestamps.
+    Microseconds clock_ = 0;
+
+    Microseconds send_interval_ = min_interval;
+    Microseconds send_timer_ = 0;
+    Microseconds keyframe_timer_ = 0;
+    Microseconds stats_timer_ = 0;
+    int last_tx_loss_ = 0;
+
+    void adapt(const Platform::NetworkPeer::Stats& stats)
+    {
+        const bool lost_messages = stats.transmit_loss_ > last_tx_loss_;
+        last_tx_loss_ = stats.transmit_loss_;
+
+        if (lost_messages or stats.link_saturation_ > 80) {
+            send_interval_ = std::min(send_interval_ * 2, max_interval);
+        } else if (stats.link_saturation_ < 50) {
+            send_interval_ =
+                std::max(send_interval_ - milliseconds(10), min_interval);
+        }
+    }
+
+    bool changed(const net_event::PlayerInfo& info) const
+    {
+        static const Float max_drift = 3.f;
+
+        const auto predicted = PeerPlayer::extrapolate(last_sent_, since_sent_);
+        const Vec2<Float> actual{Float(info.x_.get()), Float(info.y_.get())};
+
+        if (distance(predicted, actual) > max_drift) {
+            return true;
+        }
+
+        // Position aside, has anything else changed?
+        auto cmp = info;
+        cmp.x_ = last_sent_.x_;
+        cmp.y_ = last_sent_.y_;
+
+        return memcmp(&cmp, &last_sent_, sizeof cmp) not_eq 0;
+    }
+};
@@ -98,7 +98,7 @@ StatePtr ActiveState::update(Platform& pfrm, Game& game, Microseconds delta)
                       UIMetric::Align::left);
 
     if (game.player().get_health() == 0) {
-        pfrm.sleep(5);
+        game.freeze(5);
 
         player_death(pfrm, game, game.player().get_position());
 
@@ -136,7 +136,7 @@ StatePtr ActiveState::update(Platform& pfrm, Game& game, Microseconds delta)
             // the inventory screen.
             restore_keystates = pfrm.keyboard().dump_state();
 
-            pfrm.speaker().play_sound("openbag", 2);
+            pfrm.speaker().play_sound("openbag"_asset, 2);
 
             return state_pool().create<InventoryState>(true);
 
@@ -149,7 +149,7 @@ StatePtr ActiveState::update(Platform& pfrm, Game& game, Microseconds delta)
 
     if (pfrm.keyboard().down_transition<quick_select_inventory_key>()) {
 
-        pfrm.speaker().play_sound("openbag", 2);
+        pfrm.speaker().play_sound("openbag"_asset, 2);
 
         return state_pool().create<QuickSelectInventoryState>(game);
     }
@@ -163,7 +163,7 @@ StatePtr ActiveState::update(Platform& pfrm, Game& game, Microseconds delta)
              not pfrm.keyboard().pressed<Key::down>())) {
             if (game.inventory().item_count(Item::Type::map_system) not_eq 0) {
                 // TODO: add a specific sound for opening the map
-                pfrm.speaker().play_sound("openbag", 2);
+                pfrm.speaker().play_sound("openbag"_asset, 2);
 
                 return state_pool().create<QuickMapState>(game);
             } else {
@@ -206,7 +206,7 @@ StatePtr ActiveState::update(Platform& pfrm, Game& game, Microseconds delta)
             }
 
             game.player().init(t_pos);
-            pfrm.speaker().play_sound("bell", 5);
+            pfrm.speaker().play_sound("bell"_asset, 5);
             const auto c = current_zone(game).energy_glow_color_;
 
             return state_pool().create<PreFadePauseState>(game, c);
@@ -65,7 +65,7 @@ BossDeathSequenceState::update(Platform& pfrm, Game& game, Microseconds delta)
     case AnimState::init: {
         pfrm.speaker().stop_music();
 
-        pfrm.speaker().play_sound("explosion1", 3, boss_position_);
+        pfrm.speaker().play_sound("explosion1"_asset, 3, boss_position_);
         big_explosion(pfrm, game, boss_position_);
 
         const auto off = 50.f;
@@ -81,7 +81,7 @@ BossDeathSequenceState::update(Platform& pfrm, Game& game, Microseconds delta)
 
     case AnimState::explosion_wait1:
         if (counter_ > milliseconds(300)) {
-            pfrm.speaker().play_sound("explosion1", 3, boss_position_);
+            pfrm.speaker().play_sound("explosion1"_asset, 3, boss_position_);
             big_explosion(pfrm, game, boss_position_);
             const auto off = -50.f;
 
@@ -101,7 +101,7 @@ BossDeathSequenceState::update(Platform& pfrm, Game& game, Microseconds delta)
             counter_ = 0;
             anim_state_ = AnimState::fade;
 
-            pfrm.speaker().play_sound("explosion2", 4, boss_position_);
+            pfrm.speaker().play_sound("explosion2"_asset, 4, boss_position_);
 
             for (int i = 0; i <
                             [&] {
@@ -27,7 +27,7 @@ StatePtr DeathFadeState::update(Platform& pfrm, Game& game, Microseconds delta)
         death_text_overlay += locale_language_name(locale_get_language());
 
         if (not pfrm.load_overlay_texture(death_text_overlay.c_str())) {
-            pfrm.load_overlay_texture("death_text_english");
+            pfrm.load_overlay_texture("death_text_english"_asset);
         }
 
         if (locale_language_name(locale_get_language()) == "russian") {
@@ -72,7 +72,7 @@ bool DialogState::advance_text(Platform& pfrm,
         text_state_.timer_ = 0;
 
         if (sfx) {
-            pfrm.speaker().play_sound("msg", 5);
+            pfrm.speaker().play_sound("msg"_asset, 5);
         }
 
         if (text_state_.current_word_remaining_ == 0) {
@@ -165,7 +165,7 @@ bool DialogState::advance_asian_text(Platform& pfrm,
         text_state_.timer_ = 0;
 
         if (sfx) {
-            pfrm.speaker().play_sound("msg", 5);
+            pfrm.speaker().play_sound("msg"_asset, 5);
         }
 
         // At this point, we know the length of the next space-delimited word in
@@ -204,7 +204,7 @@ void DialogState::enter(Platform& pfrm, Game& game, State& prev_state)
 {
     OverworldState::enter(pfrm, game, prev_state);
 
-    pfrm.load_overlay_texture("overlay_dialog");
+    pfrm.load_overlay_texture("overlay_dialog"_asset);
 
     asian_language_ =
         (locale_language_name(locale_get_language()) == "chinese");
@@ -220,7 +220,7 @@ void DialogState::exit(Platform& pfrm, Game& game, State& next_state)
 {
     OverworldState::exit(pfrm, game, next_state);
 
-    pfrm.load_overlay_texture("overlay");
+    pfrm.load_overlay_texture("overlay"_asset);
 }
 
 
@@ -108,7 +108,7 @@ EditSettingsState::update(Platform& pfrm, Game& game, Microseconds delta)
     MenuState::update(pfrm, game, delta);
 
     if (pfrm.keyboard().down_transition(game.action2_key())) {
-        pfrm.speaker().play_sound("select", 1);
+        pfrm.speaker().play_sound("select"_asset, 1);
         exit_ = true;
         pfrm.enable_expanded_glyph_mode(false);
 
@@ -124,7 +124,7 @@ EditSettingsState::update(Platform& pfrm, Game& game, Microseconds delta)
     }
 
     if (exit_) {
-        pfrm.load_overlay_texture("overlay");
+        pfrm.load_overlay_texture("overlay"_asset);
 
         return exit_state_();
     }
@@ -151,13 +151,13 @@ EditSettingsState::update(Platform& pfrm, Game& game, Microseconds delta)
         // if (not locale_requires_doublesize_font()) { // FIXME
         if (select_row_ < static_cast<int>(lines_.size() - 1)) {
             select_row_ += 1;
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
         }
         // }
     } else if (pfrm.keyboard().down_transition<Key::up>()) {
         if (select_row_ > 0) {
             select_row_ -= 1;
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
         }
     } else if (pfrm.keyboard().down_transition<Key::right>()) {
 
@@ -169,7 +169,7 @@ EditSettingsState::update(Platform& pfrm, Game& game, Microseconds delta)
 
         updater.complete(pfrm, game, *this);
 
-        pfrm.speaker().play_sound("scroll", 1);
+        pfrm.speaker().play_sound("scroll"_asset, 1);
 
     } else if (pfrm.keyboard().down_transition<Key::left>()) {
 
@@ -181,7 +181,7 @@ EditSettingsState::update(Platform& pfrm, Game& game, Microseconds delta)
 
         updater.complete(pfrm, game, *this);
 
-        pfrm.speaker().play_sound("scroll", 1);
+        pfrm.speaker().play_sound("scroll"_asset, 1);
     }
 
     if (bigfont) {
@@ -5,7 +5,7 @@ void EndingCreditsState::enter(Platform& pfrm, Game& game, State&)
 {
     auto screen_tiles = calc_screen_tiles(pfrm);
 
-    pfrm.load_tile0_texture("tilesheet3");
+    pfrm.load_tile0_texture("tilesheet3"_asset);
     game.transporter().set_position({10000, 10000});
     game.enemies().clear();
     game.details().clear();
@@ -14,7 +14,7 @@ void EndingCreditsState::enter(Platform& pfrm, Game& game, State&)
     next_y_ = screen_tiles.y + 2;
 
     game.on_timeout(pfrm, milliseconds(500), [](Platform& pfrm, Game&) {
-        pfrm.speaker().play_music("clair_de_lune", 0);
+        pfrm.speaker().play_music("clair_de_lune"_asset, 0);
     });
 }
 
@@ -265,8 +265,8 @@ EndingCreditsState::update(Platform& pfrm, Game& game, Microseconds delta)
         }
 
 
-        for (int x = 0; x < 16; ++x) {
-            for (int y = 0; y < 20; ++y) {
+        for (int x = 0; x < TileMap::width; ++x) {
+            for (int y = 0; y < TileMap::height; ++y) {
                 pfrm.set_tile(Layer::map_0, x, y, 0);
                 pfrm.set_tile(Layer::map_1, x, y, 0);
             }
@@ -19,8 +19,8 @@ void EndingCutsceneState::enter(Platform& pfrm, Game& game, State& prev_state)
 
     pfrm.enable_glyph_mode(true);
 
-    pfrm.load_tile0_texture("ending_scene_flattened");
-    pfrm.load_tile1_texture("tilesheet_top");
+    pfrm.load_tile0_texture("ending_scene_flattened"_asset);
+    pfrm.load_tile1_texture("tilesheet_top"_asset);
 
     const auto screen_tiles = calc_screen_tiles(pfrm);
 
@@ -74,10 +74,10 @@ EndingCutsceneState::update(Platform& pfrm, Game& game, Microseconds delta)
         anim_counter_ = 0;
         if (anim_index_ == 1) {
             anim_index_ = 0;
-            pfrm.load_tile0_texture("ending_scene_flattened");
+            pfrm.load_tile0_texture("ending_scene_flattened"_asset);
         } else {
             anim_index_ = 1;
-            pfrm.load_tile0_texture("ending_scene_2_flattened");
+            pfrm.load_tile0_texture("ending_scene_2_flattened"_asset);
         }
     }
 
@@ -36,7 +36,7 @@ StatePtr FadeInState::update(Platform& pfrm, Game& game, Microseconds delta)
             return state_pool().create<ActiveState>();
         } else {
             pfrm.screen().fade(1.f, current_zone(game).energy_glow_color_);
-            pfrm.sleep(2);
+            game.freeze(2);
             game.player().set_visible(true);
 
             game.rumble(pfrm, milliseconds(250));
@@ -5,7 +5,7 @@ void HealthAndSafetyWarningState::enter(Platform& pfrm,
                                         Game& game,
                                         State& prev_state)
 {
-    pfrm.load_overlay_texture("overlay_journal");
+    pfrm.load_overlay_texture("overlay_journal"_asset);
 
     pfrm.enable_glyph_mode(true);
     tv_.emplace(pfrm);
@@ -80,7 +80,7 @@ StatePtr HealthAndSafetyWarningState::update(Platform& pfrm,
         text_.reset();
         continue_text_.reset();
         pfrm.fill_overlay(0);
-        pfrm.load_overlay_texture("overlay");
+        pfrm.load_overlay_texture("overlay"_asset);
         display_mode_ = DisplayMode::exit;
         break;
 
@@ -111,7 +111,7 @@ void IntroCreditsState::enter(Platform& pfrm, Game& game, State&)
     pfrm.screen().fade(1.f);
 
     if (game.level() == 0) {
-        pfrm.speaker().play_music("rocketlaunch", 0);
+        pfrm.speaker().play_music("rocketlaunch"_asset, 0);
     }
 }
 
@@ -183,7 +183,8 @@ IntroCreditsState::update(Platform& pfrm, Game& game, Microseconds delta)
 
             if (skip) {
                 if (game.level() == 0) {
-                    pfrm.speaker().play_music("rocketlaunch", music_offset());
+                    pfrm.speaker().play_music("rocketlaunch"_asset,
+                                              music_offset());
                 }
 
                 return next_state(pfrm, game);
@@ -66,10 +66,10 @@ StatePtr InventoryState::update(Platform& pfrm, Game& game, Microseconds delta)
         if (pfrm.keyboard().down_transition<Key::left>()) {
             if (selector_coord_.x > 0) {
                 selector_coord_.x -= 1;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             } else {
                 if (page_ > 0) {
-                    pfrm.speaker().play_sound("scroll", 1);
+                    pfrm.speaker().play_sound("scroll"_asset, 1);
                     page_ -= 1;
                     selector_coord_.x = 4;
                     if (page_text_) {
@@ -84,10 +84,10 @@ StatePtr InventoryState::update(Platform& pfrm, Game& game, Microseconds delta)
         } else if (pfrm.keyboard().down_transition<Key::right>()) {
             if (selector_coord_.x < 4) {
                 selector_coord_.x += 1;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             } else {
                 if (page_ < Inventory::pages - 1) {
-                    pfrm.speaker().play_sound("scroll", 1);
+                    pfrm.speaker().play_sound("scroll"_asset, 1);
                     page_ += 1;
                     selector_coord_.x = 0;
                     if (page_text_) {
@@ -101,14 +101,14 @@ StatePtr InventoryState::update(Platform& pfrm, Game& game, Microseconds delta)
 
         } else if (pfrm.keyboard().down_transition<Key::down>()) {
             if (selector_coord_.y < 1) {
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
                 selector_coord_.y += 1;
             }
             update_item_description(pfrm, game);
 
         } else if (pfrm.keyboard().down_transition<Key::up>()) {
             if (selector_coord_.y > 0) {
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
                 selector_coord_.y -= 1;
             }
             update_item_description(pfrm, game);
@@ -176,7 +176,7 @@ void InventoryState::enter(Platform& pfrm, Game& game, State& prev_state)
         pfrm.screen().fade(1.f);
     }
 
-    pfrm.load_overlay_texture("overlay");
+    pfrm.load_overlay_texture("overlay"_asset);
 
     update_arrow_icons(pfrm);
     draw_dot_grid(pfrm);
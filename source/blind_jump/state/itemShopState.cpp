@@ -577,7 +577,7 @@ StatePtr ItemShopState::update(Platform& pfrm, Game& game, Microseconds delta)
 
 
             display_mode_ = DisplayMode::show_buy_options;
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
 
             show_buy_option_label(pfrm, game);
         }
@@ -596,7 +596,7 @@ StatePtr ItemShopState::update(Platform& pfrm, Game& game, Microseconds delta)
         if (pfrm.keyboard().down_transition<Key::right>()) {
             if (selector_x_ < 2) {
                 ++selector_x_;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
                 show_buy_option_label(pfrm, game);
             }
         } else if (pfrm.keyboard().down_transition<Key::left>() or
@@ -604,7 +604,7 @@ StatePtr ItemShopState::update(Platform& pfrm, Game& game, Microseconds delta)
                        game.persistent_data().settings_.action1_key_)) {
             if (selector_x_ > 1) {
                 --selector_x_;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
                 show_buy_option_label(pfrm, game);
             } else {
                 display_mode_ = DisplayMode::deflate_buy_options;
@@ -675,7 +675,7 @@ StatePtr ItemShopState::update(Platform& pfrm, Game& game, Microseconds delta)
             show_buy_icons(pfrm, game);
 
             selector_x_ = 0;
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
         }
 
         game.camera().push_ballast({player_pos.x - 25, player_pos.y});
@@ -709,22 +709,22 @@ StatePtr ItemShopState::update(Platform& pfrm, Game& game, Microseconds delta)
         } else if (pfrm.keyboard().down_transition<Key::down>()) {
             if (selector_pos_ < 2) {
                 ++selector_pos_;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             } else if (buy_items_remaining_) {
                 buy_page_num_++;
                 selector_pos_ = 0;
                 show_buy_icons(pfrm, game);
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             }
         } else if (pfrm.keyboard().down_transition<Key::up>()) {
             if (selector_pos_ > 0) {
                 --selector_pos_;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             } else if (buy_page_num_ > 0) {
                 buy_page_num_--;
                 selector_pos_ = 2;
                 show_buy_icons(pfrm, game);
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             }
         }
 
@@ -804,7 +804,7 @@ StatePtr ItemShopState::update(Platform& pfrm, Game& game, Microseconds delta)
 
 
             display_mode_ = DisplayMode::show_sell_options;
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
 
             show_sell_option_label(pfrm, game);
         }
@@ -824,7 +824,7 @@ StatePtr ItemShopState::update(Platform& pfrm, Game& game, Microseconds delta)
         if (pfrm.keyboard().down_transition<Key::left>()) {
             if (selector_x_ < 2) {
                 ++selector_x_;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
                 show_sell_option_label(pfrm, game);
             }
         } else if (pfrm.keyboard().down_transition<Key::right>() or
@@ -832,7 +832,7 @@ StatePtr ItemShopState::update(Platform& pfrm, Game& game, Microseconds delta)
                        game.persistent_data().settings_.action1_key_)) {
             if (selector_x_ > 1) {
                 --selector_x_;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
                 show_sell_option_label(pfrm, game);
             } else {
                 display_mode_ = DisplayMode::deflate_sell_options;
@@ -924,7 +924,7 @@ StatePtr ItemShopState::update(Platform& pfrm, Game& game, Microseconds delta)
             // player some score, because the score-added sound would still be
             // playing.
             if (game.player().get_sprite().get_mix().amount_ == 0) {
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             }
         }
 
@@ -959,22 +959,22 @@ StatePtr ItemShopState::update(Platform& pfrm, Game& game, Microseconds delta)
         } else if (pfrm.keyboard().down_transition<Key::down>()) {
             if (selector_pos_ < 2) {
                 ++selector_pos_;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             } else if (sell_items_remaining_) {
                 sell_page_num_++;
                 selector_pos_ = 0;
                 show_sell_icons(pfrm, game);
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             }
         } else if (pfrm.keyboard().down_transition<Key::up>()) {
             if (selector_pos_ > 0) {
                 --selector_pos_;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             } else if (sell_page_num_ > 0) {
                 sell_page_num_--;
                 selector_pos_ = 2;
                 show_sell_icons(pfrm, game);
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             }
         }
 
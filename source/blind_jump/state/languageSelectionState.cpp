@@ -105,7 +105,7 @@ LanguageSelectionState::update(Platform& pfrm, Game& game, Microseconds delta)
     draw_cursor_image(pfrm, &languages_[cursor_loc_], left, right);
 
     if (pfrm.keyboard().down_transition<Key::action_1>()) {
-        pfrm.speaker().play_sound("select", 1);
+        pfrm.speaker().play_sound("select"_asset, 1);
 
         locale_set_language(cursor_loc_ + 1);
 
@@ -121,13 +121,13 @@ LanguageSelectionState::update(Platform& pfrm, Game& game, Microseconds delta)
         if (cursor_loc_ < (int)languages_.size() - 1) {
             draw_cursor_image(pfrm, &languages_[cursor_loc_], 0, 0);
             cursor_loc_ += 1;
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
         }
     } else if (pfrm.keyboard().down_transition<Key::up>()) {
         if (cursor_loc_ > 0) {
             draw_cursor_image(pfrm, &languages_[cursor_loc_], 0, 0);
             cursor_loc_ -= 1;
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
         }
     }
 
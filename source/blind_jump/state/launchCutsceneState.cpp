@@ -8,7 +8,7 @@ void LaunchCutsceneState::enter(Platform& pfrm, Game& game, State& prev_state)
         // if we're running this cutscene, and the previous state was anything
         // other than the intro credits scene, we need to jump ahead in the
         // audio track to the proper position.
-        pfrm.speaker().play_music("rocketlaunch",
+        pfrm.speaker().play_music("rocketlaunch"_asset,
                                   IntroCreditsState::music_offset());
     }
 
@@ -30,10 +30,10 @@ void LaunchCutsceneState::enter(Platform& pfrm, Game& game, State& prev_state)
 
     pfrm.screen().fade(1.f);
 
-    pfrm.load_sprite_texture("spritesheet_launch_anim");
-    pfrm.load_overlay_texture("overlay_cutscene");
-    pfrm.load_tile0_texture("launch_flattened");
-    pfrm.load_tile1_texture("tilesheet_top");
+    pfrm.load_sprite_texture("spritesheet_launch_anim"_asset);
+    pfrm.load_overlay_texture("overlay_cutscene"_asset);
+    pfrm.load_tile0_texture("launch_flattened"_asset);
+    pfrm.load_tile1_texture("tilesheet_top"_asset);
 
     // pfrm.screen().fade(0.f, ColorConstant::silver_white);
 
@@ -88,7 +88,7 @@ void LaunchCutsceneState::exit(Platform& pfrm, Game& game, State& next_state)
     pfrm.fill_overlay(0);
     altitude_text_.reset();
 
-    // pfrm.load_overlay_texture("overlay");
+    // pfrm.load_overlay_texture("overlay"_asset);
 
     game.details().transform([](auto& buf) { buf.clear(); });
     game.effects().transform([](auto& buf) { buf.clear(); });
@@ -260,8 +260,8 @@ LaunchCutsceneState::update(Platform& pfrm, Game& game, Microseconds delta)
 
             game.effects().transform([](auto& buf) { buf.clear(); });
 
-            pfrm.load_tile0_texture("tilesheet_intro_cutscene_flattened");
-            pfrm.load_sprite_texture("spritesheet_intro_clouds");
+            pfrm.load_tile0_texture("tilesheet_intro_cutscene_flattened"_asset);
+            pfrm.load_sprite_texture("spritesheet_intro_clouds"_asset);
 
             for (int i = 0; i < 32; ++i) {
                 for (int j = 0; j < 32; ++j) {
@@ -392,7 +392,8 @@ LaunchCutsceneState::update(Platform& pfrm, Game& game, Microseconds delta)
         break;
 
     case Scene::exit_clouds: {
-        camera_offset_ = interpolate(-50.f, camera_offset_, delta * 0.0000005f);
+        camera_offset_ =
+            interpolate(Float(-50), camera_offset_, delta * 0.0000005f);
 
         game.camera().set_position(pfrm, {0, camera_offset_});
 
@@ -433,7 +434,7 @@ LaunchCutsceneState::update(Platform& pfrm, Game& game, Microseconds delta)
         if (timer_ > fade_duration) {
             altitude_text_.reset();
 
-            pfrm.sleep(5);
+            game.freeze(5);
 
             return state_pool().create<NewLevelState>(Level{0});
 
@@ -451,7 +452,7 @@ LaunchCutsceneState::update(Platform& pfrm, Game& game, Microseconds delta)
 
     if (pfrm.keyboard().down_transition(game.action2_key()) and
         static_cast<int>(scene_) > static_cast<int>(Scene::fade_transition0)) {
-        pfrm.speaker().play_sound("select", 1);
+        pfrm.speaker().play_sound("select"_asset, 1);
         return state_pool().create<NewLevelState>(Level{0});
     }
 
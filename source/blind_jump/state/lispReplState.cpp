@@ -103,7 +103,7 @@ void LispReplState::repaint_entry(Platform& pfrm, bool show_cursor)
 
 void LispReplState::enter(Platform& pfrm, Game& game, State& prev_state)
 {
-    // pfrm.load_overlay_texture("repl");
+    // pfrm.load_overlay_texture("repl"_asset);
 
     locale_set_language(1);
 
@@ -225,12 +225,12 @@ StatePtr LispReplState::update(Platform& pfrm, Game& game, Microseconds delta)
             completion_cursor_ < completion_strs_.size() - 1) {
             ++completion_cursor_;
             repaint_completions(pfrm);
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
         } else if (pfrm.keyboard().down_transition<Key::up>() and
                    completion_cursor_ > 0) {
             --completion_cursor_;
             repaint_completions(pfrm);
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
         } else if (pfrm.keyboard().down_transition(game.action1_key())) {
             repaint_entry(pfrm);
             completion_strs_.clear();
@@ -242,7 +242,7 @@ StatePtr LispReplState::update(Platform& pfrm, Game& game, Microseconds delta)
             repaint_entry(pfrm);
             completion_strs_.clear();
             completions_.clear();
-            pfrm.speaker().play_sound("typewriter", 2);
+            pfrm.speaker().play_sound("typewriter"_asset, 2);
             display_mode_ = DisplayMode::entry;
         }
         break;
@@ -258,7 +258,7 @@ StatePtr LispReplState::update(Platform& pfrm, Game& game, Microseconds delta)
             command_.push_back(
                 keyboard[keyboard_cursor_.y][keyboard_cursor_.x][0]);
             repaint_entry(pfrm);
-            pfrm.speaker().play_sound("typewriter", 2);
+            pfrm.speaker().play_sound("typewriter"_asset, 2);
         } else if (pfrm.keyboard().down_transition<Key::alt_1>()) {
             // Try to isolate an identifier from the command buffer, for autocomplete.
 
@@ -327,7 +327,7 @@ StatePtr LispReplState::update(Platform& pfrm, Game& game, Microseconds delta)
 
         if (pfrm.keyboard().down_transition<Key::start>()) {
 
-            pfrm.speaker().play_sound("tw_bell", 2);
+            pfrm.speaker().play_sound("tw_bell"_asset, 2);
 
             lisp::read(command_.c_str());
             lisp::eval(lisp::get_op(0));
@@ -350,7 +350,7 @@ StatePtr LispReplState::update(Platform& pfrm, Game& game, Microseconds delta)
             } else {
                 keyboard_cursor_.x -= 1;
             }
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
             repaint_entry(pfrm);
         } else if (pfrm.keyboard().down_transition<Key::right>()) {
             if (keyboard_cursor_.x == 5) {
@@ -358,7 +358,7 @@ StatePtr LispReplState::update(Platform& pfrm, Game& game, Microseconds delta)
             } else {
                 keyboard_cursor_.x += 1;
             }
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
             repaint_entry(pfrm);
         } else if (pfrm.keyboard().down_transition<Key::up>()) {
             if (keyboard_cursor_.y == 0) {
@@ -366,7 +366,7 @@ StatePtr LispReplState::update(Platform& pfrm, Game& game, Microseconds delta)
             } else {
                 keyboard_cursor_.y -= 1;
             }
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
             repaint_entry(pfrm);
         } else if (pfrm.keyboard().down_transition<Key::down>()) {
             if (keyboard_cursor_.y == 6) {
@@ -374,7 +374,7 @@ StatePtr LispReplState::update(Platform& pfrm, Game& game, Microseconds delta)
             } else {
                 keyboard_cursor_.y += 1;
             }
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
             repaint_entry(pfrm);
         }
         break;
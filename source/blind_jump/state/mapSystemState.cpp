@@ -104,15 +104,15 @@ StatePtr MapSystemState::update(Platform& pfrm, Game& game, Microseconds delta)
 
             // sigh...
             if (locale_requires_doublesize_font()) {
-                set_tile(TileMap::width + 2, 4, 137, false);  // you
-                set_tile(TileMap::width + 2, 7, 135, false);  // enemy
-                set_tile(TileMap::width + 2, 10, 136, false); // transporter
-                set_tile(TileMap::width + 2, 13, 134, false); // item
-                set_tile(TileMap::width + 2, 16, 393, false); // shop
+                set_tile(minimap_width + 2, 4, 137, false);  // you
+                set_tile(minimap_width + 2, 7, 135, false);  // enemy
+                set_tile(minimap_width + 2, 10, 136, false); // transporter
+                set_tile(minimap_width + 2, 13, 134, false); // item
+                set_tile(minimap_width + 2, 16, 393, false); // shop
 
                 legend_border_.emplace(pfrm,
                                        OverlayCoord{11, 16},
-                                       OverlayCoord{TileMap::width + 2, 3},
+                                       OverlayCoord{minimap_width + 2, 3},
                                        false,
                                        8);
 
@@ -124,20 +124,20 @@ StatePtr MapSystemState::update(Platform& pfrm, Game& game, Microseconds delta)
                     legend_text_[i].emplace(
                         pfrm,
                         locale_string(pfrm, legend_strings[i])->c_str(),
-                        OverlayCoord{TileMap::width + 5, y},
+                        OverlayCoord{minimap_width + 5, y},
                         font_conf);
                 }
 
             } else {
-                set_tile(TileMap::width + 2, 9, 137, false);  // you
-                set_tile(TileMap::width + 2, 11, 135, false); // enemy
-                set_tile(TileMap::width + 2, 13, 136, false); // transporter
-                set_tile(TileMap::width + 2, 15, 134, false); // item
-                set_tile(TileMap::width + 2, 17, 393, false); // shop
+                set_tile(minimap_width + 2, 9, 137, false);  // you
+                set_tile(minimap_width + 2, 11, 135, false); // enemy
+                set_tile(minimap_width + 2, 13, 136, false); // transporter
+                set_tile(minimap_width + 2, 15, 134, false); // item
+                set_tile(minimap_width + 2, 17, 393, false); // shop
 
                 legend_border_.emplace(pfrm,
                                        OverlayCoord{11, 11},
-                                       OverlayCoord{TileMap::width + 2, 8},
+                                       OverlayCoord{minimap_width + 2, 8},
                                        false,
                                        8);
 
@@ -146,12 +146,13 @@ StatePtr MapSystemState::update(Platform& pfrm, Game& game, Microseconds delta)
                     legend_text_[i].emplace(
                         pfrm,
                         locale_string(pfrm, legend_strings[i])->c_str(),
-                        OverlayCoord{TileMap::width + 5, y});
+                        OverlayCoord{minimap_width + 5, y});
                 }
             }
 
             path_finder_.emplace(allocate_dynamic<IncrementalPathfinder>(
                 pfrm,
+                "pathfinder",
                 pfrm,
                 game.tiles(),
                 get_constrained_player_tile_coord(game).cast<u8>(),
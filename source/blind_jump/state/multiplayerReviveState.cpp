@@ -61,7 +61,7 @@ MultiplayerReviveState::update(Platform& pfrm, Game& game, Microseconds delta)
             show_menu(pfrm);
         }
 
-        pfrm.speaker().play_sound("scroll", 1);
+        pfrm.speaker().play_sound("scroll"_asset, 1);
 
     } else if (pfrm.keyboard().down_transition<Key::down>()) {
         if (donate_health_count_ > 0) {
@@ -70,14 +70,14 @@ MultiplayerReviveState::update(Platform& pfrm, Game& game, Microseconds delta)
             show_menu(pfrm);
         }
 
-        pfrm.speaker().play_sound("scroll", 1);
+        pfrm.speaker().play_sound("scroll"_asset, 1);
 
     } else if (pfrm.keyboard().down_transition(game.action2_key())) {
         if (donate_health_count_ == 0) {
             return state_pool().create<ActiveState>();
         }
 
-        pfrm.speaker().play_sound("select", 1);
+        pfrm.speaker().play_sound("select"_asset, 1);
 
         net_event::HealthTransfer hp;
         hp.amount_.set(donate_health_count_);
@@ -6,7 +6,7 @@ void NetworkConnectWaitState::enter(Platform& pfrm,
                                     Game& game,
                                     State& prev_state)
 {
-    pfrm.load_overlay_texture("overlay_network_flattened");
+    pfrm.load_overlay_texture("overlay_network_flattened"_asset);
     pfrm.fill_overlay(85);
     draw_image(pfrm, 85, 1, 4, 28, 13, Layer::overlay);
 }
@@ -18,12 +18,16 @@ void NetworkConnectWaitState::exit(Platform& pfrm,
 {
     pfrm.fill_overlay(0);
     pfrm.screen().fade(1.f, ColorConstant::rich_black, {}, true, true);
-    pfrm.load_overlay_texture("overlay");
+    pfrm.load_overlay_texture("overlay"_asset);
 
     if (not dynamic_cast<MenuState*>(&next_state)) {
 
         if (auto os = dynamic_cast<OverworldState*>(&next_state)) {
             if (pfrm.network_peer().is_connected()) {
+                // Start over, rather than picking up where we left off with
+                // a previous peer.
+                game.player_replication() = {};
+
                 push_notification(
                     pfrm,
                     os,
@@ -43,6 +47,8 @@ void NetworkConnectWaitState::exit(Platform& pfrm,
 
                 net_event::transmit(pfrm, vn);
 
+                game.highscore_sync().send(game.data_streams());
+
             } else {
                 push_notification(
                     pfrm,
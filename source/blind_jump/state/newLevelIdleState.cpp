@@ -177,10 +177,22 @@ NewLevelIdleState::update(Platform& pfrm, Game& game, Microseconds delta)
         }
 
         if (not bosses_remaining) {
-            pfrm.sleep(150);
-            pfrm.speaker().play_music("waves", 0);
-            pfrm.sleep(240);
-            return state_pool().create<EndingCutsceneState>();
+            // A pause, then the ending music, and a few seconds later, the
+            // ending cutscene.
+            const auto music_start = milliseconds(2500);
+
+            if (ending_timer_ < music_start and
+                ending_timer_ + delta >= music_start) {
+                pfrm.speaker().play_music("waves"_asset, 0);
+            }
+
+            ending_timer_ += delta;
+
+            if (ending_timer_ > music_start + seconds(4)) {
+                return state_pool().create<EndingCutsceneState>();
+            }
+
+            return null_state();
         }
 
         return state_pool().create<NewLevelState>(next_level);
@@ -9,7 +9,7 @@ void NewLevelState::enter(Platform& pfrm, Game& game, State&)
 {
     pfrm.screen().fade(1.f);
 
-    pfrm.load_overlay_texture("overlay");
+    pfrm.load_overlay_texture("overlay"_asset);
 
     std::get<BlindJumpGlobalData>(globals()).visited_.clear();
 }
@@ -75,7 +75,7 @@ StatePtr NewLevelState::update(Platform& pfrm, Game& game, Microseconds delta)
                     text_[1]->append(l2str->c_str());
                 }
 
-                pfrm.sleep(5);
+                game.freeze(5);
 
             } else {
                 FontConfiguration font_conf;
@@ -212,9 +212,9 @@ StatePtr NewLevelState::update(Platform& pfrm, Game& game, Microseconds delta)
 
             repaint(std::min(max_i, i));
 
-            if (timer_ > seconds(1)) {
-                pfrm.sleep(80);
-
+            // Hold the finished title on screen for a moment before starting
+            // the music.
+            if (timer_ > seconds(1) + milliseconds(1333)) {
                 pfrm.speaker().play_music(zone.music_name_, zone.music_offset_);
 
                 return state_pool().create<FadeInState>(game);
@@ -10,7 +10,7 @@ NotebookState::NotebookState(LocalizedText&& str)
 
 void NotebookState::enter(Platform& pfrm, Game&, State&)
 {
-    // pfrm.speaker().play_sound("open_book", 0);
+    // pfrm.speaker().play_sound("open_book"_asset, 0);
 
     pfrm.sleep(1); // Well, this is embarassing... basically, the fade function
                    // creates tearing on the gameboy, and we can mitigate the
@@ -21,7 +21,7 @@ void NotebookState::enter(Platform& pfrm, Game&, State&)
                    // period, causing tearing anyway.
 
     pfrm.screen().fade(1.f, ColorConstant::rich_black, {}, true, true);
-    pfrm.load_overlay_texture("overlay_journal");
+    pfrm.load_overlay_texture("overlay_journal"_asset);
     pfrm.screen().fade(1.f, ColorConstant::aged_paper, {}, true, true);
 
     auto screen_tiles = calc_screen_tiles(pfrm);
@@ -233,7 +233,7 @@ StatePtr NotebookState::update(Platform& pfrm, Game& game, Microseconds delta)
 
     case DisplayMode::transition:
         repaint_page(pfrm);
-        pfrm.speaker().play_sound("open_book", 0);
+        pfrm.speaker().play_sound("open_book"_asset, 0);
         display_mode_ = DisplayMode::after_transition;
         break;
     }
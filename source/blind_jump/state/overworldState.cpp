@@ -165,7 +165,7 @@ void OverworldState::receive(const net_event::ItemChestShared& s,
 
     if (game.peer() and
         create_item_chest(game, game.peer()->get_position(), s.item_, false)) {
-        pfrm.speaker().play_sound("dropitem", 3);
+        pfrm.speaker().play_sound("dropitem"_asset, 3);
         (*game.details().get<ItemChest>().begin())->override_id(s.id_.get());
     } else {
         error(pfrm, "failed to allocate shared item chest");
@@ -237,11 +237,9 @@ void OverworldState::receive(const net_event::EnemyHealthChanged& hc,
 }
 
 
-static void transmit_player_info(Platform& pfrm, Game& game)
+static net_event::PlayerInfo make_player_info(Game& game)
 {
-    net_event::PlayerInfo info;
-    info.opt1_ = 0;
-    info.opt2_ = 0;
+    net_event::PlayerInfo info{};
     info.header_.message_type_ = net_event::Header::player_info;
     info.x_.set(game.player().get_position().cast<s16>().x);
     info.y_.set(game.player().get_position().cast<s16>().y);
@@ -273,7 +271,7 @@ static void transmit_player_info(Platform& pfrm, Game& game)
         info.set_color_amount(0);
     }
 
-    pfrm.network_peer().send_message({(byte*)&info, sizeof info});
+    return info;
 }
 
 
@@ -281,50 +279,84 @@ void OverworldState::multiplayer_sync(Platform& pfrm,
                                       Game& game,
                                       Microseconds delta)
 {
-    // On the gameboy advance, we're dealing with a slow connection and
-    // twenty-year-old technology, so, realistically, we can only transmit
-    // player data a few times per second. TODO: add methods for querying the
-    // uplink performance limits from the Platform class, rather than having
-    // various game-specific hacks here.
-
-    // FIXME: I strongly suspect that this number can be increased without
-    // issues, but I'm waiting until I test on an actual device with a link
-    // cable.
-    //
-    // Note: These numbers seem to result in smooth enough performance on a
-    // physical GBA, so I will not increase the refresh rates per now. Three
-    // updates per second is fairly smooth with interpolation.
-    static const auto player_refresh_rate = seconds(1) / 20;
-
-    static auto update_counter = player_refresh_rate;
-
-    update_counter -= delta;
-    if (update_counter <= 0) {
-        update_counter = player_refresh_rate;
+    auto& r = game.player_replication();
+
+    static const auto clock_period =
+        256 * net_event::PlayerInfo::timestamp_unit;
+
+    r.clock_ = (r.clock_ + delta) % clock_period;
+    r.since_sent_ = std::min(r.since_sent_ + delta, seconds(10));
+
+    r.stats_timer_ += delta;
+    if (r.stats_timer_ >= r.stats_interval) {
+        r.stats_timer_ = 0;
+        r.adapt(pfrm.network_peer().stats());
+    }
+
+    r.send_timer_ -= delta;
+    r.keyframe_timer_ -= delta;
+
+    if (r.send_timer_ <= 0) {
+        const bool keyframe = r.keyframe_timer_ <= 0;
+        bool sent = false;
 
         if (game.player().get_health() > 0) {
-            transmit_player_info(pfrm, game);
+            auto info = make_player_info(game);
+
+            if (keyframe or r.changed(info)) {
+                info.timestamp_ =
+                    r.clock_ / net_event::PlayerInfo::timestamp_unit;
+
+                if (pfrm.network_peer().send_message(
+                        {(byte*)&info, sizeof info})) {
+                    info.timestamp_ = 0;
+                    r.last_sent_ = info;
+                    r.since_sent_ = 0;
+                    sent = true;
+                }
+            }
         }
 
-        if (pfrm.network_peer().is_host()) {
+        if (pfrm.network_peer().is_host() and
+            (keyframe or rng::critical_state not_eq r.last_seed_)) {
             net_event::SyncSeed s;
             s.random_state_.set(rng::critical_state);
             net_event::transmit(pfrm, s);
+
+            r.last_seed_ = rng::critical_state;
+            sent = true;
+        }
+
+        if (sent) {
+            r.send_timer_ = r.send_interval_;
+        }
+
+        if (keyframe) {
+            r.keyframe_timer_ = r.keyframe_interval;
         }
     }
+}
 
 
-    net_event::poll_messages(pfrm, game, *this);
+void OverworldState::realtime_update(Platform& pfrm,
+                                     Game& game,
+                                     Microseconds delta)
+{
+    // Messages keep arriving during hit-stop, e.g. share_item() freezes the
+    // game while it waits for the peer to receive an item chest.
+    if (pfrm.network_peer().is_connected()) {
+        net_event::poll_messages(pfrm, game, *this);
 
-    if (game.peer()) {
-        game.peer()->update(pfrm, game, delta);
+        if (game.peer()) {
+            game.peer()->update(pfrm, game, delta);
+        }
     }
 }
 
 
 void player_death(Platform& pfrm, Game& game, const Vec2<Float>& position)
 {
-    pfrm.speaker().play_sound("explosion1", 3, position);
+    pfrm.speaker().play_sound("explosion1"_asset, 3, position);
     big_explosion(pfrm, game, position);
 }
 
@@ -598,19 +630,17 @@ StatePtr OverworldState::update(Platform& pfrm, Game& game, Microseconds delta)
         break;
 
     case NotificationStatus::flash: {
+        if (notification_freeze) {
+            game.freeze(3);
+        }
+
         const bool bigfont = locale_requires_doublesize_font();
 
         if (bigfont) {
-            for (int x = 0; x < 32; ++x) {
-                pfrm.set_tile(Layer::overlay, x, 0, 110);
-            }
-            for (int x = 0; x < 32; ++x) {
-                pfrm.set_tile(Layer::overlay, x, 1, 110);
-            }
+            fill_overlay_row(pfrm, 0, 110);
+            fill_overlay_row(pfrm, 1, 110);
         } else {
-            for (int x = 0; x < 32; ++x) {
-                pfrm.set_tile(Layer::overlay, x, 0, 108);
-            }
+            fill_overlay_row(pfrm, 0, 108);
         }
         notification_status = NotificationStatus::flash_animate;
         notification_text_timer = -1 * milliseconds(5);
@@ -624,9 +654,7 @@ StatePtr OverworldState::update(Platform& pfrm, Game& game, Microseconds delta)
 
             const auto current_tile = pfrm.get_tile(Layer::overlay, 0, 0);
             if (current_tile < 110) {
-                for (int x = 0; x < 32; ++x) {
-                    pfrm.set_tile(Layer::overlay, x, 0, current_tile + 1);
-                }
+                fill_overlay_row(pfrm, 0, current_tile + 1);
             } else {
                 notification_status = NotificationStatus::wait;
                 notification_text_timer = milliseconds(80);
@@ -667,17 +695,13 @@ StatePtr OverworldState::update(Platform& pfrm, Game& game, Microseconds delta)
             if (locale_requires_doublesize_font()) {
                 notification_status = NotificationStatus::exit_row2;
 
-                for (int x = 0; x < 32; ++x) {
-                    pfrm.set_tile(Layer::overlay, x, 1, 112);
-                }
+                fill_overlay_row(pfrm, 1, 112);
             } else {
                 notification_status = NotificationStatus::exit;
             }
 
 
-            for (int x = 0; x < 32; ++x) {
-                pfrm.set_tile(Layer::overlay, x, 0, 112);
-            }
+            fill_overlay_row(pfrm, 0, 112);
         }
         break;
 
@@ -690,9 +714,7 @@ StatePtr OverworldState::update(Platform& pfrm, Game& game, Microseconds delta)
 
             const auto tile = pfrm.get_tile(Layer::overlay, 0, 1);
             if (tile < 120) {
-                for (int x = 0; x < 32; ++x) {
-                    pfrm.set_tile(Layer::overlay, x, 1, tile + 1);
-                }
+                fill_overlay_row(pfrm, 1, tile + 1);
             } else {
                 notification_text_timer = 0;
                 notification_status = NotificationStatus::exit;
@@ -710,9 +732,7 @@ StatePtr OverworldState::update(Platform& pfrm, Game& game, Microseconds delta)
 
             const auto tile = pfrm.get_tile(Layer::overlay, 0, 0);
             if (tile < 120) {
-                for (int x = 0; x < 32; ++x) {
-                    pfrm.set_tile(Layer::overlay, x, 0, tile + 1);
-                }
+                fill_overlay_row(pfrm, 0, tile + 1);
             } else {
                 notification_status = NotificationStatus::hidden;
                 notification_text.reset();
@@ -766,7 +786,7 @@ StatePtr OverworldState::update(Platform& pfrm, Game& game, Microseconds delta)
 
     if (bosses_were_remaining and not bosses_remaining()) {
         game.effects().transform([](auto& buf) { buf.clear(); });
-        pfrm.sleep(10);
+        game.freeze(10);
         return state_pool().create<BossDeathSequenceState>(
             game, boss_position, boss_defeated_text);
     }
@@ -170,16 +170,16 @@ PauseScreenState::update(Platform& pfrm, Game& game, Microseconds delta)
             cursor_loc_ < int(texts_.size() - 1)) {
 
             cursor_loc_ += 1;
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
             draw_cursor(pfrm);
 
         } else if (pfrm.keyboard().down_transition<Key::up>() and
                    cursor_loc_ > 0) {
             cursor_loc_ -= 1;
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
             draw_cursor(pfrm);
         } else if (pfrm.keyboard().down_transition(game.action2_key())) {
-            pfrm.speaker().play_sound("select", 1);
+            pfrm.speaker().play_sound("select"_asset, 1);
             switch (strs_[cursor_loc_]) {
             case LocaleString::menu_resume:
                 return state_pool().create<ActiveState>();
@@ -41,13 +41,13 @@ StatePtr QuickChatState::update(Platform& pfrm, Game& game, Microseconds delta)
         if (msg_index_ > 0) {
             --msg_index_;
             update_text(pfrm, game);
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
         }
     } else if (pfrm.keyboard().down_transition<Key::down>()) {
         if (static_cast<u32>(msg_index_) < chat_messages.size() - 1) {
             ++msg_index_;
             update_text(pfrm, game);
-            pfrm.speaker().play_sound("scroll", 1);
+            pfrm.speaker().play_sound("scroll"_asset, 1);
         }
     }
 
@@ -57,7 +57,7 @@ StatePtr QuickChatState::update(Platform& pfrm, Game& game, Microseconds delta)
 
         net_event::transmit(pfrm, chat);
 
-        pfrm.sleep(20);
+        game.freeze(20);
     }
 
     return null_state();
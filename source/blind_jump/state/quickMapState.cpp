@@ -152,6 +152,7 @@ StatePtr QuickMapState::update(Platform& pfrm, Game& game, Microseconds delta)
 
             path_finder_.emplace(allocate_dynamic<IncrementalPathfinder>(
                 pfrm,
+                "pathfinder",
                 pfrm,
                 game.tiles(),
                 get_constrained_player_tile_coord(game).cast<u8>(),
@@ -261,10 +261,10 @@ StatePtr QuickSelectInventoryState::update(Platform& pfrm,
 
         if (pfrm.keyboard().down_transition<Key::up>()) {
             if (selector_pos_ > 0) {
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
                 selector_pos_ -= 1;
             } else if (page_ > 0) {
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
                 page_ -= 1;
                 selector_pos_ = items_.capacity() - 1;
                 draw_items(pfrm, game);
@@ -275,10 +275,10 @@ StatePtr QuickSelectInventoryState::update(Platform& pfrm,
         } else if (pfrm.keyboard().down_transition<Key::down>()) {
             if (selector_pos_ < items_.capacity() - 1) {
                 selector_pos_ += 1;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             } else {
                 if (more_pages_) {
-                    pfrm.speaker().play_sound("scroll", 1);
+                    pfrm.speaker().play_sound("scroll"_asset, 1);
                     selector_pos_ = 0;
                     page_ += 1;
                     draw_items(pfrm, game);
@@ -324,7 +324,7 @@ StatePtr QuickSelectInventoryState::update(Platform& pfrm,
                                            game,
                                            game.player().get_position(),
                                            items_[selector_pos_])) {
-                                pfrm.speaker().play_sound("dropitem", 3);
+                                pfrm.speaker().play_sound("dropitem"_asset, 3);
                                 game.inventory().remove_item(page, col, row);
                             }
                         }
@@ -3,7 +3,7 @@
 
 void RespawnWaitState::enter(Platform& pfrm, Game& game, State&)
 {
-    // pfrm.speaker().play_sound("bell", 5);
+    // pfrm.speaker().play_sound("bell"_asset, 5);
 }
 
 
@@ -62,7 +62,7 @@ ScoreScreenState::update(Platform& pfrm, Game& game, Microseconds delta)
             pfrm, milliseconds(100), [this](Platform& pfrm, Game& game) {
                 repaint_stats(pfrm, game);
                 locked_ = false;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
             });
     };
 
@@ -119,7 +119,7 @@ SignalJammerSelectorState::update(Platform& pfrm, Game& game, Microseconds dt)
                     p->colorize({ColorConstant::null, 0});
                 }
 
-                pfrm.sleep(8);
+                game.freeze(8);
 
                 return state_pool().create<InventoryState>(true);
 
@@ -143,7 +143,7 @@ SignalJammerSelectorState::update(Platform& pfrm, Game& game, Microseconds dt)
             if (target_) {
                 mode_ = Mode::selected;
                 timer_ = 0;
-                pfrm.sleep(3);
+                game.freeze(3);
             }
         } else if (pfrm.keyboard().down_transition(game.action1_key())) {
             return state_pool().create<InventoryState>(true);
@@ -17,6 +17,11 @@ StatePtr State::update(Platform&, Game&, Microseconds)
 }
 
 
+void State::realtime_update(Platform&, Game&, Microseconds)
+{
+}
+
+
 static void lethargy_update(Platform& pfrm, Game& game)
 {
     if (auto lethargy = get_powerup(game, Powerup::Type::lethargy)) {
@@ -162,13 +167,10 @@ void push_notification(Platform& pfrm,
                        State* state,
                        const NotificationStr& string)
 {
-    if (not lisp::is_executing()) {
-        pfrm.sleep(3);
-    }
-
     if (auto os = dynamic_cast<OverworldState*>(state)) {
         os->notification_status = OverworldState::NotificationStatus::flash;
         os->notification_str = string;
+        os->notification_freeze = not lisp::is_executing();
     }
 }
 
@@ -431,7 +433,7 @@ constexpr static const InventoryItemHandler inventory_handlers[] = {
      item_icon(Item::Type::long_jump_z2),
      [](Platform& pfrm, Game& game) {
          const auto c = current_zone(game).energy_glow_color_;
-         pfrm.speaker().play_sound("bell", 5);
+         pfrm.speaker().play_sound("bell"_asset, 5);
          game.persistent_data().level_.set(boss_0_level);
          game.score() = 0; // Otherwise, people could exploit the jump packs to
                            // keep replaying a zone, in order to get a really
@@ -445,7 +447,7 @@ constexpr static const InventoryItemHandler inventory_handlers[] = {
      item_icon(Item::Type::long_jump_z2),
      [](Platform& pfrm, Game& game) {
          const auto c = current_zone(game).energy_glow_color_;
-         pfrm.speaker().play_sound("bell", 5);
+         pfrm.speaker().play_sound("bell"_asset, 5);
          game.persistent_data().level_.set(boss_1_level);
          game.score() = 0;
          return state_pool().create<PreFadePauseState>(game, c);
@@ -457,7 +459,7 @@ constexpr static const InventoryItemHandler inventory_handlers[] = {
      item_icon(Item::Type::long_jump_z2),
      [](Platform& pfrm, Game& game) {
          const auto c = current_zone(game).energy_glow_color_;
-         pfrm.speaker().play_sound("bell", 5);
+         pfrm.speaker().play_sound("bell"_asset, 5);
          game.persistent_data().level_.set(boss_2_level);
          game.score() = 0;
          return state_pool().create<PreFadePauseState>(game, c);
@@ -469,7 +471,7 @@ constexpr static const InventoryItemHandler inventory_handlers[] = {
      item_icon(Item::Type::long_jump_z2),
      [](Platform& pfrm, Game& game) {
          const auto c = current_zone(game).energy_glow_color_;
-         pfrm.speaker().play_sound("bell", 5);
+         pfrm.speaker().play_sound("bell"_asset, 5);
          game.persistent_data().level_.set(boss_max_level);
          return state_pool().create<PreFadePauseState>(game, c);
      },
@@ -620,7 +622,13 @@ bool draw_minimap(Platform& pfrm,
                   PathBuffer* path)
 {
     auto set_tile = [&](s8 x, s8 y, int icon, bool dodge = true) {
-        if (y < y_skip_top or y >= TileMap::height - y_skip_bot) {
+        if (minimap_width not_eq TileMap::width) {
+            x = (x * minimap_width) / TileMap::width;
+        }
+        if (minimap_height not_eq TileMap::height) {
+            y = (y * minimap_height) / TileMap::height;
+        }
+        if (y < y_skip_top or y >= minimap_height - y_skip_bot) {
             return;
         }
         const auto tile =
@@ -33,6 +33,34 @@ public:
         game.set_boss_target(t.target_.get());
     }
 
+    void receive(const net_event::DataStreamAvail& m,
+                 Platform& pfrm,
+                 Game& game) override
+    {
+        game.data_streams().receive(pfrm, m);
+    }
+
+    void receive(const net_event::DataStreamReadRequest& m,
+                 Platform& pfrm,
+                 Game& game) override
+    {
+        game.data_streams().receive(pfrm, m);
+    }
+
+    void receive(const net_event::DataStreamReadResponse& m,
+                 Platform& pfrm,
+                 Game& game) override
+    {
+        game.data_streams().receive(pfrm, m);
+    }
+
+    void receive(const net_event::DataStreamDoneReading& m,
+                 Platform& pfrm,
+                 Game& game) override
+    {
+        game.data_streams().receive(pfrm, m);
+    }
+
 
     void
     receive(const net_event::PlayerDied&, Platform& pfrm, Game& game) override;
@@ -61,11 +89,17 @@ public:
     void enter(Platform& pfrm, Game& game, State& prev_state) override;
     void exit(Platform& pfrm, Game& game, State& next_state) override;
 
+    void
+    realtime_update(Platform& pfrm, Game& game, Microseconds delta) override;
+
     virtual void display_time_remaining(Platform&, Game&);
 
     std::optional<Text> notification_text;
     NotificationStr notification_str;
     Microseconds notification_text_timer = 0;
+
+    // Notifications pushed by scripts don't pause the game when they appear.
+    bool notification_freeze = true;
     enum class NotificationStatus {
         flash,
         flash_animate,
@@ -1330,6 +1364,7 @@ private:
     void display_text(Platform& pfrm, LocaleString ls);
 
     Microseconds timer_ = 0;
+    Microseconds ending_timer_ = 0;
     bool peer_ready_ = false;
     int matching_syncs_received_ = 0;
     bool ready_ = false;
@@ -1674,6 +1709,12 @@ void update_ui_metrics(Platform& pfrm,
 Vec2<s8> get_constrained_player_tile_coord(Game& game);
 
 
+// The minimap draws one overlay tile per map tile, which fits the gba-sized
+// maps on screen. Larger maps are scaled down to the same footprint.
+static constexpr const int minimap_width = std::min<int>(TileMap::width, 16);
+static constexpr const int minimap_height = std::min<int>(TileMap::height, 20);
+
+
 // Return true when done drawing the map. Needs lastcolumn variable to store
 // display progress. A couple different states share this code--the map system
 // state in the pause screen, and the simpler overworld minimap.
@@ -48,11 +48,11 @@ void TitleScreenState::enter(Platform& pfrm, Game& game, State& prev_state)
     pfrm.set_overlay_origin(0, 0);
     game.camera() = {};
 
-    pfrm.speaker().play_music("midsommar", 0);
+    pfrm.speaker().play_music("midsommar"_asset, 0);
     pfrm.speaker().stop_music();
 
-    pfrm.load_overlay_texture("overlay");
-    pfrm.load_tile1_texture("tilesheet_top");
+    pfrm.load_overlay_texture("overlay"_asset);
+    pfrm.load_tile1_texture("tilesheet_top"_asset);
 
     const Vec2<Float> arbitrary_offscreen_location{1000, 1000};
 
@@ -241,7 +241,7 @@ TitleScreenState::update(Platform& pfrm, Game& game, Microseconds delta)
         timer_ += delta;
         animate_selector();
         if (pfrm.keyboard().down_transition(game.action2_key())) {
-            pfrm.speaker().play_sound("select", 1);
+            pfrm.speaker().play_sound("select"_asset, 1);
             if (cursor_index_ == 0) {
                 if (game.persistent_data().clean_) {
                     break;
@@ -265,7 +265,7 @@ TitleScreenState::update(Platform& pfrm, Game& game, Microseconds delta)
                 animate_selector();
                 timer_ = 0;
                 display_mode_ = DisplayMode::image_animate_out;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
 
                 const bool bigfont = locale_requires_doublesize_font();
                 const auto st = calc_screen_tiles(pfrm);
@@ -283,7 +283,7 @@ TitleScreenState::update(Platform& pfrm, Game& game, Microseconds delta)
                 animate_selector();
                 timer_ = 0;
                 display_mode_ = DisplayMode::image_animate_out;
-                pfrm.speaker().play_sound("scroll", 1);
+                pfrm.speaker().play_sound("scroll"_asset, 1);
 
                 const bool bigfont = locale_requires_doublesize_font();
                 const auto st = calc_screen_tiles(pfrm);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "platform/platform.hpp"
+#include "sizeClassArena.hpp"
 #include <memory>
 #include <new>
 
@@ -21,15 +22,40 @@ align(size_t __align, size_t __size, void*& __ptr, size_t& __space) noexcept
 }
 
 
-// An abstraction for a single large allocation. Must fit within 1K of
-// memory. If your data is nowhere near 1k, and the data is long lived, might be
-// better to use a bulk allocator, and share the underlying scratch buffer with
-// other stuff.
+// An abstraction for a single dynamic allocation. Must fit within a scratch
+// buffer. Small objects share scratch buffers, see sizeClassArena.hpp. If your
+// data is long lived, and you're allocating a bunch of different objects, might
+// be better to use a bulk allocator, and share the underlying scratch buffer
+// with other stuff.
 template <typename T> struct DynamicMemory {
     static_assert(sizeof(T) + alignof(T) <= sizeof ScratchBuffer::data_);
+
+    // NOTE: The member order here matters. The object needs to be destroyed
+    // before the handle returns its memory to the arena, and the arena needs
+    // the scratch buffer until then.
     ScratchBufferPtr memory_;
+    SizeClassArena::Handle handle_;
     std::unique_ptr<T, void (*)(T*)> obj_;
 
+    DynamicMemory(const ScratchBufferPtr& memory,
+                  SizeClassArena::Handle handle,
+                  std::unique_ptr<T, void (*)(T*)> obj)
+        : memory_(memory), handle_(std::move(handle)), obj_(std::move(obj))
+    {
+    }
+
+    DynamicMemory(DynamicMemory&&) = default;
+
+    DynamicMemory& operator=(DynamicMemory&& other)
+    {
+        // Destroy our current object before letting go of its memory.
+        obj_.reset();
+        handle_ = std::move(other.handle_);
+        memory_ = other.memory_;
+        obj_ = std::move(other.obj_);
+        return *this;
+    }
+
     T& operator*() const
     {
         return *obj_.get();
@@ -47,11 +73,12 @@ template <typename T> struct DynamicMemory {
 };
 
 
+// The tag names the call site, for the arena's allocation telemetry, and should
+// be a string literal.
 template <typename T, typename... Args>
-DynamicMemory<T> allocate_dynamic(Platform& pfrm, Args&&... args)
+DynamicMemory<T>
+allocate_dynamic(Platform& pfrm, const char* tag, Args&&... args)
 {
-    auto sc_buf = pfrm.make_scratch_buffer();
-
     auto deleter = [](T* val) {
         if (val) {
             if constexpr (not std::is_trivial<T>()) {
@@ -63,18 +90,19 @@ DynamicMemory<T> allocate_dynamic(Platform& pfrm, Args&&... args)
         }
     };
 
-    void* alloc_ptr = sc_buf->data_;
-    std::size_t size = sizeof sc_buf->data_;
+    auto mem = size_class_arena.alloc(
+        pfrm, SizeClassArena::size_class(sizeof(T), alignof(T)), tag);
+
+    void* alloc_ptr = mem.mem_;
+    std::size_t size = mem.size_;
 
     if (align(alignof(T), sizeof(T), alloc_ptr, size)) {
         T* result = reinterpret_cast<T*>(alloc_ptr);
         new (result) T(std::forward<Args>(args)...);
-        alloc_ptr = (char*)alloc_ptr + sizeof(T);
-        size -= sizeof(T);
 
-        return {sc_buf, {result, deleter}};
+        return {mem.buffer_, std::move(mem.handle_), {result, deleter}};
     }
-    return {sc_buf, {nullptr, deleter}};
+    return {mem.buffer_, std::move(mem.handle_), {nullptr, deleter}};
 }
 
 
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "number/int.h"
+
+
+// Decoders for the compressed image data that build/compress_image.py writes
+// into the rom. Both formats are the ones that the gba bios understands:
+//
+// A four byte header holds the format in the low byte, and the decompressed
+// size in the upper three bytes.
+//
+// LZ77 (0x10): groups of eight items, each group preceded by a flag byte, with
+// one bit per item, starting from the high bit. A clear bit means a literal
+// byte. A set bit means two bytes, holding a length (three to eighteen, in the
+// high nibble) and a distance back into the output (one to 4096, in the
+// remaining twelve bits).
+//
+// RLE (0x30): a flag byte, then if the high bit is set, a single byte repeated
+// (flag & 0x7f) + 3 times, otherwise (flag & 0x7f) + 1 literal bytes.
+//
+// The decoder writes its output sixteen bits at a time, because the gba
+// ignores byte writes to vram, so images can decompress straight into video
+// memory, without a staging buffer.
+namespace compression {
+
+
+enum class Format : u8 { lz77 = 0x10, rle = 0x30 };
+
+
+inline Format format(const void* src)
+{
+    return static_cast<Format>(static_cast<const u8*>(src)[0]);
+}
+
+
+inline u32 decompressed_size(const void* src)
+{
+    auto p = static_cast<const u8*>(src);
+    return p[1] | (p[2] << 8) | (p[3] << 16);
+}
+
+
+// Collects output bytes into halfwords. We assume a little endian target, as
+// are the gba, psp, and any desktop that we build for.
+class HalfwordWriter {
+public:
+    HalfwordWriter(void* dest) : dest_(static_cast<u16*>(dest))
+    {
+    }
+
+    void put(u8 byte)
+    {
+        if (pos_ & 1) {
+            dest_[pos_ >> 1] = pending_ | (byte << 8);
+        } else {
+            pending_ = byte;
+        }
+        ++pos_;
+    }
+
+    void fill(u8 byte, u32 count)
+    {
+        if (count and (pos_ & 1)) {
+            put(byte);
+            --count;
+        }
+
+        const u16 pair = byte | (byte << 8);
+        for (; count > 1; count -= 2) {
+            dest_[pos_ >> 1] = pair;
+            pos_ += 2;
+        }
+
+        if (count) {
+            put(byte);
+        }
+    }
+
+    // Reads back a byte that we already wrote.
+    u8 get(u32 pos) const
+    {
+        if (pos == pos_ - 1 and (pos_ & 1)) {
+            return pending_;
+        }
+        return reinterpret_cast<const u8*>(dest_)[pos];
+    }
+
+    // Writes out the last byte of an odd length output, along with whatever
+    // the high byte of its halfword held before.
+    void finish()
+    {
+        if (pos_ & 1) {
+            auto& last = dest_[pos_ >> 1];
+            last = (last & 0xff00) | pending_;
+        }
+    }
+
+    u32 pos() const
+    {
+        return pos_;
+    }
+
+private:
+    u16* dest_;
+    u32 pos_ = 0;
+    u8 pending_ = 0;
+};
+
+
+inline void lz77_decompress(const u8* src, u32 size, HalfwordWriter& out)
+{
+    while (out.pos() < size) {
+        const u8 flags = *src++;
+
+        for (int bit = 0x80; bit and out.pos() < size; bit >>= 1) {
+            if (not(flags & bit)) {
+                out.put(*src++);
+                continue;
+            }
+
+            const u8 b0 = *src++;
+            const u8 b1 = *src++;
+
+            u32 length = (b0 >> 4) + 3;
+            const u32 disp = (((b0 & 0xf) << 8) | b1) + 1;
+
+            if (length > size - out.pos()) {
+                length = size - out.pos();
+            }
+
+            u32 from = out.pos() - disp;
+            while (length--) {
+                out.put(out.get(from++));
+            }
+        }
+    }
+}
+
+
+inline void rle_decompress(const u8* src, u32 size, HalfwordWriter& out)
+{
+    while (out.pos() < size) {
+        const u8 flag = *src++;
+
+        if (flag & 0x80) {
+            u32 length = (flag & 0x7f) + 3;
+            if (length > size - out.pos()) {
+                length = size - out.pos();
+            }
+            out.fill(*src++, length);
+        } else {
+            u32 length = (flag & 0x7f) + 1;
+            if (length > size - out.pos()) {
+                length = size - out.pos();
+            }
+            while (length--) {
+                out.put(*src++);
+            }
+        }
+    }
+}
+
+
+// Decompresses src into dest, which needs room for decompressed_size(src)
+// bytes, rounded up to a multiple of two. Returns false for an unknown format.
+inline bool decompress(const void* src, void* dest)
+{
+    const auto size = decompressed_size(src);
+    const auto data = static_cast<const u8*>(src) + 4;
+
+    HalfwordWriter out(dest);
+
+    switch (format(src)) {
+    case Format::lz77:
+        lz77_decompress(data, size, out);
+        break;
+
+    case Format::rle:
+        rle_decompress(data, size, out);
+        break;
+
+    default:
+        return false;
+    }
+
+    out.finish();
+
+    return true;
+}
+
+
+} // namespace compression
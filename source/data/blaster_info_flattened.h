@@ -6,8 +6,8 @@
 //	blaster_info_flattened, 3816x8@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 477 tiles not compressed
-//	Total size: 512 + 15264 = 15776
+//	+ 477 tiles lz77 compressed, 15264 bytes raw
+//	Total size: 512 + 2456 = 2968
 //
 //	Time-stamp: 2021-04-06, 09:05:25
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_BLASTER_INFO_FLATTENED_H
 #define GRIT_BLASTER_INFO_FLATTENED_H
 
-#define blaster_info_flattenedTilesLen 15264
-extern const unsigned int blaster_info_flattenedTiles[3816];
+#define blaster_info_flattenedTilesLen 2456
+extern const unsigned int blaster_info_flattenedTiles[614];
 
 #define blaster_info_flattenedPalLen 512
 extern const unsigned short blaster_info_flattenedPal[256];
@@ -6,8 +6,8 @@
 @	blaster_info_flattened, 3816x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 477 tiles not compressed
-@	Total size: 512 + 15264 = 15776
+@	+ 477 tiles lz77 compressed, 15264 bytes raw
+@	Total size: 512 + 2456 = 2968
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,545 +17,95 @@
 
 	.section .rodata
 	.align	2
-	.global blaster_info_flattenedTiles		@ 15264 unsigned chars
+	.global blaster_info_flattenedTiles		@ 2456 unsigned chars
 	.hidden blaster_info_flattenedTiles
 blaster_info_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333330,0x33333333,0x55555333,0x55555533,0x33335533,0x33335533,0x13335533,0x11335533
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333311,0x33333111
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x31333333,0x31133333
-	.word 0x03333333,0x33333333,0x33355555,0x33555555,0x33553333,0x33553333,0x33553331,0x33553311
-	.word 0x33335533,0x11335533,0x14335533,0x43335533,0x33335533,0x33335533,0x33335533,0x33335533
-	.word 0x33333333,0x33333111,0x33333411,0x33333344,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35353535,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35353535,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35353535,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35353535,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35353535,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35353535,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35353535,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35353535,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35353535,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35353535,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x35333333,0x35333333,0x35353535,0x35333333,0x35333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x53333333,0x53333333,0x53333333,0x53333333,0x53333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x53535353,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x53535353,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x53535353,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33335333,0x33335333,0x33335353,0x33335333,0x33335333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x31133333,0x31133333,0x31433333,0x44333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33553311,0x33553311,0x33553341,0x33553334,0x33553333,0x33553333,0x33553333,0x33553333
-	.word 0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x53333333,0x35333333,0x35333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333555,0x33555333,0x55333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333335
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x53333333,0x35533333,0x33553333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35555553,0x35333335,0x35333333,0x35333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33555553,0x33333333,0x33335333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35555533,0x33333333,0x33353333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x53333333,0x53333333,0x53333333,0x53333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333555,0x33533533,0x35553533,0x33533533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x33333335,0x33333335,0x33333335
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33335555,0x33335333,0x33335333,0x33335333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333
-	.word 0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x35333333,0x35333333,0x35333333,0x35333333,0x35333333,0x55333333,0x53333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333335,0x33333355
-	.word 0x33333353,0x33333533,0x33335333,0x33353333,0x33533333,0x35333333,0x55333333,0x55333333
-	.word 0x33333333,0x55553333,0x33353333,0x33353333,0x53353333,0x33353333,0x33355555,0x33355555
-	.word 0x33333333,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33355333,0x33335555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x35333333,0x35333333,0x35333333,0x35333333,0x55333333,0x35333333,0x35333333,0x35333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333355,0x33333353,0x33333353,0x33333353
-	.word 0x33335333,0x33333333,0x33335333,0x33333333,0x33335333,0x33333333,0x33335333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333
-
-	.word 0x53333333,0x53333333,0x53333333,0x53333333,0x55333333,0x53333333,0x53333333,0x53333333
-	.word 0x33333333,0x33333333,0x33333333,0x55555533,0x55555533,0x55555533,0x55555533,0x55555533
-	.word 0x33533533,0x55555533,0x33333333,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333
-	.word 0x33333335,0x33333335,0x33333333,0x55555555,0x55555555,0x55555555,0x55555333,0x55555333
-	.word 0x33335333,0x33335333,0x33335333,0x33335335,0x33355335,0x33335335,0x33335335,0x33335335
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333
-	.word 0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333553,0x33355333,0x33533333,0x35333333,0x53333333,0x33333333,0x33333333,0x33333333
-	.word 0x55333333,0x55333333,0x55333333,0x55333333,0x55333333,0x55333335,0x55333353,0x55333533
-	.word 0x33355555,0x33355555,0x33355555,0x33355555,0x33355555,0x33355555,0x33355555,0x33355555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x55553333,0x33335533,0x33333533,0x33333353,0x33333353,0x33333353
-	.word 0x35333333,0x35333333,0x35333333,0x35333355,0x35333353,0x35333533,0x35333533,0x35333533
-	.word 0x33333353,0x33333353,0x33333353,0x33333353,0x33333353,0x33333353,0x33333353,0x33333353
-
-	.word 0x33335333,0x33333333,0x33335333,0x33333333,0x33335333,0x33333333,0x33335333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333
-	.word 0x53333333,0x53333333,0x55333333,0x53533333,0x53533333,0x53533333,0x53533333,0x53533333
-	.word 0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55555533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555333,0x55555333,0x55555333,0x55555333,0x55555333,0x55555333,0x55555333,0x55555333
-
-	.word 0x33335335,0x33335335,0x33355335,0x33535335,0x33535335,0x33535335,0x33535335,0x33535335
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333
-	.word 0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55335333,0x55553333,0x55333333,0x53333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33355555,0x33555555,0x33555555,0x35555555,0x55555555,0x55555555,0x55555553,0x55555553
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333335,0x33333355,0x33333555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333353,0x33333533,0x33335533,0x55553333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x35333533,0x55333353,0x35333355,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333
-	.word 0x33333353,0x33333355,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33335333,0x33333333,0x33335333,0x33333333,0x33335333,0x33333333,0x33335333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333
-
-	.word 0x53533333,0x53533333,0x53533333,0x55333333,0x53333333,0x53333333,0x53333333,0x53333333
-	.word 0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55555533
-	.word 0x33333333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33535335,0x33535335,0x33535335,0x33355335,0x33335335,0x33335335,0x33335335,0x33335335
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333
-	.word 0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555533,0x55555533,0x55555333,0x55555333,0x55553333,0x55555333,0x33355333,0x33355533
-	.word 0x33335555,0x33355555,0x33555555,0x55555555,0x55555555,0x55555555,0x55555553,0x55553333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55553333,0x55533333,0x55533333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333355,0x33333353,0x33333353,0x33333353
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x35333333,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33335333,0x33333333,0x33335333,0x33333333,0x33335333,0x33333333,0x33335333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333
-	.word 0x53333333,0x53333333,0x53333333,0x53333333,0x53333333,0x53333333,0x53333333,0x53333333
-	.word 0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55333533,0x55333533,0x55333533
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x33355555,0x33355555,0x33355555
-
-	.word 0x33335335,0x33335335,0x33335335,0x33335335,0x33335335,0x33335335,0x33335335,0x33335335
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333
-	.word 0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x53333333,0x53333333,0x55333333,0x55333333
-	.word 0x33355533,0x33355553,0x33555555,0x35555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x53333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333335,0x33333355,0x55555555
-	.word 0x55555555,0x55555533,0x55333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-	.word 0x55555555,0x55555555,0x33335555,0x33333533,0x33333533,0x33333533,0x33333533,0x33333555
-	.word 0x55533333,0x55533333,0x55533333,0x55533333,0x55533333,0x55533333,0x55533333,0x55533333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333353,0x33333353,0x33333353,0x33333533,0x33335333,0x33553333,0x55533333,0x53333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-	.word 0x35333333,0x35333333,0x35333333,0x35333333,0x35335333,0x35333333,0x35333333,0x35555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33335333,0x33333333,0x33335333,0x33333333,0x33335333,0x33333333,0x33335333,0x33555553
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333
-
-	.word 0x53333333,0x53333333,0x53333333,0x53333333,0x55333333,0x53333333,0x53333333,0x53333333
-	.word 0x55333533,0x55333533,0x33333533,0x33333533,0x33333533,0x33333533,0x33333533,0x33333555
-	.word 0x55555555,0x55555555,0x55555555,0x35553335,0x35553335,0x35553353,0x35553353,0x55555553
-	.word 0x33355555,0x33355555,0x33333555,0x33333533,0x33333533,0x33333353,0x33333353,0x33333355
-	.word 0x33335335,0x33335335,0x33335335,0x33335335,0x33355335,0x33335335,0x33335335,0x33335555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333
-	.word 0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33335553,0x53355335
-	.word 0x55533333,0x55553333,0x55555333,0x55555533,0x55555553,0x55555553,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x33555555,0x33355555,0x33335555,0x33333555,0x33333355,0x33333335,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55533333,0x55333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x53333333
-	.word 0x55555553,0x55555553,0x55555553,0x55555553,0x55555553,0x55555553,0x55555555,0x55555553
-	.word 0x33333355,0x33333355,0x33333355,0x33333355,0x33333355,0x33333355,0x33333555,0x33335355
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333
-	.word 0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x53333333,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333
-
-	.word 0x55553333,0x55533333,0x55553333,0x55553333,0x55533333,0x55333333,0x53333333,0x33333333
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x35555555,0x33555555,0x33355555,0x33335555,0x33333555,0x33333355,0x33333335,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55333333,0x55333333,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333
-	.word 0x55555553,0x55555553,0x55555553,0x55555553,0x55555553,0x55555553,0x55555553,0x55555553
-	.word 0x33355355,0x33355355,0x33353355,0x33353355,0x33353355,0x33353355,0x33353355,0x33353355
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-
-	.word 0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553333,0x33553335
-	.word 0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x35333333,0x35333333,0x53333333,0x53333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333335,0x33333355,0x33333553,0x33335533
-	.word 0x55555553,0x55555553,0x55555533,0x55555333,0x55553333,0x55533333,0x55333333,0x55333333
-	.word 0x35555555,0x33555555,0x33355555,0x33335555,0x33333555,0x33333355,0x33333335,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333,0x33353333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x35333333,0x35333333,0x35333333,0x35333333,0x53333333,0x53333333,0x53333333,0x53333333
-	.word 0x55555553,0x55555553,0x55555553,0x55555553,0x55555553,0x55555553,0x55555553,0x55555535
-	.word 0x33353355,0x33353355,0x33353355,0x33353355,0x33335355,0x33335355,0x33335355,0x33335535
-
-	.word 0x55333333,0x55333333,0x55333333,0x55333333,0x35333333,0x35333333,0x35333333,0x35333333
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x55353355,0x33333333,0x53353553
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x35335553,0x33333333,0x33353555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333335,0x33333333,0x33333333
-	.word 0x33553335,0x33553335,0x33553335,0x33553335,0x33553335,0x33553335,0x33553335,0x33553335
-	.word 0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x33335533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33355333,0x33533333,0x55333333,0x53333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x53333333,0x53333333,0x35333333,0x35533335,0x33555553,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33353333,0x33333333,0x33353333,0x33333333,0x35555533,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333335,0x33333355,0x33333353,0x33333553,0x55555533,0x33333333,0x33333333,0x33333333
-	.word 0x33333533,0x33333553,0x33333353,0x33333355,0x33333335,0x33333333,0x33333333,0x33333333
-	.word 0x35333333,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333,0x35333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x35553555,0x35353535,0x35353555,0x35553535,0x33333333
-
-	.word 0x33553335,0x33553335,0x33553335,0x33553335,0x33553335,0x33553335,0x33553335,0x33553335
-	.word 0x33335533,0x33335533,0x33335533,0x33335533,0x33335533,0x55555533,0x55555533,0x55555533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-
-	.word 0x55333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33553335,0x33553333,0x33553333,0x33553333,0x33553333,0x33555555,0x33555555,0x33555555
-	.word 0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55555533
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55333555,0x55335555,0x55335555,0x53535555,0x53535555,0x53535555,0x35535555
-	.word 0x55555555,0x55555335,0x55555335,0x55555353,0x55555353,0x55555353,0x55555353,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55553335,0x35553553,0x55553555,0x55553335
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55553335,0x55553553,0x55553553,0x55553553
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55535535,0x55535535,0x55535535,0x55535535
-	.word 0x55555555,0x55533555,0x55535355,0x55555355,0x55553355,0x35555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555333,0x35555355,0x35555355,0x35555333
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x35555333,0x55553553,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555553,0x53555333,0x53555553,0x53555553,0x53555553
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x35555535,0x33555535,0x35555535,0x35555535
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33555533,0x53355535,0x33355555,0x55355555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33555553,0x53355535,0x55355533,0x55355555
-	.word 0x55555555,0x55555535,0x55555535,0x55555535,0x55555533,0x55555535,0x55555535,0x55555535
-	.word 0x55555555,0x55535555,0x55555555,0x55555555,0x55535555,0x55533555,0x55535555,0x55535555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55333555,0x55355335,0x55355355,0x55355355
-	.word 0x55555555,0x35555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55553333,0x55535553,0x55535553,0x55553553,0x55553333,0x55535553,0x55535553
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55533355,0x55355535,0x55355535,0x55355535
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55533355,0x55555355,0x55555355,0x55333555
-	.word 0x55555555,0x55555555,0x55555555,0x55555355,0x55533335,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55553335,0x55535553,0x55535553,0x55535553
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55533355,0x55535533,0x55535535,0x55535535
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x33555555,0x33555555,0x33555555,0x33555555,0x33555555,0x33555555,0x33555555,0x33555555
-	.word 0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55555533,0x55555333
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x35535555,0x35335555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555355,0x55553355,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55553553,0x35533333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55553553,0x55533353,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55535535,0x55333335,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x35555355,0x35553355,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x35555355,0x55553333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555553,0x55555333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x53555553,0x33555333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x35555535,0x33555333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x35555555
-	.word 0x53355555,0x33555553,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x33333333
-	.word 0x55355555,0x33555533,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x33333333
-
-	.word 0x55555535,0x55555333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555553
-	.word 0x55535555,0x55333555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55355355,0x53335335,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x35555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55535553,0x55553333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55355535,0x55533355,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55355555,0x55533355,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555355,0x55533355,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55535553,0x55553335,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55535535,0x55333533,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33555555,0x33555555,0x33555555,0x33555555,0x33555555,0x33555555,0x33555555,0x33355555
-	.word 0x33333333,0x33333333,0x33333333,0x13333333,0x11333333,0x11333333,0x11333333,0x14333333
-	.word 0x55533333,0x55333333,0x53333333,0x53333313,0x53333113,0x53333113,0x53333113,0x53333413
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x35555555,0x35555555,0x35555555,0x35555555,0x35555555,0x35555555,0x35555555,0x35555555
-	.word 0x22223333,0x55553333,0x22223333,0x55553333,0x22222222,0x55555555,0x22222222,0x55555555
-	.word 0x22222222,0x55555555,0x22222222,0x55555555,0x22222222,0x55555555,0x22222222,0x55555555
-	.word 0x55555553,0x55555553,0x55555553,0x55555553,0x55555553,0x55555553,0x55555553,0x55555553
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333555,0x33333355,0x33333335,0x11333335,0x11133335,0x33333335,0x11133335,0x11433335
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333331,0x33333311,0x33333333,0x33333311,0x33333341
-	.word 0x43333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333334,0x44444444,0x44444440
-	.word 0x53333344,0x53333333,0x53333333,0x33333333,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x35555555,0x35555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x22222222,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x22222222,0x33333333,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-
-	.word 0x55555553,0x55555553,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x44333335,0x33333335,0x33333335,0x33333333,0x33333333,0x33333333,0x44444444,0x44444444
-	.word 0x33333334,0x33333333,0x33333333,0x33333333,0x33333333,0x43333333,0x44444444,0x04444444
+	.word 0x003BA010,0xF0000031,0x30019001,0x01303333,0x55555307,0x03105533,0x03300B00,0x0300135F
+	.word 0x001E5011,0x5001201A,0x3F18100F,0x0D503111,0x01D01FF0,0x1FF01FF0,0xF0FF1FF0,0xF019F01F
+	.word 0xF001F01F,0xF01FF01F,0xFF1FF01F,0x1FF01FF0,0x1FF001F0,0x1FF001F0,0x1FF01FF0,0xF01FF0FF
+	.word 0xF01FF019,0xF01FF001,0xF01FF01F,0x1FF0FF1F,0x01F01FF0,0x01F01FF0,0x1FF01FF0,0xF0FF1FF0
+	.word 0xF019F01F,0xF001F01F,0xE01FF01F,0x561D031F,0x03211313,0x23351F30,0x315C535E,0x005C23F5
+	.word 0x100E300B,0x0300140A,0xE07F8343,0x01000330,0x34116713,0xD8443333,0x019076F0,0xF003F035
+	.word 0x35353501,0xF017F0FF,0xF001F01F,0xF001F01F,0xF01FF01F,0x1FF0FF1F,0x1FF016F0,0x1FF001F0
+	.word 0x1FF001F0,0xF0FF1FF0,0x401A401F,0xF05FF11E,0xF001F001,0xFD01F001,0x01F001F0,0x01F001F0
+
+	.word 0x011001F0,0x8F03F053,0x535301F0,0xF017F053,0xF001F01F,0x7DF0FF1F,0x1D200300,0x01F07DF0
+	.word 0x01F001F0,0x13DE0120,0x43031063,0x22E36B13,0x03105813,0x0300BF41,0x635CE334,0x8303F07F
+	.word 0xF001F07F,0x01C0FB01,0x23F2DD10,0x11105210,0xF0582053,0x01C0FF5D,0x01F060F2,0x01F001F0
+	.word 0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xE001F001,0xFF291201,0x22F1FE00,0x8013A608
+	.word 0x01F083F3,0x3F3001F0,0xF06160FF,0xF001F001,0xA001F001,0x20E81501,0x9AF0FF08,0x03C08250
+	.word 0x63F63EC0,0xF5201FA0,0x357F3600,0x07100900,0x22303FF0,0x1F4081F0,0xF0FF7DF0,0xF001F001
+	.word 0xF001F001,0xF0712001,0xFF7FF303,0x7FF303F0,0x013001F0,0x3930F7F6,0x34C0DDF0,0x232460FF
+	.word 0x8008E093,0x60351181,0x477C115E,0x6131FFCF,0x01C1B3F1,0x1FF01FF0,0x1FF016F0,0xF0FF01F0
+
+	.word 0xF001F01F,0x0301901F,0xA01DF066,0xFF5BF101,0x6B707FF3,0x03805210,0x07F08561,0x01F069F0
+	.word 0xF001F0FF,0xA007F09E,0xF36FE307,0x11015001,0x03D0FF27,0x3F41EE11,0x4F91E359,0x1FA00491
+	.word 0x20FF6814,0x22697003,0x306F0139,0xF0033007,0xFF01F001,0x01F001F0,0xD46001F0,0x7FF303F0
+	.word 0x7FF303F0,0xF001F0FF,0x1501E001,0x100440C5,0xF008600E,0x0370FFA0,0x7511F815,0x67436623
+	.word 0x7F7303F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0xD2007B4F
+	.word 0x6B639CC2,0x7C248414,0xF90180FF,0x207FF3D4,0xF007F001,0xF001F082,0x01E0FF01,0x07B077F3
+	.word 0xFD197793,0x73F303C0,0xF0FD03B0,0x6301B070,0x2803F067,0x5377A32C,0xF0FF03E0,0xF001F050
+	.word 0xF001F001,0xF3015001,0xFF7FF354,0x7FF303F0,0x01F001F0,0x01F001F0,0x810101C0,0xF71548FB
+
+	.word 0x4E141033,0x350340B7,0x5A01DF54,0xF00320FF,0xF33C8750,0xF001F09E,0xF001F001,0x01F0FF01
+	.word 0x01F001F0,0xEDB701F0,0x6D2309F7,0xF7FF0126,0xF10C5807,0xF060E0A6,0xF069F107,0xFF01F001
+	.word 0x6FF301F0,0x6F9307D0,0x7FF3FBE6,0xD7A67FF3,0x1301D0FF,0x7001F063,0xB66FB301,0xF0FFF6FB
+	.word 0x01F0FF01,0x01F001F0,0x54F30190,0x03F07FF3,0xF0FF7FF3,0xF001F001,0xF001F001,0x8001F001
+	.word 0xFF875101,0x8A12D354,0x25170B20,0xA383BB39,0x9B330160,0xE1CFF2FF,0xF01FF0BF,0x301FC01F
+	.word 0x3EC41E57,0x1FF0FFC8,0x1F6001F0,0x7CF90300,0x018001F0,0xFAFF77F3,0x5001F07F,0xB077F301
+	.word 0xF001F007,0xFF01F001,0x07F09EC0,0x03F0FFF6,0x73F30320,0x0350F728,0xF051F3FF,0x7901F001
+	.word 0xF36FD31F,0xF001F07F,0x01F0FF01,0x01F001F0,0x54F30130,0x03F07FF3,0xF0FF7FF3,0xF001F001
+
+	.word 0xF001F001,0x9C01C001,0x7F8F0127,0x63E50235,0x83FF665F,0x6645E11F,0xFF2350FF,0x2BF32730
+	.word 0xD9C249D0,0x67533F37,0x7FF303F0,0xA301F0FF,0x207D6B6B,0xF0BBF0B6,0x0595F09F,0x0B50FFC6
+	.word 0x36F06822,0x07F080F0,0xCE240720,0xF0FF01F0,0x8001F001,0xB077F301,0xA0FFFD07,0xEF6B730F
+	.word 0x03107FF1,0x103555B3,0x30B40303,0xFF6B9303,0x68903780,0x937373F3,0x01F0FEF0,0x01F001F0
+	.word 0x9001F0FF,0xF354F301,0xF303F07F,0xF001F07F,0x01F0FF01,0x013001F0,0x0B017D12,0xD3660522
+	.word 0x5AFF4D01,0xF001F057,0xF001F001,0x47827301,0xFFD3112B,0xB8F27F00,0xA97001F0,0x01F009F1
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x77F301B0
+	.word 0x01F007B0,0xF0DF01F0,0x53014001,0x03D00F52,0x07200110,0xF0FF2400,0xF4E74103,0xF001F0DD
+
+	.word 0xF001F001,0xFF01F001,0x014001F0,0x7FF39DF0,0x7FF303F0,0x014001F0,0xF4E510FF,0x46C574BD
+	.word 0x7DB79927,0xF02AF3EB,0x01F0FF01,0x071601A0,0xA7F05FF3,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xC077F3FF
+	.word 0xC001F007,0xF20F5201,0xF3A2153B,0x87B3FF7B,0x0320CF06,0x54A7B49A,0x7BC001F0,0x50FF01F0
+	.word 0xF0DE331C,0xF01FF001,0xF31F6001,0xFF035054,0x16F0A110,0x01F003C0,0x2B5101D0,0x01F0D2FC
+	.word 0x1D1B6AFF,0x510810BE,0xB3E36D47,0xF35FF3A3,0x01F0FF5F,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x012001F0
+	.word 0x07B077F3,0xF001F0FF,0xAA03A040,0x7073F3AF,0xD38C2C03,0x571ADF73,0x32350340,0xA0D1D2BF
+
+	.word 0x2028E96F,0x39309F24,0xE24A3553,0x9D021FC0,0x0D2BDC20,0xA01FF0FF,0xB011F4F9,0xC073F303
+	.word 0xF001F003,0x01F0FF01,0x68230170,0x20F0F47C,0xCD006B61,0xF4FF900A,0xF001F052,0xF001F001
+	.word 0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x6FD3FF01,0x01F093FE,0x01F001F0,0x306E5580,0xC2FF0C20,0x4DEF1D20
+	.word 0x6097F5F3,0x7003F042,0xFF01F003,0x01F001F0,0x8F0301F0,0x01009103,0x7C300550,0xF373F3FF
+	.word 0x4603D07F,0x305FF78F,0xF0EFC367,0x1FF0FF1F,0x1FF01FF0,0x1FF01FF0,0x01F01FF0,0xF0FF1FF0
+	.word 0xF01FF01F,0xF01FF01F,0xF01DF01F,0xFF1FF01F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0x1FF001F0
+	.word 0xF01FF0FF,0xF01FF01F,0xF01FF01F,0xF01FF01D,0x1FF0FF1F,0x1FF01FF0,0x1E6E1FF0,0x43F01FF0
+
+	.word 0xF0FF1FF0,0xF01FF01F,0x231FA01F,0x1003C063,0xFF035032,0x03F00CA0,0x01F001F0,0x01D001F0
+	.word 0x0350A627,0x605218FF,0x16FF2703,0xA00310F4,0xC0689F19,0x3500FF4A,0x56300110,0x55201FF0
+	.word 0x1FE00350,0x90FF5400,0x50143003,0x40A25074,0x2B7FF01A,0xFD3E5023,0xBFF80B00,0x77F01300
+	.word 0x5E200130,0xFFE6B053,0x3D059FF0,0x07305519,0x1B205FF0,0x6A163121,0x4063F0FF,0x508C151F
+	.word 0x4B09501F,0x700FA0C8,0x0B80FF99,0xA0D075AD,0x60F15900,0xB39088F0,0x50FF9311,0x80DC1001
+	.word 0x112CF00F,0xF0017054,0xFF35411F,0x00C2802A,0x1F801521,0x1F325EF0,0x5FF00180,0xD25D0AFF
+	.word 0xF001F01F,0x6001F001,0xF303F051,0x03F0FF7F,0x01F06B42,0x01F001F0,0x71210180,0x60FE48F1
+	.word 0xF06C401E,0x083D7001,0x7019F061,0xF0FF531F,0x330160A8,0x8060F028,0xF1EC0B7F,0xFF1F90E8
+
+	.word 0x1E903EF0,0x1FC027F1,0x41F09E10,0x32229F60,0x701FF0FF,0xF0A7131E,0x2577101F,0xF0BE106B
+	.word 0x1F50FF1F,0x9FF07323,0xB442BB60,0x24601CF0,0xF0FFCD23,0xF0A7E041,0x1F5D3001,0x7017F0CB
+	.word 0xFFE01138,0x5AA05EF0,0x60901FF0,0x7FC01FF0,0x5D90DEF0,0xF0CD2DFF,0xF001F018,0xF001F001
+	.word 0x8056F301,0xFEEAAB03,0x11030013,0x2E140380,0x8B824B6D,0x13531C00,0x34038031,0x01F0F8F0
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xA6C301F0,0x3303E08E,0x12222233,0x0F0750BF,0x22222222,0x07F03410,0x071007F0,0xF00A96FF
+	.word 0xF08CF003,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FE01F0
+	.word 0xF001F001,0x1501E001,0x30E7149D,0x351D1103,0x03001333,0x07100B10,0xBA431343,0x43310160
+
+	.word 0x10011054,0x0A304107,0x84D3A043,0x44030034,0x40444444,0x4E0410FF,0x600340FA,0x101A1001
+	.word 0xF08ED001,0x1FF0FF1F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0xF0FF1FF0,0xF01FF01F,0xF01FF01F
+	.word 0xF01FF01F,0xFE1FF01F,0x1FD00ABA,0x0F104713,0x1FF01FF0,0x7F441FF0,0xF067D344,0xF09FF07F
+	.word 0xF01FF01F,0xFF1FF01F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0xF01FF0FF,0xF01FF01F
+	.word 0x031F901F,0x2303106B,0x0190F27F,0x4B131F50,0x433301F0,0x00041E40
 
 	.section .rodata
 	.align	2
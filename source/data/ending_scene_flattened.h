@@ -6,8 +6,8 @@
 //	ending_scene_flattened, 3368x8@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 421 tiles not compressed
-//	Total size: 512 + 13472 = 13984
+//	+ 421 tiles rle compressed, 13472 bytes raw
+//	Total size: 512 + 2160 = 2672
 //
 //	Time-stamp: 2021-04-06, 09:05:25
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_ENDING_SCENE_FLATTENED_H
 #define GRIT_ENDING_SCENE_FLATTENED_H
 
-#define ending_scene_flattenedTilesLen 13472
-extern const unsigned int ending_scene_flattenedTiles[3368];
+#define ending_scene_flattenedTilesLen 2160
+extern const unsigned int ending_scene_flattenedTiles[540];
 
 #define ending_scene_flattenedPalLen 512
 extern const unsigned short ending_scene_flattenedPal[256];
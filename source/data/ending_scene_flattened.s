@@ -6,8 +6,8 @@
 @	ending_scene_flattened, 3368x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 421 tiles not compressed
-@	Total size: 512 + 13472 = 13984
+@	+ 421 tiles rle compressed, 13472 bytes raw
+@	Total size: 512 + 2160 = 2672
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,482 +17,85 @@
 
 	.section .rodata
 	.align	2
-	.global ending_scene_flattenedTiles		@ 13472 unsigned chars
+	.global ending_scene_flattenedTiles		@ 2160 unsigned chars
 	.hidden ending_scene_flattenedTiles
 ending_scene_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0xBB444444,0xBBB44444,0xBBB44444,0xBBBB4444,0xBBBB4444,0xBBBB4444
-	.word 0xBBBBBB44,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x444444BB,0x4444BBBB,0x44BBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0xBB888B44
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444BBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x55544444,0x55554444,0x55555444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444555,0x44445555,0x44455555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0xBBBB4444,0xBBBBB444,0xBBBBB444,0xBBBBB444,0xBBBBB444,0xBBBBB444,0xBBBBB444,0xBBBBB444
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBB444444,0x8BB44444,0x88844444,0x8B8B4444,0x8B88B444,0x88888444,0x88888B44,0x88888B44
-	.word 0x88888888,0xB8888888,0xBBB88888,0xBBBBB88B,0xBBBBBB88,0xBBBBBBB8,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x444BBBBB,0x44BBBBBB,0x4BBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0xBB44444B,0xBBB4444B,0xBBBB444B,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x88844444,0xBB888844,0xBBBBB888,0xBBBBBBB8,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x4444444B,0x44444BBB,0x44444BBB,0x444BBBBB,0x44BBBBBB,0x4BBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x55555544,0x55555544,0x55555544,0x55555544,0x55555544,0x55555544,0x55555444,0x55554444
-	.word 0x44555555,0x44555555,0x44555555,0x44555555,0x44555555,0x44555555,0x44455555,0x44445555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0xBBB44444,0xBBBB4444,0xBBBBB444,0xBBBBBB44,0xBBBBBB44,0xBBBBBBB4,0xBBBBBBB4,0xBBBBBBB4
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xB8888BBB,0xB88B88BB,0xB88B8888,0xB88BBBB8,0xB88BBBBB,0xBBB88BBB,0xBBBB8BBB,0xBBBBB8BB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x4BBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x4444444B,0x444444BB,0x4444444B,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x55544444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444555,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0xB4444444,0xBB444444,0xBBB44444,0xBBB44444,0xBBB44444,0xBBBB4444,0xBBBBB444
-	.word 0x44444444,0x4444BBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBB4,0xBBBBBBB4,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBABBB,0xBBBBABBB,0xBBBBABBB
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4444444B,0x44444BBB,0x44BBBBBB
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4BBB4444,0xBBBBBB44
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4444444B
-	.word 0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBB444
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBABBB,0xBBBAAABB,0xBBAAAABB,0xBBAAAAAB,0xBBAAAAAB,0xBBAAAAAB,0xBBBAAAAB,0xBBBAAAAB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x4444BBBB,0x444BBBBB,0x444BBBBB,0x444BBBBB,0x444BBBBB,0xBB4BBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x444BBB44,0x4BBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4444444B
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0xB4444444,0xBB444444,0xBBB44444,0xBBB44444,0xBBB44444,0xBBB44444,0xBBBBBBB4
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBB4444,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xABBBBBBB,0xAABBBBBB,0xAABBBBBB
-	.word 0xBBBAAAAB,0xBBAAAAAB,0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444BBB,0xBBBBBBBB,0x44444BBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0xB4444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0xAABBBBBB,0xAABBBBBB,0xAABBBBBB,0xAA444444,0xAA999999,0xAA999999,0xAA999999,0xAAA99999
-	.word 0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA,0x44AAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x66669999,0x66669999,0x66666999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999966,0x99996666,0x96666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAA99999,0xAAA99999,0xAAAAA999,0xAAAAA999,0xAAAAA999,0xAAAAA999,0xAAAAA999,0xAAAAA999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0x9AAAAAAA,0x9AAAAAAA,0x99AAAAAA,0x99AAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99A99999,0x99A79999,0x99A79999,0x9A779999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x66666999,0x66666999,0x66666999,0x66669999,0x62899999,0x22229999,0x22222299,0x22222229
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x99999966,0x99999992,0x99999222,0x99992222
-	.word 0x99966666,0x99666666,0x99999966,0x99999996,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAA999,0xAAAAAA99,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAA99,0xAAAAAA99,0xAAAAAAA9
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x9999999A,0x9999999A,0x9999999A,0x9999999A,0x9999999A,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x9A779999,0x9AA79999,0x9AA79999,0x9AA79999,0x9AA77999,0x9AA77999,0x9A777799,0x9A777779
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x11199999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99991111
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x29999999,0x29999999,0x22299999,0x22229999
-
-	.word 0x22222229,0x22222229,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x99922222,0x99922222,0x99922222,0x99922222,0x99922222,0x99222222,0x99222222,0x99222222
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xA9999999,0xAA999999,0xAA999999,0xAAA99999,0xAAA99999,0xAAAA9999,0xAAAA9999,0xAAAAA999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0x9AAAAAAA,0x99AAAAAA,0x99AAAAAA,0x9AAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0xA9999999,0x79999999,0x79999999,0xA9999999,0xA9999999,0x99999999,0x99999999
-	.word 0x9A777777,0x9A777777,0x9AA77777,0xAAAA7777,0xAAAA7777,0xAAAAA777,0xAAAAA777,0xAAAAA777
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x9999999A,0x9999999A,0x999999AA,0x999999AA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x19999999,0x11999999,0x11999999
-	.word 0x99999999,0x99999999,0x11999999,0x11119999,0x11111119,0x11111111,0x11111111,0x11111111
-	.word 0x11119999,0x11111119,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22211111,0x21111111,0x21111111,0x21111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222221,0x22222231,0x22223331
-	.word 0x99222222,0x99222222,0x92222222,0x92222222,0x92222222,0x12222222,0x33222222,0x33322222
-
-	.word 0xC9999999,0xC9222299,0xC2222299,0xC2222229,0xC2222229,0x92222229,0x92222221,0x91222233
-	.word 0x9999999C,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAA999,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x9999999A,0x9999999A,0x999999AA,0x999999AA,0x99999AAA,0x99999AAA,0x9999999A,0x9999999A
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x7A999999,0x77A99999,0x777A9999,0x777A9999
-	.word 0xAAAAAA77,0xAAAAAA77,0xAAA7AA77,0xAAAA7A77,0xAAAA7777,0xAAAA7777,0xAAAA7777,0xAAAAAA77
-	.word 0x999999AA,0x9999999A,0x9999999A,0x9999999A,0x9999999A,0x999999AA,0x999999AA,0x999999AA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x11119999,0x11119999,0x11111999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x11999999,0x11111111,0x11111111,0x11111111
-	.word 0x11999999,0x11199999,0x11111199,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x23333311,0x33333111,0x33331111,0x33111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333111,0x33331111,0x33111111
-	.word 0x33333333,0x33333333,0x13333333,0x11113333,0x13333333,0x33333333,0x11333333,0x11111133
-	.word 0x99999111,0x99991111,0x99111111,0x91111111,0x11111111,0x11111113,0x11111111,0x11111111
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999991,0x99999111,0x99991111
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAAA99,0xAAAAA999,0xAAAAA999,0xAAAA9999,0xAAAA9999,0xAAAA9999,0xAAAAAA99,0xAAAAAAA9
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0x9AAAAAAA,0x9AAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x999999AA,0x99999AAA,0x99999AAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x777AA999,0x77AAA999,0x77AAA999,0x77AAA999,0x7AAAA999,0xAAAA9999,0xAAAA9999,0xAAAA9999
-	.word 0xAAAAAAA7,0xAAAAAAA7,0xAAAAAAA7,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x999999AA,0x999999AA,0x9999AAAA,0x999AAAAA,0x999AAAAA,0x999AAAAA,0x999AAAAA,0x9999AAAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x11999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x19999999,0x11111999,0x11111111,0x11111111
-	.word 0x99999999,0x99999999,0x11999999,0x11111999,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111999,0x11111199,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x99111111,0x91111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x99999999,0x99999999,0x99999991,0x99991111,0x99111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999991,0x99999111,0x99111111
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0xA9999999
-	.word 0xAAAAAAA9,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAA999,0xAAAAAA99,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x99999AAA,0x99999AAA,0x99999AAA,0x99999AAA,0x99999AAA,0x999999AA,0x9999999A,0x9999999A
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0xAAAA9999,0xAAAAAA99,0xAAAAAA99,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x9999AAAA,0x999AAAAA,0x99AAAAAA,0x99AAAAAA,0x99AAAAAA,0x99AAAAAA,0x99AAAAAA,0x999AAAAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x19999999,0x11199999,0x11119999,0x11111199
-	.word 0x11199999,0x11119999,0x11119999,0x11111119,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x91111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x99999999,0x99991111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0xA9999999,0xA9999999,0xA9999999,0xA9991111,0xA1111111,0xA1111111,0xA1111111,0xA1111111
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x99999999,0x99999999,0x9999999A,0x99999AAA,0x99999AAA,0x9999AAAA,0x9999AAAA,0x9999AAAA
+	.word 0x0034A030,0x44FF009D,0x44D944FF,0x00FF00FF,0x44FF00F9,0xBB154486,0xBBB44444,0xBBB44444
+	.word 0xBBBB4444,0xBBBB4444,0xBBBB4444,0x80BB9D44,0xBBBB0344,0xBB804444,0xBB914400,0x8B0244BA
+	.word 0x4499BB88,0xFF4BBB01,0x9144FF44,0x55540944,0x55554444,0x55555444,0x550A4491,0x55444445
+	.word 0x55444455,0x44FF4555,0x44FF44FF,0xBB1B44BA,0xBBB444BB,0xBBB444BB,0xBBB444BB,0xBBB444BB
+	.word 0xBBB444BB,0xBBB444BB,0xBFB444BB,0x1A4480BB,0xB44444BB,0x8444448B,0x8B444488,0x88B4448B
+	.word 0x8884448B,0x888B4488,0x868B4488,0x88B80988,0x8BBBB888,0x88BBBBB8,0xB800BB80,0x4B01BB8A
+	.word 0x00BB8044,0x00BB8044,0x8DBB914B,0x444B0944,0x444BBB44,0x444BBBB4,0x4487BB83,0x4488840A
+	.word 0x88BB8888,0xB8BBBBB8,0x4485BB88,0x44804B00,0x444BBB0B,0x444BBB44,0x4BBBBB44,0x00BB8044
+
+	.word 0x00BB8044,0x9C44FF4B,0x00558044,0x00558044,0x00558044,0x00558044,0x00558044,0x05558044
+	.word 0x55555444,0x55824444,0x55804400,0x55804400,0x55804400,0x55804400,0x55804400,0x55554406
+	.word 0x55554445,0x44FF44FF,0x449B44FF,0x44BBB40A,0x44BBBB44,0x44BBBBB4,0x4400BB80,0xB400BB80
+	.word 0xB400BB80,0xB400BB80,0x8B18BBE1,0x88BBB888,0x8888B88B,0xBBB8B88B,0xBBBBB88B,0x8BBBB88B
+	.word 0x8BBBBBB8,0xB800BB80,0xBB80BBFF,0xBB994B00,0x4B004489,0xBB004480,0x4B004480,0x448844FF
+	.word 0x99555401,0x45550144,0x44FF44FF,0xB40044FE,0xBB144480,0xBBB44444,0xBBB44444,0xBBB44444
+	.word 0xBBBB4444,0xBBBBB444,0xBB034481,0x954444BB,0x80B400BB,0xCDB400BB,0x80AB00BB,0x80AB00BB
+	.word 0xFFAB00BB,0x91BBDDBB,0x804B0044,0x4BBB0344,0xBB804444,0x44FF44FF,0x44F244FF,0x444BBB02
+
+	.word 0x4499BB80,0x44814B00,0x4400BB80,0x4400BB80,0x4400BB80,0x4400BB80,0x4400BB80,0x4400BB80
+	.word 0x4401BB80,0x00BBE0B4,0x19BB80AB,0xBBBBBAAA,0xABBBAAAA,0xABBBAAAA,0xABBBAAAA,0xABBBAAAA
+	.word 0xABBBBAAA,0xBBFFBAAA,0x4414BBFE,0x4BBBBB44,0x4BBBBB44,0x4BBBBB44,0x4BBBBB44,0x4BBBBB44
+	.word 0x448EBB86,0x444BBB02,0x4B00BB80,0x4499BB85,0x44FF4B00,0x44E344FF,0x4480B400,0x4444BB11
+	.word 0x4444BBB4,0x4444BBB4,0x4444BBB4,0xC0B4BBB4,0x444401BB,0xAB00BBF2,0xAA00BB80,0xAA08BB80
+	.word 0xBBBAAAAB,0xBBAAAAAB,0xBB00AA80,0xBB00AA80,0xBB00AA80,0xBB00AA80,0xBB00AA80,0xBBAAAA80
+	.word 0x998D4481,0x4481BB89,0xBB89998D,0x998D4481,0x4481BB89,0xBB89998D,0x998D4481,0x4481BB89
+	.word 0xBB89998D,0x998D4481,0x4481BB89,0xBB89998D,0x998D4481,0x444BBB03,0x00BB8244,0x8D44834B
+
+	.word 0x8D448D99,0x8D448D99,0x8D448D99,0x8D448D99,0x8D448D99,0x8D448D99,0x8D448D99,0x8D448D99
+	.word 0x8D448D99,0x8D448D99,0x00448899,0x8D4481B4,0x81BB8999,0x89998D44,0x8D4481BB,0x81BB8999
+	.word 0x89998D44,0x8D4481BB,0x81BB8999,0x89998D44,0x8D4481BB,0x00BB8099,0x00BB80AA,0x00BB80AA
+	.word 0x004480AA,0x009980AA,0x009980AA,0x039980AA,0xA99999AA,0xBB00AA81,0xBB00AA80,0xBB00AA80
+	.word 0x4400AA80,0xBB89AA8D,0x99FF4481,0x99FF99FF,0x99BB99FF,0x99666609,0x99666699,0x91666669
+	.word 0x80660099,0x66660399,0x66809999,0x99FF9600,0xA91B99FD,0xA99999AA,0xAAA999AA,0xAAA999AA
+	.word 0xAAA999AA,0xAAA999AA,0xAAA999AA,0x8AA999AA,0x809A00AA,0x809A00AA,0x809900AA,0x859900AA
+	.word 0x0099EFAA,0x009980A9,0x009980A7,0x019980A7,0x99FF9A77,0x99FF99FF,0x691799B8,0x69996666
+
+	.word 0x69996666,0x99996666,0x99996666,0x99996289,0x80992222,0x80290022,0x80668E22,0x80920099
+	.word 0x92220B99,0x22229999,0x66669999,0x66809996,0x80669901,0xFF960099,0x0399EF99,0x99AAAAA9
+	.word 0xA900AA80,0xA900AA80,0xA900AA80,0x9900AA80,0x9900AA80,0xA900AA80,0x9A00AAA0,0x9A009980
+	.word 0x9A009980,0x9A009980,0x9A009980,0x771D99CE,0xA799999A,0xA799999A,0xA799999A,0xA779999A
+	.word 0xA779999A,0x7777999A,0x7777799A,0xFF99FF9A,0x0199F799,0x99991119,0x92111101,0x80290099
+	.word 0x99290999,0x99222999,0x29222299,0x29002280,0x9211229A,0x92222299,0x92222299,0x92222299
+	.word 0x92222299,0x00228099,0x00228099,0xFF228099,0x0099DF99,0x009980A9,0x129980AA,0xA99999AA
+	.word 0xA99999AA,0xAA9999AA,0xAA9999AA,0xA6A999AA,0x809A00AA,0x809900AA,0x809900AA,0x899A00AA
+
+	.word 0x0099C4AA,0x009980A9,0x00998079,0x00998079,0x009980A9,0x809985A9,0x809A0077,0x779A1877
+	.word 0x779AA777,0x77AAAA77,0x77AAAA77,0x77AAAAA7,0x77AAAAA7,0x8DAAAAA7,0x809A0099,0x809A0099
+	.word 0x80AA0099,0xFFAA0099,0x9399FF99,0x80190099,0x80110099,0x88110099,0x99110599,0x19111199
+	.word 0x9904118C,0x19111199,0x210111BA,0x00118022,0x00118021,0x00118021,0x91118D21,0x80210022
+	.word 0x80310022,0x33310122,0x99002282,0x99002280,0x92002280,0x92002280,0x92002280,0x12002280
+	.word 0x33042280,0x33322222,0xC91D9980,0xC9222299,0xC2222299,0xC2222229,0xC2222229,0x92222229
+	.word 0x92222221,0x91222233,0xBB99FF9C,0xAAA90399,0xAA8099AA,0xAA809900,0xAA809900,0xAA809900
+	.word 0xAA809900,0xAA809900,0xAAC09900,0x99809A00,0x99809A00,0x9980AA00,0x9980AA00,0x999AAA08
+
+	.word 0x999AAA99,0x99809A99,0x99B39A00,0x99997A0D,0x999977A9,0x9999777A,0x8077777A,0x807700AA
+	.word 0xAA7714AA,0x7A77AAA7,0x7777AAAA,0x7777AAAA,0x7777AAAA,0x8177AAAA,0x009980AA,0x0099809A
+	.word 0x0099809A,0x0099809A,0x0099809A,0x009980AA,0x009980AA,0xD499FFAA,0x11110999,0x11119999
+	.word 0x11111999,0x118A9990,0x11059980,0x11199999,0x9311FF99,0x33330A11,0x33311123,0x33111133
+	.word 0x00118033,0x01118D33,0x338F3222,0x33311107,0x33111133,0x89118033,0x33130433,0x80111133
+	.word 0x84130033,0x33110133,0x91061181,0x11119999,0x11809999,0x11809900,0x11819100,0x11881300
+	.word 0x91009991,0x11059980,0x11999991,0x0099FF11,0x14AA8099,0xAAAAA999,0xAAAAA999,0xAAAA9999
+	.word 0xAAAA9999,0xAAAA9999,0x00AA8099,0x00AAABA9,0x00AA809A,0x91AA8D9A,0x80AA0099,0x9AAA0599
+
+	.word 0x9AAA9999,0xA91F99A0,0xA999777A,0xA99977AA,0xA99977AA,0xA99977AA,0x99997AAA,0x9999AAAA
+	.word 0x9999AAAA,0x80A7AAAA,0x80A700AA,0x95A700AA,0x009980AA,0x159980AA,0x9999AAAA,0x999AAAAA
+	.word 0x999AAAAA,0x999AAAAA,0x999AAAAA,0x99FEAAAA,0x99901100,0x19991902,0x99881187,0x19991102
+	.word 0x9904118F,0x99111119,0x11FF11FF,0x990011D7,0x91001180,0x99851195,0x99809100,0x99111103
+	.word 0x00118099,0x91118999,0x80910099,0x91110399,0x11809999,0xA90199BD,0x00AA80A9,0x00AA8099
+	.word 0x00AA8099,0x04AA8099,0xAAAAA999,0x13AAC999,0xAA99999A,0xAA99999A,0xAA99999A,0xAA99999A
+	.word 0xAA99999A,0x9A009980,0x9A009980,0xAA0299A2,0xAA8099AA,0xAA809900,0xAA80A900,0xAAAEA900
+	.word 0xAA999905,0x80999AAA,0x809900AA,0x809900AA,0x809900AA,0x809900AA,0xAA9903AA,0x99D19AAA
+
+	.word 0x99991909,0x99991119,0x80991111,0x99990C11,0x99991119,0x99991111,0xFF191111,0xFF11FF11
+	.word 0x0011ED11,0x81119991,0x11110399,0x11959999,0xA9009980,0xA9009980,0xA9049980,0xA9991111
+	.word 0xA1001180,0xA1001180,0xA1001180,0xA1001180,0x9985AADD,0x99809A00,0x999AAA13,0x999AAA99
+	.word 0x99AAAA99,0x99AAAA99,0x99AAAA99,0x00000099
 
 	.section .rodata
 	.align	2
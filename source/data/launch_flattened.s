@@ -6,8 +6,8 @@
 @	launch_flattened, 3368x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 421 tiles not compressed
-@	Total size: 512 + 13472 = 13984
+@	+ 421 tiles lz77 compressed, 13472 bytes raw
+@	Total size: 512 + 2416 = 2928
 @
 @	Time-stamp: 2021-04-06, 09:05:26
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,482 +17,94 @@
 
 	.section .rodata
 	.align	2
-	.global launch_flattenedTiles		@ 13472 unsigned chars
+	.global launch_flattenedTiles		@ 2416 unsigned chars
 	.hidden launch_flattenedTiles
 launch_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x32333333,0x32333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x88833333,0x88883333
-	.word 0x33333333,0x33333333,0x33333333,0x33888233,0x88882233,0x88882233,0x28882233,0x82222233
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333332,0x33333332
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33334443
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x83333333,0x88333333,0x88333333,0x88833333,0x88883333,0x88333333,0x88333333
-
-	.word 0x88883333,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x22222233,0x22222233,0x22222333,0x22222333,0x22222333,0x22222333,0x22222333,0x22223333
-	.word 0x33333332,0x33333332,0x33888882,0x38888888,0x38888888,0x22888882,0x28888222,0x88882222
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333332
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x23333333,0x23333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333322,0x33388222,0x33222222
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x22333333,0x22333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333332,0x33333322,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x43333333,0x43333333,0x44333333,0x44333333,0x44333333,0x43333333,0x43333333,0x33333333
-	.word 0x33444444,0x33444444,0x34444444,0x34444444,0x34444444,0x33444444,0x33444444,0x33334443
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x83333333,0x88883333,0x88883333,0x88888333,0x88888833,0x88888833,0x88888833,0x88888833
-	.word 0x22888888,0x28888888,0x28888888,0x28888888,0x28888888,0x22888888,0x22888888,0x22288888
-	.word 0x22333333,0x23333333,0x23333333,0x33333333,0x33333335,0x33333355,0x33333355,0x33333555
-
-	.word 0x88222222,0x22222222,0x22222222,0x22222222,0x22222223,0x22222233,0x22222233,0x22222333
-	.word 0x33333332,0x33333332,0x33333332,0x33333332,0x33333332,0x33333322,0x33338828,0x33338222
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33222223,0x32222233,0x22223333,0x22333333,0x23333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333332,0x33333322,0x33333323,0x33332223,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x23333333,0x33333333,0x32233333,0x33233333,0x33333333,0x33333333
-	.word 0x33333322,0x33333222,0x33333332,0x33333333,0x33333333,0x33333333,0x33333333,0x83333333
-	.word 0x88888333,0x88888333,0x88888333,0x88882333,0x88888823,0x88888888,0x88888888,0x28888888
-	.word 0x22288888,0x32288888,0x32228888,0x32222888,0x32222888,0x33222288,0x33322288,0x33332222
-	.word 0x33335555,0x33335555,0x33355555,0x33555555,0x33555555,0x55555555,0x55555555,0x55555555
-	.word 0x22233333,0x22333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333335,0x33333335
-	.word 0x33332222,0x22222222,0x22222222,0x22222223,0x22222333,0x22233333,0x23333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333332,0x33333222,0x33332222
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x88333333,0x88833333,0x88883333,0x28883323,0x28822223,0x22222233
-	.word 0x33333333,0x33333333,0x33333328,0x33333288,0x82332888,0x88222288,0x88828888,0x88828222
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333322,0x33333888,0x33338888,0x33288888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333323,0x33333323,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333666,0x33336666,0x33366666
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x32333333,0x33233333,0x33333333,0x33333332,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x83333333,0x83333333,0x83333333,0x88333333,0x88888333,0x88888833,0x88888823,0x28888823
-	.word 0x28888888,0x22888888,0x22288888,0x22228888,0x22222288,0x22222228,0x22222222,0x32222222
-	.word 0x33333222,0x33333322,0x33333322,0x33333332,0x33333332,0x22333332,0x22233333,0x22233333
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333355,0x33335555,0x33355555,0x33555555,0x35555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333355
-	.word 0x33222233,0x32233333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x11111333
-	.word 0x33333333,0x33333333,0x33333333,0x11113333,0x11111133,0x11111113,0x11111111,0x11111111
-
-	.word 0x33333333,0x33333333,0x33111113,0x33311111,0x33331111,0x33333111,0x33333331,0x33333331
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x22223333,0x22333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x82222222,0x22222222,0x22222223,0x22222233,0x22222333,0x22223333,0x22233333,0x33333333
-	.word 0x33888888,0x28822282,0x28222222,0x22222222,0x22222222,0x22222222,0x22233332,0x22333333
-	.word 0x33333333,0x33333333,0x38833322,0x88883322,0x88888222,0x88888222,0x22222222,0x22222222
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333332,0x33333338,0x33333322
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333223,0x33322223
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66666633,0x66666633,0x66666633,0x66666633,0x66666633,0x66666333,0x66663333,0x66633333
-	.word 0x33366666,0x33366666,0x33366666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333336,0x33333366,0x33333666,0x33336666,0x33666666
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x83333333,0x28823333
-	.word 0x28888823,0x28888823,0x22888833,0x22288823,0x22228823,0x22222882,0x22222222,0x32222222
-	.word 0x33322222,0x33332222,0x33333222,0x33333322,0x33333322,0x33333332,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x53333333,0x53333333,0x53333333,0x55333333,0x55333333,0x55333333
-	.word 0x55555155,0x55555111,0x55555511,0x55555551,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x11555515,0x11111111,0x11111111
-	.word 0x33333555,0x33355555,0x11111155,0x11111115,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111133,0x11111133,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x31111111
-	.word 0x11111111,0x31111111,0x31111111,0x33131111,0x33333331,0x33333331,0x33333331,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33113333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x22222222,0x22333333,0x23333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333222,0x32222222,0x32222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33323333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66633333,0x66633333,0x66633333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66666666,0x66666666,0x66666666,0x66666633,0x66666633,0x66666333,0x66666333,0x66666333
-	.word 0x36666666,0x36666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33366666,0x33666666,0x33666666,0x66666666
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33666666
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x23333333,0x83333333,0x83333333,0x83333333,0x83333333,0x22233333,0x32233333,0x33332333
-	.word 0x22888888,0x22228888,0x22222888,0x33222288,0x33332222,0x33333332,0x33333333,0x33333333
-	.word 0x33322222,0x33333322,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x23333333,0x33333333,0x33333333,0x33333333
-	.word 0x55533333,0x55533333,0x55533222,0x55553322,0x55553333,0x35555333,0x55555333,0x55555533
-	.word 0x11115555,0x11115555,0x11111151,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33311111,0x33311111,0x33311111,0x33511111,0x35551111,0x55555111,0x55555551,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x11133333,0x11113355,0x11111555
-	.word 0x33111333,0x33111333,0x33311133,0x33311113,0x33331111,0x33331111,0x33331111,0x33333111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x22233333,0x22223333,0x32233333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333332,0x33332222,0x33332222
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66666333,0x66666333,0x66666333,0x66666333,0x66663333,0x66633333,0x33333333,0x33333333
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666663,0x66666633
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x33333333,0x33333366,0x33333366,0x33333366,0x33333666,0x33333666,0x33333666,0x33333666
-
-	.word 0x33332233,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x53333333,0x55333323,0x55533333,0x55555333,0x55555333,0x55555533
-	.word 0x55355553,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x55551111,0x55555511,0x55555511,0x55555551
-	.word 0x55555111,0x55555511,0x55555551,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x15555555,0x11555555,0x11155555,0x11115555,0x11115555,0x11111555
-	.word 0x11111555,0x11111155,0x11111111,0x11111111,0x11111111,0x11111111,0x11311111,0x51111111
-	.word 0x33333111,0x33333111,0x33333311,0x33333331,0x33333355,0x33333555,0x33355555,0x35555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x22333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33322222,0x33323222,0x22222223,0x22223333,0x22222333,0x22222333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33332222,0x22222222,0x22222222,0x22222222,0x22222223,0x22233333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333332,0x33333332,0x33333322,0x33322222
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66663333,0x66633333,0x66663333,0x66663333,0x66663333,0x66663333,0x66663333,0x66633333
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x33333666,0x33333666,0x33366666,0x36666666,0x36666666,0x66666666,0x66666666,0x66666666
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x53333333,0x55533333
-
-	.word 0x33333333,0x53333333,0x55333333,0x55533333,0x55555333,0x55555553,0x55555555,0x55555555
-	.word 0x55555553,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x11111111,0x11111111,0x51111111,0x55111111,0x55551111,0x55555555,0x55555555,0x55555555
-	.word 0x55555551,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x15555555,0x11555555,0x11555555,0x11155555,0x11111155
-	.word 0x11111555,0x11111155,0x11111115,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x51111111,0x51111111,0x51111111,0x55111111,0x55111111,0x55551111,0x55555111,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x15555555,0x15555555,0x11555555
-	.word 0x33313335,0x33311355,0x33331115,0x35551115,0x55555111,0x55555511,0x55555511,0x55555111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333355,0x33335555,0x33555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x22333333,0x23333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x32222222,0x22222222,0x22222223,0x22333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333332,0x33222222,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x22222333,0x33223333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33332222,0x33332222,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x66633333,0x66633333,0x66633333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66666666,0x66666666,0x66666666,0x66666663,0x66633333,0x66633333,0x77733333,0x77733333
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666667,0x66666777
-	.word 0x66666666,0x36666666,0x76666666,0x77666666,0x77766666,0x77766666,0x77766666,0x77777766
-	.word 0x33333333,0x33333333,0x33333333,0x55533777,0x55777777,0x77777777,0x77777777,0x77777777
-	.word 0x55553333,0x55555333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555557,0x55555577
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x51115555,0x51155555,0x11555555,0x11555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555511,0x55555111
-	.word 0x55555555,0x55555555,0x55555555,0x15555555,0x11155555,0x11111111,0x11111111,0x11111111
-	.word 0x55555555,0x55555555,0x55551555,0x55551115,0x15555111,0x11555111,0x11155511,0x11111551
-	.word 0x11111155,0x11111115,0x11111115,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x51111111
-	.word 0x55555551,0x55555551,0x55555551,0x55555551,0x55555551,0x55555555,0x55555555,0x15555555
-	.word 0x11555555,0x11115555,0x11111555,0x11111155,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x55555111,0x55555111,0x55555511,0x55555511,0x55555511,0x55555511,0x55555551,0x55555551
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333355,0x33555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333355,0x33333555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x55533333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x53333355,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333355,0x33555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555553,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55533333,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x55333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x55555533,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x77753333,0x77555333,0x77555555,0x75555555,0x75555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x66777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777775,0x77777555,0x77775555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x55555777,0x55555777,0x55555777,0x55557777,0x55557777,0x55557777,0x55577777,0x57777777
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x15555555,0x15555555,0x11555555,0x11155555,0x11155555,0x11555555,0x11555555,0x15555555
-	.word 0x55555111,0x55555111,0x55555111,0x55551111,0x55111111,0x11111111,0x11111111,0x11111111
-	.word 0x51111111,0x51111111,0x55111111,0x55111111,0x15111111,0x15555111,0x15555511,0x11155555
-
-	.word 0x11111155,0x11111115,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x55111111,0x55511111,0x55511111,0x55511111,0x55511111,0x55511111,0x55555511,0x55555551
-	.word 0x11155555,0x11111555,0x11111555,0x11111155,0x11111155,0x11111115,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x51111111,0x55111111,0x55111111
-	.word 0x55555555,0x55555551,0x55555551,0x55555551,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x15555555
-
-	.word 0x55555555,0x55555555,0x55551555,0x55551155,0x55551155,0x55551155,0x55551115,0x55551111
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x51555555,0x15555555,0x15555555,0x15555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555551,0x55555511,0x55555511,0x55555111,0x55551111,0x55511111,0x55513111
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x77775555,0x77775555,0x77775555,0x77555555,0x55555555,0x55555555,0x75555555,0x75555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x55555557,0x55555557,0x55555557,0x55555577,0x55555577,0x55555777,0x55555777,0x55555777
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111115,0x11111115,0x11111155,0x11111555
+	.word 0x0034A010,0xF0000033,0x33019001,0xF001F033,0x01F0FF01,0x01F001F0,0x01F001F0,0x01B001F0
+	.word 0xF0FFB1F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF1013001,0xF001F091,0x01F0FF01,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF201F001,0xF001F051,0x01F0FF01,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0
+	.word 0x91F10130,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFD01F001
+
+	.word 0x01F001F0,0x01F001F0,0x014001F0,0xFF034032,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0x2001F0C1,0x33888301,0x03008833,0x820180AC,0x00220E00,0x28033013,0x22221F33
+	.word 0x3037F082,0xF02CF301,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FE
+	.word 0xF001F001,0xF001F001,0x4301F001,0x13F0447F,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF
+	.word 0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FD01F0
+	.word 0xF001F001,0xF001F001,0x8301E001,0x13F30300,0x6303008B,0x88034097,0x7001F088,0xA303AD01
+
+	.word 0x23032022,0xCC0303F0,0x6EA75322,0x002A0082,0x0310382E,0xD9030B00,0x22283F88,0x8BF0E713
+	.word 0xDFF30160,0x01F001F0,0x230120BC,0x01F00340,0x98000100,0x823F2233,0xF0B62038,0xF001F01D
+	.word 0xF04EF001,0x0170F716,0x20F0C710,0x40430160,0x508D1303,0x13508503,0x44444433,0x80340350
+	.word 0x1320FF03,0x01F0BFF3,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xC001F001
+	.word 0x13BB0301,0x0300BC47,0x90643383,0x03010003,0xED288865,0x131003C0,0x52280300,0x352F63BB
+	.word 0x557F0300,0x0C000350,0xAC032303,0xD6030170,0x43F7EF33,0x90DF53F3,0x28501003,0xBDF7CA17
+	.word 0xF0FF01F0,0x7401A001,0x50AC2346,0x5001E0AB,0xFFC82077,0x01F06CF3,0x01F001F0,0x01F001F0
+
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xF701F001,0x01F001F0,0x974201F0
+	.word 0x728A0223,0xECB422A2,0xCBF61100,0x23830120,0x230350B3,0x00887588,0x03019002,0xA71328AB
+	.word 0x7DAE0332,0x300A0032,0x000A0303,0x5511230E,0x30AFA803,0x03003503,0x60035055,0xE30D4301
+	.word 0xE713FF11,0x5E330310,0x7023DB83,0x67F33320,0x23FF0140,0xF091536B,0xF001F001,0xF001F001
+	.word 0x8001D001,0x33239B68,0x22232888,0x1F1CDD82,0x10288160,0x0C930020,0x1F018235,0x003A01DC
+	.word 0x501C8206,0x301001B0,0x55FF3888,0xF0351031,0xF001F001,0xF8019001,0xFF01F06C,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0F8,0xF001F001,0x3301F001,0x365F6633,0x10660300
+
+	.word 0xF0080003,0xF001F001,0x01F0FF01,0x01F001F0,0x015001F0,0x87F39363,0xC0FF01F0,0x501B1B01
+	.word 0x13636703,0x870300A7,0xEFA7134F,0xD80A2C37,0x23320150,0x10380027,0x9E238703,0x22236343
+	.word 0x01F0AB93,0xDFD3C023,0x1EC0FE35,0x014001F0,0x22231C20,0x01F09314,0x11131833,0x0010B011
+	.word 0x1111110F,0x601600E2,0x112A9001,0x21103111,0x0600BF33,0x20020033,0xD001F003,0xF0B76701
+	.word 0x1D209E01,0x57A88222,0xC557F047,0xF082C618,0x56B1EB03,0xD7B41018,0x38833322,0x031505FF
+	.word 0x400340F3,0x3171F027,0xF0020483,0x01F0FF94,0x01F001F0,0x01F001F0,0x252601E0,0xF0FD3D29
+	.word 0xF001F001,0xF001F001,0x66012001,0xD0AF8903,0x9D336303,0x03081033,0xF00370A3,0x4A90FF01
+	.word 0x1010CD13,0x1EA0DF73,0x01F001F0,0xF0FC01F0,0xF001F001,0xF001F001,0x82AF0301,0xA313EB28
+
+	.word 0x1A120310,0x23A30323,0x49727A1E,0x49123279,0xA7C37122,0x533301F0,0x6B830380,0x55515522
+	.word 0x03101155,0x00E78B03,0xF001F006,0x00155501,0x1B5F532E,0xDB23DF63,0x83150B00,0x407F6377
+	.word 0x2001F003,0x80316F01,0x13030007,0x9BF39763,0xC90301F0,0xF012F0FF,0xF001F001,0xF001F001
+	.word 0x0001F001,0xA343FF01,0x1F506FF8,0xA7116728,0x01F02CF3,0xF0FF01F0,0xF001F001,0xF0015001
+	.word 0xF001F072,0xF701F001,0x01F001F0,0x013001F0,0x30A72363,0xFF01F003,0xDF93ABA3,0xE0130340
+	.word 0x01F00340,0x0754C0F3,0xF00350FF,0xF07BB073,0x1101F014,0x004397D7,0xFB26FF03,0xDF25C205
+	.word 0x93033737,0x0D12D71A,0x23FA7591,0xF053F09F,0x806FB001,0xA7035301,0x22551A53,0x5B030032
+	.word 0x7003532D,0x285BEF53,0x03008303,0xF05BF351,0xF001F001,0xA2F3E901,0x03103747,0x55030051
+
+	.word 0xE32F1435,0xBEF02B54,0x11130110,0x04291055,0x0A00EF10,0x74270E10,0x507F5713,0xF0E4F303
+	.word 0x01F0FF01,0x63572211,0x0100E0F2,0x2140DF2B,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0x83018001,0x509797AB
+	.word 0x30B1F31E,0xDA13FF01,0x01F01CF0,0xFFF301F0,0x0350D327,0x80FEDB17,0xF07CF303,0xF001F001
+	.word 0xE001F001,0x03FF5301,0x23AB23B8,0x039F439B,0x8040F7AA,0xFF6FF301,0x01B001F0,0xAF57AB37
+	.word 0x01F0BBF7,0x2A10B677,0x2F24157F,0x9F030320,0x64F00320,0x0410F713,0xA313517F,0xE0000320
+	.word 0x3428AE13,0x0410F357,0xD007F1FB,0x9081F101,0x321F151C,0xB1430D1B,0x2B3F1BFF,0x7F27D043
+	.word 0x4B6F6BE7,0x5C019063,0x9427FFA3,0x01F072F7,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+
+	.word 0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0xCF6301F0,0x0390DB53,0x01F0A037,0xF001F0FF
+	.word 0x53014001,0xE7B737AB,0xF08FF0EB,0x01F0FF01,0xE70A0120,0x0B503B17,0x02009B73,0x90FF0160
+	.word 0xF001F00B,0x60BFF301,0x23821701,0xFF019059,0x01F097F3,0xA743A3F3,0x9F435010,0x77A05BFB
+	.word 0x200350FD,0xF0DD2332,0x2067D078,0xD503356B,0x31135507,0xE0031533,0xDB277100,0x105F54FF
+	.word 0x7F54D10B,0xF17E38CF,0xFB01E076,0x1C90FF1B,0xCF431B3B,0x01502BF4,0x1EF0D337,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0xDF3401F0,0x0150CBF0,0x01F0BBF8,0x01F001F0
+	.word 0xFB0130FC,0x9301907F,0x6093276B,0xEB77732B,0xB0F30310,0x00670130,0x04107703,0x00B9C543
+	.word 0x12107603,0x03700600,0x43007777,0x77017087,0x00555337,0x60031012,0xCF4AD701,0x0057A0E2
+
+	.word 0x16F07703,0x01E001F0,0x15B512BF,0x03401A27,0xDF8201F0,0x69B317F3,0x2019B0DB,0x03001533
+	.word 0x83519823,0xCF9FF39B,0x01F001F0,0x82105111,0x8FB003D0,0xF7FFAA10,0x784170A7,0xF0039003
+	.word 0x4001F04B,0xFF463C01,0x1C3001F0,0xF333B701,0x1F5027F0,0x1B780150,0x701FF0FF,0xF0ECB101
+	.word 0xF0A8451F,0xF467B01F,0x27F0FF7F,0x1FF01FF0,0xA5A016F0,0x3FF019F0,0x70FF01F0,0x7017F041
+	.word 0xA01FF03B,0xF11FF01A,0x3B1F007E,0x6A007775,0x03102A13,0x60034075,0x6203EF01,0x01A08613
+	.word 0x00841375,0xF01D2004,0x01F0FE01,0x017001F0,0x0360A803,0x03505120,0x5D10FF57,0x01F0C613
+	.word 0x8B6601B0,0x03106133,0x13FFC662,0x10DF326B,0xE3092303,0x03FBC606,0xFFA3138A,0x9BF3B153
+	.word 0x01F001F0,0x5D1F0190,0x9C0003F0,0x005F33FF,0xF0478B63,0x9001F06F,0xF34110AF,0x01F0FFFB
+
+	.word 0x01F001F0,0x572101F0,0x59810970,0xF0FF055C,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xE001F0FF,0x52B61101,0xC06F71C3,0x32539920
+	.word 0x4302BFC7,0xF0F1F131,0xA7559301,0xF3EB2312,0x01F0FF90,0x01F001F0,0xDE6301F0,0x8F578B27
+	.word 0x83FC0320,0xB001F0F3,0x57F8D201,0x00DB5A2B
 
 	.section .rodata
 	.align	2
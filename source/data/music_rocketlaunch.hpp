@@ -1,3 +1,5 @@
 #pragma once
-constexpr int music_rocketlaunchLen = 543518;
+// ima adpcm, see platform/adpcm.hpp
+constexpr int music_rocketlaunchLen = 272292;
+constexpr int music_rocketlaunchSamples = 543518;
 extern const unsigned char music_rocketlaunch[music_rocketlaunchLen];
@@ -1,3 +1,5 @@
 #pragma once
-constexpr int music_wavesLen = 320909;
+// ima adpcm, see platform/adpcm.hpp
+constexpr int music_wavesLen = 160772;
+constexpr int music_wavesSamples = 320909;
 extern const unsigned char music_waves[music_wavesLen];
@@ -6,8 +6,8 @@
 @	old_poster_chinese_flattened, 3816x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 477 tiles not compressed
-@	Total size: 512 + 15264 = 15776
+@	+ 477 tiles lz77 compressed, 15264 bytes raw
+@	Total size: 512 + 2664 = 3176
 @
 @	Time-stamp: 2021-05-29, 07:25:26
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,545 +17,103 @@
 
 	.section .rodata
 	.align	2
-	.global old_poster_chinese_flattenedTiles		@ 15264 unsigned chars
+	.global old_poster_chinese_flattenedTiles		@ 2664 unsigned chars
 	.hidden old_poster_chinese_flattenedTiles
 old_poster_chinese_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x22222244,0x44444244,0x44444244,0x44444244,0x34444244
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44222222,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244443,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x22444444,0x22444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x44444224,0x44444224,0x44222222,0x44222222,0x44444222,0x44422222,0x44422222,0x44422222
-	.word 0x22222222,0x22222222,0x22444422,0x22444422,0x22444422,0x22444422,0x22444422,0x22444422
-	.word 0x44444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x44444444
-	.word 0x42244444,0x42222222,0x42222222,0x42244442,0x42244442,0x42222222,0x24222222,0x24444444
-	.word 0x24444444,0x22222224,0x22222224,0x24444224,0x24444224,0x22222224,0x22222224,0x42244422
-
-	.word 0x44444442,0x44444442,0x44444442,0x24444442,0x22244442,0x42444442,0x44444444,0x44444444
-	.word 0x44444244,0x22222224,0x22222222,0x44444422,0x22224422,0x22224422,0x44224422,0x44224422
-	.word 0x44442244,0x22222222,0x22222222,0x44442244,0x22222222,0x22222222,0x44442244,0x44442244
-	.word 0x24444444,0x24444422,0x24444422,0x24444444,0x24444422,0x24444422,0x24444422,0x24444422
-	.word 0x22222222,0x22222222,0x24444442,0x24444442,0x24444442,0x22222222,0x22222222,0x24444442
-	.word 0x22222222,0x22222222,0x44444442,0x44444442,0x44444442,0x22222222,0x22222222,0x44444442
-	.word 0x44444422,0x44444422,0x44444422,0x24444422,0x22444422,0x22444422,0x44444422,0x44444422
-	.word 0x22442444,0x22422244,0x44442224,0x44444422,0x24444442,0x24444444,0x24442444,0x24422244
-
-	.word 0x22222222,0x22222222,0x44422444,0x44422444,0x22222222,0x22222222,0x24444442,0x24422442
-	.word 0x24444422,0x24444422,0x22444444,0x22444444,0x22244442,0x42444442,0x44444442,0x44444442
-	.word 0x44444442,0x44444442,0x22222222,0x22222222,0x44442244,0x44442244,0x44442244,0x44442244
-	.word 0x44444444,0x44444444,0x22222224,0x22222224,0x44444224,0x44444224,0x44444224,0x44444224
-	.word 0x44444444,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444224
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x24444444,0x24444444,0x24444444,0x24444444,0x22444444,0x22444444,0x22444444,0x22444444
-	.word 0x44422222,0x44422222,0x44422222,0x44424224,0x44224224,0x24224224,0x24224224,0x24224224
-
-	.word 0x22444422,0x22444422,0x22444422,0x22444422,0x22444422,0x22444442,0x22444442,0x22444442
-	.word 0x22444444,0x22444444,0x44444444,0x22244444,0x22244444,0x24444444,0x24444444,0x24444422
-	.word 0x22222222,0x22222222,0x44222224,0x44442222,0x44444422,0x42222222,0x42222222,0x42244442
-	.word 0x22222222,0x22222222,0x22222444,0x22244444,0x44444444,0x22222224,0x22222224,0x24444224
-	.word 0x44444422,0x44444422,0x44444444,0x44444222,0x44444422,0x44444442,0x44444442,0x44444442
-	.word 0x44224422,0x22224422,0x22224422,0x44444422,0x44224422,0x22222422,0x22444422,0x22444422
-	.word 0x44442244,0x22222222,0x22222222,0x44442244,0x44444224,0x44444222,0x44442222,0x42222222
-	.word 0x24444422,0x24444422,0x24444442,0x24444444,0x24444444,0x22444444,0x22444444,0x22444444
-
-	.word 0x24444442,0x24444442,0x24444442,0x22222222,0x22222222,0x24444442,0x24444444,0x24444444
-	.word 0x44444442,0x44444442,0x44444442,0x22222222,0x22222222,0x44444442,0x44444442,0x44444442
-	.word 0x44444422,0x24444422,0x22444422,0x22444422,0x44444422,0x44444422,0x44444422,0x44444422
-	.word 0x24444224,0x24444422,0x24444442,0x24444444,0x24444444,0x44442444,0x44422244,0x24444222
-	.word 0x24422442,0x24422442,0x24422442,0x24422242,0x24242242,0x42224224,0x22244222,0x22444422
-	.word 0x22244442,0x22244442,0x44444442,0x44444442,0x44444442,0x24444444,0x24444444,0x22444442
-	.word 0x22222222,0x22222222,0x44244224,0x44224224,0x42244422,0x42244422,0x22444442,0x22444444
-	.word 0x44444222,0x44444222,0x44444224,0x44444224,0x44444224,0x44444224,0x44444224,0x22222224
-
-	.word 0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444224,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x22444444,0x22444444,0x22444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24224224,0x22224224,0x24444424,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22444442,0x22444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444422,0x24444442,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42244442,0x42222222,0x44222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444224,0x22222224,0x22222224,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42222422,0x44424422,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22444222,0x42244422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22444442,0x22444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444422,0x22444442,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244422,0x42444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x24444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244422,0x42444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x11111114,0x11111114,0x11111114,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44111111,0x44111111,0x44111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44244244,0x44244244,0x22222244,0x44244424,0x44244442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22244422,0x44444444,0x22444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444424,0x44444424,0x44222222,0x44424424,0x44444424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22242224,0x44242424,0x44242224,0x22242424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x24444442,0x42444442,0x42244444,0x44444442
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444442,0x44422222,0x44442442,0x44444224,0x44444222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222224,0x44244444,0x44244444,0x44244444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22244442,0x44244444,0x22244444,0x44244444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44422222,0x44424444,0x44422222,0x44444424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x22222244,0x44244444,0x44244444,0x22222222,0x44444444,0x44444444,0x44444444
-
-	.word 0x22224444,0x44444442,0x24444444,0x42444444,0x44224422,0x44444444,0x44444444,0x44444444
-	.word 0x42222222,0x44444222,0x44442424,0x42424424,0x44244424,0x44444424,0x44444444,0x44444444
-	.word 0x42242424,0x42242224,0x24242424,0x24242424,0x42242442,0x44244242,0x44444444,0x44444444
-	.word 0x22244442,0x44424442,0x22444442,0x44444444,0x24444422,0x42244424,0x44444444,0x44444444
-	.word 0x42222444,0x44444424,0x44422222,0x44424442,0x44424442,0x44442244,0x44444444,0x44444444
-	.word 0x22222222,0x44244444,0x44244444,0x44244444,0x44244444,0x44222444,0x44444444,0x44444444
-	.word 0x22244422,0x44244444,0x44244444,0x44244444,0x22244444,0x44224444,0x44444444,0x44444444
-	.word 0x44222222,0x44444244,0x44444244,0x44444242,0x44242442,0x44224444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42244444,0x22224444,0x22224444,0x22422444,0x22224444,0x44444444,0x44422444,0x44442244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44442444,0x22242244,0x44244224,0x44244222,0x22244244,0x44444244
-	.word 0x44444444,0x44444444,0x44442444,0x44442222,0x24442444,0x44442444,0x44442222,0x44444442
-	.word 0x44444444,0x44444444,0x42444444,0x22224424,0x44424222,0x44424424,0x44424424,0x22224424
-	.word 0x44444444,0x44444444,0x44444444,0x44444222,0x44444244,0x44444244,0x44444244,0x44444222
-	.word 0x44444444,0x44444444,0x44442444,0x44442444,0x44442444,0x44442444,0x44444244,0x44424244
-	.word 0x44444444,0x44444444,0x44444444,0x22224444,0x44424444,0x22224444,0x44424444,0x44424444
-
-	.word 0x44444444,0x44444444,0x44244444,0x44222222,0x44244444,0x44222222,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x22444444,0x22222224,0x44424424,0x44224424,0x22222224,0x44442444
-	.word 0x44444444,0x44444444,0x44444444,0x44422222,0x24424444,0x24424444,0x44422222,0x44442244
-	.word 0x44444444,0x44444444,0x44444244,0x22222224,0x44444442,0x22222222,0x44444442,0x22222242
-	.word 0x44444444,0x44444444,0x44444444,0x44444422,0x44444442,0x44444222,0x44444444,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x44444444,0x22244444,0x24444444
-	.word 0x44444444,0x44444444,0x44422222,0x44444444,0x44444222,0x44424244,0x22424244,0x42224244
-	.word 0x44444444,0x44444444,0x44444444,0x22222244,0x24444444,0x22444444,0x22444444,0x24244444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44222222,0x44444444,0x44444444,0x44444224,0x44442244
-	.word 0x44444444,0x44444444,0x44444244,0x24222222,0x24444424,0x22444424,0x42222224,0x24244424
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x44442222,0x44442444,0x44442444,0x44442244
-	.word 0x44444444,0x44444444,0x44424444,0x22222222,0x44444224,0x24444422,0x22222222,0x44444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444222,0x44444444,0x44444442,0x44444442,0x44444422
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x22444444,0x22224444,0x22222444,0x22222244
-	.word 0x22444444,0x22222244,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x44444422,0x44222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444422,0x44444222,0x44442222,0x44422222,0x44422222
-	.word 0x44444244,0x44444244,0x44444424,0x44444424,0x44444422,0x44444442,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x22224244,0x42444244,0x44244244,0x44224244,0x44424244,0x44444444,0x44444444,0x44444444
-	.word 0x44422222,0x24444242,0x44442442,0x44422442,0x24424442,0x44444444,0x44444444,0x44444444
-
-	.word 0x44424224,0x44422422,0x44424424,0x44442424,0x44442422,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x22444444,0x44244444,0x44444444,0x44444444,0x44444444
-	.word 0x44222424,0x42244422,0x22444442,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x44424444,0x24424444,0x22224442,0x44422442,0x44444444,0x44444444,0x44444444
-	.word 0x44222222,0x44444244,0x44442444,0x42422444,0x44244444,0x44444444,0x44444444,0x44444444
-	.word 0x44422444,0x22222244,0x22444444,0x44222444,0x44444224,0x44444444,0x44444444,0x44444444
-	.word 0x44444224,0x44444422,0x24444442,0x24442222,0x22422444,0x44444444,0x44444444,0x44444444
-	.word 0x44444242,0x44444242,0x22244242,0x44444244,0x22222244,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444442,0x44444442,0x44444442,0x44444244,0x44444222,0x44444444,0x44444444,0x44444444
-	.word 0x24444444,0x24444444,0x42444444,0x44224444,0x44424444,0x44444444,0x44444444,0x44444444
-	.word 0x44224244,0x44424244,0x44244244,0x42244244,0x24444222,0x44444444,0x44444444,0x44444444
-	.word 0x24424444,0x24442244,0x24444244,0x24444444,0x24444444,0x44444444,0x44444444,0x44444444
-	.word 0x44422444,0x44224444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244424,0x44244424,0x44244422,0x24244442,0x22222442,0x44444444,0x44444444,0x44444444
-	.word 0x44444242,0x22444424,0x44444222,0x24442442,0x24422444,0x44444444,0x44444444,0x44444444
-	.word 0x24444424,0x22222222,0x24444422,0x24444442,0x24444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444422,0x44444444,0x24444444,0x22444444,0x22244444,0x22244444,0x22224444
-	.word 0x22222224,0x22222222,0x22222222,0x44222222,0x44422222,0x44444222,0x44444422,0x44444442
-	.word 0x22222222,0x22222222,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x22222222,0x22244444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222244,0x22222444,0x22224444
-	.word 0x24222222,0x24222222,0x22222222,0x22222222,0x42222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44442444,0x22242244,0x44444224,0x44444222,0x44444244,0x22224244,0x44444244,0x44444244
-	.word 0x44442444,0x24422222,0x44444442,0x24444442,0x24444442,0x24422222,0x44444442,0x44444442
-	.word 0x44444244,0x22422222,0x44444244,0x22222222,0x44444444,0x44444444,0x22222222,0x44442244
-	.word 0x24444442,0x22444222,0x42244442,0x42224222,0x42444244,0x42444244,0x42444422,0x42444424
-	.word 0x24444444,0x22222224,0x44424444,0x44424444,0x44424444,0x22222222,0x44424444,0x44424444
-	.word 0x44424444,0x22224442,0x44442444,0x44244444,0x24224444,0x42244442,0x44422444,0x44444444
-
-	.word 0x44444444,0x42222242,0x42444242,0x42444242,0x42224244,0x44444244,0x22222244,0x44444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44422444
-	.word 0x44444444,0x44444444,0x24444444,0x24444444,0x44444444,0x44444444,0x24444444,0x24444444
-	.word 0x44224424,0x22224442,0x44442242,0x24444222,0x22222424,0x24442442,0x24442442,0x22222222
-	.word 0x44444444,0x22444422,0x44444422,0x44444242,0x44444222,0x22224244,0x44444244,0x44444222
-	.word 0x44444444,0x42222222,0x44444244,0x44444244,0x44444244,0x22222222,0x44444424,0x44424442
-	.word 0x42444444,0x22244444,0x44422444,0x22222444,0x44424444,0x22424442,0x42424444,0x42424444
-	.word 0x44444444,0x44222222,0x44424444,0x42222222,0x44444444,0x44422222,0x44424444,0x44424444
-
-	.word 0x42422224,0x42424424,0x44224424,0x44242424,0x22442424,0x24424424,0x42424424,0x42424424
-	.word 0x44442222,0x44422444,0x44424444,0x44424444,0x44442222,0x44444444,0x44422442,0x44442442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22224444,0x22222444,0x22222444,0x22222444,0x42222444,0x42222444,0x42222444
-	.word 0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x11111444,0x11111144
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444411
-
-	.word 0x22244444,0x22244444,0x22444444,0x22444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444244,0x44444244,0x22224244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444442,0x24422222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444224,0x44444422,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444424,0x42444424,0x42444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424444,0x44424444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42424444,0x42422444,0x22442442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244224,0x42444444,0x42422222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442444,0x44442444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442444,0x44442222,0x22222442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x24444444,0x42244244,0x44224222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424442,0x44424444,0x22224444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42422442,0x42442442,0x22442242,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44422224,0x42444444,0x42222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24422224,0x42444424,0x22244424,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442222,0x44444244,0x44422222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x22224444,0x22224444,0x22224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111114,0x11111114,0x11111114,0x11111114,0x11111144,0x11111144,0x11111444,0x11111444
-	.word 0x44444111,0x44441111,0x44441111,0x44441111,0x44441111,0x44441111,0x44444411,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x24444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444442,0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44424444,0x44422444,0x44422444,0x44422244,0x44422244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x22244444,0x22444444,0x22444444,0x24444444,0x24444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444442,0x44444422,0x44444222,0x44442222,0x44422222,0x44222222,0x42222224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x24444444,0x24444444,0x22444444,0x22244444,0x22244444,0x22222444,0x22222444,0x22222244
-	.word 0x42222222,0x42222222,0x42222222,0x44222222,0x44222222,0x44222222,0x44422222,0x44442222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x22444444
-	.word 0x44422244,0x44422244,0x44422224,0x44422224,0x44222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444422,0x44444222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222244,0x22222444,0x22222444,0x22244444,0x24444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444422,0x22222222,0x22222222,0x22222222,0x22222224,0x44444444,0x44444444
-	.word 0x44444444,0x22444444,0x22222222,0x22222222,0x22222222,0x22222222,0x44444444,0x44444444
-	.word 0x22222224,0x22222222,0x22222222,0x44222222,0x44442222,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x42222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244222,0x44242244,0x44242444,0x44224444,0x44224444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x22224444,0x44224444,0x44424444,0x44424444,0x44424444,0x44424444,0x44424444
-
-	.word 0x22222222,0x22222222,0x22222244,0x22222444,0x22224444,0x22244441,0x22244411,0x22244411
-	.word 0x44442222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44244444,0x44244444,0x44244444,0x42224444,0x42222444,0x24242444,0x24442444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444
-	.word 0x24444444,0x24444444,0x24444444,0x44444444,0x44442444,0x44444224,0x44444422,0x44444442
-
-	.word 0x44444444,0x44444442,0x44444422,0x44442222,0x22222222,0x42222222,0x44222222,0x44422224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44224444,0x44244444,0x42244444,0x22444444,0x22444444,0x42244444,0x44224444,0x44422444
-	.word 0x22244444,0x22244444,0x22224444,0x22222444,0x22222222,0x22222244,0x44444444,0x44444444
-	.word 0x44442222,0x44442222,0x44442222,0x44422222,0x44222222,0x42222244,0x22224444,0x22444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442
-	.word 0x22224444,0x44442444,0x44444244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444442,0x44444424,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22444444,0x42444444,0x42244444,0x44244444,0x44244444,0x44244444,0x44224444,0x44422444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442224,0x44442224,0x44442224,0x44444224,0x44444224,0x44444424,0x44444424,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x43444244,0x44444244,0x44444244,0x44444244,0x22222244,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444224,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44442244,0x44444224,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444422,0x44444424,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x44222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x42222244,0x44444222,0x44444444,0x44444444,0x44444444
-	.word 0x44444224,0x44444422,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444434,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
+	.word 0x003BA010,0xF0000032,0x44019001,0x22018044,0x4422220D,0x70070042,0x1EC03403,0x2FA0227F
+	.word 0x1FF001C0,0x15F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF001,0xF01FF01F,0xF001F01F,0x01F0FF1F
+	.word 0x01F01FF0,0x1FF01FF0,0x1FF015F0,0xF0FF01F0,0xF001F01F,0xF01FF01F,0xF01FF01F,0xFF1FF001
+	.word 0x1FF001F0,0x1FF001F0,0x15F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF001,0xF01FF01F,0x8001F01F
+	.word 0x0500BF1F,0xB303B024,0xF003F06F,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF0F101F0,0xF001F001,0x24012001,0x73D34344,0xF07FF3FB,0x137FF303,0x24C0E3BC
+
+	.word 0x03102300,0x20DB13EF,0x420B2003,0x01400380,0x03F01610,0xF02F54F6,0x10033098,0x3D004206
+	.word 0xFF420320,0x03100B00,0x83700F40,0x03100C10,0x03201C00,0x220F40BF,0xCEA02F20,0xA2101E10
+	.word 0x1410D970,0x00A370FF,0x20C96090,0x50022001,0x400BC01E,0x00247FBD,0x90032006,0x4003600B
+	.word 0x2026412F,0x1390FF03,0xA7600B80,0x66501390,0x53100340,0x30AF3B51,0xA610247E,0x30EF0042
+	.word 0x2053100F,0x01109F15,0xDA704222,0x8FA07D40,0xBB800100,0x515220FF,0xE006D21F,0x41FF70F7
+	.word 0x70836104,0x6541FFE8,0x3EF032D0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xD001F001,0xFFFF3001,0x7FF3D6F2,0x7F8303F0,0x42A134D0,0x1D436B93,0x030310FF,0xF3033007
+	.word 0x50A23373,0x104B8003,0x0E42FF5E,0xF741CB82,0xB0630800,0x5F728F93,0x20FF1D10,0x200B923B
+
+	.word 0x50E75110,0x3057A270,0xFF734301,0x3C100F40,0x73C31F54,0x63246B24,0xA7408740,0xC1F762FF
+	.word 0x3277F323,0xF22B50FB,0x308BC3E3,0x77E3FF03,0xE3300C65,0x81207FB0,0x20119301,0x03FF0190
+	.word 0x1096118F,0x639A2308,0x9573236F,0xFF9B5072,0x3E003E65,0xDD21DB21,0x8A31D734,0x77D30F41
+	.word 0xD2F060FF,0xF003C030,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x63540190
+	.word 0x60FF01F0,0xF303F021,0x7103F07F,0xA02EF18C,0xFF67237F,0xAF468C16,0x638301B0,0x183001F0
+	.word 0x3FF03B92,0xF0EF76FF,0x767F201C,0xF71DF0EF,0x027FE0C6,0xF41EFF7A,0x61603CF0,0x3F901AF0
+	.word 0x85F17A14,0x40FF40A0,0x3001F003,0xF016549B,0x435F1001,0xFF43F007,0xCFC71F50,0x37F05FF0
+	.word 0x3FF03FF0,0xBFF00170,0xF13F90FF,0xF07FD077,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0
+
+	.word 0x01F001F0,0x01F001F0,0xF0FC01F0,0xF0164301,0xF07FF303,0x143C9103,0x11113311,0x66F00350
+	.word 0x16004444,0xF0FF0160,0xF01FF01D,0xF01FF01F,0xF01FF01F,0xFF1FF01F,0x01F01FF0,0x1FF01FF0
+	.word 0x1FF01FF0,0x1FF01FF0,0xF01DF0FF,0xF01FF01F,0xF01FF01F,0xF01FF01F,0x1FF0FF1F,0x1FF001F0
+	.word 0x1FF01FF0,0x1FF01FF0,0xF0EF1FF0,0xF01FF01D,0x0360111F,0x01F01DF0,0xF0FF01F0,0xF001F001
+	.word 0xD001F001,0xF373F301,0xFD03F07F,0x01F038F6,0xA30801E0,0x9C2D0320,0xFFBB1624,0x010023F0
+	.word 0x0A607315,0x092AA9F0,0x23403DF0,0x09B006FF,0x06071041,0x489BF6F8,0xD00620FA,0xE339BFBE
+	.word 0x5AA22042,0x2A5FF047,0xD08D80C7,0xEAADFF43,0xC949DBF0,0x5EF08F2B,0x01F001F0,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01A0FF01,0x7FF373F3,0x7FF303F0,0x5F6001F0
+	.word 0xF8FFB382,0x4091328F,0xB0412C70,0x008B1C1D,0x7BA9271C,0xA2651C42,0x03AD1CB7,0x0700426B
+	.word 0x00BF0120,0x25104208,0xBB3C1F50,0x58300110,0x1CFF8810,0x0C4070A9,0x508540E9,0x30829001
+	.word 0xFF13C1AF,0x2B34D683,0x854E1FA0,0x2B613F60,0x9F00F013,0xF08530FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0xFF01F001,0x01F001F0,0x063F0140,0xFA1E0320,0x157C823F,0xD001F0FF,0xF303F03F
+	.word 0xD303F07F,0x2356227F,0x3706FF09,0x361DE726,0x99201FA0,0x96524043,0x10FF0180,0x16060339
+	.word 0xB3035017,0x603A46AB,0xFF9FA603,0x2320BAD0,0x755020D4,0x40801483,0x07401A34,0x2E5FF4FF
+
+	.word 0x37974043,0x46C0C607,0xDDFC30DB,0x4314FFB5,0x2720DE10,0x8BC42940,0x1F200C10,0xF4FF7740
+	.word 0x102660DE,0x54F3ADA7,0x235830C5,0xFF7F01EC,0xE050C1C7,0x0C24736F,0x5D401EC0,0xBFB08820
+	.word 0x14FE10FF,0x10BE117D,0xD06118E0,0xE461609B,0xF317FF66,0x16314000,0x18EE0A11,0x7ED0F790
+	.word 0x42FFFB80,0x300300EB,0xF0072042,0xF001F001,0xFF404001,0x01F04A30,0x8C3F9FF1,0xC3388120
+	.word 0xF290AC50,0xF01EF3FF,0xF3017001,0xF07FF373,0x00037003,0x3626FF8D,0xB7122B10,0x1A00F2D1
+	.word 0x9532B202,0x80FF2850,0x111C007D,0x21D72294,0x80A1F0D8,0xFFD3E9A8,0x7814621A,0x3DF0ED42
+	.word 0x65006B73,0x92F23412,0x201E20FF,0xC04610EE,0x31DE3442,0xC06B00E7,0xE664FF3E,0x5B145E33
+	.word 0x01700411,0x03100A33,0xC1FF8F44,0xFAABA1D3,0x44F750F3,0x90DD5151,0xFF734140,0xD6FA6041
+
+	.word 0xAE6BD614,0x68E334FB,0x01307CD0,0x184240FF,0x25DFE06C,0x1082304E,0x73DFB1FF,0x6910FF6B
+	.word 0x7DB07FF0,0x0340E351,0x0EC3AF03,0x81FFF722,0xC028F309,0xB41E605B,0xC01FD0AF,0xFFDF3364
+	.word 0x76251D30,0x36151E80,0x72F00C70,0x01F001F0,0xF021B1FF,0xF3037003,0x6603B073,0x239F96F7
+	.word 0x1F60FF93,0x7B4DF552,0x73A23A25,0x5F45D200,0x31FF4661,0x21D74207,0x7A5B1272,0x401A1024
+	.word 0xFF82039D,0x6735B096,0x11100F90,0xAC307931,0x48934B10,0x0AAE00FF,0x304A02B3,0xFB822A59
+	.word 0xC301F028,0x5BD2FF8C,0xB9120F20,0xCD11F723,0x3846C012,0x50FF0310,0x24B45862,0x513F8144
+	.word 0x97E621DC,0xFF1012F7,0x5641D940,0x33221834,0xF9431E61,0x1721F253,0x700F40FF,0x005C014C
+	.word 0x0003108A,0x00991B42,0x0F00FF08,0x17300600,0x5B91CF36,0x4B153341,0xF0FFEDF4,0xC001F001
+
+	.word 0xA0BB5901,0x10363C03,0xE079409C,0x01F001F0,0x111401A0,0xFF114411,0x19F00300,0x1C300160
+	.word 0x5B57EB53,0x9EF34CCC,0xF301A0FF,0xF0FFF612,0xF3019001,0xF07FF373,0x03F0FF03,0x0110AEF2
+	.word 0x663D4B68,0xA6797DF0,0x40FF1FF0,0xF0595781,0xF361701D,0x131F602E,0xFF60326B,0xAE551CF0
+	.word 0x1DF08223,0x99F09540,0x25F001F0,0x231560FF,0xA037C615,0xF0B72621,0x8198201E,0x1DF0FF41
+	.word 0x28430723,0x5C20DFF0,0xB3157233,0x30FFDFF0,0x2476181F,0x541DF00E,0xF0A58F18,0xFF01F001
+	.word 0x01F001F0,0x03D0A090,0xF3F09353,0x660301E0,0x0390117D,0x03107323,0x10107F13,0xFF670341
+	.word 0x03E06803,0x99E04AF0,0x72F39D20,0x03807FF3,0xF001F0FF,0xF066F001,0xF07FF303,0xF070F003
+	.word 0x01F0FF01,0x01F001F0,0x01D001F0,0x01F07AF0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0x47A158FF,0xF073F37C,0xF001F001
+	.word 0x8001F001,0x7FF6FF01,0x91500340,0x7BBD0B6E,0xA0F02A27,0xF0FF01F0,0x4080C001,0x57F77A03
+	.word 0x506F7A87,0xFF2B5E03,0x4CF08340,0x01F001F0,0x03F07EF0,0x03F07FF3,0xF004F3FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xF001F001,0xF001F001,0xFF01F001,0x733201C0,0x7A566743,0x0B7D5F42,0x012037F0,0xF00F53FF
+	.word 0xF001F001,0xF001F001,0x8A685001,0xC3FDFF97,0xB3809B73,0x45D08F3C,0x185001B0,0xC0FF5FFE
+	.word 0xF0C51B38,0x4001F095,0x6012F02E,0xFF6A1001,0x67434AF0,0x551C1E2A,0x8A948D18,0x7FF373F3
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+
+	.word 0xF0FF01F0,0xF001F001,0xF001F001,0xE001F001,0xF8B31201,0x0B003526,0x7882C0F1,0x2222E342
+	.word 0x0800BF41,0x76034011,0xF203F06F,0x4001F04E,0x0380FF83,0x6C1EEC53,0x01F0B3FB,0x01F001F0
+	.word 0xF0FF01F0,0x126B4078,0x50F34CE2,0x63C373BD,0xFFEB26A8,0x01A0BB4B,0x01F011F0,0x01F001F0
+	.word 0x01F001F0,0xF07060FF,0xF07FF303,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01E001F0
+	.word 0x01F08711,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0xD2690170
+	.word 0x81626662,0xFF591220,0x637F33FF,0x8D3D508B,0x33F75989,0xF5232078,0x0180FFEF,0x57105E31
+	.word 0x01F00C60,0x88F31A40,0xF0FF01F0,0x5BE06001,0x70EB5038,0xA001F0E6,0xFFFD5001,0x45C00320
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x4001F0EF,0x43673301,0xDFF773A3,0xB7F801A0,0xF01FF0FF
+
+	.word 0xF01FF015,0xF01FF001,0xF11FB001,0x3FF0FF82,0x1FF01FF0,0x01F01FF0,0x01F01FF0,0xF0FF1FF0
+	.word 0xF01FF001,0xF015F01F,0xF10C301F,0xFF3FF003,0x15F01FF0,0x5E401FF0,0x3FF0ABE2,0x15F01FF0
+	.word 0xC01EF0FF,0x06A40901,0xD6CBC097,0xF001F0CB,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x346001B0,0x01A012F0
 
 	.section .rodata
 	.align	2
@@ -6,8 +6,8 @@
 @	old_poster_flattened, 3816x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 477 tiles not compressed
-@	Total size: 512 + 15264 = 15776
+@	+ 477 tiles lz77 compressed, 15264 bytes raw
+@	Total size: 512 + 2344 = 2856
 @
 @	Time-stamp: 2021-10-25, 17:44:23
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,545 +17,92 @@
 
 	.section .rodata
 	.align	2
-	.global old_poster_flattenedTiles		@ 15264 unsigned chars
+	.global old_poster_flattenedTiles		@ 2344 unsigned chars
 	.hidden old_poster_flattenedTiles
 old_poster_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x22222244,0x44444244,0x44444244,0x44444244,0x34444244
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44222222,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x22222244,0x22222244,0x22222244,0x22222244,0x44222244
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x22222222,0x22222222,0x22222222,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x22222222,0x22222222,0x22222222,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444222,0x44444222,0x44444222,0x44444222,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44442444,0x44442444,0x44422244,0x44422244,0x44222244,0x44222224,0x44222224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222444,0x22222444,0x22222444,0x22222444,0x42222444
-	.word 0x44444444,0x44444444,0x44444444,0x44422222,0x42222222,0x22222222,0x22222222,0x22244444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44424444,0x44224444,0x42224444,0x22224444,0x22224444,0x22224444,0x22224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444442,0x44444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44442222,0x44442222,0x44442222,0x44442222,0x44442222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x22244444,0x22224444
-	.word 0x44444444,0x44444444,0x22244444,0x22222224,0x22222222,0x22222222,0x44422222,0x44444422
-
-	.word 0x44444444,0x44444444,0x44444442,0x44422222,0x42222222,0x22222222,0x22222244,0x22224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444422
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x22222222,0x22222222,0x22222222,0x24444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x22222222,0x22222222,0x22222222,0x44444222
-	.word 0x44444444,0x44444444,0x44444444,0x44444442,0x44444442,0x44444442,0x44444442,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244443,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44222244,0x44222244,0x44222244,0x44222244,0x44222244,0x22222244,0x22222244,0x22222244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42222222,0x42222222,0x42222222
-	.word 0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444222,0x44444222,0x44444222
-	.word 0x44444444,0x44444444,0x24444444,0x24444444,0x22444444,0x22444444,0x22244444,0x22244444
-
-	.word 0x42222222,0x42222222,0x22224222,0x22224222,0x22224222,0x22244422,0x22244422,0x22444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444442,0x44444422,0x44444422
-	.word 0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x22222444
-	.word 0x22444444,0x22444444,0x22444444,0x22444444,0x22444444,0x22444444,0x22244444,0x22222222
-	.word 0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444
-	.word 0x44444222,0x44442222,0x44422222,0x44222224,0x42222244,0x22222444,0x22224444,0x22244444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444422
-	.word 0x44442222,0x44442222,0x44442222,0x44442222,0x44442222,0x44442222,0x44442222,0x44442222
-	.word 0x22222444,0x22222444,0x42222244,0x44222244,0x44222224,0x44422224,0x44422224,0x44422224
-	.word 0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x24444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444222,0x44442222,0x44442222,0x44422222,0x44422224,0x44422224,0x44422224
-	.word 0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444224
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x22222244,0x44222244,0x44222244,0x44222244,0x44222244,0x44222244,0x44222244,0x44222244
-	.word 0x42222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444
-	.word 0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22224444,0x22222444,0x42222444,0x22222444,0x22222244,0x22222244,0x44222224
-	.word 0x22444442,0x24444444,0x24444444,0x44444444,0x22222222,0x22222222,0x22222222,0x44444444
-	.word 0x44444422,0x44444222,0x44444222,0x44442222,0x44442222,0x44422222,0x44422222,0x44222224
-	.word 0x22222444,0x22222444,0x22222444,0x42222444,0x42222444,0x42222444,0x42222444,0x42222444
-	.word 0x22222222,0x42222222,0x44442222,0x44422224,0x44222224,0x42222244,0x42222444,0x22222444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444
-	.word 0x22444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44442222,0x44422222,0x44222222,0x42222224,0x22222244,0x22222444,0x22224444
-	.word 0x44442222,0x44442222,0x44442222,0x44442222,0x44442222,0x44442222,0x44442222,0x44442222
-	.word 0x44422224,0x44422224,0x44422224,0x44222224,0x44222224,0x44222244,0x42222244,0x22222444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x22444444
-	.word 0x44422224,0x44422224,0x44422224,0x44422224,0x44422222,0x44442222,0x44442222,0x44444222
-	.word 0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444224,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44222244,0x44222244,0x44222244,0x44222244,0x44222244,0x44222244,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x22222222,0x22222222,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444222,0x24444222,0x24444222,0x22444222,0x44444444,0x44444444
-	.word 0x44422224,0x44422222,0x44442222,0x44442222,0x44444222,0x44444222,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44222244,0x42222244,0x42222444,0x42222444,0x22222444,0x22224444,0x44444444,0x44444444
-	.word 0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x44444444,0x44444444
-	.word 0x22224444,0x22244444,0x22244444,0x22444444,0x24444444,0x24444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444422,0x44444422,0x44444222,0x44442222,0x44442222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x22244444,0x22444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442222,0x44442222,0x44442222,0x44442222,0x44442224,0x44442244,0x44442444,0x44444444
-	.word 0x22222444,0x22224444,0x22244444,0x22444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444422,0x44422222,0x22222222,0x22222222,0x22222244,0x44444444,0x44444444
-	.word 0x22244444,0x22224444,0x22222224,0x22222222,0x44222222,0x44442222,0x44444444,0x44444444
-	.word 0x44444222,0x44444422,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x11111114,0x11111114,0x11111114,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x42444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x42444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x24444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44111111,0x44111111,0x44111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44222444,0x44444244,0x44444244,0x44222444,0x44244444,0x44422244
-	.word 0x44444444,0x44424444,0x42222444,0x44424444,0x44424444,0x44424444,0x44424444,0x42224444
-	.word 0x44444444,0x44444444,0x42222444,0x42442444,0x42444444,0x42222444,0x42442444,0x22222444
-	.word 0x44444444,0x44244444,0x22224444,0x44244444,0x44244444,0x44244444,0x44244444,0x22244444
-	.word 0x44444444,0x44444444,0x42244444,0x42444444,0x42444444,0x42444444,0x42444444,0x22244444
-	.word 0x44444444,0x44444444,0x22444444,0x42244444,0x44244444,0x44244444,0x42244444,0x22444444
-
-	.word 0x44444444,0x44444444,0x44444422,0x44444224,0x44444244,0x44444244,0x44444224,0x44444422
-	.word 0x44444444,0x44444444,0x44222222,0x44244424,0x44244424,0x44244424,0x44244424,0x42244422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22244444,0x44424444,0x44424444,0x22244444,0x24444444,0x42224444
-	.word 0x44444444,0x44444444,0x22444444,0x42244444,0x22244444,0x44244444,0x42244444,0x22444444
-	.word 0x44444444,0x44444444,0x44444442,0x24444424,0x24444422,0x24444444,0x24444444,0x44444422
-	.word 0x44444444,0x44444444,0x44442222,0x44442442,0x44444444,0x44444444,0x44444442,0x44444222
-	.word 0x44444444,0x44444444,0x42444224,0x42444244,0x42444244,0x42444244,0x42444244,0x22222244
-
-	.word 0x44444444,0x44444444,0x24224444,0x42244444,0x44244444,0x44244444,0x44244444,0x42224444
-	.word 0x44444444,0x44444444,0x42244442,0x42444442,0x42444444,0x42444444,0x42444444,0x22244444
-	.word 0x44444444,0x44244444,0x22224444,0x44244444,0x44244444,0x44244444,0x44244444,0x22244444
-	.word 0x44444444,0x44444444,0x42244444,0x44244444,0x42444444,0x22444444,0x22444444,0x24444444
-	.word 0x44444444,0x44444444,0x44444442,0x44444442,0x44444442,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22444444,0x24444444,0x24444444,0x24444444,0x24444444,0x22444444
-	.word 0x44444444,0x44444444,0x24444444,0x42444444,0x42444444,0x24444444,0x44444444,0x22444442
-	.word 0x44444444,0x44444444,0x44444422,0x44444444,0x44444444,0x44444422,0x44444424,0x44444442
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44442244,0x44442444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44422444,0x44424444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444422,0x44444424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444444,0x42444444,0x42444444,0x44244444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42244444,0x22224444,0x22224444,0x22422444,0x22224444,0x44444444,0x44422444,0x44442244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44442444,0x22222444,0x24442444,0x24442444,0x24442444,0x24442444,0x24442244,0x44444444
-	.word 0x44444444,0x22444444,0x42244444,0x22244444,0x44244444,0x42244444,0x22444444,0x44444444
-	.word 0x44444444,0x24444442,0x44444424,0x44444422,0x44444444,0x44444444,0x24444422,0x44444444
-	.word 0x44444444,0x44442242,0x44442422,0x44444442,0x44444442,0x44444442,0x44444422,0x44444444
-	.word 0x44444444,0x44422244,0x44244224,0x44222224,0x44444424,0x44444224,0x44222244,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444244,0x44422224,0x44444244,0x44444244,0x44444244,0x44444244,0x44422244,0x44444444
-	.word 0x44444444,0x42222444,0x22442244,0x24444244,0x24444244,0x22442244,0x42222444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424444,0x22224444,0x44424444,0x44424444,0x44424444,0x44424444,0x44422444,0x44444444
-	.word 0x44444444,0x24444442,0x22444442,0x22444442,0x42444442,0x22444442,0x24444442,0x44444444
-	.word 0x44444444,0x44444422,0x44444244,0x44444222,0x44444444,0x44444444,0x44444222,0x44444444
-	.word 0x44444424,0x44444424,0x44444424,0x44444424,0x44444424,0x44444424,0x44444224,0x44444444
-	.word 0x44444444,0x44422222,0x44224424,0x44244424,0x44244424,0x44224424,0x44422224,0x44444424
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x22444444,0x22224444,0x22222444,0x22222244
-	.word 0x22444444,0x22222244,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x44444422,0x44222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444422,0x44444222,0x44442222,0x44422222,0x44422222
-	.word 0x44444244,0x44444244,0x44444424,0x44444424,0x44444422,0x44444442,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444424,0x44444424,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x24444444,0x22444444,0x22244444,0x22244444,0x22224444
-	.word 0x22222224,0x22222222,0x22222222,0x44222222,0x44422222,0x44444222,0x44444422,0x44444442
-	.word 0x22222222,0x22222222,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x22222222,0x22244444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222244,0x22222444,0x22224444
-	.word 0x24222222,0x24222222,0x22222222,0x22222222,0x42222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22224444,0x22222444,0x22222444,0x22222444,0x42222444,0x42222444,0x42222444
-	.word 0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x11111444,0x11111144
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444411
-
-	.word 0x22244444,0x22244444,0x22444444,0x22444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x22224444,0x22224444,0x22224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111114,0x11111114,0x11111114,0x11111114,0x11111144,0x11111144,0x11111444,0x11111444
-	.word 0x44444111,0x44441111,0x44441111,0x44441111,0x44441111,0x44441111,0x44444411,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x24444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444442,0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44424444,0x44422444,0x44422444,0x44422244,0x44422244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x22244444,0x22444444,0x22444444,0x24444444,0x24444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444442,0x44444422,0x44444222,0x44442222,0x44422222,0x44222222,0x42222224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x24444444,0x24444444,0x22444444,0x22244444,0x22244444,0x22222444,0x22222444,0x22222244
-	.word 0x42222222,0x42222222,0x42222222,0x44222222,0x44222222,0x44222222,0x44422222,0x44442222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x22444444
-	.word 0x44422244,0x44422244,0x44422224,0x44422224,0x44222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444422,0x44444222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222244,0x22222444,0x22222444,0x22244444,0x24444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444422,0x22222222,0x22222222,0x22222222,0x22222224,0x44444444,0x44444444
-	.word 0x44444444,0x22444444,0x22222222,0x22222222,0x22222222,0x22222222,0x44444444,0x44444444
-	.word 0x22222224,0x22222222,0x22222222,0x44222222,0x44442222,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x42222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244222,0x44242244,0x44242444,0x44224444,0x44224444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x22224444,0x44224444,0x44424444,0x44424444,0x44424444,0x44424444,0x44424444
-
-	.word 0x22222222,0x22222222,0x22222244,0x22222444,0x22224444,0x22244441,0x22244411,0x22244411
-	.word 0x44442222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44244444,0x44244444,0x44244444,0x42224444,0x42222444,0x24242444,0x24442444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444
-	.word 0x24444444,0x24444444,0x24444444,0x44444444,0x44442444,0x44444224,0x44444422,0x44444442
-
-	.word 0x44444444,0x44444442,0x44444422,0x44442222,0x22222222,0x42222222,0x44222222,0x44422224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44224444,0x44244444,0x42244444,0x22444444,0x22444444,0x42244444,0x44224444,0x44422444
-	.word 0x22244444,0x22244444,0x22224444,0x22222444,0x22222222,0x22222244,0x44444444,0x44444444
-	.word 0x44442222,0x44442222,0x44442222,0x44422222,0x44222222,0x42222244,0x22224444,0x22444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442
-	.word 0x22224444,0x44442444,0x44444244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444442,0x44444424,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22444444,0x42444444,0x42244444,0x44244444,0x44244444,0x44244444,0x44224444,0x44422444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442224,0x44442224,0x44442224,0x44444224,0x44444224,0x44444424,0x44444424,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x43444244,0x44444244,0x44444244,0x44444244,0x22222244,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444224,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44442244,0x44444224,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444422,0x44444424,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x44222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x42222244,0x44444222,0x44444444,0x44444444,0x44444444
-	.word 0x44444224,0x44444422,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444434,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
+	.word 0x003BA010,0xF0000032,0x44019001,0x22018044,0x4422220D,0x70070042,0x1EC03403,0x2FA0227F
+	.word 0x1FF001C0,0x15F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF001,0xF01FF01F,0xF001F01F,0x01F0FF1F
+	.word 0x01F01FF0,0x1FF01FF0,0x1FF015F0,0xF0FF01F0,0xF001F01F,0xF01FF01F,0xF01FF01F,0xFF1FF001
+	.word 0x1FF001F0,0x1FF001F0,0x15F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF001,0xF01FF01F,0x8001F01F
+	.word 0x0500BF1F,0xB303B024,0xD003F06F,0xE003B040,0x0190FF7F,0x131081F0,0x3FF003D0,0x1F403FF0
+	.word 0x90FC8F00,0xF001F003,0x50012001,0x223C60EE,0x40247F44,0xF02CF003,0x80477001,0xA0033038
+	.word 0x00226B85,0x42B6000E,0xF024BF70,0xFF014060,0x1CF03810,0x2DB001F0,0x3FF1BC40,0x5FF02DE0
+	.word 0xD001F0FE,0xF09DF101,0x302A5023,0x242190DB,0x1201227F,0x0B010180,0x1F81C1D0,0x61F08C32
+
+	.word 0xE02FA0FF,0x111FE29F,0x701FF0D5,0xF253E082,0x01F0FCDA,0x01F001F0,0x01F001F0,0x44240130
+	.word 0x73D3437F,0x03F07FF3,0x94F1C461,0x70F083A3,0x206351FF,0xF13CF003,0xF33FF0E1,0xF31FA083
+	.word 0xE830FF83,0x03306543,0x11221F12,0x91608B30,0x63FF5410,0x925FE03C,0x101C20BB,0x5003F026
+	.word 0xFF265003,0x7B3003F0,0x038020F0,0x01F003F2,0x88C12FF1,0x406161FF,0xF308808E,0x20E7B0FF
+	.word 0xB155F087,0x6B54FF9D,0x39613C33,0xC3F00350,0x832001D0,0xF0FF9B51,0x801275DD,0x800370C7
+	.word 0x3103F03B,0xFF97E59D,0x01F01FF2,0x01F001F0,0x01F001F0,0x017001F0,0xBEF0247F,0x73F303F0
+	.word 0xE7367FD3,0x032003F0,0xD065F4FF,0xA234F001,0xB063F33F,0xF05DF03D,0x18B2FF5F,0x0A101B64
+	.word 0xFF616343,0x5566DBD3,0x62FF03C2,0xC0EFD6C6,0x30695503,0x5303A32A,0xFF01F09F,0x01F001F0
+
+	.word 0x03F03FF1,0x07E62133,0xD3703FD1,0x60C620FF,0xF00D3108,0xD4039051,0x61DA636E,0x01F0FF20
+	.word 0x01F001F0,0xA301B340,0xE64352B1,0x31FF0330,0xF3B4F2FB,0xF303F07F,0xF001F07F,0xFF01F001
+	.word 0xC4B001F0,0x21D063F0,0x7FF303F0,0xFFF603F0,0xF0B6F6FF,0xF001F001,0x2040F03C,0xA07BFA25
+	.word 0x4F31FF1F,0xDD60A661,0x77F1B3F1,0x9ED001F0,0x80FFD3C6,0x6573F37F,0x37407098,0x100C106B
+	.word 0xFF034031,0x4B970120,0x01F0E393,0xA09001F0,0x01F003F0,0x3001F0FF,0xF09780C0,0xC06FE35D
+	.word 0xE04BB72D,0x4777FF77,0xBB31D623,0xA73ABFA1,0xBDA09B8A,0xF1FF8458,0xF04070B2,0xF3CB7003
+	.word 0xF0FFF173,0xFF01F001,0x01F001F0,0x01F001F0,0xA70001C0,0x7FF3BAF0,0xDB03F0C3,0x11111424
+	.word 0xF0035011,0x44443F66,0x01601600,0x1FF01DF0,0x1FF01FF0,0xE01FF0FF,0xF0A1601F,0xF03FF01F
+
+	.word 0xF01FF01F,0x1FF0FF1F,0x1FF01DF0,0x1FF01FF0,0x1FF01FF0,0xF0FF1FF0,0xF01FF01F,0xF01FF001
+	.word 0xF11FF01F,0xFF3FF05F,0x1DF01FF0,0x1FF01FF0,0x01001FF0,0x1FF06763,0x603FE0FF,0xF01DF003
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x73F301D0,0x03F07FF3,0xC614A4EE,0x5BFF1350,0x006864D2
+	.word 0xE7132607,0x2641703C,0xFF184037,0xBF680B50,0x63158A28,0x47959FD0,0xDFBC9DF0,0x103F10FF
+	.word 0xAF3B5013,0x90B120C2,0x29FCCD39,0x01C0FF92,0x49F51100,0x20F101F0,0x9F9020F1,0xA0FBE750
+	.word 0x8035209F,0x21FCC01C,0xC186421D,0x10EF5DC1,0xA601F04D,0x5E102287,0x41A01F91,0x427F8C01
+	.word 0x8250C0F1,0xA2F09FF1,0xF2A75B50,0xD2FF07A8,0x9801C052,0x60CB9F3B,0x50428060,0xFFDFA168
+	.word 0x6BF048D0,0x01F001F0,0x01F001F0,0x01F001F0,0xF30150FF,0xF07FF373,0xC02CF103,0xF0D1F801
+
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0x6301F001
+	.word 0xFF01F0EC,0x01F001F0,0x01B001F0,0x01F07EF1,0x01F001F0,0xF001F0FF,0xA001F001,0xF0AF9301
+	.word 0xF001F01D,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xA0E701F0,0x3BA92501,0x7B422483
+	.word 0xF0C0D5FB,0x3F50FF01,0x7FF303F0,0x699403F0,0x1CF6782F,0xF5DF6480,0x24DBB5DB,0x2840CCD4
+	.word 0xD5101F30,0xA0FF8AC0,0x052E17DA,0x508630FC,0xF0FCF05D,0xEF7C4001,0x3CC69AF7,0x1622512E
+	.word 0x10032004,0xFFE3AD0B,0x60A001F0,0x60B09D36,0x6E573A87,0x67160340,0x7C0710FF,0xAE2440C3
+	.word 0xF10B4055,0x506181B1,0x4E28FF2B,0xBE30A291,0x01F00DF3,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xE001F001,0x11374701,0xFF476EE8,0x01F00720,0x01F001F0,0x4A304040,0x1FA801F0,0x18A3DFFF
+
+	.word 0x9737723E,0xF09EF690,0xF1017001,0x7FF3FFBD,0x60F003F0,0x01F001F0,0x01F001F0,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x7001F0FF,0xF0A8F901,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0xAA4001A0,0xE522A725
+	.word 0xA3FF6603,0x46F7220E,0xF3D9345A,0x70019028,0xFEF35B1E,0x73E31FF0,0x65336C2C,0x82100100
+	.word 0xFF428690,0x02F32B90,0x01F001F0,0x03F0F2D0,0x03F07FF3,0xF07FD3FF,0xF001F08B,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0x590150FF,0x1F03A0BB
+	.word 0xF20320FB,0xF001F066,0x01008301,0x44111114,0xF0030011,0x0160FF19,0xEB531C30,0xC07E93AE
+
+	.word 0x01A09EF3,0xF3FF12F3,0x9001F01E,0xF373F301,0xF003F07F,0xFF01F060,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF0FF01F0,0xF1018001,0xF001F0EB,0xD001F001,0xFB6B8301,0x93530360
+	.word 0x01E044FC,0x90116603,0xEF732303,0x7F130310,0x03411010,0xE0680367,0xFF4AF003,0x9D2099E0
+	.word 0x7FF372F3,0x01F00380,0x66F001F0,0xF303F0FF,0xF003F07F,0xF001F070,0xF001F001,0x01F0FF01
+	.word 0x7AF001D0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x894E01F0,0x01F08D9E,0xF001F0FF,0xF001F001,0xF6014001,0x5003407F
+	.word 0xEF6FFF91,0x2A277BBD,0x01F0A0F0,0x80C001F0,0x7AFF0340,0x7A8757F7,0x5E03506F,0xF083402B
+
+	.word 0xFF01F04C,0x7EF001F0,0x7FF303F0,0x04F303F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0x3201C001,0xFF674373,0x5F427A56,0x37F00B7D,0x0F530120,0x01F001F0,0xF001F0FF,0x5001F001
+	.word 0xFD978A68,0x809B73C3,0xB416FFB3,0x01B045F0,0x5FFE1850,0x600038C0,0xF0FEE6F0,0xF02E5001
+	.word 0x10016012,0x434AF06A,0x42572267,0x00220700,0xAD5F2403,0x73F3EA40,0xF07FF3FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xF001F001,0xF001F001,0xFC01E001,0x3526B312,0xC0F10B00,0xE3427882,0x415F2222,0x40110800
+	.word 0xF06F7603,0xF04EF203,0x8340FF01,0xEC530380,0x01106802,0x01F02CF0,0xF0FF01F0,0xD001F001
+
+	.word 0x126B3078,0x007214E2,0xFFBD500A,0xA863C373,0x0A2BEB26,0x11F001C0,0x01F001F0,0xF001F0FF
+	.word 0x6001F001,0xF303F070,0xF001F07F,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0x11FF01E0
+	.word 0xF001F087,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x017001F0,0x6662D269
+	.word 0x208162FF,0x33FF5912,0x508B637F,0x59898D3D,0x7833FFF7,0xEFF52320,0x5E310180,0x0C605710
+	.word 0x40FF01F0,0xF088F31A,0x6001F001,0x50385BE0,0xFFE670EB,0x01A001F0,0x0320FD50,0x01F045C0
+	.word 0x01F001F0,0xF001F0FD,0xF001F001,0x33014001,0x73A34367,0xA0DFF7FF,0xF0B7F801,0xF015F01F
+	.word 0xF001F01F,0x01F0FF1F,0x82F11FB0,0x1FF03FF0,0x1FF01FF0,0xF0FF01F0,0xF001F01F,0xF001F01F
+	.word 0xF01FF01F,0xFF1FF015,0x03F10C30,0x1FF03FF0,0x1FF015F0,0xABE25E40,0xF03FF0FF,0xF015F01F
+
+	.word 0x0901C01E,0xC09706A4,0xCBD6FFCB,0x01F001F0,0x01F001F0,0x01F001F0,0xF0EC01F0,0xB001F001
+	.word 0x12F03401,0x000001A0
 
 	.section .rodata
 	.align	2
@@ -6,8 +6,8 @@
 //	old_poster_french_flattened, 3816x8@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 477 tiles not compressed
-//	Total size: 512 + 15264 = 15776
+//	+ 477 tiles lz77 compressed, 15264 bytes raw
+//	Total size: 512 + 2456 = 2968
 //
 //	Time-stamp: 2021-10-25, 17:44:23
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_OLD_POSTER_FRENCH_FLATTENED_H
 #define GRIT_OLD_POSTER_FRENCH_FLATTENED_H
 
-#define old_poster_french_flattenedTilesLen 15264
-extern const unsigned int old_poster_french_flattenedTiles[3816];
+#define old_poster_french_flattenedTilesLen 2456
+extern const unsigned int old_poster_french_flattenedTiles[614];
 
 #define old_poster_french_flattenedPalLen 512
 extern const unsigned short old_poster_french_flattenedPal[256];
@@ -6,8 +6,8 @@
 @	old_poster_french_flattened, 3816x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 477 tiles not compressed
-@	Total size: 512 + 15264 = 15776
+@	+ 477 tiles lz77 compressed, 15264 bytes raw
+@	Total size: 512 + 2456 = 2968
 @
 @	Time-stamp: 2021-10-25, 17:44:23
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,545 +17,95 @@
 
 	.section .rodata
 	.align	2
-	.global old_poster_french_flattenedTiles		@ 15264 unsigned chars
+	.global old_poster_french_flattenedTiles		@ 2456 unsigned chars
 	.hidden old_poster_french_flattenedTiles
 old_poster_french_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x22222244,0x44444244,0x44444244,0x44444244,0x34444244
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44222222,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444424,0x44444224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x24444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444422,0x24444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44442444,0x44422444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222444,0x42224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x22444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22244422,0x22244442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42222222,0x42222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222444,0x22222444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42222222,0x44222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22244444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22224444,0x22224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44442222,0x44222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444424,0x44444224
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42224444,0x42224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44442444,0x44422444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22442224,0x22442224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22444222,0x22444222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244443,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44442224,0x44422224,0x44222224,0x42222224,0x22242224,0x22242224,0x22442224,0x44442224
-	.word 0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444442,0x24444422,0x24444222
-	.word 0x24444422,0x22444422,0x22444422,0x42244422,0x42244422,0x44444422,0x44444422,0x44444422
-	.word 0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444
-	.word 0x44422444,0x44422244,0x44222244,0x44222224,0x42222224,0x42224222,0x22244222,0x22244422
-	.word 0x22224444,0x22244444,0x22444444,0x22444444,0x24444444,0x24444444,0x44444444,0x44444444
-
-	.word 0x22444444,0x22244444,0x42224442,0x42224442,0x44222422,0x44222422,0x44422222,0x44442224
-	.word 0x22244442,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444
-	.word 0x42222222,0x44444444,0x44444444,0x44444444,0x44444444,0x42222222,0x42222222,0x42222222
-	.word 0x22222444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x24444444
-	.word 0x44422222,0x44422244,0x44442224,0x44442224,0x44444222,0x44444222,0x44444422,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22222444,0x44222244,0x44422244,0x44422224,0x44442224,0x44442224,0x44442224
-	.word 0x22222222,0x22444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x22224442,0x42224442,0x42224442,0x42224444,0x42224444,0x22224444,0x22224444,0x22224444
-	.word 0x44222222,0x42222444,0x42224444,0x42224444,0x42222444,0x42222222,0x44222222,0x44442222
-	.word 0x44444444,0x44444444,0x44444444,0x24444444,0x24444444,0x22444444,0x22444444,0x22244444
-	.word 0x44444224,0x44444222,0x44442222,0x44442222,0x44422222,0x44422242,0x44222442,0x44222444
-	.word 0x42224444,0x42224444,0x42224444,0x42224444,0x42224444,0x42224444,0x42224444,0x42224444
-	.word 0x44222444,0x42222444,0x22222444,0x22222444,0x24222444,0x24222444,0x44222444,0x44222444
-	.word 0x44444444,0x44444444,0x44444444,0x44444442,0x44444422,0x44444222,0x44442222,0x44422244
-	.word 0x22442224,0x44442224,0x44442224,0x44442224,0x44442224,0x44442224,0x44442224,0x44442224
-
-	.word 0x22222222,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444
-	.word 0x22444222,0x22444444,0x22444444,0x22444444,0x22444444,0x22444444,0x22444444,0x22444444
-	.word 0x22222222,0x44444442,0x44444442,0x44444442,0x44444442,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44442224,0x44442224,0x44442224,0x44442224,0x44442224,0x44442224,0x44442224,0x44442224
-	.word 0x24422224,0x24222244,0x24222444,0x22224444,0x22244444,0x22444444,0x24444444,0x44444444
-
-	.word 0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422
-	.word 0x24444444,0x22444444,0x22444444,0x22444444,0x22244444,0x22244444,0x42224444,0x42224444
-	.word 0x22444422,0x22444442,0x22222222,0x22222222,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444442,0x44444422,0x44444422,0x44444222,0x44444222,0x44442222,0x44442224
-	.word 0x44442224,0x44442224,0x44442224,0x44442224,0x44442224,0x44442224,0x44442224,0x44442224
-	.word 0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42222222,0x42222222
-	.word 0x22444444,0x22244444,0x22244444,0x42224444,0x42224444,0x44222444,0x22222244,0x22222244
-
-	.word 0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42222222,0x42222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442224,0x44442224,0x44422224,0x44422244,0x44222244,0x22222444,0x22224444,0x22244444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x22222222,0x22222222
-	.word 0x42224444,0x42224444,0x42224444,0x42224444,0x42224442,0x42224442,0x42224442,0x42224444
-	.word 0x44444222,0x44442224,0x44422244,0x44422244,0x44222444,0x42224444,0x42224444,0x22244444
-	.word 0x22244444,0x42224444,0x22224444,0x22224444,0x22222444,0x44222444,0x44422244,0x44422244
-	.word 0x42224444,0x42224444,0x22222222,0x22222222,0x22222222,0x22444444,0x22444444,0x24444444
-
-	.word 0x42224444,0x42224444,0x42224444,0x42224444,0x42224442,0x42224442,0x42224422,0x42224422
-	.word 0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444
-	.word 0x42222444,0x22224444,0x22244444,0x22444444,0x24444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442224,0x44442224,0x44442224,0x44442222,0x44442222,0x44442222,0x44442224,0x44442244
-	.word 0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444
-	.word 0x22444444,0x22444444,0x22444444,0x22444444,0x22444444,0x22444444,0x22444444,0x22444444
-	.word 0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44442224,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444424,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44222444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44422224,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44442224,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222224,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x42224444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42224222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44222444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44222444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x11111114,0x11111114,0x11111114,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44111111,0x44111111,0x44111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444244,0x44444224,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44442222,0x44442442,0x44442444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x44244444,0x44244444
-	.word 0x44444444,0x44444444,0x24444444,0x42444444,0x44444444,0x22244442,0x22224444,0x44424444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22244444,0x44224442,0x44424444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44224442,0x44244442,0x44244444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42244424,0x22444424,0x42444424
-	.word 0x44444444,0x44444444,0x42444444,0x44444444,0x44444444,0x42244422,0x42444424,0x42444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44424444,0x42222444,0x44424444,0x44424444
-	.word 0x44444444,0x44444444,0x44424444,0x44442444,0x44444444,0x44422244,0x44222224,0x44444424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x22444444,0x42444444
-	.word 0x44444444,0x44444244,0x44444244,0x44444244,0x44444244,0x44444222,0x24444244,0x24444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444222,0x44442442,0x44442222
-	.word 0x44444444,0x44244444,0x44224444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222244,0x44244244,0x44244444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444244,0x44444244,0x44442244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442222,0x44442442,0x44422222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x22444444,0x44444444,0x22244444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424442,0x44224442,0x22244444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424444,0x44224444,0x22244442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x22244444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444424,0x42444424,0x22244222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444444,0x42444444,0x22244444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424444,0x44424444,0x42224444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444424,0x44444224,0x44222244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x42444444,0x42444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444244,0x24444244,0x44442222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444442,0x44442222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x42244444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44222244,0x44244244,0x42222244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42244444,0x22224444,0x22224444,0x22422444,0x22224444,0x44444444,0x44422444,0x44442244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222444,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444244,0x44422224,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24442222,0x44442442
-	.word 0x44444444,0x44444444,0x44444444,0x24444444,0x44444444,0x44444442,0x22444222,0x24444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22244444,0x44224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22244442,0x42444422
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444222,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42224444,0x24422444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22244444,0x44424444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44424444,0x42222444,0x44424444
-	.word 0x44444444,0x44444444,0x24444444,0x22444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x44444444,0x44444444,0x44444444,0x44244444,0x44244444,0x44444444,0x22224444,0x24424444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222224,0x42244244
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42222444,0x22442244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44422444,0x44424444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42244442,0x22444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444422,0x44444424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x22444444,0x22224444,0x22222444,0x22222244
-	.word 0x22444444,0x22222244,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x44444422,0x44222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444422,0x44444222,0x44442222,0x44422222,0x44422222
-	.word 0x44444244,0x44444244,0x44444424,0x44444424,0x44444422,0x44444442,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444244,0x44222444,0x44244444,0x44422244,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x44444244,0x44444244,0x44422244,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44442444,0x44442222,0x44442442,0x44422222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444442,0x24444442,0x24444442,0x22444222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424444,0x44424444,0x44224444,0x22244442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444424,0x42444424,0x42444422,0x42244442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x44444244,0x44444244,0x44442244,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222444,0x44442444,0x44422444,0x22224444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424444,0x22244444,0x24444444,0x42224444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424444,0x44424444,0x44424444,0x42224444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x24444444,0x24444444,0x24444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444444,0x22224444,0x24424444,0x22224442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444244,0x42444244,0x42244244,0x44222244,0x44444244,0x44444244,0x44444244,0x44444224
-	.word 0x24444244,0x24444244,0x22442244,0x42222444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424444,0x44424444,0x44424444,0x22224444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444442,0x42444442,0x42444442,0x22244422,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x24444444,0x22444444,0x22244444,0x22244444,0x22224444
-	.word 0x22222224,0x22222222,0x22222222,0x44222222,0x44422222,0x44444222,0x44444422,0x44444442
-	.word 0x22222222,0x22222222,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x22222222,0x22244444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222244,0x22222444,0x22224444
-	.word 0x24222222,0x24222222,0x22222222,0x22222222,0x42222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42244224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24442244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22244444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24442222
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444444,0x44444444,0x22444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444424,0x44444424,0x44444424,0x44444424,0x24444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22224444,0x22222444,0x22222444,0x22222444,0x42222444,0x42222444,0x42222444
-	.word 0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x11111444,0x11111144
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444411
-
-	.word 0x22244444,0x22244444,0x22444444,0x22444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44244244,0x44242444,0x44422444,0x44424444,0x44424444,0x44444444,0x44444444,0x44444444
-	.word 0x42244224,0x42444424,0x42444424,0x42244224,0x44222244,0x44444444,0x44444444,0x44444444
-
-	.word 0x24442444,0x24442444,0x24442444,0x24442444,0x22222444,0x44444444,0x44444444,0x44444444
-	.word 0x44424444,0x44424444,0x22244444,0x24444444,0x42224442,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442442,0x44442444,0x44442222,0x44442442,0x24422222,0x44444444,0x44444444,0x44444444
-	.word 0x42244442,0x44244442,0x44244442,0x44244442,0x22444422,0x44444444,0x44444444,0x44444444
-	.word 0x22444424,0x22444424,0x42444424,0x22444424,0x24444222,0x44444444,0x44444444,0x44444444
-	.word 0x24444244,0x24444222,0x24444444,0x24444444,0x22444222,0x44444444,0x44444444,0x44444444
-	.word 0x44444242,0x44444444,0x44444444,0x44444444,0x44444442,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x22224444,0x22224444,0x22224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111114,0x11111114,0x11111114,0x11111114,0x11111144,0x11111144,0x11111444,0x11111444
-	.word 0x44444111,0x44441111,0x44441111,0x44441111,0x44441111,0x44441111,0x44444411,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x24444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444442,0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44424444,0x44422444,0x44422444,0x44422244,0x44422244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x22244444,0x22444444,0x22444444,0x24444444,0x24444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444442,0x44444422,0x44444222,0x44442222,0x44422222,0x44222222,0x42222224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x24444444,0x24444444,0x22444444,0x22244444,0x22244444,0x22222444,0x22222444,0x22222244
-	.word 0x42222222,0x42222222,0x42222222,0x44222222,0x44222222,0x44222222,0x44422222,0x44442222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x22444444
-	.word 0x44422244,0x44422244,0x44422224,0x44422224,0x44222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444422,0x44444222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222244,0x22222444,0x22222444,0x22244444,0x24444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444422,0x22222222,0x22222222,0x22222222,0x22222224,0x44444444,0x44444444
-	.word 0x44444444,0x22444444,0x22222222,0x22222222,0x22222222,0x22222222,0x44444444,0x44444444
-	.word 0x22222224,0x22222222,0x22222222,0x44222222,0x44442222,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x42222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244222,0x44242244,0x44242444,0x44224444,0x44224444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x22224444,0x44224444,0x44424444,0x44424444,0x44424444,0x44424444,0x44424444
-
-	.word 0x22222222,0x22222222,0x22222244,0x22222444,0x22224444,0x22244441,0x22244411,0x22244411
-	.word 0x44442222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44244444,0x44244444,0x44244444,0x42224444,0x42222444,0x24242444,0x24442444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444
-	.word 0x24444444,0x24444444,0x24444444,0x44444444,0x44442444,0x44444224,0x44444422,0x44444442
-
-	.word 0x44444444,0x44444442,0x44444422,0x44442222,0x22222222,0x42222222,0x44222222,0x44422224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44224444,0x44244444,0x42244444,0x22444444,0x22444444,0x42244444,0x44224444,0x44422444
-	.word 0x22244444,0x22244444,0x22224444,0x22222444,0x22222222,0x22222244,0x44444444,0x44444444
-	.word 0x44442222,0x44442222,0x44442222,0x44422222,0x44222222,0x42222244,0x22224444,0x22444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442
-	.word 0x22224444,0x44442444,0x44444244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444442,0x44444424,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22444444,0x42444444,0x42244444,0x44244444,0x44244444,0x44244444,0x44224444,0x44422444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442224,0x44442224,0x44442224,0x44444224,0x44444224,0x44444424,0x44444424,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x43444244,0x44444244,0x44444244,0x44444244,0x22222244,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444224,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44442244,0x44444224,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444422,0x44444424,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x44222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x42222244,0x44444222,0x44444444,0x44444444,0x44444444
-	.word 0x44444224,0x44444422,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444434,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
+	.word 0x003BA010,0xF0000032,0x44019001,0x22018044,0x4422220D,0x70070042,0x1EC03403,0x2FA0227F
+	.word 0x1FF001C0,0x15F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF001,0xF01FF01F,0xF001F01F,0x01F0FF1F
+	.word 0x01F01FF0,0x1FF01FF0,0x1FF015F0,0xF0FF01F0,0xF001F01F,0xF01FF01F,0xF01FF01F,0xFF1FF001
+	.word 0x1FF001F0,0x1FF001F0,0x15F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF001,0xF01FF01F,0x8001F01F
+	.word 0x0500BF1F,0xB303B024,0xF003F06F,0x20012001,0x1FF0FF3D,0x16F022E0,0x1B008B40,0x19F00310
+	.word 0x10FD0130,0xF0CCF05A,0x5018F080,0x223D101F,0xB0EF20F0,0x6062F041,0x3C00249F,0x01F04420
+	.word 0x221F1F10,0x03104222,0x7F6019F0,0x3FF04210,0xF03FB0FF,0xF001F018,0xF0648001,0xF25F6013
+	.word 0x21C0FF0F,0x01F00330,0x1EF01D70,0x01F001F0,0x10FF9920,0x901DF103,0xF11D0061,0xF040F03F
+
+	.word 0xDF01F001,0x190101F0,0xF0031022,0x117D4019,0xFCE0F01C,0xDD119D90,0x3FF01FF0,0x89B001F0
+	.word 0xD3FE4344,0xF07FF373,0x23034003,0x22892224,0x247F424E,0x0130D500,0x6030DF20,0x36A003C0
+	.word 0x419F0B30,0x304224EC,0x10F83203,0xC0E6F303,0x4D10FFBC,0xCE32AA21,0x01308310,0x5A300D30
+	.word 0x40E76C33,0x40F7D303,0x1042228A,0x11B85003,0x3510FF5C,0x03F0A270,0x63F34423,0x1B207B63
+	.word 0x70FF63F3,0x304020BB,0x500861BF,0xF0F7F0CE,0xFF6D4001,0x41216320,0xB1B04710,0x83F00342
+	.word 0x46420140,0x80FB20FF,0x2092617D,0x5054103E,0x540B001B,0xD9F0F91B,0x73405B61,0x51E00702
+	.word 0x9C014442,0x9E01447F,0x03F00385,0x60A26F80,0x03405210,0x555EE4FF,0x406F5093,0xF087223E
+	.word 0xF01F8103,0x0360FF18,0x03F06343,0x00520340,0x7B530390,0xF0FE7FF3,0xF31EF301,0x7003F07F
+
+	.word 0xD0B2F003,0x247F4203,0x33319000,0x03230BB3,0x03B0D4F0,0x67FFCFB1,0x50A96216,0x71F3F008
+	.word 0x91976193,0xFFABF0ED,0x492003F0,0x21D015F0,0xFFA601F0,0xF851B3E0,0xF02420FF,0xF03FD03A
+	.word 0x71BD9101,0x94D89067,0x01F0FF77,0xEFD22F81,0x8F538B53,0x26A30510,0x60FF0CE0,0x544245D7
+	.word 0x40BE56F6,0x829FB147,0xFF7FF003,0x03400725,0x60F272F1,0x1FF157F2,0x2DC0E485,0xC153F0FF
+	.word 0xB296F2DE,0x8116F34E,0xE17AF160,0x03F0FFC1,0x03F07FF3,0x01F07F83,0x01F001F0,0xF0FF7D70
+	.word 0xF0209001,0xF001F060,0xF23E7001,0xFF5EF0C2,0x21F001F0,0x011001F0,0x3DD023F3,0x3FF083F1
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF021E07E,0x20C0FF7F,0x5F9012F0,0x01C013F0,0x7DA0E2F1
+	.word 0xB0FF7FF0,0xF060F03D,0xF001F001,0xF001F07D,0xFF01F05F,0x20F00100,0x60F11C90,0x01F001F0
+
+	.word 0x73F37D60,0xF07FF3F0,0x40038003,0x11111401,0x0350CF11,0x444466F0,0x01601600,0x1FF01DF0
+	.word 0xF01FF0FF,0xF01FF01F,0xF01FF01F,0xF01FF01F,0x1FF0FF01,0x1FF01FF0,0x1FF01FF0,0x1DF01FF0
+	.word 0xF0FF1FF0,0xF01FF01F,0xF01FF01F,0xF01FF01F,0xFF01F01F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0
+	.word 0x1FF01DF0,0x111FF0BF,0x1DF00360,0x01F001F0,0x01F001F0,0xF001F0FF,0xF301D001,0xF07FF373
+	.word 0x177FA303,0x1BF0FF07,0x0140C0FC,0x950A3114,0x22809BF4,0xA0FF8370,0x595120A8,0x6060F0C0
+	.word 0xF0B64B2A,0x773F301F,0xF0431022,0x24686080,0x301B9E10,0x60FF4090,0x81A31E0B,0x375DE019
+	.word 0x101ED074,0xFD405017,0x3CF0CE4C,0x029E8270,0xF44853C1,0xFFC44024,0x7D2001E0,0x4EB0ED4B
+	.word 0x3DF0DFF1,0xA0F12A10,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0
+
+	.word 0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF1011001,0xF07FF393,0xFFF0FA03,0x011059F0
+	.word 0x66F9CA51,0x87402270,0x5A2041F0,0x5B0110FF,0x5001F0A8,0xF093337C,0xF0CB8001,0x1930FF1F
+	.word 0xA60E4B23,0x60701FF0,0x1ED069FB,0x70FFC7F9,0xF0103C7D,0xF240B01C,0x231D30EC,0xFF3EF067
+	.word 0x1FF040B0,0x855081A0,0xA0F101F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01C001F0,0x5EFF5711,0x51B20EFB,0xF0162089,0xF301F02D
+	.word 0xFF7FF373,0xFDF503F0,0x9EF656D0,0x22960160,0x012001F0,0xF2CD20FF,0x42112091,0xF04110ED
+	.word 0xF180A021,0x8270FF00,0x81F0D222,0xDFF07F50,0xA1F021F0,0xF0FF7FC0,0xF17D5040,0x40A4F600
+	.word 0x6722C003,0xFFA45644,0x01F001F0,0x3E309DF0,0x2070A0F0,0x40F1F614,0xF11F60FF,0x11019020
+
+	.word 0x7081F21C,0xF0E85001,0x01F0FF01,0xEB4236C0,0x7B3D0300,0x01F00720,0xF0FF01F0,0x30404001
+	.word 0xCD01F04A,0x632B20DB,0xFF1E016D,0x9951E688,0x1DF1B458,0x013001F0,0x7FF373F3,0xA003F0FF
+	.word 0x151A2603,0xB771F043,0x201FF023,0x82F5FF36,0xE9113E90,0x544A0320,0x03F721F0,0x36FF5E90
+	.word 0x120300DF,0xA03EF013,0x5A5EF042,0xFFC4F628,0x00F14080,0x00F160F0,0x6FF3A270,0x2C531FB0
+	.word 0xD07FF0FF,0x5014F069,0x803E4001,0x3A42438E,0x6B13FFC7,0x40F01324,0x7FE0BF80,0x03508112
+	.word 0xF0FF4010,0xF001F03F,0x42016001,0x3C4710C2,0xFF7E0163,0xF7220EA3,0x9130D843,0x019028F3
+	.word 0xA3511E70,0xE31FF0FE,0x24031073,0x100E20A0,0x42869082,0xF12B90FF,0xF001F030,0xF0F2D001
+	.word 0xF07FF303,0xF0F1FF03,0x5FF559C0,0x35F101B0,0x2FF11FC0,0xF0FF61C0,0xF001F040,0xE07E7001
+
+	.word 0xA0B1CD5F,0xFF1DD15F,0x01F0A44E,0xD1F35F50,0x1DF101A0,0x01F001F0,0xF001F0FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0xBB590170,0x4A1503A0,0xF2F00320,0xF001F066
+	.word 0x14010001,0x7F441111,0xF0030011,0x30016019,0x57EB531C,0xFFE6B15B,0x01B09DF3,0x1EF312F3
+	.word 0x019001F0,0x7FF373F3,0x7003F0EF,0x24230003,0x75F00310,0x83035D20,0x238356EF,0x2473D38F
+	.word 0x20D001D0,0xFD3464B7,0xF001F0FF,0x403D4001,0xA36387C6,0x36273933,0x0636DF02,0x402273E3
+	.word 0xB3A25703,0x51294273,0xA3D7FF30,0xCDC04022,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xF001F001,0xF0B8F001,0xFF01F001,0x01E001F0,0x03606B83,0xA0F59353,0x660301E0,0x0390117D
+	.word 0x03107323,0x10107F13,0xFF670341,0x03E06803,0x99E04AF0,0x72F39D20,0x03807FF3,0xF001F0FF
+
+	.word 0xF066F001,0xF07FF303,0xF070F003,0x01F0FF01,0x01F001F0,0x01D001F0,0x01F07AF0,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x23ED8BFF,0xF065F106,0xF001F001,0x7001F001,0x7FF6FF01,0x91500340,0x7BBD1A6C,0xA0F02A27
+	.word 0xF0FF01F0,0x4080C001,0x57F77A03,0x506F7A87,0xFF2B5E03,0x4CF08340,0x01F001F0,0x03F07EF0
+	.word 0x03F07FF3,0xF004F3FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x733201C0,0x7A566743
+	.word 0x0B7D5F42,0x012037F0,0xF00F53FF,0xF001F001,0xF001F001,0x8A685001,0xC3FDFF97,0xB3809B73
+	.word 0x45F0B416,0x185001B0,0xC0FF5FFE,0xF0D81E38,0x4001F095,0x6012F02E,0xFF6A1001,0x67434AF0
+
+	.word 0x65199629,0x8A944B1A,0x7FF373F3,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xE001F001,0xF8B31201
+	.word 0x0B003526,0x7882C0F1,0x2222E342,0x0800BF41,0x76034011,0xF203F06F,0x4001F04E,0x0380FF83
+	.word 0x6802EC53,0x2CF00110,0x01F001F0,0xF0FF01F0,0x3078D001,0x512A4D6B,0x7301100D,0xFFA863C3
+	.word 0x0A2BEB26,0x11F001C0,0x01F001F0,0x01F001F0,0x6001F0FF,0xF303F070,0xF001F07F,0xF001F001
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0xB22E01E0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x016001F0,0x6662D269,0x12208162,0x33FF59FF,0x508B637F,0x59898D3D
+	.word 0x207833F7,0xEFF5FF23,0x5E310180,0x0C605710,0x1A4001F0,0xF0FF88F3,0x6001F001,0x50385BE0
+
+	.word 0xF0E670EB,0xFF01A001,0x0320FD50,0x01F045C0,0x01F001F0,0x01F001F0,0xF001F0F7,0x33014001
+	.word 0x73A34367,0x01A0DFF7,0xF0B7F8FF,0xF015F01F,0xF001F01F,0xB001F01F,0x82F1FF1F,0x1FF03FF0
+	.word 0x1FF01FF0,0x1FF001F0,0xF0FF01F0,0xF001F01F,0xF01FF01F,0x301FF015,0xFF03F10C,0x1FF03FF0
+	.word 0x1FF015F0,0xABE25E40,0x1FF03FF0,0xF015F0FF,0x0901C01E,0xC09706A4,0xF0CBD6CB,0x01F0FF01
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xB0B001F0,0x12F03401,0x000001A0
 
 	.section .rodata
 	.align	2
@@ -6,8 +6,8 @@
 //	old_poster_italian_flattened, 3816x8@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 477 tiles not compressed
-//	Total size: 512 + 15264 = 15776
+//	+ 477 tiles lz77 compressed, 15264 bytes raw
+//	Total size: 512 + 2392 = 2904
 //
 //	Time-stamp: 2021-07-21, 18:52:09
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_OLD_POSTER_ITALIAN_FLATTENED_H
 #define GRIT_OLD_POSTER_ITALIAN_FLATTENED_H
 
-#define old_poster_italian_flattenedTilesLen 15264
-extern const unsigned int old_poster_italian_flattenedTiles[3816];
+#define old_poster_italian_flattenedTilesLen 2392
+extern const unsigned int old_poster_italian_flattenedTiles[598];
 
 #define old_poster_italian_flattenedPalLen 512
 extern const unsigned short old_poster_italian_flattenedPal[256];
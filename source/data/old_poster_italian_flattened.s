@@ -6,8 +6,8 @@
 @	old_poster_italian_flattened, 3816x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 477 tiles not compressed
-@	Total size: 512 + 15264 = 15776
+@	+ 477 tiles lz77 compressed, 15264 bytes raw
+@	Total size: 512 + 2392 = 2904
 @
 @	Time-stamp: 2021-07-21, 18:52:09
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,545 +17,93 @@
 
 	.section .rodata
 	.align	2
-	.global old_poster_italian_flattenedTiles		@ 15264 unsigned chars
+	.global old_poster_italian_flattenedTiles		@ 2392 unsigned chars
 	.hidden old_poster_italian_flattenedTiles
 old_poster_italian_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x22222244,0x44444244,0x44444244,0x44444244,0x34444244
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44222222,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444424,0x44444224,0x44442224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44422244,0x44422244,0x44422244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44422244,0x44422244,0x44422244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222444,0x22222444,0x22222444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222244,0x22222244,0x22222244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22244442,0x22244442,0x22244442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x22222222,0x22222222
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444422,0x44444422,0x44444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x24444444,0x24444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444222,0x44442222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44244444,0x42244444,0x42244444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222444,0x44222444,0x44222444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222444,0x44222444,0x44222444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222244,0x22222244,0x22222244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444222,0x44422222,0x44222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44442444,0x44422444,0x44422444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244443,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44422224,0x44222224,0x42222224,0x22222224,0x22222224,0x22242224,0x22442224,0x24442224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444422,0x44444222,0x44422222
-	.word 0x44422244,0x44422244,0x44422244,0x44422244,0x44422244,0x44422244,0x44422244,0x44422244
-	.word 0x44422244,0x44422244,0x44422244,0x44422244,0x44422244,0x44422244,0x44422244,0x44422244
-	.word 0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x22222444,0x22222444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x22222222
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222
-	.word 0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444422,0x44444422
-	.word 0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x22222222
-	.word 0x44442222,0x44422224,0x44422244,0x44422244,0x44422244,0x44422224,0x44442222,0x44442222
-
-	.word 0x42224444,0x22224444,0x22222444,0x22222444,0x22222244,0x22422244,0x24422224,0x24442224
-	.word 0x44444444,0x44444444,0x44444444,0x44444442,0x44444442,0x44444422,0x44444422,0x44444222
-	.word 0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444
-	.word 0x44422244,0x44422244,0x44422244,0x44422244,0x44422244,0x44422244,0x44422244,0x22222244
-	.word 0x44222244,0x42222444,0x42224444,0x42224444,0x42224444,0x42224444,0x44222244,0x44222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x24444444
-
-	.word 0x44422244,0x44222244,0x44222224,0x42222224,0x42222222,0x22224222,0x22244222,0x22244422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444224
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44442224,0x44442224,0x44442224,0x44442224,0x44442224,0x44442224,0x44442224,0x44442224
-	.word 0x44222222,0x42222224,0x22222444,0x22224444,0x22244444,0x22444444,0x24444444,0x44444444
-
-	.word 0x44422244,0x44422244,0x44422244,0x44422242,0x44422222,0x44422222,0x44422222,0x44422222
-	.word 0x44422244,0x44422244,0x44422244,0x44422244,0x44422244,0x44422244,0x44422244,0x44422244
-	.word 0x22222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444
-	.word 0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222,0x44444222
-	.word 0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444
-	.word 0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x22222222,0x22222222,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422
-	.word 0x44444222,0x44444442,0x24444444,0x24444444,0x22444444,0x22444444,0x22444444,0x22244444
-	.word 0x44442222,0x44444222,0x44444222,0x22222222,0x22222222,0x22222222,0x44444442,0x44444442
-	.word 0x44444222,0x44442222,0x44442224,0x44422222,0x44422222,0x44222222,0x44222444,0x42222444
-	.word 0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x42222444,0x22224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222444,0x44222244,0x44422224
-	.word 0x22222244,0x22222244,0x22422244,0x24422244,0x44422244,0x44422244,0x44422244,0x44422244
-	.word 0x44422222,0x44444222,0x44444422,0x44444422,0x44444222,0x44442224,0x44422244,0x44222244
-	.word 0x22444444,0x22444444,0x22244444,0x22244444,0x22224444,0x22224444,0x42224444,0x42222444
-	.word 0x22444422,0x22444442,0x24444442,0x22222222,0x22222222,0x22222222,0x44444444,0x44444444
-	.word 0x44444442,0x44444422,0x44444422,0x44444222,0x44444222,0x44442222,0x44442224,0x44422224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444224,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44442224,0x44442224,0x44442224,0x44442224,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44422224,0x44422244,0x44422444,0x44424444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44422244,0x44422244,0x44422244,0x44422244,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44222444,0x22222444,0x22222444,0x22222444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x22222222,0x22222222,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444222,0x44444222,0x44444222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x22244444,0x22244444,0x22244444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x22222222,0x22222222,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444422,0x44444422,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444444,0x24444444,0x24444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444422,0x44444422,0x44444422,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x22224444,0x42224444,0x42222444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42222444,0x22224444,0x22224444,0x22244444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22244444,0x22444444,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x22222222,0x22222222,0x22222224,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44422222,0x44442222,0x44444222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44422244,0x44422244,0x44422244,0x44422244,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42222444,0x22224444,0x22244444,0x22444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44222444,0x44222244,0x44422242,0x44422222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44422224,0x44222244,0x44222244,0x42222444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x11111114,0x11111114,0x11111114,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x41111111,0x41111111,0x41111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x24444444,0x22444444,0x24444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x42444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444422,0x44444424,0x44444424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x24444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444222,0x44444442,0x44444442
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44442222,0x44442442,0x44442444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222444,0x44244244,0x44424444
-	.word 0x44444444,0x44444444,0x44424444,0x44444444,0x44444444,0x44422444,0x44424444,0x44424444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22224444,0x24422444,0x44442444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x24444442,0x24444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44442222,0x44442444,0x44442444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44422244,0x44244224,0x44222224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x42444444,0x42444444,0x42444444,0x42444444,0x42222444,0x42442244,0x42444244
-	.word 0x44444444,0x44444444,0x42444444,0x44444444,0x44444444,0x42244444,0x42444444,0x42444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x24444444,0x24444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22444444,0x42444444,0x22444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444422,0x44444424,0x44444222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444244,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444442,0x44444222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442222,0x44442442,0x44422222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44422444,0x42442444,0x42222244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424444,0x44424444,0x44222444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442444,0x24422444,0x22224444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x24444442,0x24444442,0x22444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442444,0x44442444,0x44422444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444424,0x44444224,0x44222244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444244,0x42444244,0x22222444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444444,0x42444444,0x22244444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42244444,0x22224444,0x22224444,0x22422444,0x22224444,0x44444444,0x44422444,0x44442244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x24444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444222,0x44444444,0x44444444,0x44444222
-	.word 0x44444444,0x44444424,0x44444444,0x44444444,0x44444422,0x44444424,0x44444424,0x44444424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44422224,0x44424422,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x42444224,0x42444244,0x42444244,0x42444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x24224444,0x42244444,0x44244444,0x44244444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22444442,0x42244442,0x22244444,0x44244444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444424,0x44444422,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44442224,0x44442442,0x44444244,0x44444224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44222444,0x44244244,0x44424444,0x44422444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x42222444,0x42442444,0x42444444,0x42222444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x42444444,0x44444444,0x44444444,0x22244444,0x22224444,0x44424444,0x44424444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x22444444,0x22224444,0x22222444,0x22222244
-	.word 0x22444444,0x22222244,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x44444422,0x44222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444422,0x44444222,0x44442222,0x44422222,0x44422222
-	.word 0x44444244,0x44444244,0x44444424,0x44444424,0x44444422,0x44444442,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444424,0x44444222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444422,0x44442224,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444244,0x22222244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x42224444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42244444,0x22444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424424,0x44422222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42442444,0x42222244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x42442444,0x22222444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44224444,0x22244444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x24444444,0x22444444,0x22244444,0x22244444,0x22224444
-	.word 0x22222224,0x22222222,0x22222222,0x44222222,0x44422222,0x44444222,0x44444422,0x44444442
-	.word 0x22222222,0x22222222,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x22222222,0x22244444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222244,0x22222444,0x22224444
-	.word 0x24222222,0x24222222,0x22222222,0x22222222,0x42222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444444,0x44444444,0x44444444,0x24444422,0x44444424,0x44444424,0x44444424,0x44444424
-	.word 0x44444444,0x44444444,0x44444444,0x44424442,0x44424442,0x44424442,0x44424442,0x44424442
-	.word 0x44442444,0x44444444,0x44444444,0x44442244,0x44442444,0x44442444,0x44442444,0x44442444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44222224,0x42244244,0x42444244,0x42444244,0x42244244
-
-	.word 0x44444444,0x44444444,0x44444444,0x22244444,0x44224444,0x22224444,0x44424444,0x44224444
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x24444442,0x24444442,0x24444444,0x24444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444224,0x44444242,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x22444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x44444444,0x44444444,0x44444444,0x24444422,0x22444444,0x22444444,0x42444444,0x22444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444422,0x44444244,0x44444222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22224444,0x22222444,0x22222444,0x22222444,0x42222444,0x42222444,0x42222444
-	.word 0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x11111444,0x11111144
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444411
-
-	.word 0x22244444,0x22244444,0x22444444,0x22444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x22444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444422,0x44444424,0x44444424,0x44444424,0x44444242,0x44444444,0x44444444,0x44444444
-
-	.word 0x44222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44422244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44222244,0x44444244,0x44444244,0x44444244,0x44444224,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x24444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x22224444,0x22224444,0x22224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111114,0x11111114,0x11111114,0x11111114,0x11111144,0x11111144,0x11111444,0x11111444
-	.word 0x44444111,0x44441111,0x44441111,0x44441111,0x44441111,0x44441111,0x44444411,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x24444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444442,0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44424444,0x44422444,0x44422444,0x44422244,0x44422244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x22244444,0x22444444,0x22444444,0x24444444,0x24444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444442,0x44444422,0x44444222,0x44442222,0x44422222,0x44222222,0x42222224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x24444444,0x24444444,0x22444444,0x22244444,0x22244444,0x22222444,0x22222444,0x22222244
-	.word 0x42222222,0x42222222,0x42222222,0x44222222,0x44222222,0x44222222,0x44422222,0x44442222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x22444444
-	.word 0x44422244,0x44422244,0x44422224,0x44422224,0x44222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444422,0x44444222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222244,0x22222444,0x22222444,0x22244444,0x24444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444422,0x22222222,0x22222222,0x22222222,0x22222224,0x44444444,0x44444444
-	.word 0x44444444,0x22444444,0x22222222,0x22222222,0x22222222,0x22222222,0x44444444,0x44444444
-	.word 0x22222224,0x22222222,0x22222222,0x44222222,0x44442222,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x42222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244222,0x44242244,0x44242444,0x44224444,0x44224444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x22224444,0x44224444,0x44424444,0x44424444,0x44424444,0x44424444,0x44424444
-
-	.word 0x22222222,0x22222222,0x22222244,0x22222444,0x22224444,0x22244441,0x22244411,0x22244411
-	.word 0x44442222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44244444,0x44244444,0x44244444,0x42224444,0x42222444,0x24242444,0x24442444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444
-	.word 0x24444444,0x24444444,0x24444444,0x44444444,0x44442444,0x44444224,0x44444422,0x44444442
-
-	.word 0x44444444,0x44444442,0x44444422,0x44442222,0x22222222,0x42222222,0x44222222,0x44422224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44224444,0x44244444,0x42244444,0x22444444,0x22444444,0x42244444,0x44224444,0x44422444
-	.word 0x22244444,0x22244444,0x22224444,0x22222444,0x22222222,0x22222244,0x44444444,0x44444444
-	.word 0x44442222,0x44442222,0x44442222,0x44422222,0x44222222,0x42222244,0x22224444,0x22444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442
-	.word 0x22224444,0x44442444,0x44444244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444442,0x44444424,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22444444,0x42444444,0x42244444,0x44244444,0x44244444,0x44244444,0x44224444,0x44422444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442224,0x44442224,0x44442224,0x44444224,0x44444224,0x44444424,0x44444424,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x43444244,0x44444244,0x44444244,0x44444244,0x22222244,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444224,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44442244,0x44444224,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444422,0x44444424,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x44222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x42222244,0x44444222,0x44444444,0x44444444,0x44444444
-	.word 0x44444224,0x44444422,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444434,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
+	.word 0x003BA010,0xF0000032,0x44019001,0x22018044,0x4422220D,0x70070042,0x1EC03403,0x2FA0227F
+	.word 0x1FF001C0,0x15F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF001,0xF01FF01F,0xF001F01F,0x01F0FF1F
+	.word 0x01F01FF0,0x1FF01FF0,0x1FF015F0,0xF0FF01F0,0xF001F01F,0xF01FF01F,0xF01FF01F,0xFF1FF001
+	.word 0x1FF001F0,0x1FF001F0,0x15F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF001,0xF01FF01F,0x8001F01F
+	.word 0x0500BF1F,0xB303B024,0xF003F06F,0x00393001,0xF0247F1B,0xF001F06D,0x00880001,0xF003503C
+	.word 0x1FF0FF01,0xC80080E0,0x1DF00350,0x01500721,0x30FB1DF0,0xF0036020,0xC03FF01D,0x78004201
+	.word 0xF0FF0350,0xE03FF01D,0xF003801F,0x91012001,0xFF3FF0A4,0x9FC05FF0,0x1DF03E41,0xC1115E90
+	.word 0x01F060F1,0x1001F0FF,0xF00350F6,0xF001F001,0x903FF03F,0x9FF1EF01,0xDB201EB0,0xF01EF042
+
+	.word 0x2001F001,0x0310FE7F,0x01F0FEF0,0x01F001F0,0x6CD001F0,0x73D3FD43,0x03F07FF3,0x65320340
+	.word 0x0042EA22,0x30226F03,0x44011003,0x1FE20310,0x0310FB21,0xA32341FF,0xF003F04B,0x9103D003
+	.word 0xF303B0AB,0x0180FF7F,0x01F09FF2,0x72F02720,0x78F0FEC3,0xF0FF40F2,0xC07FF001,0xB103401F
+	.word 0x9303F08C,0xFF03E0AB,0xA3116140,0x0F10B490,0x7D301710,0x2F518943,0x42D722A7,0x2442BB01
+	.word 0xF651BFD1,0x10FF5F60,0xF0F2F00C,0x7001F0FE,0xB033F001,0xFF74F103,0xAF200380,0x0310E0F0
+	.word 0x79E09EF3,0xFEB00320,0x3300425F,0x30053042,0xB136F011,0xFF01F00F,0x01F001F0,0x3F328040
+	.word 0x7FF303F0,0x7F6303F0,0xA103F0FF,0x33D7403E,0x002C310B,0xA1685739,0xF800FF32,0x0370B744
+	.word 0x7FE373F1,0x03F02631,0xF2FF0320,0xF001F0E3,0xF0017001,0xF07FF372,0xFF048403,0x5FB07FF0
+
+	.word 0x01D012F0,0x7F9394F1,0x03F0C883,0x42A330FF,0x80335027,0xA23E101E,0x630160CE,0x2747FF6B
+	.word 0x9751CB31,0xE237DE60,0x135303F0,0xE0FFDEF0,0x403BF0DD,0x6442506C,0x43030013,0xFF66932F
+	.word 0x0A100300,0x6132EF80,0xEB607E60,0x03305860,0x808824FF,0x814B71FE,0x916FD4B3,0xF09F200F
+	.word 0xDEB0FF01,0x21D022F0,0x7FF303F0,0x7FF303F0,0xF0FF2DF4,0x607DF001,0xC05450FD,0xD0F0F201
+	.word 0xFFEB7640,0x4230EFF6,0x01F057F1,0x7EF001F0,0x80607EF0,0xF001F1FF,0x407FF07F,0xF003801F
+	.word 0xF094E101,0x3FF0FF3B,0x6F729FC0,0x01F01FF0,0x71423EC0,0xD0FF3B65,0xF0536581,0x40BF425C
+	.word 0xD0ED33FB,0xFF8B473D,0x20403CF0,0x9FF080F1,0x1FD0D7A5,0xDB551E20,0xF040F0FF,0x605EF001
+	.word 0xF040F0FE,0xF001F001,0x5E60FC01,0x7FF3DEF1,0x038003F0,0x11140140,0x50111133,0x4466F003
+
+	.word 0x60160044,0x1DF0FF01,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0xF0FF1FF0,0xF001F01F,0xF01FF01F
+	.word 0xF01FF01F,0xFF1FF01F,0x1FF01DF0,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0xF01FF0FF,0xF01FF001
+	.word 0xF01FF01F,0xF01FF01F,0x1DF0FE1F,0x1FF01FF0,0x1FF01FF0,0x1F801FF0,0x0350FF41,0x01F01DF0
+	.word 0x01F001F0,0x73F30130,0xF0FF7FF3,0x587FC303,0xF040F0D7,0x10011070,0xFF4BF42B,0x3CF01C80
+	.word 0x22F0B8F0,0xE9053F40,0x013015F0,0xF75359FF,0x003F806D,0xF0E90880,0x5079605D,0x4190FB20
+	.word 0xCB670B80,0x616061F0,0xF0400024,0x2060FF5F,0x21F01148,0xFDF09F40,0x5E203DB0,0xF0FF6EF6
+	.word 0xB1013001,0x00202ED5,0xB0011007,0xFF014023,0x01F0E0F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x015001F0,0x7FF332F3,0x7D8103F0
+
+	.word 0xB0FF6BF3,0x4B6B2301,0x401CF0A2,0xF0D9F738,0xFF12F0A8,0x5CF03740,0xC79C0160,0x6B7301F0
+	.word 0x75509BF8,0xF80523FF,0xF961D0BC,0x13B5709A,0x500BFD0C,0x6753FF3D,0x3F601FF0,0x01F08740
+	.word 0x5EF01A70,0xF0FF01F0,0x30801001,0x80ACF301,0xF0E0F0A2,0xFF01F001,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF001F0FE,0xF001F001,0x1101B001,0x24A04A7D,0x314E2EFF,0xF0162027
+	.word 0xF301F02D,0xF07FF373,0xFDF4FF03,0x16F054F0,0x0B5007B3,0x44D72890,0x65FF58E0,0x207EF09A
+	.word 0x504F521F,0x1B81F001,0xFFF24273,0x653C61F0,0xF01B1F20,0x35401FF0,0x9F505AF1,0xF31A77FF
+	.word 0xF020F032,0x76BD271F,0xF021F087,0x9BB6FF01,0x21F10342,0x01F02CF0,0x01F001F0,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0x4D01C001,0xFFEB4FE3,0x07204F3E,0x01F001F0,0x404001F0,0x01F04A30
+
+	.word 0x5EAFCEFF,0x456D33E4,0x009D5492,0xF3175206,0x01F0FF1E,0x73F30170,0x03F07FF3,0x01F07FFA
+	.word 0xF4FF0120,0xF27DE006,0x23017065,0x9040F08F,0xFF08115F,0x61F021F0,0x1F3001F0,0x17F03D26
+	.word 0x01F083B0,0xF75D50FF,0xF020F01A,0xF61FA020,0xF001F07B,0x9D80FF01,0x019021F1,0x01F07CF0
+	.word 0x01F001F0,0xF0FF01F0,0xF001F001,0x6001F001,0x24C24201,0xFFE522FB,0x0EA31A01,0x5342F722
+	.word 0x28F3F637,0x1E700190,0xE22321FF,0x4371F3A7,0x209321D7,0x9082100E,0x90427F86,0xF05BF12B
+	.word 0xD001F001,0xF303F0F2,0x03F0FF7F,0x3B21D8F1,0x1CB043C0,0x01701DF0,0x26FFBAD6,0xF01CF7BE
+	.word 0xF001F040,0x3A2E1001,0xFF5E806C,0xF32180D6,0x3F466810,0x979DD5E1,0x181081E0,0xF0681BFF
+	.word 0xF01E3001,0x413FB0C1,0xF0E3453C,0x0C20FF80,0x5DF0A037,0x01F001F0,0x01F001F0,0xF0FF01F0
+
+	.word 0xF001F001,0xF001F001,0x59012001,0xFC03A0BB,0x0300FB37,0x01F066F2,0x010001F0,0x111F1114
+	.word 0x03001144,0x016019F0,0xEB531C30,0xA17761FF,0xB09DF39F,0xF312F301,0x9001F01E,0x73F3FF01
+	.word 0x03F07FF3,0x7AF46080,0xD0D00180,0xF4FF9FD2,0xF040D0B9,0xF001F0C5,0xA0608001,0xFFF2F9AF
+	.word 0x01903BF6,0x1FE0BEF7,0x60C001F0,0x9E8012F0,0xB01FF0FF,0xF060F01F,0xF001F001,0xF001F001
+	.word 0x01F0FF01,0x87F00170,0x01F001F0,0x01D001F0,0x60FB6B83,0xFE935303,0x0301E0D4,0x03901166
+	.word 0x10EF7323,0x107F1303,0x67034110,0x03E06803,0xE0FF4AF0,0xF39D2099,0x807FF372,0xF001F003
+	.word 0xFF66F001,0x7FF303F0,0x70F003F0,0x01F001F0,0x01F001F0,0xD001F0FF,0xF07AF001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+
+	.word 0x47DD5701,0xFFFCF364,0x01F001F0,0x01F001F0,0x7FF60180,0x91500340,0xBD0868FF,0xF02A277B
+	.word 0xF001F0A0,0x4080C001,0xF77AFF03,0x6F7A8757,0x2B5E0350,0x4CF08340,0xF0FF01F0,0xF07EF001
+	.word 0xF07FF303,0xF004F303,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF
+	.word 0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x733201C0,0x56FF6743
+	.word 0x7D5F427A,0x2037F00B,0xF00F5301,0xFF01F001,0x01F001F0,0x685001F0,0xC3FD978A,0xB3809B73
+	.word 0xF0B416FF,0x5001B045,0xC05FFE18,0xF0531C38,0x01F0FE95,0x12F02E40,0x6A100160,0x67434AF0
+	.word 0x00425F22,0x03002207,0x8A84A12D,0x7FF373F3,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xE001F001
+
+	.word 0xF1D32E01,0xC0F1D74E,0xE3427882,0x00412222,0x40117F08,0xF06F7603,0xF04EF203,0x80834001
+	.word 0xEC53FF03,0x01106802,0x01F02CF0,0x01F001F0,0xD0FF01F0,0x126B3078,0x50544CE2,0x63C373BD
+	.word 0xFFEB26A8,0x01C00A2B,0x01F011F0,0x01F001F0,0x01F001F0,0xF07060FF,0xF07FF303,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01E001F0,0x01F00BFE,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0xFF01F001,0x01B001F0,0x6662D269,0x12208162,0x7F33FF59,0x508B63FF,0x59898D3D
+	.word 0x207833F7,0x80EFF523,0x5E31FF01,0x0C605710,0x1A4001F0,0x01F088F3,0x60FF01F0,0x50385BE0
+	.word 0xF0E670EB,0x5001A001,0xFF0320FD,0x01F045C0,0x01F001F0,0x01F001F0,0x01F001F0,0x330140DF
+	.word 0x73A34367,0x01A0DFF7,0x1FF0B7F8,0xF015F0FF,0xF001F01F,0xB001F01F,0xF082F11F,0x1FF0FF3F
+
+	.word 0x1FF01FF0,0x1FF001F0,0x1FF001F0,0xF0FF01F0,0xF01FF01F,0x301FF015,0xF003F10C,0xFF1FF03F
+	.word 0x1FF015F0,0xABE25E40,0x1FF03FF0,0x1EF015F0,0x0901C0FF,0xC09706A4,0xF0CBD6CB,0xF001F001
+	.word 0x01F0FE01,0x01F001F0,0x01F001F0,0x01B001F0,0x12F0C034,0x000001A0
 
 	.section .rodata
 	.align	2
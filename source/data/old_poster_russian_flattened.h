@@ -6,8 +6,8 @@
 //	old_poster_russian_flattened, 3816x8@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 477 tiles not compressed
-//	Total size: 512 + 15264 = 15776
+//	+ 477 tiles lz77 compressed, 15264 bytes raw
+//	Total size: 512 + 2636 = 3148
 //
 //	Time-stamp: 2021-05-29, 09:05:30
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_OLD_POSTER_RUSSIAN_FLATTENED_H
 #define GRIT_OLD_POSTER_RUSSIAN_FLATTENED_H
 
-#define old_poster_russian_flattenedTilesLen 15264
-extern const unsigned int old_poster_russian_flattenedTiles[3816];
+#define old_poster_russian_flattenedTilesLen 2636
+extern const unsigned int old_poster_russian_flattenedTiles[659];
 
 #define old_poster_russian_flattenedPalLen 512
 extern const unsigned short old_poster_russian_flattenedPal[256];
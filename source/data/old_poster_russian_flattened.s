@@ -6,8 +6,8 @@
 @	old_poster_russian_flattened, 3816x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 477 tiles not compressed
-@	Total size: 512 + 15264 = 15776
+@	+ 477 tiles lz77 compressed, 15264 bytes raw
+@	Total size: 512 + 2636 = 3148
 @
 @	Time-stamp: 2021-05-29, 09:05:30
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,545 +17,102 @@
 
 	.section .rodata
 	.align	2
-	.global old_poster_russian_flattenedTiles		@ 15264 unsigned chars
+	.global old_poster_russian_flattenedTiles		@ 2636 unsigned chars
 	.hidden old_poster_russian_flattenedTiles
 old_poster_russian_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x22222244,0x44444244,0x44444244,0x44444244,0x34444244
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444222
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444222
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44222222,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222244,0x44222244,0x44222244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44422224,0x44422224,0x44422224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222444,0x22222444,0x22222444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44422222,0x44422222,0x44422222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22244444,0x22222244,0x22222224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42222444,0x42222444,0x42222444
-	.word 0x24442222,0x22222224,0x22222244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444222,0x44444422,0x44444444,0x44444444,0x22444444,0x22244444,0x22224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x22222444,0x22222244
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22224444,0x22222224,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44422222,0x44422222,0x44422222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244443,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44222244,0x44222244,0x44222244,0x44222244,0x44222244,0x44222244,0x44222244,0x22222244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222
-	.word 0x44422224,0x44422224,0x44422224,0x44422224,0x44422224,0x44422224,0x44422224,0x44422222
-	.word 0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x22222444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442222,0x44442222,0x44442222,0x44442222,0x44442222,0x44442222,0x44442222,0x44442222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x24444444,0x22444444,0x22244444,0x22244444,0x22224444,0x22224444,0x22224444
-	.word 0x44422222,0x44442222,0x44444222,0x44444422,0x44444442,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44442222,0x44442222,0x44422224,0x44222224,0x44222244,0x44222244,0x44222444
-	.word 0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x42222444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x22444444,0x22244444
-	.word 0x22222444,0x22222444,0x22222244,0x22222224,0x22222222,0x22224222,0x22224422,0x22224422
-	.word 0x44444444,0x44444444,0x24444444,0x22444444,0x22444444,0x22244444,0x22244444,0x22244444
-	.word 0x44222224,0x44422222,0x44444222,0x44444222,0x44444422,0x44444442,0x44444442,0x44444442
-	.word 0x22444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444422,0x24444422,0x22444444,0x22444444,0x22444444,0x22444444,0x22444444,0x24444444
-	.word 0x44442222,0x44444222,0x44444422,0x44444422,0x44444422,0x44444422,0x44444422,0x44444222
-	.word 0x44422224,0x44422224,0x44422224,0x44422224,0x44422224,0x44422224,0x44422224,0x44422224
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444224
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x22222244,0x22222244,0x44222244,0x44222244,0x44222244,0x44222244,0x44222244,0x44222244
-	.word 0x22222222,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44422222,0x44422222,0x44422224,0x44422224,0x44422224,0x44422224,0x44422224,0x44422224
-	.word 0x22222444,0x22222444,0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x42222444
-	.word 0x22222222,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x22222222,0x44442222,0x44442222,0x44442222,0x44442222,0x44442222,0x44442222
-	.word 0x44442222,0x44222222,0x42222224,0x42222444,0x22224444,0x22224444,0x22224444,0x22224444
-	.word 0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22244444,0x22244444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44222444,0x42222444,0x42222444,0x44222444,0x44222244,0x44222244,0x44222244,0x44422224
-	.word 0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x22222444,0x22222444
-	.word 0x22244444,0x22224444,0x42222444,0x44222244,0x44422224,0x44442222,0x44442222,0x44444222
-	.word 0x22224442,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444
-	.word 0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22244444,0x22444444,0x22444444
-	.word 0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444422,0x44444422
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44422222,0x22222222,0x22222244,0x22224444,0x22222444,0x42222444,0x44222244,0x44222224
-	.word 0x44422224,0x44422222,0x44422222,0x44422224,0x44422224,0x44422224,0x44422224,0x44422224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444224,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44222244,0x44222244,0x44222244,0x44222244,0x44222244,0x44222244,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44422224,0x44422224,0x44422224,0x44422224,0x44422224,0x44422224,0x44444444,0x44444444
-	.word 0x42222444,0x42222444,0x42222444,0x22222444,0x22222444,0x22222444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22222222,0x22222222,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444442,0x44444442,0x44444442,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442222,0x44442222,0x44442222,0x22222222,0x22222222,0x22222222,0x44444444,0x44444444
-	.word 0x22224444,0x42222444,0x42222244,0x44222222,0x44422222,0x44444222,0x44444444,0x44444444
-	.word 0x22444444,0x22444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444422,0x44444222,0x44422222,0x42222222,0x22222244,0x22224444,0x44444444,0x44444444
-	.word 0x44444444,0x24444444,0x22444444,0x22222444,0x22222222,0x42222222,0x44444444,0x44444444
-	.word 0x44422222,0x44442222,0x44444222,0x44444422,0x44444442,0x44444444,0x44444444,0x44444444
-	.word 0x22222444,0x22222444,0x22222444,0x42222444,0x44222444,0x44222444,0x44444444,0x44444444
-
-	.word 0x44444422,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x22224444,0x44444444,0x44444444
-	.word 0x24444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44442222,0x44222222,0x22222224,0x22222444,0x22244444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x22224444,0x22222222,0x42222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444422,0x24444422,0x24444422,0x22444442,0x22244444,0x44444444,0x44444444
-	.word 0x44422224,0x44442222,0x44442222,0x44444222,0x44444422,0x44444422,0x44444444,0x44444444
-	.word 0x44422224,0x44422224,0x44422224,0x44422224,0x44422224,0x44422224,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x11111114,0x11111114,0x11111114,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44111111,0x44111111,0x44111111,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444244,0x44442444,0x24442244,0x24424244,0x42424244,0x42244244,0x44244224,0x44444444
-	.word 0x44442442,0x44442442,0x44442442,0x42222442,0x24442442,0x24442422,0x42222424,0x44444444
-	.word 0x44444424,0x44444424,0x44444424,0x44444424,0x44444424,0x44444424,0x24444424,0x44444444
-	.word 0x24422222,0x24424422,0x24424422,0x24424422,0x24424422,0x24424442,0x24424442,0x44444444
-	.word 0x44222444,0x22442244,0x24444244,0x24444222,0x24444224,0x24444244,0x42222444,0x44444444
-	.word 0x42222444,0x42442444,0x42442444,0x42442444,0x42442244,0x42444244,0x22222224,0x24444424
-
-	.word 0x44422244,0x44424424,0x44424424,0x44422224,0x44424244,0x44424224,0x24424422,0x44444444
-	.word 0x42444442,0x42444424,0x42244422,0x42244242,0x42424242,0x22422442,0x24442442,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444422
-	.word 0x24444424,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44424422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42442244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44244244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22444244
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44424442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44424422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42244444,0x22224444,0x22224444,0x22422444,0x22224444,0x44444444,0x44422444,0x44442244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444444,0x42444444,0x22444444,0x42444444,0x42444444,0x22444444,0x44444444,0x44444444
-	.word 0x42244424,0x44244224,0x44244422,0x44244244,0x42244244,0x22444222,0x44444444,0x44444444
-	.word 0x24424424,0x24424444,0x22224444,0x22424444,0x24424424,0x44424422,0x44444444,0x44444444
-
-	.word 0x44422442,0x44424444,0x44424444,0x44424444,0x44424444,0x44442222,0x44444444,0x44444444
-	.word 0x42422444,0x42224444,0x22244444,0x42224444,0x42422444,0x42442244,0x44444444,0x44444444
-	.word 0x44244424,0x44244442,0x24244444,0x22244442,0x42244424,0x44244244,0x44444444,0x44444444
-	.word 0x44244224,0x44444222,0x24444242,0x44444244,0x44244244,0x22244244,0x44444444,0x44444444
-	.word 0x44424422,0x44424422,0x22224442,0x44424424,0x44424424,0x44424442,0x44444444,0x44444444
-	.word 0x44424422,0x44424422,0x22224422,0x44424422,0x44424422,0x22224422,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444442,0x44444442,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x22444444,0x22224444,0x22222444,0x22222244
-	.word 0x22444444,0x22222244,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x44444422,0x44222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444422,0x44444222,0x44442222,0x44422222,0x44422222
-	.word 0x44444244,0x44444244,0x44444424,0x44444424,0x44444422,0x44444442,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42224444,0x22442244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222224,0x44442444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44422224,0x24424424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44424222,0x24422442
-	.word 0x44444444,0x44444444,0x44444444,0x44442442,0x44442442,0x44444444,0x24444222,0x44442442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44244444,0x44244442
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x44244444,0x44424444,0x22424444,0x44224444
-	.word 0x44444444,0x44444444,0x44444422,0x44444442,0x44444444,0x44444444,0x22244442,0x44224422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22244444,0x24424442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444442
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44442224,0x24422442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22242224,0x24442442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22244422,0x44224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222424,0x44244422
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42444244,0x44244244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42422244,0x42244224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x24444444,0x22444444,0x22244444,0x22244444,0x22224444
-	.word 0x22222224,0x22222222,0x22222222,0x44222222,0x44422222,0x44444222,0x44444422,0x44444442
-	.word 0x22222222,0x22222222,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x22222222,0x22244444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222244,0x22222444,0x22224444
-	.word 0x24222222,0x24222222,0x22222222,0x22222222,0x42222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x24444244,0x44444244,0x24444244,0x24442244,0x42222444,0x44444444,0x44444444,0x44444444
-	.word 0x44442442,0x44442442,0x44442442,0x44442444,0x24442444,0x24444444,0x24444444,0x44444444
-	.word 0x24424424,0x24424424,0x24424422,0x24424442,0x44222222,0x44244444,0x44244444,0x44444444
-	.word 0x24424444,0x24424444,0x24424444,0x24424444,0x44422222,0x44444444,0x44444444,0x44444444
-	.word 0x24424444,0x24422222,0x24444444,0x24424444,0x22442222,0x44444444,0x44444444,0x44444444
-	.word 0x44224442,0x44224424,0x44242424,0x42242244,0x42444244,0x44444444,0x44444444,0x44444444
-
-	.word 0x44424444,0x44424444,0x44424444,0x44224444,0x22244444,0x44444444,0x44444444,0x44444444
-	.word 0x44424224,0x22224244,0x44424224,0x44424424,0x22244442,0x44444444,0x44444444,0x44444444
-	.word 0x24444424,0x22444422,0x44444444,0x44424424,0x22224442,0x44444444,0x44444444,0x44444444
-	.word 0x24444442,0x24444444,0x24444442,0x24444442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24224444,0x24244444,0x24224444,0x24424442,0x44442222,0x44444444,0x44444444,0x44444444
-	.word 0x24444444,0x24444444,0x24444444,0x24442442,0x24442222,0x44444444,0x44444444,0x44444444
-	.word 0x44424444,0x44424444,0x44424444,0x44424444,0x22244444,0x44444444,0x44444444,0x44444444
-	.word 0x44244424,0x44244424,0x44244424,0x44244424,0x44244422,0x44444444,0x44444444,0x44444444
-
-	.word 0x44424244,0x44422244,0x44424244,0x44244244,0x22444244,0x44444444,0x44444444,0x44444444
-	.word 0x42444424,0x42444424,0x42444424,0x42444424,0x42222244,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22224444,0x22224444,0x22222444,0x22222444,0x22222444,0x42222444,0x42222444,0x42222444
-	.word 0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x11111444,0x11111144
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444411
-
-	.word 0x22244444,0x22244444,0x22444444,0x22444444,0x24444444,0x24444444,0x24444444,0x24444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442,0x44444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42224244,0x22442244,0x24444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42224444,0x22442244,0x24444242
-
-	.word 0x44444444,0x22444444,0x42224444,0x44442444,0x44444244,0x42224244,0x22442244,0x24444242
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42224444,0x22442244,0x24444242
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44222224,0x44442444,0x44442442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42444442,0x42444442,0x42444442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x44224444,0x44424444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42222242,0x44424442,0x44424444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42422244,0x42244224,0x42444424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42244424,0x42244424,0x42244424
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44244424,0x44244424,0x44244424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42444424,0x42244424,0x42224424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42444424,0x42244424,0x42224424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x42222444,0x42222444,0x42222444,0x42222444,0x42222444,0x22224444,0x22224444,0x22224444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111114,0x11111114,0x11111114,0x11111114,0x11111144,0x11111144,0x11111444,0x11111444
-	.word 0x44444111,0x44441111,0x44441111,0x44441111,0x44441111,0x44441111,0x44444411,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x24444444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444442,0x44444442,0x44444442,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444244,0x24444244,0x24442244,0x22224244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444242,0x24444242,0x24442244,0x42222444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444242,0x24444242,0x24442244,0x42222444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444242,0x24444242,0x24442244,0x42222444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442442,0x44442442,0x44442444,0x44442444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42442222,0x42424442,0x42424442,0x42442222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44424444,0x44424444,0x44224444,0x22244444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44424444,0x44424444,0x44424442,0x44424442,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444424,0x42444424,0x42444424,0x42222244,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42222224,0x42244424,0x42244424,0x42244424,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244424,0x44244424,0x44244424,0x42222224,0x42444444,0x42444444,0x44444444,0x44444444
-	.word 0x42422424,0x42442224,0x42444224,0x42444424,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42422424,0x42442224,0x42444224,0x42444424,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44424444,0x44422444,0x44422444,0x44422244,0x44422244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x22244444,0x22444444,0x22444444,0x24444444,0x24444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444442,0x44444422,0x44444222,0x44442222,0x44422222,0x44222222,0x42222224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x24444444,0x24444444,0x22444444,0x22244444,0x22244444,0x22222444,0x22222444,0x22222244
-	.word 0x42222222,0x42222222,0x42222222,0x44222222,0x44222222,0x44222222,0x44422222,0x44442222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22444244,0x22444244,0x22444244,0x22222244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x24222444,0x22442244,0x24444244,0x24444244
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x42444444,0x42444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22224222,0x42444244,0x42444444,0x42444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22242442,0x24422444,0x44442444,0x44442444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x42224444,0x24422442,0x44442422,0x44442424
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x42442242,0x42422442,0x42224442,0x22244442
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22444244,0x42244424,0x44244442,0x22244444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444424,0x44444244,0x44444222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444,0x22444444
-	.word 0x44422244,0x44422244,0x44422224,0x44422224,0x44222222,0x22222222,0x22222222,0x22222222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444422,0x44444222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22222244,0x22222444,0x22222444,0x22244444,0x24444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444442,0x44444422,0x22222222,0x22222222,0x22222222,0x22222224,0x44444444,0x44444444
-	.word 0x44444444,0x22444444,0x22222222,0x22222222,0x22222222,0x22222222,0x44444444,0x44444444
-	.word 0x22222224,0x22222222,0x22222222,0x44222222,0x44442222,0x44444444,0x44444444,0x44444444
-	.word 0x44444222,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x22444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x42222222,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244222,0x44242244,0x44242444,0x44224444,0x44224444,0x44244444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x22444244,0x22444244,0x22444244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x24444244,0x24444244,0x22222444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444444,0x22444444,0x24444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x42444444,0x42444244,0x42444222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442444,0x44422444,0x22242444,0x44442444,0x44442444,0x44442444,0x44442444,0x44444444
-	.word 0x44442422,0x44442442,0x22224442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x42224442,0x42422442,0x42442242,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44244442,0x44244424,0x22444244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444244,0x44444422,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22244444,0x22224444,0x44224444,0x44424444,0x44424444,0x44424444,0x44424444,0x44424444
-
-	.word 0x22222222,0x22222222,0x22222244,0x22222444,0x22224444,0x22244441,0x22244411,0x22244411
-	.word 0x44442222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222,0x44422222
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44244444,0x44244444,0x44244444,0x42224444,0x42222444,0x24242444,0x24442444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x24444444
-	.word 0x24444444,0x24444444,0x24444444,0x44444444,0x44442444,0x44444224,0x44444422,0x44444442
-
-	.word 0x44444444,0x44444442,0x44444422,0x44442222,0x22222222,0x42222222,0x44222222,0x44422224
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444442,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244,0x44444244
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x22244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x44444444,0x24444422,0x42244424,0x44244424,0x44244424,0x44244424,0x42244424,0x22444424
-	.word 0x44444444,0x24244422,0x42244224,0x44242244,0x44242444,0x44242244,0x42244244,0x24244422
-	.word 0x44444444,0x22444422,0x44244224,0x44242244,0x22242444,0x42442244,0x42244244,0x44224222
-	.word 0x44444444,0x22244442,0x44244442,0x44244442,0x44244442,0x44224442,0x44424442,0x22222442
-	.word 0x44444444,0x24442442,0x42442442,0x44242442,0x44222442,0x44242442,0x42442442,0x24442422
-	.word 0x44444444,0x24222444,0x22442244,0x24444244,0x24444244,0x24444244,0x24444244,0x22222442
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44224444,0x44244444,0x42244444,0x22444444,0x22444444,0x42244444,0x44224444,0x44422444
-	.word 0x22244444,0x22244444,0x22224444,0x22222444,0x22222222,0x22222244,0x44444444,0x44444444
-	.word 0x44442222,0x44442222,0x44442222,0x44422222,0x44222222,0x42222244,0x22224444,0x22444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444442
-	.word 0x22224444,0x44442444,0x44444244,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444442,0x44444424,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x22444444,0x42444444,0x42244444,0x44244444,0x44244444,0x44244444,0x44224444,0x44422444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44442224,0x44442224,0x44442224,0x44444224,0x44444224,0x44444424,0x44444424,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444244,0x43444244,0x44444244,0x44444244,0x44444244,0x22222244,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44444444,0x22222222,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44442444,0x44442444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444424,0x44444424,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44442244,0x44444224,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444422,0x44444424,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22444444,0x44222222,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x24444444,0x42222244,0x44444222,0x44444444,0x44444444,0x44444444
-	.word 0x44444224,0x44444422,0x44444442,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444434,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
+	.word 0x003BA010,0xF0000032,0x44019001,0x22018044,0x4422220D,0x70070042,0x1EC03403,0x2FA0227F
+	.word 0x1FF001C0,0x15F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF001,0xF01FF01F,0xF001F01F,0x01F0FF1F
+	.word 0x01F01FF0,0x1FF01FF0,0x1FF015F0,0xF0EF01F0,0xF001F01F,0xE311221F,0x1FF01FF0,0xF0FF1FF0
+	.word 0xF01FF001,0xF01FF01F,0xF016F01F,0xFF01F01F,0x01F01FF0,0x1FF01FF0,0x1FF01FF0,0x1FF001F0
+	.word 0x3001F0EF,0x2405001F,0x6FB303B0,0x01F003F0,0x704810FB,0xF001F003,0x2401C001,0x0350D801
+	.word 0x201DF0DF,0x03602220,0xE7201DF0,0x1DF00150,0xF0BEF0FD,0xF001F001,0x705FF05F,0x0360421F
+	.word 0xF01DF0E7,0x2401F001,0x00641022,0xFF5FF0DE,0x83607F30,0x27801DF0,0x5E5012F0,0x45116061
+	.word 0xF06720FF,0x0043304B,0xE00320C2,0xF1A3005A,0x01F0FFE0,0x3F3001F0,0x73F0BB11,0x38011C30
+
+	.word 0xB0FFDFF0,0xF0591101,0x1041701C,0x503FF0D3,0xFE9FF11D,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x3F2401B0,0x73D34344,0x03F07FF3,0x6B930350,0xF0FF03F0,0x110180FF,0xD06B931F,0xF01F2103
+	.word 0xFF039018,0x5FC05FF0,0x017015F0,0x01F07DF1,0x5EF4D2F0,0xE001F0FF,0x424C1101,0x41B752B3
+	.word 0x72E72020,0x93F0FFE3,0x3F202F10,0x541001F0,0x4D403710,0x70FF1261,0xD03FF110,0xB052F003
+	.word 0x44E754AF,0xF701200F,0x05441D13,0xE79033F0,0x32331024,0xFFC783EB,0x45F1FFC4,0x4840DF90
+	.word 0x03A05B70,0x5740EE30,0xF203E0FF,0xF0FEF03E,0xF001F001,0xF001F001,0x01F0DF01,0x202401C0
+	.word 0xF373F37E,0x8303F07F,0x8A71FF7F,0xA7F503F0,0x875401C0,0x1F411BF1,0xF0FFEB76,0xF0BF251C
+	.word 0xF601905F,0xF001F0E7,0xFF9F9001,0x03F06170,0xA2006674,0x1DF0B040,0x1C7303F0,0xF071F0FF
+
+	.word 0x8001F0B7,0xA063B301,0xF13F4162,0xA853FF37,0x3440BD22,0x0650F034,0x0D801364,0xA0FF03F0
+	.word 0x6303D0C7,0x5036F202,0xF0CDF01C,0xFF7BF401,0xA1109FC1,0x2B824B57,0x63F20AA0,0x01F07FF3
+	.word 0xF001F0FF,0xC001F001,0xD062F0BC,0xF303F021,0x03F0FF7F,0x18F6FFF6,0x7DF001F0,0x17B113F1
+	.word 0xFAFF33F2,0xFA014077,0xFA01B017,0xF001F077,0xFFADB653,0xE4715FF0,0xEB350632,0x03404290
+	.word 0x1C5047F2,0x22B523FF,0xF1042047,0x66FF4540,0xF7617080,0x39D0FF3F,0xA3533381,0x33F0F683
+	.word 0x03F001F1,0xF0FFF7E6,0x643D50DB,0x73BE3091,0x0001E0F3,0xFFDFF043,0xD853A350,0x3F70E630
+	.word 0xD7D32FD4,0x77F35BF2,0xF001F0FF,0xF001F001,0xF001F001,0x0001C001,0x73F3F0F3,0x03F07FF3
+	.word 0x1114C8D2,0x50CF1111,0x4466F003,0x60160044,0xF01DF001,0x1FF0FF1F,0x1FF01FF0,0x1FF01FF0
+
+	.word 0x1FF01FF0,0xF0FF01F0,0xF01FF01F,0xF01FF01F,0xF01FF01F,0xFF1FF01D,0x1FF01FF0,0x1FF01FF0
+	.word 0x1FF01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF01F,0xF01FF01F,0xF01DF01F,0x1FF0BF1F,0xF0036011
+	.word 0xF001F01D,0xF001F001,0x01F0FF01,0x01D001F0,0x7FF373F3,0x03A003F0,0x44109D45,0x03104242
+	.word 0x24424442,0x200110F7,0x7006105D,0x21102203,0xF30F140C,0xF08444FF,0x20036071,0x040A0540
+	.word 0x2003B0EC,0x5120FF60,0xF8142810,0xDA440100,0x83001800,0x54FF0300,0x201520E4,0x10033011
+	.word 0x1C3C1029,0xFF6310CF,0x70291E90,0x03000700,0xBF206710,0xDE00BA40,0x10D900FF,0x00062003
+	.word 0xF0F3F595,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF
+
+	.word 0xF001F001,0xF2015001,0xF07FF3F9,0xC8F9FF03,0x01F001F0,0x01F001F0,0x01F001F0,0xF8DF0160
+	.word 0x241CB0C7,0x01F0C753,0xC0F01F10,0xF0FF1FA0,0xF040F01E,0x44017015,0x5001F022,0xFFBFF01F
+	.word 0x5EF01EB0,0x01F07EF0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0x30FF01F0,0x4E122B01,0x5BA6057B,0xF0294B9B
+	.word 0xFF3FE001,0x7FF303F0,0x7FF303F0,0x01F001F0,0x01F001F0,0x9F01D0FF,0x400B90B2,0x176B37BD
+	.word 0x0664477E,0x1F90EF9C,0x17117D57,0x27F30642,0x2F5C7043,0x03B0FF20,0x0C07DDBC,0x68278923
+	.word 0x7F801C67,0x13FF3D27,0x104117EA,0x2077938F,0x3056479B,0xFF08385E,0x4A101F50,0x8F179237
+	.word 0x77932430,0x591E1F50,0xF10B90FF,0xF092F126,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0
+
+	.word 0x01F001F0,0x01A001F0,0x4EFFDE4D,0x20873F47,0xF001F007,0x4001F001,0xFF4A3040,0xE7AF01F0
+	.word 0x775FAB9F,0x1400D811,0x06001D12,0xF3063AFF,0x9001F01E,0xF373F301,0xF003F07F,0x2AE1FF60
+	.word 0x17F02822,0x862F7540,0x1F7017F0,0xF0FF8B22,0x3A5D6021,0x531390E6,0xC07D4069,0xFF61E01D
+	.word 0x56B03743,0xDC209430,0x1880D82A,0x6B13EEA0,0xD0DEF0FF,0xA081F0C1,0x8001F1AF,0xF01B243D
+	.word 0x1F60FF1F,0x03FB5F00,0x983BAF80,0x3F4019F0,0xF0FF801B,0xF09C903E,0x1B60A0BE,0xF0BC2486
+	.word 0xFF01F001,0x01F001F0,0x59109620,0xBF20FD30,0x0EB3E500,0x46F722FF,0xF388255A,0x60A6B028
+	.word 0xF1F3241E,0x72F3FDF0,0xA022D733,0xAA2C0E20,0x90421E80,0x00F1FF2B,0x01F001F0,0x03F0F2D0
+	.word 0x03F07FF3,0x45FF0340,0x8D4B1DD7,0x9D014077,0x905240FF,0xFF632360,0x38269346,0x1E604931
+
+	.word 0x1F1041C0,0x1320F1D0,0xE3AC50FB,0x20041414,0x22891A98,0x35D46210,0x20CC90FF,0x263FA07B
+	.word 0x107101FE,0xC09B3607,0x815EFF1F,0x3DD7CB30,0x07101A65,0x01106FF3,0x50FF862E,0xC0F5219C
+	.word 0x2F2F6101,0xEF34E33B,0xFF9FC08C,0x3EF001B0,0xE720DE47,0xDFD0EF21,0xF43580A1,0xF001F0FF
+	.word 0xF001F001,0x59011001,0x4F03A0BB,0x6515F0CD,0x01F0E6F5,0x144401F0,0x443F1111,0xF0030011
+	.word 0x30016019,0x57EB531C,0x00B3FF5B,0x01B09DF3,0x9EF60EF3,0x019001F0,0xF3FF73F3,0xF003F07F
+	.word 0x3A018060,0xF22A1901,0xFF01206F,0xD2221F30,0xB1361040,0x1FE05750,0x1FF03FF0,0x47D170FF
+	.word 0x40BEF55B,0x486D429E,0x3001F03D,0xE0F0FF8F,0x7D27DE60,0x9E701FF0,0x3D411B26,0x33FF9FF0
+	.word 0xF003204A,0xF033B31D,0x5ADA501D,0xFF01F0D9,0x01F01FF0,0x01F001F0,0x49F001A0,0x01F001F0
+
+	.word 0xD001F0FF,0x606B8301,0xFB935303,0x0301E067,0x90117D66,0x10732303,0x107F1303,0x67034110
+	.word 0xE06803FF,0xE04AF003,0xF39D2099,0x807FF372,0x01F0FF03,0x66F001F0,0x7FF303F0,0x03A703F0
+	.word 0x02FF5815,0x421BD098,0x401BF7E8,0xF01FF001,0xFF1FF01F,0x5BB71F80,0x9110DDE0,0x03202B03
+	.word 0x41D09D40,0xF60340FF,0x501F90FB,0xF61DD001,0x271FC01B,0x6FF3FF9C,0x01803F70,0x1F30CEB1
+	.word 0x1C687807,0xF0FFE2F1,0xF0C0F01F,0x7001F001,0x23A957EB,0xFF4EF006,0x01F001F0,0x01F001F0
+	.word 0x7FF60170,0x91500340,0xBD9D61FF,0xF02A277B,0xF001F0A0,0x4080C001,0xF77AFF03,0x6F7A8757
+	.word 0x2B5E0350,0x4CF08340,0xF0FF01F0,0xF07EF001,0xF07FF303,0x20EDF103,0xFFE51213,0x96FB0330
+	.word 0x1B67B82C,0x0150BFF6,0x18B0C69E,0xF04533FF,0x0C7E5081,0x40EA32D8,0x265AF0C2,0xF559FF9C
+
+	.word 0xAF133FE0,0x651CD302,0xDF506BDA,0x30FF4713,0x2A1FF0BA,0xF2084001,0xF001F01D,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x733201C0,0x7A566743,0x7D5F42FF,0x2037F00B,0xF00F5301,0xF001F001
+	.word 0x01F0FF01,0x685001F0,0xC3FD978A,0xB3809B73,0xC0FFC44C,0x5001B045,0xC05FFE18,0xF024F938
+	.word 0xFF2E8001,0x016012F0,0x4AF06A10,0x422DA842,0x8A849462,0xD073F3FF,0xF06F7303,0x3C1F5E5C
+	.word 0x301DF0B9,0xF774FF21,0x7C4601F0,0xBBF0B900,0xB315BE60,0x60FF7713,0x104D60CE,0xF09C56D2
+	.word 0x3317203C,0xFF1BF76F,0xCC23BE60,0xC1A0DFF0,0x01F01CF0,0x01F001F0,0xF001F0FF,0xF001F001
+	.word 0x2E017001,0xC14F8B9E,0x7872C5BC,0x2222E342,0x11080041,0x76FF0340,0xF203F06F,0x4001F04E
+	.word 0x53038083,0xFF6802EC,0x01F060FB,0x01F001F0,0x78F001F0,0xE2121152,0x50AF41FF,0x63C373BD
+
+	.word 0xF9EB26A8,0xF08BF36E,0x01F0FF01,0x01F001F0,0x708001F0,0x7DF603F0,0xF0FF01F0,0xF001F001
+	.word 0x0001F001,0x10172801,0xFF03F007,0x1C100100,0x0190DF49,0x1F305124,0xA119EC01,0x335F54FF
+	.word 0x37720394,0x30761101,0x371F202D,0x1F10FF9D,0x02312100,0x4A643022,0x22106E34,0x4AFFD333
+	.word 0x00C7035C,0x100C2A04,0x52330407,0xFFF3D75F,0x3F500340,0x01F001F0,0x01F001F0,0xDD4001F0
+	.word 0x55A464FF,0x20814258,0x33FF5912,0x508B637F,0x898DFF3D,0x7833F759,0xBFF02320,0x1E320180
+	.word 0x60FF5710,0x4001F00C,0xF088F31A,0x6001F001,0xFF385BE0,0xE670EB50,0x01A001F0,0x0320FD50
+	.word 0x01F045C0,0xF001F0FF,0xF001F001,0xF001F001,0x33014001,0xA3437F67,0xA0DFF773,0xF0B7F801
+	.word 0xF015F01F,0x01F0FF1F,0x01F01FF0,0xAFF31FD0,0x3FF03FF0,0xF0FF3EE0,0xF01EF01F,0xF001F01F
+
+	.word 0xF01FF01F,0xFF1FF01F,0x1FF016F0,0x86F20C20,0x1FF03FF0,0x1FF015F0,0xF05E40FF,0xF03FF0FF
+	.word 0xF016F01F,0x0401B01E,0x1105FFC3,0xCBD6CBC0,0x01F001F0,0x01F001F0,0xF0FB01F0,0xF001F001
+	.word 0xB001F001,0x12F03401,0x000001A0
 
 	.section .rodata
 	.align	2
@@ -6,8 +6,8 @@
 //	overlay_network_flattened, 3816x8@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 477 tiles not compressed
-//	Total size: 512 + 15264 = 15776
+//	+ 477 tiles rle compressed, 15264 bytes raw
+//	Total size: 512 + 1348 = 1860
 //
 //	Time-stamp: 2021-04-06, 09:05:25
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_OVERLAY_NETWORK_FLATTENED_H
 #define GRIT_OVERLAY_NETWORK_FLATTENED_H
 
-#define overlay_network_flattenedTilesLen 15264
-extern const unsigned int overlay_network_flattenedTiles[3816];
+#define overlay_network_flattenedTilesLen 1348
+extern const unsigned int overlay_network_flattenedTiles[337];
 
 #define overlay_network_flattenedPalLen 512
 extern const unsigned short overlay_network_flattenedPal[256];
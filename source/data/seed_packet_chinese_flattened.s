@@ -6,8 +6,8 @@
 @	seed_packet_chinese_flattened, 3816x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 477 tiles not compressed
-@	Total size: 512 + 15264 = 15776
+@	+ 477 tiles lz77 compressed, 15264 bytes raw
+@	Total size: 512 + 3224 = 3736
 @
 @	Time-stamp: 2021-05-29, 07:25:26
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,545 +17,122 @@
 
 	.section .rodata
 	.align	2
-	.global seed_packet_chinese_flattenedTiles		@ 15264 unsigned chars
+	.global seed_packet_chinese_flattenedTiles		@ 3224 unsigned chars
 	.hidden seed_packet_chinese_flattenedTiles
 seed_packet_chinese_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55555555,0x55555555,0x44444455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x45555555,0x45555555,0x44555555
-
-	.word 0x44444455,0x44444445,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x66644444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444466
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44222222,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x33355555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x53333355,0x33333335,0x33333333,0x33333333
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555553
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x54555555,0x55455555,0x55555555,0x55555555
-	.word 0x44445555,0x44444455,0x44444455,0x44444445,0x44444444,0x44444555,0x44445555,0x44555555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x66644444,0x66666444,0x66666644,0x66666664,0x66666664,0x66666666
-	.word 0x66664444,0x66664444,0x66664446,0x66664666,0x16666666,0x11166666,0x11116666,0x11111666
-	.word 0x44446666,0x44446666,0x44466666,0x44466666,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11181111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11118111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111118
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444441,0x44444111,0x44441111,0x44411111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333555,0x33333555,0x33333555,0x33333555,0x33333355,0x33333335,0x33333335,0x33333335
-	.word 0x33333333,0x33333333,0x33337333,0x33337333,0x33337733,0x33337773,0x33333333,0x33333333
-	.word 0x45533333,0x44333333,0x44333333,0x44333333,0x44333333,0x44333333,0x44333333,0x44333333
-	.word 0x55554444,0x55555444,0x55555444,0x55555444,0x55555444,0x55555444,0x55555444,0x55555444
-	.word 0x45555555,0x45555555,0x55555555,0x45555555,0x45555555,0x45555555,0x45555555,0x44555555
-
-	.word 0x44444444,0x44444555,0x44455545,0x55544444,0x54444444,0x44444444,0x44444444,0x44444444
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666644
-	.word 0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x88888881,0x11111111,0x88888881,0x11811181,0x88888181,0x11881181,0x81881181,0x11188181
-	.word 0x88888888,0x11111111,0x18888888,0x11118111,0x18888881,0x11118111,0x18818181,0x11111111
-	.word 0x11811111,0x88888881,0x11811111,0x11118111,0x18888881,0x18118111,0x18111811,0x18111811
-	.word 0x11111811,0x18888888,0x11111811,0x11111111,0x11118111,0x18888888,0x11118111,0x11118111
-
-	.word 0x88888811,0x11111811,0x11111811,0x88888811,0x11111811,0x11111811,0x88888811,0x11111111
-	.word 0x11888888,0x11811118,0x11811118,0x11888888,0x11811118,0x11811118,0x11888888,0x11111118
-	.word 0x11181111,0x11118111,0x18888881,0x18111181,0x18111181,0x18111181,0x18111181,0x18888881
-	.word 0x11111181,0x18888881,0x18111118,0x18111118,0x18111818,0x18111811,0x18111811,0x18118111
-	.word 0x88888811,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x88888111,0x11111111
-	.word 0x18888888,0x11111118,0x11111118,0x11111118,0x11111118,0x11111118,0x11888888,0x11111118
-	.word 0x11111111,0x11111111,0x88888881,0x11111181,0x11111181,0x11111181,0x11111181,0x11111181
-	.word 0x11111118,0x11111118,0x18888888,0x18111118,0x18111118,0x18111118,0x18111118,0x18111118
-
-	.word 0x88888811,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x88888111,0x11111111
-	.word 0x18888888,0x11111118,0x11111118,0x11111118,0x11111118,0x11111118,0x11888888,0x11111118
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44411111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333335,0x33333335,0x33333335,0x33333335,0x53333355,0x55555555,0x55555555,0x55555555
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x43333333,0x44433335,0x44455555
-	.word 0x44433333,0x44444333,0x44444445,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x55555444,0x55554444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44445555,0x44444555,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x66664444,0x64444444,0x66444444,0x66444444,0x66444444,0x66444444,0x64444444,0x44444444
-	.word 0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111144
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x88888181,0x18111181,0x88888181,0x11818181,0x88811181,0x11811118,0x11111111,0x11111111
-	.word 0x18888888,0x11111111,0x18888888,0x18111111,0x18888888,0x18111111,0x11111111,0x11111111
-	.word 0x18111811,0x11811181,0x11811811,0x11188111,0x11881111,0x18118881,0x11111811,0x11111111
-	.word 0x18888888,0x18111118,0x18111118,0x18111118,0x18111118,0x18888888,0x11111111,0x18811111
-	.word 0x11111111,0x88888811,0x11111111,0x11111111,0x88888881,0x11111111,0x11111111,0x11111811
-	.word 0x11111118,0x11888888,0x11111118,0x11111118,0x18888888,0x11111111,0x11111111,0x11111111
-	.word 0x18111181,0x18111181,0x18111181,0x18111181,0x18888881,0x18111181,0x11111111,0x11111111
-	.word 0x18118111,0x18188111,0x18111111,0x18111111,0x11811181,0x11188881,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x88888881,0x11111111,0x11111111,0x11111111
-	.word 0x11111118,0x11111118,0x11111118,0x11111118,0x88888888,0x11111111,0x11111111,0x11111111
-	.word 0x11111181,0x88888881,0x11111181,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x18111118,0x18888888,0x18111118,0x11111118,0x11111118,0x11111118,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x88888881,0x11111111,0x11111111,0x11111111
-	.word 0x11111118,0x11111118,0x11111118,0x11111118,0x88888888,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44555555,0x44555555,0x44555555,0x44555555,0x45555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x55555555
-
-	.word 0x44444444,0x44444444,0x55544444,0x55555444,0x55555544,0x55555544,0x55555544,0x55555555
-	.word 0x44444444,0x44444444,0x44445555,0x44455555,0x44555555,0x44555555,0x45555555,0x45555555
-	.word 0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11811111,0x88888881,0x81811111,0x88888811,0x11811111,0x18111111,0x88888811,0x11111811
-
-	.word 0x11111811,0x18888888,0x11111818,0x11888888,0x11111811,0x11111881,0x11888888,0x18111118
-	.word 0x11188111,0x11118111,0x11118111,0x11118111,0x11888881,0x11811811,0x81811811,0x88811811
-	.word 0x11111111,0x11888888,0x11811118,0x11811818,0x11811818,0x11811818,0x11811111,0x18888888
-	.word 0x18111111,0x88888881,0x18111111,0x88888111,0x11118111,0x88888111,0x88118111,0x18818111
-	.word 0x11111811,0x18888888,0x11111818,0x11888888,0x11111811,0x11888888,0x11188811,0x18818188
-	.word 0x18111111,0x18111111,0x88888881,0x18118111,0x18118111,0x11118111,0x88888881,0x18118111
-	.word 0x11111881,0x11111181,0x18888888,0x11111181,0x11111811,0x11111811,0x18888888,0x11111811
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x45555555,0x45555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444444,0x44444444,0x44444444,0x54444444,0x45544445,0x44444555,0x44444555,0x44444555
-	.word 0x55544444,0x44555554,0x44444455,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x55555554,0x55555554,0x55555554,0x55555554,0x55555444,0x55544444,0x44444444,0x44444444
-	.word 0x44555555,0x44555555,0x44555555,0x44555555,0x44455555,0x44445555,0x44444444,0x44444444
-	.word 0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x88881811,0x11181111,0x11181111,0x11181111,0x11181111,0x11111111,0x11111111,0x11111111
-	.word 0x18888888,0x11181118,0x11181118,0x11181118,0x11118818,0x11111118,0x11111111,0x11111111
-	.word 0x81181811,0x81181881,0x81188111,0x81888111,0x18818111,0x11111811,0x11111181,0x11111111
-	.word 0x11811111,0x11811811,0x11811111,0x18888888,0x11811111,0x11881111,0x11188111,0x11111111
-	.word 0x18181811,0x88881811,0x18111811,0x88811811,0x18188811,0x88111181,0x11111111,0x11111111
-
-	.word 0x11118118,0x18888888,0x11111111,0x11188888,0x11181111,0x11188888,0x11111111,0x11111111
-	.word 0x11818111,0x11811811,0x11888111,0x18881111,0x18118811,0x11111811,0x11111111,0x11111111
-	.word 0x11888888,0x11811118,0x11811118,0x11811118,0x11888888,0x11811118,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x65555555,0x66555555,0x66665555,0x66665555,0x66665555,0x66666555,0x66666555,0x66666555
-	.word 0x56666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x33666666
-	.word 0x44445555,0x44445556,0x44445566,0x66665666,0x66666666,0x66666666,0x66666666,0x63366663
-	.word 0x66644444,0x66666644,0x66666666,0x66666666,0x66666666,0x66666666,0x66666663,0x66666633
-	.word 0x44444444,0x44444446,0x44444466,0x44444466,0x44444466,0x44444466,0x44444466,0x44444446
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144
-	.word 0x11111111,0x11111111,0x11111111,0x22222211,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66666555,0x66666555,0x66666555,0x66665555,0x66665555,0x66655555,0x33555555,0x35555555
-
-	.word 0x33366666,0x33366666,0x33366666,0x33366666,0x33366666,0x33666333,0x66633333,0x33333333
-	.word 0x33336333,0x33333333,0x33333333,0x33333333,0x33777773,0x37777773,0x77777777,0x77777777
-	.word 0x66666633,0x66666633,0x46666633,0x46666333,0x46666333,0x66666633,0x66666663,0x66666666
-	.word 0x44444446,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444446,0x44444466
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x45555544
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x88111144,0x11111144,0x11111144
-	.word 0x11111111,0x11111111,0x11111111,0x11111811,0x11111811,0x88888888,0x11111181,0x11111181
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11811111,0x88111111,0x11111111,0x88881111
-	.word 0x11111111,0x11111111,0x11111111,0x11111881,0x11111181,0x11111181,0x11111181,0x11888888
-	.word 0x11111111,0x11111111,0x11111111,0x18111111,0x18111111,0x18111111,0x18111111,0x88888881
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x81111111,0x81111111,0x81118888
-	.word 0x11111111,0x11111111,0x11111111,0x11181111,0x11181111,0x88888888,0x11111111,0x18111811
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x88811111,0x81111888,0x81111811,0x81111811
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x88888818,0x11181111,0x11181111,0x11181111
-	.word 0x11111111,0x11111111,0x11111111,0x11181111,0x81181111,0x11181111,0x81888111,0x11181111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111811,0x18888888,0x11111188,0x18888888,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x88888881,0x88111111,0x18111111,0x88888811
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x81188888,0x81111111,0x18111111,0x11118888
-	.word 0x11111111,0x11111111,0x11111111,0x11111811,0x11111811,0x81188888,0x81111811,0x81111811
-	.word 0x11111111,0x11111111,0x11111111,0x11111181,0x11111181,0x81111181,0x81111181,0x81111181
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11188118,0x11118111,0x88888811,0x11181881
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111118,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x35555555,0x33555555,0x33555555,0x66555555,0x66555555,0x66355555,0x66355555,0x66355555
-	.word 0x33333333,0x33333333,0x33333333,0x33333336,0x33333366,0x33333666,0x33333666,0x33336666
-	.word 0x66667773,0x66666673,0x66666663,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x44444666,0x54446666,0x55546666,0x55556666,0x55556666,0x55554666,0x55544466,0x55544466
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444445,0x44444455,0x44444455,0x44444555,0x44444555,0x44445555,0x44445555,0x44444555
-	.word 0x88811144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144
-	.word 0x88888888,0x11111181,0x11111118,0x18888888,0x11811111,0x11188188,0x11118811,0x11881111
-	.word 0x11111118,0x11111111,0x11111111,0x81111111,0x18111111,0x11811111,0x11188111,0x11181111
-	.word 0x11811118,0x11811118,0x11811818,0x11811811,0x11811111,0x11181111,0x11188811,0x11118111
-	.word 0x18111111,0x81811111,0x81811111,0x11811111,0x11181111,0x18118111,0x18111811,0x11111181
-	.word 0x11111111,0x81111111,0x11111111,0x11111118,0x11111118,0x11111881,0x81188811,0x11118111
-
-	.word 0x88818811,0x11111188,0x11111118,0x88888811,0x11181111,0x11181111,0x88888888,0x11111111
-	.word 0x88811118,0x81111188,0x81111811,0x81111118,0x81111111,0x18811111,0x11111888,0x11111111
-	.word 0x11181188,0x18188111,0x18188111,0x81181811,0x11181818,0x11181811,0x11181111,0x11181111
-	.word 0x81181111,0x81181111,0x81181111,0x81881811,0x81118118,0x11111111,0x11111111,0x88811111
-	.word 0x11888888,0x11811111,0x11888888,0x11811111,0x11888888,0x11118118,0x18118118,0x11881111
-	.word 0x11811811,0x11811811,0x11811811,0x11811811,0x11811811,0x11811811,0x11111811,0x11111811
-	.word 0x88118118,0x11118118,0x11118118,0x81118118,0x81118118,0x81118111,0x81118881,0x11111811
-	.word 0x81188888,0x81111811,0x81111811,0x81188888,0x81181811,0x81181811,0x11181811,0x81111811
-
-	.word 0x88111181,0x81811181,0x81111181,0x81111181,0x81111181,0x81111181,0x81111181,0x81111188
-	.word 0x11181181,0x88881111,0x11181111,0x11181111,0x88881111,0x11181111,0x11181111,0x11181111
-	.word 0x11111111,0x11111118,0x11111111,0x11111111,0x11111118,0x11188111,0x11118111,0x11118111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66355555,0x63555555,0x33555555,0x35555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x33366666,0x33666666,0x33666666,0x33666666,0x33336633,0x33366355,0x43333555,0x44455555
-	.word 0x66666666,0x66666663,0x66666663,0x66666663,0x66666663,0x66666634,0x66666334,0x55533355
-	.word 0x66666666,0x46666666,0x44466666,0x44446666,0x44455666,0x44555666,0x44555556,0x44555555
-	.word 0x55544446,0x55444444,0x55444444,0x54444444,0x44444444,0x44444444,0x54444444,0x54444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x45555555,0x44444444,0x44444444
-	.word 0x44444555,0x44444455,0x44444455,0x44444455,0x44444445,0x44444444,0x44444444,0x44444444
-	.word 0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144
-	.word 0x11811111,0x11111111,0x11111111,0x11111111,0x11111111,0x11118811,0x11118881,0x11181118
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x88888111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111188,0x11111118,0x18888888
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11181111,0x11181111,0x88888881
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111118,0x11111118,0x11188888
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x81181111,0x81181888,0x11181111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x81111111,0x88811118,0x81111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11181111,0x18888888,0x11181111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x88888811,0x11111811
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11118888,0x11118111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x88888881,0x11111181
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111118,0x88111118
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x88888888
-	.word 0x11111118,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x88811111,0x11111118
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11888888,0x11811181
-	.word 0x11111811,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x88888881,0x11181111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44118111,0x44118111,0x44118111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x54555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555554
-	.word 0x44555555,0x44555555,0x44555555,0x44455555,0x44455555,0x44455555,0x44445555,0x44444555
-	.word 0x45444444,0x45444444,0x45444444,0x44544444,0x44454444,0x44445444,0x44445444,0x44445444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x81111144,0x18111144,0x11811144,0x11111144,0x11111144,0x81111144,0x81111144,0x81111144
-	.word 0x18811811,0x81111111,0x11888888,0x11181111,0x11111111,0x18888888,0x18111111,0x18111111
-	.word 0x81111111,0x18111118,0x88111111,0x18811111,0x88181111,0x18188111,0x88111111,0x18111111
-	.word 0x11111111,0x11111111,0x11188888,0x11181111,0x11188888,0x11181111,0x11188888,0x11181111
-	.word 0x11181111,0x11111111,0x81181111,0x81118111,0x81118811,0x81118188,0x88118111,0x81818111
-	.word 0x81111118,0x11111111,0x11111811,0x81118811,0x11111181,0x81111118,0x11111111,0x11118111
-
-	.word 0x88888888,0x11181811,0x88181181,0x11111118,0x11181111,0x88888888,0x11818111,0x18111811
-	.word 0x81111188,0x81111111,0x81111111,0x81111188,0x88881111,0x81111188,0x18111111,0x11881111
-	.word 0x11188888,0x11181111,0x11188888,0x11181111,0x88888888,0x11181111,0x11811811,0x88118888
-	.word 0x18111811,0x18111811,0x88881811,0x18111811,0x18111811,0x81811811,0x11181811,0x11111811
-	.word 0x11118111,0x11118111,0x11118188,0x11118111,0x11118111,0x11118118,0x11118181,0x11118111
-	.word 0x11111181,0x88888881,0x11111181,0x11111181,0x88888881,0x11111181,0x11111181,0x11111181
-	.word 0x11111118,0x81111118,0x81111118,0x81111118,0x81111118,0x81111118,0x81111118,0x81111118
-	.word 0x18111111,0x18118888,0x18118111,0x18118111,0x18118111,0x18118888,0x18118111,0x18111111
-
-	.word 0x18811111,0x11811111,0x11111111,0x88111111,0x11881111,0x11111111,0x18181111,0x18118111
-	.word 0x11811181,0x11811118,0x11811118,0x11188111,0x11111181,0x11811181,0x18111881,0x18181111
-	.word 0x11181111,0x88888881,0x81818181,0x81818181,0x81818181,0x81818181,0x81818181,0x81118181
-	.word 0x44188881,0x44118111,0x44118181,0x44118181,0x44118181,0x44118181,0x44118111,0x44118111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x45555555
-	.word 0x55555444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444455,0x44444544,0x44444544,0x44445544,0x44445444,0x44455444,0x44454444,0x54544444
-	.word 0x44444544,0x44444544,0x44444554,0x44444454,0x44444455,0x44444445,0x44444445,0x44444445
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x81111144,0x81111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x88811144
-	.word 0x18888888,0x18111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111811,0x88888888
-
-	.word 0x18111111,0x18111111,0x11111111,0x11111111,0x11111111,0x81111111,0x81111111,0x88888811
-	.word 0x11181111,0x11118111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11888888
-	.word 0x81118111,0x11118111,0x11111111,0x11111111,0x11111111,0x11111111,0x11881111,0x11181111
-	.word 0x81188111,0x81118888,0x11111111,0x11111111,0x11111111,0x11111111,0x81111881,0x11111181
-	.word 0x81111188,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x88888888,0x11881111
-	.word 0x11111888,0x88811111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111888,0x81111111
-	.word 0x11111811,0x18888888,0x11111111,0x11111111,0x11111111,0x11118111,0x11118118,0x11118111
-	.word 0x88888811,0x11111811,0x11111111,0x11111111,0x11111111,0x11111111,0x11811111,0x11811111
-
-	.word 0x81118888,0x11118111,0x11111111,0x11111111,0x11111111,0x11111111,0x11188111,0x11111811
-	.word 0x88888888,0x11111111,0x11111111,0x11111111,0x11111111,0x11188111,0x11118111,0x11118111
-	.word 0x11111888,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x81111188,0x11111118
-	.word 0x18118111,0x11881111,0x11111111,0x11111111,0x11111111,0x81118111,0x88888888,0x11111111
-	.word 0x18118111,0x88111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111888,0x88111111
-	.word 0x18181111,0x11118888,0x11111111,0x11111111,0x11111111,0x11111111,0x11181181,0x88888888
-	.word 0x88111181,0x18111181,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111118
-	.word 0x44118181,0x44111811,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x44444445,0x44444445,0x44444445,0x44444445,0x44444445,0x44444445,0x44444445
-	.word 0x44555555,0x45544444,0x54444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x54544444,0x55544444,0x55444444,0x55444455,0x45445554,0x45455444,0x44454444,0x44544444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x66364444,0x33333644
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444466,0x44444666
-	.word 0x88111144,0x88111144,0x18111144,0x88111144,0x18111144,0x88111144,0x18111144,0x88881144
-	.word 0x11888888,0x11888888,0x11811111,0x11888888,0x11811111,0x11888888,0x11811111,0x88888888
-	.word 0x11111811,0x11811811,0x18811111,0x11188811,0x11118111,0x88811111,0x81111111,0x81111111
-	.word 0x11811111,0x11811181,0x11118888,0x11188111,0x11811111,0x11118888,0x11111111,0x11111111
-	.word 0x11181111,0x11181111,0x11181111,0x11181111,0x11881111,0x18118111,0x11118111,0x81111811
-	.word 0x11111181,0x11111181,0x11111181,0x11111181,0x11111881,0x11111818,0x11111818,0x11118111
-
-	.word 0x11181111,0x88888888,0x18118118,0x18118118,0x18118118,0x18118118,0x18118118,0x11118118
-	.word 0x81111111,0x18111188,0x18811181,0x11111181,0x81111181,0x11111181,0x11111181,0x11111181
-	.word 0x88888888,0x11118111,0x11118111,0x11118111,0x18888888,0x11118111,0x11118111,0x11118111
-	.word 0x11811111,0x11811111,0x11811111,0x88888811,0x11811111,0x11811111,0x11811111,0x81811111
-	.word 0x11111181,0x11111118,0x11111111,0x11888888,0x11111118,0x11111181,0x11111811,0x11118811
-	.word 0x11888811,0x81811811,0x81811811,0x11888811,0x11811811,0x11811811,0x11811811,0x11888811
-	.word 0x11188888,0x11181111,0x11181111,0x11181181,0x11181181,0x11181881,0x11181111,0x81118111
-	.word 0x88888888,0x81118118,0x88188818,0x88188818,0x11111118,0x88888818,0x88888118,0x11118811
-
-	.word 0x11111888,0x81111111,0x88811188,0x18111118,0x18111181,0x18111888,0x81111188,0x81111181
-	.word 0x11111181,0x11811111,0x88888188,0x11811181,0x11811118,0x88888118,0x81118111,0x81118118
-	.word 0x11111111,0x11111111,0x11111118,0x11111111,0x11111111,0x11111111,0x11188111,0x11811811
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x45555555,0x44555555,0x44455555
-
-	.word 0x44444445,0x44444445,0x44444445,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x34444444,0x36666644,0x36666634,0x66666334,0x66663334
-	.word 0x33333344,0x33333364,0x33333334,0x33333333,0x33333333,0x33333333,0x33373333,0x33373336
-	.word 0x44446666,0x44446666,0x44466663,0x44466663,0x44466633,0x44466333,0x44463333,0x63633333
-	.word 0x81111144,0x18811144,0x11181144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144
-	.word 0x11188188,0x18811111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x88888811,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11888888,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x18111181,0x11811111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11881111,0x11181111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x81111118,0x11111118,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x88811188,0x11111118,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x88888888,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x18811118,0x11881111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11881111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11811811,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x81118111,0x11111881,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x88888181,0x11118111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x18111188,0x11811111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x88888181,0x81118111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11811811,0x11188111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44445555,0x44455555,0x44555555,0x45555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444455,0x44444555,0x54445555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x45555444,0x55555554,0x55555555,0x55555555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444445,0x44444455
-	.word 0x66666333,0x66633333,0x66633333,0x33333333,0x73333333,0x33333333,0x33333333,0x33333334
-
-	.word 0x33377336,0x33377773,0x33377777,0x33337777,0x33337777,0x33333333,0x33333333,0x33333333
-	.word 0x66633333,0x66633333,0x66333333,0x63333333,0x63333333,0x33333333,0x43333333,0x44333333
-	.word 0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44411111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55445555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444555,0x44444555,0x44445555,0x55545555,0x44555555,0x44445555,0x44445555,0x44445555
-	.word 0x33333334,0x33333334,0x33333334,0x33333335,0x33333336,0x33333333,0x33333333,0x33333364
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33343333,0x64443333,0x44443333,0x44446333
-	.word 0x44333333,0x44333333,0x44333333,0x55333333,0x54433333,0x44446633,0x44444444,0x44444444
-	.word 0x11111444,0x11114444,0x11144444,0x14444444,0x44444445,0x44444455,0x44444554,0x44444544
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333444,0x33333444,0x33344444,0x44444444
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44433333,0x44444333,0x44444433,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44411111,0x44441111,0x44444111,0x44444441,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x44444455,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555
-	.word 0x44445555,0x44444555,0x44445555,0x44455555,0x22244444,0x44455555,0x44455555,0x44455555
-	.word 0x33336644,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444633,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44445444,0x44455444,0x44454444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44222222,0x44444444,0x44444444,0x44444444
+	.word 0x003BA010,0xF0000032,0x55019001,0x44014055,0x5544440E,0xD0070054,0x441E7003,0xF00D70FF
+	.word 0xF01FF001,0xF015F01F,0xF001F01F,0x01F0D51F,0x40451FE0,0x18104403,0x0F030045,0x22222222
+	.word 0x01F02310,0x1FF00130,0xF01FF0CF,0xF0666415,0x6001701F,0xFF1FF01C,0x1FF05FF0,0x16F01FF0
+	.word 0x01F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF01F,0xF001F01F,0xF001F01F,0x1FF0FF1F,0x1FF01FF0
+	.word 0x1FF016F0,0x1FF001F0,0xF0FB01F0,0xF01FF01F,0x001FB01F,0x03E02405,0xC0F973F3,0xF001F003
+	.word 0x4001F001,0xE0333501,0x33330312,0x33333553,0x33F00160,0x530170BF,0x011012F0,0x5A139500
+	.word 0x77030150,0x53C900EF,0x55011067,0x17200800,0x01F09633,0x0001F0E0,0x644B0301,0x66446666
+	.word 0x0066663E,0x10032006,0x20450301,0x10A84603,0x12204618,0x11020016,0x11386666,0x00060011
+
+	.word 0x46219007,0x11761144,0x65D001B0,0xF0181DB0,0x811E901F,0xF03FF0FF,0xF01FF05F,0xF01FF01F
+	.word 0xF01FF01F,0x1FF0FF1F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0xF0DF1FF0,0x181B901F,0x3FF01FF0
+	.word 0x1FF01FF0,0xF0DD1FF0,0x4101401F,0x04002310,0x10111910,0x73F3FD08,0x73F303A0,0x01F003C0
+	.word 0xA03362D3,0x5303F503,0x03505F13,0x40730160,0x06007703,0x700300CB,0x00455301,0x03F04404
+	.word 0x23FF0330,0xF0870049,0x00033003,0x90EB5601,0xDFFF660B,0x8F131311,0x00041045,0x91041030
+	.word 0xFF66432F,0x7B1301F0,0x63010410,0x037003F0,0x01B001F0,0x8888810A,0x81075088,0x88815003
+	.word 0x11810800,0x88090088,0x811D8181,0x16001118,0x06001F20,0xFE6F1318,0x07301E00,0x41301C10
+	.word 0x14104340,0xFF181F60,0x3B300180,0x23102D40,0x03204B50,0x1B103B10,0xD00310FF,0x1012600B
+
+	.word 0xE0910050,0x40C5420B,0x0600FF77,0x133003B0,0x25001B20,0x99900330,0x40FF4A10,0x7018F167
+	.word 0x909250F7,0x717F7003,0xFFD25047,0x2F800390,0x03808370,0x7FF07FF0,0x7FF07FF0,0x5001F0DF
+	.word 0x93134101,0x034003F0,0x7FF373F3,0xF303F0FF,0x6301F07F,0x166FA37E,0x931F90DF,0x01808569
+	.word 0x43333543,0x03455903,0x44433F63,0xBB660200,0x671301E0,0x01F0CD26,0x105B23FE,0xF03CF01D
+	.word 0x6301F001,0x64040081,0xC00810EF,0x44131003,0x037073F3,0x01F00CE5,0x026F43EF,0x810710AB
+	.word 0x1C438123,0x2B230130,0x180770BF,0x20600750,0x3510C702,0x9223F122,0x12BB03FF,0xF221401A
+	.word 0x10436077,0x8207307D,0x0F54FF83,0x96F35B40,0x2F403B60,0x072073F3,0x00FF2080,0x50C272CE
+	.word 0xF009F1E1,0xD282407F,0xFF1FA0F7,0x7B23DF43,0xC23001F0,0x47600381,0x7FF001F0,0xF07FF0FF
+
+	.word 0xE001F07F,0xF377F301,0xF303F07F,0x03F0FF7F,0x01F07FF3,0x01D001F0,0x0380072A,0xF3FF3C9A
+	.word 0xF001F057,0xF001F001,0xB0010001,0xF5FB065F,0x8880CB13,0xE5331F90,0x45A7D045,0xB0FF54F1
+	.word 0xF001F003,0xF001F001,0xF001F001,0xFF01F001,0x1F670110,0xDB33B436,0x5442F735,0x07309F22
+	.word 0x40CE36FF,0x107E230B,0x2650860C,0x03693316,0xE903FF59,0x17671600,0x03501700,0x2B542C10
+	.word 0x00FFD342,0x43070022,0x001E1030,0x909F6792,0xFF07207F,0x90043A00,0x1410B773,0x07587A37
+	.word 0x9E500F20,0x404310FF,0xF3D360D9,0xF001F068,0xF001F001,0x01F0FF01,0x016001F0,0x7FF316F2
+	.word 0x7FF303F0,0xF3FF03F0,0xF001F07F,0x3001F001,0xF3279A01,0x7F24437F,0x2D020045,0x130340BF
+	.word 0xF3362337,0xFF01F05E,0xA22A01F0,0x4F370390,0xA353872A,0x831303C0,0xF14080FF,0xF07FF354
+
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0xFD0501D0,0x0170C5F5,0x01801B36,0x70EF2D40,0x1368033F
+	.word 0x03108150,0x3333221B,0x46FE6F76,0x236F63F9,0x3A5A670D,0x17A02371,0x03FF88A9,0x662D1057
+	.word 0x670C2043,0xA79F30E3,0xFFE60362,0x3210DB37,0xDB779413,0x9463BF40,0x08F1239B,0xF001F0FF
+	.word 0xF001F001,0xF001F001,0xF201A001,0x7FF3FC16,0x7FF303F0,0x7FF303F0,0x555501F0,0x0300655B
+	.word 0x70020066,0x03706503,0x566A0100,0x016059FD,0x56EB1233,0xC3660300,0x29C00310,0x63366663
+	.word 0x873D060A,0x6301C0BB,0xA31D3C10,0x0046C500,0xFF3CDA03,0x17100310,0x01F001F0,0x7FF301F0
+	.word 0x7FF303F0,0x2222110F,0xA09EF122,0xF01FF01E,0x01F0FF1F,0x01F01FF0,0x1FF01FF0,0x1FF01FF0
+	.word 0xF0FF16F0,0xF001F01F,0xF001F01F,0xF01FF01F,0xFF1FF01F,0x1FF001F0,0x1FF001F0,0x1FF01FF0
+
+	.word 0x14F01FD0,0xF312F2FF,0xF303F07F,0xF303F07F,0x0301F07F,0x6F83D47D,0x00658363,0x5B035503
+	.word 0x66183555,0x26033666,0x633303B0,0x020EF166,0x06000420,0x777318BE,0x1D031077,0x30777737
+	.word 0x40631301,0x32004603,0x430330FF,0xF301107F,0x53013063,0x8001F093,0xEC16F701,0x7FF315F0
+	.word 0xF38803F0,0x7901007F,0xAF2CFF1B,0x0110A5F5,0x1F461520,0x0ABAEBCC,0xC0FFB69D,0xF0B38961
+	.word 0x5A645060,0x6C3EE00D,0xFFC1F9E3,0x70963630,0x445A80D0,0x96606BF7,0xF62EE43A,0x171EE0FF
+	.word 0xCEE9260B,0x207D8067,0xD0A8501E,0x864AFF1F,0xF9270310,0x23407EF0,0x66ABBFF0,0xE0FF0350
+	.word 0x3EF08ADF,0x5001F0D6,0xF201406A,0xFF7FF31E,0x7FF303F0,0x7FF303F0,0x630301F0,0x03106B43
+	.word 0x007713DD,0x03603503,0x79035B93,0xE0101033,0x03208213,0x77730C00,0xFC736666,0x01F04F83
+
+	.word 0x01A001F0,0x05076803,0x662F6654,0x46817754,0x630A0300,0xAEF00310,0x1301B0FF,0x206E1A80
+	.word 0x2EF75A03,0x02FF4A0B,0x58F1FF11,0x6B530370,0xBC21BB4F,0x6143B801,0xC2FF823D,0x4CE03102
+	.word 0x3DEA62FA,0x59227073,0xFF2F30EA,0x17202E82,0x57B0ED39,0x5A201163,0x47228312,0x30D12DFE
+	.word 0x533B8387,0x30B43D83,0x81FE7384,0x1D53187F,0x8812C120,0xA4000310,0x9722C82D,0x600674DF
+	.word 0xF9001803,0x96507530,0x9A4E6640,0x403F5AFF,0x8024212D,0x3003B03E,0x230A005E,0x0340FF71
+	.word 0x251B5F30,0x6BA32D3E,0x03600B30,0x1AFFDC20,0x932E10FE,0x3F035073,0x70B93134,0xFF5FF4CF
+	.word 0x0B20C391,0x12F22895,0x03F07FF3,0x03F07FF3,0xF07FF3F7,0x00E22601,0xEF566304,0xF3361DD0
+	.word 0x03C256E0,0x55020070,0x55333663,0x4333351D,0x4B5AFD12,0x10340390,0x08008F03,0x00533355
+
+	.word 0x1365333F,0x356D1A68,0x33005666,0x4D56B00A,0xCB3D46AF,0x540350BF,0x0B10B986,0x7673C1F0
+	.word 0x6F130237,0xE74080FF,0xCA54F110,0x2DE5F67F,0xF5C5211E,0x01A0FF3F,0x3EF01A33,0x23F60962
+	.word 0x70220572,0x60FF3FF0,0xF06F5D1D,0x333A2701,0x401AF0F0,0xFF5D1099,0x1AF00710,0x9B306130
+	.word 0x01603FF0,0x17F0A83D,0xF01E60FF,0x4480A05D,0x5001F0D7,0xF0A53481,0x82A0FF19,0x618001F1
+	.word 0x3BA01BF0,0xC3F0E823,0x40DF9F70,0x8116F21C,0x73F30370,0x03F07FF3,0xF0FF7FF3,0xF001F001
+	.word 0xF0012001,0xF001F045,0xDF387001,0x03306723,0x46038045,0x4032339F,0xFD721303,0x03500640
+	.word 0x01F001F0,0x7F9301F0,0x7F030081,0x61503118,0x20131064,0x53B03803,0xFFAC310A,0x8E96F641
+	.word 0x0A400E23,0x4026D801,0x33203070,0xB09756FE,0x45227007,0x153D00F9,0x810930D0,0x508955FF
+
+	.word 0x47D71561,0x32791060,0x160B1683,0xCD55FF9C,0x29101320,0xFB262004,0x3150AF5A,0xF0FF8477
+	.word 0x16775297,0x371E0098,0x80492089,0xFF56160B,0x5D40F540,0xCB46906B,0xD147A820,0x0BE06B53
+	.word 0x200171FF,0x6A03F0E7,0x70319B87,0x613A700F,0xB273FF66,0x48111431,0x7514AA6A,0x68177720
+	.word 0x37FFE420,0x01931044,0x1701F06B,0x001A3287,0xFF03A00B,0x03F07FF3,0x03F07FF3,0x01F001F0
+	.word 0x01F001F0,0x2001F0DF,0xA1164501,0x0170F4F2,0x61531C20,0x54E156A7,0x54541050,0x76437963
+	.word 0x50FFC356,0xF001F003,0xE301F001,0xF403107F,0xFF5F39E8,0x0F4308FD,0x1FF07C49,0xCB525E52
+	.word 0xC753E8F5,0xF00C42FF,0x09BE631B,0x32E7FD91,0xF07E2A4A,0x5B50FF5D,0x94338B22,0x1FB0EB26
+	.word 0xE349B130,0x9BFF2AC6,0xC0E7F62A,0x50BFF0E2,0xF02381A0,0xFFB7531B,0x9F305BF0,0xA140664B
+
+	.word 0xF85A7AD0,0x27F71F40,0x115740FF,0x4047FE7F,0xFE5B4C36,0x240140C8,0x6713BF5E,0x501AF218
+	.word 0xF373F303,0xF303F07F,0x01F0FF7F,0x01F001F0,0x13B36453,0x1E000390,0xF6FE5053,0x030120AD
+	.word 0x16634A63,0x030900F2,0x00F845B3,0xF032F02F,0x7001F001,0x44663601,0xF0830EF7,0x0A013017
+	.word 0x5B1E44EA,0xFF1D4401,0x040310FF,0x1107D0E8,0xFC2316A1,0x320740E3,0xAC32FF9B,0x6B53D001
+	.word 0x0126DB69,0x1120CC26,0xB2FF3036,0x426BAD0F,0x4CAE3579,0x40C076DF,0xFFA26D42,0x2424154E
+	.word 0x0370199D,0x5A4D8C50,0x4F909030,0x702B37FF,0x908B2310,0xC01CC020,0x328F578D,0x0E41FFEC
+	.word 0xE710AC6E,0x2F178224,0x0B300300,0x21FD0370,0x66FB705B,0x437F5EA9,0x88BC2067,0x10FF0140
+	.word 0x27132019,0x1847649D,0x28B53736,0xFFF72708,0x7321EB50,0x0B672F00,0xCBAED134,0x682180E3
+
+	.word 0xF31E20FF,0xF07FF377,0xF07FF303,0xF07FF303,0x01F0FF01,0x57137223,0x8BF67913,0x01F001F0
+	.word 0xF0EA01F0,0x0001F001,0x240E3401,0x363F0E36,0x343F1EA0,0x3344710E,0xB1643333,0x00340300
+	.word 0x3701B003,0x03003633,0x00532EDA,0x6C036303,0x10330310,0x00A56303,0x03103303,0xFB366363
+	.word 0xDF6B0381,0x0310E4F4,0xF5333388,0xF501501F,0xFF1EF0DF,0xE67101F0,0x41D020F7,0x7EF00300
+	.word 0x80490150,0x6001F0FF,0xC007FD3D,0xA0A0F09F,0xF05E105F,0x9FB0FF22,0x407001F0,0x01A0DBF0
+	.word 0xA0F0E319,0xF7FF1E70,0xF17DD0FD,0xF03FF03F,0xF09F9020,0xFF019080,0x7FF316F2,0x7FF303F0
+	.word 0x7FF303F0,0x941601F0,0x2D8F2DFF,0xC07713A3,0x2601F01D,0x009003CC,0xC0F68F1D,0x90455554
+	.word 0x303DF076,0x7B8E5A01,0x03670333,0x20034027,0x61537301,0x36007313,0x73333773,0x5E333777
+
+	.word 0x33032077,0x01B00320,0x03103B60,0x0340DE63,0x00430110,0xF1FF1603,0x14035054,0xF08CF1FF
+	.word 0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFE01F001,0x01F001F0,0x01F001F0,0x1AF201A0,0xFF410360
+	.word 0x7FF373F3,0x7FF373F3,0x01F001F0,0x413301F0,0xF012F0FF,0x5001F001,0x33A71301,0x200300AB
+	.word 0x0B40F790,0x63130330,0x13350350,0x1659836F,0x01F0DFF7,0x00442910,0x00BB131A,0x80080003
+	.word 0x03554F03,0x1A335476,0x0301507C,0xFF841363,0x0D100810,0xD447866E,0x5E008CE1,0x04000320
+	.word 0xD03E10EB,0x445F001F,0x5A440200,0xFF3FE0F8,0x1FF067C4,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0
+	.word 0xF01FF0FF,0xF01FF01F,0xF01FF01F,0xF01FF01F,0x1FF0FF1F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0
+
+	.word 0x10BF1FF0,0x1D22411F,0x6D136A13,0x73F301F0,0x80FF7FF3,0xF3150003,0xF04D8304,0xF01FF01F
+	.word 0xF91FF016,0x1FF001F0,0x7F731140,0x2224F412,0x30B06F37,0xB5064403,0x2222ED90,0x90FF2222
+	.word 0xA1460A0F,0xD01FD00D,0x171FE001,0xFF6C53A1,0x3FF01FF0,0x1FF01FF0,0x1FF016F0,0x1FF001F0
+	.word 0xF001F0FF,0xF01FF01F,0xF01FF01F,0xF01FF001,0x1FF0FF01,0x1FF01FF0,0x16F01FF0,0x01F01FF0
+	.word 0xF0FF1FF0,0xF01FF001,0xF01FF01F,0xF001F01F,0xC001401F,0x1ED06FB3
 
 	.section .rodata
 	.align	2
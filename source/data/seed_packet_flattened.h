@@ -6,8 +6,8 @@
 //	seed_packet_flattened, 3816x8@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 477 tiles not compressed
-//	Total size: 512 + 15264 = 15776
+//	+ 477 tiles lz77 compressed, 15264 bytes raw
+//	Total size: 512 + 3032 = 3544
 //
 //	Time-stamp: 2021-10-25, 18:57:33
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_SEED_PACKET_FLATTENED_H
 #define GRIT_SEED_PACKET_FLATTENED_H
 
-#define seed_packet_flattenedTilesLen 15264
-extern const unsigned int seed_packet_flattenedTiles[3816];
+#define seed_packet_flattenedTilesLen 3032
+extern const unsigned int seed_packet_flattenedTiles[758];
 
 #define seed_packet_flattenedPalLen 512
 extern const unsigned short seed_packet_flattenedPal[256];
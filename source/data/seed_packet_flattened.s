@@ -6,8 +6,8 @@
 @	seed_packet_flattened, 3816x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 477 tiles not compressed
-@	Total size: 512 + 15264 = 15776
+@	+ 477 tiles lz77 compressed, 15264 bytes raw
+@	Total size: 512 + 3032 = 3544
 @
 @	Time-stamp: 2021-10-25, 18:57:33
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,545 +17,115 @@
 
 	.section .rodata
 	.align	2
-	.global seed_packet_flattenedTiles		@ 15264 unsigned chars
+	.global seed_packet_flattenedTiles		@ 3032 unsigned chars
 	.hidden seed_packet_flattenedTiles
 seed_packet_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55555555,0x55555555,0x33333355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x35555555,0x35555555,0x33555555
-
-	.word 0x33333355,0x33333335,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x66633333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333366
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33222222,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x44455555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x54444455,0x44444445,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555554
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x53555555,0x55355555,0x55555555,0x55555555
-	.word 0x33335555,0x33333355,0x33333355,0x33333335,0x33333333,0x33333555,0x33335555,0x33555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x66633333,0x66666333,0x66666633,0x66666663,0x66666663,0x66666666
-	.word 0x66663333,0x66663333,0x66663336,0x66663666,0x16666666,0x11166666,0x11116666,0x11111666
-	.word 0x33336666,0x33336666,0x33366666,0x33366666,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333331,0x33333111,0x33331111,0x33311111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444555,0x44444555,0x44444555,0x44444555,0x44444455,0x44444445,0x44444445,0x44444445
-	.word 0x44444444,0x44444444,0x44447444,0x44447444,0x44447744,0x44447774,0x44444444,0x44444444
-	.word 0x35544444,0x33444444,0x33444444,0x33444444,0x33444444,0x33444444,0x33444444,0x33444444
-	.word 0x55553333,0x55555333,0x55555333,0x55555333,0x55555333,0x55555333,0x55555333,0x55555333
-	.word 0x35555555,0x35555555,0x55555555,0x35555555,0x35555555,0x35555555,0x35555555,0x33555555
-
-	.word 0x33333333,0x33333555,0x33355535,0x55533333,0x53333333,0x33333333,0x33333333,0x33333333
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666633
-	.word 0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x21111166
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122221,0x11221122,0x11221112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222211,0x12211221,0x22111122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22221111,0x21122111,0x11122111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21211111,0x12222111,0x12211111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222122,0x12211221,0x12211221
-
-	.word 0x11111111,0x11122111,0x11122111,0x11111111,0x11111111,0x11121111,0x11122211,0x11122111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222211,0x12211221,0x12211122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11112221,0x11121112,0x11222222
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12221211,0x22112222,0x22112211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111222,0x21112211,0x11112211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122221,0x11221122,0x12211122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12222221,0x12212211,0x11112211
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222111,0x12111211,0x22222221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22221111,0x21122111,0x11122111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22211111,0x11221111,0x11221111
-	.word 0x33311111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111112,0x33111112,0x33111111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444445,0x44444445,0x44444445,0x44444445,0x54444455,0x55555555,0x55555555,0x55555555
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x34444444,0x33344445,0x33355555
-	.word 0x33344444,0x33333444,0x33333335,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555333,0x55553333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33335555,0x33333555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66663333,0x63333333,0x66333333,0x66333333,0x66333333,0x66333333,0x63333333,0x33333333
-	.word 0x21111166,0x21111166,0x21111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111133
-	.word 0x11111112,0x11111112,0x11111112,0x11111122,0x11122221,0x11111111,0x11111111,0x11111111
-
-	.word 0x22111122,0x22111122,0x22111122,0x12211221,0x11222211,0x11111111,0x11111111,0x11111111
-	.word 0x11221111,0x22211111,0x22111111,0x22112111,0x12222111,0x11111111,0x11111111,0x11111111
-	.word 0x12211111,0x12211111,0x12211111,0x12211111,0x22221111,0x11111111,0x11111111,0x11111111
-	.word 0x12211221,0x12211221,0x12211221,0x12211221,0x12221222,0x11111111,0x11111111,0x11111111
-	.word 0x11122111,0x11122111,0x11122111,0x11122111,0x11222211,0x11111111,0x11111111,0x11111111
-	.word 0x11111122,0x11111122,0x11111122,0x11111221,0x11222211,0x11111111,0x11111111,0x11111111
-	.word 0x21111111,0x21111111,0x21111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111112,0x11111112,0x11111112,0x11121122,0x11112221,0x11111111,0x11111111,0x11111111
-
-	.word 0x22112211,0x22112211,0x22112211,0x22112211,0x22222221,0x11111111,0x11111111,0x11111111
-	.word 0x11112211,0x11112211,0x11112211,0x11112211,0x11112221,0x11111111,0x11111111,0x11111111
-	.word 0x12211122,0x12211122,0x12211122,0x11221122,0x11122222,0x11111122,0x11111122,0x11111122
-	.word 0x11112211,0x11112211,0x11112211,0x11112211,0x11122221,0x11111111,0x11111111,0x11111111
-	.word 0x11111221,0x11111221,0x11111221,0x12112211,0x11222111,0x11111111,0x11111111,0x11111111
-	.word 0x11221111,0x22211111,0x22111111,0x22112111,0x12222111,0x11111111,0x11111111,0x11111111
-	.word 0x12211111,0x22111111,0x21111111,0x21121111,0x22221111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111112,0x33111112,0x33111112,0x33111111,0x33111111,0x33111111,0x33111111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33555555,0x33555555,0x33555555,0x33555555,0x35555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-
-	.word 0x33333333,0x33333333,0x55533333,0x55555333,0x55555533,0x55555533,0x55555533,0x55555555
-	.word 0x33333333,0x33333333,0x33335555,0x33355555,0x33555555,0x33555555,0x35555555,0x35555555
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12111111,0x22211111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111222,0x11112211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11112221,0x11122112
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122221,0x11121122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111211,0x11122222,0x11111221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11221122,0x11221122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222211,0x22122111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11112111,0x11222221,0x11112211
-	.word 0x11111111,0x21111111,0x11111221,0x11111221,0x11111111,0x11111111,0x11111211,0x11111222
-	.word 0x11111122,0x11111122,0x11111111,0x11111111,0x11111111,0x11111111,0x11221122,0x11221122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12221211,0x22112222
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111222,0x11112211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x35555555,0x35555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x53333333,0x35533335,0x33333555,0x33333555,0x33333555
-	.word 0x55533333,0x33555553,0x33333355,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555553,0x55555553,0x55555553,0x55555553,0x55555333,0x55533333,0x33333333,0x33333333
-	.word 0x33555555,0x33555555,0x33555555,0x33555555,0x33355555,0x33335555,0x33333333,0x33333333
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22111111,0x22111111,0x22111111,0x22111111,0x22111111,0x22211111,0x11111111,0x11111111
-	.word 0x11112211,0x11112211,0x11112211,0x11112211,0x11112211,0x11122211,0x11111111,0x11111111
-	.word 0x11122122,0x11122111,0x11122221,0x11122122,0x11122122,0x12221222,0x11111111,0x11111111
-	.word 0x11111122,0x11111221,0x11122211,0x11122111,0x11122112,0x11112222,0x11111111,0x11111111
-	.word 0x11111221,0x11111221,0x11111221,0x11111221,0x11111221,0x11122221,0x11111111,0x11111111
-	.word 0x11221122,0x11221122,0x11221122,0x11221122,0x11221122,0x12222222,0x11111111,0x11111111
-	.word 0x11122111,0x11122111,0x11122111,0x11122111,0x11122111,0x11222211,0x11111111,0x11111111
-
-	.word 0x11112211,0x11112211,0x11112211,0x11112211,0x11112211,0x11222211,0x11111111,0x11111111
-	.word 0x11111221,0x11111221,0x11111221,0x11111221,0x11111221,0x11112222,0x11111111,0x11111111
-	.word 0x11221122,0x11221122,0x11221122,0x11221122,0x11221122,0x12222222,0x11111111,0x11111111
-	.word 0x22112211,0x22112211,0x22112211,0x22112211,0x22112211,0x22222221,0x11111111,0x11111111
-	.word 0x11112211,0x11112211,0x11112211,0x11112211,0x11112211,0x11112221,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x65555555,0x66555555,0x66665555,0x66665555,0x66665555,0x66666555,0x66666555,0x66666555
-	.word 0x56666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x44666666
-	.word 0x33335555,0x33335556,0x33335566,0x66665666,0x66666666,0x66666666,0x66666666,0x64466664
-	.word 0x66633333,0x66666633,0x66666666,0x66666666,0x66666666,0x66666666,0x66666664,0x66666644
-	.word 0x33333333,0x33333336,0x33333366,0x33333366,0x33333366,0x33333366,0x33333366,0x33333336
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133
-	.word 0x11111111,0x11111111,0x11111111,0x22222211,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66666555,0x66666555,0x66666555,0x66665555,0x66665555,0x66655555,0x44555555,0x45555555
-
-	.word 0x44466666,0x44466666,0x44466666,0x44466666,0x44466666,0x44666444,0x66644444,0x44444444
-	.word 0x44446444,0x44444444,0x44444444,0x44444444,0x44777774,0x47777774,0x77777777,0x77777777
-	.word 0x66666644,0x66666644,0x36666644,0x36666444,0x36666444,0x66666644,0x66666664,0x66666666
-	.word 0x33333336,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333336,0x33333366
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x35555533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x45555555,0x44555555,0x44555555,0x66555555,0x66555555,0x66455555,0x66455555,0x66455555
-	.word 0x44444444,0x44444444,0x44444444,0x44444446,0x44444466,0x44444666,0x44444666,0x44446666
-	.word 0x66667774,0x66666674,0x66666664,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x33333666,0x53336666,0x55536666,0x55556666,0x55556666,0x55553666,0x55533366,0x55533366
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333335,0x33333355,0x33333355,0x33333555,0x33333555,0x33335555,0x33335555,0x33333555
-	.word 0x11111133,0x11111133,0x22111133,0x11211133,0x11211133,0x11211133,0x22111133,0x11111133
-	.word 0x11111111,0x11111111,0x12221112,0x21112121,0x21112111,0x21112111,0x12221122,0x11111111
-	.word 0x11111111,0x11111111,0x11122121,0x11211221,0x11211121,0x11211121,0x11211121,0x11111111
-	.word 0x11111121,0x11111121,0x22112222,0x11211121,0x11211121,0x11211121,0x22112211,0x11111111
-	.word 0x11211111,0x11111111,0x11211122,0x11211121,0x11211121,0x11211122,0x11211121,0x11111111
-	.word 0x11111111,0x11111111,0x11122121,0x21211221,0x11211121,0x11211121,0x21211121,0x11111111
-
-	.word 0x11111111,0x11111111,0x11112222,0x11111111,0x11111222,0x11112111,0x11111222,0x11111111
-	.word 0x22111111,0x11211111,0x12221111,0x11211111,0x11211111,0x11211111,0x11211111,0x11111111
-	.word 0x11112111,0x11112111,0x11112111,0x21112111,0x21112111,0x21112111,0x11122111,0x11111111
-	.word 0x11111111,0x11111111,0x21211222,0x21212111,0x21212111,0x21212111,0x32111222,0x11111111
-	.word 0x11111111,0x11111111,0x12221121,0x21112121,0x22222121,0x11112121,0x22221112,0x11111111
-	.word 0x11111111,0x11111111,0x11122121,0x21211221,0x11111121,0x11111121,0x11111121,0x11111111
-	.word 0x21111111,0x21111111,0x21111111,0x21112222,0x21111111,0x21111111,0x21111111,0x11111111
-	.word 0x11211111,0x11111111,0x11211111,0x11211111,0x11211111,0x11211111,0x11211112,0x11111111
-
-	.word 0x11111121,0x11111121,0x11121121,0x21112121,0x21112221,0x21121121,0x11211121,0x11111111
-	.word 0x11111111,0x11111111,0x11111222,0x11112111,0x11112222,0x11111111,0x11112222,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66455555,0x64555555,0x44555555,0x45555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x44466666,0x44666666,0x44666666,0x44666666,0x44446644,0x44466455,0x34444555,0x33355555
-	.word 0x66666666,0x66666664,0x66666664,0x66666664,0x66666664,0x66666643,0x66666443,0x55544455
-	.word 0x66666666,0x36666666,0x33366666,0x33336666,0x33355666,0x33555666,0x33555556,0x33555555
-	.word 0x55533336,0x55333333,0x55333333,0x53333333,0x33333333,0x33333333,0x53333333,0x53333333
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x35555555,0x33333333,0x33333333
-	.word 0x33333555,0x33333355,0x33333355,0x33333355,0x33333335,0x33333333,0x33333333,0x33333333
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x21111133,0x12111133,0x12111133
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22211222,0x11121211,0x22221211
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11221211,0x12112212,0x12111212
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21112221,0x11121112,0x11122222
-	.word 0x11111111,0x11111111,0x11111111,0x12111112,0x11111112,0x12111222,0x12111112,0x12111112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222111,0x12111211,0x11111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122221,0x11121112,0x11121112
-	.word 0x11111111,0x11111111,0x11111111,0x12111112,0x12111112,0x12111112,0x12111112,0x12111112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12111211,0x12111211,0x12111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21111111,0x12111111,0x22111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22121122,0x11221211,0x11121222
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12222111,0x12111212,0x12111212
-	.word 0x11111111,0x11111111,0x11111111,0x11111211,0x11111111,0x12111211,0x22111211,0x12111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22211122,0x11121211,0x22221211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222111,0x12111212,0x12222212
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21112212,0x12121122,0x22111112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22211122,0x11121211,0x11121222
-	.word 0x33111111,0x33111111,0x33111111,0x33111112,0x33111112,0x33111112,0x33111112,0x33111112
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x53555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555553
-	.word 0x33555555,0x33555555,0x33555555,0x33355555,0x33355555,0x33355555,0x33335555,0x33333555
-	.word 0x35333333,0x35333333,0x35333333,0x33533333,0x33353333,0x33335333,0x33335333,0x33335333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x12111133,0x21111133,0x11111133,0x21111133,0x11111133,0x11111133,0x11111133,0x11111133
-	.word 0x11121211,0x22211222,0x11111211,0x11111122,0x11111111,0x11111111,0x11111111,0x11111122
-	.word 0x12111211,0x12111212,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111112,0x11122221,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111112,0x12111221,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11211111
-	.word 0x11111211,0x12222111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11122112,0x11121221,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111112,0x22111122,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111211,0x12222111,0x12111111,0x11222111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111111,0x21111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11121111,0x11121222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111212,0x12222112,0x12111111,0x11222111,0x11111111,0x11111111,0x11111111,0x11211111
-	.word 0x12111211,0x12111211,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11121211,0x22211211,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11211111
-
-	.word 0x11111211,0x12222112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111112,0x21111112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11121111,0x22211222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21111111
-	.word 0x33111112,0x33111112,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x35555555
-	.word 0x55555333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333355,0x33333533,0x33333533,0x33335533,0x33335333,0x33355333,0x33353333,0x53533333
-	.word 0x33333533,0x33333533,0x33333553,0x33333353,0x33333355,0x33333335,0x33333335,0x33333335
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x21111133,0x22111133,0x21111133,0x21111133,0x21111133,0x21111133,0x11111133,0x11111133
-	.word 0x11111111,0x21112112,0x21112111,0x21112111,0x22112111,0x21221111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11122121,0x21211221,0x21211121,0x21211121,0x11211121,0x11111111,0x11111111
-	.word 0x11111111,0x22112222,0x11212111,0x11212111,0x11212111,0x22112222,0x11112111,0x11111222
-	.word 0x11211111,0x11211122,0x11211121,0x11211121,0x11211122,0x12211121,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x21111111,0x11111111,0x11111111,0x21111111,0x11111111,0x11111111
-	.word 0x11111111,0x22212222,0x11211111,0x11211222,0x11212111,0x22211222,0x11211111,0x11211111
-	.word 0x11111111,0x12221112,0x21112121,0x21112121,0x21112121,0x12221112,0x11111111,0x11111111
-	.word 0x11111111,0x11122121,0x21211221,0x21111121,0x21111121,0x11111121,0x11111111,0x11111111
-	.word 0x11111111,0x22111222,0x11212111,0x22112222,0x11111111,0x22212222,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111122,0x11111111,0x11111112,0x11111121,0x11111112,0x11111111,0x11111111
-	.word 0x11211111,0x11222211,0x21211121,0x21211121,0x21211121,0x11222211,0x11111111,0x11111111
-	.word 0x11111111,0x22111222,0x11212111,0x22112222,0x11111111,0x22212222,0x11111111,0x11111111
-	.word 0x11111111,0x11211122,0x11211111,0x11211112,0x11211121,0x11211112,0x11111111,0x11111111
-	.word 0x11111111,0x21222211,0x21211121,0x21211121,0x21211121,0x21222211,0x11211111,0x11122211
-	.word 0x11111111,0x22111221,0x11212112,0x22212111,0x11212111,0x22112111,0x11111111,0x11111111
-	.word 0x21111111,0x22221112,0x21112121,0x21112122,0x21112111,0x22221122,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x33333335,0x33333335,0x33333335,0x33333335,0x33333335,0x33333335,0x33333335
-	.word 0x33555555,0x35533333,0x53333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x53533333,0x55533333,0x55333333,0x55333355,0x35335553,0x35355333,0x33353333,0x33533333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x66463333,0x44444633
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333366,0x33333666
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x21111133,0x22111133,0x21111133,0x21111133
-	.word 0x11111111,0x11111111,0x11111111,0x11111122,0x11111111,0x12221112,0x21112111,0x21112111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122121,0x11211221,0x11111121
-	.word 0x11111111,0x11111111,0x11111111,0x12111111,0x12111111,0x22211111,0x12111111,0x12111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111211,0x11111211,0x11222212,0x12111211,0x12111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11112221,0x11121112,0x11122222
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21112111,0x21112111,0x12121111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222211,0x21211121,0x21211121
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11211222,0x11212111,0x11211111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21112121,0x21112121,0x21112121
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122221,0x11212121,0x11212121
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22211111,0x11121111,0x11121111
-	.word 0x11111111,0x11111111,0x11111111,0x12211111,0x11121111,0x11222111,0x11121112,0x11121112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22111111,0x11211111,0x22111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12222122,0x21112111,0x21112112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222211,0x21211121,0x21211121
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22111222,0x11212111,0x22211111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111112,0x33111121,0x33111122
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x35555555,0x33555555,0x33355555
-
-	.word 0x33333335,0x33333335,0x33333335,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x43333333,0x46666633,0x46666643,0x66666443,0x66664443
-	.word 0x44444433,0x44444463,0x44444443,0x44444444,0x44444444,0x44444444,0x44474444,0x44474446
-	.word 0x33336666,0x33336666,0x33366664,0x33366664,0x33366644,0x33366444,0x33364444,0x64644444
-	.word 0x21111133,0x21111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133
-	.word 0x21112111,0x12221111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111121,0x11111121,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111111,0x21111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111211,0x12111212,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111112,0x11122221,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12121111,0x11211111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21221121,0x11212211,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11211111,0x22112222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22112122,0x21221121,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11212121,0x11212121,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11121111,0x22211111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11121112,0x11121111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x22211111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21112121,0x12222112,0x11112111,0x11112111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21221121,0x11212211,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11211111,0x22112222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111122,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33335555,0x33355555,0x33555555,0x35555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333355,0x33333555,0x53335555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35555333,0x55555553,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333335,0x33333355
-	.word 0x66666444,0x66644444,0x66644444,0x44444444,0x74444444,0x44444444,0x44444444,0x44444443
-
-	.word 0x44477446,0x44477774,0x44477777,0x44447777,0x44447777,0x44444444,0x44444444,0x44444444
-	.word 0x66644444,0x66644444,0x66444444,0x64444444,0x64444444,0x44444444,0x34444444,0x33444444
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33311111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55335555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333555,0x33333555,0x33335555,0x55535555,0x33555555,0x33335555,0x33335555,0x33335555
-	.word 0x44444443,0x44444443,0x44444443,0x44444445,0x44444446,0x44444444,0x44444444,0x44444463
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44434444,0x63334444,0x33334444,0x33336444
-	.word 0x33444444,0x33444444,0x33444444,0x55444444,0x53344444,0x33336644,0x33333333,0x33333333
-	.word 0x11111333,0x11113333,0x11133333,0x13333333,0x33333335,0x33333355,0x33333553,0x33333533
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444333,0x44444333,0x44433333,0x33333333
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33344444,0x33333444,0x33333344,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33311111,0x33331111,0x33333111,0x33333331,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x33333355,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33335555,0x33333555,0x33335555,0x33355555,0x22233333,0x33355555,0x33355555,0x33355555
-	.word 0x44446633,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333644,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33335333,0x33355333,0x33353333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33222222,0x33333333,0x33333333,0x33333333
+	.word 0x003BA010,0xF0000032,0x55019001,0x33014055,0x5533330E,0xD0070053,0x331E7003,0xF00D70FF
+	.word 0xF01FF001,0xF015F01F,0xF001F01F,0x01F0D51F,0x40351FE0,0x18103303,0x0F030035,0x22222222
+	.word 0x01F02310,0x1FF00130,0xF01FF0CF,0xF0666315,0x6001701F,0xFF1FF01C,0x1FF05FF0,0x16F01FF0
+	.word 0x01F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF01F,0xF001F01F,0xF001F01F,0x1FF0FF1F,0x1FF01FF0
+	.word 0x1FF016F0,0x1FF001F0,0xF0FB01F0,0xF01FF01F,0x001FB01F,0x03E02305,0xC0F973F3,0xF001F003
+	.word 0x4001F001,0xE0444501,0x44440312,0x44444554,0x33F00160,0x540170BF,0x011012F0,0x5A139500
+	.word 0x77030150,0x53C900EF,0x55011067,0x17200800,0x01F09633,0x0001F0E0,0x634B0301,0x66336666
+	.word 0x0066663E,0x10032006,0x20450301,0x10A83603,0x12203618,0x11020016,0x11386666,0x00060011
+
+	.word 0x36219007,0x117F1133,0x65D001B0,0x1FF01FF0,0x1FF01FF0,0xF0FF1FF0,0xF01FF01F,0xF01FF01F
+	.word 0xF01FF01F,0xFF1FF01F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0xF01FF0FD,0xF01FF01F
+	.word 0x901FF01F,0x23103101,0x100400DF,0x08101119,0x03A073F3,0x03C073F3,0xD301F0DF,0x03A04462
+	.word 0x5F135303,0x01600350,0x0340745C,0x00060077,0x54017003,0x0400BF35,0x3003F033,0x00492303
+	.word 0x3003F087,0x0100FD03,0x0B90EB56,0x1311FF66,0x10358F13,0x3000FF04,0x2F910410,0x01F06643
+	.word 0x04107B13,0xF0D86301,0x21036003,0x01108FD1,0x3C122221,0x01002211,0x1DF00510,0x22220100
+	.word 0x12211107,0x1D001221,0x208020F0,0xF00300FE,0x0061301A,0xF064001B,0x213D3020,0x105F30FF
+	.word 0xD02E3001,0xF00B002A,0xF09FF03E,0x88E0FF20,0xFF1012F0,0xFD006110,0x1DF04700,0x223E7E10
+
+	.word 0x301A0012,0x201DF001,0x2119009A,0x501DF0FF,0xF05F315F,0x101F509F,0xF01B0020,0xA0A0FF3F
+	.word 0x21F02700,0x7FF18130,0x3A1040E0,0x317F0310,0x03A09313,0x03203500,0x73F30B10,0xF0FF7FF3
+	.word 0xF07FF303,0xA37E6301,0x90DF166F,0x8569931F,0x45340180,0x59033444,0x3F630335,0x02003334
+	.word 0x01E0BB66,0xCD266713,0x23FE01F0,0xF01D105B,0xF001F03C,0x00816301,0x10EF6304,0x1003C008
+	.word 0x63133313,0x7FA30380,0x11FF6011,0x110350A1,0x9116238D,0x30CC21C9,0xFF0F2303,0x3530F2E1
+	.word 0x71120820,0x3C6340D0,0x40B00350,0x506753FF,0xB0D90201,0xE03EF03F,0x2203507D,0x92F2FB6E
+	.word 0x03506313,0xFFB001E0,0xB0C93012,0x01A0FF60,0x8090F3E2,0x3FD00300,0x03700813,0x23FF0100
+	.word 0xF032707B,0x64FEF03F,0x50A0F07E,0xFF7FF1F9,0x243041A0,0x0300E500,0x6F6320E1,0x03907353
+
+	.word 0xF373F3FF,0xF303F07F,0xF001F07F,0x2001F001,0x072AFF01,0x3C9A0380,0x01F057F3,0x01F001F0
+	.word 0x00FE01F0,0x065FB001,0x80CB13FB,0x331F9088,0xD0BF35E5,0x50E135A7,0x01F003C0,0x01F001F0
+	.word 0xF0FF01F0,0xE2D21201,0x4601602C,0x4018F023,0xFFE22501,0x1F80BFF5,0x1FF0C712,0xE7127950
+	.word 0x7F803EF0,0xC0BEF6FE,0xF0432620,0x267C2020,0x21BF90A3,0x30A2F7FF,0xF06763E3,0xA07FF07F
+	.word 0xF06347C3,0x3F30FF19,0x01F03FF1,0x01F001F0,0x7FF312F2,0xF3FF03F0,0xF303F07F,0xF001F07F
+	.word 0x5001F001,0xDF279A01,0x24437FF3,0x2D020035,0x130340BF,0xFF362337,0x01F05EF3,0xA22A01F0
+	.word 0x4F370390,0xA353872A,0x1303C0FF,0xF1408083,0xF07FF354,0xF001F001,0x0150FF01,0x05C6C1C5
+	.word 0x3C421DF0,0xB8421E40,0x17FF4F23,0x8703105E,0x30D77603,0xD782D727,0xFF03201E,0x01F05F90
+
+	.word 0x20705A13,0x22B640F0,0x1FA0BFF0,0xD03EF0FF,0xA001F03E,0xB71EF07F,0xF47FF063,0x01F0FFD5
+	.word 0x01F001F0,0x16F20150,0x03F07FF3,0xF0E27FF3,0xF07FF303,0x65555501,0xDB660300,0x03700200
+	.word 0x00037065,0x59FD5601,0x44560160,0x0056EB12,0x03106603,0x1D6429C0,0x0A644666,0xC0873D06
+	.word 0x3C106401,0x00A31DDF,0x030036C5,0x03103CDA,0x01F01710,0xF001F0FF,0xF07FF301,0xFC7FF303
+	.word 0xF01EE0F0,0x1FF0FF1F,0x1FF001F0,0x1FF001F0,0x1FF01FF0,0xF0FF1FF0,0xF01FF016,0xF01FF001
+	.word 0xF01FF001,0xFF1FF01F,0x01F01FF0,0x01F01FF0,0x1FF01FF0,0x1FD01FF0,0xF214F0FF,0xF07FF312
+	.word 0xF07FF303,0xF07FF303,0x7D03EA01,0x83636F83,0x55030065,0x0C555B03,0x46666645,0x03B02603
+	.word 0x66786444,0x0420020E,0x18BE0600,0x8E777774,0x77470310,0x13013077,0x36034063,0x303200FF
+
+	.word 0x107F4303,0x3063F301,0xF0935301,0x0180FF01,0x15F0EC16,0x03F07FF3,0x01F07FF3,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x12F201F0,0x03F07FF3,0x03F07FF3
+	.word 0xF0DE7FF3,0x45011001,0x03106B43,0x03007713,0x0360EF45,0x79035B93,0x13101044,0x00032082
+	.word 0x7774070C,0x83746666,0xF001F04F,0x01A0E101,0x05076803,0x53666653,0x367F8177,0x630A0300
+	.word 0xAEF00310,0x801301B0,0x20F96E1A,0x2EF75A03,0x71FF4A0B,0x0C33224C,0x0370F3B8,0x84710F10
+	.word 0x2121F519,0x01401800,0xAD0609EF,0x21E01C3D,0x0190BE0F,0x03401720,0xA0AB1CFF,0x30BB6C1B
+	.word 0x604C0D27,0xF00B5001,0x90217F5F,0x5520A082,0x109520BA,0x30C1995E,0xFD19FF81,0x3E409180
+
+	.word 0x018012B0,0xFD301CBE,0x00B30370,0x9FA0324D,0x22222160,0x05BB9910,0xA0BF90FF,0x1E81A07D
+	.word 0x50A0F051,0x001AB029,0x15C0FF4D,0x7F101100,0x0B004300,0xBFB02721,0x51FF1741,0xF0EAF627
+	.word 0xF3013001,0xF07FF377,0xF37FF303,0xBEF203F0,0x672301F0,0xEF566455,0x36F01DD0,0x03C256F3
+	.word 0x55020070,0x0E444664,0x34444555,0x4B5AFD12,0xC7430390,0x08000310,0x00544455,0x1365333F
+	.word 0x6D1A9A68,0x33005666,0x4D56B00A,0x3DDF36AF,0x530350CB,0x0B10B986,0x7673C1F0,0x13FA0237
+	.word 0xE740806F,0x1054F110,0x03002103,0x0310E212,0x8B228EF1,0x00121122,0xF1DF121A,0x120120C5
+	.word 0x21101E00,0x1CF08E0D,0x1DFF9F2C,0xB00302A9,0x4D51101E,0x105D20CA,0xFF3DF003,0x19004030
+	.word 0x1E605DF0,0x20D01C30,0x03905350,0x203DF0FF,0xC040F028,0x544E3062,0x3001B043,0xA114FFFD
+
+	.word 0xA0503EF0,0x1FE11B11,0x79300D50,0xF0FB4300,0xF15F307F,0x105FC07F,0x1E00121E,0x10FF3FF0
+	.word 0x1E40405E,0x701DF08A,0x62BF405F,0xFF0D0016,0x73F303E0,0x03F07FF3,0x01F07FF3,0x01F001F0
+	.word 0xF00120FE,0xF001F045,0x23387001,0x35033067,0x460380FF,0x4032339F,0x40721303,0xF0035006
+	.word 0x01F0FF01,0x7F9301F0,0x6F136713,0x7FBA7753,0x11FF8721,0x20ACF18F,0xE247F20F,0xF00F1352
+	.word 0x7F1F6019,0xF08C2312,0xF039101A,0x263FD040,0xFF1EF057,0xA7005F90,0x207067F2,0x5F204000
+	.word 0x1FF00710,0xF08140FF,0xF31E7016,0x111D8067,0x405FF01F,0xDF20FF01,0x40C0E7F3,0x98F0E400
+	.word 0x1E103F70,0x70FF3FF0,0xF04110BC,0xF0BFA0BF,0x5360505F,0xFF0B0067,0x7FF303F0,0x73F37FF3
+	.word 0x01F07FF3,0x01F001F0,0xF001F0DF,0xA1163501,0x0170F4F2,0x61531C20,0x53E156A7,0x53531050
+
+	.word 0x76437963,0x50FFC356,0xF001F003,0xA301F001,0x1A73137F,0xFF07106B,0xFF6D0390,0xCE1256CA
+	.word 0x1B8ACFA1,0xC4A10350,0x2A7B1AFF,0x3003402E,0x7A235A0F,0xF27B8A6F,0x43B2FF4F,0x3F127BCA
+	.word 0x5F30012A,0xC2794F22,0x50FF3B5B,0xF00F1003,0x501B2ABF,0x16BFB003,0xFFB7508B,0x1F806F60
+	.word 0x71402751,0xF439BCB0,0xFCD9BC9A,0xD05FF0FF,0x10737A5F,0x917B5A01,0x105FC000,0x846BFFC6
+	.word 0xD930F020,0x8FA48741,0x40201E10,0x00FF205C,0xF31F9086,0xF07FF377,0xF07FF303,0xFF7FF303
+	.word 0x01F001F0,0x13C364F3,0x1E000390,0xADF65053,0x030120FD,0x16634A63,0x030900F2,0x2F0035B3
+	.word 0xF032F0F1,0x7001F001,0x33664601,0xF0EF830E,0x0A013017,0x5B1E33EA,0x8FB354F1,0x32FF67F2
+	.word 0xC0E4ADCF,0xE00B7E01,0x3607361A,0xFF0B4008,0x56291DF0,0x5F7017F6,0x5EF91E40,0x9B502050
+
+	.word 0x3098F6FF,0xF00F73C8,0x435F2B1C,0x301EF085,0x68F4FFDF,0x8B1D9FB0,0x1DF02030,0xFEFAC170
+	.word 0x31FF7714,0xB0FEF01E,0xF69B40A2,0x201410B7,0xFF82F180,0xFFF02070,0x0F441EA0,0x22E2A741
+	.word 0x1D000F17,0x1C00337F,0x7FF373F3,0x7FF373F3,0x01F001F0,0x1372A3FF,0xF6791357,0xF001F08B
+	.word 0xF001F001,0x01F0D501,0x0E430100,0x3F0E4624,0x413F1E46,0x33710E43,0x63444444,0x43630300
+	.word 0x01B00300,0x00464447,0xB5532E03,0x03640300,0x4403106C,0x00640310,0x10444F03,0xD6646403
+	.word 0x217FEAEF,0xFFE8F2C3,0x03403162,0x016001F0,0x1DB0BFF9,0x3CD0BFFA,0x907EF0FF,0xA05EF921
+	.word 0xB7D5059F,0x4621F0AE,0x01F0FF77,0x40F0E927,0x67F33D90,0x25109FD0,0x60FF5FF0,0xF087F31D
+	.word 0x703FF001,0x2367137F,0xFF06F16F,0xBEF01220,0xFFF021E0,0x67230190,0x03F00710,0xF37FF3FF
+
+	.word 0xF373F37F,0x7001F07F,0x1D981601,0xA32DFF8F,0x1DC07713,0xCC2601F0,0x1D009003,0x531EC0F6
+	.word 0x76903555,0x01303DF0,0xF6448E5A,0x27036703,0x01200340,0x13615374,0x74004673,0x77744447
+	.word 0xBD774447,0x20440320,0x6001B003,0x6403103B,0x10BB0340,0x03003401,0x0390FFF6,0xF08CF113
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FB,0xF201A001,0x3103601A
+	.word 0x7FF373F3,0xF373F3FF,0xF001F07F,0x3301F001,0xF012F041,0x01F0FF01,0xA7130150,0x0300AB33
+	.word 0x0B409020,0x13DF0330,0x45035063,0x59836F13,0x01F0F716,0x337D2910,0xBB131A00,0x08000300
+	.word 0x03550380,0x44533F76,0x01507C1A,0x84136303,0x0D100810,0x47866EFF,0x008CE1D4,0x0003205E
+
+	.word 0xD03E1004,0x5F00AF1F,0x33020033,0x3FE0F85A,0x1FF067C4,0xF01FF0FF,0xF01FF01F,0xF01FF01F
+	.word 0xF01FF01F,0x1FF0FF1F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0xF0FE1FF0,0xF01FF01F,0xF01FF01F
+	.word 0x101FF01F,0x22FF311F,0x136A131D,0xF301F06D,0x807FF373,0xFF150003,0x4D8304F3,0x1FF01FF0
+	.word 0x1FF016F0,0x1FF001F0,0x731140E6,0x23F4127F,0x306F3722,0x06C33303,0x22ED90B5,0x90222222
+	.word 0xFF460A0F,0x1FD00DA1,0x1FE001D0,0x6C53A117,0x3FF01FF0,0xF01FF0FF,0xF016F01F,0xF001F01F
+	.word 0xF001F01F,0x1FF0FF1F,0x1FF01FF0,0x1FF001F0,0x1FF001F0,0xF0FF1FF0,0xF01FF01F,0xF01FF016
+	.word 0xF01FF001,0xFF1FF001,0x1FF01FF0,0x01F01FF0,0x01401FF0,0x1ED06FB3
 
 	.section .rodata
 	.align	2
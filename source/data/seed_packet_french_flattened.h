@@ -6,8 +6,8 @@
 //	seed_packet_french_flattened, 3816x8@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 477 tiles not compressed
-//	Total size: 512 + 15264 = 15776
+//	+ 477 tiles lz77 compressed, 15264 bytes raw
+//	Total size: 512 + 3028 = 3540
 //
 //	Time-stamp: 2021-11-02, 19:04:10
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_SEED_PACKET_FRENCH_FLATTENED_H
 #define GRIT_SEED_PACKET_FRENCH_FLATTENED_H
 
-#define seed_packet_french_flattenedTilesLen 15264
-extern const unsigned int seed_packet_french_flattenedTiles[3816];
+#define seed_packet_french_flattenedTilesLen 3028
+extern const unsigned int seed_packet_french_flattenedTiles[757];
 
 #define seed_packet_french_flattenedPalLen 512
 extern const unsigned short seed_packet_french_flattenedPal[256];
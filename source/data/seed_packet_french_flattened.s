@@ -6,8 +6,8 @@
 @	seed_packet_french_flattened, 3816x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 477 tiles not compressed
-@	Total size: 512 + 15264 = 15776
+@	+ 477 tiles lz77 compressed, 15264 bytes raw
+@	Total size: 512 + 3028 = 3540
 @
 @	Time-stamp: 2021-11-02, 19:04:10
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,545 +17,115 @@
 
 	.section .rodata
 	.align	2
-	.global seed_packet_french_flattenedTiles		@ 15264 unsigned chars
+	.global seed_packet_french_flattenedTiles		@ 3028 unsigned chars
 	.hidden seed_packet_french_flattenedTiles
 seed_packet_french_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55555555,0x55555555,0x44444455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x45555555,0x45555555,0x44555555
-
-	.word 0x44444455,0x44444445,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11144444,0x11111666
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444111,0x44411111
-	.word 0x44444444,0x44444444,0x44222222,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x33355555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x53333355,0x33333335,0x33333333,0x33333333
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555553
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x54555555,0x55455555,0x55555555,0x55555555
-	.word 0x44445555,0x44444455,0x44444455,0x44444445,0x44444444,0x44444555,0x44445555,0x44555555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x66644444,0x66666444,0x66666644,0x66666664,0x66666664,0x66666666
-	.word 0x11111166,0x11111116,0x11111116,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x21111111,0x22111111,0x22111111,0x22111111,0x22111111
-	.word 0x11111111,0x11111111,0x11111222,0x21112111,0x11122222,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x21222121,0x12211222,0x12211221,0x12211221,0x12211221,0x12211221
-	.word 0x11111111,0x11111111,0x11111122,0x22111221,0x21111221,0x21111221,0x21111221,0x21111221
-	.word 0x11111111,0x11111111,0x11112222,0x11122112,0x11221112,0x11221112,0x11221112,0x11221112
-	.word 0x11111111,0x11111111,0x12222221,0x12212211,0x11112211,0x11112211,0x11112211,0x11112211
-
-	.word 0x11111111,0x11111111,0x12221111,0x21112111,0x22222211,0x11112211,0x11112211,0x11112211
-	.word 0x11111111,0x11111111,0x22211111,0x11221111,0x11221112,0x12211111,0x22111111,0x21111111
-	.word 0x11111111,0x11111111,0x22211112,0x11221112,0x11221111,0x12211111,0x22111112,0x21111112
-	.word 0x11111111,0x11111111,0x11111112,0x11111112,0x11111111,0x11111111,0x11111112,0x11111112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x41111111,0x41111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333555,0x33333555,0x33333555,0x33333555,0x33333355,0x33333335,0x33333335,0x33333335
-	.word 0x33333333,0x33333333,0x33337333,0x33337333,0x33337733,0x33337773,0x33333333,0x33333333
-	.word 0x45533333,0x44333333,0x44333333,0x44333333,0x44333333,0x44333333,0x44333333,0x44333333
-	.word 0x55554444,0x55555444,0x55555444,0x55555444,0x55555444,0x55555444,0x55555444,0x55555444
-	.word 0x45555555,0x45555555,0x55555555,0x45555555,0x45555555,0x45555555,0x45555555,0x44555555
-
-	.word 0x44444444,0x44444555,0x44455545,0x55544444,0x54444444,0x44444444,0x44444444,0x44444444
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666644
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11112112,0x11111222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x12211221,0x12222222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111221,0x21111222,0x21111111,0x21111111,0x21111111,0x21111111,0x22111111,0x11111111
-	.word 0x11122112,0x11112222,0x11111112,0x11111112,0x11111112,0x11111112,0x11111112,0x11111111
-	.word 0x11112211,0x11122221,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21122111,0x12221111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21121111,0x22221111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21121112,0x22221111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333335,0x33333335,0x33333335,0x33333335,0x53333355,0x55555555,0x55555555,0x55555555
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x43333333,0x44433335,0x44455555
-	.word 0x44433333,0x44444333,0x44444445,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x55555444,0x55554444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44445555,0x44444555,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x66664444,0x64444444,0x66444444,0x66444444,0x66444444,0x66444444,0x64444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x22121111,0x11222111,0x11221111,0x11221111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x21111112,0x12111122,0x22111122,0x11111122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111122,0x11111221,0x11111221,0x11111221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11122221,0x11121122,0x11111122,0x11111221
-	.word 0x11111111,0x11111111,0x11111111,0x11111211,0x11122222,0x11111221,0x11111221,0x11111221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11221122,0x11221122,0x11221122,0x11221122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x22222211,0x22122111,0x11122111,0x11122111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11121111,0x12222211,0x11122111,0x11122111,0x11122111
-	.word 0x11111221,0x11112211,0x11111111,0x11111111,0x11112111,0x11112221,0x11112211,0x11112211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x12211221,0x12211221,0x12211221,0x12211221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x22121111,0x11222211,0x11221111,0x11221111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11122212,0x11221122,0x11221122,0x11221122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44555555,0x44555555,0x44555555,0x44555555,0x45555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x55555555
-
-	.word 0x44444444,0x44444444,0x55544444,0x55555444,0x55555544,0x55555544,0x55555544,0x55555555
-	.word 0x44444444,0x44444444,0x44445555,0x44455555,0x44555555,0x44555555,0x45555555,0x45555555
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11221111,0x11221111,0x11221111,0x11222111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111122,0x22111122,0x22111122,0x22111222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111222,0x11111221,0x11111221,0x11122212,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11122211,0x11122111,0x11122112,0x11112222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111221,0x11111221,0x11111221,0x11122221,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11221122,0x11221122,0x11221122,0x12222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11122111,0x11122111,0x11122111,0x11222211,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11122111,0x11122111,0x11122111,0x12222111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11112211,0x11112211,0x11112211,0x11122221,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12211221,0x12211221,0x12211221,0x22222221,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11221111,0x11221111,0x11221111,0x22222111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11221122,0x11221122,0x11221122,0x11222122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x45555555,0x45555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444444,0x44444444,0x44444444,0x54444444,0x45544445,0x44444555,0x44444555,0x44444555
-	.word 0x55544444,0x44555554,0x44444455,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x55555554,0x55555554,0x55555554,0x55555554,0x55555444,0x55544444,0x44444444,0x44444444
-	.word 0x44555555,0x44555555,0x44555555,0x44555555,0x44455555,0x44445555,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12222111,0x22112211,0x22111221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22211111,0x11221111,0x11122111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21111112,0x22111122,0x22111221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21111222,0x22211211,0x21111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22212221,0x21122112,0x21122112
-	.word 0x11111111,0x22111111,0x22111111,0x11111111,0x11111111,0x21111111,0x22211112,0x22111112
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22111111,0x12211111,0x11221111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21111222,0x21111221,0x21111221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122112,0x11122112,0x11122112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122211,0x11211121,0x12222222
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x65555555,0x66555555,0x66665555,0x66665555,0x66665555,0x66666555,0x66666555,0x66666555
-	.word 0x56666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x33666666
-	.word 0x44445555,0x44445556,0x44445566,0x66665666,0x66666666,0x66666666,0x66666666,0x63366663
-	.word 0x66644444,0x66666644,0x66666666,0x66666666,0x66666666,0x66666666,0x66666663,0x66666633
-	.word 0x44444444,0x44444446,0x44444466,0x44444466,0x44444466,0x44444466,0x44444466,0x44444446
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111221,0x11111221,0x11111221,0x11112211,0x12222111,0x11111111,0x11111111,0x11111111
-	.word 0x11122111,0x11122111,0x11122111,0x11221111,0x22211111,0x11111111,0x11111111,0x11111111
-
-	.word 0x21111221,0x11111221,0x11111221,0x12111122,0x22111112,0x11111111,0x11111111,0x11111111
-	.word 0x21111112,0x21111222,0x21111221,0x21111221,0x22111122,0x11111111,0x11111111,0x11111111
-	.word 0x21122112,0x21122112,0x21122112,0x21122112,0x22122222,0x11111111,0x11111111,0x11111111
-	.word 0x22111112,0x22111112,0x22111112,0x22111112,0x22211112,0x11111111,0x11111111,0x11111111
-	.word 0x11221111,0x11221111,0x11221111,0x12211111,0x22111112,0x11111111,0x11111111,0x11111111
-	.word 0x21111221,0x21111221,0x21111221,0x21111221,0x21111222,0x11111221,0x11111221,0x11111221
-	.word 0x11122112,0x11122112,0x11122112,0x11122112,0x11222222,0x11111111,0x11111111,0x11111111
-	.word 0x11111122,0x11111122,0x11111122,0x11211221,0x11122211,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66666555,0x66666555,0x66666555,0x66665555,0x66665555,0x66655555,0x33555555,0x35555555
-
-	.word 0x33366666,0x33366666,0x33366666,0x33366666,0x33366666,0x33666333,0x66633333,0x33333333
-	.word 0x33336333,0x33333333,0x33333333,0x33333333,0x33777773,0x37777773,0x77777777,0x77777777
-	.word 0x66666633,0x66666633,0x46666633,0x46666333,0x46666333,0x66666633,0x66666663,0x66666666
-	.word 0x44444446,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444446,0x44444466
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x45555544
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222211,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11112111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11112111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x21111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x12111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111221,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x35555555,0x33555555,0x33555555,0x66555555,0x66555555,0x66355555,0x66355555,0x66355555
-	.word 0x33333333,0x33333333,0x33333333,0x33333336,0x33333366,0x33333666,0x33333666,0x33336666
-	.word 0x66667773,0x66666673,0x66666663,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x44444666,0x54446666,0x55546666,0x55556666,0x55556666,0x55554666,0x55544466,0x55544466
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444445,0x44444455,0x44444455,0x44444555,0x44444555,0x44445555,0x44445555,0x44444555
-	.word 0x11111111,0x22111111,0x11211111,0x11211111,0x11211111,0x22111111,0x11111111,0x11111111
-	.word 0x11111111,0x22211112,0x11121121,0x11121111,0x11121111,0x22211122,0x11111111,0x11111111
-	.word 0x11111111,0x12212111,0x21122112,0x21112112,0x21112112,0x21112111,0x11111111,0x11111111
-	.word 0x11112111,0x11222211,0x11112111,0x11112111,0x11112111,0x11221111,0x11111111,0x11111111
-	.word 0x11111111,0x11112111,0x11112111,0x11112111,0x11112111,0x11112111,0x11111111,0x11111111
-	.word 0x11111111,0x21112221,0x21121112,0x21122222,0x21111112,0x21122221,0x11111111,0x11111111
-
-	.word 0x21111111,0x22111221,0x21112112,0x21112111,0x21112111,0x11112111,0x11111111,0x11111111
-	.word 0x11111111,0x11111122,0x11111111,0x11111111,0x11111111,0x11111122,0x11111111,0x11111111
-	.word 0x12111111,0x12222111,0x12111211,0x12111211,0x12111211,0x12222111,0x11111111,0x11111111
-	.word 0x11111111,0x11122211,0x11211121,0x11222221,0x11111121,0x11222211,0x11111111,0x11111111
-	.word 0x11111111,0x11122221,0x11111112,0x11112221,0x11121111,0x11112222,0x11111111,0x11111111
-	.word 0x11111111,0x22211111,0x11121111,0x22211111,0x11111111,0x22221111,0x11111111,0x11111111
-	.word 0x11111111,0x12222112,0x21112111,0x21112111,0x12222112,0x11112111,0x11112111,0x11111111
-	.word 0x11111111,0x11222111,0x12111211,0x12111211,0x12111211,0x11222111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11122121,0x11211221,0x11111121,0x11111121,0x11111121,0x11111111,0x11111111
-	.word 0x11111111,0x11112221,0x21121112,0x11122222,0x11111112,0x21122221,0x11111111,0x11111111
-	.word 0x11111111,0x11112222,0x11111111,0x11111222,0x11112111,0x11111222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66355555,0x63555555,0x33555555,0x35555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x33366666,0x33666666,0x33666666,0x33666666,0x33336633,0x33366355,0x43333555,0x44455555
-	.word 0x66666666,0x66666663,0x66666663,0x66666663,0x66666663,0x66666634,0x66666334,0x55533355
-	.word 0x66666666,0x46666666,0x44466666,0x44446666,0x44455666,0x44555666,0x44555556,0x44555555
-	.word 0x55544446,0x55444444,0x55444444,0x54444444,0x44444444,0x44444444,0x54444444,0x54444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x45555555,0x44444444,0x44444444
-	.word 0x44444555,0x44444455,0x44444455,0x44444455,0x44444445,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x21211111,0x12211111,0x11211111,0x11211111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x22211112,0x11121121,0x22221111,0x11121111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x22221111,0x11112112,0x12221112,0x21111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x12222111,0x11111211,0x11222111,0x12111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11122211,0x11211121,0x11222221,0x11111121
-	.word 0x11111111,0x11111111,0x21111111,0x21111111,0x21112222,0x21121212,0x21121212,0x21121212
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111222,0x11112111,0x11112111,0x11112111
-	.word 0x11111111,0x11111111,0x11111112,0x11111112,0x22111112,0x11211112,0x11211112,0x11211112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x22121122,0x11221121,0x11121121,0x11121122
-	.word 0x11111111,0x11111111,0x11112111,0x11112111,0x11222211,0x11112112,0x11112112,0x11112112
-
-	.word 0x11111111,0x11111111,0x12111111,0x21111111,0x22111111,0x11211111,0x11211111,0x11211111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111122,0x11111121,0x11111121,0x11111122
-	.word 0x11111111,0x11111111,0x21111111,0x21111111,0x22221111,0x21112111,0x21112111,0x21112111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11222111,0x12111211,0x12222211,0x11111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11222211,0x11111121,0x11122211,0x11211111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x54555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555554
-	.word 0x44555555,0x44555555,0x44555555,0x44455555,0x44455555,0x44455555,0x44445555,0x44444555
-	.word 0x45444444,0x45444444,0x45444444,0x44544444,0x44454444,0x44445444,0x44445444,0x44445444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11211111,0x11111111,0x11111111,0x11111111,0x11111111,0x12211111,0x11121111,0x11222111
-	.word 0x22211111,0x11111111,0x11111111,0x11111111,0x11111111,0x11112111,0x11112111,0x11112111
-	.word 0x12222112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21112221
-	.word 0x11222211,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12112111
-	.word 0x11222211,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22111122
-	.word 0x21121212,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111122
-
-	.word 0x11111222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22111111
-	.word 0x22111122,0x11111111,0x11111111,0x11111111,0x11111111,0x21111111,0x12111111,0x22211122
-	.word 0x11121121,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12212111
-	.word 0x11221112,0x11111111,0x11111111,0x11111111,0x11111111,0x11211111,0x11121111,0x11222111
-	.word 0x22111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111211,0x11111211,0x11122221
-	.word 0x11111121,0x11111111,0x11111111,0x11111111,0x11111111,0x11111211,0x11111111,0x11111211
-	.word 0x22221111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12112222
-	.word 0x12222111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22111211
-
-	.word 0x11122221,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22221112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12221111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11221211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111211,0x11111211,0x11122221
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x45555555
-	.word 0x55555444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444455,0x44444544,0x44444544,0x44445544,0x44445444,0x44455444,0x44454444,0x54544444
-	.word 0x44444544,0x44444544,0x44444554,0x44444454,0x44444455,0x44444445,0x44444445,0x44444445
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11121111,0x11121111,0x11121111,0x11121111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11112111,0x11112111,0x11112111,0x11122111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x21121112,0x21122222,0x21111112,0x11122221,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22112111,0x12112111,0x12112211,0x12112122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11211211,0x22111111,0x11111111,0x22211111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111112,0x11211121,0x11211112,0x11121111,0x11111111,0x11111111,0x11111111
-	.word 0x11211111,0x11211111,0x22111111,0x11111111,0x22111111,0x11111111,0x11111111,0x11111111
-	.word 0x11121121,0x22221121,0x11121122,0x22211121,0x11111112,0x11111111,0x11111111,0x11111111
-	.word 0x21122112,0x21112112,0x21112111,0x21112112,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111211,0x12222211,0x11111211,0x12222111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111211,0x11111211,0x11111211,0x11122111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111211,0x21111211,0x11111211,0x11111211,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12112111,0x12112111,0x12112222,0x21112111,0x11112111,0x11111111,0x11111111,0x11111111
-	.word 0x11211211,0x22211211,0x11211221,0x22111212,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12121121,0x12121122,0x12121111,0x12121122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21112112,0x22222112,0x11112112,0x22221112,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12112211,0x12111211,0x12111211,0x12111211,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111211,0x11111211,0x11111211,0x11122111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x44444445,0x44444445,0x44444445,0x44444445,0x44444445,0x44444445,0x44444445
-	.word 0x44555555,0x45544444,0x54444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x54544444,0x55544444,0x55444444,0x55444455,0x45445554,0x45455444,0x44454444,0x44544444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x66364444,0x33333644
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444466,0x44444666
-	.word 0x11111111,0x11111111,0x22221111,0x12121111,0x12121111,0x12121111,0x12121111,0x11111111
-	.word 0x11111111,0x11111111,0x12221111,0x21112112,0x21112112,0x21112112,0x12221112,0x11111111
-	.word 0x12111111,0x12111111,0x12222111,0x12111211,0x12111211,0x12111211,0x12222111,0x11111111
-	.word 0x11112111,0x11111111,0x11112111,0x11112111,0x11112111,0x11112111,0x11112111,0x11111111
-	.word 0x11122111,0x11111211,0x11112221,0x11111211,0x11111211,0x11111211,0x11111211,0x11111111
-	.word 0x11111121,0x11111111,0x21111121,0x12111121,0x22111121,0x12111121,0x21111121,0x11111111
-
-	.word 0x11111121,0x11111112,0x22111122,0x11211211,0x22111222,0x11111111,0x22211222,0x11111111
-	.word 0x11111111,0x11111111,0x11111122,0x11111111,0x11111112,0x11111121,0x11111112,0x11111111
-	.word 0x11111111,0x11111111,0x12222111,0x21112111,0x21112111,0x12222111,0x11112111,0x11112111
-	.word 0x11111111,0x11111111,0x11222111,0x12111211,0x12111211,0x12111211,0x11222111,0x11111111
-	.word 0x11111111,0x11111111,0x11211121,0x11211121,0x11211121,0x11221121,0x11212211,0x11111111
-	.word 0x11111111,0x11111111,0x11112212,0x11121122,0x11111112,0x11111112,0x11111112,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x45555555,0x44555555,0x44455555
-
-	.word 0x44444445,0x44444445,0x44444445,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x34444444,0x36666644,0x36666634,0x66666334,0x66663334
-	.word 0x33333344,0x33333364,0x33333334,0x33333333,0x33333333,0x33333333,0x33373333,0x33373336
-	.word 0x44446666,0x44446666,0x44466663,0x44466663,0x44466633,0x44466333,0x44463333,0x63633333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22121111,0x11221111,0x11121111
-	.word 0x11111111,0x11111111,0x11111111,0x12111111,0x11211111,0x12221111,0x21112112,0x22222111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12222111,0x11111211,0x11222111
-	.word 0x11111111,0x11111111,0x11111111,0x11112111,0x11111111,0x11112111,0x11112111,0x11112111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21122221,0x11111112,0x11112221
-	.word 0x11111111,0x11111111,0x11111111,0x11111112,0x11111112,0x21111222,0x12111112,0x22111112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21211122,0x12211211,0x11211222
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111112,0x11111121,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12222111,0x12111211,0x12111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12111211,0x12111211,0x12111211
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21111111,0x21111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11112111,0x11112111,0x11111212
-	.word 0x11111111,0x11111111,0x11111111,0x11111112,0x11111111,0x22111112,0x11211112,0x11211112
-	.word 0x11111111,0x11111111,0x11111111,0x11111121,0x11111121,0x22211122,0x11121121,0x22221121
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111112,0x11111112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44445555,0x44455555,0x44555555,0x45555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444455,0x44444555,0x54445555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x45555444,0x55555554,0x55555555,0x55555555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444445,0x44444455
-	.word 0x66666333,0x66633333,0x66633333,0x33333333,0x73333333,0x33333333,0x33333333,0x33333334
-
-	.word 0x33377336,0x33377773,0x33377777,0x33337777,0x33337777,0x33333333,0x33333333,0x33333333
-	.word 0x66633333,0x66633333,0x66333333,0x63333333,0x63333333,0x33333333,0x43333333,0x44333333
-	.word 0x11121111,0x11121111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11112111,0x22221111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111111,0x11222211,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11112111,0x11112111,0x11111111,0x11111111,0x11111111,0x11111111,0x11211111,0x11211111
-	.word 0x11121111,0x11112222,0x11111111,0x11111111,0x11111111,0x11111111,0x11121111,0x11111111
-	.word 0x12111112,0x21111221,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11211111,0x11211222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111211,0x11111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12211211,0x12122111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12211211,0x12122111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111212,0x11111121,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11211112,0x22111112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11121121,0x22211122,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55445555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444555,0x44444555,0x44445555,0x55545555,0x44555555,0x44445555,0x44445555,0x44445555
-	.word 0x33333334,0x33333334,0x33333334,0x33333335,0x33333336,0x33333333,0x33333333,0x33333364
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33343333,0x64443333,0x44443333,0x44446333
-	.word 0x44333333,0x44333333,0x44333333,0x45333333,0x55433333,0x54446633,0x44444444,0x44444444
-	.word 0x11111111,0x21111111,0x11111111,0x11111111,0x21111114,0x11111115,0x11111155,0x11111544
-	.word 0x22112222,0x12111111,0x12111222,0x22112111,0x12111222,0x12111111,0x11111111,0x11111111
-
-	.word 0x22111122,0x11211211,0x11211211,0x11211122,0x22111111,0x11111111,0x11111111,0x11111111
-	.word 0x22221122,0x11211121,0x11211121,0x11211122,0x22111121,0x11111111,0x11111111,0x11111111
-	.word 0x11121111,0x11121111,0x11121111,0x11121111,0x11121111,0x11111111,0x11111111,0x11111111
-	.word 0x11222211,0x11211121,0x11211121,0x11221121,0x11212211,0x11111111,0x11111111,0x11111111
-	.word 0x11111211,0x11111211,0x11111211,0x11111211,0x11112211,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x41111111,0x41111111,0x44111111,0x44111111,0x44411111,0x44441111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x44444455,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555
-	.word 0x44445555,0x44444555,0x44445555,0x44455555,0x22244444,0x44455555,0x44455555,0x44455555
-	.word 0x33336644,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444633,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11145444,0x44455444,0x44454444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444411,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44222222,0x44444444,0x44444444,0x44444444
+	.word 0x003BA010,0xF0000032,0x55019001,0x44014055,0x5544440E,0xD0070054,0x441E7003,0xF00D70FF
+	.word 0xF01FF001,0xF015F01F,0xF001F01F,0x01F0D51F,0x40451FE0,0x18104403,0x0F030045,0x22222222
+	.word 0x01F02310,0x1FF00130,0xB01FF0C0,0x66111411,0xCF111116,0x01301FF0,0x01301111,0x1FF01FF0
+	.word 0xF0FF1FF0,0xF01FF01F,0xF01FF01F,0xF01FF01F,0xFF1FF01F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0
+	.word 0x1FF01FF0,0xF01FF0FF,0xF01FF01F,0xF01FF01F,0xF01FF01F,0x1FF09E1F,0x23104111,0x1F700400
+	.word 0xFE240500,0x73F303E0,0x01F003C0,0x01F001F0,0x40350140,0x3312E033,0x33355333,0x0160EF33
+	.word 0x017033F0,0x1012F053,0x13950001,0x0150FB5A,0xC9007703,0x01106753,0x20080055,0x9633F217
+	.word 0x01F001F0,0x66640100,0x0F660200,0x66666644,0x03200600,0x63010120,0x206603FF,0xF001F003
+
+	.word 0xF001F001,0xF001F001,0x01F0D601,0x00210120,0x03C02203,0x4C220120,0x211D2012,0xF0082022
+	.word 0x07212101,0x12222122,0x6001E021,0x1723103F,0x00221112,0x03902103,0x20001F60,0x002E10FF
+	.word 0x6003A022,0x1078105F,0x709DF03D,0x9F00DFA1,0xF0224800,0x1041301F,0x20403010,0x0820FF97
+	.word 0x3C001D50,0xA9606010,0xE9102000,0x30FF1F80,0xF00FF003,0xF001F001,0xF001F001,0xBF014001
+	.word 0x40418B13,0xF31CF003,0xF07FF373,0xDF7FF303,0x625301F0,0x0303A033,0x505F1353,0x5C016003
+	.word 0x77034073,0x03000600,0x45530170,0x440400BF,0x033003F0,0x87004923,0x033003F0,0x560100FB
+	.word 0x660B90EB,0x458F53FF,0x30000410,0x930410FF,0xF0665375,0xF18B3301,0xF001F051,0x01F0FF01
+	.word 0x01F001F0,0x012001F0,0x01F06362,0x43FF1313,0x3001F07B,0x0234033C,0x6021F0F2,0xFFD8221F
+
+	.word 0x03D06310,0x73131D23,0x0B107B23,0x012003C0,0x101B00FF,0x7059F040,0xE0A1F080,0xA089A3C1
+	.word 0x1FF0FF1D,0x13F01FC0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xB001F001,0xF373F301,0xF303F07F
+	.word 0xFC01F07F,0x6FA37E63,0x1F90DF16,0x01806993,0x33293543,0x45590343,0x44436303,0x66FF0200
+	.word 0x1301E0BB,0xF0CD2667,0x105B2301,0xF73CF01D,0x01F001F0,0x04008163,0xC0081064,0xFE131003
+	.word 0x01F06768,0x01F001F0,0x01F001F0,0x7F1201D0,0xF60A2622,0x361D3020,0xF2240028,0xFF011094
+	.word 0x03503D56,0x453601D0,0x5CC06586,0x3FF0AA13,0xB05F90FF,0x0020F001,0xF0F20396,0x2360F040
+	.word 0xE956FFFC,0xE030A060,0x1E40FEF0,0x63D0BFF7,0xF0FF9600,0x101D7040,0xF0BFF0FB,0xF001F001
+	.word 0xFF01F001,0x73F301D0,0x03F07FF3,0x01F07FF3,0x01F001F0,0x2A0120FF,0x9A038007,0xF057F33C
+
+	.word 0xF001F001,0x01F0FF01,0x5FB00100,0xCB13FB06,0x1F908880,0x455FE533,0xF145A7D0,0xF001F051
+	.word 0xF001F001,0x0150FF01,0x78222B82,0x98291DE0,0xF0990320,0x83FF1F50,0xF05B122B,0x561C3040
+	.word 0x9301D0C7,0xFFC7F66B,0x47F76FC3,0x60F040B0,0x60F060F0,0x1EF0FE80,0x136DA3FF,0x9040F0DB
+	.word 0x901FF140,0xF05FF101,0x01F0FF01,0x01F001F0,0x014001F0,0x7FF373F3,0xF3FF03F0,0xF001F07F
+	.word 0xA001F001,0xF3279A01,0x7F24437F,0x2D020045,0x130340BF,0xF3362337,0xFF01F05E,0xA22A01F0
+	.word 0x4F370390,0xA353872A,0x831303C0,0xF13F70FF,0xF001F051,0xF001F001,0xF001F001,0x01F0FF01
+	.word 0xC4360120,0x01F06D5D,0x7FF64B4D,0x47FF0130,0x403FF043,0x028F2A01,0xF04810ED,0xFF3C101D
+	.word 0x32504A7E,0x22600340,0x5FF0D63A,0xB0232F70,0x4019F0FF,0xA07FDE7F,0xF64F44BF,0x2EC090FE
+
+	.word 0x20F0FF6A,0x01F001F0,0x01F001F0,0x01F001F0,0xF3FD0100,0xF07FF373,0xF07FF303,0x65016001
+	.word 0x666D0300,0x03700200,0x00037065,0x59FD5601,0x330160AB,0x0056EB12,0x03106603,0x630E29C0
+	.word 0x0A633666,0xD0872D06,0x10EF6301,0x00A31D3C,0x030046C5,0x03103CDA,0xF0FF1710,0xF001F001
+	.word 0xF07FF301,0xF001F001,0xFF01F001,0x01F001F0,0x0BAA0190,0x53C21123,0xD4A220F0,0x52C742DF
+	.word 0xF4D212ED,0xEF629546,0x1F80B833,0x02F0C9FE,0x233FD0D2,0xD6037067,0x210B9A64,0x507FE0FF
+	.word 0x807F6077,0x83D327AF,0xB0C3376B,0x5DB0FF5E,0x01F06AFE,0x01F001F0,0x01F001F0,0xF0FF01F0
+	.word 0xF37FF301,0xF373F37F,0x7301F07F,0xA86F837D,0x00658363,0x5B035503,0x31663555,0x26033666
+	.word 0x633303B0,0xE2020E66,0x06000420,0x777318BE,0x37031077,0x3077773B,0x40631301,0x32004603
+
+	.word 0x43FF0330,0xF301107F,0x53013063,0x8001F093,0xFFEC1601,0x7FF315F0,0x01F001F0,0x1FF90110
+	.word 0x1FF01ED0,0x701FF0FF,0xF0FDC501,0xF01FF01F,0xF01FF055,0x1FF0FF41,0x1FF001F0,0xECA20100
+	.word 0x3FF01FF0,0x96FF13D0,0xF01FF0C2,0xF015F03F,0xF001F01F,0xFF01F01F,0x1FF01FF0,0x01F01EF0
+	.word 0x73F301B0,0x03F07FF3,0xF07FF3EF,0x35016001,0x03106B43,0x03007713,0x03603577,0x79035B93
+	.word 0x13101033,0x83032082,0x77730C00,0x83736666,0xF001F04F,0x01A001F0,0x05076803,0x54666654
+	.word 0x468177BF,0x630A0300,0xAEF00310,0x801301B0,0x206E1AFF,0x2EF75A03,0x510B300B,0x50AA327A
+	.word 0x43D6F703,0x8A229109,0xD6220330,0x49D10503,0x0320FFAD,0x1B600120,0x5EF0D821,0x03F03FA0
+	.word 0x00FF1EA0,0x061D1670,0x1A36269B,0x067DB01D,0xFF775015,0xDC507DB0,0xDEB00FF0,0x01805E00
+
+	.word 0xEF4983D7,0x307E1DFF,0x20FEC0BE,0xFE99573E,0x70193087,0x40D0FF21,0x6040D900,0x0B203F11
+	.word 0x3E3003B1,0xB0FF9F90,0x2158175D,0x803EF100,0x403F113E,0xFF3FA185,0xF5208D60,0x01F062F7
+	.word 0x73F30180,0x03F07FF3,0xF07FF3F7,0x137E6301,0xEF566373,0xF3361DD0,0x03C256E0,0x55020070
+	.word 0x55333663,0x4333351D,0x4B5AFD12,0x10340390,0x08008F03,0x00533355,0x1365333F,0x356D1A68
+	.word 0x33005666,0x4D56B00A,0xCB3D46AF,0x540350BF,0x0B10BA86,0x7673C1F0,0x6F130237,0xD74080EF
+	.word 0x2151F110,0xE6228101,0x2B12C9F1,0x118B63FF,0x10A8F1B5,0x13DD1117,0x3140F012,0xACA2FFFC
+	.word 0xEBC23EE0,0x35203980,0xED138B13,0xF0FE0340,0xB029503E,0x4D3D747D,0xE00340FE,0x127F113F
+	.word 0x7B10DF00,0x9E806714,0x80004F50,0x40FFDF20,0x401AA103,0x9080F021,0xF04A805F,0xFFFD12DF
+
+	.word 0x49F47C10,0x8B432560,0x60E04C53,0x7EF12354,0xF001F0FF,0xF001F001,0xF3019001,0xF07FF373
+	.word 0x7FF3FF03,0x01F001F0,0x012001F0,0x01F045F0,0x70EF01F0,0x30672338,0x03804503,0x32433B33
+	.word 0x13FF0340,0x50064072,0xF001F003,0x8301F001,0xFFA3F17F,0x2343994C,0xD641EFDC,0xAF250340
+	.word 0x263040F0,0xF60A12FF,0xF647900C,0x1D01802C,0xA063F3AB,0xABF5FF1F,0xEFDD22C0,0xBA007960
+	.word 0x4B34C717,0x30FF01F0,0xF0CF1D25,0x513E403E,0x4320F01A,0xFDCA56E8,0x07901FF0,0xBC8000F1
+	.word 0x47B08BF7,0xFF1EF022,0x5BF01EA0,0x3CF061B0,0x3EF040A0,0xDF605840,0xF373F3FF,0x8003F07F
+	.word 0xF001F003,0xF001F001,0x01F0DF01,0x16450110,0x70F5F2A1,0x531C2001,0xE156A761,0x54105054
+	.word 0x43796354,0xFFC35676,0x01F00350,0x01F001F0,0x19867F93,0x17CA8BF2,0xCA1FF0FF,0x863FF017
+
+	.word 0x10ECF24C,0xF3909A40,0xEE51FFEB,0xCD320A16,0xD4EA42D0,0x353043A0,0x27FFD91C,0x5BA1E057
+	.word 0xF3FB3937,0xF06BA62E,0xFB3AB13E,0x30281FF1,0xBAF00340,0x5012A070,0xBF81E0A0,0x10226837
+	.word 0x200CF49C,0x0025033E,0xFF076019,0xD31A3EE0,0x5FF19358,0x01907710,0xDFF0BFF0,0xF30180FF
+	.word 0xF07FF373,0xF07FF303,0xF001F001,0x6453FF01,0x039013B3,0x50531E00,0x0120ADF6,0x4AF76303
+	.word 0x00F21663,0x45B30309,0x32F02F00,0xF0C701F0,0x36017001,0x830E4466,0x013017F0,0x44EA0ABF
+	.word 0x88815B1E,0xC721D818,0xA8A10370,0x6D8916FF,0x715F4AE3,0x3043FDA1,0xFD4F521F,0x1740FFE3
+	.word 0x0AF46A87,0x181B3E90,0xC6034612,0x20FF0720,0x2691531A,0x001500E7,0x02943675,0xFF66B274
+	.word 0xC5F3AC70,0x837D1410,0x83FDB866,0x9F6083FD,0x100190FF,0x309CCA8D,0xF0E9F4A0,0xF001F001
+
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF3FF0180,0xF07FF373,0xF07FF303,0x9301F001
+	.word 0xFF571372,0x8BF67913,0x01F001F0,0x01F001F0,0x010001F0,0x240E3455,0x363F0E36,0x0E343F1E
+	.word 0x33440571,0x00643333,0x03003403,0x3701B08E,0x03003633,0x0300532E,0x6C03D563,0x10330310
+	.word 0x03006303,0x3F031033,0x51F16363,0x2D320110,0x292325F2,0x33FF0600,0xF08D2D8B,0x80E3DD3C
+	.word 0xFD078017,0xFF3E901E,0x3ED06925,0x1D13B752,0x7FF02044,0xAA131F10,0x254200FF,0x6301F0F4
+	.word 0xA001F083,0x700FF6BF,0x1FF0FF40,0x62F041C0,0xE1D41DF0,0xA36ED084,0x20FF36F0,0xFB4A28DF
+	.word 0xF04BB0DC,0xF001F09C,0xFF01F001,0x017001F0,0x7FF373F3,0x7FF303F0,0x015001F0,0x1D9816FF
+	.word 0x13A32D8F,0xF01DC077,0x03CC2601,0x1D00C790,0x5554C0F6,0xF0769045,0xBD01303D,0x03338E5A
+
+	.word 0x40270367,0x73012003,0x13806153,0x37733673,0x37777333,0x2077332F,0x03203303,0x3B6001B0
+	.word 0x636F0310,0x01100340,0x8A030043,0x2001F07F,0xDA39FF01,0x0170E7F1,0x3FD0D6F8,0x188089F2
+	.word 0x50FF3EF0,0x13054056,0x8041F08C,0x4067F347,0xFFD6F03E,0x5D2001F0,0x1FF0B7F9,0x01F001F0
+	.word 0x391001F0,0x809DF0FF,0xF19A3A1F,0x3B014001,0xB097FBBA,0x13F0FF43,0x01F001F0,0x01F001F0
+	.word 0x01B001F0,0xF3FF73F3,0xF303F07F,0xF001F07F,0x2301F001,0xFF12F041,0x01F001F0,0xA7130150
+	.word 0x0300AB33,0x0B409020,0x130330EF,0x35035063,0x59836F13,0x01F0F716,0x442910BE,0xBB131A00
+	.word 0x08000300,0x8E450380,0x33557603,0x41177466,0x14226246,0x150B00AF,0x11550700,0x0308005B
+	.word 0xFF08271B,0x70151126,0x01204279,0xFB29F759,0x1F4087BD,0xAB05227F,0xDE2C9559,0x78FAD5F6
+
+	.word 0x35304080,0xF0D7F9FF,0xF0885A3E,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF0FC01F0,0xF001F001,0xF001F001,0x1101F001,0x0340EF41,0x03003312,0x12030041
+	.word 0xF373F341,0x0380FF7F,0x05F35716,0x1FF04D73,0x16F01FF0,0xF0F91FF0,0x401FF001,0x167F7311
+	.word 0x372224F5,0x0330B06F,0x97B50644,0x22222217,0x0F90FC22,0x37A7460A,0x01D01FD0,0x14541FE0
+	.word 0x9E3E117F,0x1FD0413B,0x3FF07811,0x1FF01FF0,0xF01FF0FF,0xF01FF01F,0xF01FF01F,0xF01FF01F
+	.word 0x1FF0FF1F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0xF0FF1FF0,0xF01FF01F,0xF01FF01F,0xF01FF01F
+	.word 0xFE1FF01F,0x1F201FF0,0x1FF00C90,0x6FB30100,0x00001ED0
 
 	.section .rodata
 	.align	2
@@ -6,8 +6,8 @@
 @	seed_packet_italian_flattened, 3816x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 477 tiles not compressed
-@	Total size: 512 + 15264 = 15776
+@	+ 477 tiles lz77 compressed, 15264 bytes raw
+@	Total size: 512 + 2908 = 3420
 @
 @	Time-stamp: 2021-07-21, 19:33:37
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,545 +17,111 @@
 
 	.section .rodata
 	.align	2
-	.global seed_packet_italian_flattenedTiles		@ 15264 unsigned chars
+	.global seed_packet_italian_flattenedTiles		@ 2908 unsigned chars
 	.hidden seed_packet_italian_flattenedTiles
 seed_packet_italian_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55555555,0x55555555,0x33333355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x35555555,0x35555555,0x33555555
-
-	.word 0x33333355,0x33333335,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x66633333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333366
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33222222,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x44455555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x54444455,0x44444445,0x44444444,0x44444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555554
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x53555555,0x55355555,0x55555555,0x55555555
-	.word 0x33335555,0x33333355,0x33333355,0x33333335,0x33333333,0x33333555,0x33335555,0x33555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x66633333,0x66666333,0x66666633,0x66666663,0x66666663,0x66666666
-	.word 0x66663333,0x66663333,0x66663336,0x66663666,0x16666666,0x11166666,0x11116666,0x11111666
-	.word 0x33336666,0x33336666,0x33366666,0x33366666,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333331,0x33333111,0x33331111,0x33311111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444555,0x44444555,0x44444555,0x44444555,0x44444455,0x44444445,0x44444445,0x44444445
-	.word 0x44444444,0x44444444,0x44447444,0x44447444,0x44447744,0x44447774,0x44444444,0x44444444
-	.word 0x35544444,0x33444444,0x33444444,0x33444444,0x33444444,0x33444444,0x33444444,0x33444444
-	.word 0x55553333,0x55555333,0x55555333,0x55555333,0x55555333,0x55555333,0x55555333,0x55555333
-	.word 0x35555555,0x35555555,0x55555555,0x35555555,0x35555555,0x35555555,0x35555555,0x33555555
-
-	.word 0x33333333,0x33333555,0x33355535,0x55533333,0x53333333,0x33333333,0x33333333,0x33333333
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666633
-	.word 0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x21111166
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122221,0x11221122,0x11221112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222211,0x12211221,0x22111122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22221111,0x21122111,0x11122111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21211111,0x12222111,0x12211111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222122,0x12211221,0x12211221
-
-	.word 0x11111111,0x11122111,0x11122111,0x11111111,0x11111111,0x11121111,0x11122211,0x11122111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222211,0x12211221,0x12211122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11112221,0x11121112,0x11222222
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12221211,0x22112222,0x22112211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111222,0x21112211,0x11112211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122221,0x11221122,0x12211122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12222221,0x12212211,0x11112211
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222111,0x12111211,0x22222221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22221111,0x21122111,0x11122111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22211111,0x11221111,0x11221111
-	.word 0x33311111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111112,0x33111112,0x33111111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444445,0x44444445,0x44444445,0x44444445,0x54444455,0x55555555,0x55555555,0x55555555
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x34444444,0x33344445,0x33355555
-	.word 0x33344444,0x33333444,0x33333335,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555333,0x55553333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33335555,0x33333555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66663333,0x63333333,0x66333333,0x66333333,0x66333333,0x66333333,0x63333333,0x33333333
-	.word 0x21111166,0x21111166,0x21111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111133
-	.word 0x11111112,0x11111112,0x11111112,0x11111122,0x11122221,0x11111111,0x11111111,0x11111111
-
-	.word 0x22111122,0x22111122,0x22111122,0x12211221,0x11222211,0x11111111,0x11111111,0x11111111
-	.word 0x11221111,0x22211111,0x22111111,0x22112111,0x12222111,0x11111111,0x11111111,0x11111111
-	.word 0x12211111,0x12211111,0x12211111,0x12211111,0x22221111,0x11111111,0x11111111,0x11111111
-	.word 0x12211221,0x12211221,0x12211221,0x12211221,0x12221222,0x11111111,0x11111111,0x11111111
-	.word 0x11122111,0x11122111,0x11122111,0x11122111,0x11222211,0x11111111,0x11111111,0x11111111
-	.word 0x11111122,0x11111122,0x11111122,0x11111221,0x11222211,0x11111111,0x11111111,0x11111111
-	.word 0x21111111,0x21111111,0x21111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111112,0x11111112,0x11111112,0x11121122,0x11112221,0x11111111,0x11111111,0x11111111
-
-	.word 0x22112211,0x22112211,0x22112211,0x22112211,0x22222221,0x11111111,0x11111111,0x11111111
-	.word 0x11112211,0x11112211,0x11112211,0x11112211,0x11112221,0x11111111,0x11111111,0x11111111
-	.word 0x12211122,0x12211122,0x12211122,0x11221122,0x11122222,0x11111122,0x11111122,0x11111122
-	.word 0x11112211,0x11112211,0x11112211,0x11112211,0x11122221,0x11111111,0x11111111,0x11111111
-	.word 0x11111221,0x11111221,0x11111221,0x12112211,0x11222111,0x11111111,0x11111111,0x11111111
-	.word 0x11221111,0x22211111,0x22111111,0x22112111,0x12222111,0x11111111,0x11111111,0x11111111
-	.word 0x12211111,0x22111111,0x21111111,0x21121111,0x22221111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111112,0x33111112,0x33111112,0x33111111,0x33111111,0x33111111,0x33111111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33555555,0x33555555,0x33555555,0x33555555,0x35555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-
-	.word 0x33333333,0x33333333,0x55533333,0x55555333,0x55555533,0x55555533,0x55555533,0x55555555
-	.word 0x33333333,0x33333333,0x33335555,0x33355555,0x33555555,0x33555555,0x35555555,0x35555555
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12111111,0x22211111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111222,0x11112211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11112221,0x11122112
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122221,0x11121122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111211,0x11122222,0x11111221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11221122,0x11221122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222211,0x22122111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11112111,0x11222221,0x11112211
-	.word 0x11111111,0x21111111,0x11111221,0x11111221,0x11111111,0x11111111,0x11111211,0x11111222
-	.word 0x11111122,0x11111122,0x11111111,0x11111111,0x11111111,0x11111111,0x11221122,0x11221122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12221211,0x22112222
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111222,0x11112211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x35555555,0x35555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x53333333,0x35533335,0x33333555,0x33333555,0x33333555
-	.word 0x55533333,0x33555553,0x33333355,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555553,0x55555553,0x55555553,0x55555553,0x55555333,0x55533333,0x33333333,0x33333333
-	.word 0x33555555,0x33555555,0x33555555,0x33555555,0x33355555,0x33335555,0x33333333,0x33333333
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22111111,0x22111111,0x22111111,0x22111111,0x22111111,0x22211111,0x11111111,0x11111111
-	.word 0x11112211,0x11112211,0x11112211,0x11112211,0x11112211,0x11122211,0x11111111,0x11111111
-	.word 0x11122122,0x11122111,0x11122221,0x11122122,0x11122122,0x12221222,0x11111111,0x11111111
-	.word 0x11111122,0x11111221,0x11122211,0x11122111,0x11122112,0x11112222,0x11111111,0x11111111
-	.word 0x11111221,0x11111221,0x11111221,0x11111221,0x11111221,0x11122221,0x11111111,0x11111111
-	.word 0x11221122,0x11221122,0x11221122,0x11221122,0x11221122,0x12222222,0x11111111,0x11111111
-	.word 0x11122111,0x11122111,0x11122111,0x11122111,0x11122111,0x11222211,0x11111111,0x11111111
-
-	.word 0x11112211,0x11112211,0x11112211,0x11112211,0x11112211,0x11222211,0x11111111,0x11111111
-	.word 0x11111221,0x11111221,0x11111221,0x11111221,0x11111221,0x11112222,0x11111111,0x11111111
-	.word 0x11221122,0x11221122,0x11221122,0x11221122,0x11221122,0x12222222,0x11111111,0x11111111
-	.word 0x22112211,0x22112211,0x22112211,0x22112211,0x22112211,0x22222221,0x11111111,0x11111111
-	.word 0x11112211,0x11112211,0x11112211,0x11112211,0x11112211,0x11112221,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x65555555,0x66555555,0x66665555,0x66665555,0x66665555,0x66666555,0x66666555,0x66666555
-	.word 0x56666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x44666666
-	.word 0x33335555,0x33335556,0x33335566,0x66665666,0x66666666,0x66666666,0x66666666,0x64466664
-	.word 0x66633333,0x66666633,0x66666666,0x66666666,0x66666666,0x66666666,0x66666664,0x66666644
-	.word 0x33333333,0x33333336,0x33333366,0x33333366,0x33333366,0x33333366,0x33333366,0x33333336
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133
-	.word 0x11111111,0x11111111,0x11111111,0x22222211,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11222222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66666555,0x66666555,0x66666555,0x66665555,0x66665555,0x66655555,0x44555555,0x45555555
-
-	.word 0x44466666,0x44466666,0x44466666,0x44466666,0x44466666,0x44666444,0x66644444,0x44444444
-	.word 0x44446444,0x44444444,0x44444444,0x44444444,0x44777774,0x47777774,0x77777777,0x77777777
-	.word 0x66666644,0x66666644,0x36666644,0x36666444,0x36666444,0x66666644,0x66666664,0x66666666
-	.word 0x33333336,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333336,0x33333366
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x35555533
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111133,0x11111133,0x11111133,0x21111133,0x12111133,0x12111133,0x12111133,0x21111133
-	.word 0x11111111,0x11111111,0x11111111,0x21111122,0x12111211,0x12111111,0x12111111,0x21111222
-
-	.word 0x11111111,0x11111111,0x11111111,0x12111122,0x22111211,0x12111211,0x12111211,0x12111122
-	.word 0x11111111,0x21111111,0x21111111,0x22111122,0x21111211,0x21111211,0x21111211,0x11111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111122,0x11111111,0x11111111,0x11111111,0x11111122
-	.word 0x11111111,0x11111112,0x11111111,0x21111112,0x12111112,0x22111112,0x12111112,0x21111112
-	.word 0x11111111,0x11111111,0x11111111,0x12111122,0x22111211,0x12111222,0x12111111,0x12111222
-	.word 0x11111111,0x11111111,0x11111111,0x21111122,0x12111211,0x22111211,0x12111211,0x21111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111122,0x11111211,0x11111222,0x11111111,0x11111222
-	.word 0x11111111,0x11111111,0x11111111,0x21111111,0x12111111,0x12111111,0x12111111,0x21111111
-
-	.word 0x11111111,0x11111211,0x11111211,0x21111222,0x12111211,0x22111211,0x12111211,0x21111222
-	.word 0x11111111,0x11111111,0x11111111,0x11111122,0x11111211,0x11111222,0x11111111,0x11111222
-	.word 0x11111111,0x11111112,0x11111112,0x11111112,0x11111112,0x11111112,0x11111112,0x11111122
-	.word 0x11111111,0x11111112,0x11111112,0x21111112,0x12111112,0x22111112,0x12111112,0x21111122
-	.word 0x11111111,0x11111111,0x11111111,0x11111122,0x11111211,0x11111222,0x11111111,0x11111222
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x45555555,0x44555555,0x44555555,0x66555555,0x66555555,0x66455555,0x66455555,0x66455555
-	.word 0x44444444,0x44444444,0x44444444,0x44444446,0x44444466,0x44444666,0x44444666,0x44446666
-	.word 0x66667774,0x66666674,0x66666664,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x33333666,0x53336666,0x55536666,0x55556666,0x55556666,0x55553666,0x55533366,0x55533366
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333335,0x33333355,0x33333355,0x33333555,0x33333555,0x33335555,0x33335555,0x33333555
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111112,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111112,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111112,0x11111112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111112,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66455555,0x64555555,0x44555555,0x45555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x44466666,0x44666666,0x44666666,0x44666666,0x44446644,0x44466455,0x34444555,0x33355555
-	.word 0x66666666,0x66666664,0x66666664,0x66666664,0x66666664,0x66666643,0x66666443,0x55544455
-	.word 0x66666666,0x36666666,0x33366666,0x33336666,0x33355666,0x33555666,0x33555556,0x33555555
-	.word 0x55533336,0x55333333,0x55333333,0x53333333,0x33333333,0x33333333,0x53333333,0x53333333
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x35555555,0x33333333,0x33333333
-	.word 0x33333555,0x33333355,0x33333355,0x33333355,0x33333335,0x33333333,0x33333333,0x33333333
-	.word 0x21111133,0x12111133,0x21111133,0x11111133,0x22111133,0x11111133,0x11111133,0x11111133
-	.word 0x22111222,0x12111111,0x12111122,0x22111211,0x12111122,0x12111111,0x11111111,0x11111111
-
-	.word 0x21111122,0x12111211,0x12111211,0x12111122,0x21111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111122,0x22111211,0x12111211,0x12111211,0x12111122,0x11111111,0x11111111,0x11111111
-	.word 0x21111122,0x12111211,0x22111111,0x12111111,0x21111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111122,0x11111211,0x11111222,0x11111111,0x11111222,0x11111111,0x11111111,0x11111111
-	.word 0x21111111,0x12111111,0x21111111,0x11111111,0x22111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111222,0x11111111,0x11111122,0x11111211,0x11111122,0x11111111,0x11111111,0x11111111
-	.word 0x22111112,0x12111112,0x12111112,0x12111112,0x12111112,0x11111111,0x11111111,0x11111111
-	.word 0x11111122,0x11111212,0x11111212,0x11111212,0x11111212,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111112,0x11111112,0x11111112,0x11111112,0x11111112,0x11111111,0x11111111,0x11111111
-	.word 0x11111112,0x11111112,0x11111112,0x11111112,0x11111122,0x11111111,0x11111111,0x11111111
-	.word 0x11111112,0x11111112,0x11111112,0x11111112,0x11111112,0x11111111,0x11111111,0x11111111
-	.word 0x21111111,0x12111111,0x12111111,0x12111111,0x21111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111222,0x11111211,0x11111211,0x11111221,0x11111212,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x53555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555553
-	.word 0x33555555,0x33555555,0x33555555,0x33355555,0x33355555,0x33355555,0x33335555,0x33333555
-	.word 0x35333333,0x35333333,0x35333333,0x33533333,0x33353333,0x33335333,0x33335333,0x33335333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x21111133,0x12111133,0x12111133,0x21111133
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x12111222,0x12111211,0x12111211,0x12111222
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x21111211,0x12111211,0x22111211,0x12111221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111122,0x11111211,0x11111222,0x11111111
-	.word 0x11111111,0x11111111,0x11111112,0x11111112,0x11111112,0x11111112,0x11111112,0x11111112
-	.word 0x11111111,0x11111111,0x11111112,0x11111112,0x21111112,0x12111112,0x22111112,0x12111112
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111122,0x11111211,0x11111222,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x21111111,0x12111111,0x12111111,0x12111111
-	.word 0x11111111,0x11111111,0x11111211,0x11111211,0x21111222,0x12111211,0x22111211,0x12111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111122,0x11111211,0x11111222,0x11111111
-	.word 0x11111111,0x11111111,0x11111112,0x11111111,0x11111112,0x11111112,0x11111112,0x11111112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x21111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111221,0x11111112,0x21111122,0x12111112,0x12111112,0x12111112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x12111122,0x22111211,0x12111211,0x12111211
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111122,0x11111211,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111112,0x11111111,0x11111112,0x11111112,0x11111112,0x11111112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x35555555
-	.word 0x55555333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333355,0x33333533,0x33333533,0x33335533,0x33335333,0x33355333,0x33353333,0x53533333
-	.word 0x33333533,0x33333533,0x33333553,0x33333353,0x33333355,0x33333335,0x33333335,0x33333335
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133
-	.word 0x21111211,0x11111211,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x21111212,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111122,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111112,0x11111112
-	.word 0x21111122,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111112,0x11111111
-	.word 0x11111222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21111111,0x21111111
-	.word 0x11111222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111122,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21111111,0x21111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x33333335,0x33333335,0x33333335,0x33333335,0x33333335,0x33333335,0x33333335
-	.word 0x33555555,0x35533333,0x53333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x53533333,0x55533333,0x55333333,0x55333355,0x35335553,0x35355333,0x33353333,0x33533333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x66463333,0x44444633
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333366,0x33333666
-	.word 0x12111133,0x22111133,0x12111133,0x12111133,0x12111133,0x11111133,0x11111133,0x11111133
-	.word 0x21111122,0x12111211,0x22111111,0x12111111,0x21111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111122,0x12111211,0x12111222,0x12111111,0x21111222,0x11111111,0x11111111,0x11111111
-	.word 0x11111222,0x11111211,0x11111211,0x11111221,0x11111212,0x11111111,0x11111111,0x11111111
-	.word 0x11111112,0x11111112,0x11111112,0x11111112,0x11111122,0x11111111,0x11111111,0x11111111
-	.word 0x22111112,0x11111112,0x11111112,0x21111112,0x22111112,0x11111111,0x11111111,0x11111111
-
-	.word 0x22111222,0x11111121,0x11111112,0x21111111,0x22111222,0x11111111,0x11111111,0x11111111
-	.word 0x21111222,0x12111121,0x12111112,0x12111111,0x21111222,0x11111111,0x11111111,0x11111111
-	.word 0x22111222,0x21111211,0x21111211,0x21111221,0x11111212,0x11111111,0x11111111,0x11111111
-	.word 0x21111122,0x12111111,0x22111111,0x12111111,0x21111122,0x11111111,0x11111111,0x11111111
-	.word 0x11111122,0x11111211,0x11111222,0x11111111,0x11111222,0x11111111,0x11111111,0x11111111
-	.word 0x22111111,0x12111111,0x12111111,0x22111111,0x12111111,0x12111111,0x11111111,0x11111111
-	.word 0x21111122,0x12111211,0x22111211,0x12111122,0x21111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111122,0x22111211,0x12111222,0x12111111,0x12111222,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111122,0x11111211,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111111,0x21111111,0x21111111,0x21111111,0x21111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111111,0x21111111,0x21111111,0x21111111,0x21111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111112,0x33111111,0x33111111,0x33111111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x35555555,0x33555555,0x33355555
-
-	.word 0x33333335,0x33333335,0x33333335,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x43333333,0x46666633,0x46666643,0x66666443,0x66664443
-	.word 0x44444433,0x44444463,0x44444443,0x44444444,0x44444444,0x44444444,0x44474444,0x44474446
-	.word 0x33336666,0x33336666,0x33366664,0x33366664,0x33366644,0x33366444,0x33364444,0x64644444
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x12111133,0x12111133,0x21111133,0x21111133
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x12111211,0x12111211,0x12111121,0x12111121
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x21111211,0x12111211,0x12111211,0x12111221
-	.word 0x11111111,0x11111111,0x21111111,0x21111111,0x22111122,0x21111211,0x21111211,0x21111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x21111122,0x12111111,0x12111111,0x12111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111122,0x11111211,0x11111211,0x11111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x21111111,0x12111111,0x21111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x22111222,0x12111111,0x12111122,0x22111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x21111122,0x12111211,0x12111211,0x12111122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x22111222,0x11111211,0x11111211,0x21111221
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111222,0x11111121,0x11111112,0x11111111
-	.word 0x11111111,0x11111111,0x11111112,0x11111111,0x21111112,0x12111112,0x12111112,0x12111112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111222,0x11111211,0x11111211,0x11111221
-	.word 0x11111111,0x11111111,0x11111112,0x11111112,0x21111112,0x12111112,0x22111112,0x12111112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111122,0x11111211,0x11111222,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33335555,0x33355555,0x33555555,0x35555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333355,0x33333555,0x53335555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35555333,0x55555553,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333335,0x33333355
-	.word 0x66666444,0x66644444,0x66644444,0x44444444,0x74444444,0x44444444,0x44444444,0x44444443
-
-	.word 0x44477446,0x44477774,0x44477777,0x44447777,0x44447777,0x44444444,0x44444444,0x44444444
-	.word 0x66644444,0x66644444,0x66444444,0x64444444,0x64444444,0x44444444,0x34444444,0x33444444
-	.word 0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111133,0x11111333
-	.word 0x21111112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111212,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111122,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111122,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111122,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x22111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111122,0x12111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22111212,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111212,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111122,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33111111,0x33311111
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355,0x55555355
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55335555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333555,0x33333555,0x33335555,0x55535555,0x33555555,0x33335555,0x33335555,0x33335555
-	.word 0x44444443,0x44444443,0x44444443,0x44444445,0x44444446,0x44444444,0x44444444,0x44444463
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44434444,0x63334444,0x33334444,0x33336444
-	.word 0x33444444,0x33444444,0x33444444,0x55444444,0x53344444,0x33336644,0x33333333,0x33333333
-	.word 0x11111333,0x11113333,0x11133333,0x13333333,0x33333335,0x33333355,0x33333553,0x33333533
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444333,0x44444333,0x44433333,0x33333333
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33344444,0x33333444,0x33333344,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33311111,0x33331111,0x33333111,0x33333331,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333,0x33233333
-	.word 0x55555355,0x55555355,0x55555355,0x55555355,0x33333355,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x33333333,0x55555555,0x55555555,0x55555555
-	.word 0x33335555,0x33333555,0x33335555,0x33355555,0x22233333,0x33355555,0x33355555,0x33355555
-	.word 0x44446633,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333644,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33335333,0x33355333,0x33353333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x22222222,0x33333333,0x33333333,0x33333333
-	.word 0x33233333,0x33233333,0x33233333,0x33233333,0x33222222,0x33333333,0x33333333,0x33333333
+	.word 0x003BA010,0xF0000032,0x55019001,0x33014055,0x5533330E,0xD0070053,0x331E7003,0xF00D70FF
+	.word 0xF01FF001,0xF015F01F,0xF001F01F,0x01F0D51F,0x40351FE0,0x18103303,0x0F030035,0x22222222
+	.word 0x01F02310,0x1FF00130,0xF01FF0CF,0xF0666315,0x6001701F,0xFF1FF01C,0x1FF05FF0,0x16F01FF0
+	.word 0x01F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF01F,0xF001F01F,0xF001F01F,0x1FF0FF1F,0x1FF01FF0
+	.word 0x1FF016F0,0x1FF001F0,0xF0FB01F0,0xF01FF01F,0x001FB01F,0x03E02305,0xC0F973F3,0xF001F003
+	.word 0x4001F001,0xE0444501,0x44440312,0x44444554,0x33F00160,0x540170BF,0x011012F0,0x5A139500
+	.word 0x77030150,0x53C900EF,0x55011067,0x17200800,0x01F09633,0x0001F0E0,0x634B0301,0x66336666
+	.word 0x0066663E,0x10032006,0x20450301,0x10A83603,0x12203618,0x11020016,0x11386666,0x00060011
+
+	.word 0x36219007,0x117F1133,0x65D001B0,0x1FF01FF0,0x1FF01FF0,0xF0FF1FF0,0xF01FF01F,0xF01FF01F
+	.word 0xF01FF01F,0xFF1FF01F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0xF01FF0FD,0xF01FF01F
+	.word 0x901FF01F,0x23103101,0x100400DF,0x08101119,0x03A073F3,0x03C073F3,0xD301F0DF,0x03A04462
+	.word 0x5F135303,0x01600350,0x0340745C,0x00060077,0x54017003,0x0400BF35,0x3003F033,0x00492303
+	.word 0x3003F087,0x0100FD03,0x0B90EB56,0x1311FF66,0x10358F13,0x3000FF04,0x2F910410,0x01F06643
+	.word 0x04107B13,0xF0D86301,0x21036003,0x01108FD1,0x3C122221,0x01002211,0x1DF00510,0x22220100
+	.word 0x12211107,0x1D001221,0x208020F0,0xF00300FE,0x0061301A,0xF064001B,0x213D3020,0x105F30FF
+	.word 0xD02E3001,0xF00B002A,0xF09FF03E,0x88E0FF20,0xFF1012F0,0xFD006110,0x1DF04700,0x223E7E10
+
+	.word 0x301A0012,0x201DF001,0x2119009A,0x501DF0FF,0xF05F315F,0x101F509F,0xF01B0020,0xA0A0FF3F
+	.word 0x21F02700,0x7FF18130,0x3A1040E0,0x317F0310,0x03A09313,0x03203500,0x73F30B10,0xF0FF7FF3
+	.word 0xF07FF303,0xA37E6301,0x90DF166F,0x8569931F,0x45340180,0x59033444,0x3F630335,0x02003334
+	.word 0x01E0BB66,0xCD266713,0x23FE01F0,0xF01D105B,0xF001F03C,0x00816301,0x10EF6304,0x1003C008
+	.word 0x63133313,0x7FA30380,0x11FF6011,0x110350A1,0x9116238D,0x30CC21C9,0xFF0F2303,0x3530F2E1
+	.word 0x71120820,0x3C6340D0,0x40B00350,0x506753FF,0xB0D90201,0xE03EF03F,0x2203507D,0x92F2FB6E
+	.word 0x03506313,0xFFB001E0,0xB0C93012,0x01A0FF60,0x8090F3E2,0x3FD00300,0x03700813,0x23FF0100
+	.word 0xF032707B,0x64FEF03F,0x50A0F07E,0xFF7FF1F9,0x243041A0,0x0300E500,0x6F6320E1,0x03907353
+
+	.word 0xF373F3FF,0xF303F07F,0xF001F07F,0x2001F001,0x072AFF01,0x3C9A0380,0x01F057F3,0x01F001F0
+	.word 0x00FE01F0,0x065FB001,0x80CB13FB,0x331F9088,0xD0BF35E5,0x50E135A7,0x01F003C0,0x01F001F0
+	.word 0xF0FF01F0,0xE2D21201,0x4601602C,0x4018F023,0xFFE22501,0x1F80BFF5,0x1FF0C712,0xE7127950
+	.word 0x7F803EF0,0xC0BEF6FE,0xF0432620,0x267C2020,0x21BF90A3,0x30A2F7FF,0xF06763E3,0xA07FF07F
+	.word 0xF06347C3,0x3F30FF19,0x01F03FF1,0x01F001F0,0x7FF312F2,0xF3FF03F0,0xF303F07F,0xF001F07F
+	.word 0x5001F001,0xDF279A01,0x24437FF3,0x2D020035,0x130340BF,0xFF362337,0x01F05EF3,0xA22A01F0
+	.word 0x4F370390,0xA353872A,0x1303C0FF,0xF1408083,0xF07FF354,0xF001F001,0x0150FF01,0x05C6C1C5
+	.word 0x3C421DF0,0xB8421E40,0x17FF4F23,0x8703105E,0x30D77603,0xD782D727,0xFF03201E,0x01F05F90
+
+	.word 0x20705A13,0x22B640F0,0x1FA0BFF0,0xD03EF0FF,0xA001F03E,0xB71EF07F,0xF47FF063,0x01F0FFD5
+	.word 0x01F001F0,0x16F20150,0x03F07FF3,0xF0E27FF3,0xF07FF303,0x65555501,0xDB660300,0x03700200
+	.word 0x00037065,0x59FD5601,0x44560160,0x0056EB12,0x03106603,0x1D6429C0,0x0A644666,0xC0873D06
+	.word 0x3C106401,0x00A31DDF,0x030036C5,0x03103CDA,0x01F01710,0xF001F0FF,0xF07FF301,0xFC7FF303
+	.word 0xF01EE0F0,0x1FF0FF1F,0x1FF001F0,0x1FF001F0,0x1FF01FF0,0xF0FF1FF0,0xF01FF016,0xF01FF001
+	.word 0xF01FF001,0xFF1FF01F,0x01F01FF0,0x01F01FF0,0x1FF01FF0,0x1FD01FF0,0xF214F0FF,0xF07FF312
+	.word 0xF07FF303,0xF07FF303,0x7D03EA01,0x83636F83,0x55030065,0x0C555B03,0x46666645,0x03B02603
+	.word 0x66786444,0x0420020E,0x18BE0600,0x8E777774,0x77470310,0x13013077,0x36034063,0x303200FF
+
+	.word 0x107F4303,0x3063F301,0xF0935301,0x0180FA01,0x15F0EC16,0x03707FF3,0x12030021,0xAD0380FF
+	.word 0x1F5A1513,0x200A00D7,0xC0C21903,0x1D10FF1F,0x0120F619,0x1A300F20,0x91295F2D,0x70FD3310
+	.word 0xD2FFB103,0x5007400F,0x123E4626,0x10FFBA49,0x167FF007,0x40A340FE,0x70BFF007,0xFF3FD0A3
+	.word 0x0F20176A,0x2F109FFA,0x3F30129E,0x0F210D40,0xF15F80FF,0x805FF01F,0x9003E03E,0xA00340FF
+	.word 0xCF20FFFF,0xBFF05FF0,0x01F001F0,0x015001F0,0xF3FF77F3,0xF303F07F,0xF303F07F,0x0301F07F
+	.word 0xEE6B4363,0x77130310,0x60450300,0x035B9303,0x10F04479,0x20821310,0x740C0003,0x7E666677
+	.word 0xF04F8374,0xA001F001,0x07680301,0x66175305,0x81775366,0x0A030036,0xFF031063,0x01B0AEF0
+	.word 0x6E1A8013,0xF75A0320,0xFF4A0B2E,0xF654F1FF,0xF001F0FF,0xF001F001,0xF001F001,0x01F0FF01
+
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF2FF0160,0xF001F0BA,0xF03FF001,0xF01F7001,0xFF3FF023
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x012001F0,0xF316F2FF,0xF303F07F,0xF203F07F,0x2301F0BE
+	.word 0x64553F67,0x1DD0EF56,0xC256F336,0x02007003,0x46645500,0x44455544,0xFD12EC34,0x03904B5A
+	.word 0x00031043,0x79445508,0x333F0054,0x1A681365,0x0056666D,0xB00AAD33,0x36AF4D56,0x0350CB3D
+	.word 0xFFB98653,0xC1F00B10,0x02377673,0x40806F13,0xF37610E7,0x110710DF,0x60912254,0x0600761D
+	.word 0x5A3DCB36,0x863AA2FF,0xF6EF5653,0x9013F793,0x2053571F,0x3FF0FF67,0xD3F51530,0x93560160
+	.word 0x46A73750,0x50FF3760,0x873CC047,0xD003604B,0xC01CA07F,0xFFB7F67F,0xD3F61FF0,0x3FF01FF0
+	.word 0x73B7DFE0,0x1CC7DF90,0xF001F0FF,0xF001F001,0xF3014001,0xF07FF377,0x7FF3FF03,0xBDF203F0
+
+	.word 0x01F001F0,0x45F001D0,0xF0F701F0,0x23387001,0x35033067,0x9F460380,0x40FF3233,0x40721303
+	.word 0xF0035006,0xF001F001,0xFF7F9301,0x839A54D1,0xEF41EBA1,0xDFD90160,0x83890120,0xE00F02FF
+	.word 0x704FD31F,0x9003F036,0x3366F222,0x5FF0FF37,0x01C05FF0,0x60A0CFD2,0x5FF043DA,0x50FF5FF0
+	.word 0xF0C7F03E,0xF07F407C,0x14CC4014,0xFF0BF48F,0xCFA47FA0,0x78F01FF0,0x9FF09FF0,0x016001F0
+	.word 0xF322F2FF,0xF303F07F,0xF303F07F,0xF001F039,0x01F0EF01,0x015001F0,0xF2A11635,0x200170F4
+	.word 0x6153D31C,0x5053E156,0x63535310,0xFF764379,0x0350C356,0x01F001F0,0x7FF301F0,0x7F4A03F0
+	.word 0xB1A7FDFF,0xE2E3CCD7,0xB03BF00F,0x3012F01F,0x0340FF57,0x1F90E3DC,0x01F05FF0,0x3FF00100
+	.word 0xF0DF7F90,0x213790BF,0x87F05FF0,0x01F001F0,0x60FF01F0,0x807FF03F,0xF02FD801,0xC001F001
+
+	.word 0xFF01F05F,0x77F00130,0x03101FF0,0x7FF316F2,0x7FF303F0,0xF303F0FF,0xF001F07F,0xC364F301
+	.word 0x00039013,0x5053FF1E,0x0120ADF6,0x634A6303,0x0900F216,0x357CB303,0x32F02F00,0x01F001F0
+	.word 0x66460170,0x830E337B,0x013017F0,0x1E33EA0A,0xFFE7465B,0xF356731A,0x7F7A0310,0x1FDA1FFA
+	.word 0x0B471F20,0xF90710FF,0xA21FF91F,0xA09FF91F,0xDA42D01F,0x56227B5F,0x4B9B10D0,0x211F902F
+	.word 0x4B561F00,0x369FF0EB,0x21C3104B,0xD0215C00,0xFFFF439F,0x0FD4FF60,0xC0C01FFB,0x43913771
+	.word 0xDB7BBFFB,0x10BFFBFF,0xEB5F711B,0xA064F31F,0x90475301,0x1FF0FF03,0x01501FF0,0x6A006FA3
+	.word 0x03F07FF3,0xF0FF7FF3,0xF07FF303,0x4301F001,0x13571372,0xFD8BF679,0x01F001F0,0x01F001F0
+	.word 0x010001F0,0x54240E43,0x463F0E46,0x0E433F1E,0x16443371,0x00634444,0x03004303,0x3B4701B0
+
+	.word 0x03004644,0x0300532E,0x106C0364,0x10445403,0x03006403,0x64031044,0xD4F4FF64,0x7FFA7B7A
+	.word 0x0120EB21,0x0310D312,0x7EFF1FF0,0x367FCA0F,0x4232124F,0xC00320EF,0xFFEF823E,0x1F3022F9
+	.word 0x4FF21DF0,0x3F60C7E2,0x5FF0CFCE,0xF0CFEEFF,0xF00C743F,0xFED046BF,0xFA076007,0x3FC0FF5F
+	.word 0x3F906C94,0x3FF07FFB,0x01F01FFB,0xF0FF01F0,0xF2018001,0xF07FF322,0xF07FF303,0xFF7FF303
+	.word 0x941601F0,0xA32D8F2D,0x1DC07713,0xCC2601F0,0x009003E3,0x53C0F61D,0x76903555,0x30DE3DF0
+	.word 0x448E5A01,0x27036703,0x01200340,0x6153C074,0x74467313,0x77744447,0x77444717,0x20440320
+	.word 0x6001B003,0x0310B73B,0x10034064,0x03003401,0x03907FFA,0x1FF9137F,0x7FFA01D0,0x5FFA01B0
+	.word 0x3FF01FE0,0xF03FF0FF,0xF022F001,0xF31C3001,0xF001B0A9,0x0180FF7F,0x5FF0DF00,0x59F05F90
+
+	.word 0x5FF03FB0,0xF0FF5FD0,0xF05F9014,0xF07FF03F,0xF001F001,0xF701F001,0x011001F0,0x03601AF2
+	.word 0xF373F331,0xFF73F37F,0x01F07FF3,0x01F001F0,0x12F04133,0x01F001F0,0x130150FF,0x00AB33A7
+	.word 0x40902003,0x1303300B,0x0350BE63,0x836F1345,0xF0F71659,0x33291001,0x131A00FA,0x000300BB
+	.word 0x55038008,0x7F537603,0x507C1A44,0x13630301,0x10081084,0xFF866E0D,0x8CE1D447,0x03205E00
+	.word 0x3E100400,0x5F001FD0,0x0200335F,0xE0F85A33,0xF067C43F,0xFF1FF01F,0x1FF01FF0,0x1FF01FF0
+	.word 0x1FF01FF0,0x1FF01FF0,0xF01FF0FF,0xF01FF01F,0xF01FF01F,0xF01FF01F,0x1FF0FD1F,0x1FF01FF0
+	.word 0x1FF01FF0,0x22311F10,0x6A13FF1D,0x01F06D13,0x7FF373F3,0x15000380,0x83FF04F3,0xF01FF04D
+	.word 0xF016F01F,0xF001F01F,0xCD11401F,0xF4127F73,0x6F372223,0x06330330,0xED9087B5,0x22222222
+
+	.word 0x460A0F90,0xD0FF0DA1,0xE001D01F,0x53A1171F,0xF01FF06C,0xFF1FF03F,0x16F01FF0,0x01F01FF0
+	.word 0x01F01FF0,0x1FF01FF0,0xF01FF0FF,0xF001F01F,0xF001F01F,0xF01FF01F,0x1FF0FF1F,0x1FF016F0
+	.word 0x1FF001F0,0x1FF001F0,0xF0FE1FF0,0xF01FF01F,0x401FF001,0xD06FB301,0x0000001E
 
 	.section .rodata
 	.align	2
@@ -6,8 +6,8 @@
 @	seed_packet_russian_flattened, 3816x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 477 tiles not compressed
-@	Total size: 512 + 15264 = 15776
+@	+ 477 tiles lz77 compressed, 15264 bytes raw
+@	Total size: 512 + 3252 = 3764
 @
 @	Time-stamp: 2021-04-26, 17:42:32
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,545 +17,123 @@
 
 	.section .rodata
 	.align	2
-	.global seed_packet_russian_flattenedTiles		@ 15264 unsigned chars
+	.global seed_packet_russian_flattenedTiles		@ 3252 unsigned chars
 	.hidden seed_packet_russian_flattenedTiles
 seed_packet_russian_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55555555,0x55555555,0x44444455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x45555555,0x45555555,0x44555555
-
-	.word 0x44444455,0x44444445,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x66644444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444466
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44222222,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x33355555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x53333355,0x33333335,0x33333333,0x33333333
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555553
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x54555555,0x55455555,0x55555555,0x55555555
-	.word 0x44445555,0x44444455,0x44444455,0x44444445,0x44444444,0x44444555,0x44445555,0x44555555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x66644444,0x66666444,0x66666644,0x66666664,0x66666664,0x66666666
-	.word 0x66664444,0x66664444,0x66664446,0x66664666,0x16666666,0x11166666,0x11116666,0x11111666
-	.word 0x44446666,0x44446666,0x44466666,0x44466666,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444441,0x44444111,0x44441111,0x44411111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333555,0x33333555,0x33333555,0x33333555,0x33333355,0x33333335,0x33333335,0x33333335
-	.word 0x33333333,0x33333333,0x33337333,0x33337333,0x33337733,0x33337773,0x33333333,0x33333333
-	.word 0x45533333,0x44333333,0x44333333,0x44333333,0x44333333,0x44333333,0x44333333,0x44333333
-	.word 0x55554444,0x55555444,0x55555444,0x55555444,0x55555444,0x55555444,0x55555444,0x55555444
-	.word 0x45555555,0x45555555,0x55555555,0x45555555,0x45555555,0x45555555,0x45555555,0x44555555
-
-	.word 0x44444444,0x44444555,0x44455545,0x55544444,0x54444444,0x44444444,0x44444444,0x44444444
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666644
-	.word 0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x22211111,0x22111111,0x22111111,0x22111111,0x22111111
-	.word 0x11111111,0x11111111,0x11111111,0x11222212,0x11122111,0x11122111,0x11122222,0x11122111
-	.word 0x11111111,0x11111111,0x11111111,0x11122211,0x11221121,0x21221111,0x21222211,0x21221122
-
-	.word 0x11111111,0x11111111,0x11111111,0x22122221,0x12121112,0x11121112,0x11111112,0x11111112
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x21211221,0x11111221,0x11111221,0x11111221
-	.word 0x11111111,0x11111111,0x11111111,0x12221122,0x11211112,0x11121122,0x11121122,0x11112222
-	.word 0x11111111,0x11111111,0x11111111,0x12221211,0x22212222,0x22111221,0x22111221,0x22111221
-	.word 0x11111111,0x11111111,0x11111111,0x21222211,0x11122111,0x11122111,0x11122111,0x11122111
-	.word 0x11111111,0x11111111,0x11111111,0x22211222,0x22111122,0x22111122,0x22111122,0x22111122
-	.word 0x11111111,0x11111111,0x11111111,0x11222112,0x11122211,0x11122121,0x11122121,0x11122112
-	.word 0x11111111,0x11111111,0x11111111,0x12222221,0x11221122,0x11221122,0x11222211,0x11221221
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44411111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333335,0x33333335,0x33333335,0x33333335,0x53333355,0x55555555,0x55555555,0x55555555
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x43333333,0x44433335,0x44455555
-	.word 0x44433333,0x44444333,0x44444445,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x55555444,0x55554444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44445555,0x44444555,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x66664444,0x64444444,0x66444444,0x66444444,0x66444444,0x66444444,0x64444444,0x44444444
-	.word 0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111166,0x11111144
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22111111,0x22211111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11122111,0x11222212,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21221122,0x12222222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111122,0x11122222,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111221,0x11112222,0x11111111,0x11111111,0x12111111,0x22111111,0x11111111,0x11111111
-	.word 0x11112221,0x11112221,0x11111211,0x11111211,0x11111121,0x11111112,0x11111111,0x11111111
-	.word 0x12211221,0x11222221,0x11111221,0x11111221,0x11111221,0x11112222,0x11111111,0x11111111
-
-	.word 0x11122111,0x22222211,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22111122,0x22111222,0x11111211,0x11111211,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11122111,0x21222211,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11221122,0x12222112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44555555,0x44555555,0x44555555,0x44555555,0x45555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x55555555
-
-	.word 0x44444444,0x44444444,0x55544444,0x55555444,0x55555544,0x55555544,0x55555544,0x55555555
-	.word 0x44444444,0x44444444,0x44445555,0x44455555,0x44555555,0x44555555,0x45555555,0x45555555
-	.word 0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x22221111,0x12211111,0x12211111,0x22211111,0x12211111,0x12211111,0x22221111
-	.word 0x11111111,0x21122211,0x22111221,0x22111112,0x22111122,0x22111222,0x22112221,0x21122211
-	.word 0x11111111,0x11112222,0x21122111,0x22122111,0x22122111,0x22122111,0x22122111,0x21112222
-	.word 0x11111111,0x22112222,0x21112111,0x21112111,0x21111111,0x21111111,0x21111112,0x22112222
-
-	.word 0x11111111,0x22211122,0x12221122,0x12221122,0x12212221,0x12212221,0x12211211,0x22221212
-	.word 0x11111111,0x11222211,0x21122111,0x12122111,0x12122111,0x11222111,0x11122111,0x21122111
-	.word 0x11111111,0x22221222,0x12211122,0x12211122,0x12211122,0x22111122,0x11111122,0x11111222
-	.word 0x11111111,0x11122221,0x21112211,0x21112211,0x21112211,0x21112222,0x21112211,0x11122221
-	.word 0x11111111,0x11112221,0x21122112,0x22122112,0x22122222,0x22111112,0x22111122,0x21112222
-	.word 0x11111111,0x22112222,0x21112111,0x21112111,0x21111111,0x21111111,0x21111112,0x22112222
-	.word 0x11111111,0x12221122,0x11122112,0x11111212,0x11112222,0x11122212,0x11222112,0x12221122
-	.word 0x11111111,0x11122211,0x11221121,0x11221111,0x11222211,0x11221122,0x11221122,0x22222222
-
-	.word 0x11111111,0x12222221,0x11221122,0x11221122,0x11222211,0x11221221,0x11221122,0x12222112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x45555555,0x45555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444444,0x44444444,0x44444444,0x54444444,0x45544445,0x44444555,0x44444555,0x44444555
-	.word 0x55544444,0x44555554,0x44444455,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x55555554,0x55555554,0x55555554,0x55555554,0x55555444,0x55544444,0x44444444,0x44444444
-	.word 0x44555555,0x44555555,0x44555555,0x44555555,0x44455555,0x44445555,0x44444444,0x44444444
-	.word 0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222221,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222222,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122222,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x65555555,0x66555555,0x66665555,0x66665555,0x66665555,0x66666555,0x66666555,0x66666555
-	.word 0x56666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x33666666
-	.word 0x44445555,0x44445556,0x44445566,0x66665666,0x66666666,0x66666666,0x66666666,0x63366663
-	.word 0x66644444,0x66666644,0x66666666,0x66666666,0x66666666,0x66666666,0x66666663,0x66666633
-	.word 0x44444444,0x44444446,0x44444466,0x44444466,0x44444466,0x44444466,0x44444466,0x44444446
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111144,0x11111144,0x11111144,0x22111144,0x11211144,0x11211144,0x11211144,0x22111144
-	.word 0x11111111,0x11111111,0x11111111,0x11222112,0x12111212,0x12111211,0x12111211,0x11222112
-	.word 0x11111111,0x11111111,0x11111111,0x21222222,0x12121121,0x22121121,0x12121121,0x21222222
-	.word 0x11111111,0x11111111,0x11111111,0x22122112,0x11221121,0x11121122,0x11121111,0x22221122
-	.word 0x11111111,0x11111111,0x11111111,0x22212111,0x12121112,0x22211112,0x12121112,0x22212211
-	.word 0x11111111,0x11111111,0x11111111,0x21122221,0x22112112,0x21212111,0x21122112,0x22112221
-
-	.word 0x11111111,0x11111111,0x11111111,0x11222222,0x11212121,0x11112111,0x11112111,0x11122212
-	.word 0x11111111,0x11111111,0x11111111,0x22212221,0x12111211,0x12111211,0x12111211,0x22222221
-	.word 0x11111111,0x11111111,0x11111111,0x22111222,0x11212121,0x22211221,0x11212121,0x22111222
-	.word 0x11111111,0x11111111,0x11111111,0x12222211,0x22121212,0x21121112,0x21121111,0x11222112
-	.word 0x11111111,0x11111111,0x11111111,0x22211222,0x12112111,0x12112111,0x12112111,0x22211222
-	.word 0x11111111,0x11111111,0x11111111,0x22212222,0x11121211,0x11121211,0x11121211,0x22212221
-	.word 0x11111111,0x11111111,0x11111111,0x22222211,0x12112112,0x12112112,0x12112112,0x22222211
-	.word 0x11111111,0x21111111,0x21111111,0x21112221,0x21121112,0x21121112,0x21121112,0x11112221
-
-	.word 0x11111222,0x11111111,0x11111111,0x12221122,0x11211211,0x22211211,0x11211211,0x12221122
-	.word 0x11111111,0x11111111,0x11111111,0x11222222,0x11121121,0x12221122,0x21121121,0x12221222
-	.word 0x11111111,0x11111111,0x11111111,0x11221222,0x12112121,0x12222121,0x11112121,0x12221222
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66666555,0x66666555,0x66666555,0x66665555,0x66665555,0x66655555,0x33555555,0x35555555
-
-	.word 0x33366666,0x33366666,0x33366666,0x33366666,0x33366666,0x33666333,0x66633333,0x33333333
-	.word 0x33336333,0x33333333,0x33333333,0x33333333,0x33777773,0x37777773,0x77777777,0x77777777
-	.word 0x66666633,0x66666633,0x46666633,0x46666333,0x46666333,0x66666633,0x66666663,0x66666666
-	.word 0x44444446,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444446,0x44444466
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x45555544
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x22111144
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222212
-
-	.word 0x11211112,0x11211112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21122212
-	.word 0x11121111,0x11121111,0x11222111,0x11111111,0x11111111,0x11111111,0x11111111,0x22112212
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22211221
-	.word 0x21111111,0x21111111,0x11111111,0x11111111,0x11111111,0x11211111,0x11211111,0x22212211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22122211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11112221
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21122211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22211122
-	.word 0x21111211,0x21111211,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21221221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11121111,0x11111111,0x21122112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x35555555,0x33555555,0x33555555,0x66555555,0x66555555,0x66355555,0x66355555,0x66355555
-	.word 0x33333333,0x33333333,0x33333333,0x33333336,0x33333366,0x33333666,0x33333666,0x33336666
-	.word 0x66667773,0x66666673,0x66666663,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x44444666,0x54446666,0x55546666,0x55556666,0x55556666,0x55554666,0x55544466,0x55544466
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444445,0x44444455,0x44444455,0x44444555,0x44444555,0x44445555,0x44445555,0x44444555
-	.word 0x11211144,0x11211144,0x11211144,0x22111144,0x11111144,0x11111144,0x11111144,0x11111144
-	.word 0x21112112,0x21112111,0x21112111,0x22122212,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11211121,0x11211121,0x11211121,0x11122212,0x11111111,0x11111111,0x21111111,0x11111111
-	.word 0x21121122,0x21121112,0x21121112,0x21112222,0x11111112,0x11111112,0x11111122,0x11111111
-	.word 0x11121111,0x11121122,0x11121211,0x11222122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21111211,0x21111211,0x21111211,0x21112221,0x21111111,0x21111111,0x22111111,0x11111111
-
-	.word 0x12112112,0x12112111,0x22112111,0x12111222,0x11111111,0x11111111,0x11111112,0x11111111
-	.word 0x11211221,0x11211212,0x11211211,0x22112221,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11212112,0x11122112,0x11212112,0x22122211,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11112112,0x11112221,0x11112112,0x11122222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12121121,0x12111121,0x12111121,0x21122211,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11121211,0x12211211,0x21111211,0x12221122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12212211,0x11211211,0x11211211,0x12212221,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12121112,0x12121112,0x12121112,0x21222122,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111121,0x11111111,0x11111111,0x11111122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66355555,0x63555555,0x33555555,0x35555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x33366666,0x33666666,0x33666666,0x33666666,0x33336633,0x33366355,0x43333555,0x44455555
-	.word 0x66666666,0x66666663,0x66666663,0x66666663,0x66666663,0x66666634,0x66666334,0x55533355
-	.word 0x66666666,0x46666666,0x44466666,0x44446666,0x44455666,0x44555666,0x44555556,0x44555555
-	.word 0x55544446,0x55444444,0x55444444,0x54444444,0x44444444,0x44444444,0x54444444,0x54444444
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x45555555,0x44444444,0x44444444
-	.word 0x44444555,0x44444455,0x44444455,0x44444455,0x44444445,0x44444444,0x44444444,0x44444444
-	.word 0x11111144,0x11111144,0x11111144,0x22111144,0x11211144,0x22211144,0x11211144,0x22111144
-	.word 0x11111111,0x11111111,0x11111111,0x12212211,0x22122112,0x12112112,0x12112111,0x22122212
-
-	.word 0x11111111,0x11111111,0x11111111,0x21221122,0x12211121,0x11211121,0x11211121,0x22211221
-	.word 0x11111111,0x11111111,0x11111111,0x12122112,0x21221121,0x21121121,0x21121121,0x11222112
-	.word 0x11111111,0x11111111,0x11111111,0x22211122,0x11121211,0x12211222,0x21111111,0x12221222
-	.word 0x11111111,0x11111111,0x11111111,0x11122211,0x11111121,0x11112211,0x11121111,0x11112221
-	.word 0x11111111,0x11111111,0x11111111,0x11221221,0x21212211,0x11211211,0x21211211,0x22212221
-	.word 0x11111111,0x11111111,0x11111111,0x22111222,0x11211211,0x22111222,0x11111211,0x22212222
-	.word 0x11111111,0x11112111,0x11112111,0x22122212,0x21112111,0x21112111,0x21112112,0x11122111
-	.word 0x11111111,0x11111111,0x11111111,0x12211221,0x22111211,0x12111211,0x12111211,0x22212222
-
-	.word 0x11111111,0x12111211,0x11111211,0x12212222,0x12111211,0x12111211,0x12111211,0x22212211
-	.word 0x11111111,0x11111111,0x11111111,0x21122122,0x11121121,0x11121121,0x11121121,0x21222211
-	.word 0x11111111,0x11111111,0x11111111,0x12212212,0x12122122,0x12112112,0x12112112,0x22122122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x54555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555554
-	.word 0x44555555,0x44555555,0x44555555,0x44455555,0x44455555,0x44455555,0x44445555,0x44444555
-	.word 0x45444444,0x45444444,0x45444444,0x44544444,0x44454444,0x44445444,0x44445444,0x44445444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x22211144
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21122122
-	.word 0x11211111,0x11211111,0x12221111,0x11111111,0x11111111,0x11111111,0x11111111,0x21222122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222112
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22211222
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22122112
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21222111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11112211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111121,0x11111121,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x45555555
-	.word 0x55555444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444455,0x44444544,0x44444544,0x44445544,0x44445444,0x44455444,0x44454444,0x54544444
-	.word 0x44444544,0x44444544,0x44444554,0x44444454,0x44444455,0x44444445,0x44444445,0x44444445
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x12111144,0x12111144,0x12111144,0x22211144,0x11111144,0x11111144,0x11111144,0x11111144
-	.word 0x11211211,0x11222211,0x11111211,0x21222111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x12121112,0x22122222,0x12121112,0x21222122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21212121,0x11211122,0x11211111,0x12221122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11221121,0x11212121,0x11211221,0x12221121,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11212112,0x22212221,0x11212111,0x22122211,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11211212,0x11111212,0x11111211,0x21222112,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111212,0x12111122,0x22111212,0x12122122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111221,0x11111212,0x11111211,0x11112221,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x44444445,0x44444445,0x44444445,0x44444445,0x44444445,0x44444445,0x44444445
-	.word 0x44555555,0x45544444,0x54444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x54544444,0x55544444,0x55444444,0x55444455,0x45445554,0x45455444,0x44454444,0x44544444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x66364444,0x33333644
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444466,0x44444666
-	.word 0x11111144,0x11111144,0x11111144,0x12211144,0x22111144,0x12111144,0x12111144,0x22211144
-	.word 0x11111111,0x11111111,0x11111111,0x22122111,0x11212211,0x11212122,0x11212122,0x22122211
-	.word 0x11111111,0x11111111,0x11111111,0x22222112,0x21121121,0x21121121,0x21121121,0x22222112
-	.word 0x11111111,0x11111111,0x11111111,0x22112222,0x12211211,0x12121211,0x12112211,0x22211212
-	.word 0x11122111,0x11121111,0x11121111,0x12222221,0x21121112,0x21121112,0x21121112,0x12222221
-	.word 0x11111111,0x11111111,0x11111111,0x22112221,0x12211211,0x12121211,0x12112211,0x22211211
-
-	.word 0x11111111,0x11111111,0x11111111,0x22221222,0x11211121,0x11211121,0x11211121,0x12222222
-	.word 0x11111111,0x11111111,0x11111111,0x22221122,0x21122112,0x21121212,0x21121122,0x21222112
-	.word 0x11111111,0x11111111,0x11111111,0x22111221,0x11212112,0x11212111,0x11212111,0x22111222
-	.word 0x11111111,0x11111111,0x11111111,0x11222112,0x12121121,0x11221121,0x12121121,0x11222112
-	.word 0x11111111,0x11111111,0x11111111,0x22112221,0x21112112,0x21112221,0x21112112,0x22122222
-	.word 0x11111111,0x11111111,0x11111111,0x22222212,0x12112111,0x22112222,0x12112111,0x22222212
-	.word 0x11111111,0x11111111,0x11111111,0x22212221,0x11121211,0x11121222,0x11121211,0x22212221
-	.word 0x11111111,0x11111111,0x11111111,0x12222211,0x21112112,0x21112112,0x21112112,0x11122211
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111222,0x11112111,0x11112111,0x11112111,0x11111222
-	.word 0x11111111,0x11111111,0x11111111,0x22222222,0x21121121,0x21121121,0x21121121,0x12222222
-	.word 0x11111111,0x11111111,0x11111111,0x22112222,0x11211211,0x22111211,0x12111211,0x21222221
-	.word 0x44111111,0x44111111,0x44111111,0x44111122,0x44111112,0x44111112,0x44111112,0x44111122
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x45555555,0x44555555,0x44455555
-
-	.word 0x44444445,0x44444445,0x44444445,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x34444444,0x36666644,0x36666634,0x66666334,0x66663334
-	.word 0x33333344,0x33333364,0x33333334,0x33333333,0x33333333,0x33333333,0x33373333,0x33373336
-	.word 0x44446666,0x44446666,0x44466663,0x44466663,0x44466633,0x44466333,0x44463333,0x63633333
-	.word 0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x11111144,0x12211144
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12221222
-
-	.word 0x11112111,0x11112111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21222222
-	.word 0x11111112,0x11111112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x12221122
-	.word 0x11121111,0x11121111,0x11222111,0x11111111,0x11111111,0x11111111,0x11111111,0x22112221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11112211,0x11111111,0x12211222
-	.word 0x12111111,0x12111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22222211
-	.word 0x21111111,0x21111111,0x22111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22112221
-	.word 0x11111111,0x11111111,0x11111112,0x11111111,0x11111111,0x11111111,0x11111111,0x12222222
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22212221
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22211221
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222122
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x21222111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11122212
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11221222
-	.word 0x11211112,0x11211112,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x22212211
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11222111
-	.word 0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111111,0x44111222
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44445555,0x44455555,0x44555555,0x45555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444455,0x44444555,0x54445555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x45555444,0x55555554,0x55555555,0x55555555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444445,0x44444455
-	.word 0x66666333,0x66633333,0x66633333,0x33333333,0x73333333,0x33333333,0x33333333,0x33333334
-
-	.word 0x33377336,0x33377773,0x33377777,0x33337777,0x33337777,0x33333333,0x33333333,0x33333333
-	.word 0x66633333,0x66633333,0x66333333,0x63333333,0x63333333,0x33333333,0x43333333,0x44333333
-	.word 0x12111144,0x12111144,0x12111144,0x21111144,0x21111144,0x12111144,0x12211144,0x11111444
-	.word 0x12112121,0x11112112,0x11112112,0x12221111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12121121,0x12121121,0x12121121,0x21222112,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21211211,0x12211211,0x21211211,0x12221122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12211211,0x12121211,0x12112211,0x22211211,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11221121,0x11212121,0x11211221,0x12221121,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x12112111,0x12112111,0x12112111,0x22222211,0x21111211,0x11111111,0x11111111,0x11111111
-	.word 0x21112112,0x21112221,0x21112112,0x12122222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11211211,0x12211211,0x21211211,0x12212221,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111211,0x12222211,0x12111211,0x22212221,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12112112,0x12112222,0x12111112,0x22212221,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12111211,0x12111211,0x12111211,0x11222111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x12121111,0x11221111,0x12121111,0x21222111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21211121,0x21211121,0x21211121,0x11122212,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x12211211,0x21211111,0x21211111,0x12221222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11121221,0x11121212,0x11121212,0x22212221,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x21211212,0x11111212,0x21111212,0x21222111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x44111211,0x44111222,0x44111211,0x44112222,0x44111111,0x44111111,0x44111111,0x44411111
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455,0x55555455
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55445555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x44444555,0x44444555,0x44445555,0x55545555,0x44555555,0x44445555,0x44445555,0x44445555
-	.word 0x33333334,0x33333334,0x33333334,0x33333335,0x33333336,0x33333333,0x33333333,0x33333364
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33343333,0x64443333,0x44443333,0x44446333
-	.word 0x44333333,0x44333333,0x44333333,0x55333333,0x54433333,0x44446633,0x44444444,0x44444444
-	.word 0x11111444,0x11114444,0x11144444,0x14444444,0x44444445,0x44444455,0x44444554,0x44444544
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33333444,0x33333444,0x33344444,0x44444444
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44433333,0x44444333,0x44444433,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44411111,0x44441111,0x44444111,0x44444441,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444,0x44244444
-	.word 0x55555455,0x55555455,0x55555455,0x55555455,0x44444455,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x44444444,0x55555555,0x55555555,0x55555555
-	.word 0x44445555,0x44444555,0x44445555,0x44455555,0x22244444,0x44455555,0x44455555,0x44455555
-	.word 0x33336644,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444633,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44445444,0x44455444,0x44454444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x22222222,0x44444444,0x44444444,0x44444444
-	.word 0x44244444,0x44244444,0x44244444,0x44244444,0x44222222,0x44444444,0x44444444,0x44444444
+	.word 0x003BA010,0xF0000032,0x55019001,0x44014055,0x5544440E,0xD0070054,0x441E7003,0xF00D70FF
+	.word 0xF01FF001,0xF015F01F,0xF001F01F,0x01F0D51F,0x40451FE0,0x18104403,0x0F030045,0x22222222
+	.word 0x01F02310,0x1FF00130,0xF01FF0CF,0xF0666415,0x6001701F,0xFF1FF01C,0x1FF05FF0,0x16F01FF0
+	.word 0x01F01FF0,0x01F01FF0,0xF01FF0FF,0xF01FF01F,0xF001F01F,0xF001F01F,0x1FF0FF1F,0x1FF01FF0
+	.word 0x1FF016F0,0x1FF001F0,0xF0FB01F0,0xF01FF01F,0x001FB01F,0x03E02405,0xC0F973F3,0xF001F003
+	.word 0x4001F001,0xE0333501,0x33330312,0x33333553,0x33F00160,0x530170BF,0x011012F0,0x5A139500
+	.word 0x77030150,0x53C900EF,0x55011067,0x17200800,0x01F09633,0x0001F0E0,0x644B0301,0x66446666
+	.word 0x0066663E,0x10032006,0x20450301,0x10A84603,0x12204618,0x11020016,0x11386666,0x00060011
+
+	.word 0x46219007,0x117F1144,0x65D001B0,0x1FF01FF0,0x1FF01FF0,0xF0FF1FF0,0xF01FF01F,0xF01FF01F
+	.word 0xF01FF01F,0xFF1FF01F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0,0xF01FF0FD,0xF01FF01F
+	.word 0x901FF01F,0x23104101,0x100400DF,0x08101119,0x03A073F3,0x03C073F3,0xD301F0DF,0x03A03362
+	.word 0x5F135303,0x01600350,0x0340735C,0x00060077,0x53017003,0x0400BF45,0x3003F044,0x00492303
+	.word 0x3003F087,0x0100FD03,0x0B90EB56,0x1311FF66,0x10458F13,0x3000FF04,0x2F910410,0x01F06643
+	.word 0x04107B13,0xF0FE6301,0xF0037003,0xF001F001,0x3001F001,0x22722101,0x03D00400,0x22120160
+	.word 0x4E210E00,0x22032012,0xA0073022,0x2113003E,0x003630DD,0x4C002206,0x5DA00700,0x3E210012
+	.word 0x03001212,0x4F000100,0xC3157DC0,0x21121F21,0xF0624021,0x3060005E,0xF77F0061,0x9DA00310
+
+	.word 0xA200A020,0x00430021,0xBB034078,0x602160C0,0x0060F058,0x5210215D,0xA0FB03A0,0x101E115E
+	.word 0x103700E3,0x3FC01203,0x12773D00,0x0120A300,0x00213D10,0xF0A1C00D,0x01F0F701,0x01F001F0
+	.word 0x13410180,0x4003F093,0x73F3FF03,0x03F07FF3,0x01F07FF3,0x6FA37E63,0x90E1DF16,0x8069931F
+	.word 0x33354301,0x4F590343,0x43630345,0x66020044,0x1301E0BB,0xCD26FF67,0x5B2301F0,0x3CF01D10
+	.word 0x01F001F0,0x00BB8163,0x08106404,0x131003C0,0x7073F344,0x0CE5FF03,0x01F001F0,0x541301F0
+	.word 0x015028F2,0xE2FF6712,0x023C90E8,0xF08C23F0,0x335C4001,0xFF01F0AB,0x47D35E50,0x11602C10
+	.word 0x9D209910,0xD013B043,0x034D90FF,0x933523AF,0x304FA052,0x70C0F010,0x9E10FF9F,0x10F4CE13
+	.word 0x47A43F70,0x3A003FB0,0xF0FF5804,0xF001F019,0xF001F001,0xC001F001,0xFF77F301,0x03F07FF3
+
+	.word 0x03F07FF3,0x01F07FF3,0x01D001F0,0x80072AFF,0xF33C9A03,0xF001F057,0xF001F001,0x0100FE01
+	.word 0xFB065FB0,0x8880CB13,0xE5331F90,0xA7D0BF45,0xB054F145,0xF001F003,0x62913201,0x0B80FFA1
+	.word 0xF8059742,0x10402B16,0xBC168F22,0x50FF1710,0x25E8123D,0x120380D0,0x101F40F6,0xFF013009
+	.word 0x68302233,0xA3120826,0x1B160A20,0x2F13AA02,0x123C36BF,0x9E30D853,0x58065F10,0xA2600310
+	.word 0x305F30FF,0x307C806A,0x22F55292,0x408110FE,0x9720FF03,0x16530300,0xA6134E10,0x2A140100
+	.word 0xF0FFE770,0x20BFF0BF,0x107707BF,0x273840B2,0xFF2041C5,0xF7573F41,0x01404C40,0x17F7F743
+	.word 0xB7F30B30,0xF001F0FF,0xF201E001,0xF07FF316,0xF07FF303,0x7FF3FF03,0x01F001F0,0x013001F0
+	.word 0x7FF3279A,0x457F2443,0xBF2D0200,0x37130340,0x5EF33623,0xF0FF01F0,0x90A22A01,0x2A4F3703
+
+	.word 0xC0A35387,0xFF831303,0x54F14080,0x01C07FF3,0x15F09016,0x17520170,0xF001F0FF,0xF001F01F
+	.word 0xF01FF01F,0xF01FF01F,0x1FF0FF01,0x1FF001F0,0x1FF001F0,0x15F01FF0,0xF0FF1FF0,0xF01FF001
+	.word 0xF01FF001,0xF01FF01F,0xFF01F01F,0xB6A31F70,0x7FF316F2,0x7FF303F0,0x7FF303F0,0x5501F08B
+	.word 0x03006555,0x70020066,0x70656D03,0x56010003,0x016059FD,0x58EB1233,0x66030056,0x29C00310
+	.word 0x77366663,0x3D060A63,0x6301C087,0xA31D3C10,0x467FC500,0x3CDA0300,0x17100310,0x01F001F0
+	.word 0xF3CF01F0,0x2203407F,0x70690544,0x4D9FFC03,0x0120E75C,0xD7B1AF2C,0x16102121,0x0710C105
+	.word 0xB00F10FF,0x2517103F,0x250D1099,0x2640A0C1,0xBF1DFF51,0x25270730,0xDE061E90,0x79165C00
+	.word 0x26FF6D26,0x107FB022,0x3661461A,0x103FB047,0xFF0170C0,0x972747D4,0x41273F00,0x372A0700
+
+	.word 0x541798C2,0x363A10FF,0x101EC0F1,0x50F80010,0xA00F2003,0x4031FF3E,0x8F200350,0x3C11C0C0
+	.word 0xD78A0350,0x10FFD120,0x30153E5D,0x702E4E03,0x300D103E,0xFFFC169A,0x1F913F77,0x5E107731
+	.word 0xBFA02E3F,0x58203F11,0x200300FF,0xF31F100F,0xF07FF377,0xF07FF303,0x7FF3F503,0x6B8301F0
+	.word 0x00658373,0x5B035503,0x66355506,0x26033666,0x3C3303B0,0x020E6663,0x06000420,0x777318BE
+	.word 0x03107747,0x30777737,0x40631301,0x00467F03,0x43033032,0xF301107F,0x53013063,0x01F0FF93
+	.word 0xEC160180,0x7FF315F0,0x8F6303F0,0xC0FF1FA2,0x426D2901,0x221DF06C,0x100C12FF,0xFF02FE09
+	.word 0x5FF01F20,0x33F01FA0,0x87F701A0,0x40301FC0,0x90F359FF,0xD2033019,0x1201D0FF,0x8015F090
+	.word 0x13F0FF7F,0x18F13FC0,0x41101E90,0x5F7040F1,0xF0FFAE14,0x33010016,0xF08D2436,0xF05F801C
+
+	.word 0xFF01F013,0x01C001F0,0x7FF316F2,0x7FF303F0,0x7FF303F0,0x0301F0FD,0x106B4363,0x00771303
+	.word 0x03603503,0x035B93DE,0x10103379,0x03208213,0x0F730C00,0x73666677,0x01F04F83,0x01A001F0
+	.word 0x076803C2,0x66665405,0x46817754,0x0A0300FF,0xF0031063,0x1301B0AE,0x206E1A80,0xF75AFF03
+	.word 0xFF4A0B2E,0x60D1EFC6,0x0150351D,0xE1FF4F03,0xD61E80D2,0x85FB3C6F,0x109A2CAF,0xFF1BA253
+	.word 0x0F368F15,0x1E200EF3,0x5D265166,0x2C204F73,0x302726FF,0x600C1403,0x12085080,0x204C16A2
+	.word 0xEFF3FFC8,0x4D56EC15,0x5F306FF3,0x97E9DF4D,0x50FFE440,0xF3C8105D,0x10EB360F,0xF07E2060
+	.word 0xFFAB3E40,0x1E219F40,0x0F18FEC0,0x1F010330,0x10905FE0,0xF03DF1FF,0xF001F001,0xF301C001
+	.word 0xF07FF377,0x7FF3F903,0xBEF203F0,0x672301F0,0xEF566355,0x361DD0F8,0x03C256F3,0x55020070
+
+	.word 0x33073663,0x43333555,0x4B5AFD12,0x34630390,0x08000310,0x00533355,0xCD65333F,0x6D1A6813
+	.word 0x33005666,0x4D56B00A,0x3D466FAF,0x540350CB,0x0B10B986,0x7673C1F0,0x130237FF,0xE740806F
+	.word 0x5A50B110,0xD907407F,0x02217F7F,0x22D5266C,0x028FD3F3,0x63BD395F,0x50B3FFB0,0x15193B00
+	.word 0xBFF9E238,0xC6220F46,0xE9FF8712,0x43BE121F,0xE64D10D4,0x109A007F,0xFF5A10A3,0xDFD95823
+	.word 0x81104F2A,0x0F2AF243,0x03303820,0x60CF20FF,0xC00520BA,0x6A47235F,0x303F60C3,0x4F10FF0F
+	.word 0x2910DD8A,0x331B7FC0,0x30105084,0x00FF1FA1,0x5A621120,0xB00E107F,0xF301C0E1,0xFF01F0CD
+	.word 0x01F001F0,0x019001F0,0x7FF377F3,0x7FF303F0,0xF203F0FF,0xF001F0BD,0xF001D001,0xF001F045
+	.word 0x3870EF01,0x03306723,0x46038045,0x4032339F,0x7213FF03,0x03500640,0x01F001F0,0x7FF301F0
+
+	.word 0x23FF03F0,0x708EF187,0x864F1201,0xF50DE28E,0xFF01B0AF,0x16F01127,0x80FA3F70,0x9FF23FC0
+	.word 0x7FF001A0,0xF05FB0FF,0xF020C07F,0xF001F012,0xF001F001,0x01F0FF01,0x011001F0,0x01F03CFB
+	.word 0x01F001F0,0xF0FF01F0,0x2001F001,0xF316F201,0xF303F07F,0xFD03F07F,0x01F039F3,0x01F001F0
+	.word 0x015001F0,0xFAA11645,0x0170F4F2,0x61531C20,0x5054E156,0x547F5410,0x76437963,0x0350C356
+	.word 0x01F001F0,0xA3BF01F0,0x0370127F,0x60B1F716,0x6B357849,0x29FFCFF2,0x1997091F,0x101FF9FA
+	.word 0x42861632,0xFF7FF945,0x22001530,0x1FF07046,0xC7263116,0x1F301FFA,0x202C26FF,0xF0CF1388
+	.word 0x10A7169F,0x168D0606,0x7FE0FF5B,0xA2FEFA3A,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xF001F001,0xF001F001,0xFF01F001,0x01B001F0,0x7FF377F3,0x7FF303F0,0x7FF303F0,0xF001F0FF
+
+	.word 0xC364F301,0x00039013,0xF650531E,0x0120FDAD,0x634A6303,0x0900F216,0x0045B303,0x32F0F12F
+	.word 0x01F001F0,0x66360170,0xEF830E44,0x013017F0,0x1E44EA0A,0x13EFC65B,0xFF831387,0x89A18F63
+	.word 0xE2026F16,0x0310E219,0xCF160FD3,0x4A5B5AFF,0x1D7FB95F,0x13C3297F,0x1305100D,0x115EDF57
+	.word 0x13224F1A,0x102F6E2E,0xC07EA00F,0x7010F73F,0x111A5FA0,0xC0228F8E,0x1A3E003F,0xE129FFDA
+	.word 0xAFC34820,0x1F005900,0x0330D217,0xB0FFA72A,0x30EF4DDF,0x2D9ED707,0x207800E0,0xFF3614D5
+	.word 0x90001FD1,0xC710262F,0x1FB1BF2B,0x7F2B6724,0xDB1434FF,0x10BE103F,0xD4035057,0x8F0E20AE
+	.word 0xCDD4FF21,0x9FA16E00,0x5F311FE1,0xCE31925F,0x00BF1E82,0x3000448C,0x0F100360,0x7FF373F3
+	.word 0xF3FF03F0,0xF001F07F,0x13729301,0xF6791357,0xFA01F08B,0x01F001F0,0x01F001F0,0x0E340100
+
+	.word 0x0EA83624,0x3F1E363F,0x44710E34,0x332C3333,0x34030064,0x01B00300,0x36763337,0x532E0300
+	.word 0x03630300,0x3303106C,0x630310A9,0x10330300,0xF4636303,0x8FB3FFD4,0xCFC1C1B1,0x20F9F616
+	.word 0x5D63EF91,0x23FF01F0,0x3068120F,0x337CF621,0x6A36F06F,0xFF274E17,0x808062F0,0x202B9D40
+	.word 0x13705FF0,0x3E2040F0,0xA016F0FF,0xA0B4F03F,0xB03FFB1F,0xE01EF05F,0x14F0FF60,0x1EDF0170
+	.word 0xFE035FE0,0x1DF06D5E,0xF0F780F0,0xF21E207F,0x128F5316,0x7FF37FF3,0xF3FF73F3,0x7001F07F
+	.word 0x1D981601,0x13A32D8F,0xF81DC077,0xCC2601F0,0x1D009003,0x5554C0F6,0x7690F745,0x01303DF0
+	.word 0x03338E5A,0x40270367,0x0120B003,0x13615373,0x37733673,0x77730533,0x20773337,0x03203303
+	.word 0x6001B0ED,0x6303103B,0x01100340,0x98030043,0x21117FCA,0xFB160340,0xFF144412,0x73150626
+
+	.word 0x51F51625,0x013AD812,0xE8F10F46,0x260A47FF,0x2D3FF0CE,0x90CFF6C4,0xD09FFA5F,0x0360FF80
+	.word 0x6CC26F13,0x3FF08FC6,0x9F20DC30,0xF0FFBE00,0x1619001F,0xF09D3077,0x10F8109F,0xFFFE4A75
+	.word 0x3920CFF2,0x1EF00140,0x3A002010,0xF0361710,0x20DEF0FF,0xF30320FD,0x1480206F,0x25B027BC
+	.word 0x3FD0FF0F,0x03405118,0xBF2B9FF0,0x1E10952B,0x20EB7FF0,0x206723BF,0x83D32207,0xF373F341
+	.word 0x73F3FF7F,0x01F07FF3,0x01F001F0,0x12F04133,0xF0FF01F0,0x13015001,0x00AB33A7,0x40902003
+	.word 0xDF03300B,0x03506313,0x836F1335,0xF0F71659,0x7D291001,0x131A0044,0x000300BB,0x55038008
+	.word 0x543F7603,0x507C1A33,0x13630301,0x10081084,0x866EFF0D,0x8ED1D447,0x03209010,0x3E100400
+	.word 0x00AF1FD0,0x0200445F,0xE0F85A44,0xF067C43F,0x1FF0FF1F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0
+
+	.word 0xF0FF1FF0,0xF01FF01F,0xF01FF01F,0xF01FF01F,0xFE1FF01F,0x1FF01FF0,0x1FF01FF0,0x1FF01FF0
+	.word 0xFF411F10,0x6A131D22,0x01F06D13,0x7FF373F3,0x15000380,0x8304F3FF,0xF01FF04D,0xF016F01F
+	.word 0xF001F01F,0x1140E61F,0xF4127F73,0x6F372224,0xFF440330,0xED90B506,0x0F90C31B,0x0DA1460A
+	.word 0x01D01FD0,0x171FE0FF,0xF06C53A1,0xF03FF01F,0xF01FF01F,0x1FF0FF16,0x1FF001F0,0x1FF001F0
+	.word 0x1FF01FF0,0xF0FF1FF0,0xF01FF001,0xF01FF001,0xF01FF01F,0xFF16F01F,0x01F01FF0,0x01F01FF0
+	.word 0x1FF01FF0,0x1FF01FF0,0xF001F0F8,0xB301401F,0x001ED06F
 
 	.section .rodata
 	.align	2
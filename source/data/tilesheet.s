@@ -6,8 +6,8 @@
 @	tilesheet, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed, 14208 bytes raw
+@	Total size: 512 + 2968 = 3480
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,113 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheetTiles		@ 14208 unsigned chars
+	.global tilesheetTiles		@ 2968 unsigned chars
 	.hidden tilesheetTiles
 tilesheetTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55555555,0x88888885,0x55555585,0x55555585,0x55535585,0x55555585,0x55555585,0x55555585
-	.word 0x55555555,0x88888888,0x88855555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x88888888,0x55555888,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x58888888,0x58555555,0x58555555,0x58553555,0x58555555,0x58555555,0x58555555
-
-	.word 0x55555585,0x55555585,0x55555885,0x55555885,0x55555885,0x55555885,0x55555585,0x55555585
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x58555555,0x58555555,0x58855555,0x58855555,0x58855555,0x58855555,0x58555555,0x58555555
-	.word 0x55555585,0x55555585,0x55555585,0x55535585,0x55555585,0x55555585,0x88888885,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x88855555,0x88888888,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555888,0x88888888,0x55555555
-	.word 0x58555555,0x58555555,0x58555555,0x58553555,0x58555555,0x58555555,0x58888888,0x55555555
-
-	.word 0x69999999,0x99999999,0x99999999,0x99999996,0x99999666,0x99996666,0x99966666,0x99666666
-	.word 0x99966666,0x99666669,0x66666999,0x66699999,0x66999999,0x69999999,0x69999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999996,0x99999666,0x99996666,0x99966666,0x99666666
-	.word 0x99966666,0x99666669,0x66666999,0x66699999,0x66999999,0x69999999,0x69999999,0x99999999
-	.word 0x96666699,0x66669999,0x66699999,0x66999999,0x66999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999996,0x99999966,0x99999666,0x99966666,0x99666669,0x66666999
-	.word 0x96666699,0x66669999,0x66699999,0x66999999,0x66999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999996,0x99999966,0x99999666,0x99966666,0x99666669,0x66666999
-
-	.word 0x99999996,0x99999666,0x99996666,0x99966666,0x99666666,0x96666699,0x66669999,0x66699999
-	.word 0x66699999,0x66999999,0x69999999,0x69999999,0x99999999,0x99999999,0x99999999,0x99999966
-	.word 0x99999996,0x99999666,0x99996666,0x99966666,0x99666666,0x96666699,0x66669999,0x66999999
-	.word 0x66699999,0x66999999,0x69999999,0x69999999,0x99999999,0x99999999,0x99999996,0x99999966
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x0AAAAAAA
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAA00
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xAAAAAAA0,0xAAAAAAA0,0xAA0AAAA0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x0AAAAAAA,0x0AAAAAAA,0x0AAAAAAA,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAAA0000,0xAAAA0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00AAAAAA,0x000AA0AA,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x55555555,0x55555555,0xCCCCCC55,0xEEEEEE55,0x33333E55,0xEEEEEE55,0x33333E55,0xEEEEEE55
-	.word 0x55555555,0x55555555,0xCCCCCCCC,0xEEEEEEEE,0xE3333333,0xEEEEEEEE,0xE3333333,0xEEEEEEEE
-	.word 0x55555555,0x55555555,0xCCCCCCCC,0xEEEEEEEE,0x3333333E,0xEEEEEEEE,0x3333333E,0xEEEEEEEE
-	.word 0x55555555,0x55555555,0x55CCCCCC,0x55EEEEEE,0x55E33333,0x55EEEEEE,0x55E33333,0x55EEEEEE
-	.word 0x33333E55,0xEEEEEE55,0x33333E55,0xEEEEEE55,0x33333E55,0xEEEEEE55,0x33333E55,0xEEEEEE55
-	.word 0xE3333333,0xEEEEEEEE,0xE3333333,0xEEEEEEEE,0xE3333333,0xEEEEEEEE,0xE3333333,0xEEEEEEEE
-	.word 0x3333333E,0xEEEEEEEE,0x3333333E,0xEEEEEEEE,0x3333333E,0xEEEEEEEE,0x3333333E,0xEEEEEEEE
-	.word 0x55E33333,0x55EEEEEE,0x55E33333,0x55EEEEEE,0x55E33333,0x55EEEEEE,0x55E33333,0x55EEEEEE
-
-	.word 0x33333E55,0xEEEEEE55,0x33333E55,0xEEEEEE55,0x33333E55,0xEEEEEE55,0x55555555,0x55555555
-	.word 0xE3333333,0xEEEEEEEE,0xE3333333,0xEEEEEEEE,0xE3333333,0xEEEEEEEE,0x55555555,0x55555555
-	.word 0x3333333E,0xEEEEEEEE,0x3333333E,0xEEEEEEEE,0x3333333E,0xEEEEEEEE,0x55555555,0x55555555
-	.word 0x55E33333,0x55EEEEEE,0x55E33333,0x55EEEEEE,0x55E33333,0x55EEEEEE,0x55555555,0x55555555
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xDDBBBBBB,0xDDDBBBBB,0xDDDDBBBB,0xDDDDDBBB,0xDDEDDDBB,0xDDDEDDBB,0xEEDDDEEB
-	.word 0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDEEEDD,0xDDEEEEED,0xDDEEEEED,0xEEDEEEED
-	.word 0xBBBBBBBB,0xBBBBBBDD,0xBBBBBDDD,0xBBBBDDDD,0xBBBDDDEE,0xBBDDDEEE,0xBBDEDDDD,0xBDEEEDDE
-
-	.word 0xEEEDEEEB,0xEEEEEEEB,0xEEEEEEEB,0xEEEEEEEB,0xDEEEEEEB,0xDEDEEEEB,0xEDDEEEEB,0xEEEEEEBB
-	.word 0xEEDEEEED,0xEEDDEDDE,0xEDDEEEEE,0xDDDEEEEE,0xDDDDDEDD,0xDDDDDDED,0xDDDDDDDD,0xDDDDEDDD
-	.word 0xBDEEDEEE,0xBDDDDDEE,0xBDDEEEEE,0xBDDEEDDD,0xBDDDDDDD,0xBDDDDDDD,0xBDDDDDDD,0xBBDDDDDD
-	.word 0xEEEEEEBB,0xEEEDDBBB,0xEDDDBBBB,0xDEDBBBBB,0xDDBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xDDEEDEED,0xDDEEEEED,0xDDDDDDEE,0xDDDDEEED,0xDDDDDEED,0xDDDDDDDD,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBDDDDDD,0xBBBDDDDD,0xBBBBDDDD,0xBBBBBDDD,0xBBBBBBDD,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBFBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBFFBBBB,0xBBFFBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x69999999,0x99999999,0x99999999,0x99999996,0x49999666,0x99996666,0x99966666,0x99666666
-	.word 0x99966666,0x99666669,0x66666999,0x66699999,0x66999994,0x69999994,0x69999994,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999996,0x99999666,0x99996666,0x99966666,0x99666666
-	.word 0x99966666,0x99666669,0x66666999,0x66699999,0x66999999,0x69999999,0x69999999,0x99999999
-	.word 0x96666699,0x66669999,0x66699999,0x66999999,0x66999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999996,0x99999966,0x99999666,0x99966666,0x99666669,0x66666999
-	.word 0x96666699,0x66669999,0x66699999,0x66999999,0x66999999,0x99999999,0x49999999,0x49999999
-	.word 0x99999999,0x99999999,0x99999996,0x99999966,0x99999666,0x99966666,0x99666644,0x66666949
-
-	.word 0x99999996,0x99999666,0x99996666,0x99966666,0x99666666,0x96666699,0x66669999,0x66699999
-	.word 0x66699999,0x66999999,0x69999999,0x69999999,0x99999999,0x99999999,0x99999999,0x99999966
-	.word 0x49499996,0x99499666,0x99996666,0x99966666,0x99666666,0x96666699,0x66669999,0x66999999
-	.word 0x66699999,0x66999999,0x69999999,0x69999999,0x99999999,0x99999999,0x99999996,0x99999966
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x22222222,0x22222222,0x22222227,0x22227777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x22222222,0x22222222,0x22222222,0x77772222,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x22222222,0x22222222,0x22222222,0x22777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x22222222,0x22222222,0x77222222,0x77777722,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777770,0x77777770,0x77110000,0x01110000,0x01110000,0x11110000,0x11110000
-	.word 0x07777777,0x07777777,0x07777777,0x00010077,0x00110000,0x00000000,0x00000001,0x00000001
-	.word 0x77777110,0x77771110,0x77771110,0x00001110,0x01101110,0x01001110,0x01111110,0x01111110
-	.word 0x07777777,0x00077777,0x00000077,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x10000000,0x10000000,0x10000000,0x10100000,0x11100000,0x00000000,0x00000000,0x00000000
-	.word 0x00000001,0x00000001,0x00000001,0x00000001,0x00000001,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22227777,0x77777777,0x44777777,0x44477777,0x74477777
-	.word 0x22222222,0x22222222,0x22222222,0x77772222,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x22222222,0x22222222,0x22222222,0x22777777,0x77777777,0x74477777,0x74447777,0x77447777
-	.word 0x22222222,0x22222222,0x22222222,0x77777722,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777770,0x77777770,0x77001000,0x44001100,0x44400000,0x74400000,0x70000000
-	.word 0x77777744,0x77777444,0x17777447,0x10000077,0x11110007,0x00010007,0x00000007,0x00000007
-	.word 0x77777077,0x47770077,0x47770001,0x77000001,0x77000001,0x74400000,0x74440000,0x77440000
-	.word 0x07777777,0x01177774,0x01100044,0x01101044,0x01111000,0x00000000,0x00000000,0x00000000
-	.word 0x70000000,0x70000000,0x70000000,0x44000000,0x44400000,0x74400000,0x70000000,0x70000000
-	.word 0x00000044,0x00000444,0x00000447,0x00000007,0x00000007,0x00000007,0x00000007,0x00000044
-	.word 0x47000000,0x47000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000004,0x00000044,0x00000044,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000000CC,0x000000CC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x000000CC,0x00000CCC,0x000CCCCC,0x0CCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCC00CC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000000CC,0x0000CCCC,0x000CCCCC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0xCC000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x0CCCCCCC,0xCCCCCCCC,0xCCCCCCC0,0xCCCCC000,0xCCC00000,0xCC000000,0x00000000,0x00000000
-	.word 0x00000000,0x0000000C,0x000000CC,0x0000CCCC,0x00CCCCCC,0x0CCCCCCC,0xCCCCCCCC,0xCCCCCC00
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000000C,0x00000CCC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xCC000000,0xCC000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xCC000000,0xCCCC0000,0xCCCCC000
-	.word 0xCC000000,0xCCC00000,0xCCCCC000,0xCCCCCCC0,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCC00CCCC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xC0000000,0xCCC00000
-	.word 0x00000000,0xC0000000,0xCC000000,0xCCCC0000,0xCCCCCC00,0xCCCCCCC0,0xCCCCCCCC,0x00CCCCCC
-	.word 0xCCCCCCC0,0xCCCCCCCC,0x0CCCCCCC,0x000CCCCC,0x00000CCC,0x000000CC,0x00000000,0x00000000
-	.word 0x000000CC,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x0AAAAAAA
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAA00
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAA0,0xAAAAAAA0,0xAA0AAAA0,0x00000000,0x00000000,0x00000000,0xAA000000,0xCCCC00CC
-	.word 0x0AAAAAAA,0xAA00AAAA,0xAAA000AA,0xAAAAA000,0xAAAAAAA0,0xAAAAAAAA,0x0AAAAAAA,0x000ACCCC
-	.word 0xAAAAAAAA,0xAAAAAAAA,0x00AAAAAA,0x0000AAAA,0x000000AA,0x0000000A,0x00000000,0x00000000
-	.word 0x00AAAAAA,0x000AA0AA,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x0CCCCCCC,0x000CCCCC,0x00000CCC,0x000000CC,0x000000CC
-	.word 0x0000CCCC,0x000000CC,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x0AAAAAAA
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAA00
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xAAAAAAA0,0x00AAAAA0,0x000AAAA0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAA00,0xAAAA0000,0xAA000000,0xA0000000,0x00000000,0x00000000
-	.word 0xAAAA0000,0xAAAA00AA,0x00000AAA,0x000AAAAA,0x0AAAAAAA,0xAAAAAAAA,0xAAAAAAA0,0xCCCCA000
-	.word 0x00AAAAAA,0x000AA0AA,0x00000000,0x00000000,0x00000000,0x00000000,0x000000AA,0xCC00CCCC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xCCCC0000,0xCC000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC0,0xCCCCC000,0xCCC00000,0xCC000000,0xCC000000
-
-	.word 0x55555555,0x88888885,0x55555585,0x55555585,0x53555585,0x55555585,0x55555585,0x55555585
-	.word 0x55555555,0x55558888,0xCC588555,0x66585555,0x66585555,0x69585555,0x69585555,0x99585555
-	.word 0x55555555,0x55555555,0xCCCCCCCC,0x99999996,0x99999666,0x99996666,0x99966666,0x99666666
-	.word 0x55555555,0x53555555,0x555CCCCC,0x55C99999,0x55999999,0x55999999,0x55999999,0x55999999
-	.word 0x55555585,0x55555585,0x55555885,0x55555885,0x55555885,0x55555885,0x55555585,0x55555585
-	.word 0x99585555,0x99585555,0x99585555,0x99585555,0x99585555,0x99585555,0x99585555,0x66585555
-	.word 0x96666699,0x66669999,0x66699999,0x66999999,0x66999999,0x99999999,0x99999999,0x99999999
-	.word 0x55999999,0x55999999,0x55999996,0x55999966,0x55999666,0x55966666,0x55666669,0x55666999
-
-	.word 0x55555585,0x55555585,0x55555585,0x35555585,0x55555585,0x55555585,0x88888885,0x55555555
-	.word 0x66585555,0x66585555,0x69585555,0x69585555,0x99585555,0x99588555,0x55558888,0x55555555
-	.word 0x99999996,0x99999666,0x99996666,0x99966666,0x99666666,0x96666699,0x55555555,0x55555555
-	.word 0x55699999,0x55999999,0x55999999,0x55999999,0x55999999,0x55599999,0x53555555,0x55555555
-	.word 0x55555555,0x88888885,0x55555585,0x55555585,0x55555585,0x55535585,0x55555585,0x55555585
-	.word 0x55555555,0x88888888,0x88555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x88888888,0x55555588,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x58888888,0x58555555,0x58555555,0x58553555,0x58555555,0x58555555,0x58555555
-
-	.word 0x55555585,0x55555885,0x88888855,0x55555555,0xCCCCC555,0x99999C55,0x99999955,0x99999955
-	.word 0x55555555,0x55555555,0x88888888,0x55555555,0xCCCCCCCC,0x99966666,0x99666669,0x66666999
-	.word 0x55555555,0x55555555,0x88888888,0x55555555,0xCCCCCCCC,0x99999999,0x99999999,0x99999999
-	.word 0x58555555,0x58855555,0x55888888,0x55555555,0x555CCCCC,0x55C66666,0x55666669,0x55666999
-	.word 0x99999955,0x99999655,0x99996655,0x99966655,0x99666655,0x96666555,0x55555535,0x55555555
-	.word 0x66699999,0x66999999,0x69999999,0x69999999,0x99999999,0x99999999,0x55555555,0x55555555
-	.word 0x99999996,0x99999666,0x99996666,0x99966666,0x99666666,0x96666699,0x55555555,0x55555555
-	.word 0x55699999,0x55999999,0x55999999,0x55999999,0x55999999,0x55599999,0x53555555,0x55555555
-
-	.word 0x55555555,0x55555535,0xCCCCC555,0x99999C55,0x99999655,0x99996655,0x99966655,0x99666655
-	.word 0x55555555,0x55555555,0xCCCCCCCC,0x66699999,0x66999999,0x69999999,0x69999999,0x99999999
-	.word 0x55555555,0x88885555,0x555885CC,0x55558596,0x55558566,0x55558566,0x55558566,0x55558566
-	.word 0x55555555,0x58888888,0x58555555,0x58555555,0x58555553,0x58555555,0x58555555,0x58555555
-	.word 0x96666655,0x66669955,0x66699955,0x66999955,0x66999955,0x99999955,0x99999955,0x99999955
-	.word 0x99999999,0x99999999,0x99999996,0x99999966,0x99999666,0x99966666,0x99666669,0x66666999
-	.word 0x55558599,0x55558599,0x55558599,0x55558599,0x55558599,0x55558599,0x55558599,0x55558599
-	.word 0x58555555,0x58555555,0x58855555,0x58855555,0x58855555,0x58855555,0x58555555,0x58555555
-
-	.word 0x99999955,0x99999655,0x99996655,0x99966655,0x99666655,0x96666555,0x55555535,0x55555555
-	.word 0x66699999,0x66999999,0x69999999,0x69999999,0x99999999,0x99999999,0x55555555,0x55555555
-	.word 0x55558596,0x55558566,0x55558566,0x55558566,0x55558566,0x55588599,0x88885555,0x55555555
-	.word 0x58555555,0x58555555,0x58555555,0x58555535,0x58555555,0x58555555,0x58888888,0x55555555
-	.word 0x55555555,0x55555535,0xCCCCC555,0x99999C55,0x99999655,0x99996655,0x99966655,0x99666655
-	.word 0x55555555,0x55555555,0xCCCCCCCC,0x66699999,0x66999999,0x69999999,0x69999999,0x99999999
-	.word 0x55555555,0x55555555,0xCCCCCCCC,0x99999996,0x99999666,0x99996666,0x99966666,0x99666666
-	.word 0x55555555,0x53555555,0x555CCCCC,0x55C99999,0x55999999,0x55999999,0x55999999,0x55999999
-
-	.word 0x96666655,0x66669955,0x66699955,0x66999955,0x55555555,0x88888855,0x55555885,0x55555585
-	.word 0x99999999,0x99999999,0x99999996,0x99999966,0x55555555,0x88888888,0x55555555,0x55555555
-	.word 0x96666699,0x66669999,0x66699999,0x66999999,0x55555555,0x88888888,0x55555555,0x55555555
-	.word 0x55999999,0x55999999,0x55999996,0x55999966,0x55555555,0x55888888,0x58855555,0x58555555
-	.word 0x55555585,0x55535585,0x55555585,0x55555585,0x55555585,0x55555585,0x88888885,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x88555555,0x88888888,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555588,0x88888888,0x55555555
-	.word 0x58553555,0x58555555,0x58555555,0x58555555,0x58555555,0x58555555,0x58888888,0x55555555
-
-	.word 0x00000000,0x00000000,0x55000000,0x55000000,0x55000000,0xAA000000,0xAA000000,0xAA000000
-	.word 0x00000000,0x00000000,0x00055555,0x00055555,0x00055555,0x000AAAAA,0x000AAAAA,0x000AA000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAA000000,0xAA000000,0xAA000000,0xAA000000,0xAA000000,0xAA555555,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x000AA0D0,0x000AA0D0,0x000AA0D0,0x000AA000,0x000AACCC,0x000AACCC,0x000AACCC,0x000AAAAA
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAA000AAA,0xAA0000AA,0xAA00000A,0x0A000000,0x00000000,0x00000000
-	.word 0x0000AAAA,0x00000AAA,0x000000AA,0x0000000A,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x55555000,0x55555000,0x55555000,0xAAAAA000,0xAAAAA000,0x000AA000
-	.word 0x00000000,0x00000000,0x00000055,0x00000055,0x00000055,0x000000AA,0x000000AA,0x000000AA
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x0D0AA000,0x0D0AA000,0x0D0AA000,0x000AA000,0xCCCAA000,0xCCCAA000,0xCCCAA000,0xAAAAA000
-	.word 0x000000AA,0x000000AA,0x000000AA,0x000000AA,0x000000AA,0x555555AA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAAA0000,0xAAA00000,0xAA000000,0xA0000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAA000AA,0xAA0000AA,0xA00000AA,0x000000A0,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x000000CC,0xCCCCCCCC,0xCCCCCCCC,0x1CCC1CCC,0x1CCC1CCC,0xACCCACCC,0xACCCACCC,0xACCCACCC
-	.word 0x00000000,0xCCCCCCCC,0xCCCCCCCC,0x1CCC1CCC,0x1CCC1CCC,0xACCCACCC,0xACCCACCC,0xACCCACCC
-	.word 0x00000000,0xCCCCCCCC,0xCCCCCCCC,0x1CCC1CCC,0x1CCC1CCC,0xACCCACCC,0xACCCACCC,0xACCCACCC
-	.word 0xCCC00000,0xCCCCCCCC,0xCCCCCCCC,0xCCCC1CCC,0xCCCC1CCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC
-	.word 0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC
-	.word 0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC
-	.word 0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC
-	.word 0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC
-
-	.word 0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xCCCCCCCC,0xCCCCCC11,0x11111111,0x11111100
-	.word 0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xCCCCCCCC,0xCCCCCCCC,0x11111111,0x11111111
-	.word 0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xCCCCCCCC,0xCCCCCCCC,0x11111111,0x11111111
-	.word 0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCCCCC,0x111CCCCC,0x11111111,0x00011111
-	.word 0xEEEEEEEE,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAA0,0xAAAAAAA0
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xEEAAAAAA,0xEE55AAAA,0xAAA585AA,0xAAAAA55A,0x11BAAA5A
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAEE,0xAAAAEEEE,0xAAEEEAAA,0xAEEAAAAA,0xAEAAAB11
-	.word 0xEEEEEEEE,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x0AAAAAAA,0x0AAAAAAA
-
-	.word 0xAAAAAAA0,0xAAEEEEA0,0xAEAAAAE0,0xAAABBAA0,0xAABDDBA0,0xAABDDBAA,0xAAABBAAA,0xAAAAAAAA
-	.word 0x1111AAAE,0xDD11BAAE,0xDDD11AAA,0xDDD11AAA,0xDDD11AAA,0xDD11BAAA,0x1111AAAA,0x11BAAAAA
-	.word 0xEAAA1111,0xEAAB11DD,0xAAA11DDD,0xAAA11DDD,0xAAA11DDD,0xAAAB11DD,0xAAAA1111,0xAAAAAB11
-	.word 0x0AAAAAAA,0x0AEEEEAA,0x0EAAAAEA,0x0AAAAAAA,0x0ABDDBAA,0xAABDDBAA,0xAAABBAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAA0000,0x0AAAA000,0x00AAAA00,0x000AAAA0,0x0000AAA0,0x00000AAA,0x000000AA
-	.word 0xAAAAAAAA,0xAAAAA000,0xAA000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAAAAAAA,0xA00AAAAA,0x000000AA,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAAAAAAA,0x00000AAA,0x0000AAAA,0x000AAAA0,0x00AAAA00,0x00AAA000,0x0AAA0000,0x0AA00000
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x54455555,0x55555555,0x54445555,0x54545555,0x54445555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55544444,0x55555555,0x55544444,0x55555555
-	.word 0x55555555,0xA5555555,0xE5555555,0xE5555555,0xE5555555,0xE5555555,0xE5555555,0xE5555555
-	.word 0x55555555,0xAAAAAAAA,0xEEEEEEEE,0xEEEEEEEE,0x5555555E,0x5555555E,0x5555555E,0x5555555E
-	.word 0x55555555,0xAAAAAAAA,0xEEEEEEEE,0xEEEEEEEE,0xEEE55555,0xEEE55555,0xEEE55555,0xEEE55555
-
-	.word 0x55555555,0xAAAAAAAA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEBE
-	.word 0xE5555555,0xEAAAAAAA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x5555555E,0x5555555E,0x5555555E,0x5555555E,0xAAAAAAAE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEE5B555,0xEEE55555,0xEEE55555,0xEEE55555,0xEEEAAAAA,0xEEEEEEEE,0xEEEEEEEE,0xEBEEEEEE
-	.word 0x555555AA,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0xAA555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555
-
-	.word 0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555
-	.word 0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x555555B5,0xBBBBBF55,0xCCCCBFF5,0xBCBCB555,0xBBCCB555,0xBBCBB555,0xBBCCB555
-	.word 0x55555555,0x55555555,0xBBBBBBBB,0xCCCCBBCC,0xCBBCCCCB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x55555555,0x55555555,0xBBBBBBBB,0xBBCCCCBB,0xCCCBBCCC,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x55555555,0xFF555555,0x55BBBBBB,0x55BCCCCC,0x55BCBCBC,0x55BCCBBB,0x55BCCBBB,0x55BBCBBB
-	.word 0xBBBCB555,0xBBCCB555,0xBBCBB555,0xBBCCB555,0xBBBCB555,0xBBCCB555,0xBBCBB555,0xDBCCB555
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBD
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x55BCCBBB,0x55BCBBBB,0x55BCCBBB,0x55BBCBBB,0x55BCCBBB,0x55BCBBBB,0x55BCCBBB,0x55BBCBBB
-
-	.word 0x4BBCB555,0x4BCCB555,0x4BBCB555,0x4CCCB555,0xBBBBBFF5,0x55555555,0x55555555,0x55555555
-	.word 0x66666BD4,0x6B6B6B44,0xCCBBCC4D,0xBCCCCB44,0xBBBBBBBB,0x55555555,0x55555555,0x55555555
-	.word 0xBBBABBBB,0xB6BBBBBB,0xC66CBBCC,0xCBBCFCCB,0xBBBBDBBB,0x55555555,0x55555555,0x55555555
-	.word 0x55BCCBBB,0x55BCCDDB,0x55BCBDDB,0xF5BCCDDC,0x5FBBBBBB,0x55555555,0x55555555,0x55555555
+	.word 0x00378010,0xF000003F,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0x1001F001,0x55550001,0x88855555,0x856F8888
+	.word 0x03200710,0x30074053,0x00011003,0x1088791E,0xE00E4025,0x881F1001,0xEF17F058,0x1D101F80
+	.word 0x40350330,0x60034007,0xFF0D006B,0x7F8003A0,0x01F001F0,0x016001F0,0x61D06B40,0x207FC0FF
+	.word 0x20FB8003,0x3001F0F3,0xF01D1001,0x0150FC1F,0x1F80ED10,0x0300FBF0,0x99993151,0x00699935
+	.word 0x96012003,0x00660300,0x66662A04,0x00960310,0x07206603,0x1010FF69,0x22100440,0x37603340
+	.word 0x3FF03FF0,0x40FF3FF0,0x2020103F,0x101B6031,0x2001E003,0xFF5F605B,0x3FF05380,0x3FF03FF0
+	.word 0xB3F03F60,0x53600840,0x50B3F0FF,0xF0141001,0x103F903F,0x903FF022,0xC821CF8F,0xAAAA0100
+
+	.word 0x011001F0,0x01A01FF0,0x1FF00A6D,0xF0000170,0xA001E03F,0x0A2B0360,0x009DF3AA,0x500A4210
+	.word 0xF11DF003,0x03302130,0x3F4001F0,0xF0A0AA00,0x01F0FF3A,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x63800170,0xCCCCCC34,0xEEEEEE55,0x333E550D,0x7007A033,0x0E00CC1E,0x3333EE07,0x0790E333
+	.word 0x36001FD0,0x0790337F,0x36005ED0,0x6FE007A0,0x6FD007C0,0xD007D0FF,0xD007D06F,0xF07FF06F
+	.word 0xF0F79077,0xF7B0FC77,0xF7B077F0,0x774077F0,0xBBBB0140,0xF001F0C1,0xBBDDBB01,0x0300DBBB
+	.word 0x00DDDD21,0xDDBBDD06,0x000300ED,0xDEEBDDDE,0xDDDDEEDD,0xEE01C081,0xEEEDDDDE,0x220340EE
+	.word 0x3C40EEDE,0x20BDDDBB,0xEE70BB3D,0x22000800,0xBBDE0B00,0xEE01EDDE,0xEDEEEBBD,0x9000EBEE
+	.word 0xDE038084,0x10DEEEEB,0xC7BBED03,0x43100F00,0x00DDEDDE,0x002D0009,0x7600FA38,0x6B407D00
+
+	.word 0x1E000800,0xBD8400BD,0xBD1B008F,0x0300EDDD,0x03800B00,0xEE047000,0xEDDBBBEE,0xEDDD8700
+	.word 0xDEC300B3,0x01608E40,0xAB30DEED,0xED5FC810,0x00ED0400,0x6001105F,0x00EE10F8,0x1110F3B3
+	.word 0x1BF1C320,0xBFBB01F0,0x016012F0,0x0340FF73,0xFFF50130,0xBFF54999,0x946FBF75,0x03001A00
+	.word 0xF5031069,0xF50BF563,0xFFF5FDFF,0x01F0BFF5,0xFFF5BFF5,0x40493FC0,0x3FF0D703,0x00440400
+	.word 0xFFF54932,0xB3F0FFF5,0x49FFC583,0x49966649,0xFFF53FF0,0x00FFF5FF,0xF091F403,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0x29013001,0x01302222,0x77030027,0xFF031077,0x1F5001B0,0x1DD00130,0x0E101FB0
+	.word 0x1E701FF0,0x303EF0D1,0x03407001,0x10110000,0x40015A03,0x03101103,0x60071600,0x00BC0003
+
+	.word 0x16000016,0x09100100,0x71100310,0x1077771C,0x03302500,0x10110F00,0x0700016C,0x20110300
+	.word 0x073B3003,0x5800EB00,0x013001F0,0x10037010,0x60300310,0x500140FF,0xF0039067,0xF001F001
+	.word 0x9101F001,0x3F31C27F,0x77446161,0x03104777,0x7FF1E774,0x7FF15FF1,0x42007447,0xBFB10310
+	.word 0xB13EF0D0,0x2601107F,0x00440011,0x1040002B,0x9E007403,0x20840070,0x5100A549,0x10430117
+	.word 0x07930107,0x07710501,0x03101C00,0x47773830,0x36032001,0x03107700,0x10443B30,0x075E1003
+	.word 0x013A0080,0x01100044,0x10371044,0xD15E0101,0x03807042,0x7F207BA0,0x04141087,0x00470000
+	.word 0x50735003,0x1B10DF03,0x40470100,0x0001F003,0x20360001,0x2B40F727,0x01F001F0,0x40CC0120
+	.word 0xF001F003,0x01F0F701,0x01F001F0,0x000C6780,0x09040003,0x190C7F23,0x00016047,0x4031F011
+
+	.word 0x10040033,0x1DF0FE33,0x01F001F0,0x01F04EE0,0x93401C50,0x8E10DFC0,0x00000400,0x1033D004
+	.word 0x10937085,0x3330FFB5,0x52F00C20,0xBEF03370,0x01F001F0,0xF0FF01F0,0xF001F001,0xF0E2F101
+	.word 0xF001F001,0xFF01F001,0x2F515720,0x33010B10,0x43110B00,0x7FF001B0,0xC00180BF,0x0B406B41
+	.word 0x8B415340,0x0B804050,0x027301FF,0xC04B1243,0x7001F0E4,0xFD1FFD01,0x1FF0FE7F,0x1AF07FFD
+	.word 0x01F07FFD,0x01807FFD,0xEC10EEAA,0x601D7B3D,0x200210A0,0xCC7B502B,0x100ACC3F,0x006E8062
+	.word 0x9D380034,0xFF7FFD6D,0x90B1A8C1,0xD36243A1,0x01F036F0,0x01F001F0,0xF101F0FF,0xF07FF17F
+	.word 0xF07FF11F,0xF07FF11F,0x7F71FE01,0x23F15A01,0x4B900110,0x0310E74E,0x21A0FCA0,0x0910252F
+	.word 0x2B1F8F21,0xA0005720,0xF1BF21FF,0xF244407F,0xF001F0FF,0x5301D001,0x01F0F263,0x01701D30
+
+	.word 0xCC00C3F4,0xB685831D,0x10851F01,0x53033007,0x01200B80,0x10885288,0x2B00580C,0x03406658
+	.word 0x0340B469,0xFBFF9E99,0x1F50664B,0xCC02CC53,0x9999555C,0x990300C9,0x6003A0DF,0x03C0586B
+	.word 0x63107F60,0x034003F0,0xFCFFFBF5,0x0067203F,0x18005524,0x572D0055,0x55320055,0x0055FA0B
+	.word 0x307F7032,0x60357D03,0x3013010B,0x00F3F0BA,0x1D5099A0,0x30F3F0F8,0x00175108,0x99F3E097
+	.word 0x21F75999,0xC1235013,0x5303007F,0x6D207FC1,0xF0FA7140,0xF0E02201,0x011F9016,0x03305551
+	.word 0x0740F835,0x7B510340,0x2C202410,0x3ECCCCC5,0xAC809C55,0xE72183B0,0x1FF07F9D,0xA1CC66CC
+	.word 0x8567207C,0x125E5058,0x66386607,0xF17F61C6,0x6533029C,0x357F9666,0x3FFD3F71,0x7FF19780
+	.word 0x7FF17FF1,0x20FE7FB1,0xD0F7506B,0x3023408B,0x508BF0D7,0x01AFCCFD,0x4C019644,0xD103C066
+
+	.word 0xA174007F,0x8C22FF7F,0x0C21B000,0x03405B00,0xBFFEAC60,0x00FFFFCE,0x7003F063,0xD36B7003
+	.word 0xF1174061,0xFF7FF17F,0x7F717FF1,0x7700F3F0,0x22405032,0x53006B60,0x410B60FF,0xF17FF113
+	.word 0xE17FF17F,0xF47FF47F,0x7FF4FF7F,0x7FD13E20,0x8354B041,0xEB927FD1,0xC4FF1F21,0xC41FE07F
+	.word 0x001F407F,0xD3833105,0xFF7FF4EF,0x624001F0,0x1C501FF0,0xEFC38390,0x2A867FD1,0x500B10F1
+	.word 0x68E75603,0x05555593,0x36FF0360,0xF6D306E7,0xF001F0D7,0x9001D001,0xDC03206B,0x9F679600
+	.word 0x506300D0,0xCC6F1003,0x0370FFAC,0x01F08320,0x01F001F0,0x49687C70,0x17FF3E39,0x601600C6
+	.word 0xF014F058,0xF001F001,0xFB01F001,0x01F001F0,0x01F001F0,0x01500140,0xFF0350CB,0x0300D038
+	.word 0xDCF1B170,0x01F0DC81,0x01F001F0,0xA001308C,0x03800D0A,0xCCCA0F00,0x290370FF,0x81E0F134
+
+	.word 0xF050F0E0,0x9001F001,0x4310FF01,0x97E91B0B,0x68501D50,0x2C301011,0xF0FF24E0,0xF001F001
+	.word 0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF
+	.word 0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0
+
+	.word 0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+
+	.word 0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xCC5501A0,0x40CC0310
+	.word 0x01401C01,0xFB0170AC,0x1FF02320,0x1FF01FF0,0x60C01F40,0xBF19001E,0xA0AC0330,0xF001F003
+	.word 0xF001F001,0xF201F001,0x6FD00130,0x2DB07FF0,0x031011CC,0x11111F11,0xF0030000,0x1001301F
+	.word 0xF801101F,0x1FE01FF0,0x08316FB0,0x00011D40,0xEEEE05EE,0xF0AAAAEE,0x0340A001,0x0001C0C0
+	.word 0xAAEE552B,0x00AAA585,0xAAAAA55A,0x11BAAA5A,0xAA1CC0A8,0x20EA4D20,0xAB11AE04,0xF0AEAA37
+	.word 0x0A01605F,0x67200310,0xE0002200,0xA0AEAAAA,0x07AAABBA,0xAABDDBA0,0x000310AA,0x0024100B
+	.word 0x1111AAAE,0xDD11BAAE,0xD11AAA1F,0x0F100370,0x24001700,0xAA00C300,0xAB11DDEA,0x3E1DDDEA
+
+	.word 0x0360AAA1,0x1D107800,0x67300600,0x0AEE02EE,0x0EAAAAEA,0x72DB0B20,0x600310BD,0x0001105F
+	.word 0xA0030000,0x500AAA2B,0x1110A006,0x0203000A,0x1F20FF5B,0x0A10A400,0x1F30BDF2,0x1AF0C620
+	.word 0x10FC1F70,0x1020004B,0x1008405B,0xA00C0019,0x55553F0A,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x3054452B,0x07004407,0x10030054,0x01B0BA07,0x50124044,0xA5014007,0xDDE50300,0x032003F0
+	.word 0x11FB2155,0x5E0100E8,0x90FD0F00,0x001FD003,0xB003C032,0xBE01901F,0x553D2F20,0xF05122E5
+	.word 0x006FF01E,0x4BC0AE03,0xB0B55532,0xEB4AC06F,0xCC3300AA,0x6003F0FF,0xF001F003,0xA001F001
+	.word 0x8062F001,0x14F0FF03,0x01F07FF0,0x01F001F0,0x56F00160,0xF0FE7FF0,0xF001F073,0xF001F001
+	.word 0xE05EF001,0x1082B562,0xBBBBBF04,0x8E00BFF5,0xBCBC00B5,0xBBCCB555,0xCB70B555,0x07000300
+
+	.word 0xBBBB2340,0xCC00BBBB,0xCBCCCCBB,0xF5CBBCCC,0x01500B10,0x1E001F90,0xCC1E00BB,0x55201FF0
+	.word 0xCC0A10FF,0xBC55BCCC,0xBB5E0099,0x000350CB,0x30BCB51E,0x6F50DB67,0x90DB0FB0,0xBD01D04B
+	.word 0x01F012F0,0xBB6710BB,0x0FD06F70,0x004B6F00,0x98030067,0xF54C0720,0x1B910701,0x02666BD4
+	.word 0x6B6B4466,0xDA004D6B,0xFC00E844,0xF730F390,0xB61210BA,0x6C0FBBCC,0x01FCCBC6,0xA0B1001B
+	.word 0x2067001F,0x0300CDDB,0xDC55BCBD,0xF5BC28CD,0x905F2B00,0x0000001F
 
 	.section .rodata
 	.align	2
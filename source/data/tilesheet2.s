@@ -6,8 +6,8 @@
 @	tilesheet2, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed, 14208 bytes raw
+@	Total size: 512 + 2616 = 3128
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,101 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet2Tiles		@ 14208 unsigned chars
+	.global tilesheet2Tiles		@ 2616 unsigned chars
 	.hidden tilesheet2Tiles
 tilesheet2Tiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAA77777,0xAAAAAAAA,0xAAAAA4AA,0xAAAAAAAA,0x77AAAAAA,0x887AAAAA,0x888AAAAA,0x888AAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x77777777,0xCCCCC888,0xCCCCCC88,0x88CCCCC8
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x77777777,0x8888888C,0x88888888,0x88888888
-	.word 0x77777AAA,0xAAAAAAAA,0xA4AAAAAA,0xAAAAAAAA,0xAAAAAA77,0xAAAAA788,0xAAAAAC88,0xAAAAACC8
-
-	.word 0x888AAAAA,0xC88AAAAA,0xCC8AAAAA,0xCCCAAAAA,0xCCCAAAAA,0x8CCAAAAA,0x888AAAAA,0x888AAAAA
-	.word 0x8888CCCC,0x88888CCC,0x888888CC,0x888888CC,0x88888888,0x88888888,0x88888888,0xC8888888
-	.word 0x88888888,0xC8888888,0xCC888888,0xCCC88888,0xCCCCC888,0x8CCCCC88,0x888CCCCC,0x88888CCC
-	.word 0xAAAAACCC,0xAAAAACCC,0xAAAAA8CC,0xAAAAA8CC,0xAAAAA888,0xAAAAA888,0xAAAAA888,0xAAAAA888
-	.word 0x888AAAAA,0x88AAAAAA,0xAAAAAAAA,0xAAA7777A,0xAA77AAAA,0xAA7AAAAA,0xAA7AAA4A,0xAAAAAAAA
-	.word 0xCCC88888,0xCCCC8888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x888888CC,0x8888888C,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAA888,0xAAAAAA88,0xAAAAAAAA,0xA7777AAA,0xAAAA77AA,0xAAAAA7AA,0xA4AAA7AA,0xAAAAAAAA
-
-	.word 0xCCCCC888,0x8CCCCC88,0x888CCCCC,0x88888CCC,0x888888CC,0x8888888C,0x8888888C,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0xC8888888,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88
-	.word 0xCCCCC888,0x8CCCCC88,0x888CCCCC,0x88888CCC,0x888888CC,0x8888888C,0x8888888C,0x88888888
-	.word 0x8888888C,0x88888888,0x88888888,0xC8888888,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88
-	.word 0x88888888,0x88888888,0xC8888888,0xCC888888,0xCCC88888,0xCCCCC888,0x8CCCCC88,0x888CCCCC
-	.word 0x88CCCCC8,0x8888CCCC,0x88888CCC,0x888888CC,0x888888CC,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0xC8888888,0xCC888888,0xCCC88888,0xCCCCC888,0x8CCCCC88,0x888CCCCC
-	.word 0x88CCCCC8,0x8888CCCC,0x88888CCC,0x888888CC,0x888888CC,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888CCC,0x888888CC,0x8888888C,0x8888888C,0x88888888,0x88888888,0xC8888888,0xCC888888
-	.word 0xC8888888,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88,0x88CCCCC8,0x8888CCCC,0x888888CC
-	.word 0x88888CCC,0x888888CC,0x8888888C,0x8888888C,0x88888888,0x88888888,0x88888888,0xCC888888
-	.word 0xC8888888,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88,0x88CCCCC8,0x8888CCCC,0x88888CCC
-	.word 0xAAAAAAAA,0x44444444,0x44444444,0x44444444,0x44444440,0x44444440,0x44444440,0x44444440
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4BB44444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0xBBBB4444
-	.word 0xAAAAAAA4,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4444444B
-
-	.word 0x44444440,0x44444440,0x440B0B00,0x0B0BBBBB,0xBBBB000B,0x00000000,0x00000000,0xB0000000
-	.word 0xBBB44444,0xBBB44444,0xBBB44444,0xBBBBBBBB,0xBB2BB2BB,0xBBBBBBBB,0xBBBBBBBB,0x00BBBBBB
-	.word 0xBBBBBBBB,0x222BBBBB,0xBBBBBBBB,0xBBBBBBBB,0xB0BBBBBB,0xB0000BBB,0xB0000BBB,0xB0000B0B
-	.word 0x0BB0BBBB,0x0BB0BBBB,0x0BBBBBBB,0xBB00BBBB,0x0000BBBB,0x00000BBB,0x000000BB,0x000000BB
-	.word 0xB0000000,0xB0000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00BBBBBB,0x00BBBBBB,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xB0000B0B,0xB0000B0B,0xB0000B0B,0xB000000B,0x0000000B,0x00000000,0x00000000,0x00000000
-	.word 0x000000BB,0x000000BB,0x000000BB,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0xAAA77777,0xAAAAAAAA,0xAAAAA4AA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x77777AAA,0xAAAAAAAA,0xA4AAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAA7AA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAA7777A,0xAA77AAAA,0xAA7AAAAA,0xAA7AAA4A,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xA7777AAA,0xAAAA77AA,0xAAAAA7AA,0xA4AAA7AA,0xAAAAAAAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x999E9999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99EE9999,0x99EE9999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x999E9999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99EE9999,0x99EE9999,0x99999999,0x99999999
-
-	.word 0xCCCCC888,0x8CCCCC88,0x888CCCCC,0x88888CCC,0x888888CC,0x8888888C,0x8228888C,0x82888888
-	.word 0x88888888,0x88888888,0x88888888,0xC8888888,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88
-	.word 0xCCCCC888,0x8CCCCC88,0x888CCCCC,0x88888CCC,0x888888CC,0x8888888C,0x8888888C,0x88888888
-	.word 0x8888888C,0x88888888,0x88888888,0xC8888888,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88
-	.word 0x88888888,0x88888888,0xC8888888,0xCC888888,0xCCC88888,0xCCCCC888,0x8CCCCC88,0x888CCCCC
-	.word 0x88CCCCC8,0x8888CCCC,0x88888CCC,0x888888CC,0x888888CC,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0xC8888888,0xCC888888,0xCCC88888,0xCCCCC888,0x8CCCCC88,0x888CCCCC
-	.word 0x88CCCCC8,0x8888CCCC,0x88888CCC,0x888888CC,0x888888CC,0x88888888,0x88888888,0x88882288
-
-	.word 0x88888CCC,0x888888CC,0x8888888C,0x8888888C,0x88888888,0x88888888,0xC8888888,0xCC888888
-	.word 0xC8288888,0xCC288888,0xCCCC8888,0xCCCCC888,0xCCCCCC88,0x88CCCCC8,0x8888CCCC,0x888888CC
-	.word 0x88888CCC,0x888888CC,0x2888888C,0x8888888C,0x88888888,0x88888888,0x88888888,0xCC888888
-	.word 0xC8888288,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88,0x88CCCCC8,0x8888CCCC,0x88888CCC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x22222222,0x22222222,0x22222221,0x22221111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x11112222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x22111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x11222222,0x11111122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111110,0x11111110,0x11660000,0x06660000
-	.word 0x11111111,0x11111111,0x11111111,0x01111111,0x01111111,0x01111111,0x00060011,0x00660000
-	.word 0x11111111,0x11111111,0x11111111,0x11111660,0x11116660,0x11116660,0x00006660,0x06606660
-	.word 0x11111111,0x11111111,0x11111111,0x01111111,0x00011111,0x00000011,0x00000000,0x00000000
-
-	.word 0x06660000,0x66660000,0x66660000,0x60000000,0x60000000,0x60000000,0x60600000,0x66600000
-	.word 0x00000000,0x00000006,0x00000006,0x00000006,0x00000006,0x00000006,0x00000006,0x00000006
-	.word 0x06006660,0x06666660,0x06666660,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x11111122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x22221111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x11112222,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111110,0x11111660,0x11000660,0x00060660,0x00066660,0x00000000,0x00000000,0x00000000
-	.word 0x11011111,0x11001111,0x60000111,0x60000000,0x60000000,0x00000000,0x00000000,0x00000000
-	.word 0x11111111,0x11111111,0x11111116,0x11100006,0x00006666,0x00006000,0x00000000,0x00000000
-	.word 0x11111111,0x01111111,0x01111111,0x00111111,0x00060000,0x00660000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0xD9999999,0xDD999999,0xDDD99999,0xDDDD9999
-	.word 0xD9999999,0xDDDD9999,0xDDDDDD99,0xDDDDDDD9,0xD33DDDDD,0xDD33DDDD,0xDDDD3DDD,0xDDDDDDDD
-	.word 0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD
-	.word 0x9999999D,0x9999DDDD,0x99DDDDDD,0x9DDD33DD,0xDDD333DD,0xDD3333DD,0xDD333DDD,0xDDDDDDDD
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x9999999D,0x999999DD,0x99999DDD,0x9999DDDD
-	.word 0xDDDD9999,0xDDDDD999,0xDDDDDD99,0xDDD3DD99,0x3DDDDDD9,0x3DDD3DD9,0x3DDD33D9,0x33DD33D3
-	.word 0xDDDDDD33,0xDDDDDDDD,0x3DDDDDDD,0x3DDDDD33,0xDDD33333,0xDDD33333,0x3D333333,0xDD333333
-	.word 0xDDD3333D,0xD3333333,0x33333333,0x33333333,0x33333333,0x33333333,0x3DD3333D,0xDD3DD33D
-
-	.word 0x33D3D33D,0x33D3333D,0x33333333,0x33333333,0x33333333,0x3DD33333,0xDDD33333,0xDD3D3333
-	.word 0x9999DD33,0x999DD333,0x99DDD333,0x99DDD333,0x9DDD3333,0x9DD33333,0x9DD3DDDD,0xDDD3DDDD
-	.word 0x33DD3333,0x33DD3333,0x33DD3333,0x3DDD3333,0x3DD33333,0x3DD33333,0x33333333,0x3DD33333
-	.word 0x33333333,0x33333333,0x33333333,0xD3333333,0xD3333333,0xDD333333,0xDD333333,0xDDDD3333
-	.word 0xDD3333DD,0xD33333DD,0xDD33333D,0xDDDDDD33,0xDDDDD333,0xD3333333,0xDD3333DD,0xDDDDDDDD
-	.word 0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD
-	.word 0xDDDDDD33,0xDDDDD333,0xDDDDDD33,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD
-	.word 0x33D33333,0x33333339,0x33333339,0x33333339,0x33333399,0x33333399,0x333DD999,0x33DD9999
-
-	.word 0xDDD33333,0xD33DD333,0xDDDDD333,0xDDDDD333,0xDD333333,0xD3333333,0x33333333,0x33333333
-	.word 0xD3333DDD,0xD333DDDD,0x333DDDD3,0x33333333,0x33333333,0x33D3333D,0x33DD3333,0xDDDDD33D
-	.word 0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDD33,0xDDDDDD33,0xDDDDDD33,0xDDDDDDDD
-	.word 0xDDDDDDDD,0x9DDDDDDD,0x9DDDDDDD,0x9DDDDDDD,0x99DDDDDD,0x99DDDDDD,0x999DDDDD,0x9999DDDD
-	.word 0xDDDD9999,0xDDD99999,0xDD999999,0xD9999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x33333333,0xD333333D,0xDDD333D3,0xDDDDDD3D,0xDDDDDDD9,0xDDDDDD99,0xDDDD9999,0xD9999999
-	.word 0xDDDD33DD,0x3D33333D,0xDD33333D,0xDDD333DD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD
-	.word 0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0x9DDDDDDD,0x99DDDDDD,0x9999DDDD,0x9999999D
-
-	.word 0x9999DDDD,0x99999DDD,0x999999DD,0x9999999D,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000044,0x44444444,0x44444444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444
-	.word 0x00000000,0x44444444,0x44444444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444
-	.word 0x00000000,0x44444444,0x44444444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444
-	.word 0x44400000,0x44444444,0x44444444,0x44446444,0x44446444,0x44446444,0x44446444,0x44446444
-	.word 0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444
-	.word 0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444
-	.word 0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444
-	.word 0x44446444,0x44446444,0x44446444,0x44446444,0x44446444,0x44446444,0x44446444,0x44446444
-
-	.word 0x64446444,0x64446444,0x64446444,0x64446444,0x44444444,0x44444466,0x66666666,0x66666600
-	.word 0x64446444,0x64446444,0x64446444,0x64446444,0x44444444,0x44444444,0x66666666,0x66666666
-	.word 0x64446444,0x64446444,0x64446444,0x64446444,0x44444444,0x44444444,0x66666666,0x66666666
-	.word 0x44446444,0x44446444,0x44446444,0x44446444,0x44444444,0x66644444,0x66666666,0x00066666
-	.word 0x55555555,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBB0,0xBBBBBBB0
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x55BBBBBB,0x5555BBBB,0xBBB585BB,0xBBBBB55B,0x666BBB5B
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBB55,0xBBBB5555,0xBB555BBB,0xB55BBBBB,0xB5BBB666
-	.word 0x55555555,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x0BBBBBBB,0x0BBBBBBB
-
-	.word 0xBBBBBBB0,0xBB5555B0,0xB5BBBB50,0xBBB66BB0,0xBB6336B0,0xBB6336BB,0xBBB66BBB,0xBBBBBBBB
-	.word 0x6666BBB5,0x33666BB5,0x33366BBB,0x33366BBB,0x33366BBB,0x33666BBB,0x6666BBBB,0x666BBBBB
-	.word 0x5BBB6666,0x5BB66633,0xBBB66333,0xBBB66333,0xBBB66333,0xBBB66633,0xBBBB6666,0xBBBBB666
-	.word 0x0BBBBBBB,0x0B5555BB,0x05BBBB5B,0x0BB66BBB,0x0B6336BB,0xBB6336BB,0xBBB66BBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBB0000,0x0BBBB000,0x00BBBB00,0x000BBBB0,0x0000BBB0,0x00000BBB,0x000000BB
-	.word 0xBBBBBBBB,0xBBBBB000,0xBB000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xBBBBBBBB,0xB00BBBBB,0x000000BB,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xBBBBBBBB,0x00000BBB,0x0000BBBB,0x000BBBB0,0x00BBBB00,0x00BBB000,0x0BBB0000,0x0BB00000
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xBCCCCCCC,0x5CCCCCCC,0x5CCCCCCC,0x5CCCCCCC,0x5CCCCCCC,0x5CCCCCCC,0x5CCCCCCC
-	.word 0xCCCCCCCC,0xBBBBBBBB,0x55555555,0x55555555,0xCCCCCCC5,0xCCCCCCC5,0xCCCCCCC5,0xCCCCCCC5
-	.word 0xCCCCCCCC,0xBBBBBBBB,0x55555555,0x55555555,0x555CCCCC,0x555CCCCC,0x555CCCCC,0x555CCCCC
-
-	.word 0xCCCCCCCC,0xBBBBBBBB,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x555555B5
-	.word 0x5CCCCCCC,0x5BBBBBBB,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0xCCCCCCC5,0xCCCCCCC5,0xCCCCCCC5,0xCCCCCCC5,0xBBBBBBB5,0x55555555,0x55555555,0x55555555
-	.word 0x555CBCCC,0x555CCCCC,0x555CCCCC,0x555CCCCC,0x555BBBBB,0x55555555,0x55555555,0x5B555555
-	.word 0xCCCCCCBB,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xBBCCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC
-
-	.word 0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC
-	.word 0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCBC,0x77777ECC,0xBBBB7EEC,0x7BAB7CCC,0x77BB7CCC,0x77B77CCC,0x77BB7CCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0x77777777,0xBBBB77BB,0xB77BBBB7,0x77777777,0x77777777,0x77777777
-	.word 0xCCCCCCCC,0xCCCCCCCC,0x77777777,0x77BBBB77,0xBBB77BBB,0x77777777,0x77777777,0x77777777
-	.word 0xCCCCCCCC,0xEECCCCCC,0xCC777777,0xCC7BBBBB,0xCC7BAB7B,0xCC7BB777,0xCC7BB777,0xCC77B777
-	.word 0x777B7CCC,0x77BB7CCC,0x77B77CCC,0x77BB7CCC,0x777B7CCC,0x77BB7CCC,0x77B77CCC,0x77BB7CCC
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0xCC7BB777,0xCC7B7777,0xCC7BB777,0xCC77B777,0xCC7BB777,0xCC7B7777,0xCC7BB777,0xCC77B777
-
-	.word 0x177B7CCC,0x77BB7CCC,0x7BAB7CCC,0xBBBB7CCC,0x77777EEC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x77DDDD71,0x77D77D79,0xBB77BBB9,0x7BBBB779,0x77777777,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x77777777,0x777779E7,0xBBEB7EEB,0xB7EBBBB7,0x77777777,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCC7BB799,0xCC7BB799,0xCC7BAB99,0xEC7BBB99,0xCE777777,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
+	.word 0x00378010,0xF000003F,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0x1001F001,0x77770501,0x10AAAAA7,0x0630A401
+	.word 0x77010080,0x887AAAAA,0x8A60AAAA,0x01B00340,0x77777777,0xCCC80188,0xCCCC88CC,0x820610CC
+	.word 0x77771FF0,0x6088888C,0x7A3AAA01,0x704F0077,0x880C1061,0x0D887200,0xC8AAAAAC,0x67400300
+	.word 0x0B0300C8,0xCAAAAACC,0x508C0350,0x3D62007F,0x5000CC88,0x03200600,0x80C801C0,0x1E009707
+	.word 0x9B40CCC8,0x3002008C,0xAE630037,0x30A80320,0x03C08803,0xC720E340,0x0B21C77A,0xAA7AA110
+	.word 0x1003004A,0xFF532013,0xE7D05000,0x93100150,0x19F0EF10,0x67200130,0x100C50F7,0x105E1060
+	.word 0x0F31A766,0x4F40AFE0,0xB04391FF,0x518F30EF,0xB03FF083,0xF047C03F,0x4BB1FF3F,0x0A3043E1
+
+	.word 0x01F083F1,0x3FF03FF0,0xF0FF3FF0,0xF04FD0B3,0xF05360B3,0xF001D03F,0xCB3F903F,0x83113000
+	.word 0x01704444,0xF003C040,0x01909901,0x13F04BB4,0xBBBB0190,0xF0F1E411,0x10013017,0x0067503C
+	.word 0x2D000B0B,0x0B0B0B02,0x83BBBB00,0x00A9B09E,0x0350BB63,0xB20110BB,0xE407302B,0x2D000130
+	.word 0x222B0110,0xBBB01380,0x20000B35,0xB04C0003,0x300B0E00,0x00BB6503,0x002E1003,0x001B0000
+	.word 0x40BF6410,0x0340B068,0x231001F0,0x01F03450,0x10FF0120,0x00036063,0xB0030047,0xF003803F
+	.word 0xFF7FF401,0x01F001F0,0x01F001F0,0x7FC40160,0x72400120,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x7FF4FE01,0x01F001F0,0x01F001F0,0x7FC46080,0xF0997F99,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0x30B701F0,0x12F09E01,0x40EE0160
+
+	.word 0xF001F003,0x01F0F33F,0xBFF53FD0,0x8228CB54,0x03100600,0xF5BFF5FF,0xF53FF0FF,0xF53FF0FF
+	.word 0xF5BFF5FF,0x01F0F1BF,0x3FF03FF0,0x88883FF0,0xADBFF522,0x00284FF0,0xBFF52807,0xF528FFF5
+	.word 0x1A00BFFF,0x90F3F082,0xF091F493,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xCA01F001,0x013001F0,0x01302222,0x11030021
+	.word 0x0310117F,0x1F5001B0,0x1DD00130,0x0E101FB0,0x701FF0F4,0xF03EF01E,0x03401001,0x66540000
+	.word 0xC0060310,0x0360011E,0x00920600,0x900066BD,0x0016601C,0x50826603,0x60000003,0x3FF06066
+	.word 0x00013511,0x01805800,0x66480066,0x10972D00,0x70600003,0x03106003,0x69201310,0x3003F0E1
+	.word 0x06210003,0x20666660,0x5DF1FF03,0x7FF101F0,0x3FF13FF1,0x1FF07EF1,0xE0F2BFF1,0x2140F03F
+
+	.word 0x0637216B,0x06030000,0xB0CF00FF,0x106E31C6,0x901B9106,0x0001301F,0x06110742,0x61111000
+	.word 0x511FB045,0x3541FFB7,0x01F05621,0x01F001F0,0x01F001F0,0xF0E501F0,0xF6014001,0x00D9991F
+	.word 0x0600DD03,0xDD0300B8,0x0F100300,0xDDDD0700,0x00D940DD,0x3DDDDD03,0x7BDDDDD3,0x20060033
+	.word 0xC001F00C,0x4C109D01,0x00834920,0x9DDD3342,0x3E1033DD,0x00FF3F10,0xC0141003,0x102F207C
+	.word 0x30080003,0xD105001D,0x40307800,0x3D8310D3,0x03003DD9,0x8800335C,0x50492033,0x3D511001
+	.word 0x5F00DD33,0x00330330,0x3024000B,0x0300D30B,0x0001A0C4,0xD33D3D17,0xD3D34800,0xC00B10D4
+	.word 0x4740D31D,0x99B2003D,0xD3331799,0xDD03009D,0xC3000330,0x9D1F1B00,0x0320DDDD,0x66108010
+	.word 0x37100350,0x500340FF,0x4058B047,0x00304003,0x300410B5,0x5511FF28,0x7C201E41,0x01F04CF1
+
+	.word 0x1AF03370,0x00BC1F30,0x5000396E,0xC0000350,0x3DD90330,0x5B01336F,0x01D36A30,0x3043104A
+	.word 0xDF2FA17B,0x19004021,0x71DA10D3,0x1226203B,0xFF8FF009,0x06920370,0xCA310380,0xDF61E001
+	.word 0xF6216B22,0xA07B12FF,0x006F3001,0x1286007F,0x20831272,0x9B42FF40,0x22008A22,0xC0203F11
+	.word 0x01D001F0,0x42FF8340,0x1249106B,0xF07B426B,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x0150FF01,0x01F091F4
+	.word 0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF
+	.word 0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0
+
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01
+
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xF001F001,0xF001F001,0xFE01F001,0x01F001F0,0x01F001F0,0x01F001F0,0xAF440130,0x40440310
+
+	.word 0x01F06401,0x1FF02320,0xF0DF1FF0,0x401F401F,0x0F001E60,0x33F003F0,0xF0FE01F0,0xF001F001
+	.word 0xF0015001,0x907FF073,0x6643442D,0x66660310,0x03000066,0x30FF1FF0,0x101F1001,0xE01FF001
+	.word 0x316FB01F,0x001D4008,0x55550006,0xBBBB5555,0xB001F0BC,0x01C00340,0x2F002B00,0xBB00B585
+	.word 0xBBBBB55B,0x786BBB5B,0x101CC066,0x2018001D,0xB666B504,0xF0B5BB37,0x0B01605F,0x67200310
+	.word 0x50002200,0xB0B5BBBB,0x07BBB66B,0xBB6336B0,0x000310BB,0x0024100B,0x6666BBB5,0x33666BB5
+	.word 0x366BBB1F,0x0F000380,0x24001700,0xBB00C300,0xB666335B,0x3E63335B,0x0360BBB6,0x1D107800
+	.word 0x67300600,0x0B550255,0x05BBBB5B,0xF20B5300,0x03105B00,0x01105F60,0x03000000,0x0BBB2BB0
+	.word 0x10B00650,0x03000B11,0x20FF5B02,0x10A4001F,0x30BDF20A,0xF0C6201F,0xFC1F701A,0x20004B10
+
+	.word 0x08405B10,0x0C001910,0xCC3F0BB0,0xF001F0CC,0xF001F001,0xF001F001,0x01F0F501,0x01F001F0
+	.word 0x00BC0100,0x03F05C03,0xCC0320BB,0xE811FB21,0x00C50100,0xFF03900F,0x32001FD0,0x1FB003C0
+	.word 0x3C120190,0x51226310,0xF01EF0F9,0x0203006F,0xCC4BA096,0x976FB0BC,0xBB5B4AC0,0xF0443300
+	.word 0xF0036003,0x01F0FF01,0x01A001F0,0x038062F0,0x7FF014F0,0xF0FF01F0,0x6001F001,0xF056F001
+	.word 0xF073F07F,0xF801F001,0x01F001F0,0x62E05EF0,0x7ECC5C12,0xEC770077,0xCCBBBB7E,0x7B00AB7C
+	.word 0x77BB7CCC,0xE0B77CCC,0x07000300,0x77772340,0x01BB7777,0xB7BBBB77,0x10B77BBB,0x0150EA0B
+	.word 0x1E001F90,0xBB1E0077,0x41CC1FF0,0xBB0A10EE,0x7BCC7BBB,0x77335E00,0x000350B7,0x307B7C1E
+	.word 0xFD6F5067,0x4B900FC0,0x01F001F0,0x671001E0,0xD96F7077,0x6F000FD0,0x206F3017,0x01ECBBF7
+
+	.word 0x1B918007,0x77DDDD71,0x2ED77D79,0xDA00B977,0x90FC0079,0xE7F750F3,0x77777902,0x01EB7EEB
+	.word 0x21DCEB1B,0x991F901B,0x03206700,0xBB995E00,0x00EC7B28,0x1F90CE1E
 
 	.section .rodata
 	.align	2
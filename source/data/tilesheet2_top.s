@@ -6,8 +6,8 @@
 @	tilesheet2_top, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed, 14208 bytes raw
+@	Total size: 512 + 2356 = 2868
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,92 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet2_topTiles		@ 14208 unsigned chars
+	.global tilesheet2_topTiles		@ 2356 unsigned chars
 	.hidden tilesheet2_topTiles
 tilesheet2_topTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x33330000,0x33333300,0x33333330,0x33333330,0x33333330,0x33333310,0x33333300
-	.word 0x00000000,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000333,0x00003333,0x00033333,0x30033333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00333333,0x03333333,0x03333333,0x03333333
-
-	.word 0x33333300,0x33333330,0x33333330,0x33333330,0x33333330,0x33333330,0x33333310,0x33333100
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x66633333,0x63633333,0x31333333,0x33333333
-	.word 0x03333333,0x03333333,0x03333333,0x03333333,0x03333333,0x03333333,0x03333333,0x03333333
-	.word 0x33333000,0x33111000,0x11000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333311,0x33333100,0x33331000,0x33310000,0x11100000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x31111111,0x10000000
-	.word 0x01333333,0x00333333,0x00333333,0x00333333,0x00133333,0x00013333,0x00001333,0x00000111
-
-	.word 0x33333331,0x33333330,0x33333310,0x33333100,0x33331000,0x33330000,0x33310000,0x33300000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33666333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x13333333,0x03333333,0x01133333,0x00033333,0x00033333,0x00033333,0x00013333,0x00003333
-	.word 0x33100000,0x33000000,0x33000000,0x33000000,0x31000000,0x10000000,0x00000000,0x00000000
-	.word 0x33636333,0x33666333,0x33313333,0x33313333,0x33313333,0x33333333,0x33333310,0x11111100
-	.word 0x33333333,0x33333333,0x33333333,0x13333333,0x03333333,0x03333333,0x00113333,0x00001111
-	.word 0x00001133,0x00000013,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30000000,0x33300000
-	.word 0x00000000,0x00000000,0x00000000,0x33330000,0x33333000,0x33333300,0x66633333,0x63633333
-	.word 0x00000000,0x33000000,0x33333000,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33300000,0x33300000,0x33300000,0x33300000,0x33300000,0x33100000,0x00000000,0x00000000
-	.word 0x66633333,0x31333333,0x31333333,0x31333333,0x33333333,0x33333333,0x33333100,0x33331000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33310000,0x11100000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333331,0x33333110,0x33333000,0x33331000,0x33330000,0x11110000
-
-	.word 0x33333331,0x33331110,0x31110000,0x10000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333331,0x33333110,0x33331000,0x33310000,0x33300000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33330000,0x33333000,0x33333300,0x33333100,0x33331000,0x33330000,0x11000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x00011113,0x00000001
-	.word 0x33366633,0x33363633,0x33366633,0x33331333,0x33331333,0x33333333,0x33333330,0x33333330
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333331,0x33333310,0x33311100,0x33100000,0x11000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x33333330,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000033
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33000000,0x33000000,0x33300000,0x33300000,0x33330000,0x33330000,0x33333000,0x33333330
-	.word 0x33333333,0x33333333,0x33333333,0x36663333,0x36363333,0x36663333,0x33133333,0x33133333
-	.word 0x00033333,0x00033333,0x00333333,0x00333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00033333,0x03333333,0x03333333
-
-	.word 0x33333330,0x33333330,0x33333310,0x33333100,0x33333000,0x33331000,0x33330000,0x33330000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33336663,0x33336363,0x33336663,0x33333133,0x33333133
-	.word 0x03333333,0x03333333,0x01133333,0x00033333,0x00013333,0x00001333,0x00000333,0x00000133
-	.word 0x33310000,0x33100000,0x31000000,0x33000000,0x33333300,0x33333300,0x33333300,0x33333100
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333133,0x33333333,0x33333333,0x33333333,0x33333333,0x13333333,0x03333333,0x33333333
-	.word 0x00000333,0x00003333,0x00003333,0x00001333,0x00000133,0x00000011,0x00000000,0x00003000
-
-	.word 0x33311000,0x33300000,0x33300000,0x33330000,0x33333000,0x33333300,0x33333300,0x33333330
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00333333,0x00333333,0x00333333,0x00333333,0x00333333,0x00333333,0x00133333,0x03333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x30000000,0x33000000,0x33333000,0x33333300,0x33333330,0x33333330,0x33333300,0x33333300
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x33333300,0x33333330,0x33333330,0x33333330
-	.word 0x00000000,0x33000000,0x33000000,0x33300000,0x33333333,0x33333333,0x33366633,0x33363633
-	.word 0x33333330,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x33300000,0x33330000,0x33333000,0x33333330
-	.word 0x33333330,0x33333330,0x33333300,0x33333330,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33366633,0x33331333,0x33331333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333331,0x33333310,0x33333300,0x33333100,0x33333000,0x33331000,0x33110000,0x33000000
-	.word 0x33333333,0x33333333,0x33333333,0x33666333,0x33636333,0x33666333,0x33313333,0x33313333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33000000,0x33000000,0x33000000,0x33000000,0x33000000,0x33300000,0x33330000,0x33333000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333000,0x33333000,0x33333000,0x33333300,0x33333300,0x33333330,0x33333330,0x33333330
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000333,0x00003333,0x00033333,0x00333333,0x03333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x33333333,0x36663333,0x36363333,0x36663333,0x33133333,0x33133333,0x33333333,0x33333333
-	.word 0x00033333,0x00333333,0x00333333,0x03333333,0x33333333,0x33333333,0x33333333,0x13333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000003,0x00000003,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x13333333,0x01133333,0x00011333,0x00000333,0x00000111
-	.word 0x01333333,0x00133333,0x00033333,0x00011111,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x66633333,0x63633333,0x66633333,0x31333333,0x31333333,0x31333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x11333333,0x00133333,0x00033333
-	.word 0x13333333,0x03333333,0x01333333,0x00133333,0x00013333,0x00001111,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x11333333
-	.word 0x00013333,0x00003333,0x00033333,0x00333333,0x00333333,0x00333333,0x00011011,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x33333333,0x11133333,0x00011333,0x00000133,0x00000033,0x00000033,0x00000013,0x00000001
-	.word 0x00111111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000033,0x00033333,0x03333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000033,0x30000033,0x30003333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x33330000,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x66333333
-	.word 0x00000000,0x33000000,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333336
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x36333333,0x66333333,0x13333333,0x13333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333336,0x33333336,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x11133333,0x00011111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33311133,0x31100011,0x10000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x13333333,0x01133333,0x00011111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33331111,0x33310000,0x31100000,0x10000000
-
-	.word 0x33333333,0x33333333,0x33333333,0x33666333,0x33636333,0x33666333,0x33313333,0x33313333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333666,0x33333636,0x33333666,0x33333313,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x11333333,0x00133333,0x00011333,0x00000333,0x00000111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333311,0x33333100,0x11111000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x11113333,0x00001333,0x00000333,0x00000111,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333331,0x33111110,0x33000000,0x31000000,0x10000000
-	.word 0x00000000,0x00000333,0x00033333,0x00033333,0x00333333,0x03333333,0x03333333,0x00333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000033,0x00000033,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00003333,0x00033333,0x00033333,0x00033333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66333333,0x36333333,0x66333333,0x13333333,0x13333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333336,0x33333336,0x33333336,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00033333,0x00003333,0x00333333,0x03333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000003,0x00003333,0x00033333,0x03333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x63333333,0x63333333,0x63333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333366,0x33333363,0x33333366
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x13333333,0x03333333,0x03333333,0x01333333,0x00133333,0x00033333,0x00013333,0x00003333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333331,0x33333331,0x33333331,0x33333331,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00001333,0x00003333,0x00003333,0x00003333,0x00003333,0x00003333,0x00000333,0x00003333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00033333,0x00033333,0x00033333,0x00033333,0x00033333,0x00033333,0x03333333,0x03333333
-	.word 0x00000000,0x00000003,0x00000333,0x00003333,0x30033333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x33000000,0x33300000,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000003,0x00000333,0x00033333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x33300000,0x33300000,0x33333000,0x33333330,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x63333333,0x63333333,0x63333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333366,0x33333363,0x33333366
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333331,0x33333331,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333666,0x33333636,0x33333666,0x33333313,0x33333313,0x33333313,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333666,0x33333636
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333666,0x33333313,0x33333313,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00440000,0x04400000,0x44000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000044
-	.word 0x00000000,0x00000000,0x00404000,0x00004440,0x00000020,0x00000000,0x00000000,0x00000040
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00004000,0x00004000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44000022,0x40040000,0x00000000,0x44000000,0x24000000,0x00000000,0x40000000,0x00000000
-	.word 0x00000040,0x00044004,0x00042044,0x00040442,0x00000420,0x00000044,0x00000024,0x44440000
-	.word 0x00040000,0x00024400,0x00002440,0x00000244,0x00000000,0x00000000,0x00000000,0x00000044
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00400000,0x04400000,0x44000000,0x42000000,0x20000000,0x00000000,0x00000000
-	.word 0x44440000,0x44740000,0x44440000,0x44420000,0x22200004,0x00000402,0x00000200,0x00000000
-	.word 0x00000044,0x00000047,0x00000044,0x00000024,0x00000002,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x55335553,0x55355553,0x55355553,0x66355533,0x65155133,0x61111333,0x11555553
-	.word 0x33333333,0x33355533,0x33355553,0x33355553,0x33335553,0x33331551,0x33333111,0x33355555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x53355533,0x53555533,0x53555533
-	.word 0x55555553,0x55155133,0x11155533,0x33113333,0x33333333,0x33555335,0x33555535,0x33555535
-	.word 0x33355555,0x33331551,0x33335551,0x33333311,0x33555333,0x35555333,0x35555333,0x35553333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35553355,0x35555355,0x35555355,0x33555366
-	.word 0x63555333,0x61551333,0x61113333,0x15555533,0x55555533,0x51551333,0x11555333,0x31133333
-	.word 0x33355536,0x33315515,0x33331111,0x33555551,0x33555555,0x33315515,0x33355511,0x33333113
-	.word 0x15513333,0x11133333,0x55555333,0x55555333,0x15513333,0x15553333,0x11333333,0x33333333
-	.word 0x33155165,0x33311161,0x35555511,0x35555555,0x33155155,0x33555111,0x33331133,0x33333333
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00378010,0xF000003F,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0x7001F001,0x33332501,0x30330200,0x00100380
+	.word 0x1310FB03,0x01F01D30,0x1F200150,0x00412003,0x10037D03,0xA03E1003,0x2069B01F,0x03500356
+	.word 0xA077D0DC,0x6FF0317F,0x01D001F0,0x00BF6663,0x08006303,0x6B603D50,0x7F0003F0,0x00166C00
+	.word 0xA7101110,0x7017F111,0x40AB11FB,0x9800008F,0x00080000,0x1BF13400,0x11017086,0x00311111
+	.word 0x01C6101E,0x40F340D2,0x03001303,0x06000001,0x01113F00,0xEFB04910,0x63505F30,0x01F04AA1
+	.word 0xF0EA10EB,0x1301D001,0x0013EB30,0xEF9F2187,0x83000340,0x10109D21,0x20039005,0xFFFF60B7
+	.word 0x67204A11,0x0350A910,0xE400AF40,0x5B516BF0,0x1E00117B,0x03003F00,0x0000EA00,0xFF01F0EA
+
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0EF,0x30017001,0x12B09F11,0x4F121301
+	.word 0x639C619F,0xF1185063,0xF00130CA,0xFF66E056,0x03B00722,0x7140B321,0x57209CF1,0x01F04B42
+	.word 0xF07FF0FF,0xF001F001,0x73015001,0x7301F00B,0x9810BF1F,0x23931010,0x03E3526F,0x02171024
+	.word 0x0B00FF45,0x3FD077A2,0x836343A0,0x01F054F1,0xF0FF01F0,0x9001F0FF,0xB3D35181,0xF02F349F
+	.word 0x60013051,0x12DC0313,0x366633F3,0x367F3333,0x07100300,0x03101D13,0xE7540100,0xF0FF6FF0
+	.word 0xF001F001,0x5001F001,0x103FC1BD,0xFF750173,0xB7F14342,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF001F0FF,0x2001F001,0xF0F95101,0xF0017019,0x01F0FF1C,0x5B832640,0x6000DF41,0xCCF15DF2
+	.word 0x65FF4F75,0xD05FF2E3,0x252F3070,0xB3EFD627,0xFF57F21F,0x017001F0,0x11A4F956,0xFF558F65
+
+	.word 0xB3277B36,0x629425FF,0x967F130B,0xF07FF7A8,0xA0718401,0x0756FE01,0x51517210,0x73007730
+	.word 0x41057462,0xD003FF00,0x6B537BA1,0x01F01741,0x01F001F0,0xA0FF01A0,0x170370D2,0xF09D1087
+	.word 0xF001F001,0xFF01F001,0xE58001F0,0xF763D760,0x2FF00350,0x019001F0,0x844380FF,0x60C3623F
+	.word 0xF1AA42F5,0xF01CC143,0xFFA2FFAE,0x4BF0AF90,0xD7846740,0x01F001F0,0x64FF0190,0xA2031093
+	.word 0xB09329FF,0xF0E0F22C,0xFF01F050,0x018001F0,0x03903B71,0x01F00371,0x01F001F0,0xF001F0FF
+	.word 0x107F4001,0x100350EF,0x9103000F,0x01F0FF77,0x01F001F0,0x01F001F0,0xF0107F40,0x6BFFBFAB
+	.word 0xF01F609F,0xF001F001,0xF001F001,0xFFE05101,0xA17057F5,0x97605BA5,0x5A1A0140,0xD01301A0
+	.word 0xF0D4F3FB,0x707FB001,0x1327254F,0x44002305,0x009F1BF7,0x14370513,0xAD08032B,0x01F0C5FA
+
+	.word 0xF001F0FF,0xF07FF001,0xF201D001,0xF00340FC,0xAE2CFB01,0x4C41B330,0xC7403711,0xF0972B01
+	.word 0x01F0F87F,0x67F001F0,0xA7C1475C,0xE7101100,0x01F02BF1,0x11137F50,0x6F117321,0x00FF1310
+	.word 0x0C335C03,0xF034F062,0xF001F001,0xFF01F001,0x8F876B40,0x27A001E0,0x15B46025,0x01F0C590
+	.word 0xA066333F,0x0201C0E6,0xF001F0EC,0xFE01F001,0x131246F0,0x1C4085F5,0x01F067F0,0xF71301F0
+	.word 0xDB117A01,0x3B0A01C0,0x00B40711,0xFFAB2BD3,0x3C3037F0,0x3FF04713,0x3F6F171F,0x01701F5F
+	.word 0xF0E2F2FF,0xF001F059,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0xD9D401A0,0x01A001F0
+	.word 0xB4FFB733,0x4C20D07F,0xC0183387,0x3547031D,0xFFAA54CF,0x6B3D1D90,0x03005737,0xFF25C371
+	.word 0x334AC7AA,0xF0FEF5FF,0xF001F001,0x6301F001,0xA033FB57,0x7FC3FF01,0x4FE05FFB,0x09F6CB90
+
+	.word 0x3B232FF0,0x40FF43F3,0xF33F5301,0x10015043,0xE4C76067,0xFF6FD043,0x2F859110,0x013073F4
+	.word 0x03600403,0xA81001E0,0x101810FF,0xE001F007,0x86FF5501,0xFC074C03,0x01E0FF61,0x8DF36896
+	.word 0x7DF001F0,0x0390FF8B,0xF0FF7368,0xF001F001,0xF001F001,0x72013001,0xFF03B00B,0x93611331
+	.word 0xDFF50379,0x91F98262,0x4763D7A1,0x4C1FD0FF,0xF053FEDF,0xF1013001,0xF10180FF,0x01F0FFFF
+	.word 0x01F001F0,0x01F001F0,0x01F0F7F1,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x011001F0,0xC7F599FA,0x01F001F0,0x3057F0FF,0xF001F057,0xF001F001,0x7001F001
+	.word 0xB3F0F467,0x11F50170,0x00440110,0xF8044003,0x01F00840,0x23102570,0x40400130,0x00405700
+	.word 0x1F802010,0xF032F040,0xDD241001,0x016028F0,0x50663022,0x248F1021,0x10A05E90,0xAA000404
+
+	.word 0x00042044,0x04041A42,0x80060000,0xA2304424,0x00021F44,0x00100040,0xF0BFD006,0xDD01F001
+	.word 0x0F51A450,0x80030042,0x746310E6,0x10930300,0x00444207,0x10022281,0xBF6B4029,0x80473010
+	.word 0xF082C0B8,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF
+	.word 0xF001F001,0xF001F001,0xF001F001,0x01F0F001,0x11F30140,0x555301F0,0x53105533,0x03203555
+	.word 0x66355533,0x15513308,0x611E0B65,0x555D5553,0x00338E19,0x50230013,0x1E003303,0x33262B9E
+	.word 0xF00F0055,0xE001F04D,0x353B5501,0x203C0053,0x55630003,0x77005000,0x6B00156B,0x00356E30
+	.word 0x16003564,0x10DF0310,0x516F1063,0x1D207700,0x8C508010,0xD0E89810,0x5013005A,0x2B3066CC
+	.word 0x2A133363,0x3D006155,0x154C0061,0xB2550300,0x00510F00,0x318B1A17,0x15420036,0xF30B556B
+
+	.word 0x20510D00,0x0F30556F,0x137F1700,0x7D101826,0xA800BF0D,0x0F200320,0x40AE4700,0x0E00658E
+	.word 0x00331C61,0x353B00A8,0x0F00555F,0xF4AC6011,0xF001F07F,0xFF01F001,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF
+	.word 0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+
+	.word 0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFE01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x000001B0
 
 	.section .rodata
 	.align	2
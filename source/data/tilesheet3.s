@@ -6,8 +6,8 @@
 @	tilesheet3, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed, 14208 bytes raw
+@	Total size: 512 + 2476 = 2988
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,96 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet3Tiles		@ 14208 unsigned chars
+	.global tilesheet3Tiles		@ 2476 unsigned chars
 	.hidden tilesheet3Tiles
 tilesheet3Tiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xBBBBBBBB,0xBBBBBBBB,0x333BB3BB,0xBB3BBBBB,0xBB3BBBBB,0xBBB333BB,0xBBBBB3BB,0xBBBBB3BB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0x33333333,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0x33333333,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBB3BB333,0xBBBBB3BB,0xBBBBB3BB,0xBB333BBB,0xBB3BBBBB,0xBB3BBBBB
-
-	.word 0xBBBBB3BB,0xBBBBB3BB,0xBBBBB3BB,0xBBBBB3BB,0xBBBBB3BB,0xBBBBB3BB,0xBBBBB3BB,0xBBBBB3BB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBB3BBBBB,0xBB3BBBBB,0xBB3BBBBB,0xBB3BBBBB,0xBB3BBBBB,0xBB3BBBBB,0xBB3BBBBB,0xBB3BBBBB
-	.word 0xBBBBB3BB,0xBBBBB3BB,0xBBB333BB,0xBB3BBBBB,0xBB3BBBBB,0x333BB3BB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x33333333,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x33333333,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBB3BBBBB,0xBB3BBBBB,0xBB333BBB,0xBBBBB3BB,0xBBBBB3BB,0xBB3BB333,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x72222222,0x22222222,0x22222222,0x22222227,0x22222777,0x22227777,0x22277777,0x22777777
-	.word 0x22277777,0x22777772,0x77777222,0x77722222,0x77222222,0x72222222,0x72222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222227,0x22222777,0x22227777,0x22277777,0x22777777
-	.word 0x22277777,0x22777772,0x77777222,0x77722222,0x77222222,0x72222222,0x72222222,0x22222222
-	.word 0x27777722,0x77772222,0x77722222,0x77222222,0x77222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222227,0x22222277,0x22222777,0x22277777,0x22777772,0x77777222
-	.word 0x27777722,0x77772222,0x77722222,0x77222222,0x77222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222227,0x22222277,0x22222777,0x22277777,0x22777772,0x77777222
-
-	.word 0x22222227,0x22222777,0x22227777,0x22277777,0x22777777,0x27777722,0x77772222,0x77722222
-	.word 0x77722222,0x77222222,0x72222222,0x72222222,0x22222222,0x22222222,0x22222222,0x22222277
-	.word 0x22222227,0x22222777,0x22227777,0x22277777,0x22777777,0x27777722,0x77772222,0x77222222
-	.word 0x77722222,0x77222222,0x72222222,0x72222222,0x22222222,0x22222222,0x22222227,0x22222277
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBCCCC,0xBBBBCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCC444CC,0x4444C4CC
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x44444444
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x44444444
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xCCCCBBBB,0xCCCCBBBB,0xCCCCCCCC,0xCCCCCCCC,0xCC444CCC,0xCC4C4444
-
-	.word 0xCCCCC4CC,0xCCCCC4CC,0xCCCCC4CC,0xCCCCC4CC,0x4CCCC4CC,0xC44CC4CC,0xCCC4C4CC,0x1CCC44CC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x4444CCCC,0xCCCC4444,0xCCCCCCCC,0x1111CCCC,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCC4444,0x4444CCCC,0xCCCCCCCC,0xCCCC1111,0x11111111
-	.word 0xCC4CCCCC,0xCC4CCCCC,0xCC4CCCCC,0xCC4CCCCC,0xCC4CCCC4,0xCC4CC44C,0xCC4C4CCC,0xCC44CCC0
-	.word 0x110CC4CC,0x1111CCCC,0x11111CCC,0x100111CC,0x000111CC,0x000000CC,0x00000000,0x00000000
-	.word 0x00111111,0x00111111,0x00001111,0x00001111,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x01111110,0x00101000,0x00101000,0x00100000
-	.word 0xCC4CC100,0xCCCC0111,0xCCC11111,0xCC111110,0xCC000000,0xCC000000,0x00000000,0x00000000
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBB3BB,0x44BBBBBB,0x22BBBBBB,0x224BBBBB,0x22244BBB,0x22777BBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x77222222,0x72222222,0x72222AA2,0x22222A22
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x22222777,0x22227777,0x22277777,0x22777777
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBB3BBBBB,0xBBBBBB44,0xBBBBBB22,0xBBBBB422,0xBBB44222,0xBBB22222
-	.word 0x27777BBB,0x77772BBB,0x77722BBB,0x77222BBB,0x77222BBB,0x22222BBB,0x22222BBB,0x22222BBB
-	.word 0x22222A22,0x22222222,0x22222227,0x22222277,0x22222777,0x22277777,0x22777772,0x77777222
-	.word 0xA7777722,0xA7772222,0xA7722222,0x772222A2,0x772222A2,0x22222222,0x22222222,0x22222222
-	.word 0xBBB2222A,0xBBB22222,0xBBB22227,0xBBB22277,0xBBB22777,0xBBB77777,0xBBB77772,0xBBB77222
-
-	.word 0x22222BBB,0x22222BBB,0x222BBBBB,0x22BBBBBB,0x22BBBBBB,0xBBBBB3BB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x777222A2,0x77222AA2,0x72222222,0x72222222,0x22222222,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x22222227,0x22222777,0x22227777,0x2227A777,0x22777777,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBB22222,0xBBB22222,0xBBBBB222,0xBBBBBB22,0xBBBBBB22,0xBB3BBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88868888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88668888,0x88668888,0x88888888,0x88888888
-
-	.word 0x72222222,0x22222222,0x22222222,0x22222227,0x22222777,0x22227777,0x22277777,0x22777777
-	.word 0x22277777,0xA2777772,0xA7777222,0xA7722222,0x77222222,0x72222222,0x72222222,0x2222222A
-	.word 0x22222222,0x22222222,0x22222222,0x22222227,0x22222777,0x22227777,0x22277777,0x22777777
-	.word 0x22277777,0x22777772,0x77777222,0x77A22222,0x77A22222,0x72222222,0x722222AA,0x2222222A
-	.word 0x27777722,0x77772222,0x77722222,0x77222222,0x77222222,0x22222222,0x22222222,0x22222222
-	.word 0x222222A2,0x222222A2,0x22222227,0x22222277,0x22222777,0x22277777,0x22777772,0x77777222
-	.word 0x27777722,0x77772222,0x77722222,0x77222222,0x77222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222227,0x22222277,0x22222777,0x22277777,0x22777772,0x77777222
-
-	.word 0x22222227,0xAA222777,0x2A227777,0x22277777,0x22777777,0x27777722,0x77772222,0x77722222
-	.word 0x77722222,0x77222222,0x72222222,0x72222222,0xA2222222,0xA2222222,0x22222222,0x22222277
-	.word 0x22222227,0x22222777,0x22227777,0x2227777A,0x2277777A,0x27777722,0x77772222,0x77222222
-	.word 0x77722222,0x77222222,0x7222222A,0x72222222,0x22222222,0x22222222,0x22222227,0x22222277
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0xAAAABBBB,0xAAAABBBB,0xAAAACCCC,0xAAAACCCC,0x9999CCCC,0x9999CCCC,0x99999C99,0x99999999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x9999AAAA,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAA999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBAAAA,0xBBBBAAAA,0xCCCCAAAA,0xCCCC99AA,0x99C99999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999990,0x99999990,0x9900D000,0x00D0D000,0x00DDD000,0x00000000,0x00000000
-	.word 0x09999999,0x09999999,0x09999999,0x000D0099,0x000D0000,0x000DD000,0x00000000,0x00000000
-	.word 0x99999000,0x9999D000,0x9999D000,0x00DDD000,0x00DDD000,0xDDDDD000,0xDDDDD000,0x00000000
-	.word 0x09999999,0x00099999,0x000D0099,0x000DD000,0x0000D00D,0x0000000D,0x0000000D,0x00000000
-	.word 0xAAAABBBB,0xAAAABBBB,0xAAAACCCC,0xAAAACCCC,0x9999CCCC,0x9999CCCC,0x99999C99,0x99999999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x9999AAAA,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAA999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBAAAA,0xBBBBAAAA,0xCCCCAAAA,0xCCCC99AA,0x99C99999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999990,0x99999990,0x9900D000,0x00D0D000,0x00DDD000,0x00000000,0x00000000
-	.word 0x09999999,0x09999999,0x09999999,0x000D0099,0x000D0000,0x000DD000,0x00000000,0x00000000
-	.word 0x99999000,0x9999D000,0x9999D000,0x00DDD000,0x00DDD000,0xDDDDD000,0xDDDDD000,0x00000000
-	.word 0x09999999,0x00099999,0x000D0099,0x000DD000,0x0000D00D,0x0000000D,0x0000000D,0x00000000
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x68888888,0x66888888
-	.word 0x88888888,0x88888888,0x68888888,0x66668888,0x66666688,0x66666668,0x66666666,0x66666666
-	.word 0x66888888,0x66666668,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666655,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x88888866,0x86666666,0x66666666,0x66666665,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x88888888,0x88888888,0x88888886,0x88886666,0x88666666,0x86666666,0x66666666,0x66666666
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888886,0x88888865
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x68888888,0x66888888
-	.word 0x66688888,0x66668888,0x66666888,0x66666688,0x66666668,0x66666666,0x56666666,0x55566666
-	.word 0x66666666,0x66666666,0x66666666,0x56666666,0x56666666,0x66665566,0x66666655,0x66666665
-	.word 0x66655566,0x66655555,0x66665555,0x66666655,0x66666666,0x66666666,0x66666666,0x56666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66655556,0x65555555
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x65555666,0x55555556,0x55555556,0x55555556,0x55555566,0x55555566,0x55556666
-
-	.word 0x88888666,0x88886666,0x88866666,0x88666666,0x86666665,0x66666665,0x66655665,0x66665665
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888886,0x88888866
-	.word 0x66888888,0x66688888,0x66668888,0x66668888,0x66666888,0x66666888,0x56666888,0x55666688
-	.word 0x55566666,0x65556666,0x66555666,0x66555666,0x56656666,0x55666655,0x55566665,0x55566666
-	.word 0x66666666,0x66666666,0x66666665,0x66655566,0x65555555,0x55555555,0x55555555,0x55555555
-	.word 0x55566666,0x55556666,0x55556666,0x55556666,0x55556666,0x55566665,0x55566555,0x55665555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66666665,0x55666655,0x56666655,0x56666655,0x66655555,0x55555555,0x55555555,0x55555555
-
-	.word 0x66666666,0x66666665,0x66655655,0x56665555,0x56655555,0x56655555,0x56555555,0x56555555
-	.word 0x66665666,0x66566666,0x65565666,0x66665555,0x66555555,0x65555555,0x65555555,0x65555555
-	.word 0x88888866,0x88888666,0x88886666,0x88886666,0x88866666,0x88866666,0x88866666,0x88666666
-	.word 0x65566688,0x65556568,0x65555568,0x66555568,0x66665558,0x66555558,0x66555555,0x65555555
-	.word 0x55556666,0x55555566,0x55555556,0x55555556,0x55555556,0x55555566,0x55555566,0x55555566
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55665555,0x56655555,0x66655555,0x66655555,0x66655555,0x66665555,0x66665555,0x66665555
-	.word 0x55555555,0x65555555,0x66666555,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555556,0x55555566,0x55555666
-	.word 0x55555555,0x66555555,0x66655555,0x66666555,0x66666555,0x66665555,0x66665555,0x66665655
-	.word 0x65555555,0x65555555,0x55555556,0x55555566,0x55566666,0x66666666,0x66666666,0x66666555
-	.word 0x88666666,0x86666666,0x86666655,0x86666655,0x86666655,0x86666556,0x66666655,0x66666555
-	.word 0x65555555,0x65555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555566,0x55555556,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55556555,0x55555555,0x55555555
-	.word 0x66665555,0x66665555,0x55666555,0x55555655,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x66656666,0x66655566,0x66666666,0x66666666,0x66666666,0x66666666,0x66655555,0x66555555
-	.word 0x56666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x55666666,0x56666666,0x56666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666555,0x66666555,0x66665555,0x66655555,0x66665556,0x66666666,0x66666666,0x66666666
-	.word 0x66666556,0x66666566,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x55555555,0x56555555,0x65555558,0x55555558,0x55555558,0x55555558,0x55555558,0x55555688
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x65555555,0x66555555,0x66555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555556,0x55555556,0x55555555,0x55555555,0x55555555,0x55555555,0x66665555
-	.word 0x66555555,0x66555555,0x66666655,0x66666665,0x66666665,0x66666665,0x66666666,0x66666655
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x86666666,0x86666666,0x86666666,0x86666666,0x86666666,0x88666666
-	.word 0x55556688,0x55556888,0x55566888,0x55666888,0x66668888,0x66668888,0x66688888,0x66888888
-	.word 0x65555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555556,0x55555566,0x55555666
-
-	.word 0x55555556,0x55555556,0x55555565,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66555555,0x66665555,0x66555555,0x55555555,0x55555555,0x55555565,0x55555665,0x66556655
-	.word 0x65665556,0x65555556,0x55555566,0x55555655,0x65555555,0x55555555,0x55555555,0x55555555
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666555,0x66666555
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x88666666,0x88866666,0x88866666,0x88866666,0x88886666,0x88886666,0x88888666,0x88888866
-	.word 0x66888888,0x68888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x55555666,0x55556666,0x55556666,0x55665568,0x66665688,0x66656888,0x66668888,0x66688888
-	.word 0x55555555,0x55555555,0x55555555,0x66555555,0x66666555,0x66666556,0x66666666,0x66666666
-	.word 0x66555555,0x65555555,0x66655555,0x66655556,0x66555566,0x55555566,0x55555556,0x55555556
-	.word 0x55555555,0x55556666,0x55556666,0x55556666,0x66655666,0x66655666,0x66556665,0x66556665
-	.word 0x66666555,0x66666665,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x86666666,0x88666666,0x88866666,0x88886666,0x88888666
-	.word 0x88888866,0x88888886,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x66888888,0x68888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x66666666,0x66666566,0x66666668,0x66666688,0x66668888,0x68888888,0x88888888,0x88888888
-	.word 0x55555566,0x55555666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666668,0x66888888
-	.word 0x66666665,0x66666666,0x66666666,0x66666656,0x66666555,0x66666666,0x66666656,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x86666666,0x88888866
-	.word 0x66666666,0x66666666,0x86666666,0x88666666,0x88886666,0x88888886,0x88888888,0x88888888
-	.word 0x88888866,0x88888886,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00378010,0xF000003F,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0x1001F001,0xBBBB2001,0x3BB30140,0x67BBBB33
+	.word 0x0008003B,0x00B33303,0x6013100F,0x33BB0F1D,0x1F003333,0x1FF001F0,0x20BF01F0,0x5700B31F
+	.word 0x6A105350,0x13506B50,0xA0FF03F0,0xF001F07F,0x1001F001,0xF0674001,0xFF7FB003,0x1360F310
+	.word 0x01F0A020,0xEBF0CB50,0x7FD01FF0,0x405210F0,0x400B216B,0x22222201,0x0300D472,0x00270120
+	.word 0x04007703,0x10AB7777,0x03002703,0x72072077,0x04401010,0x402210FF,0xF0376033,0xF03FF03F
+	.word 0x103F403F,0x3120FF20,0x03101B60,0x5B2001E0,0x53805F60,0xF0FF3FF0,0x603FF03F,0x40B3F03F
+	.word 0xF0536008,0xFE0150B3,0x3FF01410,0x22103F90,0x8F903FF0,0x60CC8751,0x400350CC,0xCCC44401
+
+	.word 0x443BC4CC,0x60DBD144,0x4422101F,0x1FF01FF0,0x6061B0CB,0x00444C01,0x63004C1F,0xB0800B00
+	.word 0xC4CC4C03,0xC4CCC44C,0x440C008E,0x4F901CCC,0x0B505130,0x10117F11,0x701DB001,0x30191005
+	.word 0x8063001F,0x5E109003,0x0B00C44C,0xC0CC4C4C,0xCC600089,0x29200CC4,0x03001CCC,0x10011113
+	.word 0xCC000300,0x42001F84,0x100340F9,0x303FF40B,0x10017085,0x14400011,0x20001010,0x03000003
+	.word 0x00CF4CC1,0xC1611052,0x101B00CC,0xC403505A,0x0520E07F,0x93012F11,0x4BBB224B,0xBB220F24
+	.word 0x9F61777B,0xFD001C20,0xA22FCB51,0x2ACB012A,0x1F50BF71,0x87930BD2,0xBB5C4089,0x0300B422
+	.word 0x7B03B442,0x00BBB220,0x2BBB2763,0xBB157777,0x0300722B,0x22035022,0x10EC0350,0xA2BFF263
+	.word 0x1100A7FF,0xA7720300,0x0800A276,0xA3920310,0x1063002A,0x00A82767,0x03107703,0x77030027
+
+	.word 0x7243BBB7,0x72220300,0x6B60BBB7,0x50DF0400,0xA2F7949E,0xEB006400,0xF390BFA2,0xA77FFFA2
+	.word 0x5F14F3D0,0xEA107F30,0x93346050,0x883F0130,0xF001F088,0xF001F001,0xF001F001,0x01F0FF01
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF0FB01F0,0xF001F001,0xD001F001,0x12F08601,0x667F0160
+	.word 0x01300340,0xBFF5FFF5,0x06126602,0x94FA6322,0xF59A42CB,0x453FF0FF,0x0340A2FF,0xAA723F22
+	.word 0xBFF53F50,0xCF02BFA2,0xFFF20320,0xF0FFF5FA,0xF5FFF53F,0xAA1320FF,0xF52A0E00,0xFFF5BFF5
+	.word 0xFFE59280,0x7A08007A,0x20FFFFF5,0xF5EB0007,0xF40300FF,0xF001F0D1,0xFF01F001,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0C201
+	.word 0xBBBB0130,0x0310AAAA,0x50CC49CC,0x10999903,0x009C9903,0x01009F03,0x0190AAAA,0x01901330
+
+	.word 0x21E01DC0,0x405D30EF,0xC9592061,0x01F044F0,0x01F001F0,0xF001F0F2,0xF001F001,0x40909901
+	.word 0xD0200003,0xD0030000,0xDDD00000,0x001F61D3,0x03600916,0x11000D00,0xD0730300,0x01400710
+	.word 0xD0003800,0x37000350,0xDD0330B6,0x3F600320,0x30580009,0x00FF0D37,0xF145405E,0xF17FF17F
+	.word 0xF101C07F,0xFF1FD07F,0x45F07FF1,0x01F001F0,0x01F001F0,0x01F001F0,0xF101F0FF,0x207FF17F
+	.word 0xF17FF103,0xF17FF17F,0x7F81FB7F,0x01F01FF6,0x012001F0,0x2048A668,0x6666270F,0x68660200
+	.word 0x01500300,0x90C62310,0x6601F00F,0x12F05566,0x2F6640B0,0x0A108666,0x601DF065,0x10F1167F
+	.word 0x1210FB0D,0x1F902F50,0x2F1001D0,0xF016F065,0x01F0DD01,0x2068FFC0,0xD0060075,0x020056FB
+	.word 0x00DAD0FC,0x00030013,0x20181015,0x3F6555CF,0x03205566,0x2F4007F1,0x181001F0,0x00F73320
+
+	.word 0xF01AF004,0x562C0001,0x03502C00,0x20F63810,0x01751003,0x86373108,0x50003B21,0x54108F86
+	.word 0x00655665,0xA13FF103,0xEF0A306F,0x07510371,0x00560330,0x1163000E,0xFCA70003,0x0E210610
+	.word 0x10B08A00,0x0B710120,0x00FF6555,0x40016003,0x1003A03F,0x10D1303B,0xFE01F02E,0x57100190
+	.word 0x70303840,0x5F806330,0xFD557B30,0x0D00EF00,0x2E715840,0xCA118131,0xFF970056,0x74204810
+	.word 0x0320A310,0x43619F22,0x03504751,0x56101080,0x55656865,0x00CB6865,0x6603002B,0x58430058
+	.word 0x7A008271,0xF10830FF,0xF0DDF09F,0x10C12001,0x82D74046,0x0360FF4B,0x29F20631,0x4FF00130
+	.word 0x08108380,0x00FF6460,0x30AD1057,0x010330B1,0x60075116,0xFFD38133,0x8F237340,0x03601400
+	.word 0x07106A01,0x4B614B40,0x4001F0FF,0xF0867053,0xD001F001,0x11AB404D,0x48F0FF16,0xD4401900
+
+	.word 0x272217E1,0x01F083F3,0x33FF2410,0xC11BF0D7,0xA3F53233,0xF06C239A,0x559FC137,0x65330256
+	.word 0x90550300,0xCFF08803,0x7101F0FF,0x5052F211,0xF003405C,0x64EF6201,0xAE90FFAF,0x01F0AFF4
+	.word 0x01F001F0,0x01F001F0,0x15F80100,0x0303D0D3,0x0307015F,0x56688858,0x6603009F,0x14897355
+	.word 0xF21D1093,0xFFDF925B,0x80F2FB50,0x07810471,0xF0424C61,0x7C53CF11,0xC24451FF,0x1001F07D
+	.word 0xF0175201,0xF001F001,0x01A0FF01,0x014173C4,0x9F659314,0x01F0AB26,0x00D51C10,0x689D52B3
+	.word 0x1588D000,0xD61468F3,0xE14331FF,0x22B3000B,0x65C750B3,0x62DB120F,0x53A2FFE8,0x3C10BFA5
+	.word 0x3B015B16,0x32100310,0xF0FF06F1,0xF001F001,0x22010001,0x41076113,0xFF0DFF03,0x01F001F0
+	.word 0x3FF12271,0x75101C80,0xF717C000,0xA0F045FF,0xD067522F,0x002F20A8,0x14FB901E,0x1352FF40
+
+	.word 0xEBF04CF4,0xFBC01B49,0xFFF0EFB0,0xF0FF01F0,0xFD017001,0xF001F031,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF
+
+	.word 0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0
+
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+
+	.word 0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF
+	.word 0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0C0,0x00000001
 
 	.section .rodata
 	.align	2
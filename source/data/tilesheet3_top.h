@@ -6,8 +6,8 @@
 //	tilesheet3_top, 1184x24@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 444 tiles Metatiled by 4x3 not compressed
-//	Total size: 512 + 14208 = 14720
+//	+ 444 tiles Metatiled by 4x3 lz77 compressed, 14208 bytes raw
+//	Total size: 512 + 2320 = 2832
 //
 //	Time-stamp: 2021-04-06, 09:05:26
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_TILESHEET3_TOP_H
 #define GRIT_TILESHEET3_TOP_H
 
-#define tilesheet3_topTilesLen 14208
-extern const unsigned int tilesheet3_topTiles[3552];
+#define tilesheet3_topTilesLen 2320
+extern const unsigned int tilesheet3_topTiles[580];
 
 #define tilesheet3_topPalLen 512
 extern const unsigned short tilesheet3_topPal[256];
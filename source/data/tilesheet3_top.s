@@ -6,8 +6,8 @@
 @	tilesheet3_top, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed, 14208 bytes raw
+@	Total size: 512 + 2320 = 2832
 @
 @	Time-stamp: 2021-04-06, 09:05:26
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,91 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet3_topTiles		@ 14208 unsigned chars
+	.global tilesheet3_topTiles		@ 2320 unsigned chars
 	.hidden tilesheet3_topTiles
 tilesheet3_topTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x66660000,0x66666600,0x66666660,0x66666660,0x66666660,0x66666640,0x66666600
-	.word 0x00000000,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000666,0x00006666,0x00066666,0x60066666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00666666,0x06666666,0x06666666,0x06666666
-
-	.word 0x66666600,0x66666660,0x66666660,0x66666660,0x66666660,0x66666660,0x66666640,0x66666400
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x56566666,0x55566666,0x64666666,0x66666666
-	.word 0x06666666,0x06666666,0x06666666,0x06666666,0x06666666,0x06666666,0x06666666,0x06666666
-	.word 0x66666000,0x66444000,0x44000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666644,0x66666400,0x66664000,0x66640000,0x44400000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x64444444,0x40000000
-	.word 0x04666666,0x00666666,0x00666666,0x00666666,0x00466666,0x00046666,0x00004666,0x00000444
-
-	.word 0x66666664,0x66666660,0x66666640,0x66666400,0x66664000,0x66660000,0x66640000,0x66600000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66565666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x46666666,0x06666666,0x04466666,0x00066666,0x00066666,0x00066666,0x00046666,0x00006666
-	.word 0x66400000,0x66000000,0x66000000,0x66000000,0x64000000,0x40000000,0x00000000,0x00000000
-	.word 0x66555666,0x66555666,0x66646666,0x66646666,0x66646666,0x66666666,0x66666640,0x44444400
-	.word 0x66666666,0x66666666,0x66666666,0x46666666,0x06666666,0x06666666,0x00446666,0x00004444
-	.word 0x00004466,0x00000046,0x00000004,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x60000000,0x66600000
-	.word 0x00000000,0x00000000,0x00000000,0x66660000,0x66666000,0x66666600,0x56566666,0x55566666
-	.word 0x00000000,0x66000000,0x66666000,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66600000,0x66600000,0x66600000,0x66600000,0x66600000,0x66400000,0x00000000,0x00000000
-	.word 0x55566666,0x64666666,0x64666666,0x64666666,0x66666666,0x66666666,0x66666400,0x66664000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66640000,0x44400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666664,0x66666440,0x66666000,0x66664000,0x66660000,0x44440000
-
-	.word 0x66666664,0x66664440,0x64440000,0x40000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666664,0x66666440,0x66664000,0x66640000,0x66600000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66660000,0x66666000,0x66666600,0x66666400,0x66664000,0x66660000,0x44000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x00044446,0x00000004
-	.word 0x66656566,0x66655566,0x66655566,0x66664666,0x66664666,0x66666666,0x66666660,0x66666660
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666664,0x66666640,0x66644400,0x66400000,0x44000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x66666660,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000066
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66000000,0x66000000,0x66600000,0x66600000,0x66660000,0x66660000,0x66666000,0x66666660
-	.word 0x66666666,0x66666666,0x66666666,0x65656666,0x65556666,0x65556666,0x66466666,0x66466666
-	.word 0x00066666,0x00066666,0x00666666,0x00666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00066666,0x06666666,0x06666666
-
-	.word 0x66666660,0x66666660,0x66666640,0x66666400,0x66666000,0x66664000,0x66660000,0x66660000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66665656,0x66665556,0x66665556,0x66666466,0x66666466
-	.word 0x06666666,0x06666666,0x04466666,0x00066666,0x00046666,0x00004666,0x00000666,0x00000466
-	.word 0x66640000,0x66400000,0x64000000,0x66000000,0x66666600,0x66666600,0x66666600,0x66666400
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666466,0x66666666,0x66666666,0x66666666,0x66666666,0x46666666,0x06666666,0x66666666
-	.word 0x00000666,0x00006666,0x00006666,0x00004666,0x00000466,0x00000044,0x00000000,0x00006000
-
-	.word 0x66644000,0x66600000,0x66600000,0x66660000,0x66666000,0x66666600,0x66666600,0x66666660
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00666666,0x00666666,0x00666666,0x00666666,0x00666666,0x00666666,0x00466666,0x06666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x60000000,0x66000000,0x66666000,0x66666600,0x66666660,0x66666660,0x66666600,0x66666600
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x66666600,0x66666660,0x66666660,0x66666660
-	.word 0x00000000,0x66000000,0x66000000,0x66600000,0x66666666,0x66666666,0x66656566,0x66655566
-	.word 0x66666660,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x66600000,0x66660000,0x66666000,0x66666660
-	.word 0x66666660,0x66666660,0x66666600,0x66666660,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66655566,0x66664666,0x66664666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666664,0x66666640,0x66666600,0x66666400,0x66666000,0x66664000,0x66440000,0x66000000
-	.word 0x66666666,0x66666666,0x66666666,0x66565666,0x66555666,0x66555666,0x66646666,0x66646666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66000000,0x66000000,0x66000000,0x66000000,0x66000000,0x66600000,0x66660000,0x66666000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666000,0x66666000,0x66666000,0x66666600,0x66666600,0x66666660,0x66666660,0x66666660
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000666,0x00006666,0x00066666,0x00666666,0x06666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x66666666,0x65656666,0x65556666,0x65556666,0x66466666,0x66466666,0x66666666,0x66666666
-	.word 0x00066666,0x00666666,0x00666666,0x06666666,0x66666666,0x66666666,0x66666666,0x46666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000006,0x00000006,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x46666666,0x04466666,0x00044666,0x00000666,0x00000444
-	.word 0x04666666,0x00466666,0x00066666,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x56566666,0x55566666,0x55566666,0x64666666,0x64666666,0x64666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x44666666,0x00466666,0x00066666
-	.word 0x46666666,0x06666666,0x04666666,0x00466666,0x00046666,0x00004444,0x00000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x44666666
-	.word 0x00046666,0x00006666,0x00066666,0x00666666,0x00666666,0x00666666,0x00044044,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x66666666,0x44466666,0x00044666,0x00000466,0x00000066,0x00000066,0x00000046,0x00000004
-	.word 0x00444444,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000066,0x00066666,0x06666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000066,0x60000066,0x60006666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x66660000,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x65666666
-	.word 0x00000000,0x66000000,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666665
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x55666666,0x55666666,0x46666666,0x46666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666665,0x66666665,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x44466666,0x00044444
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66644466,0x64400044,0x40000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x46666666,0x04466666,0x00044444
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66664444,0x66640000,0x64400000,0x40000000
-
-	.word 0x66666666,0x66666666,0x66666666,0x66565666,0x66555666,0x66555666,0x66646666,0x66646666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666565,0x66666555,0x66666555,0x66666646,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x44666666,0x00466666,0x00044666,0x00000666,0x00000444
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666644,0x66666400,0x44444000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x44446666,0x00004666,0x00000666,0x00000444,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666664,0x66444440,0x66000000,0x64000000,0x40000000
-	.word 0x00000000,0x00000666,0x00066666,0x00066666,0x00666666,0x06666666,0x06666666,0x00666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000066,0x00000066,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00006666,0x00066666,0x00066666,0x00066666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x65666666,0x55666666,0x55666666,0x46666666,0x46666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666665,0x66666665,0x66666665,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00066666,0x00006666,0x00666666,0x06666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000006,0x00006666,0x00066666,0x06666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x56666666,0x56666666,0x56666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666656,0x66666655,0x66666655
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x46666666,0x06666666,0x06666666,0x04666666,0x00466666,0x00066666,0x00046666,0x00006666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666664,0x66666664,0x66666664,0x66666664,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00004666,0x00006666,0x00006666,0x00006666,0x00006666,0x00006666,0x00000666,0x00006666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00066666,0x00066666,0x00066666,0x00066666,0x00066666,0x00066666,0x06666666,0x06666666
-	.word 0x00000000,0x00000006,0x00000666,0x00006666,0x60066666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x66000000,0x66600000,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000006,0x00000666,0x00066666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x66600000,0x66600000,0x66666000,0x66666660,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x56666666,0x56666666,0x56666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666656,0x66666655,0x66666655
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666664,0x66666664,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666565,0x66666555,0x66666555,0x66666646,0x66666646,0x66666646,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666565,0x66666555
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666555,0x66666646,0x66666646,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00003333,0x00003333,0x00002222,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x33333000,0x33333000,0x22222000,0x33333333
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00880000,0x08800000,0x88000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00006600,0x00006000,0x00006000,0x08000088
-	.word 0x00000000,0x00000000,0x00808000,0x00008880,0x00000070,0x00000000,0x00666000,0x00606080
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000060,0x00000060
-	.word 0x00008000,0x00008000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x88000077,0x80080000,0x00000000,0x88000000,0x78000000,0x00000000,0x80000000,0x00000000
-	.word 0x00006080,0x00086008,0x00086088,0x00080887,0x00000870,0x00000088,0x00000078,0x88880000
-	.word 0x00080000,0x00078800,0x00007880,0x00000788,0x00000000,0x00000000,0x00000000,0x00000088
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x60800000,0x66800000,0x86600000,0x87600000,0x70000000,0x00000000,0x00000000
-	.word 0x88880000,0x88180006,0x88880006,0x88870000,0x77700008,0x00000807,0x00000700,0x00000000
-	.word 0x00000088,0x00000081,0x00000088,0x00000078,0x00000007,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00066000
-	.word 0x00000000,0x00000000,0x08888880,0x08188180,0x08888880,0x07888870,0x00777000,0x66088000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00066000,0x88860000,0x07868000,0x00060080,0x00000000,0x00000000,0x80000000,0x88880000
-	.word 0x06070000,0x86080880,0x86088780,0x78878088,0x08008870,0x00807800,0x00000800,0x00000000
-	.word 0x07088800,0x00007880,0x00000070,0x00000000,0x00000000,0x00000000,0x00000000,0x00000060
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00780000,0x00000000,0x00000800,0x00000000,0x00600000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00080000,0x00880000,0x00870000,0x00800000,0x00700000,0x00000000,0x00000000
-	.word 0x00000066,0x00000006,0x00000000,0x00000000,0x00000000,0x00000008,0x00000007,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00378010,0xF000003F,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0x7001F001,0x66662501,0x60660200,0x00400380
+	.word 0x1310FB03,0x01F01D30,0x1F200150,0x00412006,0x10067D03,0xA03E1003,0x2069B01F,0x03500656
+	.word 0xA077D0DC,0x6FF0647F,0x01D001F0,0x00BF5656,0x08005503,0x6B603D50,0x7F0003F0,0x00166C00
+	.word 0xA7104440,0x7017F144,0x40AB44FB,0x9800008F,0x00080000,0x1BF13400,0x44017086,0x00644444
+	.word 0x04C6101E,0x40F340D2,0x03004603,0x06000004,0x04443F00,0xEFB04910,0x63505F30,0x01F04AA1
+	.word 0xF0EA10EB,0x4601D001,0x0046EB30,0xEF9F2187,0x83000340,0x10409D21,0x20039005,0xFEFF60B7
+	.word 0x4E614A11,0xAF400350,0x6BF0E400,0xF7445B51,0x3F001E00,0xEA000300,0xF0EA0000,0xFF01F001
+
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0x7001F0DF,0x9F116001,0x130112B0,0x9C614F12
+	.word 0x5055563F,0x30CAF118,0xE056F001,0xFF072266,0xB32103B0,0x9CF17140,0x4B425720,0x7FF001F0
+	.word 0xF001F0FF,0x5001F001,0xF00B7301,0x101F7301,0x10407F98,0x526F2393,0x102403E3,0x00450217
+	.word 0x77A2FF0B,0x43A03FD0,0x54F18363,0x01F001F0,0xF0FEFFF0,0x51819001,0x349FB3D3,0x3051F02F
+	.word 0x03C04601,0x66F312DC,0x66666565,0x0340FF55,0x03101D13,0xE7540100,0x01F06FF0,0xF0FF01F0
+	.word 0x5001F001,0x103FC1BD,0x42750173,0xFFB7F143,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x2001F0FF,0xF0F95101,0xF0017019,0x4001F01C,0x5B83FF26,0x6000DF41,0xCCF15DF2,0xE3654F75
+	.word 0xD0FF5FF2,0x252F3070,0xB3EFD627,0xF057F21F,0xFF017001,0x11A4F956,0xFF558F65,0xB3277B36
+
+	.word 0x0B629425,0x967F13FF,0xF07FF7A8,0xA0718401,0x10075601,0x5151FB72,0x73007730,0x41057462
+	.word 0xA1D00300,0x6B53FF7B,0x01F01741,0x01F001F0,0xD2A001A0,0x17FF0370,0xF09D1087,0xF001F001
+	.word 0xF001F001,0xFFE58001,0xF763D760,0x2FF00350,0x019001F0,0x3F844380,0x60C362FF,0xF1AA42F5
+	.word 0xF01CC143,0x90FFA2AE,0x4BF0FFAF,0xD7C40100,0x01F001F0,0x93640190,0xA2FF0310,0xB09329FF
+	.word 0xF0E0F22C,0xF001F050,0xFF018001,0x03903B71,0x01F00371,0x01F001F0,0x01F001F0,0x107F40FF
+	.word 0x100350EF,0x9103000F,0xF001F077,0x01F0FF01,0x01F001F0,0xF0107F40,0x9F6BBFAB,0xF0FF1F60
+	.word 0xF001F001,0xF001F001,0xF5E05101,0xFFA17057,0x97605BA5,0x5A1A0140,0xD01301A0,0x01F0D4F3
+	.word 0x707FB0EF,0x4627254F,0x44002305,0x13009F1B,0x143705DF,0xAD08062B,0x01F0C5FA,0x01F001F0
+
+	.word 0xF07FF0FF,0xF201D001,0xF00340FC,0x30AE2C01,0x4C41EFB3,0xC7403711,0xF0972B04,0xF001F07F
+	.word 0x67F0E301,0xA7C1475C,0xF1404400,0x9F01F02B,0x44467F50,0x6F117321,0x03001310,0x0CFF335C
+	.word 0xF034F062,0xF001F001,0x4001F001,0xFC8F876B,0x27A001E0,0x15B46025,0x01F0C590,0xA0FF6566
+	.word 0xF01CD0E6,0xF001F012,0x1201D001,0xFB03100F,0x634085F5,0x01F067F0,0x014601F0,0xDFDB117A
+	.word 0x3B0A01C0,0x00B40744,0xF0AB2BD3,0xFF3C3037,0x3FF04713,0x3F6F171F,0x01701F5F,0x59F0E2F2
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0xD9D401A0,0x01A001F0,0x7FB4B733
+	.word 0x4CFF20D0,0xC0183387,0x3547031D,0x90AA54CF,0xFF6B3D1D,0x03005737,0xFF25C371,0x334AC7AA
+	.word 0x01F0FEF5,0xF001F0FF,0x6301F001,0xA033FB57,0xFB7FC301,0x4FE0FF5F,0x09F6CB90,0x1E232FF0
+
+	.word 0x014043F3,0xF3FF3F53,0x10015043,0xE4C76067,0x106FD043,0xFF2F8591,0x013073F4,0x03600803
+	.word 0xB0801CF0,0x01E001F0,0x86FF55FF,0xFC074C03,0x9601E061,0xF08DF368,0x7DF0FF01,0x0390FF8B
+	.word 0x01F07368,0x01F001F0,0xF0FF01F0,0x72013001,0x3103B00B,0x79936113,0xFFDFF503,0x91F98262
+	.word 0x4763D7A1,0xDF4C1FD0,0x01F053FE,0xF10130FF,0xF11CC0FF,0xF001F0FF,0xF001F001,0x01B0FF01
+	.word 0x01F0F7F1,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF011001
+	.word 0xC7F599FA,0x01F001F0,0x533057F0,0x01F001F0,0xF001F0FF,0x3001F001,0xB051FB01,0xF011F501
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0F801F0,0xF001F001,0xF001F001,0x33000001
+	.word 0x0330334F,0x07102222,0x01F00910,0xF0EC2B70,0xC01FF01F,0x13003001,0x22200310,0x1FF02269
+
+	.word 0x00880150,0x40088003,0x01B0DE08,0x3060B111,0x101C0003,0x80013023,0x80008016,0x50701000
+	.word 0x806E040F,0x28106079,0x1E2001F0,0x80000340,0xF0DD0340,0x77012001,0x21506630,0x50788F10
+	.word 0x0420C171,0x60084400,0x00880008,0x08870603,0x00700008,0x88247091,0x88A23087,0x00800007
+	.word 0xE0060010,0x01F0EAE5,0x653001F0,0x86431580,0xE3870300,0xE6601000,0x00066310,0x10030018
+	.word 0x8887276B,0x07778100,0x6B401511,0x817A6310,0x82C0B880,0x019001F0,0x803F7860,0x08888801
+	.word 0x08188180,0x70290710,0x70C90088,0x08801901,0xB0F03FF3,0xF09F7101,0x86638001,0x1C800088
+	.word 0xBE800786,0x105F01B9,0x000607D3,0x86080880,0x86088780,0x87808802,0x00887078,0x00C77853
+	.word 0x8859501A,0x5B110708,0x5A701081,0xF012F0FF,0x60CE5101,0x3035F0A9,0x1141111C,0xF611FF7A
+
+	.word 0x00116D70,0x7E8165D9,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF
+
+	.word 0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0
+
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+
+	.word 0xF001F001,0xF001F001,0xC001F001,0x016001F0
 
 	.section .rodata
 	.align	2
@@ -6,8 +6,8 @@
 //	tilesheet4, 1184x24@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 444 tiles Metatiled by 4x3 not compressed
-//	Total size: 512 + 14208 = 14720
+//	+ 444 tiles Metatiled by 4x3 lz77 compressed, 14208 bytes raw
+//	Total size: 512 + 2536 = 3048
 //
 //	Time-stamp: 2021-04-06, 09:05:25
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_TILESHEET4_H
 #define GRIT_TILESHEET4_H
 
-#define tilesheet4TilesLen 14208
-extern const unsigned int tilesheet4Tiles[3552];
+#define tilesheet4TilesLen 2536
+extern const unsigned int tilesheet4Tiles[634];
 
 #define tilesheet4PalLen 512
 extern const unsigned short tilesheet4Pal[256];
@@ -6,8 +6,8 @@
 @	tilesheet4, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed, 14208 bytes raw
+@	Total size: 512 + 2536 = 3048
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,98 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet4Tiles		@ 14208 unsigned chars
+	.global tilesheet4Tiles		@ 2536 unsigned chars
 	.hidden tilesheet4Tiles
 tilesheet4Tiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x222222E2,0x22222222,0x88888222,0x22288222,0x22228222,0x22228222,0x22228222
-	.word 0x22222222,0x22222222,0x22222222,0x88888888,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x88888888,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x2E222222,0x22222222,0x22288888,0x22288222,0x22282222,0x22282222,0x22282222
-
-	.word 0x22228222,0x22228222,0x22228222,0x22228222,0x22228222,0x22228222,0x22228222,0x22228222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22282222,0x22282222,0x22282222,0x22282222,0x22282222,0x22282222,0x22282222,0x22282222
-	.word 0x22228222,0x22228222,0x22228222,0x22288222,0x88888222,0x22222222,0x222222E2,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x88888888,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x88888888,0x22222222,0x22222222,0x22222222
-	.word 0x22282222,0x22282222,0x22282222,0x22288222,0x22288888,0x22222222,0x2E222222,0x22222222
-
-	.word 0x55555777,0x75555577,0x77755555,0x77777555,0x77777755,0x77777775,0x77777775,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x57777777,0x55577777,0x55557777,0x55555777,0x55555577
-	.word 0x55555777,0x75555577,0x77755555,0x77777555,0x77777755,0x77777775,0x77777775,0x77777777
-	.word 0x77777775,0x77777777,0x77777777,0x57777777,0x55577777,0x55557777,0x55555777,0x55555577
-	.word 0x77777777,0x77777777,0x57777777,0x55777777,0x55577777,0x55555777,0x75555577,0x77755555
-	.word 0x77555557,0x77775555,0x77777555,0x77777755,0x77777755,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x57777777,0x55777777,0x55577777,0x55555777,0x75555577,0x77755555
-	.word 0x77555557,0x77775555,0x77777555,0x77777755,0x77777755,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777555,0x77777755,0x77777775,0x77777775,0x77777777,0x77777777,0x57777777,0x55777777
-	.word 0x57777777,0x55577777,0x55557777,0x55555777,0x55555577,0x77555557,0x77775555,0x77777755
-	.word 0x77777555,0x77777755,0x77777775,0x77777775,0x77777777,0x77777777,0x77777777,0x55777777
-	.word 0x57777777,0x55577777,0x55557777,0x55555777,0x55555577,0x77555557,0x77775555,0x77777555
-	.word 0x66666666,0x66666666,0xCCCCC666,0x666CC666,0x6666C666,0x6666C666,0x6666C666,0x6666C666
-	.word 0x66666666,0x66666666,0xCCCCCCCC,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0xCCCCCCCC,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x666CCCCC,0x666CC666,0x666C6666,0x666C6666,0x666C6666,0x666C6666
-
-	.word 0x6666C666,0x66666666,0x6666C666,0x6666C660,0x66666660,0x66666660,0x66666660,0x66666660
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x00106666,0x00100666,0x11100066
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666111,0x66666111,0x60166111
-	.word 0x666C6666,0x666C6666,0x666C6666,0x66666666,0x666C6666,0x66666666,0x66666666,0x00666666
-	.word 0x01111000,0x11111000,0x11110000,0x11100000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x11000000,0x11111100,0x11111111,0x01111111,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x60166011,0x61111111,0x60100001,0x01100000,0x01000000,0x10000000,0x00000000,0x00000000
-	.word 0x00016666,0x00011106,0x00001116,0x00000106,0x00000100,0x00000011,0x00000000,0x00000000
-
-	.word 0x22222222,0x22222292,0x22222222,0xDDDD8222,0x8888D222,0x88888222,0xDDD88222,0x88888222
-	.word 0x22222222,0x22222222,0x22222222,0xDDDDDDDD,0x88888888,0x88888888,0xDDDDDDDD,0x88888888
-	.word 0x22222222,0x22222222,0x22222222,0xDDDDDDDD,0x88888888,0x88888888,0xDDDDDDDD,0x88888888
-	.word 0x22222222,0x29222222,0x22222222,0x2228DDDD,0x222D8888,0x22288888,0x22288DDD,0x22288888
-	.word 0xDDD88222,0x88888222,0xDDD88222,0x88888222,0xDDD88222,0x88888222,0xDDD88222,0x88888222
-	.word 0xDDDDDDDD,0x88888888,0xDDDDDDDD,0x88888888,0xDDDDDDDD,0x88888888,0xDDDDDDDD,0x88888888
-	.word 0xDDDDDDDD,0x88888888,0xDDDDDDDD,0x88888888,0xDDDDDDDD,0x88888888,0xDDDDDDDD,0x88888888
-	.word 0x22288DDD,0x22288888,0x22288DDD,0x22288888,0x22288DDD,0x22288888,0x22288DDD,0x22288888
-
-	.word 0xDDD88222,0x88888222,0x88888222,0x88888222,0x88882222,0x22222222,0x22222292,0x22222222
-	.word 0xDDDDDDDD,0x88888888,0x88888888,0x88888888,0x88888888,0x22222222,0x22222222,0x22222222
-	.word 0xDDDDDDDD,0x88888888,0x88888888,0x88888888,0x88888888,0x22222222,0x22222222,0x22222222
-	.word 0x22288DDD,0x22288888,0x22288888,0x22288888,0x22228888,0x22222222,0x29222222,0x22222222
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x999A9999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99AA9999,0x99AA9999,0x99999999,0x99999999
-
-	.word 0x55555777,0x75555577,0x77755555,0x77777555,0x77777755,0x77BBB775,0x77B7B775,0x7777B777
-	.word 0x77777777,0x77777777,0x77777777,0x57777777,0x55577777,0x55557777,0x55555777,0x55555577
-	.word 0x55555777,0x75555577,0x77755555,0x77777555,0x77777755,0x77777775,0x77777775,0x77777777
-	.word 0x77777775,0x77777777,0x77777777,0x57777777,0x55577777,0x55557777,0x55555777,0x55555577
-	.word 0x7777B777,0x77777777,0x57777777,0x55777777,0x55577777,0x55555777,0x75555577,0x77755555
-	.word 0x77555557,0x77775555,0x77777555,0x77777755,0x77777755,0x777B7777,0x77B77777,0x77B77777
-	.word 0x77777777,0x77777777,0x57777777,0x55777777,0x55577777,0x55555777,0x75555577,0x77755555
-	.word 0x77555557,0x77775555,0x77777555,0x77777755,0x77777755,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777555,0x77777755,0x77777775,0x77777775,0x77777777,0x77777777,0x57777777,0x55777777
-	.word 0x57777777,0x55577777,0x55557777,0x55555777,0x55555577,0x77555557,0x77775555,0x77777755
-	.word 0xB7777555,0xB7777755,0xB7777775,0x77777775,0x77777777,0x77777777,0x77777777,0x55777777
-	.word 0x5777777B,0x55577777,0x55557777,0x55555777,0x55555577,0x77555557,0x77775555,0x77777555
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x33333333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x34444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x33333333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444400
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44404404,0x44004400
-	.word 0x44444444,0x44444444,0x44444444,0x04444444,0x04444444,0x04444444,0x04444444,0x04444444
-
-	.word 0x44440000,0x40000000,0x40000000,0x40000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044004,0x00000004,0x00000004,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000400,0x00000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044440,0x00044440,0x00044400,0x00044400,0x00044400,0x00004400,0x00004000,0x00004000
-	.word 0x33333333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x34444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x33333333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444400
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44404404,0x44004400
-	.word 0x44444444,0x44444444,0x44444444,0x04444444,0x04444444,0x04444444,0x04444444,0x04444444
-	.word 0x44440000,0x40000000,0x40000000,0x40000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044004,0x00000004,0x00000004,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000400,0x00000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044440,0x00044440,0x00044400,0x00044400,0x00044400,0x00004400,0x00004000,0x00004000
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0xE9999999,0xEEE99999,0xEEEEE999
-	.word 0x99999999,0x99999999,0xE9999999,0xEEEE9999,0xEEEEEEE9,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x99999999,0xEEEE9999,0xAEEEEEEE,0xAAEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAEEEEEEE,0xAAEEEEEE
-	.word 0x99999999,0xEEEEEEEE,0xEEEEEEAA,0xEEEEEEAA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x99999999,0x9999EEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-
-	.word 0x99999999,0x99999999,0x9999999E,0x9999EEEE,0x9EEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x9999999E,0x99999EEE,0x999EEEEE
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0xEE999999,0xEEE99999,0xEEEE9999,0xEEEEEE99,0xEEEEEEE9,0xEEEEEEEE
-
-	.word 0xEEEEEEE9,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAEEEEEEE
-	.word 0x9EEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEAAEE,0xEEEEEEEE,0xEAAAAAEE,0xAAAAAAAA
-	.word 0x99999999,0x99999999,0x999999EE,0x99999EAE,0x9999EAEE,0x99EEAEEE,0x9EAEEEEE,0xEEEEEEEE
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xE9999999,0xEE999999,0xEEE99999,0xEEE99999,0xEEEE9999,0xEEEEE999,0xEEEEEE99,0xEEEEEE99
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEAAE,0xEEEEAAAA,0xEEAAAAAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xAEEEEEEE,0xAEEEEEEE,0xAEEEEEEE,0xAEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAEE,0xAAAAAEEE,0xAAAAEEEE
-	.word 0xEEEEEEEA,0xEEEEEEEA,0xEEEEEEEA,0xEEEEEEAA,0xEAEEEEAA,0xAAEEEEAA,0xAAEEEEEA,0xEEEEEEEA
-	.word 0x9999999E,0x999999EE,0x99999EEE,0x99999EEE,0x9999EEEE,0x999EEEEE,0x99EEEEEE,0x99EEEEEE
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0xE9999999,0xE9999999,0xEE999999,0xEE999999,0xEEE99999
-
-	.word 0xEEEEEEE9,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEAEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xAEEEEEEE,0xAEEEEEEE,0xAEEEEEEE,0xAEEEEEEE,0xAAAEEEEE,0xAAAAEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEA,0xEEEEEEEA,0xEAAAAAAE,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEA,0xEEEEEEEA,0xEEEEEEEA
-	.word 0xAAAEEEEE,0xAAAAAEEE,0xAAAAAAEE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAEE,0xAAAAAAEE
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xEEEEEEEA,0xEEEEEAAA,0xEEEEEAAA,0xEEEAAAAA,0xEEEAAAAA,0xEEEAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEAAAAEE,0xEAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAEEAAAAE,0xAEEAAAAA,0xEAEEAAAA,0xEAAEAAAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAEEEEEEE,0xAEAAAAEA,0xAAAAAAAA,0xAAAAAAAE,0xAAAAAAAE
-	.word 0x9EEEEEAA,0xEEEEEEAA,0xEEEEEEEA,0xEEEEEEEE,0xEEEEEEEA,0xEEEEEAAA,0xEEEEAAAA,0xEEEEAAAA
-	.word 0x99999999,0x99999999,0x99999999,0x9999999E,0x9999999E,0x999999EE,0x999999EE,0x99999EEE
-	.word 0xEEE99999,0xEEEE9999,0xEEEE9999,0xEEEE9999,0xAEEEE999,0xAAEAE999,0xAAEAE999,0xAAEAAE99
-	.word 0xEEEAAEEE,0xEEEAAAEE,0xEEEEAAAE,0xEEEEEEAE,0xEEEEEEAA,0xAEEEEAAA,0xAAEEEEAA,0xAAAEEEAA
-	.word 0xAAAAAEEE,0xAAAAAEEE,0xAAAAAEEE,0xAAAAAEEE,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEEAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xEEEEEEEA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEAA,0xAEEEEEAA,0xAEEEEEAA
-	.word 0xAAAAAAEE,0xAAAAAAEE,0xAAAAAEEE,0xAAAAAEEE,0xAAAAAEEE,0xAAAEEEEE,0xAAAEEEEE,0xAAEEEEEA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAEEA,0xAAAAAEEE,0xAAAAAEEE
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xEAAEAAAA,0xEAAAAAAA,0xEEAAAAAA,0xEAAAAAAA,0xEAAAAAAA,0xEEAAAAAA,0xEEEAAAAA,0xEEEEEAAA
-	.word 0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAEE
-	.word 0xEEEEAAAA,0xEEEEAAAA,0xEEEEAAAA,0xEEEAAAAA,0xEEEAAAAA,0xEEEAAAAA,0xEEEEAAAA,0xEEEEAAAA
-
-	.word 0x99999EEE,0x9999EEEE,0x9999EEEE,0x9999EEEE,0x999EEEEE,0x999EEEEE,0x999EEEEE,0x99EEEEEE
-	.word 0xAAEAAE99,0xAAEAAE99,0xEEAAAE99,0xAAAAAA99,0xAAAAAAE9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9
-	.word 0xAAAEEEEA,0xAAAEEEEA,0xAAEEEEEE,0xAAEEEEEE,0xAEEEEEEA,0xEEEEEEEA,0xAAEEEEAA,0xAAEEEEAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xEEEEEEAA,0xEEEEEEAA,0xEEEEEEAA,0xEEEEEEAA,0xEEEEEEEA,0xAAAEEEAA,0xEAAAAAAA,0xAAAAAAAA
-	.word 0xAEEEEEEA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAEEEEEEA,0xAAEEEEEA,0xAAAEEEEA
-	.word 0xEEEEAAAA,0xEAAAEEEE,0xEEAAEAAE,0xEEEEEAAA,0xEAEEAAAA,0xEAAAAAAA,0xEAAAAAAA,0xEEAAAAAA
-
-	.word 0xAAAAAAEE,0xAAAAAAAE,0xAAAAEEEE,0xAAAEEAEE,0xAEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAEE,0xAEAAAAEE,0xAEEAAEEE
-	.word 0xEEEEEEAA,0xEEEEEAAA,0xEEEEEAAA,0xEEEEEAAA,0xEEEEEAAA,0xEEEEEAAA,0xEEEEEAAA,0xEEEEEEAA
-	.word 0xAAAAAEEE,0xAAEAAAEE,0xAEEEAEEE,0xAAEAEEEE,0xAAEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEAAAAEE
-	.word 0xEEEEAAAA,0xEEEEEAAA,0xEEEEEEAA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEAE
-	.word 0x99EEEEEE,0x99EEEEEE,0x99EEEEEE,0x99EEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE
-	.word 0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9
-	.word 0xAAEEEEAA,0xAAEEEAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEAAAAAAA,0xEEAAAAAA,0xEEAAAAAA,0xEEEAAAAA,0xEEEEEAAA
-	.word 0xAAAEEEEE,0xAAAEEEEE,0xAAAEEEEE,0xEAEAAEEE,0xEAAEEEEE,0xEEEEAAAE,0xEEEEAAAA,0xEEEEAAEA
-	.word 0xEEAAAAAA,0xEEEAAAAA,0xEEEEEAAA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-
-	.word 0xEEAAAAAA,0xEAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEAAAAAAE,0xEEAAAAEE
-	.word 0xEEEEEAAE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE
-	.word 0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAEAAA,0xAAAAAAAA,0xAAAEEAAA,0xAAAEEAAA,0xAAAAEAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xEAAAAAAA,0xEEAAAAAA,0xEEEAAAAA,0xEEEEAAAA,0xEEEEEEEA,0xEEEEEEEA,0xEEEEEEAA
-	.word 0xEEEEEEEA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAAEEEEEE
-
-	.word 0xEEEEEEAE,0xEEEEEEEE,0xEEEAAEEE,0xEAAAAEEE,0xEAAAAEEE,0xEEAAEEEE,0xEEEEEEAA,0xEEEEEEAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x99EEEEEE,0x99EEEEEE,0x99EEEEEE,0x99EEEEEE
-
-	.word 0xAAAAAE99,0xAAAAA999,0xAAAAA999,0xAAAAE999,0xAAAA9999,0xAAAA9999,0xAAAE9999,0xAAE99999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEAAAAAAA,0xEEAAAAAA,0xEEAAAAAA,0xEEAAAAAA,0xEAAAAAAA
-	.word 0xEEEEEAEE,0xEEEEAAAA,0xEAAAAAAA,0xEAAAAAAE,0xEAAAAAAE,0xAAAAAAEE,0xAAAAAAEE,0xAAAAAEEE
-	.word 0xAAEEEEEE,0xAEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAEEEEEEA,0xAAAAEEAA,0xAAAAAAAA
-	.word 0xEEEEEEAA,0xEEEEEEEE,0xEEEEEEAE,0xEEEEEEEE,0xAEEEEEEE,0xAAEEEEAA,0xEEEEEEEA,0xEEEEEEEA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEA,0xEEEEAAAA,0xEEEEAAAA,0xEEEAAAAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEA,0xEEEEEEAA
-
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x99EEEEEE,0x999EEEEE,0x999EEEEE,0x999EEEEE,0x9999EEEE,0x9999EEEE,0x9999EEEE,0x99999EEE
-	.word 0xAAE99999,0xAE999999,0xEE999999,0xE9999999,0xE9999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAEAAAEE,0xAAAAAEEE,0xAAAAEEEE,0xAAAEEEE9
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xAAAAAEEA,0xAAAAAEAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xEEAAAAAA,0xEEEAAAAA,0xEEEAAAAA,0xEAAAAAAA
-	.word 0xEEEEEEAA,0xEEEEEAAA,0xEEEEEAAA,0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEAAAAAAA,0xAEAAAAAE
-	.word 0xAAAAAAAE,0xAAAAAEEE,0xAAAAAEEE,0xAAAAAEAA,0xAAAAAAAA,0xAAAAAAAE,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xEEEEEEAA,0xEEEEEEAA,0xEEEEEEAA,0xEEEEEEAA,0xEEEEEAAA,0xEEEAAAAA,0xEAAAAAAA,0xEAAAAAAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0x9EEEEEEE
-	.word 0x99999EEE,0x999999EE,0x999999EE,0x9999999E,0x9999999E,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAEEEE99,0xAEEEEE99,0xAEEEE999,0xEEEE9999,0xEEE99999,0xEAE99999,0xEE999999,0xE9999999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAEA,0xAAAAAEAA,0xAEEEEEAE,0xEEEEAAAE
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEEEAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAEEEEA,0xEAAEEEEE,0xAAEEEEEE
-	.word 0xAAEAAAAE,0xAAEEAEEA,0xAEEEEEEA,0xAEEEEEEA,0xEEEEEEEA,0xEEEEEEEA,0xEEEEEEEE,0xEEEEEAAA
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAE,0xAAAAAEEE,0xAAAEEEEE,0xEEEEEEEE,0xEEAAAEEE
-	.word 0xEAAAAAAA,0xEAAAAAAA,0xEEAAAAAA,0xEEEAAAAA,0xEEEEAAAA,0xEEEEEAAA,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x99EEEEEE,0x99EEEEEE,0x999EEEEE,0x9999EEEE,0x99999EEE,0x99999EEE,0x999999EE,0x9999999E
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xEEEEAAEE,0xEEEEEEE9,0xEEEEEE99,0xEEEE9999,0xEEE99999,0xEE999999,0x99999999,0x99999999
-	.word 0xEEEAAAAE,0xAAEAAAEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEE9
-	.word 0xAEEEEEEE,0xAAEEEEEE,0xAAAEEEEE,0xAAAEEEEE,0xAAEEEEEE,0xAAEEEEEE,0xAEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEAAAA,0xAAAAAAAA,0xEAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEAAAAAAA,0xEEEAAAAA,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xAAEEAAEE,0xAAAAAAEE,0xEEEAAEEE,0xEEEAEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0x9EEEEEEE
-	.word 0xEEEEEEEE,0x9EEEEEEE,0x99EEEEEE,0x9999EEEE,0x99999EEE,0x999999EE,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xEEEEE999,0xEEE99999,0xE9999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEE9,0xEEEE9999,0xE9999999,0x99999999,0x99999999
-	.word 0xEEEEEEEE,0xAAEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEE9999,0x99999999
-	.word 0xEEEEEEEE,0xEEEEEEEA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEA,0xEEEEEEEE,0x99999999
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0x9999EEEE,0x99999999
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0x9EEEEEEE,0x9999EEEE,0x9999999E,0x99999999,0x99999999
-	.word 0x999EEEEE,0x99999EEE,0x9999999E,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00378010,0xF000003F,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0x1001F001,0x22220601,0x10E22222,0x82011004
+	.word 0x22888807,0x07002882,0x03400B10,0x8801809F,0xB01F0088,0xF01FF012,0x77011016,0x101F302E
+	.word 0x2203005B,0x6B900380,0xF0FF03F0,0xF001F049,0xC001A001,0xA003D06F,0xFE0F106F,0x1361C330
+	.word 0xE3F001C0,0x7FF01FF0,0xE0286B50,0x01300331,0x57771321,0x14775555,0x00755555,0x02007702
+	.word 0x771C5577,0x06007777,0x01F00320,0x00FF5777,0x00220002,0x50373033,0x403FF007,0xFF47C030
+	.word 0x1BA03FF0,0x1F003E10,0x0A305380,0x5B401800,0xF03090FF,0xF03FF09B,0xF034B03F,0xF04FD0B3
+	.word 0x5360FCB3,0x01D03FF0,0x3F903FF0,0x66663000,0xC6014081,0xC666CCCC,0xE707006C,0x03800B10
+
+	.word 0xCCCC0140,0x0E701F00,0xF0F701E0,0x101FD01F,0x6603005B,0x635003C0,0x607C0700,0x0A000310
+	.word 0x01F00390,0x00100110,0x00066622,0x11100003,0x17661BF0,0x50611166,0x42001603,0x01106F90
+	.word 0x200750D4,0x42000001,0x11030001,0x10005B00,0x03001003,0x001101E0,0x4501501A,0x601CE001
+	.word 0x17006016,0x74440061,0x103F0060,0x1003101F,0x66661F50,0x06000115,0x00163600,0x1D400659
+	.word 0x136490D0,0x11539203,0x22DDDD82,0x8314D266,0xDDD80310,0x01508B53,0xDDDD1FDD,0x105F13DD
+	.word 0xF00B5001,0xB41FF01F,0x30290100,0x2D7F131F,0x8DDD8323,0x508B43FF,0x2007F067,0xF0475007
+	.word 0xF007F007,0x0700FF07,0x07F06740,0x03407FD0,0x13911500,0x50FFD390,0xF0F3F001,0x401F601F
+	.word 0x60037067,0x3F13211A,0x01F09999,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+
+	.word 0xF001F001,0xFB01F001,0x01F001F0,0x01F001F0,0xF09A01D0,0x79016012,0x300340AA,0x04BFF501
+	.word 0x00BBB7C7,0x77B71F03,0xF5020077,0xF5FFF563,0xFDFFF5FF,0x3F403FF0,0xBFF56370,0xBF45BFF5
+	.word 0xFF03007B,0xA0A03810,0x3FF03FF0,0xB3F0FFF5,0xBFF5FFF5,0xB7FF95AF,0x00B70700,0xE503103B
+	.word 0xFFA900FF,0x93803FF0,0x01F0EEF4,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0x33030130,0x44333333,0x5001F044
+	.word 0x43333701,0x01C013F0,0x8012F034,0xEF5FF03F,0x01F001F0,0xF0000120,0xF001F012,0x1A012001
+	.word 0x00404404,0x0441E03F,0xD80003D0,0x06012200,0xA0038040,0x04400401,0x2400007E,0x01F00320
+	.word 0x1CF01840,0xDF400160,0x03106200,0x7003A000,0xB01FF16D,0xFF7FF101,0x7FF101E0,0x5FF03F90
+
+	.word 0x01F001F0,0x7FF10120,0xF001F0FF,0xF1013001,0xF116407F,0xF17FF17F,0x62F1FF7F,0x01F07FF1
+	.word 0x7FE17FF1,0x01F01FF6,0xF0F501F0,0xF001F001,0xE9018001,0x00EE0200,0xB0EE4F02,0x00EEEE13
+	.word 0x3001A012,0x5F0A201A,0xAA0300AE,0x0F201A80,0x18101D50,0x90F11C90,0xF005103F,0x995F9019
+	.word 0x27709E99,0x1FF09E7F,0x2B2001B0,0x2A000400,0x01F01CF0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0x7001F001,0xCB00FF01,0xE5107301,0x6751D700,0x01F06FD1,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0xE001A001,0xAFA10312,0xAAAA0462,0x6AAAAAEA,0x11E868AA,0xB311AEC8,0xAE0300EA
+	.word 0xAE0211BF,0x26F13720,0x01F001F0,0x01F001F0,0x020160FF,0x417B51D7,0x10F7127F,0xF0CFF07B
+	.word 0x01F0FE01,0x01F001F0,0x01F001F0,0x014001F0,0x11EA7FAE,0xF303103E,0x2101F051,0xA0039083
+
+	.word 0x8311ED01,0x582001D0,0x006130AE,0x0350EE6A,0xEAC343BF,0x82101810,0x6B231310,0xBB110310
+	.word 0x337323FF,0x201A0077,0xF06EF103,0x418BC101,0x9331FB8F,0xDAD0FFF2,0x0330E7F0,0x50BF20AE
+	.word 0xC350FF1C,0x7722D600,0x54F0EB60,0x03102B60,0x11FF4720,0x002B000B,0x21036006,0xE03AF123
+	.word 0xFF372101,0x0D102C41,0x7FF00370,0x3210AE10,0xE4809FF0,0x10EAAA3F,0x009110C2,0xB0091227
+	.word 0xEF14101E,0xA7503710,0x109E4000,0x60285044,0xFC1D418F,0xCB117C91,0xD341CF61,0x03501363
+	.word 0xAE07EEE9,0xAAEAE999,0x6D000320,0xEA7F8C32,0x00566D21,0x44220E40,0x03803B21,0x71FF01F0
+	.word 0x3152F12A,0x4201D03F,0x92723087,0xFF0350AF,0xE6301A30,0x73D001F0,0xAFF014F0,0x016001F0
+	.word 0x607211FF,0x010B80BB,0x928000E3,0x3003D033,0x8B71FF9D,0xBD421FB2,0x5B935363,0x10000350
+
+	.word 0x308A7E00,0x99EEAA03,0x00E94D00,0x80FFA903,0x318A1103,0x219A518E,0x440C10B1,0xFF01F042
+	.word 0x01F001F0,0x8F710160,0x5B300320,0x5B213821,0xF36F10FF,0x3235725F,0x027201E1,0x5197424A
+	.word 0x4721FE43,0x19307753,0x4FA0C720,0x9B6390F0,0x6500FFAE,0x7F53F830,0x503303D0,0xB2007810
+	.word 0x14FF5710,0x20A688DA,0xD32B8046,0x6406306C,0xFF0340EB,0x0360B716,0x03F08B91,0x0E74D840
+	.word 0x01F001F0,0xF001F0FE,0xA201F001,0x539F729B,0xEAE7342B,0x559A21FF,0xA0E82539,0xF001F02B
+	.word 0xF001F001,0x01F0FF01,0x013001F0,0xA7D3AF40,0x61240425,0xD0FF97F0,0xD08FA101,0x138FD103
+	.word 0xE1039043,0xFF7D6041,0x01F049D6,0xD76339C0,0xBEF04F97,0xEC62FEB0,0x33E810FF,0xFB8D22CA
+	.word 0xF001F04F,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x012001F0,0xA3CE93D1,0xAAD7044F
+
+	.word 0x20980199,0x99DC0403,0x309401DF,0x0300AE03,0x01F0ED14,0xFFF201F0,0x115752FF,0x61664480
+	.word 0x3153A6D5,0x2173A466,0xB253FF89,0x20801340,0x3F783E23,0xF72101B0,0xF0FFEF85,0xF0278021
+	.word 0xF001F016,0xF001F001,0xFD01F001,0x015001F0,0x8B8673C6,0xC31B1F38,0xFF3248AE,0x0160BF59
+	.word 0x6B3584D1,0x4A08FD30,0xB4D1A5F1,0xF0C868FF,0x4001F001,0x35637962,0xB27F69D0,0x5600BF0B
+	.word 0x575B26AE,0xA06740EB,0x903F106E,0xC769FF03,0x2EF14330,0x01F001F0,0x01F001F0,0xF0FF01F0
+	.word 0x182F0301,0x597C411F,0xF001F0BF,0xFF016001,0xB302A31F,0xD521D729,0x850D072D,0x8FE1CF31
+	.word 0x1B2041FF,0xF0273660,0xF62A7001,0x361820D8,0xE222FF6F,0x8801CE04,0x14209768,0xC0D95451
+	.word 0x38FFAB61,0xB98553CF,0xF07C5373,0xF001F001,0xFF01F001,0x01D001F0,0x1B43AB44,0x8BF1075D
+
+	.word 0x01F001F0,0xF001F0FF,0x00BEB101,0x35231DEF,0x20BF512C,0x0120FF7E,0x06232E36,0x5B4D01E0
+	.word 0x0758B64B,0x24FFEA62,0x66248AD2,0xA0DB51FD,0x2192164C,0xFFF9F49F,0x01F001F0,0x01F001F0
+	.word 0x2F2601F0,0x7F710750,0xF026F1FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x84010170
+	.word 0x37A5B341,0xEC900150,0x20FFE721,0x612B70E5,0x4018C17D,0xD11F2027,0xFF0F508D,0x41D05FD0
+	.word 0x67111FF0,0xF722D7B2,0xEBF21000,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xCF01F001
+	.word 0x011001F0,0x01F00000,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001
+
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001
+	.word 0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001
+	.word 0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF
+	.word 0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0F001
+	.word 0x01F001F0,0x000001D0
 
 	.section .rodata
 	.align	2
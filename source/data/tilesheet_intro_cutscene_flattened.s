@@ -6,8 +6,8 @@
 @	tilesheet_intro_cutscene_flattened, 3368x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 421 tiles not compressed
-@	Total size: 512 + 13472 = 13984
+@	+ 421 tiles rle compressed, 13472 bytes raw
+@	Total size: 512 + 1992 = 2504
 @
 @	Time-stamp: 2021-04-06, 09:05:26
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,482 +17,79 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet_intro_cutscene_flattenedTiles		@ 13472 unsigned chars
+	.global tilesheet_intro_cutscene_flattenedTiles		@ 1992 unsigned chars
 	.hidden tilesheet_intro_cutscene_flattenedTiles
 tilesheet_intro_cutscene_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x99777777,0x99997777,0x99999777,0x66999977,0x66996977,0x66669667,0x99666667,0x66666667
-	.word 0x77777999,0x77799699,0x77999999,0x79966966,0x76999966,0x96966696,0x99966696,0x96666996
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x69966667,0x96966667,0x99666677,0x66666677,0x96699777,0x66967777,0x99777777,0x77777777
-	.word 0x99999999,0x99999999,0x79999996,0x79999969,0x77999999,0x77799996,0x77777999,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55777777,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777755,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777755
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x55577777,0x55555555,0x33333333,0x33333333,0x33334443,0x44444444
-	.word 0x77777777,0x77777777,0x55555555,0x33333355,0x33333333,0x33333333,0x33333333,0x34444433
-	.word 0x77777777,0x55555577,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x77777777,0x55555555,0x33333355,0x33333333,0x33333333,0x33343333,0x33333333,0x33333333
-	.word 0x55555777,0x55555555,0x33333333,0x33333333,0x33444333,0x34444443,0x33888333,0x33333333
-	.word 0x55555555,0x35555555,0x33333333,0x33333333,0x33333333,0x33433334,0x43333333,0x33333333
-	.word 0x55555555,0x33333333,0x33333333,0x33333333,0x44444433,0x44444443,0x44444444,0x48888333
-	.word 0x55555555,0x33333333,0x33333333,0x34443333,0x44444333,0x44444444,0x44444444,0x44444444
-	.word 0x55555555,0x33333333,0x44333333,0x44343333,0x33333333,0x33333334,0x33334444,0x34343344
-	.word 0x33555555,0x33333333,0x33333333,0x33333334,0x34433333,0x34444333,0x33333333,0x33333333
-	.word 0x34433333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333334,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x43334333,0x33333333,0x33333333,0x33333334,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333334,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33344333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555533,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x33343333,0x33333333,0x33333333
-	.word 0x55555555,0x33333333,0x33334443,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555555,0x55555553,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x77755555,0x55555555,0x33333333,0x33333333,0x33333333,0x33344333,0x43333333,0x33333333
-	.word 0x77777777,0x55555555,0x55333333,0x33333333,0x33333333,0x33333333,0x33333433,0x33333333
-
-	.word 0x77777777,0x77555555,0x55555555,0x33333333,0x33333333,0x33433333,0x33333333,0x33333333
-	.word 0x77777777,0x77777777,0x55555555,0x55333333,0x33333333,0x33333333,0x33434333,0x44433333
-	.word 0x77777777,0x77777777,0x77777555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x33334444,0x33333333
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444344,0x44333333,0x83333333
-	.word 0x33334444,0x44344444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44338888
-	.word 0x33333444,0x43444434,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444434
-	.word 0x33333333,0x33344444,0x33443333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x33333333,0x33333333,0x34333333,0x33333444,0x33344434,0x44444444,0x44444444,0x44444444
-	.word 0x83333333,0x33333333,0x33333333,0x33333333,0x33333333,0x34444444,0x44444444,0x44444444
-	.word 0x38888888,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x43333344,0x44444444
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33444444,0x34444444
-	.word 0x33333333,0x33333333,0x34443333,0x44444443,0x44488833,0x88333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x44443344,0x44444444,0x44444388,0x43888333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333344,0x44334443,0x33344444,0x33333888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333334,0x33344333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33344433,0x33338833,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x44333333,0x38833333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333443,0x33333344,0x33333388,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33334444,0x43333833,0x44433333,0x83333333,0x33333333
-	.word 0x33333333,0x33333333,0x44433333,0x44443333,0x44444444,0x44444444,0x43388888,0x33333333
-	.word 0x33333333,0x33333333,0x33444444,0x34444444,0x44444444,0x44444444,0x88834444,0x33333388
-	.word 0x33333333,0x33333333,0x33333333,0x44444333,0x44444444,0x44444444,0x44444443,0x44443883
-	.word 0x33333333,0x33333333,0x33333333,0x33333344,0x33333444,0x44334444,0x44444444,0x44444444
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x34444443,0x44444444,0x44444444,0x44444444
-	.word 0x38833333,0x33333333,0x33333333,0x33333333,0x33333333,0x33344443,0x34444444,0x44444444
-
-	.word 0x33333333,0x34333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333444
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33443333,0x44444433,0x33888333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88833333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444438,0x48888833,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444444,0x48834444,0x83333888,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444444,0x44444444,0x44444448,0x48888333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444444,0x44444444,0x44444444,0x33338888,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33334444,0x34444344,0x44444443,0x33888333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333334,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x83333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888833,0x88888888,0x88888883,0x88888333,0x88833333,0x88333333,0x88333333,0x88833333
-
-	.word 0x33333388,0x38888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33333333,0x33333338,0x33333388,0x33333388,0x33333888,0x33333888,0x33333888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x88888833,0x88888833,0x88888333,0x88888333,0x88888333,0x88888333
-	.word 0x33333333,0x33333333,0x33333338,0x33333388,0x33333388,0x33333888,0x33338888,0x33888888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88833333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444443,0x44444433,0x44443333,0x44433333,0x83333333,0x33333333,0x33333333,0x33333333
-	.word 0x34444444,0x44344444,0x44444444,0x44444444,0x44444888,0x38883333,0x33333333,0x33333333
-	.word 0x44444443,0x44444344,0x44444344,0x33334444,0x33333333,0x33333333,0x44433333,0x43344333
-	.word 0x33444444,0x44444444,0x44444444,0x44444444,0x44444333,0x44433333,0x44333333,0x44444444
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x38888888,0x88888888,0x88888888
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333338
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333433,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x34443333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88833333,0x83333333,0x33333333,0x33333888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333888,0x33333338,0x33333338,0x33888838,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33333333,0x33333333,0x88883333,0x88888333,0x88888888,0x88888888,0x88888888
-
-	.word 0x33333333,0x33333333,0x33333333,0x83338888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x83333333,0x88888833,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888333,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x38888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33333388,0x33338888,0x33888888,0x38888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333388,0x33333888,0x33333888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x83333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x34444444,0x44388888,0x83333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444444,0x44444444,0x44444448,0x44444433,0x88883333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888883,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x38888888,0x88388888,0x88883333,0x88333333,0x88883333,0x88888833,0x88888883,0x88888888
-	.word 0x33333333,0x33333888,0x88888888,0x88888888,0x88888888,0x33888888,0x88888888,0x88888888
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333388,0x33333338,0x33333333,0x33333333,0x33888888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x44444333,0x43333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x34444444,0x44444444,0x48888833,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x44433333,0x44444444,0x44444444,0x44444444,0x44444883
-	.word 0x33333333,0x33333333,0x33333333,0x33333444,0x44434444,0x44444444,0x44444444,0x44444444
-
-	.word 0x33333333,0x33333333,0x33333333,0x44333333,0x44433344,0x44444444,0x44444444,0x44444444
-	.word 0x33333333,0x33334443,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x33333333,0x88888833,0x88888888,0x88888884,0x44888844,0x44444444,0x44444444,0x44444444
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888444,0x88844444,0x88444444,0x84444444
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33338888,0x33338888,0x33388888,0x33388888,0x33888888,0x38888888,0x38888888,0x88888888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888833,0x88883333,0x88333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x33333333,0x33333333,0x33333333
-	.word 0x38888888,0x38888888,0x33388888,0x33338888,0x33338388,0x88888333,0x83333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33338888,0x33883333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88338883,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444488,0x88333333,0x33333333,0x33333333,0x33333333,0x33333333,0x88883333,0x88888333
-	.word 0x44444444,0x88888888,0x33333333,0x33333333,0x33333333,0x33333333,0x33333338,0x88888888
-	.word 0x44444444,0x44444444,0x44448833,0x88883333,0x88883333,0x88888833,0x88888883,0x88888888
-
-	.word 0x44444444,0x44444444,0x44444444,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x44444444,0x44444444,0x44444444,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888844,0x88888844,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x38888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33338888,0x33888888,0x33888888,0x33888888,0x38888888,0x38888888,0x38888888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x38833333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333383,0x33333333,0x33333333,0x38333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333388,0x88888833
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x88883333,0x88888833,0x88888888
-	.word 0x88833333,0x88888333,0x88888833,0x88888833,0x88888883,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x38888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33333333,0x33333338,0x33333338,0x33333338,0x33333338,0x33333388,0x33333888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x88833333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333338
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888333,0x88833333,0x88333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888833,0x88888833,0x88883333,0x88833333,0x88333333
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x33388888,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x33333888,0x33333338,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x83333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x88888888,0x88888888,0x88888888,0x83333888,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888833,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888833,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888833
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x38888888,0x33333888,0x33333338
-	.word 0x33333888,0x33333888,0x33338888,0x33333888,0x33333338,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x88333333,0x88833333,0x88833333,0x88833333,0x83333333,0x88333333,0x88333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33338888,0x33888888,0x38888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333338,0x33333388,0x33333888,0x33338888
+	.word 0x0034A030,0x77A0009D,0x77779919,0x97779999,0x99779999,0x69776699,0x96676699,0x66676666
+	.word 0x80679966,0x79990766,0x96997777,0x99807779,0x6966770A,0x99667996,0x66967699,0x66069680
+	.word 0x69969996,0x119D9666,0x00FF779D,0x00F900FF,0x77FF229D,0x77FF77FF,0x670C7797,0x67699666
+	.word 0x77969666,0x77996666,0x77076680,0x77966997,0x80669677,0x81990077,0x07998577,0x79999996
+	.word 0x79999969,0x77069980,0x77799996,0x77C37999,0x00FF00FF,0x77FF00F9,0x77FF77FF,0x77FF77FF
+	.word 0x77FF77FF,0x77FF77FF,0x77FF77FF,0x77FF77FF,0x77FF77FF,0x77FF77FF,0x77FF77FF,0x77FF77FF
+	.word 0x77FF77FF,0x77FF77FF,0x77FF77FF,0x550077A6,0x55817799,0x55817799,0x55827798,0x55857795
+	.word 0x55857795,0x55857795,0x55857795,0x55857795,0x55857795,0x55857795,0x55857795,0x55007795
+
+	.word 0x55817780,0x55817799,0x55817799,0x55007799,0x77E877FF,0x55825700,0x43033385,0x81333344
+	.word 0x82778544,0x02338D55,0x82344444,0x91558477,0x82778133,0x00338A55,0x01338634,0x55835777
+	.word 0x43093386,0x44433344,0x83333444,0x84338288,0x89350055,0x33340233,0x00338143,0x81338143
+	.word 0x80338A55,0x84430044,0x83330344,0x55814888,0x44033387,0x8B433334,0x84558144,0x33440433
+	.word 0x81443433,0x80340033,0x44440733,0x33443333,0x55803434,0x34003386,0x43053382,0x44433334
+	.word 0x01338734,0x338D3443,0x33913400,0x43334302,0x34003385,0x34003390,0x43013399,0xD533FF34
+	.word 0x99558033,0x99558133,0x8F558133,0x86340033,0x81558133,0x44430133,0x55813393,0x55805300
+	.word 0x55033395,0x81777555,0x01338A55,0x33813443,0x33814300,0x55817781,0x55003380,0x3400338A
+
+	.word 0x77813383,0x77005580,0x33875581,0x33864300,0x55817785,0x55003380,0x43013386,0x01338043
+	.word 0x77854443,0x77755503,0x8D558177,0x83449733,0x02449233,0x80444443,0x80440033,0x44830733
+	.word 0x44333344,0x44923444,0x3388880B,0x33344444,0x44443433,0x00449143,0x81448034,0x44440233
+	.word 0x01338034,0x44913344,0x34083388,0x33333444,0x33344434,0x33804489,0x338D8300,0x34004480
+	.word 0x88804485,0x33913800,0x33334403,0x95448143,0x00448033,0x00448033,0x02338734,0x80433444
+	.word 0x88330344,0x33804448,0x33918800,0x83334401,0x43880744,0x83334444,0x33914388,0x33804400
+	.word 0x33444302,0x34034480,0x93388833,0x81340033,0x34430133,0x440433AF,0x88333334,0x339033FF
+	.word 0x33334404,0x33B13883,0x33344304,0x33804433,0x33A08800,0x80444401,0x33380633,0x43333343
+
+	.word 0x00338044,0x03338B83,0x33334443,0x88034487,0x89433888,0x00448033,0x00448033,0x02448734
+	.word 0x8D888883,0x87430033,0x80430044,0x38830344,0x33894444,0x33804400,0x33344406,0x33444433
+	.word 0x338D4486,0x44444303,0x03448934,0x38833333,0x4303338D,0x80333444,0x81340044,0x00338444
+	.word 0x01339134,0x33C13444,0x33334402,0x33024480,0x33948883,0x99888301,0x80380033,0x88330344
+	.word 0x33954888,0x83054483,0x33388848,0x85339183,0x80480044,0x83330344,0x338D4888,0x338D448D
+	.word 0x88014489,0x08339388,0x33334444,0x34444344,0x02448043,0x96888333,0xD7340033,0x96830033
+	.word 0x00888433,0x07888083,0x88888333,0x88833333,0x88003380,0x88053380,0x88833333,0x80338088
+	.word 0x95380088,0x00338588,0x00338038,0x00338088,0x09338088,0x33333888,0x33333888,0x33C83888
+
+	.word 0x33008880,0x330F8880,0x33888883,0x33888883,0x33888883,0x85888883,0x80380033,0x80880033
+	.word 0x80880033,0x38880733,0x88883333,0x88803333,0x330233FF,0x33998883,0x44804300,0x44803300
+	.word 0x44333307,0x43333344,0x00338044,0x80338983,0x44340344,0x44863444,0x44488807,0x88333344
+	.word 0x00338538,0x00448143,0x00448043,0x89448143,0x44430533,0x43344333,0x33004480,0x33074489
+	.word 0x33444443,0x80444333,0x91448233,0x00888033,0x99888538,0xED380033,0xA1340033,0x34440133
+	.word 0x33E933FF,0x80888301,0x81830033,0x38880333,0x888E3333,0x33333803,0x00338038,0x03338038
+	.word 0x33888838,0x338B888D,0x33888803,0x89888B83,0x88880333,0x888D8333,0x83013384,0x01889433
+	.word 0x889E8333,0x88993800,0x88003381,0x88033380,0x80333388,0x80330088,0x89380088,0x00339188
+
+	.word 0x05338088,0x33333888,0x33FF3888,0x83003384,0x44803395,0x88883404,0x33804438,0x33918300
+	.word 0x48004485,0x33004480,0x33034480,0x89888833,0x00888133,0x95888083,0x08888033,0x38888838
+	.word 0x88333388,0x05338088,0x88333388,0x88803388,0x88848300,0x88033381,0x8C333338,0x85330088
+	.word 0x00338988,0x00338088,0x80338838,0x0233EB88,0x80444443,0x95430033,0x00448033,0x03448134
+	.word 0x48888833,0x43003393,0x8303448A,0x89444448,0x34440633,0x44443333,0x8C448A43,0x44440333
+	.word 0x448A4333,0x43033381,0x95333344,0x84338244,0x80840088,0x88440288,0x8D448A88,0x84440788
+	.word 0x44448888,0x44808884,0x44808800,0x88FF8400,0x330D88DD,0x33888833,0x38888833,0x38888833
+	.word 0x00888033,0x00888033,0x00888038,0xFF888138,0x8133FB33,0x80330088,0x33330388,0x33808888
+
+	.word 0x338D8800,0x33898891,0x38008880,0x380A8880,0x33388888,0x33338888,0x33808388,0x88888302
+	.word 0x83003380,0x88013399,0x00338188,0x0333FE88,0x88338883,0x88003399,0x33804480,0x338F8800
+	.word 0x33888805,0x81888883,0x8D888144,0x80380033,0x85888133,0x88330C44,0x33334444,0x33338888
+	.word 0x80338888,0x84830088,0x91448988,0x95448988,0x80440088,0xFF440088,0x0088D588,0x81889938
+	.word 0x88880333,0x88803333,0x88803300,0x88803300,0x88803300,0x88803800,0x88803800,0x33FF3800
+	.word 0x33BB33FF,0x99388301,0x8B830033,0xC5380033,0x81880033,0x93888033,0x88880233,0x08888433
+	.word 0x88833333,0x88888333,0x00888033,0x00888033,0xFF88FF83,0xA988FF88,0x99380088,0x00338588
+	.word 0x00338038,0x00338038,0x00338038,0x00338038,0x01338088,0x33BD3888,0x99888301,0xFF380033
+
+	.word 0x9D33FF33,0x88830633,0x83333388,0x00338088,0x89339188,0x80330088,0x80330088,0x33330788
+	.word 0x33338888,0x33808883,0x889688FF,0x33823800,0x3803888E,0x88383333,0x91888933,0x80888933
+	.word 0x8D830033,0x02888A33,0x8D833338,0x8D888D33,0x00888D33,0x89888033,0x00889133,0x85888033
+	.word 0x00889933,0x0588B733,0x33388838,0x33803833,0x33388810,0x33388833,0x33888833,0x33388833
+	.word 0x33933833,0x3333880C,0x33338883,0x33338883,0x33808883,0x33808300,0x33808800,0x3802889F
+	.word 0x88993333,0x88033381,0x80333388,0x80330088,0x8D380088,0x00338D88,0x00338038,0x07338088
+	.word 0x33333888,0x33338888
 
 	.section .rodata
 	.align	2
@@ -6,8 +6,8 @@
 @	title_1_flattened, 3368x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 421 tiles not compressed
-@	Total size: 512 + 13472 = 13984
+@	+ 421 tiles lz77 compressed, 13472 bytes raw
+@	Total size: 512 + 2848 = 3360
 @
 @	Time-stamp: 2021-04-06, 09:05:26
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,482 +17,109 @@
 
 	.section .rodata
 	.align	2
-	.global title_1_flattenedTiles		@ 13472 unsigned chars
+	.global title_1_flattenedTiles		@ 2848 unsigned chars
 	.hidden title_1_flattenedTiles
 title_1_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x88885555,0x77888555,0x88888855,0x88888885
-	.word 0x55555555,0x55555555,0x55555555,0x55588885,0x77777778,0x77777777,0x77777777,0x77777788
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55558877,0x55577777,0x55877787
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x88855555,0x88855555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x58888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x78777888,0x88778888,0x88788888,0x77788888,0x87788888,0x87888888,0x88888888,0x88888888
-	.word 0x55778887,0x55788887,0x58787777,0x58777887,0x58778888,0x88788888,0x88888888,0x88888888
-	.word 0x55555555,0x55555555,0x88885555,0x87778855,0x78888885,0x88888888,0x88888888,0x88888888
-	.word 0x55555555,0x55555555,0x55555588,0x55577777,0x55777777,0x55877777,0x58877888,0x88878888
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x85555555,0x88555555,0x88885555,0x88888555,0x88885555,0x88888888,0x88888888
-	.word 0x55555555,0x85555588,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x55555555,0x55555888,0x55888888,0x58888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x88885555,0x88885555,0x88888555,0x88888855
-	.word 0x88885555,0x88885555,0x88885555,0x88885555,0x88888555,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555558,0x88888588,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x88555555,0x88885555,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x55558885,0x55888888,0x58888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55588888,0x55588888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555558,0x55555555,0xCCCCCCCC
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x88888855,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x88885555,0x88885555,0x88888555,0x88888855,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x58888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x85555555,0x88555555,0x88555555,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAAAAAAC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAAAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x2CCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAACCCCCC,0xAAAAAACC,0xAAAAAAAC,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xACCCCCCC,0xAAAAAAAC,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xDAAAAAAA,0xDDAAAAAA,0xCDDDDAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xDDDDDAAA,0xCCDDDDDD,0xCCCCCCDD,0xCCCCCCCC
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xDDDDDDAA,0xCCCCDDDD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xDDDDDDDA,0xCCCCDDDD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xAAAAAAAA,0xDDDAAAAA,0xCCCDDDDD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCAA,0xCCDDDDDD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCC2CC,0xCCCCC2CC,0xCCCCC2CC,0xCCCCC2CC,0xCCCCC22C,0xCCCCC22C
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAACCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAAAAAAA,0xAAAAAAAC,0xADDCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAACCCCC,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCAAA,0xAAAAAAAA
-	.word 0x2CCCCCCC,0x2CCCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x222CCCCC,0x222CAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xDAAAAAAA,0xDDDAAAAA,0xDDDDAAAA,0xCDDDDAAA,0xCCCDDDDA
-	.word 0xAAAAAAAA,0xDDDAAAAA,0xDDDDDAAA,0xCCCDDDDD,0xCCCCCCCD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCDDDDD,0xCCCCCCDD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0x2CCCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x2222CCCC,0x22222CCC
-	.word 0xCCCC2222,0xCCCC2222,0xCCC22222,0xCCC22222,0xCCC22222,0xCCC22222,0xCCCC2222,0xCCC22222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xAAADDCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xAAAAAAAA,0xAAADDDCC,0xDCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAD,0xAADDDDCC,0xDDDCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAD,0xAAADDDDD,0xDDDDCCCC,0xDCCCCCCC
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAADD
-	.word 0x222AAAAA,0x222AAAAA,0x2222AAAA,0x22222AAA,0x222222AA,0x222222AA,0x222222AA,0x22222AAA
-	.word 0xDAAAAAAA,0xDDAAAAAA,0xDDAAAAAA,0xDDDAAAAA,0xDDDDAAAA,0xCDDDDAAA,0xCDDDDAAA,0xCCDDDAAA
-	.word 0xCCCCDDDD,0xCCCCCDDD,0xCCCCCCDD,0xCCCCCCCD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCC22CCCC,0xCC22CCCC,0xCC2CCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xECCCCCCC,0xEECCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xEEEEEEEC,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCEEE,0xCCCEEEEE,0xCCCEEEEE
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x22222CCC,0x22222CCC,0x22222CCC,0x22222CCC,0x2222222C,0x2222222C,0x22222222,0x22222222
-	.word 0xCCC22222,0xCCC22222,0xCCC22222,0xCCCC2222,0xCCCCC222,0xCCCC2222,0xCCCC2222,0xCCC22222
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xAAAADDDC,0xAAADDCCC,0xAADDCCCC,0xADDCCCCC,0xDDCCCCCC,0xDCCCCCCC,0xDCCCCCCC,0x2CCCCCCC
-	.word 0x2222222A,0x2222222A,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCDDDAA,0xCCCDDDAA,0xCCCDDDDA,0xCCCCDDDA,0xCCCCDDDA,0xCCCCDDDD,0xCCCCDDDD,0xCCCCCDDD
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xC22CCCCC,0xC22CCCCC,0x662CCCCC,0x662CCCCC,0x6222CCCC,0x6222CCCC,0x6622CCCC,0x6622CCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC6,0xCCCCCC66,0xCCCCCC66,0xCCCCCC66,0xCCCCCC66,0xCCCCC666
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xC11111CC,0x111111CC,0x11111CCC,0x111CCCCC,0x111111CC,0x111111CC,0x1111111C
-	.word 0xEECCCCCC,0xEEECCCCC,0xEEE11111,0xEEEE1111,0xEEEE1111,0xEEEE1111,0xEEEE1111,0xEEEE1111
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xCEEEEEEE,0xCCEEEEEE,0xCCCEEEEE
-
-	.word 0xCEEE7EEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEECCC,0xEEEECC8C,0xEEECCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCE,0xCCCCCCCE,0xCCCCCCCE,0xCCCCCCCE,0xCCCCCCCE
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x22222222,0x2222222C,0x2222222C,0x2222222C,0x2222222C,0x22222222,0x22222222,0x22222222
-	.word 0xCCC22222,0xCCC22222,0xCC222222,0xCC222222,0xCCC22222,0xCCC22222,0xCCCC2222,0xCCCC2222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x2CCCCCCC,0x2CCCCCCC,0x2CCCCCCC,0x2CCCCCCC,0x2CCCCCCC,0x2CCCCCCC,0x2CCCCCCC,0x2CCCCCCC
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCCDDD,0xCCCCCDDD,0xCCCCCDDD,0xCCCCCCDD,0xCCCCCCDD,0xCCCCCCDD,0xCCCCCCDD,0xCCCCCCDD
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x6622CCCC,0x6622CCCC,0x662CCCCC,0x662CCCCC,0x662CCCCC,0x2222CCCC,0x22222CCC,0x62222CCC
-	.word 0xCCCC6666,0xCCCC6666,0xCCCC6666,0xCCCC6666,0xCCCC6666,0xCCC66666,0xCC666662,0xCC666666
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33111111,0x3311111C,0x33311119,0x33311139
-	.word 0xEEE41111,0xEE441111,0x44441111,0x44499E41,0x44414EE4,0x4434EE43,0x439EEE43,0x334EE433
-	.word 0xCCCEEEEE,0xCCCEEEEE,0xCCCEEEEE,0xCCEEEE44,0xC4444444,0x44444444,0x44444444,0x44444443
-	.word 0xEEECCCCC,0xEEECCCCC,0x4EECCCCC,0x444ECCCC,0x14444CCC,0x93444444,0x43344444,0x43333444
-	.word 0xCCCCCCCE,0xCCCCCC14,0xCCCCC1E1,0x111114E4,0x111114EE,0x1111114E,0x11111144,0x11111114
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC1,0xCCCCC111,0x11111111,0x11111111,0x11111111
-	.word 0xCCCCCCCC,0x2CCCCCCC,0x22CCCCCC,0x222CCCCC,0x222CCCCC,0x222CCCCC,0x222CCCC1,0x222CC111
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCC222,0xCCCCCC22,0xCCCCCC22,0xCCCCC222,0xCCCCC222,0xCCC22222,0xCCC22222,0xCCC22222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x2CCCCCCC,0x2CCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC2,0xCCCCCCC2,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x2CCCCCCC,0x22CCCCCC,0x2222CCCC,0x2222CCCC,0x22222CCC,0x22222CCC,0x22222CCC,0x22222CCC
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCCCCD,0xCCCCCCCD,0xCCCCCCCD,0xCCCCCCCD,0xCCCCCCCD,0xCCCCCCCD,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCC2CC,0xCCCCC2CC,0xCCCCC22C,0xCCCC622C,0xCCCC622C
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x6222CCCC,0x6222CCCC,0x622CCCCC,0x622CCCCC,0x6222CCCC,0x22222CCC,0x22222CCC,0x22222CCC
-	.word 0xC6666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666662,0x66666662,0x66666622
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC6,0xCCCCCCC6,0xCCCCCCC6,0xCCCCCCC6,0xCCCCCCC6,0xCCCCCC66
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0x9CCCCCCC,0x99CCCCCC,0x999CCCCC,0x999CCCCC,0x999CCCCC,0x999CCCCC,0x9999CCCC,0x9999CCCC
-	.word 0x33111399,0x11113999,0x11139999,0x11339999,0x11333999,0x13399999,0x339B9999,0x39BBB999
-	.word 0x34444333,0x34E33111,0x33331111,0x11111111,0x11111111,0x11111111,0x11111113,0x11111333
-	.word 0x33333333,0x33333333,0x33333333,0x33331111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x11333333,0x11133333,0x11111133,0x11111111,0x71111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111177,0x11111771,0x77777117,0x77777777,0x77771111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111117,0x11111177
-	.word 0x222111C1,0x22111111,0x21111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222221,0x22211111,0x2111C111,0x11C11111,0x11111111
-	.word 0xCCC22222,0xCCCC2222,0xCCCC2222,0xCCCC2222,0xCCCC2222,0xCCCCC222,0xC1CCC221,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC1
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x22CCCCCC,0x2222CCCC,0x2222CCCC,0xC2222CCC,0xC2222CCC,0x222222CC,0x222222CC,0x222222CC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x2CCCCCCC,0x22CCCCCC
-	.word 0x22222CCC,0x222222CC,0x2222222C,0x2222222C,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCC2622C,0xCC26622C,0xCC6662CC,0xC26662CC,0xC26622CC,0xC26622CC,0xA266222C,0x2266222C
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCA,0xCCCCCAA2
-
-	.word 0x22222CCC,0x222222CC,0x2222222C,0x2222222C,0x222222CC,0x22222CCC,0x2222CCCC,0x222CCCCC
-	.word 0x66666662,0x66666662,0x66666662,0x66666622,0x66666622,0x66666222,0x66662222,0x66222222
-	.word 0xCCCCC666,0xCCC66666,0xCC666666,0xC2666666,0xC2666666,0xC2266666,0xC2226666,0xC2226666
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x9999CCCC,0x9999CCCC,0x9999CCCC,0x9999CCCC,0x9999B9CC,0x999BB9CC,0x999BB9CC,0x99BB999C
-	.word 0x9BBBB999,0xBBBBB999,0xBBBB9999,0x99999999,0xBB999999,0xBBBB9999,0xBBBB9999,0xBBBB9999
-
-	.word 0x11113339,0x11113399,0x11113999,0x1113399B,0x111399BB,0x11339BBB,0x33339BBB,0x339999BB
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111113
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77711111,0x77111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111777,0x11177777,0x11777777,0x77777777,0x77777771,0x77777771,0x77777711,0x77771111
-	.word 0x11111111,0x11111111,0x11111111,0x11111117,0x11111177,0x11117777,0x11177777,0x11777777
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0xCCCCCC11,0xCCCCC111,0xCCCC1111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCC1CC,0x21111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xC222222C,0xC2222222,0xC2222222,0xC2222222,0xC2222221,0xCC222211,0xCC111111,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC1
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC1
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x22662222,0x22662222,0x26222222,0x66222222,0x66222222,0x22222222,0x6222222C,0x222222CC
-	.word 0xCCCAAA22,0xCCAAAA22,0xAAAAA222,0xAAAAA222,0xAAAAA222,0xAAAAA222,0xAAAA2222,0xAAAA2222
-	.word 0x222CCCCC,0x222CCCCC,0x222CCCCC,0x222CCCAA,0x222CAAAA,0x222AAAAA,0x222AAAAA,0x22AAAAAA
-	.word 0x26662222,0x26622222,0x26622222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0xCC226662,0xCC226622,0xC2266622,0xC2266662,0x22666662,0xC2626622,0x22226222,0x26222222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC2,0xCCCCCCC2
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0x99CCCCCC,0x99CCCCCC,0x99CCCCCC,0x99CCCCCC,0x99CCCCCC,0x999CCCCC,0x999CCCCC
-	.word 0x99B99999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBB99999,0xBB999999,0xB9999999,0x99999999,0x99999999,0x99999999,0x99999999,0xBB999999
-	.word 0x3399999B,0x3399999B,0x3399999B,0x99999999,0x999B9999,0x9BBBBB99,0x9BBBBBBB,0x9BBBBBBB
-	.word 0x11111113,0x11111113,0x11111113,0x11111113,0x11111113,0x11111133,0x11111339,0x11113339
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77777777,0x77777777,0x77777111,0x77771111,0x77711111,0x71111111,0x11111111,0x11111111
-	.word 0x11111111,0x11177777,0x17777777,0x77777777,0x77777777,0x77777777,0x77771111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111777,0x17777777,0x77777777,0x77777777,0x77777711
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111117,0x11111777,0x11177777
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xC1111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCC11,0xC1111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC1,0xCCCCC111,0xCCCC1111,0xCCCC1111,0xCC111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x22222CCC,0x22222CCC,0x222222CC,0x222222CC,0x222222CC,0x2222222C,0x2222222C,0x2222222C
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x2CCCCCCC,0x2CCCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC
-	.word 0x2222222C,0x2222222C,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xAAAA2222,0xAAAA2222,0xAAA22222,0xAAA22222,0xAA222222,0xAA222222,0xAA222222,0xAA222222
-	.word 0x22AAAAAA,0x222AAAAA,0x222AAAAA,0x222AAAAA,0x222AAAAA,0x222AAAAA,0x2222AAAA,0x22222AAA
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCC222,0xACCCCC22,0xACCCCC22,0xAACAAC22,0xAAAAAC22,0xAAAAAA22,0xAAAAAA22,0xAAAAAA22
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCA,0xCCCCCCAA,0xCCCCCCAA,0xCCCCAAAA,0xCCCAAAAA,0xCAAAAAAA
-	.word 0x999CCCCC,0x9999CCCC,0x9999CCCC,0x9999CCCC,0x9999BB9C,0x999BBBB9,0x99BBBBB9,0x99BBBB99
-	.word 0x99B99999,0xBBB99999,0xB1139999,0xB1119999,0x11113999,0x11113999,0x11113999,0x11133999
-	.word 0xBBB99999,0xB9999999,0x9999999B,0x99999999,0x99999999,0x99999991,0x99999911,0x99999111
-	.word 0x9BBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBB9,0xBBBBBBB9,0xBBBBBB99,0xBBBB9999,0x99999999
-	.word 0x11113339,0x11133399,0x11133399,0x11333999,0x11333999,0x11333999,0x13339999,0x33399999
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77771111,0x77711111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77777777,0x77777777,0x77777771,0x77777711,0x77711111,0x71111111,0x11111111,0x11111111
-	.word 0x11111117,0x11111777,0x11111777,0x11117777,0x11777777,0x77777777,0x77777771,0x77777711
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111177,0x77777777
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111177
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xC1111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC1,0xCCCC1111,0xCCC11111,0xCC111111,0x11111111
-	.word 0x2222222C,0x2222222C,0x2222222C,0x2222222C,0x222222CC,0x222222CC,0x222222CC,0x22222CCC
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x222CCCCC,0x222CCCCC,0x2222CCCC
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xAA222222,0xAA222222,0xAA222222,0xAAA22222,0xAAA22222,0xAAA22222,0xAA222222,0xAA222222
-	.word 0x22222AAA,0x22222AAA,0x22222AAA,0x22222AAA,0x22222AAA,0x2222AAAA,0x22222AAA,0x222222AA
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xAAAAA222,0xAAAA2222,0xAAAA2222,0xAAA22222,0xAAA22222,0xAAA22222,0xAAA22222,0xAAA22222
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x9BAAAAAA,0xBB9AAAAA,0xB99AAAAA,0x999AAAAA,0x999AAAAA
-	.word 0x9BBB9999,0x99999999,0x99999999,0x99999999,0x99999999,0x9999999B,0x99999999,0x99999999
-
-	.word 0x11133999,0x1113399B,0x11113999,0x11111111,0x11111113,0x11111133,0x11111339,0x11133333
-	.word 0x99991111,0x99911111,0x99111111,0x91111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999911,0x99999911,0x99999111
-	.word 0x33399999,0x33999999,0x33999999,0x33999999,0x33999999,0x33999999,0x33999999,0x99999999
-	.word 0x11111111,0x11111113,0x11111333,0x11111333,0x11111333,0x11111333,0x11113333,0x11133333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77777111,0x77711111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77777777,0x77777777,0x77771111,0x77111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11117777,0x17777777,0x77777777,0x77777777,0x77777711,0x77777111,0x77711111,0x77111111
-	.word 0x11111111,0x11111111,0x11111117,0x11111777,0x11111777,0x11117777,0x77777777,0x77777777
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111117,0x11111177
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222C11,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222111,0x22111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x22222221,0x22222111,0x22221111,0x22111111,0x21111111
+	.word 0x0034A010,0xF0000032,0x55019001,0x8801D055,0x85558804,0x06007788,0x00C08588,0x85199003
+	.word 0x78555888,0x60775877,0x03008801,0x55553FF0,0x35008077,0x55577777,0xFF877787,0x01F01CF0
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0xF1012001,0x01F0FF71
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001
+	.word 0x01F001F0,0x01F001F0,0x91F10130,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001,0x3001F001
+	.word 0x03857B01,0xF0031045,0x58960301,0x01F00300,0x8801F080,0x78777888,0x77778888,0x0C200810
+	.word 0x00870300,0x20031008,0x03874401,0x788887EA,0x5878AF03,0x7778871F,0x03105700,0x01302B10
+	.word 0x550F7590,0x04877788,0x801C7013,0xDD08101F,0x1214F313,0x00F70377,0x87470066,0xF0FFBFF0
+
+	.word 0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x857F0150,0x4B020300,0x07209B26,0x28237F92,0x70BFF9F2,0x3120581F,0xDFC637F3,0x01F001F0
+	.word 0x50FF8320,0xC03F2087,0xF089F003,0xF001F001,0x0F6900B7,0xCCCCCCCC,0x1FF019F0,0x1FF001F0
+	.word 0xF01FF0E6,0xCC1FF01F,0x010710CC,0x28FF553E,0x201FF00C,0xF019711F,0xB01A501F,0xFD1F701D
+	.word 0x0E10E114,0x9BA10300,0x27105FF0,0xFF034058,0x01901FF0,0x1FF0AF10,0x1FF001F0,0x15F01FF0
+	.word 0xF01FF0FF,0xF01FF001,0xF01FF001,0xF01FF01F,0x01F0FF1F,0x01F01FF0,0x01F01FF0,0x01401FF0
+	.word 0xB3FF7FE1,0xF05FF213,0xF01FF001,0xF21FC01F,0xFF7F301F,0x60B21B44,0x5FF03FF0,0x1FF01FF0
+
+	.word 0x1FB019F0,0xF001F0FF,0xF001F001,0xF001F001,0xF001F001,0x01F0E101,0x015001F0,0xAAAAAAAC
+	.word 0x70F715F0,0xF01E0001,0xCA1FA01F,0x01F014F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001
+	.word 0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01F001F0,0xF001F0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0F101F0,0xF001F001,0xCC01F001
+	.word 0x0FC02CCC,0xF412AA7F,0x01501713,0x13801860,0x1A000190,0x2F90AC7A,0x01F001F0,0x00DA0100
+	.word 0xAA09DD03,0xF0CDDDDA,0x00DDDD19,0xDDCC3F01,0x310077F0,0xB0B01A20,0xE0E036B0,0xCD1D70B3
+	.word 0xF0201CF0,0x38F0CCCC,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0
+	.word 0x01F001F0,0x01F001F0,0x01F001F0,0xB0C2CC2F,0x03402C03,0x01F001F0,0xF0F701F0,0xF001F001
+
+	.word 0xAC017001,0x0180B7F5,0x359F1112,0xF0ADDCFB,0xF0CDB21D,0xF0FFE23B,0x1FF0DF5F,0xF0CA1FD0
+	.word 0x0623C01F,0x131F405A,0x0310A1A3,0x2C03B022,0x10AAAA22,0x01F0FF03,0x5D7301F0,0x48130B13
+	.word 0x02007B13,0x339F1F63,0xD3CCCD40,0xF3131025,0xF001F01D,0x01F0FF01,0x01F001F0,0x01F001F0
+	.word 0x01F001F0,0xF0FF01F0,0xF001F001,0xF001F001,0xF001F001,0xFF01F001,0x01F001F0,0x01F001F0
+	.word 0x01C001F0,0x03203BF2,0x0222222E,0x05002242,0x03000910,0x03C0FFC2,0x4EF01330,0x01F001F0
+	.word 0x01F001F0,0xF0E701F0,0xE001F001,0xF3ADDC01,0x23018043,0x20DD5A43,0x1DF0DC23,0x20ADAB73
+	.word 0x14F6DD27,0xD3EEA213,0xDD271040,0x34264F20,0x62F3F6DC,0x68030170,0x032A0100,0x220310A3
+	.word 0x0600225F,0x70060022,0x570F1003,0xFF03200B,0x03409B73,0xBA166520,0xC1F66C10,0x01F001F0
+
+	.word 0x7201F0FF,0xF0FED706,0xF001F001,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0
+	.word 0x00AC01F0,0x0300EC01,0x0016F0EE,0xEFEEEE18,0x1DF00160,0x00CE3400,0x10040003,0xFF1DF003
+	.word 0x01F001F0,0x01F001F0,0xA3030140,0xB2130390,0x60B623FF,0x03B3C301,0xF0D393B2,0xF001F050
+	.word 0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0xF0FB01F0,0xF001F001,0xF001F001,0x7103DC01
+	.word 0x23F54334,0x230F18FB,0x2C0340D7,0x1022A203,0x01F0DF03,0x17AA0130,0x17030043,0x20AE034B
+	.word 0xB323FE03,0x01F0B743,0x01F001F0,0x49590190,0x30664F2C,0x40622203,0x000B1003,0x7F013003
+	.word 0x100300C6,0x1003A00C,0xF001F014,0xFC01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x1111CCCC
+	.word 0x0300C111,0x001CCC11,0x0400FC03,0x03000B20,0x0F000E00,0xEEECA313,0xE1111117,0xE0EE0300
+
+	.word 0x2001F003,0x13CE6E01,0x7EA323BA,0x01A00B20,0xFF8CE013,0x57101D00,0xCD138690,0x01F003D0
+	.word 0x01F001F0,0x120170FB,0xF3B35323,0x22BF93BB,0x7F970340,0xF04FF0FF,0xF001F001,0xF001F001
+	.word 0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x01F001F0,0x20FF01F0,0xF01F5B01,0xF03D2503
+	.word 0x27019001,0xFF03505B,0x03D03000,0x01F001F0,0x019001F0,0xBF53A753,0x55C323CC,0x006662CF
+	.word 0xC603F00D,0x1810BFCC,0xF00C1066,0xF001F001,0xF001F001,0x01F0FD01,0x01F001F0,0xA20301C0
+	.word 0x033301D0,0x193302B7,0x39333111,0x28110300,0xA703E411,0x44031044,0x49009E41,0x414EE444
+	.word 0x40EE4344,0x9E030034,0x4EE43343,0x4757D033,0x03440310,0x44444492,0x0300DCC4,0x00430120
+	.word 0x20A33303,0x01CC4E03,0xCC444ECC,0x0014444C,0x44930016,0x44433444,0x43503334,0x0014A313
+
+	.word 0xCCC1E103,0x14E435CC,0x03001104,0x4484004E,0x00F70300,0x603F140A,0xCC220001,0xB3A06904
+	.word 0x4BA91A40,0x03602C23,0x110300C1,0xFF3EF2C1,0x548BBEF3,0x7F270B10,0x31F19377,0x01F001F0
+	.word 0xF001F0FF,0xE0E36201,0xF0865F01,0xF001F001,0x01F0FF01,0x01F001F0,0x01F001F0,0x012001F0
+	.word 0x44FF7B41,0xF0EFC8F1,0x1701B001,0xF003F062,0xFF012064,0x4D271841,0x03104107,0x01D001F0
+	.word 0x31506F57,0x800B00EF,0xC6A3039F,0x01A00300,0x0320BB03,0x501C10FF,0xD08A1745,0xF0DDF303
+	.word 0xF001F001,0x01F0D601,0x009C01A0,0x06009903,0x809903C0,0x13990320,0x39993311,0x10114011
+	.word 0x33999908,0x80399911,0x39990300,0x9B999913,0xB9990433,0x033339BB,0x3B311165,0xD20334E3
+	.word 0x0170CB03,0x00E81313,0x33333D04,0x23D00170,0x1A400C24,0xA22C0033,0xF4711C80,0x77111136
+
+	.word 0x03171810,0x71171111,0x01107777,0x10F81100,0x0001F012,0x20260001,0x2111C12F,0x0600226E
+	.word 0xF0210310,0x82180025,0x00F7212B,0x03260003,0xC12B10D7,0x6B771F40,0x028F0360,0xCCC2211F
+	.word 0x4EF12020,0x4F140170,0xE001F0EF,0xC2DB9201,0xEC770320,0x01F0E1F7,0xF001F0FF,0xF001F001
+	.word 0xF001F001,0xF001F001,0x0150FF01,0x0713B733,0x01F0DBF8,0x012001F0,0xC0A356F0,0x32016264
+	.word 0x07CC2662,0xC3031010,0x03303B01,0xA266222C,0x3FF00300,0xCA0140AF,0x10A20300,0x219FC004
+	.word 0xFF131073,0x80279321,0x0320AFA3,0xD9130C00,0x8A172A00,0x138F27EA,0xC20300CA,0x00260330
+	.word 0x20FF2203,0xF079F003,0xF001F001,0x5001F001,0xA8A73301,0x10B90360,0x03209B03,0x5FBB999C
+	.word 0x9BA30399,0x08000300,0x01200310,0x30D80B40,0x11CE0303,0xD703D603,0x089B1111,0xBB111339
+
+	.word 0x9BBBE703,0x0310BE33,0xE3200033,0xF0E3D3AF,0x7101D001,0xF38613EB,0x770140A7,0x0077A803
+	.word 0xFFCE1304,0xDA13D313,0x10200310,0xD353DFC3,0x33301930,0xF051F0FF,0x8001F001,0x37410101
+	.word 0x40ABF8F3,0x0130F71E,0x43E41738,0x17C22A02,0x040350E5,0x04C27F43,0xF4A25C34,0xF401801F
+	.word 0xF01FF01F,0x01F0FF01,0x01F001F0,0x016001F0,0x03F09E68,0xF0FF9E2C,0xF001F001,0xF0BFF301
+	.word 0x23602001,0x742A1046,0x20084026,0x6257010C,0xCAAA7D20,0x0F22CC21,0xAAA22282,0xEA03A0AA
+	.word 0x03101400,0x10AA9399,0x0310AA03,0x0340CB2A,0x66222200,0x40625700,0x7301F003,0x14220462
+	.word 0xC2260026,0x13032062,0xC2620FDA,0x1E206222,0x01F05804,0xF9FF0110,0x8001F043,0xD09B0301
+	.word 0x03673703,0xDE9643A0,0x013001F0,0x10B713B9,0x0028F003,0x03F09B17,0x300350A3,0xBB090012
+
+	.word 0xFBBB9BBB,0xA3130340,0xD41303D0,0x1311EA03,0xFD01F0FB,0x01F001F0,0x84F301A0,0xAA371C90
+	.word 0xF7060477,0x0F24CF43,0xCB43DFA7,0xF72B5017,0xFF2740DB,0x27702B24,0x013000F4,0x57442724
+	.word 0x01F01DF0,0xF001F0FF,0x6001F001,0xF0283801,0x11012001,0x6324FFFC,0x1F6027F0,0x7F7C0150
+	.word 0x49F28F64,0x5AFF01D0,0x86BB566B,0xF06FF7CB,0xF301F001,0xFA6D90BF,0x1F640340,0x01D067F0
+	.word 0x40A2AB53,0xA0FB2203,0x73A31303,0x000390AF,0x4DF02A1C,0xF0E801F0,0x3D01A001,0x0320AC7F
+	.word 0x3FAACAAC,0x7020AC22,0xD8500360,0x0C100A18,0x00BE0320,0x7704AA04,0x16001E00,0x03100B7B
+	.word 0x52E7E09C,0xA3139613,0x9999B113,0x2BB17E11,0x1B03602B,0x07BF2333,0x91B4738D,0x000300CF
+	.word 0x00119918,0x20A74308,0xFF530001,0x14100320,0x9F37AF57,0x03104700,0x03507B1B,0x301000FF
+
+	.word 0xF001F01D,0xF001F001,0xF001F001,0x01F0FF01,0x01D001F0,0x01F0F363,0x01301D20,0xB4FFF377
+	.word 0x23CB631F,0x682F20CF,0x80FFF327,0xFF5B4057,0x23B019F0,0x01F001F0,0x01A001F0,0x0180D7F3
+	.word 0x23DFE3DF,0x1F68C1D7,0x7F6AAB93,0x58F30350,0xF001F0FF,0x9301A001,0x570370AB,0xF02FF033
+	.word 0xAF93FF01,0xC773C353,0x03E0A313,0x2010BB43,0xF0FF01F0,0x8001F001,0xB0EB8701,0x1403307F
+	.word 0x05018040,0x9AAAAA9B,0xB90300BB,0x997F0300,0x22370310,0x10A001B0,0xF71AA303,0x10F7AF13
+	.word 0x1E1F9701,0x11F91E93,0x0810A803,0x917F0300,0x92F7DFD1,0xDF43DB43,0x0400A313,0x47FF03F0
+	.word 0x107360AF,0x2F03906F,0xF061FB2D,0xFF01F001,0x01F001F0,0x01F001F0,0x01F001F0,0x01C001F0
+	.word 0xF3F727FF,0xC70150FF,0x33F3F7EF,0x70F3B7F3,0x2F60FF53,0x575027F4,0x2F6001F0,0x01F016F0
+
+	.word 0xB0FB01F0,0xF0A30301,0x12017014,0x140C11C2,0xF0FC0A10,0x501F301D,0x40260001,0x212F602B
 
 	.section .rodata
 	.align	2
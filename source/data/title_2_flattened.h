@@ -6,8 +6,8 @@
 //	title_2_flattened, 3368x8@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 421 tiles not compressed
-//	Total size: 512 + 13472 = 13984
+//	+ 421 tiles rle compressed, 13472 bytes raw
+//	Total size: 512 + 2164 = 2676
 //
 //	Time-stamp: 2021-04-06, 09:05:26
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_TITLE_2_FLATTENED_H
 #define GRIT_TITLE_2_FLATTENED_H
 
-#define title_2_flattenedTilesLen 13472
-extern const unsigned int title_2_flattenedTiles[3368];
+#define title_2_flattenedTilesLen 2164
+extern const unsigned int title_2_flattenedTiles[541];
 
 #define title_2_flattenedPalLen 512
 extern const unsigned short title_2_flattenedPal[256];
@@ -6,8 +6,8 @@
 @	title_2_flattened, 3368x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 421 tiles not compressed
-@	Total size: 512 + 13472 = 13984
+@	+ 421 tiles rle compressed, 13472 bytes raw
+@	Total size: 512 + 2164 = 2676
 @
 @	Time-stamp: 2021-04-06, 09:05:26
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,482 +17,85 @@
 
 	.section .rodata
 	.align	2
-	.global title_2_flattenedTiles		@ 13472 unsigned chars
+	.global title_2_flattenedTiles		@ 2164 unsigned chars
 	.hidden title_2_flattenedTiles
 title_2_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99499999,0x44999999,0x49999999,0x44449999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999994,0x99999994
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999299,0x99999999,0x99999999,0x92999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x29999999,0x29999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999992,0x99999992,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999499,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99944999,0x99994999,0x99994999,0x99944999,0x99949999,0x99449999,0x44499999,0x94499999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x44444449,0x99999944,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999944,0x99999449,0x99994499
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x89999999,0x99999999,0x99999999,0x99999999,0x99998899
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99929999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x49999999,0x44999999
-	.word 0x99994999,0x99994999,0x99994999,0x99994499,0x99999949,0x99999994,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99949999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x88889999,0x98888889,0x99988888
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99998999,0x99999988,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999998,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x69999999,0x66899999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x66668999,0x88666668,0x88886666,0x98888866
-	.word 0x99999999,0x99999999,0x98889999,0x99988889,0x99999888,0x99999988,0x99999999,0x99999999
-	.word 0x99999988,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99949999,0x99949999,0x49949999,0x44449999,0x94499999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999994,0x99999949,0xCC999999
-	.word 0x99999999,0x99999999,0x99999999,0xCC999999,0xCCCCC999,0xCCCCCCC9,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x99999999,0x99999999,0x99999999,0x9CCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x999999CC,0x9999CCCC,0x9999CCCC,0x9999CCCC
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99989999,0x99999899
-	.word 0x99999999,0x88999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999988,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x88999999,0x99999999,0x99998899
-	.word 0x86669999,0x88888999,0x99888899,0x99998888,0x99999998,0x99999999,0x99999999,0x99999999
-	.word 0x99988888,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x66999999,0x66669999,0x66666999,0x66666699,0x66666669
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xCC999999,0xCCC99999,0xCCC99999,0xCCC99999,0xCCC99999,0xCC999999,0x93999999,0x99999999
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x9CCCCCCC,0x33333333
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x33CCCCCC,0x93339CCC,0x99933333,0x99999933
-	.word 0x9999CCCC,0x99993CCC,0x9999339C,0x99999333,0x99999993,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x9AAAA999,0xAAAAA299,0xAAA22229,0xAA277729,0xAA777729
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x9999999A,0x9999999A,0x9999999A,0x9999999A
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x88899999,0x88888999,0x98888899
-	.word 0x99999999,0x89999999,0x98899999,0x99888899,0x99998888,0x99999888,0x99999999,0x99999999
-	.word 0x99999889,0x99999998,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0xAA229999,0x22222999,0x22222299,0x77772299,0x77777299
-	.word 0x99999999,0x99999999,0x99999999,0x9999999A,0x999999A2,0x99999222,0x99999222,0x99999227
-	.word 0x99999899,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999993,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x69999999,0x66999999,0x66699999,0x66669999,0x66666999,0x66666669,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x88999999,0x89999999
-	.word 0xA277D729,0x22777299,0x92222999,0xBB999999,0xBB588899,0xBB588889,0xBB558888,0xBB558888
-	.word 0x9999999A,0x99999999,0x88888899,0x888888BB,0x8888BBBB,0x988BBBBB,0x9BBBBBBB,0x9BBBBBBB
-	.word 0x99988889,0x99998888,0x99999888,0x99999988,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x7DD77299,0x7DD77299,0x77772299,0x22222999,0x79999999,0x75559999,0x55555999,0x55555999
-	.word 0x99999227,0x99999227,0x99999922,0x99999992,0x99999997,0x99995557,0x99955557,0x99555555
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x39999999,0x33399999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x93339999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x69999999,0x66999999,0x66669999,0x66666999
-	.word 0x66999999,0x66669999,0x66666699,0x66666669,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x89999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x88888899,0x88888888
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x88888889,0x88888888,0x88888888
-	.word 0x99999999,0x99999999,0x99999999,0x89999999,0x88888899,0x88888888,0x88888888,0x88888888
-
-	.word 0x99999999,0x89999999,0x88888999,0x88888888,0x88888888,0x88888888,0x88888888,0x99999888
-	.word 0x99999999,0x99999988,0x99999988,0x99999988,0x99999988,0x99999988,0x99999999,0x99999999
-	.word 0xBB558889,0xB5558889,0x55558889,0x55599989,0x55599999,0x55599999,0x55599999,0x55599999
-	.word 0x555BBBBB,0x5555BBBB,0x55555555,0x55555555,0x55555555,0x55555555,0x99555555,0x99775555
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x55555999,0x55555599,0x55555599,0x55555599,0x55555999,0x55555599,0x55555599,0x55555599
-	.word 0x99555555,0x95555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x39999995,0x33999995,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x39999993,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999939,0x99999933,0x99999993,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x66999999,0x66669999
-	.word 0x99999999,0x69999999,0x66699999,0x66666999,0x66666669,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x88888899
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x88889999,0x88888888,0x88888888
-
-	.word 0x99999999,0x88999999,0x88888999,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888899,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x99999888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x98888888,0x99988888,0x99999998,0x99999999
-	.word 0x88888888,0x88888888,0x88888888,0x99999988,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x88888888,0x99988888,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x55599999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99779977,0x97799977,0x97799977,0x97999779,0x97999779,0x97999779,0x99999799,0x99999799
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x55555599,0x55555999,0x55559999,0x99779999,0x99779999,0x99777999,0x99777999,0x99977999
-	.word 0x95555555,0x99555555,0x99995559,0x99997779,0x99997779,0x99997799,0x99997799,0x99997999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99993339,0x99999333,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x66999999,0x66669999,0x66666699,0x66666669,0x66666666
-	.word 0x66666669,0x66666666,0x66666666,0x66666666,0x76666666,0x77666666,0x77766666,0x77766666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666677,0x66666777,0x66667777,0x66667777
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99988888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x99999999,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88889999,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x98888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x98888888,0x99999998,0x99999999
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x99988888,0x99999999,0x99999999,0x99999999
-	.word 0x88888888,0x88888888,0x99988888,0x99999988,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99998888,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999989,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99979999,0x99979999,0x99979999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99997999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x66999999,0x66666999,0x66666669,0x66666666
-	.word 0x66999999,0x66669999,0x66666999,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x77766666,0x77766666,0x99766666,0x99766666,0x7776EEE6,0x777EEEE6,0x77EEEEEE,0x66EEEEEE
-	.word 0x66677777,0x66677777,0x66677777,0x66677777,0x66677777,0x66667777,0x66611777,0x67711116
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x88888888,0x88888888,0x88888888,0x98888888,0x99988899,0x99999999,0x99999999,0x99999999
-
-	.word 0x88888888,0x88888888,0x88888888,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99998888,0x99999998,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x88999999,0x88889999
-	.word 0x99999999,0x99999999,0x99999999,0x66899999,0x66666899,0x66666666,0x88888888,0x88888888
-	.word 0x99999999,0x99999999,0x99999999,0x88666666,0x88886666,0x88888886,0x88888888,0x99999888
-	.word 0x99999999,0x88899999,0x88888899,0x99888866,0x99998888,0x99999988,0x99999999,0x99999999
-
-	.word 0x99988888,0x99999988,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x69999999,0x66669999
-	.word 0x69999999,0x66699999,0x66669999,0x66666999,0x66666669,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x6EEEEEEE,0x6EEEEEE6,0xEEEEEEE6,0xEEEEEE66,0xEEEEE666,0xEEEEE611,0xEEEEE111,0xEEE111E6
-
-	.word 0x77711166,0x77771766,0x777711EE,0x7777771E,0x7777771E,0x7777711E,0x7777111E,0x7771111E
-	.word 0x66666667,0x66666777,0x66667777,0x66677777,0x66777777,0x67777777,0x77777777,0x77777777
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666677
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x88899999,0x88669999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x98888888,0x99988888,0x99999998
-	.word 0x99999999,0x99999999,0x88999999,0x98899999,0x99888999,0x99999999,0x99999999,0x99999999
-	.word 0x88888999,0x99888888,0x99999988,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999888,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x69999999,0x66999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x66669999,0x66666669,0x66666666,0x66666666
-	.word 0x99999999,0x69999999,0x66669999,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666699,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0xE1111E66,0x1111EE66,0x111EE666,0x11EE6666,0x11E66666,0xEEE66666,0xEE666666,0xE6666666
-	.word 0x7111111E,0x11111111,0x11111111,0x11117711,0x11117711,0x11111EEE,0x11111EEE,0x111111EE
-	.word 0x77777777,0x77777771,0x77777771,0x77777771,0x77777771,0x77777711,0x77777711,0x77777111
-
-	.word 0x66666677,0x66666677,0x66666777,0x66666777,0x66667777,0x66677777,0x66777777,0x66777777
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99888999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x69999999
-	.word 0x99999999,0x99999999,0x99999999,0x69999999,0x66699999,0x66669999,0x66666669,0x66666666
-	.word 0x66699999,0x66666699,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x11111166,0x11111116,0x11EEE666,0xEEE66666,0xE6666666,0x66666666
-	.word 0x111111EE,0x11711111,0x17711111,0x177E1111,0x17EEEE11,0x11EEEEEE,0x11EEEEEE,0x111EEE66
-	.word 0x77777711,0x77777711,0x77777711,0x77777771,0x77777771,0x77777711,0x77777711,0x77777711
-	.word 0x66777777,0x67777777,0x66777777,0x66777777,0x66777777,0x66777777,0x66677777,0x66677777
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x66699999,0x66666699
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x66669999,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x66669999,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66669999,0x66666669,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x111EE666,0x111EE666,0x11111666,0x11116666,0x11166666,0x16666666,0x66666666,0x66666666
-	.word 0x77777711,0x777777EE,0x777777EE,0x17777E11,0x67776111,0x66666111,0x66661111,0x66611116
-	.word 0x66667777,0x66666777,0x66661117,0x66611111,0x66111116,0x61111666,0x11116666,0x11166666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666661
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x66699999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x69999999,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x66999999,0x66666666,0x66666666
-
-	.word 0x99999999,0x99999999,0x99999999,0x66999999,0x66666699,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x66669999,0x66666699,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66111666,0x11116666,0x11666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x11666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666611,0x66666111,0x66661116,0x66611166,0x66611666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
+	.word 0x0034A030,0x99CF009D,0x99814900,0x99804400,0x99994904,0x99954444,0x99809400,0x99FF9400
+	.word 0x00FF99DE,0x00F900FF,0x920099A6,0x9200998A,0x290099B4,0x29009980,0x92009995,0x92009980
+	.word 0x940099F9,0x49049990,0x49999994,0x49009980,0x49019980,0x00998094,0x00998094,0x05998044
+	.word 0x99994449,0x99919449,0x44814900,0x44009998,0x49019980,0x00998094,0xFF99FF44,0xFF99FF99
+	.word 0x8499FF99,0x8A890099,0xED880099,0xFF920099,0x00998799,0x02998049,0x80499944,0x80490099
+	.word 0x80490099,0x99440399,0x99804999,0x999E9400,0x99FF9400,0x99FF99FF,0x880899B6,0x88888988
+	.word 0x98888898,0x8903998F,0x90889999,0xAB980099,0x80890099,0x99690499,0x8E668999,0x66890E99
+	.word 0x66666866,0x88666688,0x88886688,0x0A998798,0x88899888,0x98889998,0x88889999,0xFF880099
+
+	.word 0x0099C899,0x00998094,0x09998094,0x99994994,0x99994444,0x99919449,0x99809400,0x99834900
+	.word 0x998CCC00,0xC999CC05,0x88C9CCCC,0x809989CC,0x8D9C00CC,0x00998DCC,0x099980CC,0x9999CCCC
+	.word 0x9999CCCC,0x99FFCCCC,0x99F599FF,0x99999803,0x00998698,0x00999588,0x0099CF88,0x00998089
+	.word 0x00998288,0x0E998188,0x89998666,0x88998888,0x88889988,0x8C989999,0x88880299,0xC799FF98
+	.word 0x99660999,0x99666699,0x99666669,0x69006680,0x99C06680,0x9999CC10,0x9999CCC9,0x9999CCC9
+	.word 0x9999CCC9,0x9980CCC9,0x9980CC00,0x99819300,0x9C00CC98,0xCC903381,0x9CCC3309,0x33339333
+	.word 0x80339993,0xCCCC1099,0x3CCC9999,0x339C9999,0x93339999,0xFF939999,0x1299F799,0x999AAAA9
+	.word 0x29AAAAA2,0x29AAA222,0x29AA2777,0x8DAA7777,0x809A0099,0x809A0099,0x809A0099,0x939A0099
+
+	.word 0x99890C99,0x99888999,0x99888889,0x84988888,0x99890E99,0x99988999,0x88998888,0x88999988
+	.word 0x04998798,0x99999889,0x0699C698,0x2999AA22,0x80992222,0x22990722,0x72997777,0x99897777
+	.word 0x99809A00,0x9980A200,0x99922209,0x99922299,0x80922799,0xFF980099,0x00998D99,0x0099CF93
+	.word 0x0D998069,0x69999966,0x66999966,0x66699966,0x66A46966,0x99FF99FF,0x999299FF,0x99808800
+	.word 0xD729890C,0x7299A277,0x29992277,0x99809222,0x8899BB11,0x8889BB58,0x8888BB58,0x8888BB55
+	.word 0x859ABB55,0x00888099,0x078880BB,0x8888BBBB,0x988BBBBB,0x9B00BB80,0x9B0DBB80,0x99988889
+	.word 0x99998888,0x99999888,0x0E99F188,0x997DD772,0x997DD772,0x99777722,0x80222229,0x99791599
+	.word 0x99755599,0x99555559,0x27555559,0x27999992,0x22999992,0x92009980,0x97009980,0x57079980
+
+	.word 0x57999955,0x80999555,0x0499D155,0x39999939,0x01998F33,0x99C49333,0x99806900,0x99996608
+	.word 0x69996666,0x99806666,0x99996605,0x80996666,0xD0690066,0xFA99FF66,0x96890099,0x91888499
+	.word 0x88890099,0x01998C88,0x888C9989,0x89029984,0x88908999,0x99839800,0x99808800,0x99808800
+	.word 0x99808800,0x99808800,0x99888800,0x55888925,0x558889BB,0x558889B5,0x59998955,0x59999955
+	.word 0x59999955,0x59999955,0x59999955,0x5BBBBB55,0x92BBBB55,0x55990355,0x99FF7755,0x55555903
+	.word 0x00558099,0x00558099,0x04558099,0x55555999,0x00558099,0x00558099,0x00558399,0x00558099
+	.word 0x91559595,0x99950799,0x99953999,0x99953399,0x99999303,0x00999139,0x00998039,0x00998033
+	.word 0x0499A393,0x66999966,0x09998466,0x69999969,0x66699966,0x66FF6966,0x99F8668A,0x80998901
+
+	.word 0x02999088,0x87999989,0x02998488,0x93899988,0xB9990088,0x99980288,0x05889099,0x98888898
+	.word 0x99849899,0x9990888A,0x98008883,0x590199D8,0x19999955,0x99779977,0x97799977,0x97799977
+	.word 0x97999779,0x97999779,0x97999779,0x99809799,0x99FF9700,0x55809900,0x5559990A,0x55999955
+	.word 0x77999955,0x770D9980,0x77799999,0x77799999,0x97799999,0x00558099,0x0A558095,0x99555999
+	.word 0x99777999,0x80777999,0x80770099,0x80770099,0x8F790099,0x33390599,0x93339999,0x660599B6
+	.word 0x66669999,0x00668099,0x00668469,0x00668F69,0x08668076,0x76666677,0x76666677,0x00668D77
+	.word 0x09668077,0x66666777,0x66667777,0x66FF7777,0x88039981,0x95999888,0x99998188,0x99990188
+	.word 0x9800889A,0x98018894,0x8F998498,0x8A980088,0x02888799,0x90889998,0x88880199,0x890099F6
+
+	.word 0x89009999,0x99FF99FF,0x97009982,0x97009980,0x97009980,0x79009993,0x660599AE,0x66666999
+	.word 0x80668469,0x99660699,0x99666699,0x1566B569,0x66667776,0x66667776,0x66669976,0xEEE69976
+	.word 0xEEE67776,0xEE80777E,0xEE807700,0x77776620,0x77776667,0x77776667,0x77776667,0x77776667
+	.word 0x77776667,0x17776666,0x11166661,0x66FD6771,0x9803888C,0x8A988899,0x91888999,0x88880499
+	.word 0xF3989999,0x99880499,0x8B888899,0x66890399,0x66836899,0x99898885,0x88056680,0x88886666
+	.word 0x00888586,0x02998598,0x80998889,0x88660888,0x88889988,0x88889999,0x88880499,0xFF889998
+	.word 0xCF99FF99,0x99690499,0x80666699,0x99690D99,0x99666999,0x99666699,0x69666669,0xEE8066EC
+	.word 0xEEE66E05,0x80E66EEE,0x806600EE,0xE6661CEE,0xE611EEEE,0xE111EEEE,0x11E6EEEE,0x1166EEE1
+
+	.word 0x17667771,0x11EE7777,0x801E7777,0x801E0077,0x711E0C77,0x111E7777,0x111E7777,0x80677771
+	.word 0x67770B66,0x77776666,0x77776666,0x77806667,0x77806600,0x77856700,0x77006699,0x99D766C0
+	.word 0x99888905,0x91886699,0x05888099,0x98888898,0x998B9899,0x99998807,0x89999889,0x00998B88
+	.word 0x01888289,0x99948899,0xFF988801,0xD299FF99,0x80690099,0x8F660099,0x66660299,0x84668869
+	.word 0x99690299,0x00669399,0x9B66FF99,0x111E1666,0x11EE66E1,0x1EE66611,0xEE666611,0xE6666611
+	.word 0xE6666611,0x006680EE,0x046680EE,0x11111EE6,0x00118671,0x0B118077,0xEE111177,0xEE11111E
+	.word 0xEE11111E,0x77811180,0x77807100,0x77807100,0x77807100,0x77807100,0x77801100,0x77801100
+	.word 0x80711101,0x00668077,0x0F668077,0x66666777,0x66666777,0x66667777,0x66677777,0x66007780
+
+	.word 0x66BE7780,0x89009990,0x890199AA,0xFF99FF88,0x9399FF99,0x8C690099,0x99690999,0x99666999
+	.word 0x69666699,0x99046684,0x99666999,0x66FF66FF,0x16001180,0x66071180,0x6611EEE6,0x80EEE666
+	.word 0x81E60066,0x82EE0066,0x80710011,0x17710911,0x177E1111,0x17EEEE11,0x1100EE80,0x1105EE80
+	.word 0x111EEE66,0x00778011,0x00778011,0x00778011,0x00778071,0x00778071,0x00778011,0x00778011
+	.word 0x00778311,0x00778066,0x00778067,0x00778066,0x00778066,0x07778066,0x67777766,0x67777766
+	.word 0x99FF66BE,0x99F399FF,0x99666902,0x998F6680,0x9987668B,0x99046693,0x69666699,0x66FF66FF
+	.word 0xE61266D5,0xE666111E,0x1666111E,0x66661111,0x66661111,0x66801116,0x66851600,0x77801100
+	.word 0x7780EE00,0x7780EE00,0x777E1133,0x77611117,0x66611167,0x66111166,0x61111666,0x66777766
+
+	.word 0x66677766,0x66111766,0x61111166,0x11111666,0x11166666,0x11666661,0x16666611,0x00669911
+	.word 0xFF66A061,0x0199D999,0x99986669,0x66816900,0x66869994,0x6601998C,0x83668C99,0x66660299
+	.word 0xFF66FF99,0xEF66FF66,0x11160166,0x11016680,0x00668011,0x00669411,0x00669911,0x05668011
+	.word 0x66666111,0x66801116,0x66611105,0xAA611666,0x00000066
 
 	.section .rodata
 	.align	2
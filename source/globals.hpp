@@ -15,7 +15,9 @@ struct BlindJumpGlobalData {
     Game::EffectGroup::Pool_ effect_pool_;
     Game::EffectGroup::NodePool_ effect_node_pool_;
 
-    Bitmatrix<TileMap::width, TileMap::height> visited_;
+    // NOTE: Bitmatrix wants a width divisible by eight, so round up, in case
+    // the build configures an unusual map width.
+    Bitmatrix<(TileMap::width + 7) / 8 * 8, TileMap::height> visited_;
 };
 
 
@@ -33,17 +33,14 @@ Text::Text(Platform& pfrm,
 
 void Text::erase()
 {
+    static const TileDesc blank[32] = {};
+
     if (not config_.double_size_) {
-        for (int i = 0; i < len_; ++i) {
-            pfrm_.set_tile(Layer::overlay, coord_.x + i, coord_.y, 0);
-        }
+        pfrm_.set_tiles(coord_.x, coord_.y, blank, std::min(int(len_), 32));
     } else {
-        for (int i = 0; i < len_ * 2; ++i) {
-            pfrm_.set_tile(Layer::overlay, coord_.x + i, coord_.y, 0);
-        }
-        for (int i = 0; i < len_ * 2; ++i) {
-            pfrm_.set_tile(Layer::overlay, coord_.x + i, coord_.y + 1, 0);
-        }
+        const auto width = std::min(len_ * 2, 32);
+        pfrm_.set_tiles(coord_.x, coord_.y, blank, width);
+        pfrm_.set_tiles(coord_.x, coord_.y + 1, blank, width);
     }
 
     len_ = 0;
@@ -77,56 +74,67 @@ Platform::TextureCpMapper locale_texture_map();
 Platform::TextureCpMapper locale_doublesize_texture_map();
 
 
+// Maps a double size glyph, returning its top left, top right, bottom left, and
+// bottom right tiles.
+static std::array<TileDesc, 4> double_char_tiles(Platform& pfrm,
+                                                 utf8::Codepoint c)
+{
+    const auto mapping_info = locale_doublesize_texture_map()(c);
+
+    u16 t0 = 495;
+    u16 t1 = 495;
+    u16 t2 = 495;
+    u16 t3 = 495;
+
+    if (mapping_info) {
+        auto info = *mapping_info;
+
+        // FIXME: these special cases should be handled in the texture map
+        // lookup.
+        if (info.offset_ == 72) {
+            t0 = pfrm.map_glyph(c, info);
+            // Special case for space character
+            t1 = t0;
+            t2 = t0;
+            t3 = t0;
+        } else if (info.offset_ == 65) {
+            // Special case for enlarged quote character
+            info.offset_ = 523;
+            t0 = pfrm.map_glyph(c, info);
+            info.offset_ = 524;
+            t1 = pfrm.map_glyph(c, info);
+            info.offset_ = 72; // space
+            t2 = pfrm.map_glyph(c, info);
+            t3 = pfrm.map_glyph(c, info);
+        } else if (info.offset_ == 38 or info.offset_ == 37) {
+            // Special case for period, comma
+            t2 = pfrm.map_glyph(c, info);
+            info.offset_ = 72; // space
+            t0 = pfrm.map_glyph(c, info);
+            t1 = pfrm.map_glyph(c, info);
+            t3 = pfrm.map_glyph(c, info);
+        } else {
+            t0 = pfrm.map_glyph(c, info);
+            info.offset_++;
+            t1 = pfrm.map_glyph(c, info);
+            info.offset_++;
+            t2 = pfrm.map_glyph(c, info);
+            info.offset_++;
+            t3 = pfrm.map_glyph(c, info);
+        }
+    }
+
+    return {t0, t1, t2, t3};
+}
+
+
 void print_double_char(Platform& pfrm,
                        utf8::Codepoint c,
                        const OverlayCoord& coord,
                        const std::optional<FontColors>& colors = {})
 {
     if (c not_eq 0) {
-        const auto mapping_info = locale_doublesize_texture_map()(c);
-
-        u16 t0 = 495;
-        u16 t1 = 495;
-        u16 t2 = 495;
-        u16 t3 = 495;
-
-        if (mapping_info) {
-            auto info = *mapping_info;
-
-            // FIXME: these special cases should be handled in the texture map
-            // lookup.
-            if (info.offset_ == 72) {
-                t0 = pfrm.map_glyph(c, info);
-                // Special case for space character
-                t1 = t0;
-                t2 = t0;
-                t3 = t0;
-            } else if (info.offset_ == 65) {
-                // Special case for enlarged quote character
-                info.offset_ = 523;
-                t0 = pfrm.map_glyph(c, info);
-                info.offset_ = 524;
-                t1 = pfrm.map_glyph(c, info);
-                info.offset_ = 72; // space
-                t2 = pfrm.map_glyph(c, info);
-                t3 = pfrm.map_glyph(c, info);
-            } else if (info.offset_ == 38 or info.offset_ == 37) {
-                // Special case for period, comma
-                t2 = pfrm.map_glyph(c, info);
-                info.offset_ = 72; // space
-                t0 = pfrm.map_glyph(c, info);
-                t1 = pfrm.map_glyph(c, info);
-                t3 = pfrm.map_glyph(c, info);
-            } else {
-                t0 = pfrm.map_glyph(c, info);
-                info.offset_++;
-                t1 = pfrm.map_glyph(c, info);
-                info.offset_++;
-                t2 = pfrm.map_glyph(c, info);
-                info.offset_++;
-                t3 = pfrm.map_glyph(c, info);
-            }
-        }
+        const auto [t0, t1, t2, t3] = double_char_tiles(pfrm, c);
 
         if (not colors) {
             pfrm.set_tile(Layer::overlay, coord.x, coord.y, t0);
@@ -148,24 +156,23 @@ void print_double_char(Platform& pfrm,
 }
 
 
+static TileDesc char_tile(Platform& pfrm, utf8::Codepoint c)
+{
+    if (auto mapping_info = locale_texture_map()(c)) {
+        return pfrm.map_glyph(c, *mapping_info);
+    }
+
+    return 495;
+}
+
+
 static void print_char(Platform& pfrm,
                        utf8::Codepoint c,
                        const OverlayCoord& coord,
                        const std::optional<FontColors>& colors = {})
 {
     if (c not_eq 0) {
-        auto mapping_info = locale_texture_map()(c);
-
-        u16 t = 495;
-
-        if (mapping_info) {
-
-            switch (mapping_info->offset_) {
-            }
-
-
-            t = pfrm.map_glyph(c, *mapping_info);
-        }
+        const auto t = char_tile(pfrm, c);
 
         if (not colors) {
             pfrm.set_tile(Layer::overlay, coord.x, coord.y, t);
@@ -202,6 +209,11 @@ void Text::append(const char* str, const OptColors& colors)
         return;
     }
 
+    if (not colors) {
+        this->append_tiles(str);
+        return;
+    }
+
     if (config_.double_size_) {
         auto write_pos = static_cast<u8>(coord_.x + len_ * 2);
 
@@ -229,6 +241,44 @@ void Text::append(const char* str, const OptColors& colors)
 }
 
 
+void Text::append_tiles(const char* str)
+{
+    // Map the whole string first, then hand each row of tiles to the platform
+    // in one call. The buffers hold a full row of the overlay, anything past
+    // that would land offscreen anyway.
+    Buffer<TileDesc, 32> top;
+    Buffer<TileDesc, 32> bottom;
+
+    const u8 start = coord_.x + len_ * (config_.double_size_ ? 2 : 1);
+
+    utf8::scan(
+        [&](const utf8::Codepoint& cp, const char* raw, int) {
+            ++len_;
+
+            if (config_.double_size_) {
+                if (top.size() + 2 > top.capacity()) {
+                    return;
+                }
+                const auto tiles = double_char_tiles(pfrm_, cp);
+                top.push_back(tiles[0]);
+                top.push_back(tiles[1]);
+                bottom.push_back(tiles[2]);
+                bottom.push_back(tiles[3]);
+            } else if (not top.full()) {
+                top.push_back(char_tile(pfrm_, cp));
+            }
+        },
+        str,
+        str_len(str));
+
+    pfrm_.set_tiles(start, coord_.y, top.data(), top.size());
+
+    if (config_.double_size_) {
+        pfrm_.set_tiles(start, coord_.y + 1, bottom.data(), bottom.size());
+    }
+}
+
+
 void Text::append(int num, const OptColors& colors)
 {
     std::array<char, 40> buffer = {0};
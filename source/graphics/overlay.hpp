@@ -76,6 +76,8 @@ public:
 private:
     void resize(u32 len);
 
+    void append_tiles(const char* str);
+
     Platform& pfrm_;
     const OverlayCoord coord_;
     Length len_;
@@ -0,0 +1,226 @@
+#pragma once
+
+#include "graphics/color.hpp"
+
+
+// Hands out hardware palette banks for sprite color mixes, e.g. the glow on an
+// injured enemy. Each bank in [first_bank, last_bank) holds the sprite palette
+// blended with one (color, amount) pair. The platform looks up a mix when
+// drawing a sprite. On a hit, the bank already holds the blended palette. On a
+// miss, the cache picks a bank for the mix, and the caller fills it in.
+//
+// Lookups hash into a small open addressed table, so drawing a mixed sprite
+// costs the same however many banks are in use. Banks keep their mixes across
+// frames, so a scene with a steady set of mixes blends each one once, rather
+// than once per frame. When a miss needs a bank, we take the one that the
+// oldest frame used, and of that frame's banks, the last one drawn. When every
+// bank belongs to the current frame, lookups fail.
+//
+// Sprites draw in much the same order every frame, and with more mixes on
+// screen than banks, evicting the least recently used mix would throw out the
+// mixes that the next frame draws first, and blend every mix, every frame.
+//
+// A hit only stamps the bank with the frame and its place in the frame's draw
+// order, and a miss compares the stamps of every bank to pick one. Most draws
+// hit, and cost less than a linear scan over the banks would. A miss costs a
+// scan, but it also costs a blend of the whole palette, which takes longer.
+//
+// The bank that a miss hands out may still hold a mix that sprites from the
+// previous frame use, and the hardware draws that frame until the platform
+// swaps in the new sprites. So the caller must not write the new mix to
+// palette memory right away, but along with the sprites, e.g. from the same
+// vblank-side copy that updates OAM (see the gba's Screen::display()).
+template <int first_bank, int last_bank> class PaletteCache {
+public:
+    using Bank = int;
+
+    static constexpr const int bank_count = last_bank - first_bank;
+
+    static_assert(first_bank > 0 and bank_count > 0 and bank_count < 255);
+
+
+    PaletteCache()
+    {
+        // Before any draws, misses take the banks from the end of the range.
+        for (int i = 0; i < bank_count; ++i) {
+            banks_[i].stamp_ = stamp(0, i);
+        }
+    }
+
+
+    struct Result {
+        // Zero if there were no banks available.
+        Bank bank_;
+
+        // Set on a miss, when the caller needs to write the mix to the bank.
+        bool fill_;
+    };
+
+
+    Result acquire(ColorConstant k, u8 amount)
+    {
+        const Key key = make_key(k, amount);
+
+        int slot = home_slot(key);
+        while (table_[slot]) {
+            const int index = table_[slot] - 1;
+            if (banks_[index].key_ == key) {
+                touch(index);
+                return {first_bank + index, false};
+            }
+            slot = (slot + 1) % table_size;
+        }
+
+        // Starts below every stamp from the current frame, to skip its banks.
+        // Written without branches, as the oldest bank could be any of them.
+        int victim = -1;
+        Stamp oldest = static_cast<Stamp>(frame_) << 8;
+        for (int i = 0; i < bank_count; ++i) {
+            const Stamp st = banks_[i].stamp_;
+            const bool older = st < oldest;
+            oldest = older ? st : oldest;
+            victim = older ? i : victim;
+        }
+
+        if (victim == -1) {
+            return {0, false};
+        }
+
+        auto& info = banks_[victim];
+
+        if (info.valid_) {
+            erase(info.key_);
+        }
+
+        info.key_ = key;
+        info.valid_ = true;
+        touch(victim);
+
+        // erase() may have moved entries around, so probe again for a free
+        // slot.
+        slot = home_slot(key);
+        while (table_[slot]) {
+            slot = (slot + 1) % table_size;
+        }
+        table_[slot] = victim + 1;
+
+        return {first_bank + victim, true};
+    }
+
+
+    // Call once per frame, after the frame's sprites are drawn.
+    void next_frame()
+    {
+        ++frame_;
+        drawn_ = 0;
+    }
+
+
+    // Forget all of the mixes, e.g. after loading a new sprite palette, which
+    // leaves the blended banks out of date. The cache still remembers which
+    // banks the current frame used.
+    void invalidate()
+    {
+        for (auto& info : banks_) {
+            info.valid_ = false;
+        }
+        for (auto& slot : table_) {
+            slot = 0;
+        }
+    }
+
+
+private:
+    using Key = u32;
+
+    // Orders the banks for eviction: by frame, and within a frame, in reverse
+    // draw order, so the smallest stamp belongs to the last bank drawn in the
+    // oldest frame.
+    using Stamp = u64;
+
+    static Stamp stamp(u32 frame, int draw)
+    {
+        return (static_cast<Stamp>(frame) << 8) | (255 - draw);
+    }
+
+    // ColorConstants hold 24 bit rgb values, so the mix fits in a word.
+    static Key make_key(ColorConstant k, u8 amount)
+    {
+        return (static_cast<u32>(k) << 8) | amount;
+    }
+
+    // A power of two, at least twice the number of banks, to keep probe
+    // sequences short.
+    static constexpr const int table_size = [] {
+        int size = 1;
+        while (size < bank_count * 2) {
+            size *= 2;
+        }
+        return size;
+    }();
+
+    static int home_slot(Key key)
+    {
+        return ((key * 2654435761u) >> 16) & (table_size - 1);
+    }
+
+
+    // Stamps the bank the first time that the current frame uses it.
+    void touch(int index)
+    {
+        auto& info = banks_[index];
+
+        if ((info.stamp_ >> 8) not_eq frame_) {
+            info.stamp_ = stamp(frame_, drawn_++);
+        }
+    }
+
+
+    void erase(Key key)
+    {
+        int slot = home_slot(key);
+        while (banks_[table_[slot] - 1].key_ not_eq key) {
+            slot = (slot + 1) % table_size;
+        }
+
+        // Backward shift deletion: pull later entries in the probe sequence
+        // into the hole, so that lookups never stop early.
+        int hole = slot;
+        for (int next = (hole + 1) % table_size; table_[next];
+             next = (next + 1) % table_size) {
+
+            const int home = home_slot(banks_[table_[next] - 1].key_);
+
+            // Move the entry if the hole lies between its home and its
+            // current slot, wrapping around the end of the table.
+            const int dist_home = (next - home + table_size) % table_size;
+            const int dist_hole = (next - hole + table_size) % table_size;
+
+            if (dist_hole <= dist_home) {
+                table_[hole] = table_[next];
+                hole = next;
+            }
+        }
+
+        table_[hole] = 0;
+    }
+
+
+    struct BankInfo {
+        Key key_ = 0;
+        bool valid_ = false;
+
+        // Frames count from one, so frame zero means never used.
+        Stamp stamp_;
+    };
+
+    BankInfo banks_[bank_count];
+
+    // Indices into banks_, plus one. Zero marks an empty slot.
+    u8 table_[table_size] = {};
+
+    // How many banks the current frame used.
+    int drawn_ = 0;
+
+    u32 frame_ = 1;
+};
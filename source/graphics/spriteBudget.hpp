@@ -0,0 +1,220 @@
+#pragma once
+
+#include "graphics/sprite.hpp"
+#include "memory/buffer.hpp"
+#include <algorithm>
+
+
+// How much it matters that a sprite makes it to the screen, from least to most
+// important. When a scene holds more sprites than the hardware can draw, we
+// drop decoration first, and the player last.
+enum class SpritePriority : u8 {
+    decoration, // particles, debris, explosions, and other effects
+    actor,      // enemies, items, the transporter, and other things to touch
+    projectile,
+    boss,
+    peer,
+    player,
+    count
+};
+
+
+// The number of hardware sprites that the gba needs to draw a sprite. 32x32
+// sprites take two (see Platform::Screen::draw()).
+inline u32 sprite_hardware_cost(const Sprite& spr)
+{
+    return spr.get_size() == Sprite::Size::w32_h32 ? 2 : 1;
+}
+
+
+inline bool sprite_is_affine(const Sprite& spr)
+{
+    return spr.get_rotation() or spr.get_scale().x or spr.get_scale().y;
+}
+
+
+// Sprites with equal keys can share an affine matrix.
+using SpriteAffineKey = u64;
+
+
+inline SpriteAffineKey sprite_affine_key(const Sprite& spr)
+{
+    return (u64(u16(spr.get_rotation())) << 32) |
+           (u32(u16(spr.get_scale().x)) << 16) | u16(spr.get_scale().y);
+}
+
+
+// Collects the sprites for a frame, then draws as many as fit within the
+// hardware's sprite and affine transform limits, choosing which ones to keep
+// by priority. The gba draws earlier sprites on top of later ones, so push
+// sprites in the order that they should layer, and kept sprites reach the
+// screen in that same order, whatever their priority. Shadows, pushed with
+// push_shadow(), draw beneath everything else, in the order pushed.
+//
+// A sprite with rotation or scale also needs an affine matrix, which it shares
+// with any other sprites that have the same rotation and scale. When the
+// matrices run out, we drop affine sprites too.
+template <u32 capacity> class SpriteBudget {
+public:
+    void push(const Sprite& spr, SpritePriority priority)
+    {
+        if (spr.get_alpha() == Sprite::Alpha::transparent) {
+            return;
+        }
+
+        if (front_ == back_) {
+            ++dropped_;
+            return;
+        }
+
+        entries_[front_++] = {&spr, priority, false};
+    }
+
+
+    void push_shadow(const Sprite& spr, SpritePriority priority)
+    {
+        if (spr.get_alpha() == Sprite::Alpha::transparent) {
+            return;
+        }
+
+        if (front_ == back_) {
+            ++dropped_;
+            return;
+        }
+
+        entries_[--back_] = {&spr, priority, false};
+    }
+
+
+    // The number of sprites, not counting shadows, pushed so far.
+    u32 size() const
+    {
+        return front_;
+    }
+
+
+    // Reorders the sprites pushed since size() returned begin, e.g. to layer
+    // them by their y position. Shadows keep their order.
+    template <typename F> void sort(u32 begin, F&& less)
+    {
+        std::sort(entries_ + begin,
+                  entries_ + front_,
+                  [&](const Entry& l, const Entry& r) {
+                      return less(*l.sprite_, *r.sprite_);
+                  });
+    }
+
+
+    // Calls draw_fn for each sprite that fits, in push order, then for each
+    // shadow that fits, and returns the number of sprites dropped, including
+    // any that didn't fit in the buffer.
+    template <typename F>
+    u32 draw(u32 sprite_limit, u32 affine_limit, F&& draw_fn)
+    {
+        select(sprite_limit, affine_limit);
+
+        for_each_entry([&](Entry& entry) {
+            if (entry.keep_) {
+                draw_fn(*entry.sprite_);
+            }
+        });
+
+        const auto result = dropped_;
+
+        front_ = 0;
+        back_ = capacity;
+        dropped_ = 0;
+
+        return result;
+    }
+
+
+private:
+    struct Entry {
+        const Sprite* sprite_;
+        SpritePriority priority_;
+        bool keep_;
+    };
+
+
+    // In draw order: sprites from the front of the buffer, then shadows, which
+    // fill the buffer from the back.
+    template <typename F> void for_each_entry(F&& fn)
+    {
+        for (u32 i = 0; i < front_; ++i) {
+            fn(entries_[i]);
+        }
+        for (u32 i = capacity; i > back_; --i) {
+            fn(entries_[i - 1]);
+        }
+    }
+
+
+    void select(u32 sprite_limit, u32 affine_limit)
+    {
+        u32 total = 0;
+        bool any_affine = false;
+        for_each_entry([&](Entry& entry) {
+            total += sprite_hardware_cost(*entry.sprite_);
+            any_affine |= sprite_is_affine(*entry.sprite_);
+        });
+
+        // The common case: everything fits, and nothing needs a matrix.
+        if (total <= sprite_limit and not any_affine) {
+            for_each_entry([](Entry& entry) { entry.keep_ = true; });
+            return;
+        }
+
+        Buffer<SpriteAffineKey, 32> matrices;
+        if (affine_limit > matrices.capacity()) {
+            affine_limit = matrices.capacity();
+        }
+
+        u32 remaining = sprite_limit;
+
+        for (int p = int(SpritePriority::count) - 1; p >= 0; --p) {
+            for_each_entry([&](Entry& entry) {
+                if (entry.priority_ not_eq SpritePriority(p)) {
+                    return;
+                }
+
+                const auto& spr = *entry.sprite_;
+
+                const auto c = sprite_hardware_cost(spr);
+                if (c > remaining) {
+                    ++dropped_;
+                    return;
+                }
+
+                if (sprite_is_affine(spr)) {
+                    const auto key = sprite_affine_key(spr);
+
+                    bool found = false;
+                    for (auto k : matrices) {
+                        if (k == key) {
+                            found = true;
+                            break;
+                        }
+                    }
+
+                    if (not found) {
+                        if (matrices.size() == affine_limit) {
+                            ++dropped_;
+                            return;
+                        }
+                        matrices.push_back(key);
+                    }
+                }
+
+                remaining -= c;
+                entry.keep_ = true;
+            });
+        }
+    }
+
+
+    Entry entries_[capacity];
+    u32 front_ = 0;
+    u32 back_ = capacity;
+    u32 dropped_ = 0;
+};
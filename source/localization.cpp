@@ -1243,7 +1243,7 @@ bool locale_requires_doublesize_font()
 
 LocalizedText locale_string(Platform& pfrm, LocaleString ls)
 {
-    auto result = allocate_dynamic<LocalizedStrBuffer>(pfrm);
+    auto result = allocate_dynamic<LocalizedStrBuffer>(pfrm, "locale-string");
 
     auto languages = lisp::get_var("languages");
 
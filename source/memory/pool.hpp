@@ -13,7 +13,7 @@ public:
     };
 
 
-    Pool() : freelist_(nullptr)
+    Pool() : freelist_(nullptr), remaining_(count)
     {
         for (decltype(count) i = 0; i < count; ++i) {
             Cell* next = &cells_[i];
@@ -29,6 +29,7 @@ public:
         if (freelist_) {
             const auto ret = freelist_;
             freelist_ = freelist_->next_;
+            --remaining_;
             return (byte*)ret;
         } else {
             return nullptr;
@@ -40,6 +41,7 @@ public:
         auto cell = (Cell*)mem;
         cell->next_ = freelist_;
         freelist_ = cell;
+        ++remaining_;
     }
 
     static constexpr u32 element_size()
@@ -60,13 +62,7 @@ public:
 
     u32 remaining() const
     {
-        const Cell* current = freelist_;
-        int n = 0;
-        while (current) {
-            current = current->next_;
-            ++n;
-        }
-        return n;
+        return remaining_;
     }
 
     bool empty() const
@@ -77,6 +73,7 @@ public:
 private:
     Cells cells_;
     Cell* freelist_;
+    u32 remaining_;
 };
 
 
@@ -0,0 +1,334 @@
+#pragma once
+
+#include "int.h"
+#include <ciso646>
+#include <type_traits>
+
+
+// A signed fixed-point number, with IntBits of integer precision, and FracBits
+// of fractional precision. The gameboy advance has no floating point unit, so
+// every float operation compiles to a call into a soft-float library routine;
+// fixed-point math, on the other hand, boils down to a handful of integer
+// instructions. Fixed mixes freely with the builtin arithmetic types, so that
+// code written against Float compiles regardless of whether Float is a float or
+// a Fixed (see numeric.hpp).
+//
+// NOTE: Conversions from float literals, like x * 0.5f, fold into constants at
+// compile time. But converting a runtime float value costs a soft-float
+// multiply, so don't mix floats into hot loops.
+template <int IntBits, int FracBits> class Fixed {
+public:
+    static_assert(IntBits + FracBits == 32, "Fixed must fit in 32 bits");
+    static_assert(FracBits > 0 and IntBits > 0, "");
+
+    using Rep = s32;
+
+    static constexpr const int frac_bits = FracBits;
+    static constexpr const Rep one = Rep(1) << FracBits;
+
+
+    constexpr Fixed() : data_(0)
+    {
+    }
+
+
+    template <typename T,
+              typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    constexpr Fixed(T value) : data_(from(value))
+    {
+    }
+
+
+    static constexpr Fixed from_raw(Rep data)
+    {
+        Fixed result;
+        result.data_ = data;
+        return result;
+    }
+
+
+    constexpr Rep raw() const
+    {
+        return data_;
+    }
+
+
+    template <typename T,
+              typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    constexpr operator T() const
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            return data_ not_eq 0;
+        } else if constexpr (std::is_integral_v<T>) {
+            // Round towards zero, like a float to int conversion.
+            return T(data_ < 0 ? -(-data_ >> FracBits) : data_ >> FracBits);
+        } else {
+            return T(data_) / one;
+        }
+    }
+
+
+    constexpr Fixed operator-() const
+    {
+        return from_raw(-data_);
+    }
+
+
+    constexpr Fixed operator+() const
+    {
+        return *this;
+    }
+
+
+    constexpr Fixed& operator+=(Fixed other)
+    {
+        data_ += other.data_;
+        return *this;
+    }
+
+
+    constexpr Fixed& operator-=(Fixed other)
+    {
+        data_ -= other.data_;
+        return *this;
+    }
+
+
+    constexpr Fixed& operator*=(Fixed other)
+    {
+        data_ = Rep((s64(data_) * other.data_) >> FracBits);
+        return *this;
+    }
+
+
+    constexpr Fixed& operator/=(Fixed other)
+    {
+        data_ = Rep((s64(data_) * one) / other.data_);
+        return *this;
+    }
+
+
+    friend constexpr Fixed operator+(Fixed lhs, Fixed rhs)
+    {
+        return lhs += rhs;
+    }
+
+
+    friend constexpr Fixed operator-(Fixed lhs, Fixed rhs)
+    {
+        return lhs -= rhs;
+    }
+
+
+    friend constexpr Fixed operator*(Fixed lhs, Fixed rhs)
+    {
+        return lhs *= rhs;
+    }
+
+
+    friend constexpr Fixed operator/(Fixed lhs, Fixed rhs)
+    {
+        return lhs /= rhs;
+    }
+
+
+    friend constexpr bool operator==(Fixed lhs, Fixed rhs)
+    {
+        return lhs.data_ == rhs.data_;
+    }
+
+
+    friend constexpr bool operator not_eq(Fixed lhs, Fixed rhs)
+    {
+        return lhs.data_ not_eq rhs.data_;
+    }
+
+
+    friend constexpr bool operator<(Fixed lhs, Fixed rhs)
+    {
+        return lhs.data_ < rhs.data_;
+    }
+
+
+    friend constexpr bool operator>(Fixed lhs, Fixed rhs)
+    {
+        return lhs.data_ > rhs.data_;
+    }
+
+
+    friend constexpr bool operator<=(Fixed lhs, Fixed rhs)
+    {
+        return lhs.data_ <= rhs.data_;
+    }
+
+
+    friend constexpr bool operator>=(Fixed lhs, Fixed rhs)
+    {
+        return lhs.data_ >= rhs.data_;
+    }
+
+
+private:
+    template <typename T> static constexpr Rep from(T value)
+    {
+        if constexpr (std::is_integral_v<T>) {
+            return Rep(value) * one;
+        } else {
+            // Round to nearest, otherwise constants like 0.1f come out
+            // slightly small.
+            return Rep(value * one + (value < 0 ? T(-0.5) : T(0.5)));
+        }
+    }
+
+    Rep data_;
+};
+
+
+template <typename T> struct IsFixed : std::false_type {
+};
+
+
+template <int I, int F> struct IsFixed<Fixed<I, F>> : std::true_type {
+};
+
+
+// Mixed operations with builtin arithmetic types. Without these, an expression
+// like x * 2 would be ambiguous, as the compiler could either convert the Fixed
+// to an int, or the int to a Fixed. Integer operands skip the conversion
+// entirely, as a Fixed times an int needs no rescaling.
+
+
+#define FIXED_MIXED_ARITHMETIC(OP, INT_EXPR)                                   \
+    template <int I, int F, typename T,                                        \
+              typename = std::enable_if_t<std::is_arithmetic_v<T>>>           \
+    constexpr Fixed<I, F> operator OP(Fixed<I, F> lhs, T rhs)                  \
+    {                                                                          \
+        using Fx = Fixed<I, F>;                                                \
+        if constexpr (std::is_integral_v<T>) {                                 \
+            return Fx::from_raw(INT_EXPR);                                     \
+        } else {                                                               \
+            return lhs OP Fixed<I, F>(rhs);                                    \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    template <int I, int F, typename T,                                        \
+              typename = std::enable_if_t<std::is_arithmetic_v<T>>>           \
+    constexpr Fixed<I, F> operator OP(T lhs, Fixed<I, F> rhs)                  \
+    {                                                                          \
+        return Fixed<I, F>(lhs) OP rhs;                                        \
+    }                                                                          \
+                                                                               \
+    template <int I, int F, typename T,                                        \
+              typename = std::enable_if_t<std::is_arithmetic_v<T>>>           \
+    constexpr Fixed<I, F>& operator OP##=(Fixed<I, F>& lhs, T rhs)             \
+    {                                                                          \
+        return lhs = lhs OP rhs;                                               \
+    }
+
+
+FIXED_MIXED_ARITHMETIC(+, lhs.raw() + Fx(rhs).raw())
+FIXED_MIXED_ARITHMETIC(-, lhs.raw() - Fx(rhs).raw())
+FIXED_MIXED_ARITHMETIC(*, lhs.raw() * s32(rhs))
+FIXED_MIXED_ARITHMETIC(/, lhs.raw() / s32(rhs))
+
+
+#undef FIXED_MIXED_ARITHMETIC
+
+
+#define FIXED_MIXED_COMPARISON(OP)                                             \
+    template <int I, int F, typename T,                                        \
+              typename = std::enable_if_t<std::is_arithmetic_v<T>>>           \
+    constexpr bool operator OP(Fixed<I, F> lhs, T rhs)                         \
+    {                                                                          \
+        return lhs OP Fixed<I, F>(rhs);                                        \
+    }                                                                          \
+                                                                               \
+    template <int I, int F, typename T,                                        \
+              typename = std::enable_if_t<std::is_arithmetic_v<T>>>           \
+    constexpr bool operator OP(T lhs, Fixed<I, F> rhs)                         \
+    {                                                                          \
+        return Fixed<I, F>(lhs) OP rhs;                                        \
+    }
+
+
+FIXED_MIXED_COMPARISON(==)
+FIXED_MIXED_COMPARISON(not_eq)
+FIXED_MIXED_COMPARISON(<)
+FIXED_MIXED_COMPARISON(>)
+FIXED_MIXED_COMPARISON(<=)
+FIXED_MIXED_COMPARISON(>=)
+
+
+#undef FIXED_MIXED_COMPARISON
+
+
+// Builtin types accumulating a Fixed, e.g. an integer timer advanced by a
+// fractional rate. Like an int += float, the fractional part is discarded.
+template <int I,
+          int F,
+          typename T,
+          typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+T& operator+=(T& lhs, Fixed<I, F> rhs)
+{
+    return lhs += T(rhs);
+}
+
+
+template <int I,
+          int F,
+          typename T,
+          typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+T& operator-=(T& lhs, Fixed<I, F> rhs)
+{
+    return lhs -= T(rhs);
+}
+
+
+// Digit-by-digit integer square root, which needs only shifts and adds, as the
+// gba has no hardware divide.
+inline u32 isqrt(u64 n)
+{
+    if (n == 0) {
+        return 0;
+    }
+
+    u64 result = 0;
+    u64 bit = u64(1) << ((63 - __builtin_clzll(n)) & ~1);
+
+    while (bit) {
+        if (n >= result + bit) {
+            n -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return u32(result);
+}
+
+
+// Unlike the float sqrt_approx() in numeric.hpp, the result is exact, to within
+// the precision of the Fixed type.
+template <int I, int F> Fixed<I, F> sqrt_approx(Fixed<I, F> x)
+{
+    if (x.raw() <= 0) {
+        return {};
+    }
+
+    return Fixed<I, F>::from_raw(isqrt(u64(x.raw()) << F));
+}
+
+
+// The length of the vector (x, y). With sixteen integer bits, squaring a
+// coordinate more than 181 pixels long would overflow, so we sum the squares in
+// 64 bits, where the raw values, each scaled by 2^F, square to a sum scaled by
+// 2^2F, whose square root lands right back at a raw value scaled by 2^F.
+template <int I, int F> Fixed<I, F> hypot_approx(Fixed<I, F> x, Fixed<I, F> y)
+{
+    const s64 rx = x.raw();
+    const s64 ry = y.raw();
+
+    return Fixed<I, F>::from_raw(isqrt(u64(rx * rx) + u64(ry * ry)));
+}
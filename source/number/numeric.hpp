@@ -1,5 +1,6 @@
 #pragma once
 
+#include "fixed.hpp"
 #include "int.h"
 #include <ciso646> // For MSVC. What an inept excuse for a compiler.
 
@@ -59,14 +60,20 @@ using Degree = u16;
 using Angle = Degree;
 
 
-// Note: In case I need to swap in a fixed-point class in the future.
+// Platforms without a floating point unit may build with
+// __BLINDJUMP_FIXED_POINT, to swap a fixed-point class in for Float. See
+// fixed.hpp.
+#ifdef __BLINDJUMP_FIXED_POINT
+using Float = Fixed<16, 16>;
+#else
 using Float = float;
+#endif
 
 
-inline Float sqrt_approx(const Float x)
+inline float sqrt_approx(const float x)
 {
-    constexpr Float magic = 0x5f3759df;
-    const Float xhalf = 0.5f * x;
+    constexpr float magic = 0x5f3759df;
+    const float xhalf = 0.5f * x;
 
     union {
         float x;
@@ -78,6 +85,12 @@ inline Float sqrt_approx(const Float x)
     return x * u.x * (1.5f - xhalf * u.x * u.x);
 }
 
+
+inline float hypot_approx(float x, float y)
+{
+    return sqrt_approx(x * x + y * y);
+}
+
 template <typename T> Vec2<T> operator+(const Vec2<T>& lhs, const Vec2<T>& rhs)
 {
     return {lhs.x + rhs.x, lhs.y + rhs.y};
@@ -128,6 +141,36 @@ template <typename T> Vec2<T> operator/(const T& rhs, const Vec2<T>& lhs)
     return {lhs.x / rhs, lhs.y / rhs};
 }
 
+// Scaling a vector of Fixed by a builtin arithmetic type. For Vec2<float>, the
+// operators above require the scalar to match, but with Float defined as a
+// Fixed, we still want expressions like vec * 0.5f to compile.
+template <typename T,
+          typename U,
+          typename = std::enable_if_t<IsFixed<T>::value and
+                                      std::is_arithmetic_v<U>>>
+Vec2<T> operator*(const Vec2<T>& lhs, const U& rhs)
+{
+    return {lhs.x * rhs, lhs.y * rhs};
+}
+
+template <typename T,
+          typename U,
+          typename = std::enable_if_t<IsFixed<T>::value and
+                                      std::is_arithmetic_v<U>>>
+Vec2<T> operator*(const U& rhs, const Vec2<T>& lhs)
+{
+    return {lhs.x * rhs, lhs.y * rhs};
+}
+
+template <typename T,
+          typename U,
+          typename = std::enable_if_t<IsFixed<T>::value and
+                                      std::is_arithmetic_v<U>>>
+Vec2<T> operator/(const Vec2<T>& lhs, const U& rhs)
+{
+    return {lhs.x / rhs, lhs.y / rhs};
+}
+
 template <typename T> bool operator==(const Vec2<T>& rhs, const Vec2<T>& lhs)
 {
     return lhs.x == rhs.x and lhs.y == rhs.y;
@@ -152,7 +195,7 @@ template <typename T> T clamp(T x, T floor, T ceil)
 
 inline Float smoothstep(Float edge0, Float edge1, Float x)
 {
-    x = clamp((x - edge0) / (edge1 - edge0), 0.f, 1.f);
+    x = clamp((x - edge0) / (edge1 - edge0), Float(0), Float(1));
     return x * x * (3 - 2 * x);
 }
 
@@ -223,7 +266,7 @@ inline UnitVec direction(const Vec2<Float>& origin, const Vec2<Float>& target)
 {
     const auto vec = target - origin;
 
-    const auto magnitude = sqrt_approx(vec.x * vec.x + vec.y * vec.y);
+    const auto magnitude = hypot_approx(vec.x, vec.y);
 
     return vec / magnitude;
 }
@@ -249,8 +292,7 @@ inline Vec2<Float> cartesian_angle(Float degree_angle)
 
 inline Float distance(const Vec2<Float>& from, const Vec2<Float>& to)
 {
-    const Vec2<float> vec = {abs(from.x - to.x), abs(from.y - to.y)};
-    return sqrt_approx(vec.x * vec.x + vec.y * vec.y);
+    return hypot_approx(from.x - to.x, from.y - to.y);
 }
 
 
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "platform/audioMixer.hpp"
+
+
+// Four bit ima adpcm, for the gba's music tracks. build/encode_adpcm.py
+// converts a track of eight bit signed samples (see audioMixer.hpp) offline,
+// halving its size in the rom, and the audio interrupt handler decodes eight
+// samples at a time, from one word of the track.
+//
+// A track is a sequence of blocks. Each block starts with a one word header,
+// holding the decoder state (a sixteen bit predictor, then an eight bit step
+// index, then a zero byte), followed by up to block_words words of samples,
+// two per byte, low nibble first. Every block besides the last one holds
+// exactly block_words words. The header lets a player seek into a track, or
+// loop back to the start, without decoding everything before that point.
+//
+// The decoder runs at sixteen bits of precision, with eight bit input samples
+// stored in the high byte. The encoder adds half of an output step to each
+// input sample, so taking the predictor's high byte rounds to the nearest
+// sample, rather than down.
+namespace adpcm {
+
+
+static constexpr const int block_words = 512;
+static constexpr const int block_samples = block_words * 8;
+
+
+static constexpr const int step_count = 89;
+
+
+inline constexpr u16 step_table_init[step_count] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+
+inline constexpr s8 index_table_init[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+
+// The decoder looks up both tables for every sample. On the gba, the audio isr
+// would wait on the cartridge for each of those lookups, so the platform copies
+// the tables to iwram at startup (see gba_platform.cpp), and the decoder reads
+// the copies.
+#ifdef __GBA__
+extern u16 step_table[step_count];
+extern s8 index_table[8];
+#else
+inline constexpr const auto& step_table = step_table_init;
+inline constexpr const auto& index_table = index_table_init;
+#endif
+
+
+struct State {
+    s32 predictor_ = 0;
+    s32 index_ = 0;
+};
+
+
+inline State read_header(u32 header)
+{
+    return {static_cast<s16>(header & 0xffff),
+            static_cast<s32>((header >> 16) & 0xff)};
+}
+
+
+inline u32 make_header(const State& state)
+{
+    return static_cast<u16>(state.predictor_) | (state.index_ << 16);
+}
+
+
+// Advances the decoder by one sample, and returns the new predictor.
+inline s32 step(State& state, u32 nibble)
+{
+    const s32 step = step_table[state.index_];
+
+    s32 diff = step >> 3;
+    if (nibble & 4) {
+        diff += step;
+    }
+    if (nibble & 2) {
+        diff += step >> 1;
+    }
+    if (nibble & 1) {
+        diff += step >> 2;
+    }
+
+    s32 predictor = state.predictor_;
+    if (nibble & 8) {
+        predictor -= diff;
+        if (predictor < -32768) {
+            predictor = -32768;
+        }
+    } else {
+        predictor += diff;
+        if (predictor > 32767) {
+            predictor = 32767;
+        }
+    }
+    state.predictor_ = predictor;
+
+    s32 index = state.index_ + index_table[nibble & 7];
+    if (index < 0) {
+        index = 0;
+    } else if (index >= step_count) {
+        index = step_count - 1;
+    }
+    state.index_ = index;
+
+    return predictor;
+}
+
+
+inline AudioSample decode(State& state, u32 nibble)
+{
+    return step(state, nibble) >> 8;
+}
+
+
+// Decodes the eight samples packed into one word of a block.
+inline void decode_word(State& state, u32 word, AudioSample* out)
+{
+    for (int i = 0; i < 8; ++i) {
+        out[i] = decode(state, word & 0xf);
+        word >>= 4;
+    }
+}
+
+
+// Advances the decoder past the eight samples in a word, without output.
+inline void skip_word(State& state, u32 word)
+{
+    for (int i = 0; i < 8; ++i) {
+        step(state, word & 0xf);
+        word >>= 4;
+    }
+}
+
+
+// Picks the nibble that moves the predictor closest to sample, as the standard
+// ima encoder does, and advances the state past it. The encoder in
+// build/encode_adpcm.py does the same thing, this version is for tests.
+inline u32 encode(State& state, AudioSample sample)
+{
+    const s32 target = (sample << 8) + 128;
+
+    const s32 step = step_table[state.index_];
+
+    s32 diff = target - state.predictor_;
+    u32 nibble = 0;
+    if (diff < 0) {
+        nibble = 8;
+        diff = -diff;
+    }
+    if (diff >= step) {
+        nibble |= 4;
+        diff -= step;
+    }
+    if (diff >= step >> 1) {
+        nibble |= 2;
+        diff -= step >> 1;
+    }
+    if (diff >= step >> 2) {
+        nibble |= 1;
+    }
+
+    adpcm::step(state, nibble);
+
+    return nibble;
+}
+
+
+} // namespace adpcm
@@ -0,0 +1,571 @@
+#pragma once
+
+#include "memory/buffer.hpp"
+#include "number/numeric.hpp"
+#include <algorithm>
+#include <array>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+
+// The game's sound effects and music are eight bit signed mono samples, at
+// 16kHz. The gba's interrupt handlers mix them directly into the sound fifos,
+// while the other platforms mix blocks of samples with the AudioMixer below,
+// and hand the result to the host's audio api through an AudioRing. Both paths
+// share the volume tables, the voice stealing policy, and the distance
+// attenuation defined here, and the AudioMixer produces bit-identical samples
+// to the gba's mixer (see unittest/audioMixer.cpp). The gba stores its music
+// tracks in adpcm, and decodes them as it mixes (see adpcm.hpp).
+
+
+using AudioSample = s8;
+
+
+using VolumeScaleLUT = std::array<s8, 256>;
+
+
+namespace detail {
+template <std::size_t... Is> struct seq {
+};
+template <std::size_t N, std::size_t... Is>
+struct gen_seq : gen_seq<N - 1, N - 1, Is...> {
+};
+template <std::size_t... Is> struct gen_seq<0, Is...> : seq<Is...> {
+};
+
+
+template <class Generator, std::size_t... Is>
+constexpr auto generate_array_helper(Generator g, seq<Is...>)
+    -> std::array<decltype(g(std::size_t{}, sizeof...(Is))), sizeof...(Is)>
+{
+    return {{g(Is, sizeof...(Is))...}};
+}
+
+template <std::size_t tcount, class Generator>
+constexpr auto generate_array(Generator g)
+    -> decltype(generate_array_helper(g, gen_seq<tcount>{}))
+{
+    return generate_array_helper(g, gen_seq<tcount>{});
+}
+} // namespace detail
+
+
+static constexpr const int volume_levels = 20;
+
+
+static constexpr const float volume_scales[volume_levels] = {
+    0.05f, 0.10f, 0.15f, 0.20f, 0.25f, 0.30f, 0.35f, 0.40f, 0.45f, 0.50f,
+    0.55f, 0.60f, 0.65f, 0.70f, 0.75f, 0.80f, 0.85f, 0.90f, 0.95f, 1.0f};
+
+
+constexpr auto make_volume_lut(float scale)
+{
+    return detail::generate_array<256>(
+        [scale](std::size_t curr, std::size_t) -> s8 {
+            const auto real = (s8)((u8)curr);
+            return real * scale;
+        });
+}
+
+
+// Each table entry contains the whole number space of a signed 8-bit value,
+// scaled by a fraction.
+inline constexpr std::array<VolumeScaleLUT, volume_levels> volume_scale_LUTs =
+    detail::generate_array<volume_levels>([](std::size_t level, std::size_t) {
+        return make_volume_lut(volume_scales[level]);
+    });
+
+
+// The simd kernels can't index a lookup table, so they multiply each sample's
+// magnitude by a 16.16 fixed-point scale instead. Rounding the scale up
+// reproduces the float truncation in make_volume_lut() exactly, for every
+// level, which we verify below.
+constexpr u32 volume_multiplier(int level)
+{
+    const float scaled = volume_scales[level] * 65536.f;
+    const u32 result = scaled;
+    return result < scaled ? result + 1 : result;
+}
+
+
+inline constexpr std::array<u32, volume_levels> volume_multipliers =
+    detail::generate_array<volume_levels>(
+        [](std::size_t level, std::size_t) {
+            return volume_multiplier(level);
+        });
+
+
+constexpr bool volume_multipliers_match_LUTs()
+{
+    for (int level = 0; level < volume_levels; ++level) {
+        for (int i = 0; i < 256; ++i) {
+            const s32 sample = (s8)((u8)i);
+            const s32 magnitude = sample < 0 ? -sample : sample;
+            const s32 scaled = (magnitude * volume_multipliers[level]) >> 16;
+            if ((sample < 0 ? -scaled : scaled) not_eq
+                volume_scale_LUTs[level][i]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+static_assert(volume_multipliers_match_LUTs());
+
+
+inline u8 volume_level(Float volume)
+{
+    const int level = volume * Float(volume_levels - 1);
+    return clamp(level, 0, volume_levels - 1);
+}
+
+
+struct StereoLevels {
+    u8 left_;
+    u8 right_;
+};
+
+
+// Pan ranges from -1 (left) to 1 (right). Panning attenuates the opposite
+// channel, rather than boosting either one.
+inline StereoLevels stereo_levels(Float volume, Float pan)
+{
+    volume = clamp(volume, Float(0), Float(1));
+    pan = clamp(pan, Float(-1), Float(1));
+
+    return {volume_level(pan > 0 ? volume * (Float(1) - pan) : volume),
+            volume_level(pan < 0 ? volume * (Float(1) + pan) : volume)};
+}
+
+
+// Volume of a sound emitted some distance from the listener, in pixels.
+inline Float spatial_volume(Float dist)
+{
+    if (dist < 48) {
+        return 1.f;
+    }
+
+    const Float distance_scale = 0.0005f;
+
+    const auto inv_sqr_intensity = 1.f / (distance_scale * ((dist / 4) * dist));
+
+    return clamp(inv_sqr_intensity, Float(0), Float(1));
+}
+
+
+// When all of the voices are busy, a new sound replaces the lowest-priority
+// voice, if the new sound has a higher priority, and is otherwise dropped.
+template <typename Voice, u32 capacity>
+bool add_voice(Buffer<Voice, capacity>& voices, const Voice& voice)
+{
+    if (not voices.full()) {
+        voices.push_back(voice);
+        return true;
+    }
+
+    Voice* lowest = voices.begin();
+    for (auto it = voices.begin(); it not_eq voices.end(); ++it) {
+        if (it->priority_ < lowest->priority_) {
+            lowest = it;
+        }
+    }
+
+    if (lowest not_eq voices.end() and lowest->priority_ < voice.priority_) {
+        voices.erase(lowest);
+        voices.push_back(voice);
+        return true;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Kernels
+//
+// Each kernel adds count samples, scaled by a volume level, to a sixteen bit
+// accumulator. With at most 64 voices, the sums can't overflow, and the low
+// byte of each sum equals the gba's wrapping eight bit mix.
+////////////////////////////////////////////////////////////////////////////////
+
+
+inline void
+mix_scaled_scalar(s16* acc, const AudioSample* in, u32 count, u8 level)
+{
+    const auto& lut = volume_scale_LUTs[level];
+
+    for (u32 i = 0; i < count; ++i) {
+        acc[i] += lut[(u8)in[i]];
+    }
+}
+
+
+#if defined(__SSE2__)
+
+
+// The full volume level has a multiplier of 1.0, i.e. 65536, which doesn't fit
+// in a sixteen bit lane, so we add the unscaled magnitude in for that level.
+inline __m128i mix_scaled_sse2_lane(__m128i samples, __m128i mul, __m128i full)
+{
+    const __m128i sign = _mm_srai_epi16(samples, 15);
+    const __m128i mag = _mm_sub_epi16(_mm_xor_si128(samples, sign), sign);
+
+    const __m128i scaled = _mm_add_epi16(_mm_mulhi_epu16(mag, mul),
+                                         _mm_and_si128(mag, full));
+
+    return _mm_sub_epi16(_mm_xor_si128(scaled, sign), sign);
+}
+
+
+inline void
+mix_scaled_simd(s16* acc, const AudioSample* in, u32 count, u8 level)
+{
+    const u32 m = volume_multipliers[level];
+    const __m128i mul = _mm_set1_epi16(s16(m & 0xffff));
+    const __m128i full = _mm_set1_epi16(m >> 16 ? -1 : 0);
+
+    u32 i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i*)(in + i));
+
+        // Sign-extend each byte, by unpacking it into the high byte of a
+        // sixteen bit lane, then shifting it back down.
+        const __m128i lo = _mm_srai_epi16(_mm_unpacklo_epi8(s, s), 8);
+        const __m128i hi = _mm_srai_epi16(_mm_unpackhi_epi8(s, s), 8);
+
+        __m128i* out = (__m128i*)(acc + i);
+
+        _mm_storeu_si128(out,
+                         _mm_add_epi16(_mm_loadu_si128(out),
+                                       mix_scaled_sse2_lane(lo, mul, full)));
+
+        _mm_storeu_si128(out + 1,
+                         _mm_add_epi16(_mm_loadu_si128(out + 1),
+                                       mix_scaled_sse2_lane(hi, mul, full)));
+    }
+
+    mix_scaled_scalar(acc + i, in + i, count - i, level);
+}
+
+
+#define AUDIO_MIXER_SIMD "sse2"
+
+
+#elif defined(__ARM_NEON)
+
+
+inline int16x8_t
+mix_scaled_neon_lane(int16x8_t samples, uint16x8_t mul, uint16x8_t full)
+{
+    const int16x8_t sign = vshrq_n_s16(samples, 15);
+    const uint16x8_t mag = vreinterpretq_u16_s16(vabsq_s16(samples));
+
+    const uint16x4_t lo =
+        vshrn_n_u32(vmull_u16(vget_low_u16(mag), vget_low_u16(mul)), 16);
+    const uint16x4_t hi =
+        vshrn_n_u32(vmull_u16(vget_high_u16(mag), vget_high_u16(mul)), 16);
+
+    const int16x8_t scaled = vreinterpretq_s16_u16(
+        vaddq_u16(vcombine_u16(lo, hi), vandq_u16(mag, full)));
+
+    return vsubq_s16(veorq_s16(scaled, sign), sign);
+}
+
+
+inline void
+mix_scaled_simd(s16* acc, const AudioSample* in, u32 count, u8 level)
+{
+    const u32 m = volume_multipliers[level];
+    const uint16x8_t mul = vdupq_n_u16(m & 0xffff);
+    const uint16x8_t full = vdupq_n_u16(m >> 16 ? 0xffff : 0);
+
+    u32 i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const int8x16_t s = vld1q_s8(in + i);
+
+        const int16x8_t lo = vmovl_s8(vget_low_s8(s));
+        const int16x8_t hi = vmovl_s8(vget_high_s8(s));
+
+        vst1q_s16(acc + i,
+                  vaddq_s16(vld1q_s16(acc + i),
+                            mix_scaled_neon_lane(lo, mul, full)));
+
+        vst1q_s16(acc + i + 8,
+                  vaddq_s16(vld1q_s16(acc + i + 8),
+                            mix_scaled_neon_lane(hi, mul, full)));
+    }
+
+    mix_scaled_scalar(acc + i, in + i, count - i, level);
+}
+
+
+#define AUDIO_MIXER_SIMD "neon"
+
+
+#endif
+
+
+inline void mix_scaled(s16* acc, const AudioSample* in, u32 count, u8 level)
+{
+#ifdef AUDIO_MIXER_SIMD
+    mix_scaled_simd(acc, in, count, level);
+#else
+    mix_scaled_scalar(acc, in, count, level);
+#endif
+}
+
+
+using AudioMixKernel = void (*)(s16*, const AudioSample*, u32, u8);
+
+
+////////////////////////////////////////////////////////////////////////////////
+// AudioRing
+////////////////////////////////////////////////////////////////////////////////
+
+
+// A sixteen bit stereo pcm frame, in the interleaved layout that most audio
+// apis expect.
+struct AudioFrame {
+    s16 left_;
+    s16 right_;
+};
+
+
+// Single producer, single consumer queue of mixed frames. The game thread mixes
+// audio into the ring once per frame, and the host's audio thread drains it.
+template <u32 capacity> class AudioRing {
+public:
+    static_assert((capacity & (capacity - 1)) == 0,
+                  "ring capacity must be a power of two");
+
+    u32 size() const
+    {
+        return write_ - read_;
+    }
+
+
+    u32 space() const
+    {
+        return capacity - size();
+    }
+
+
+    // Called by the producer. Returns the number of frames written.
+    u32 write(const AudioFrame* frames, u32 count)
+    {
+        const u32 w = write_;
+        const u32 r = read_;
+
+        count = std::min(count, capacity - (w - r));
+
+        for (u32 i = 0; i < count; ++i) {
+            frames_[(w + i) & (capacity - 1)] = frames[i];
+        }
+
+        write_ = w + count;
+
+        return count;
+    }
+
+
+    // Called by the consumer. Returns the number of frames read.
+    u32 read(AudioFrame* frames, u32 count)
+    {
+        const u32 r = read_;
+        const u32 w = write_;
+
+        count = std::min(count, w - r);
+
+        for (u32 i = 0; i < count; ++i) {
+            frames[i] = frames_[(r + i) & (capacity - 1)];
+        }
+
+        read_ = r + count;
+
+        return count;
+    }
+
+
+private:
+    std::array<AudioFrame, capacity> frames_;
+    Atomic<u32> write_{0};
+    Atomic<u32> read_{0};
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// AudioMixer
+////////////////////////////////////////////////////////////////////////////////
+
+
+// Mixes one looping music track, and up to voice_count sound effects.
+//
+// NOTE: Like the gba's interrupt handler, the mixer steps through sounds in
+// chunks of four samples, and drops a sound's trailing partial chunk. Mix in
+// multiples of four frames, to keep the output identical to the gba's.
+template <u32 voice_count, AudioMixKernel kernel = mix_scaled>
+class AudioMixer {
+public:
+    static_assert(voice_count <= 64, "voice sums may overflow the accumulator");
+
+
+    struct Voice {
+        const AudioSample* data_;
+        s32 position_;
+        s32 end_;
+        s32 priority_;
+        StereoLevels levels_;
+    };
+
+
+    // Returns false if a higher-priority sound occupies every voice, or if the
+    // sound is shorter than one chunk of four samples, which the mixer would
+    // drop anyway.
+    bool play(const AudioSample* data,
+              s32 length,
+              s32 priority,
+              StereoLevels levels = {volume_levels - 1, volume_levels - 1})
+    {
+        if (length < 4) {
+            return false;
+        }
+
+        return add_voice(voices_,
+                         Voice{data, 0, (length - 1) & ~3, priority, levels});
+    }
+
+
+    bool is_playing(const AudioSample* data) const
+    {
+        for (auto& voice : voices_) {
+            if (voice.data_ == data) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+
+    void play_music(const AudioSample* data, u32 length, u32 position = 0)
+    {
+        music_ = length ? data : nullptr;
+        music_length_ = length;
+        music_pos_ = length ? position % length : 0;
+    }
+
+
+    void stop_music()
+    {
+        music_ = nullptr;
+    }
+
+
+    u32 active_voices() const
+    {
+        return voices_.size();
+    }
+
+
+    // Writes count mixed frames to left and right. The low byte of each output
+    // sample matches the gba's eight bit mix.
+    void mix(s16* left, s16* right, u32 count)
+    {
+        mix_music(left, count);
+
+        for (u32 i = 0; i < count; ++i) {
+            right[i] = left[i];
+        }
+
+        for (auto it = voices_.begin(); it not_eq voices_.end();) {
+            const u32 n = std::min(count, u32(it->end_ - it->position_));
+
+            kernel(left, it->data_ + it->position_, n, it->levels_.left_);
+            kernel(right, it->data_ + it->position_, n, it->levels_.right_);
+
+            it->position_ += n;
+
+            // The gba's isr would have noticed that the sound ended, and freed
+            // its voice, partway through the block. A sound that ends exactly
+            // at the end of a block holds onto its voice until the next one.
+            if (n < count) {
+                it = voices_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+
+    // Mixes blocks into the ring until it holds at least target frames, or
+    // runs out of space. Returns the number of frames mixed.
+    template <u32 capacity> u32 fill(AudioRing<capacity>& ring, u32 target)
+    {
+        static constexpr const u32 block = 64;
+
+        u32 mixed = 0;
+
+        while (ring.size() < target and ring.space() >= block) {
+            s16 left[block];
+            s16 right[block];
+            AudioFrame frames[block];
+
+            mix(left, right, block);
+
+            for (u32 i = 0; i < block; ++i) {
+                frames[i] = {to_pcm(left[i]), to_pcm(right[i])};
+            }
+
+            ring.write(frames, block);
+            mixed += block;
+        }
+
+        return mixed;
+    }
+
+
+    // Hosts with sixteen bit output don't need to wrap around like the gba, so
+    // we saturate at the eight bit range instead, and scale up.
+    static s16 to_pcm(s16 sum)
+    {
+        return clamp(sum, s16(-128), s16(127)) * 256;
+    }
+
+
+private:
+    void mix_music(s16* out, u32 count)
+    {
+        u32 i = 0;
+
+        while (music_ and i < count) {
+            const u32 n = std::min(count - i, music_length_ - music_pos_);
+
+            for (u32 j = 0; j < n; ++j) {
+                out[i + j] = music_[music_pos_ + j];
+            }
+
+            i += n;
+            music_pos_ += n;
+
+            if (music_pos_ == music_length_) {
+                music_pos_ = 0;
+            }
+        }
+
+        for (; i < count; ++i) {
+            out[i] = 0;
+        }
+    }
+
+
+    Buffer<Voice, voice_count> voices_;
+
+    const AudioSample* music_ = nullptr;
+    u32 music_length_ = 0;
+    u32 music_pos_ = 0;
+};
@@ -0,0 +1,271 @@
+#include "assetPack.hpp"
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace asset_pack {
+
+
+// Entry data starts on a sixteen byte boundary, so that image pixels and sound
+// samples are suitably aligned for the simd audio kernels.
+static const u64 data_align = 16;
+
+
+std::vector<u8> write(std::vector<Item> items, std::string& error_out)
+{
+    std::sort(items.begin(), items.end(), [](const Item& a, const Item& b) {
+        if (a.entry_.kind_ not_eq b.entry_.kind_) {
+            return a.entry_.kind_ < b.entry_.kind_;
+        }
+        return a.entry_.hash_ < b.entry_.hash_;
+    });
+
+    for (u32 i = 1; i < items.size(); ++i) {
+        if (items[i].entry_.kind_ == items[i - 1].entry_.kind_ and
+            items[i].entry_.hash_ == items[i - 1].entry_.hash_) {
+            error_out = "asset hash collision";
+            return {};
+        }
+    }
+
+    auto align = [](u64 offset) {
+        return (offset + data_align - 1) & ~(data_align - 1);
+    };
+
+    u64 offset = align(sizeof(Header) + items.size() * sizeof(Entry));
+
+    for (auto& item : items) {
+        item.entry_.offset_ = offset;
+        item.entry_.size_ = item.data_.size();
+        offset = align(offset + item.data_.size());
+    }
+
+    std::vector<u8> result(offset);
+
+    const Header header{magic, version, u32(items.size()), 0};
+    std::memcpy(result.data(), &header, sizeof header);
+
+    for (u32 i = 0; i < items.size(); ++i) {
+        auto& item = items[i];
+
+        std::memcpy(result.data() + sizeof(Header) + i * sizeof(Entry),
+                    &item.entry_,
+                    sizeof(Entry));
+
+        std::copy(item.data_.begin(),
+                  item.data_.end(),
+                  result.begin() + item.entry_.offset_);
+    }
+
+    return result;
+}
+
+
+} // namespace asset_pack
+
+
+AssetPack::~AssetPack()
+{
+    close();
+}
+
+
+void AssetPack::close()
+{
+    if (mapping_) {
+#ifdef _WIN32
+        UnmapViewOfFile(base_);
+        CloseHandle(mapping_);
+#else
+        munmap(mapping_, size_);
+#endif
+        mapping_ = nullptr;
+    }
+
+    built_.clear();
+
+    base_ = nullptr;
+    size_ = 0;
+    entries_ = nullptr;
+    count_ = 0;
+}
+
+
+// A truncated or corrupt archive must not hand out pointers past the end of
+// the mapping, so we check each entry once, up front, rather than on lookup.
+static bool valid(const AssetPack::Entry& entry, const u8* base, u64 size)
+{
+    if (entry.offset_ > size or entry.size_ > size - entry.offset_) {
+        return false;
+    }
+
+    switch (entry.kind_) {
+    case AssetPack::Kind::file:
+        // Handed out as null terminated strings.
+        return entry.size_ > 0 and
+               base[entry.offset_ + entry.size_ - 1] == '\0';
+
+    case AssetPack::Kind::image:
+    case AssetPack::Kind::metatiled_image:
+        return u64(entry.width_) * entry.height_ * 4 <= entry.size_;
+
+    case AssetPack::Kind::sound:
+        return true;
+    }
+
+    return false;
+}
+
+
+bool AssetPack::adopt(const u8* base, u64 size)
+{
+    if (size < sizeof(asset_pack::Header)) {
+        return false;
+    }
+
+    asset_pack::Header header;
+    std::memcpy(&header, base, sizeof header);
+
+    if (header.magic_ not_eq asset_pack::magic or
+        header.version_ not_eq asset_pack::version or
+        sizeof header + u64(header.count_) * sizeof(Entry) > size) {
+        return false;
+    }
+
+    const auto entries = reinterpret_cast<const Entry*>(base + sizeof header);
+
+    for (u32 i = 0; i < header.count_; ++i) {
+        if (not valid(entries[i], base, size)) {
+            return false;
+        }
+    }
+
+    base_ = base;
+    size_ = size;
+    entries_ = entries;
+    count_ = header.count_;
+
+    return true;
+}
+
+
+bool AssetPack::open(const std::string& path)
+{
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (not GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping =
+        CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    // The mapping keeps the file open.
+    CloseHandle(file);
+
+    if (not mapping) {
+        return false;
+    }
+
+    auto base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (not base) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    mapping_ = mapping;
+
+    if (not adopt(static_cast<const u8*>(base), size.QuadPart)) {
+        size_ = size.QuadPart;
+        base_ = static_cast<const u8*>(base);
+        close();
+        return false;
+    }
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1 or st.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    auto base = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping keeps the file open.
+    ::close(fd);
+
+    if (base == MAP_FAILED) {
+        return false;
+    }
+
+    mapping_ = base;
+    size_ = st.st_size;
+
+    if (not adopt(static_cast<const u8*>(base), st.st_size)) {
+        close();
+        return false;
+    }
+#endif
+
+    return true;
+}
+
+
+const AssetPack::Entry* AssetPack::find(Kind kind, u32 hash) const
+{
+    const auto end = entries_ + count_;
+
+    const auto found =
+        std::lower_bound(entries_, end, 0, [&](const Entry& entry, int) {
+            if (entry.kind_ not_eq kind) {
+                return entry.kind_ < kind;
+            }
+            return entry.hash_ < hash;
+        });
+
+    if (found not_eq end and found->kind_ == kind and found->hash_ == hash) {
+        return found;
+    }
+
+    return nullptr;
+}
+
+
+const char*
+AssetPack::file(const char* folder, const char* filename, u32* size) const
+{
+    if (auto entry = find(Kind::file, asset_path_hash(folder, filename))) {
+        if (size) {
+            *size = entry->size_ - 1;
+        }
+        return reinterpret_cast<const char*>(data(*entry));
+    }
+    return nullptr;
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "assetId.hpp"
+#include "number/int.h"
+#include <string>
+#include <vector>
+
+
+// Desktop builds used to read scripts and strings through fstreams, decode a
+// png (and metatile it, for tile0) on every texture swap, and scan the sounds
+// folder at startup. Instead, the build packs the scripts/, strings/, images/,
+// and sounds/ folders into a single archive, assets.pack, in the build
+// directory. The platform maps the archive into memory when it starts up, and
+// hands out pointers into the mapping, so loading an asset never parses a file.
+//
+// The archive holds a header, followed by a table of entries, sorted by kind
+// and hash, followed by the entries' data:
+//
+// file: the file's contents, plus a null terminator, keyed by
+//     asset_path_hash(folder, filename), e.g. ("scripts", "init.lisp").
+//
+// image: decoded rgba pixels, keyed by the image's name, without the .png
+//     extension. Magenta is left as is, the platform masks it out when creating
+//     a texture, as some code (the glyph loader) compares against it.
+//
+// metatiled_image: For images 24 pixels tall, i.e. tilesets metatiled 4x3 for
+//     the gba, the same pixels, rearranged into a single row of 8x8 tiles, for
+//     use as a background texture.
+//
+// sound: 8 bit signed mono pcm, same as the raw files on disk, keyed by the
+//     sound's name, without the sound_ prefix.
+//
+// Music streams from ogg files, and shaders load once at startup, so neither
+// belongs in the archive.
+namespace asset_pack {
+
+
+static constexpr const u32 magic = 0x4b504a42; // "BJPK"
+static constexpr const u32 version = 1;
+
+
+enum class Kind : u32 { file, image, metatiled_image, sound };
+
+
+struct Header {
+    u32 magic_;
+    u32 version_;
+    u32 count_;
+    u32 reserved_;
+};
+
+
+struct Entry {
+    Kind kind_;
+    u32 hash_;
+
+    // Images only.
+    u32 width_;
+    u32 height_;
+
+    // From the start of the archive.
+    u64 offset_;
+    u64 size_;
+};
+
+
+static_assert(sizeof(Header) == 16 and sizeof(Entry) == 32,
+              "the archive layout must not depend on the compiler");
+
+
+struct Item {
+    Entry entry_; // The kind, hash, and (for images) dimensions.
+    std::vector<u8> data_;
+};
+
+
+// Lays the items out in a packed archive. Returns an empty vector, and
+// describes the problem in error_out, if two items share a kind and hash.
+std::vector<u8> write(std::vector<Item> items, std::string& error_out);
+
+
+// Reads every asset under the resource directory root into a packed archive.
+// Returns an empty vector, and describes the problem in error_out, if a file
+// could not be read. See assetPackBuild.cpp.
+std::vector<u8> build(const std::string& root, std::string& error_out);
+
+
+} // namespace asset_pack
+
+
+class AssetPack {
+public:
+    using Entry = asset_pack::Entry;
+    using Kind = asset_pack::Kind;
+
+    AssetPack() = default;
+    AssetPack(const AssetPack&) = delete;
+
+    ~AssetPack();
+
+    // Maps an archive written by the AssetPacker tool. Rejects archives with
+    // entries that reach past the end of the file.
+    bool open(const std::string& path);
+
+    // Packs the resource directory in memory instead, for when the archive
+    // is missing, e.g. when running a build tree that skipped the pack step.
+    bool build(const std::string& root, std::string& error_out);
+
+    const Entry* find(Kind kind, u32 hash) const;
+
+    const u8* data(const Entry& entry) const
+    {
+        return base_ + entry.offset_;
+    }
+
+    // If size is not null, stores the file's length, minus the terminator.
+    const char*
+    file(const char* folder, const char* filename, u32* size = nullptr) const;
+
+    const Entry* image(AssetId name) const
+    {
+        return find(Kind::image, name.hash_);
+    }
+
+    const Entry* sound(AssetId name) const
+    {
+        return find(Kind::sound, name.hash_);
+    }
+
+private:
+    void close();
+
+    bool adopt(const u8* base, u64 size);
+
+    const u8* base_ = nullptr;
+    u64 size_ = 0;
+    const Entry* entries_ = nullptr;
+    u32 count_ = 0;
+
+    // Set when the archive is mapped, rather than built in memory.
+    void* mapping_ = nullptr;
+
+    std::vector<u8> built_;
+};
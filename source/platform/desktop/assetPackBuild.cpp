@@ -0,0 +1,202 @@
+#include "assetPack.hpp"
+#include "SFML/Graphics.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+
+// Reads the resource directory for asset_pack::write(). Kept apart from the
+// archive code in assetPack.cpp, which doesn't depend on sfml, so that the
+// unittests can link it.
+namespace asset_pack {
+
+
+static bool read_file(const std::filesystem::path& path, std::vector<u8>& out)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (not file) {
+        return false;
+    }
+    out.assign(std::istreambuf_iterator<char>(file), {});
+    return true;
+}
+
+
+// Tilesets are metatiled 4x3 for the gba, i.e. each 32x24 block holds twelve
+// 8x8 tiles. The gba uses tile0 for the background layer as well, with 8x8
+// tiles, so we lay each block's three rows out side by side.
+static std::vector<u8> metatile(const u8* pixels, u32 width)
+{
+    static const u32 block_width = 32;
+    static const u32 rows = 3;
+    static const u32 tile_size = 8;
+    static const u32 px_size = 4;
+
+    const u32 meta_width = width * rows;
+
+    std::vector<u8> result(meta_width * tile_size * px_size);
+
+    for (u32 block = 0; block < width / block_width; ++block) {
+        for (u32 row = 0; row < rows; ++row) {
+            const u32 src_x = block * block_width;
+            const u32 dest_x = block * block_width * rows + row * block_width;
+
+            for (u32 y = 0; y < tile_size; ++y) {
+                const u32 src_y = row * tile_size + y;
+
+                std::memcpy(&result[(y * meta_width + dest_x) * px_size],
+                            &pixels[(src_y * width + src_x) * px_size],
+                            block_width * px_size);
+            }
+        }
+    }
+
+    return result;
+}
+
+
+static bool add_files(const std::filesystem::path& root,
+                      const char* folder,
+                      std::vector<Item>& items,
+                      std::string& error_out)
+{
+    for (auto& dirent : std::filesystem::directory_iterator(root / folder)) {
+        if (not dirent.is_regular_file()) {
+            continue;
+        }
+
+        const auto filename = dirent.path().filename().string();
+
+        Item item{};
+        if (not read_file(dirent.path(), item.data_)) {
+            error_out = "failed to read " + dirent.path().string();
+            return false;
+        }
+        item.data_.push_back('\0');
+
+        item.entry_.kind_ = Kind::file;
+        item.entry_.hash_ = asset_path_hash(folder, filename.c_str());
+
+        items.push_back(std::move(item));
+    }
+
+    return true;
+}
+
+
+static bool add_images(const std::filesystem::path& root,
+                       std::vector<Item>& items,
+                       std::string& error_out)
+{
+    for (auto& dirent : std::filesystem::directory_iterator(root / "images")) {
+        if (dirent.path().extension() not_eq ".png") {
+            continue;
+        }
+
+        const auto name = dirent.path().stem().string();
+
+        sf::Image image;
+        if (not image.loadFromFile(dirent.path().string())) {
+            error_out = "failed to decode " + dirent.path().string();
+            return false;
+        }
+
+        const u32 width = image.getSize().x;
+        const u32 height = image.getSize().y;
+        const u8* pixels = image.getPixelsPtr();
+
+        Item item{};
+        item.entry_.kind_ = Kind::image;
+        item.entry_.hash_ = asset_hash(name.c_str());
+        item.entry_.width_ = width;
+        item.entry_.height_ = height;
+        item.data_.assign(pixels, pixels + width * height * 4);
+
+        if (height == 24) {
+            Item meta{};
+            meta.entry_.kind_ = Kind::metatiled_image;
+            meta.entry_.hash_ = item.entry_.hash_;
+            meta.entry_.width_ = width * 3;
+            meta.entry_.height_ = 8;
+            meta.data_ = metatile(pixels, width);
+
+            items.push_back(std::move(meta));
+        }
+
+        items.push_back(std::move(item));
+    }
+
+    return true;
+}
+
+
+static bool add_sounds(const std::filesystem::path& root,
+                       std::vector<Item>& items,
+                       std::string& error_out)
+{
+    static const std::string prefix("sound_");
+
+    for (auto& dirent : std::filesystem::directory_iterator(root / "sounds")) {
+        const auto filename = dirent.path().stem().string();
+
+        if (dirent.path().extension() not_eq ".raw" or
+            filename.compare(0, prefix.size(), prefix) not_eq 0) {
+            continue;
+        }
+
+        const auto name = filename.substr(prefix.size());
+
+        Item item{};
+        if (not read_file(dirent.path(), item.data_)) {
+            error_out = "failed to read " + dirent.path().string();
+            return false;
+        }
+
+        item.entry_.kind_ = Kind::sound;
+        item.entry_.hash_ = asset_hash(name.c_str());
+
+        items.push_back(std::move(item));
+    }
+
+    return true;
+}
+
+
+std::vector<u8> build(const std::string& root, std::string& error_out)
+{
+    std::vector<Item> items;
+
+    const std::filesystem::path root_path(root);
+
+    try {
+        if (not add_files(root_path, "scripts", items, error_out) or
+            not add_files(root_path, "strings", items, error_out) or
+            not add_images(root_path, items, error_out) or
+            not add_sounds(root_path, items, error_out)) {
+            return {};
+        }
+    } catch (const std::filesystem::filesystem_error& err) {
+        error_out = err.what();
+        return {};
+    }
+
+    return write(std::move(items), error_out);
+}
+
+
+} // namespace asset_pack
+
+
+bool AssetPack::build(const std::string& root, std::string& error_out)
+{
+    close();
+
+    built_ = asset_pack::build(root, error_out);
+
+    if (built_.empty()) {
+        return false;
+    }
+
+    return adopt(built_.data(), built_.size());
+}
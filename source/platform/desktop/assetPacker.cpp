@@ -0,0 +1,35 @@
+#include "assetPack.hpp"
+#include <fstream>
+#include <iostream>
+
+
+// Build step for desktop targets: packs the resource directory into the
+// archive that the desktop platform maps at startup (see assetPack.hpp).
+//
+// usage: AssetPacker <resource directory> <output file>
+int main(int argc, char** argv)
+{
+    if (argc not_eq 3) {
+        std::cerr << "usage: " << argv[0] << " <resource dir> <output file>"
+                  << std::endl;
+        return 1;
+    }
+
+    std::string error;
+    const auto pack = asset_pack::build(argv[1], error);
+
+    if (pack.empty()) {
+        std::cerr << "AssetPacker: " << error << std::endl;
+        return 1;
+    }
+
+    std::ofstream out(argv[2], std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(pack.data()), pack.size());
+
+    if (not out) {
+        std::cerr << "AssetPacker: failed to write " << argv[2] << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
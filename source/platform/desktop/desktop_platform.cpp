@@ -1,6 +1,10 @@
+#include "assetPack.hpp"
 #include "number/random.hpp"
+#include "platform/audioMixer.hpp"
+#include "platform/loopbackLink.hpp"
 #include "platform/platform.hpp"
 #include "script/lisp.hpp"
+#include "tileMap.hpp"
 #include <limits>
 
 
@@ -24,12 +28,11 @@
 #include "SFML/Graphics.hpp"
 #include "SFML/Network.hpp"
 #include "SFML/System.hpp"
+#include <atomic>
 #include <chrono>
 #include <cmath>
-#include <filesystem>
 #include <fstream>
 #include <iostream>
-#include <list>
 // The game logic and graphics used to run on different threads. But the game is
 // efficient enough to run on a gameboy, so there isn't really any need for
 // threading.
@@ -51,13 +54,16 @@ std::string resource_path();
 
 
 ////////////////////////////////////////////////////////////////////////////////
-// TileMap
+// TileLayer
 ////////////////////////////////////////////////////////////////////////////////
 
 
-class TileMap : public sf::Drawable, public sf::Transformable {
+class TileLayer : public sf::Drawable, public sf::Transformable {
 public:
-    TileMap(sf::Texture* texture, sf::Vector2u tile_size, int width, int height)
+    TileLayer(sf::Texture* texture,
+              sf::Vector2u tile_size,
+              int width,
+              int height)
         : texture_(texture), tile_size_(tile_size), width_(width),
           height_(height)
     {
@@ -126,6 +132,83 @@ private:
 };
 
 
+////////////////////////////////////////////////////////////////////////////////
+// ChunkedTileLayer
+////////////////////////////////////////////////////////////////////////////////
+
+
+// A tile layer, split into square chunks, each with its own vertex array. The
+// map layers used to be drawn in their entirety into a render texture, which
+// scales poorly when a desktop build configures maps much larger than the
+// screen. Instead, we draw only the chunks that overlap the view, and updating
+// a tile touches only the vertices of its own chunk.
+class ChunkedTileLayer : public sf::Drawable {
+public:
+    static constexpr const int chunk_size = 8;
+
+    ChunkedTileLayer(sf::Texture* texture,
+                     sf::Vector2u tile_size,
+                     int width,
+                     int height)
+        : tile_size_(tile_size), width_(width), height_(height),
+          chunks_x_((width + chunk_size - 1) / chunk_size),
+          chunks_y_((height + chunk_size - 1) / chunk_size)
+    {
+        chunks_.reserve(chunks_x_ * chunks_y_);
+
+        for (int y = 0; y < chunks_y_; ++y) {
+            for (int x = 0; x < chunks_x_; ++x) {
+                chunks_.emplace_back(texture, tile_size, chunk_size, chunk_size);
+                chunks_.back().setPosition(x * chunk_size * tile_size.x,
+                                           y * chunk_size * tile_size.y);
+            }
+        }
+    }
+
+    void set_tile(int x, int y, int index)
+    {
+        if (x < 0 or y < 0 or x >= width_ or y >= height_) {
+            return;
+        }
+
+        chunks_[x / chunk_size + (y / chunk_size) * chunks_x_].set_tile(
+            x % chunk_size, y % chunk_size, index);
+    }
+
+private:
+    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        const auto& view = target.getView();
+
+        const auto top_left = view.getCenter() - view.getSize() / 2.f;
+        const auto bottom_right = view.getCenter() + view.getSize() / 2.f;
+
+        const float chunk_w = chunk_size * tile_size_.x;
+        const float chunk_h = chunk_size * tile_size_.y;
+
+        const int x0 = std::max(0, int(std::floor(top_left.x / chunk_w)));
+        const int y0 = std::max(0, int(std::floor(top_left.y / chunk_h)));
+        const int x1 =
+            std::min(chunks_x_ - 1, int(std::floor(bottom_right.x / chunk_w)));
+        const int y1 =
+            std::min(chunks_y_ - 1, int(std::floor(bottom_right.y / chunk_h)));
+
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                target.draw(chunks_[x + y * chunks_x_], states);
+            }
+        }
+    }
+
+    std::vector<TileLayer> chunks_;
+    sf::Vector2u tile_size_;
+    const int width_;
+    const int height_;
+    const int chunks_x_;
+    const int chunks_y_;
+};
+
+
 ////////////////////////////////////////////////////////////////////////////////
 // Global State Data
 ////////////////////////////////////////////////////////////////////////////////
@@ -137,6 +220,88 @@ static constexpr Vec2<u32> resolution{240, 160};
 static const TileDesc glyph_region_start = 504;
 
 
+// Sound effects play through the portable AudioMixer. The game loop tops up the
+// ring once per frame (see Screen::clear()), and SFML's audio thread drains it.
+using SoundMixer = AudioMixer<16>;
+using SoundRing = AudioRing<4096>;
+
+
+class MixerStream : public sf::SoundStream {
+public:
+    MixerStream(SoundRing& ring) : ring_(ring)
+    {
+        initialize(2, 16000);
+    }
+
+    ~MixerStream()
+    {
+        stop();
+    }
+
+private:
+    bool onGetData(Chunk& data) override
+    {
+        auto count = ring_.read(buffer_.data(), buffer_.size());
+
+        // If the game loop stalls, e.g. while loading a level, we play silence
+        // rather than letting the stream stop.
+        if (count == 0) {
+            count = 256;
+            std::fill(buffer_.begin(), buffer_.begin() + count, AudioFrame{});
+        }
+
+        static_assert(sizeof(AudioFrame) == 2 * sizeof(sf::Int16));
+
+        data.samples = reinterpret_cast<const sf::Int16*>(buffer_.data());
+        data.sampleCount = count * 2;
+
+        return true;
+    }
+
+    void onSeek(sf::Time) override
+    {
+    }
+
+    SoundRing& ring_;
+    std::array<AudioFrame, 512> buffer_;
+};
+
+
+// The build writes the asset pack to its build directory (see
+// build/CMakeLists.txt). Packaged builds, e.g. the mac app bundle, ship the
+// pack alongside the other resources instead.
+static bool open_asset_pack(AssetPack& assets)
+{
+#ifdef __BLINDJUMP_ASSET_PACK
+    if (assets.open(__BLINDJUMP_ASSET_PACK)) {
+        return true;
+    }
+#endif
+    return assets.open(resource_path() + "assets.pack");
+}
+
+
+// Copies pre-decoded pixels out of the asset pack, e.g. ahead of uploading them
+// to a texture.
+static bool load_image(const AssetPack& assets,
+                       AssetPack::Kind kind,
+                       u32 hash,
+                       sf::Image& image)
+{
+    if (auto entry = assets.find(kind, hash)) {
+        image.create(entry->width_, entry->height_, assets.data(*entry));
+        return true;
+    }
+    return false;
+}
+
+
+static bool load_image(const AssetPack& assets, AssetId name, sf::Image& image)
+{
+    return load_image(assets, AssetPack::Kind::image, name.hash_, image);
+}
+
+
 class Platform::Data {
 public:
     sf::Texture spritesheet_texture_;
@@ -159,17 +324,13 @@ public:
 
     sf::Color fade_color_ = sf::Color::Transparent;
 
-    TileMap overlay_;
-    TileMap map_0_;
-    TileMap map_1_;
-    TileMap background_;
+    TileLayer overlay_;
+    ChunkedTileLayer map_0_;
+    ChunkedTileLayer map_1_;
+    TileLayer background_;
 
-    bool map_0_changed_ = false;
-    bool map_1_changed_ = false;
     bool background_changed_ = false;
 
-    sf::RenderTexture map_0_rt_;
-    sf::RenderTexture map_1_rt_;
     sf::RenderTexture background_rt_;
 
     const bool fullscreen_;
@@ -182,16 +343,18 @@ public:
 
     Vec2<u32> window_size_;
 
-    // std::mutex audio_lock_;
     sf::Music music_;
-    std::list<sf::Sound> sounds_;
-    std::map<std::string, sf::SoundBuffer> sound_data_;
+    AssetPack assets_;
+    SoundMixer mixer_;
+    SoundRing audio_ring_;
+    MixerStream mixer_stream_;
+    Vec2<Float> listener_pos_;
 
 
     Data(Platform& pfrm)
         : overlay_(&overlay_texture_, {8, 8}, 32, 32),
-          map_0_(&tile0_texture_, {32, 24}, 16, 20),
-          map_1_(&tile1_texture_, {32, 24}, 16, 20),
+          map_0_(&tile0_texture_, {32, 24}, TileMap::width, TileMap::height),
+          map_1_(&tile1_texture_, {32, 24}, TileMap::width, TileMap::height),
           background_(&background_texture_, {8, 8}, 32, 32),
           fullscreen_( // lisp::loadv<lisp::Integer>("fullscreen").value_
               false),
@@ -217,7 +380,8 @@ public:
                           return sf::Style::Titlebar | sf::Style::Close |
                                  sf::Style::Resize;
                       }
-                  }())
+                  }()),
+          mixer_stream_(audio_ring_)
     {
         window_.setVerticalSyncEnabled(true);
         // window_.setMouseCursorVisible(false);
@@ -227,40 +391,23 @@ public:
 
         rt_.create(240, 160);
 
-        const auto vignette_path =
-            resource_path() + ("images" PATH_DELIMITER) + "vignette.png";
-        if (not vignette_texture_.loadFromFile(vignette_path)) {
-            error(pfrm, "failed to load vignette texture");
-        }
-
-        auto sound_folder = resource_path() + ("sounds" PATH_DELIMITER);
-        // lisp::loadv<lisp::Symbol>("sound-dir").name_;
+        if (not open_asset_pack(assets_)) {
+            warning(pfrm, "missing assets.pack, packing resources in memory");
 
-        for (auto& dirent : std::filesystem::directory_iterator(sound_folder)) {
-            const auto filename = dirent.path().stem().string();
-            static const std::string prefix("sound_");
-            const auto prefix_loc = filename.find(prefix);
-
-            if (prefix_loc not_eq std::string::npos) {
-                std::ifstream file_data(dirent.path(), std::ios::binary);
-                std::vector<s8> buffer(
-                    std::istreambuf_iterator<char>(file_data), {});
-
-                // The gameboy advance sound data was 8 bit signed mono at
-                // 16kHz. Here, we're upsampling to 16bit signed.
-                std::vector<s16> upsampled;
-
-                for (s8 sample : buffer) {
-                    upsampled.push_back(sample << 8);
-                }
-
-                sf::SoundBuffer sound_buffer;
-                sound_buffer.loadFromSamples(
-                    upsampled.data(), upsampled.size(), 1, 16000);
-
-                sound_data_[filename.substr(prefix.size())] = sound_buffer;
+            std::string err;
+            if (not assets_.build(resource_path(), err)) {
+                error(pfrm, ("failed to pack resources: " + err).c_str());
+                exit(EXIT_FAILURE);
             }
         }
+
+        sf::Image vignette;
+        if (not load_image(assets_, "vignette"_asset, vignette) or
+            not vignette_texture_.loadFromImage(vignette)) {
+            error(pfrm, "failed to load vignette texture");
+        }
+
+        mixer_stream_.play();
     }
 };
 
@@ -390,6 +537,23 @@ Microseconds Platform::DeltaClock::reset()
 }
 
 
+Platform::DeltaClock::TimePoint Platform::DeltaClock::sample() const
+{
+    // Wraps around every seventy minutes or so. duration() subtracts unsigned
+    // values, so intervals shorter than that still come out right.
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return TimePoint(
+        u32(std::chrono::duration_cast<std::chrono::microseconds>(now)
+                .count()));
+}
+
+
+Microseconds Platform::DeltaClock::duration(TimePoint t1, TimePoint t2)
+{
+    return u32(t2) - u32(t1);
+}
+
+
 Platform::DeltaClock::~DeltaClock()
 {
     delete reinterpret_cast<sf::Clock*>(impl_);
@@ -712,15 +876,11 @@ void Platform::Screen::clear()
         ::platform->data()->fade_color_);
 
     {
-        // std::lock_guard<std::mutex> guard(::platform->data()->audio_lock_);
-        auto& sounds = ::platform->data()->sounds_;
-        for (auto it = sounds.begin(); it not_eq sounds.end();) {
-            if (it->getStatus() == sf::Sound::Status::Stopped) {
-                it = sounds.erase(it);
-            } else {
-                ++it;
-            }
-        }
+        // Keep about four frames worth of audio queued up for the stream.
+        static const u32 audio_latency = 1024;
+
+        auto& data = *::platform->data();
+        data.mixer_.fill(data.audio_ring_, audio_latency);
     }
 
     {
@@ -729,12 +889,13 @@ void Platform::Screen::clear()
             const auto request = texture_swap_requests.front();
             texture_swap_requests.pop();
 
-            sf::Image image;
+            auto& assets = ::platform->data()->assets_;
+
+            const AssetId name(request.second.c_str());
 
-            auto image_folder = resource_path() + ("images" PATH_DELIMITER);
+            sf::Image image;
 
-            if (not image.loadFromFile(image_folder + request.second +
-                                       ".png")) {
+            if (not load_image(assets, name, image)) {
                 error(*::platform,
                       (std::string("failed to load texture ") + request.second)
                           .c_str());
@@ -744,13 +905,11 @@ void Platform::Screen::clear()
                      (std::string("loaded image ") + request.second).c_str());
             }
             image.createMaskFromColor({255, 0, 255, 255});
-            image.saveToFile("/home/evan/blind-jump-portable/build/test." +
-                             request.second + ".png");
 
             // For space savings on the gameboy advance, I used tile0 for the
-            // background as well. But it was meta-tiled as 4x3, so we need to
-            // create a meta-tiled version of the tile0 for use as the
-            // background texture...
+            // background as well. But it was meta-tiled as 4x3, so we need a
+            // meta-tiled version of the tile0 for use as the background
+            // texture. The asset packer metatiles tilesets ahead of time.
             if (request.first == TextureSwap::tile0) {
                 // But... we need to support loading a non-standard map texture,
                 // for the purpose of displaying images, so do not metatile if
@@ -758,21 +917,14 @@ void Platform::Screen::clear()
                 //
                 if (image.getSize().y not_eq 8) {
                     sf::Image meta_image;
-                    meta_image.create(image.getSize().x * 3, 8);
-
-                    for (size_t block = 0; block < image.getSize().x / 32;
-                         ++block) {
-                        for (int row = 0; row < 3; ++row) {
-                            const int src_x = block * 32;
-                            const int src_y = row * 8;
-
-                            const int dest_x = block * (32 * 3) + row * 32;
-                            const int dest_y = 0;
-
-                            meta_image.copy(
-                                image, dest_x, dest_y, {src_x, src_y, 32, 8});
-                        }
+                    if (not load_image(assets,
+                                       AssetPack::Kind::metatiled_image,
+                                       name.hash_,
+                                       meta_image)) {
+                        error(*::platform, "missing metatiled tileset");
+                        exit(EXIT_FAILURE);
                     }
+                    meta_image.createMaskFromColor({255, 0, 255, 255});
 
                     if (not ::platform->data()
                                 ->background_texture_.loadFromImage(
@@ -832,16 +984,14 @@ void Platform::Screen::clear()
             const auto rq = glyph_requests.front();
             glyph_requests.pop();
 
-            auto image_folder = resource_path() + ("images" PATH_DELIMITER);
-
             sf::Image character_source_image_;
-            const auto charset_path =
-                std::string(image_folder) + rq.second.texture_name_ + ".png";
-            if (not character_source_image_.loadFromFile(charset_path)) {
-                error(
-                    *::platform,
-                    (std::string("failed to open charset image " + charset_path)
-                         .c_str()));
+            if (not load_image(::platform->data()->assets_,
+                               rq.second.texture_name_,
+                               character_source_image_)) {
+                error(*::platform,
+                      (std::string("failed to open charset image ") +
+                       rq.second.texture_name_)
+                          .c_str());
                 exit(EXIT_FAILURE);
             }
 
@@ -909,14 +1059,12 @@ void Platform::Screen::clear()
                 break;
 
             case Layer::map_0:
-                ::platform->data()->map_0_changed_ = true;
                 ::platform->data()->map_0_.set_tile(std::get<1>(request),
                                                     std::get<2>(request),
                                                     std::get<3>(request));
                 break;
 
             case Layer::map_1:
-                ::platform->data()->map_1_changed_ = true;
                 ::platform->data()->map_1_.set_tile(std::get<1>(request),
                                                     std::get<2>(request),
                                                     std::get<3>(request));
@@ -1095,22 +1243,8 @@ void Platform::Screen::display()
                    view_.get_center().y + view_.get_size().y / 2);
     rt.setView(view);
 
-    if (::platform->data()->map_0_changed_) {
-        ::platform->data()->map_0_changed_ = false;
-        ::platform->data()->map_0_rt_.clear(sf::Color::Transparent);
-        ::platform->data()->map_0_rt_.draw(::platform->data()->map_0_);
-        ::platform->data()->map_0_rt_.display();
-    }
-
-    if (::platform->data()->map_1_changed_) {
-        ::platform->data()->map_1_changed_ = false;
-        ::platform->data()->map_1_rt_.clear(sf::Color::Transparent);
-        ::platform->data()->map_1_rt_.draw(::platform->data()->map_1_);
-        ::platform->data()->map_1_rt_.display();
-    }
-
-    rt.draw(sf::Sprite(::platform->data()->map_0_rt_.getTexture()));
-    rt.draw(sf::Sprite(::platform->data()->map_1_rt_.getTexture()));
+    rt.draw(::platform->data()->map_0_);
+    rt.draw(::platform->data()->map_1_);
 
     ::platform->data()->fade_overlay_.setPosition(
         {view_.get_center().x, view_.get_center().y});
@@ -1280,7 +1414,7 @@ void Platform::Screen::draw(const Sprite& spr)
 
 void Platform::Speaker::set_position(const Vec2<Float>& position)
 {
-    // sf::Listener::setPosition({position.x, 0, position.y});
+    ::platform->data()->listener_pos_ = position;
 }
 
 
@@ -1290,15 +1424,15 @@ Platform::Speaker::Speaker()
 }
 
 
-static std::string current_music;
+static u32 current_music;
 
 
-void Platform::Speaker::play_music(const char* name, Microseconds offset)
+void Platform::Speaker::play_music(AssetId name, Microseconds offset)
 {
     std::string path = resource_path() + ("sounds" PATH_DELIMITER);
 
     path += "music_";
-    path += name;
+    path += name.name_;
     path += ".ogg";
 
     if (::platform->data()->music_.openFromFile(path.c_str())) {
@@ -1313,7 +1447,7 @@ void Platform::Speaker::play_music(const char* name, Microseconds offset)
         // stereo isn't really worth the resources on the gameboy).
         ::platform->data()->music_.setVolume(70);
 
-        ::current_music = name;
+        ::current_music = name.hash_;
 
     } else {
         error(*::platform, "failed to load music file");
@@ -1327,56 +1461,56 @@ void Platform::Speaker::stop_music()
 }
 
 
-void Platform::Speaker::play_sound(const char* name,
+void Platform::Speaker::play_sound(AssetId name,
                                    int priority,
                                    std::optional<Vec2<Float>> position)
 {
-    (void)priority; // We are not using the priority variable, because we're a
-                    // powerful desktop pc, we can play lots of sounds at once,
-                    // and do not need to evict sounds! Or do we...? I think
-                    // SFML does have a hard upper limit of 256 concurrent audio
-                    // streams, but we'll probably never hit that limit, given
-                    // that the game was originally calibrated for the gameboy
-                    // advance, where I was supporting four concurrent audio
-                    // streams.
-
-    // std::lock_guard<std::mutex> guard(::platform->data()->audio_lock_);
-    auto& data = ::platform->data()->sound_data_;
-    auto found = data.find(name);
-    if (found not_eq data.end()) {
-        ::platform->data()->sounds_.emplace_back(found->second);
-
-        auto& sound = ::platform->data()->sounds_.back();
-
-        sound.play();
-
-        // sound.setRelativeToListener(static_cast<bool>(position));
-
-        // if (position) {
-        //     sound.setAttenuation(0.2f);
-        // } else {
-        //     sound.setAttenuation(0.f);
-        // }
-
-        // sound.setMinDistance(160.f);
-        // if (position) {
-        //     sound.setPosition({position->x, 0, position->y});
-        // }
+    auto& data = *::platform->data();
+
+    if (auto sound = data.assets_.sound(name)) {
+        StereoLevels levels{volume_levels - 1, volume_levels - 1};
+
+        // Same distance attenuation as the gameboy advance, plus panning
+        // across the width of the screen.
+        if (position) {
+            const auto& listener = data.listener_pos_;
+            const auto dist = distance(*position, listener);
+            const auto pan =
+                (position->x - listener.x) / Float(int(resolution.x));
+
+            levels = stereo_levels(spatial_volume(dist), pan * 2.f);
+        }
+
+        // Same format as the gameboy advance sound data, 8 bit signed mono at
+        // 16kHz, played straight out of the asset pack. The mixer upsamples to
+        // 16 bit on output.
+        data.mixer_.play(
+            reinterpret_cast<const AudioSample*>(data.assets_.data(*sound)),
+            sound->size_,
+            priority,
+            levels);
     } else {
-        error(*::platform, (std::string("no sound data for ") + name).c_str());
+        error(*::platform,
+              (std::string("no sound data for ") + name.name_).c_str());
     }
 }
 
 
-bool is_sound_playing(const char* name)
+bool Platform::Speaker::is_sound_playing(AssetId name)
 {
-    return false; // TODO...
+    auto& data = *::platform->data();
+
+    if (auto sound = data.assets_.sound(name)) {
+        return data.mixer_.is_playing(
+            reinterpret_cast<const AudioSample*>(data.assets_.data(*sound)));
+    }
+    return false;
 }
 
 
-bool Platform::Speaker::is_music_playing(const char* name)
+bool Platform::Speaker::is_music_playing(AssetId name)
 {
-    return ::current_music == name;
+    return ::current_music == name.hash_;
 }
 
 
@@ -1385,16 +1519,102 @@ bool Platform::Speaker::is_music_playing(const char* name)
 ////////////////////////////////////////////////////////////////////////////////
 
 
+// The desktop console reads lines from the terminal that launched the game,
+// e.g. type (perf-watch 60) to stream perf stats while playing. A background
+// thread blocks on stdin, and passes complete lines to the game loop through a
+// lock-free single producer, single consumer ring, so readline() never waits
+// on input.
+class ConsoleLineRing {
+public:
+    using Line = Platform::RemoteConsole::Line;
+
+    static constexpr const u32 capacity = 8;
+
+    // Reader thread only.
+    bool push(const std::string& text)
+    {
+        const auto write = write_.load(std::memory_order_relaxed);
+        if (write - read_.load(std::memory_order_acquire) == capacity) {
+            return false;
+        }
+
+        auto& line = lines_[write % capacity];
+        line.clear();
+        line += text.c_str();
+
+        write_.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Game thread only.
+    std::optional<Line> pop()
+    {
+        const auto read = read_.load(std::memory_order_relaxed);
+        if (read == write_.load(std::memory_order_acquire)) {
+            return {};
+        }
+
+        std::optional<Line> result = lines_[read % capacity];
+
+        read_.store(read + 1, std::memory_order_release);
+        return result;
+    }
+
+private:
+    std::array<Line, capacity> lines_;
+    std::atomic<u32> read_{0};
+    std::atomic<u32> write_{0};
+};
+
+
+static ConsoleLineRing console_lines;
+
+
+static void console_reader()
+{
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (not line.empty() and line.back() == '\r') {
+            line.pop_back();
+        }
+
+        if (line.empty()) {
+            continue;
+        }
+
+        // The game loop drains one line per frame, so the ring only fills up
+        // if someone pastes a lot of lines at once.
+        while (not console_lines.push(line)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(16));
+        }
+    }
+}
+
+
 auto Platform::RemoteConsole::readline() -> std::optional<Line>
 {
-    // TODO...
-    return {};
+    // When nobody's attached to stdin, e.g. when launched from a desktop
+    // shortcut, getline() fails right away, and the reader thread exits.
+    [[gnu::unused]] static const bool reader_started = [] {
+        std::thread(console_reader).detach();
+        return true;
+    }();
+
+    return console_lines.pop();
 }
 
 
 bool Platform::RemoteConsole::printline(const char* text, bool show_prompt)
 {
-    return false;
+    std::cout << text << '\n';
+
+    if (show_prompt) {
+        std::cout << "> ";
+    }
+
+    std::cout.flush();
+
+    return true;
 }
 
 
@@ -1581,8 +1801,6 @@ Platform::Platform()
         {Float(screen_.size().x), Float(screen_.size().y)});
 
 
-    data_->map_0_rt_.create(16 * 32, 20 * 24);
-    data_->map_1_rt_.create(16 * 32, 20 * 24);
     data_->background_rt_.create(32 * 8, 32 * 8);
 
     keymap[(int)Key::left] = sf::Keyboard::Left;
@@ -1651,48 +1869,42 @@ void Platform::sleep(u32 frames)
 }
 
 
-void Platform::load_sprite_texture(const char* name)
+void Platform::load_sprite_texture(AssetId name)
 {
     // std::lock_guard<std::mutex> guard(texture_swap_mutex);
-    texture_swap_requests.push({TextureSwap::spritesheet, name});
+    texture_swap_requests.push({TextureSwap::spritesheet, name.name_});
 }
 
 
-void Platform::load_tile0_texture(const char* name)
+void Platform::load_tile0_texture(AssetId name)
 {
     // std::lock_guard<std::mutex> guard(texture_swap_mutex);
-    texture_swap_requests.push({TextureSwap::tile0, name});
+    texture_swap_requests.push({TextureSwap::tile0, name.name_});
 }
 
 
-void Platform::load_tile1_texture(const char* name)
+void Platform::load_tile1_texture(AssetId name)
 {
     // std::lock_guard<std::mutex> guard(texture_swap_mutex);
-    texture_swap_requests.push({TextureSwap::tile1, name});
+    texture_swap_requests.push({TextureSwap::tile1, name.name_});
 }
 
 
-bool Platform::overlay_texture_exists(const char* name)
+bool Platform::overlay_texture_exists(AssetId name)
 {
-    auto image_folder = resource_path() + ("images" PATH_DELIMITER);
-
-    std::ifstream f(image_folder + name + ".txt");
-    return f.good();
+    return ::platform->data()->assets_.image(name) not_eq nullptr;
 }
 
 
-bool Platform::load_overlay_texture(const char* name)
+bool Platform::load_overlay_texture(AssetId name)
 {
-    auto image_folder = resource_path() + ("images" PATH_DELIMITER);
-
-    std::ifstream f(image_folder + name + ".txt");
-    if (not f.good()) {
+    if (not overlay_texture_exists(name)) {
         return false;
     }
 
     {
         // std::lock_guard<std::mutex> guard(texture_swap_mutex);
-        texture_swap_requests.push({TextureSwap::overlay, name});
+        texture_swap_requests.push({TextureSwap::overlay, name.name_});
     }
     {
         // std::lock_guard<std::mutex> guard(glyph_requests_mutex);
@@ -1732,6 +1944,14 @@ void Platform::set_tile(u16 x, u16 y, TileDesc glyph, const FontColors& colors)
 }
 
 
+void Platform::set_tiles(u16 x, u16 y, const TileDesc* tiles, u32 count)
+{
+    for (u32 i = 0; i < count; ++i) {
+        set_tile(Layer::overlay, x + i, y, tiles[i]);
+    }
+}
+
+
 TileDesc Platform::get_tile(Layer layer, u16 x, u16 y)
 {
     return tile_layers_[layer][{x, y}];
@@ -1804,24 +2024,60 @@ void Platform::feed_watchdog()
 }
 
 
-static std::map<std::string, std::string> files;
+// Files written since the build packed the resource folders, e.g. recorded
+// replays.
+static std::map<std::string, std::string> loose_files;
 
 
 const char* Platform::load_file_contents(const char* folder,
-                                         const char* filename) const
+                                         const char* filename,
+                                         u32* size) const
 {
+    // Null terminated in the asset pack, so we return a pointer into the
+    // mapping, without copying.
+    if (auto contents = data_->assets_.file(folder, filename, size)) {
+        return contents;
+    }
+
     const auto name = std::string(folder) + PATH_DELIMITER + filename;
-    const auto found = files.find(name);
-    if (found == files.end()) {
-        std::fstream file(resource_path() + name);
+
+    auto found = loose_files.find(name);
+    if (found == loose_files.end()) {
+        std::ifstream file(resource_path() + name, std::ios::binary);
+        if (not file) {
+            return nullptr;
+        }
+
         std::stringstream buffer;
         buffer << file.rdbuf();
-        files[name] = buffer.str();
-    } else {
-        return found->second.c_str();
+        found = loose_files.emplace(name, buffer.str()).first;
+    }
+
+    if (size) {
+        *size = found->second.size();
     }
 
-    return files[name].c_str();
+    return found->second.c_str();
+}
+
+
+bool Platform::write_file_contents(const char* folder,
+                                   const char* filename,
+                                   const void* data,
+                                   u32 length,
+                                   bool append)
+{
+    const auto name = std::string(folder) + PATH_DELIMITER + filename;
+
+    loose_files.erase(name);
+
+    const auto mode =
+        std::ios::binary | (append ? std::ios::app : std::ios::trunc);
+
+    std::ofstream file(resource_path() + name, mode);
+    file.write(reinterpret_cast<const char*>(data), length);
+
+    return file.good();
 }
 
 
@@ -1852,6 +2108,10 @@ const char* Platform::get_opt(char opt)
             op.add<popl::Switch>("h", "help", "produce help message");
         auto eval_option =
             op.add<popl::Value<std::string>>("e", "eval", "evaluate lisp");
+        auto record_option = op.add<popl::Value<std::string>>(
+            "r", "record", "record a replay, to replays/<name>");
+        auto replay_option = op.add<popl::Value<std::string>>(
+            "p", "replay", "play back replays/<name>, and report frame times");
 
         op.parse(::argc, ::argv);
 
@@ -1862,6 +2122,20 @@ const char* Platform::get_opt(char opt)
                 return eval_result.c_str();
             }
             break;
+
+        case 'r':
+            if (record_option->is_set()) {
+                static std::string record_name = record_option->value();
+                return record_name.c_str();
+            }
+            break;
+
+        case 'p':
+            if (replay_option->is_set()) {
+                static std::string replay_name = replay_option->value();
+                return replay_name.c_str();
+            }
+            break;
         }
     } catch (...) {
         // ... TODO ...
@@ -1907,9 +2181,62 @@ struct NetworkPeerImpl {
     sf::TcpListener listener_;
     bool is_host_ = false;
     int poll_consume_position_ = 0;
+
+    // Set when the peer talks over the in-process loopback link rather than
+    // a socket.
+    std::optional<LoopbackLink::Side> loopback_;
 };
 
 
+// When the network-loopback variable is set, listen() and connect() attach to
+// a simulated serial link within the same process, rather than opening a tcp
+// socket. Create a second NetworkPeer and connect() it, to drive the other end
+// of the link from a test harness. The loopback-* variables configure the link.
+static LoopbackLink loopback_link;
+static std::chrono::steady_clock::time_point loopback_last_update;
+
+
+static int loopback_param(const char* name, int default_value)
+{
+    auto var = lisp::get_var(name);
+    if (var->type() == lisp::Value::Type::integer) {
+        return var->integer().value_;
+    }
+    return default_value;
+}
+
+
+static bool loopback_enabled()
+{
+    return loopback_param("network-loopback", 0);
+}
+
+
+static void loopback_attach(NetworkPeerImpl& impl, LoopbackLink::Side side)
+{
+    if (not loopback_link.is_connected()) {
+        LoopbackLink::Config config;
+
+        config.message_interval_ =
+            loopback_param("loopback-interval", config.message_interval_);
+        config.latency_ = loopback_param("loopback-latency", config.latency_);
+        config.jitter_ = loopback_param("loopback-jitter", config.jitter_);
+        config.drop_percent_ =
+            loopback_param("loopback-loss", config.drop_percent_);
+
+        loopback_link.configure(config);
+    }
+
+    loopback_link.attach(side);
+    loopback_last_update = std::chrono::steady_clock::now();
+
+    impl.loopback_ = side;
+    impl.is_host_ = side == LoopbackLink::host;
+
+    info(*::platform, "attached to loopback link");
+}
+
+
 Platform::NetworkPeer::NetworkPeer() : impl_(nullptr)
 {
     auto impl = new NetworkPeerImpl;
@@ -1923,6 +2250,13 @@ Platform::NetworkPeer::NetworkPeer() : impl_(nullptr)
 void Platform::NetworkPeer::disconnect()
 {
     auto impl = (NetworkPeerImpl*)impl_;
+
+    if (impl->loopback_) {
+        loopback_link.detach(*impl->loopback_);
+        impl->loopback_.reset();
+        return;
+    }
+
     impl->socket_.disconnect();
 
     if (is_connected()) {
@@ -1947,6 +2281,11 @@ void Platform::NetworkPeer::listen()
 {
     auto impl = (NetworkPeerImpl*)impl_;
 
+    if (loopback_enabled()) {
+        loopback_attach(*impl, LoopbackLink::host);
+        return;
+    }
+
     auto port = lisp::loadv<lisp::Integer>("network-port").value_;
 
     info(*::platform, ("listening on port " + std::to_string(port)).c_str());
@@ -1965,6 +2304,11 @@ void Platform::NetworkPeer::connect(const char* peer)
 {
     auto impl = (NetworkPeerImpl*)impl_;
 
+    if (loopback_enabled()) {
+        loopback_attach(*impl, LoopbackLink::guest);
+        return;
+    }
+
     impl->is_host_ = false;
 
     auto port = lisp::loadv<lisp::Integer>("network-port").value_;
@@ -1990,6 +2334,11 @@ void Platform::NetworkPeer::connect(const char* peer)
 bool Platform::NetworkPeer::is_connected() const
 {
     auto impl = (NetworkPeerImpl*)impl_;
+
+    if (impl->loopback_) {
+        return loopback_link.is_connected();
+    }
+
     return impl->socket_.getRemoteAddress() not_eq sf::IpAddress::None;
 }
 
@@ -1998,6 +2347,10 @@ bool Platform::NetworkPeer::send_message(const Message& message)
 {
     auto impl = (NetworkPeerImpl*)impl_;
 
+    if (impl->loopback_) {
+        return loopback_link.send(*impl->loopback_, message);
+    }
+
     std::size_t sent = 0;
     impl->socket_.send(message.data_, message.length_, sent);
 
@@ -2017,6 +2370,20 @@ void Platform::NetworkPeer::update()
 {
     auto impl = (NetworkPeerImpl*)impl_;
 
+    if (impl->loopback_) {
+        // Both ends of the link call update() every frame, so advance the link
+        // by the time elapsed since whichever peer updated it last.
+        const auto now = std::chrono::steady_clock::now();
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                now - loopback_last_update);
+        loopback_last_update = now;
+
+        loopback_link.update(elapsed.count());
+        loopback_link.compact(*impl->loopback_);
+        return;
+    }
+
     if (impl->poll_consume_position_) {
         receive_buffer.erase(receive_buffer.begin(),
                              receive_buffer.begin() +
@@ -2049,6 +2416,10 @@ Platform::NetworkPeer::poll_message()
 {
     auto impl = (NetworkPeerImpl*)impl_;
 
+    if (impl->loopback_) {
+        return loopback_link.poll_message(*impl->loopback_);
+    }
+
     if (receive_buffer.empty()) {
         return {};
     }
@@ -2065,6 +2436,12 @@ Platform::NetworkPeer::poll_message()
 void Platform::NetworkPeer::poll_consume(u32 length)
 {
     auto impl = (NetworkPeerImpl*)impl_;
+
+    if (impl->loopback_) {
+        loopback_link.poll_consume(*impl->loopback_, length);
+        return;
+    }
+
     impl->poll_consume_position_ += length;
 }
 
@@ -2077,6 +2454,12 @@ Platform::NetworkPeer::~NetworkPeer()
 
 Platform::NetworkPeer::Stats Platform::NetworkPeer::stats()
 {
+    auto impl = (NetworkPeerImpl*)impl_;
+
+    if (impl->loopback_) {
+        return loopback_link.stats(*impl->loopback_);
+    }
+
     return {0, 0, 0, 0, 0};
 }
 
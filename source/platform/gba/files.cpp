@@ -23,7 +23,7 @@ extern const unsigned char file_french[];
 extern const unsigned char file_german[];
 //
 
-static const struct {
+static constexpr struct {
     const char* root_;
     const char* name_;
     const unsigned char* data_;
@@ -52,3 +52,8 @@ static const struct {
     {"strings", "german.txt", file_german},
 //
 };
+
+
+static constexpr auto file_index = make_asset_index(files, [](auto& file) {
+    return asset_path_hash(file.root_, file.name_);
+});
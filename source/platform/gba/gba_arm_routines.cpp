@@ -44,18 +44,12 @@ void audio_update_fast_isr()
 {
     alignas(4) AudioSample mixing_buffer[8];
 
-    auto& music_pos = snd_ctx.music_track_pos;
-    const auto music_len = snd_ctx.music_track_length;
-
-
-    if (music_pos > music_len) {
-        music_pos = 0;
-    }
-    // Load 8 music samples upfront (in chunks of four), to try to take
-    // advantage of sequential cartridge reads.
-    auto music_in = (u32*)mixing_buffer;
-    *(music_in++) = ((u32*)(snd_ctx.music_track))[music_pos++];
-    *(music_in) = ((u32*)(snd_ctx.music_track))[music_pos++];
+    // Fetch 8 music samples upfront. An adpcm track (DEF_MUSIC) packs all
+    // eight into one cartridge word, plus a header word at the start of each
+    // block, and decodes them with lookups into adpcm's step and index tables,
+    // which live in iwram. A pcm track (DEF_PCM_MUSIC) stores the samples as
+    // is, and takes two cartridge words.
+    music_fill(snd_ctx, mixing_buffer);
 
     auto it = snd_ctx.active_sounds.begin();
     while (it not_eq snd_ctx.active_sounds.end()) {
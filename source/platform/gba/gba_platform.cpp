@@ -10,9 +10,12 @@
 #ifdef __GBA__
 
 #include "bulkAllocator.hpp"
+#include "compression.hpp"
 #include "gba_color.hpp"
 #include "gbp_logo.hpp"
+#include "graphics/paletteCache.hpp"
 #include "graphics/overlay.hpp"
+#include "graphics/spriteBudget.hpp"
 #include "localization.hpp"
 #include "number/random.hpp"
 #include "platform/platform.hpp"
@@ -445,10 +448,15 @@ static auto affine_transform_back_buffer =
     reinterpret_cast<ObjectAffineMatrix*>(object_attribute_back_buffer);
 
 
-static const u32 affine_transform_limit = 32;
+static const u32 affine_transform_limit =
+    Platform::Screen::affine_transform_limit;
 static u32 affine_transform_write_index = 0;
 static u32 last_affine_transform_write_index = 0;
 
+// The rotation and scale of each matrix written this frame, so that sprites
+// with the same transform can share a matrix.
+static SpriteAffineKey affine_transform_keys[affine_transform_limit];
+
 
 static volatile u16* bg0_control = (volatile u16*)0x4000008;
 static volatile u16* bg1_control = (volatile u16*)0x400000a;
@@ -680,8 +688,6 @@ using PaletteBank = int;
 constexpr PaletteBank available_palettes = 3;
 constexpr PaletteBank palette_count = 16;
 
-static PaletteBank palette_counter = available_palettes;
-
 
 static u8 screen_pixelate_amount = 0;
 
@@ -707,16 +713,17 @@ static Color nightmode_adjust(const Color& c)
 }
 
 
-// For the purpose of saving cpu cycles. The color_mix function scans a list of
-// previous results, and if one matches the current blend parameters, the caller
-// will set the locked_ field to true, and return the index of the existing
-// palette bank. Each call to display() unlocks all of the palette infos.
-static struct PaletteInfo {
-    ColorConstant color_ = ColorConstant::null;
-    u8 blend_amount_ = 0;
-    bool locked_ = false;
-    bool used_ = false;
-} palette_info[palette_count] = {};
+// Banks three through fifteen hold sprite palettes blended with a color, see
+// color_mix().
+static PaletteCache<available_palettes, palette_count> palette_cache;
+
+
+// Sprites from the previous frame may still use a bank that the cache hands
+// out for a new mix, until Screen::display() copies the new frame's sprites
+// into OAM. So color_mix() blends into this back buffer, and display() copies
+// the banks marked in mixed_palette_dirty_banks along with OAM.
+static u16 mixed_palette_back_buffer[palette_count][16] alignas(u32);
+static u16 mixed_palette_dirty_banks;
 
 
 // We want to be able to disable color mixes during a screen fade. We perform a
@@ -735,79 +742,34 @@ static PaletteBank color_mix(ColorConstant k, u8 amount)
         return 0;
     }
 
-    for (PaletteBank palette = available_palettes; palette < 16; ++palette) {
-        auto& info = palette_info[palette];
-        if (info.color_ == k and info.blend_amount_ == amount) {
-            info.locked_ = true;
-            info.used_ = true;
-            return palette;
-        }
-    }
-
-    // Skip over any palettes that are in use
-    while (palette_info[palette_counter].locked_) {
-        if (UNLIKELY(palette_counter == palette_count)) {
-            return 0;
-        }
-        ++palette_counter;
-    }
-
-    if (UNLIKELY(palette_counter == palette_count)) {
-        // Ok, so in this instance, we ran out of unused palettes, but there may
-        // be a palette that was used in the last frame, and which has not yet
-        // been referenced while rendering the current frame. Unlock that
-        // palette and use it. Note that doing this could cause sprites to
-        // flicker, because there's still a sprite in the OAM front buffer using
-        // the locked-but-not-used palette bank. We would not need two booleans,
-        // locked_ and used_, in the table for keeping state if we simply used a
-        // palette back buffer, but adding a back buffer for the OAM palettes
-        // complicates the logic in other ways, uses more memory, and would
-        // require us to copy the whole sprite palette bank into VRAM on every
-        // frame. Because we typically aren't exhausting our supply of ColorMix
-        // palettes anyway, we don't do double buffering for sprite palettes,
-        // and instead, consciously avoid writing to palette banks used by
-        // sprites in the previous frame, unless we really run out of palettes
-        // (which is a rare case, so not worth the cost of double buffering,
-        // IMO).
-        if (auto salvaged_palette = [&] {
-                for (PaletteBank palette = available_palettes; palette < 16;
-                     ++palette) {
-                    auto& info = palette_info[palette];
-                    if (info.locked_ and not info.used_) {
-                        return palette;
-                    }
-                }
-                return 0;
-            }()) {
-            palette_counter = salvaged_palette;
-        } else {
-            return 0;
-        }
+    const auto result = palette_cache.acquire(k, amount);
+    if (not result.fill_) {
+        return result.bank_;
     }
 
     const auto c = nightmode_adjust(real_color(k));
 
+    auto& bank = mixed_palette_back_buffer[result.bank_];
+
     if (amount not_eq 255) {
         for (int i = 0; i < 16; ++i) {
             auto from = Color::from_bgr_hex_555(MEM_PALETTE[i]);
-            const u32 index = 16 * palette_counter + i;
-            MEM_PALETTE[index] = Color(fast_interpolate(c.r_, from.r_, amount),
-                                       fast_interpolate(c.g_, from.g_, amount),
-                                       fast_interpolate(c.b_, from.b_, amount))
-                                     .bgr_hex_555();
+            bank[i] = Color(fast_interpolate(c.r_, from.r_, amount),
+                            fast_interpolate(c.g_, from.g_, amount),
+                            fast_interpolate(c.b_, from.b_, amount))
+                          .bgr_hex_555();
         }
     } else {
         for (int i = 0; i < 16; ++i) {
-            const u32 index = 16 * palette_counter + i;
             // No need to actually perform the blend operation if we're mixing
             // in 100% of the other color.
-            MEM_PALETTE[index] = c.bgr_hex_555();
+            bank[i] = c.bgr_hex_555();
         }
     }
 
-    palette_info[palette_counter] = {k, amount, true, true};
+    mixed_palette_dirty_banks |= 1 << result.bank_;
 
-    return palette_counter++;
+    return result.bank_;
 }
 
 
@@ -872,10 +834,18 @@ void Platform::Screen::draw(const Sprite& spr)
 
         oa->attribute_0 &= (0xff00 & ~((1 << 8) | (1 << 9))); // clear attr0
 
-        if (spr.get_rotation() or spr.get_scale().x or spr.get_scale().y) {
-            if (affine_transform_write_index not_eq affine_transform_limit) {
-                auto& affine =
-                    affine_transform_back_buffer[affine_transform_write_index];
+        if (sprite_is_affine(spr)) {
+            const auto key = sprite_affine_key(spr);
+
+            u32 index = 0;
+            while (index < affine_transform_write_index and
+                   affine_transform_keys[index] not_eq key) {
+                ++index;
+            }
+
+            if (index == affine_transform_write_index and
+                index not_eq affine_transform_limit) {
+                auto& affine = affine_transform_back_buffer[index];
 
                 if (spr.get_rotation() and
                     (spr.get_scale().x or spr.get_scale().y)) {
@@ -888,15 +858,18 @@ void Platform::Screen::draw(const Sprite& spr)
                     affine.scale(spr.get_scale().x, spr.get_scale().y);
                 }
 
+                affine_transform_keys[index] = key;
+                affine_transform_write_index += 1;
+            }
+
+            if (index < affine_transform_write_index) {
                 oa->attribute_0 |= 1 << 8;
                 oa->attribute_0 |= 1 << 9;
 
                 abs_position.x -= 8;
                 abs_position.y -= 16;
 
-                oa->attribute_1 |= affine_transform_write_index << 9;
-
-                affine_transform_write_index += 1;
+                oa->attribute_1 |= index << 9;
             }
         } else {
             const auto& flip = spr.get_flip();
@@ -1061,30 +1034,34 @@ static void keypad_isr()
 
 
 static ScreenBlock overlay_back_buffer alignas(u32);
-static bool overlay_back_buffer_changed = false;
+
+// One bit for each row of the overlay, set when we write to the row in the back
+// buffer. Screen::display() only copies the rows marked here into vram, so
+// updating a line of text costs one row, rather than the whole screen. All
+// rows start out dirty, to clear whatever vram held at boot.
+static u32 overlay_dirty_rows = ~0;
 
 
 void Platform::Screen::display()
 {
     // platform->stopwatch().start();
 
-    if (overlay_back_buffer_changed) {
-        overlay_back_buffer_changed = false;
-
-        // If the overlay has not scrolled, then we do not need to bother with
-        // the lower twelve rows of the overlay tile data, because the screen is
-        // twenty tiles tall. This hack could be problematic if someone scrolls
-        // the screen a lot without editing the overlay.
-        if (overlay_y == 0) {
-            memcpy32(MEM_SCREENBLOCKS[sbb_overlay_tiles],
-                     overlay_back_buffer,
-                     (sizeof(u16) * (21 * 32)) / 4);
-        } else {
-            memcpy32(MEM_SCREENBLOCKS[sbb_overlay_tiles],
-                     overlay_back_buffer,
-                     (sizeof overlay_back_buffer) / 4);
+    // Copy each run of adjacent dirty rows with a single memcpy32.
+    for (u32 rows = overlay_dirty_rows; rows;) {
+        const int first = __builtin_ctz(rows);
+        const u32 run = rows >> first;
+        const int count = ~run == 0 ? 32 : __builtin_ctz(~run);
+
+        memcpy32(&MEM_SCREENBLOCKS[sbb_overlay_tiles][first * 32],
+                 &overlay_back_buffer[first * 32],
+                 (sizeof(u16) * 32 * count) / 4);
+
+        if (first + count == 32) {
+            break;
         }
+        rows &= ~0u << (first + count);
     }
+    overlay_dirty_rows = 0;
 
     for (u32 i = oam_write_index; i < last_oam_write_index; ++i) {
         // Disable affine transform for unused sprite
@@ -1113,19 +1090,20 @@ void Platform::Screen::display()
              object_attribute_back_buffer,
              (sizeof object_attribute_back_buffer) / 4);
 
+    for (u32 banks = mixed_palette_dirty_banks; banks; banks &= banks - 1) {
+        const int bank = __builtin_ctz(banks);
+        memcpy32(&MEM_PALETTE[bank * 16],
+                 mixed_palette_back_buffer[bank],
+                 (sizeof mixed_palette_back_buffer[bank]) / 4);
+    }
+    mixed_palette_dirty_banks = 0;
+
     last_affine_transform_write_index = affine_transform_write_index;
     affine_transform_write_index = 0;
 
     last_oam_write_index = oam_write_index;
     oam_write_index = 0;
-    palette_counter = available_palettes;
-
-    for (auto& info : palette_info) {
-        if (not info.used_) {
-            info.locked_ = false;
-        }
-        info.used_ = false;
-    }
+    palette_cache.next_frame();
 
     auto view_offset = view_.get_center().cast<s32>();
 
@@ -1204,12 +1182,12 @@ init_palette(const TextureData* td, u16* palette, bool skip_contrast)
             const auto c =
                 nightmode_adjust(Color::from_bgr_hex_555(td->palette_data_[i]));
 
-            const auto r =
-                clamp(f * (Color::upsample(c.r_) - 128) + 128, 0.f, 255.f);
-            const auto g =
-                clamp(f * (Color::upsample(c.g_) - 128) + 128, 0.f, 255.f);
-            const auto b =
-                clamp(f * (Color::upsample(c.b_) - 128) + 128, 0.f, 255.f);
+            const auto r = clamp(
+                f * (Color::upsample(c.r_) - 128) + 128, Float(0), Float(255));
+            const auto g = clamp(
+                f * (Color::upsample(c.g_) - 128) + 128, Float(0), Float(255));
+            const auto b = clamp(
+                f * (Color::upsample(c.b_) - 128) + 128, Float(0), Float(255));
 
             palette[i] = Color(Color::downsample(r),
                                Color::downsample(g),
@@ -1245,6 +1223,10 @@ void Platform::Screen::enable_night_mode(bool enabled)
     for (int i = 0; i < 16; ++i) {
         MEM_BG_PALETTE[16 + i] = overlay_palette[i];
     }
+
+    // The color mixes blend in the night mode adjustment, and the old sprite
+    // palette.
+    palette_cache.invalidate();
 }
 
 
@@ -1281,6 +1263,28 @@ static bool validate_overlay_texture_size(Platform& pfrm, size_t size)
 }
 
 
+// The size of an image's tiles in vram, for images compressed in the rom as
+// well as uncompressed ones.
+static u32 tile_data_size(const TextureData& info)
+{
+    if (info.compressed_) {
+        return compression::decompressed_size(info.tile_data_);
+    }
+    return info.tile_data_length_;
+}
+
+
+// Copies an image's tiles into vram, decompressing them on the way if needed.
+static void load_tile_data(const TextureData& info, void* dest)
+{
+    if (info.compressed_) {
+        compression::decompress(info.tile_data_, dest);
+    } else {
+        memcpy16(dest, info.tile_data_, info.tile_data_length_ / 2);
+    }
+}
+
+
 COLD static void set_map_tile(u8 base, u16 x, u16 y, u16 tile_id, int palette)
 {
     // NOTE: The game's tiles are 32x24px in size. GBA tiles are each
@@ -1545,6 +1549,10 @@ void Platform::Screen::fade(float amount,
     last_color = k;
     last_fade_include_sprites = include_sprites;
 
+    // The color mixes blend against the sprite palette in bank zero, which
+    // we're about to change.
+    palette_cache.invalidate();
+
     const auto c = nightmode_adjust(real_color(k));
 
     if (not base) {
@@ -1660,34 +1668,34 @@ std::optional<Platform::DynamicTexturePtr> Platform::make_dynamic_texture()
 }
 
 
-void Platform::load_sprite_texture(const char* name)
+void Platform::load_sprite_texture(AssetId name)
 {
     for (auto& mapping : dynamic_texture_mappings) {
         mapping.dirty_ = true;
     }
 
-    for (auto& info : sprite_textures) {
+    if (auto found = find_asset(sprite_textures, sprite_texture_index, name)) {
+        auto& info = *found;
 
-        if (str_cmp(name, info.name_) == 0) {
+        current_spritesheet = &info;
 
-            current_spritesheet = &info;
+        init_palette(current_spritesheet, sprite_palette, false);
 
-            init_palette(current_spritesheet, sprite_palette, false);
+        // The color mixes blend against the old palette.
+        palette_cache.invalidate();
 
+        // NOTE: There are four tile blocks, so index four points to the
+        // end of the tile memory.
+        memcpy16((void*)&MEM_TILE[4][1],
+                 info.tile_data_,
+                 std::min((u32)16128, info.tile_data_length_ / 2));
 
-            // NOTE: There are four tile blocks, so index four points to the
-            // end of the tile memory.
-            memcpy16((void*)&MEM_TILE[4][1],
-                     info.tile_data_,
-                     std::min((u32)16128, info.tile_data_length_ / 2));
-
-            // We need to do this, otherwise whatever screen fade is currently
-            // active will be overwritten by the copy.
-            const auto c = nightmode_adjust(real_color(last_color));
-            for (int i = 0; i < 16; ++i) {
-                auto from = Color::from_bgr_hex_555(sprite_palette[i]);
-                MEM_PALETTE[i] = blend(from, c, last_fade_amt);
-            }
+        // We need to do this, otherwise whatever screen fade is currently
+        // active will be overwritten by the copy.
+        const auto c = nightmode_adjust(real_color(last_color));
+        for (int i = 0; i < 16; ++i) {
+            auto from = Color::from_bgr_hex_555(sprite_palette[i]);
+            MEM_PALETTE[i] = blend(from, c, last_fade_amt);
         }
     }
 
@@ -1697,75 +1705,67 @@ void Platform::load_sprite_texture(const char* name)
 }
 
 
-void Platform::load_tile0_texture(const char* name)
+void Platform::load_tile0_texture(AssetId name)
 {
-    for (auto& info : tile_textures) {
+    if (auto found = find_asset(tile_textures, tile_texture_index, name)) {
+        auto& info = *found;
 
-        if (str_cmp(name, info.name_) == 0) {
+        current_tilesheet0 = &info;
 
-            current_tilesheet0 = &info;
+        init_palette(current_tilesheet0, tilesheet_0_palette, false);
 
-            init_palette(current_tilesheet0, tilesheet_0_palette, false);
 
+        // We don't want to load the whole palette into memory, we might
+        // overwrite palettes used by someone else, e.g. the overlay...
+        //
+        // Also, like the sprite texture, we need to apply the currently
+        // active screen fade while modifying the color palette.
+        const auto c = nightmode_adjust(real_color(last_color));
+        for (int i = 0; i < 16; ++i) {
+            auto from = Color::from_bgr_hex_555(tilesheet_0_palette[i]);
+            MEM_BG_PALETTE[i] = blend(from, c, last_fade_amt);
+        }
 
-            // We don't want to load the whole palette into memory, we might
-            // overwrite palettes used by someone else, e.g. the overlay...
-            //
-            // Also, like the sprite texture, we need to apply the currently
-            // active screen fade while modifying the color palette.
-            const auto c = nightmode_adjust(real_color(last_color));
-            for (int i = 0; i < 16; ++i) {
-                auto from = Color::from_bgr_hex_555(tilesheet_0_palette[i]);
-                MEM_BG_PALETTE[i] = blend(from, c, last_fade_amt);
-            }
-
-            if (validate_tilemap_texture_size(*this, info.tile_data_length_)) {
-                memcpy16((void*)&MEM_SCREENBLOCKS[sbb_t0_texture][0],
-                         info.tile_data_,
-                         info.tile_data_length_ / 2);
-            } else {
-                StringBuffer<45> buf = "unable to load: ";
-                buf += name;
+        if (validate_tilemap_texture_size(*this, tile_data_size(info))) {
+            load_tile_data(info, &MEM_SCREENBLOCKS[sbb_t0_texture][0]);
+        } else {
+            StringBuffer<45> buf = "unable to load: ";
+            buf += name.name_;
 
-                error(*this, buf.c_str());
-            }
+            error(*this, buf.c_str());
         }
     }
 }
 
 
-void Platform::load_tile1_texture(const char* name)
+void Platform::load_tile1_texture(AssetId name)
 {
-    for (auto& info : tile_textures) {
+    if (auto found = find_asset(tile_textures, tile_texture_index, name)) {
+        auto& info = *found;
 
-        if (str_cmp(name, info.name_) == 0) {
+        current_tilesheet1 = &info;
 
-            current_tilesheet1 = &info;
+        init_palette(current_tilesheet1, tilesheet_1_palette, false);
 
-            init_palette(current_tilesheet1, tilesheet_1_palette, false);
 
+        // We don't want to load the whole palette into memory, we might
+        // overwrite palettes used by someone else, e.g. the overlay...
+        //
+        // Also, like the sprite texture, we need to apply the currently
+        // active screen fade while modifying the color palette.
+        const auto c = nightmode_adjust(real_color(last_color));
+        for (int i = 0; i < 16; ++i) {
+            auto from = Color::from_bgr_hex_555(tilesheet_1_palette[i]);
+            MEM_BG_PALETTE[32 + i] = blend(from, c, last_fade_amt);
+        }
 
-            // We don't want to load the whole palette into memory, we might
-            // overwrite palettes used by someone else, e.g. the overlay...
-            //
-            // Also, like the sprite texture, we need to apply the currently
-            // active screen fade while modifying the color palette.
-            const auto c = nightmode_adjust(real_color(last_color));
-            for (int i = 0; i < 16; ++i) {
-                auto from = Color::from_bgr_hex_555(tilesheet_1_palette[i]);
-                MEM_BG_PALETTE[32 + i] = blend(from, c, last_fade_amt);
-            }
-
-            if (validate_tilemap_texture_size(*this, info.tile_data_length_)) {
-                memcpy16((void*)&MEM_SCREENBLOCKS[sbb_t1_texture][0],
-                         info.tile_data_,
-                         info.tile_data_length_ / 2);
-            } else {
-                StringBuffer<45> buf = "unable to load: ";
-                buf += name;
+        if (validate_tilemap_texture_size(*this, tile_data_size(info))) {
+            load_tile_data(info, &MEM_SCREENBLOCKS[sbb_t1_texture][0]);
+        } else {
+            StringBuffer<45> buf = "unable to load: ";
+            buf += name.name_;
 
-                error(*this, buf.c_str());
-            }
+            error(*this, buf.c_str());
         }
     }
 }
@@ -2124,23 +2124,45 @@ void Platform::Speaker::play_note(Note n, Octave o, Channel c)
 #include "data/scottbuckley_omega.hpp"
 
 
+// An adpcm block of silence: a zeroed header, and samples that leave the
+// predictor at zero.
 static const int null_music_len = 8;
 static const u32 null_music[null_music_len] = {0, 0, 0, 0, 0, 0, 0, 0};
 
 
-#define DEF_AUDIO(__STR_NAME__, __TRACK_NAME__, __DIV__)                       \
+#define DEF_AUDIO(                                                             \
+    __STR_NAME__, __TRACK_NAME__, __LENGTH__, __SAMPLES__, __ADPCM__)          \
     {                                                                          \
-        STR(__STR_NAME__), (AudioSample*)__TRACK_NAME__,                       \
-            __TRACK_NAME__##Len / __DIV__                                      \
+        STR(__STR_NAME__), __TRACK_NAME__, __LENGTH__, __SAMPLES__, __ADPCM__  \
     }
 
 
+// NOTE: Use DEF_MUSIC for tracks converted to adpcm with build/encode_adpcm.py,
+// and DEF_PCM_MUSIC for tracks still in eight bit pcm. The encoder defines the
+// track's Samples constant, so a pcm track listed with DEF_MUSIC fails to
+// compile here, rather than playing back as noise.
 #define DEF_MUSIC(__STR_NAME__, __TRACK_NAME__)                                \
-    DEF_AUDIO(__STR_NAME__, __TRACK_NAME__, 4)
+    DEF_AUDIO(__STR_NAME__,                                                    \
+              __TRACK_NAME__,                                                  \
+              (__TRACK_NAME__##Len + 3) / 4,                                   \
+              __TRACK_NAME__##Samples,                                         \
+              true)
+
+
+#define DEF_PCM_MUSIC(__STR_NAME__, __TRACK_NAME__)                            \
+    DEF_AUDIO(__STR_NAME__,                                                    \
+              __TRACK_NAME__,                                                  \
+              __TRACK_NAME__##Len / 4,                                         \
+              __TRACK_NAME__##Len,                                             \
+              false)
 
 
 #define DEF_SOUND(__STR_NAME__, __TRACK_NAME__)                                \
-    DEF_AUDIO(__STR_NAME__, __TRACK_NAME__, 1)
+    DEF_AUDIO(__STR_NAME__,                                                    \
+              __TRACK_NAME__,                                                  \
+              __TRACK_NAME__##Len,                                             \
+              __TRACK_NAME__##Len,                                             \
+              false)
 
 
 #include "gba_platform_soundcontext.hpp"
@@ -2149,31 +2171,45 @@ static const u32 null_music[null_music_len] = {0, 0, 0, 0, 0, 0, 0, 0};
 SoundContext snd_ctx;
 
 
-static const struct AudioTrack {
+// The adpcm decoder's tables, copied from rom by audio_start(), see adpcm.hpp.
+__attribute__((section(".iwram"))) u16 adpcm::step_table[adpcm::step_count];
+__attribute__((section(".iwram"))) s8 adpcm::index_table[8];
+
+
+static constexpr struct AudioTrack {
     const char* name_;
-    const AudioSample* data_;
+    const u8* bytes_;
     int length_; // NOTE: For music, this is the track length in 32 bit words,
                  // but for sounds, length_ reprepresents bytes.
-} music_tracks[] = {DEF_MUSIC(omega, scottbuckley_omega),
-                    DEF_MUSIC(computations, scottbuckley_computations),
-                    DEF_MUSIC(clair_de_lune, clair_de_lune),
-                    DEF_MUSIC(murmuration, music_murmuration),
-                    DEF_MUSIC(rocketlaunch, music_rocketlaunch),
-                    DEF_MUSIC(chantiers_navals_412, music_chantiers_navals_412),
-                    DEF_MUSIC(midsommar, music_midsommar),
-                    DEF_MUSIC(waves, music_waves)};
-
+    int samples_;
+    bool adpcm_; // Music only, sounds are always pcm.
 
-static const AudioTrack* find_music(const char* name)
-{
-    for (auto& track : music_tracks) {
+    const AudioSample* data() const
+    {
+        return reinterpret_cast<const AudioSample*>(bytes_);
+    }
 
-        if (str_cmp(name, track.name_) == 0) {
-            return &track;
-        }
+    const u32* words() const
+    {
+        return reinterpret_cast<const u32*>(bytes_);
     }
+} music_tracks[] = {
+    DEF_PCM_MUSIC(omega, scottbuckley_omega),
+    DEF_PCM_MUSIC(computations, scottbuckley_computations),
+    DEF_PCM_MUSIC(clair_de_lune, clair_de_lune),
+    DEF_PCM_MUSIC(murmuration, music_murmuration),
+    DEF_MUSIC(rocketlaunch, music_rocketlaunch),
+    DEF_PCM_MUSIC(chantiers_navals_412, music_chantiers_navals_412),
+    DEF_PCM_MUSIC(midsommar, music_midsommar),
+    DEF_MUSIC(waves, music_waves)};
 
-    return nullptr;
+
+static constexpr auto music_index = make_asset_index(music_tracks);
+
+
+static const AudioTrack* find_music(AssetId name)
+{
+    return find_asset(music_tracks, music_index, name);
 }
 
 
@@ -2206,111 +2242,59 @@ static const AudioTrack* find_music(const char* name)
 #include "data/sound_typewriter.hpp"
 
 
-static const AudioTrack sounds[] = {DEF_SOUND(explosion1, sound_explosion1),
-                                    DEF_SOUND(explosion2, sound_explosion2),
-                                    DEF_SOUND(typewriter, sound_typewriter),
-                                    DEF_SOUND(footstep1, sound_footstep1),
-                                    DEF_SOUND(footstep2, sound_footstep2),
-                                    DEF_SOUND(footstep3, sound_footstep3),
-                                    DEF_SOUND(footstep4, sound_footstep4),
-                                    DEF_SOUND(open_book, sound_open_book),
-                                    DEF_SOUND(dropitem, sound_dropitem),
-                                    DEF_SOUND(openbag, sound_openbag),
-                                    DEF_SOUND(blaster, sound_blaster),
-                                    DEF_SOUND(tw_bell, sound_tw_bell),
-                                    DEF_SOUND(select, sound_select),
-                                    DEF_SOUND(laser1, sound_laser1),
-                                    DEF_SOUND(scroll, sound_scroll),
-                                    DEF_SOUND(creak, sound_creak),
-                                    DEF_SOUND(dodge, sound_dodge),
-                                    DEF_SOUND(heart, sound_heart),
-                                    DEF_SOUND(click, sound_click),
-                                    DEF_SOUND(thud, sound_thud),
-                                    DEF_SOUND(coin, sound_coin),
-                                    DEF_SOUND(bell, sound_bell),
-                                    DEF_SOUND(pop, sound_pop),
-                                    DEF_SOUND(msg, sound_msg)};
-
-
-static const AudioTrack* get_sound(const char* name)
-{
-    for (auto& sound : sounds) {
-        if (str_cmp(name, sound.name_) == 0) {
-            return &sound;
-        }
-    }
-    return nullptr;
+static constexpr AudioTrack sounds[] = {
+    DEF_SOUND(explosion1, sound_explosion1),
+    DEF_SOUND(explosion2, sound_explosion2),
+    DEF_SOUND(typewriter, sound_typewriter),
+    DEF_SOUND(footstep1, sound_footstep1),
+    DEF_SOUND(footstep2, sound_footstep2),
+    DEF_SOUND(footstep3, sound_footstep3),
+    DEF_SOUND(footstep4, sound_footstep4),
+    DEF_SOUND(open_book, sound_open_book),
+    DEF_SOUND(dropitem, sound_dropitem),
+    DEF_SOUND(openbag, sound_openbag),
+    DEF_SOUND(blaster, sound_blaster),
+    DEF_SOUND(tw_bell, sound_tw_bell),
+    DEF_SOUND(select, sound_select),
+    DEF_SOUND(laser1, sound_laser1),
+    DEF_SOUND(scroll, sound_scroll),
+    DEF_SOUND(creak, sound_creak),
+    DEF_SOUND(dodge, sound_dodge),
+    DEF_SOUND(heart, sound_heart),
+    DEF_SOUND(click, sound_click),
+    DEF_SOUND(thud, sound_thud),
+    DEF_SOUND(coin, sound_coin),
+    DEF_SOUND(bell, sound_bell),
+    DEF_SOUND(pop, sound_pop),
+    DEF_SOUND(msg, sound_msg)};
+
+
+static constexpr auto sound_index = make_asset_index(sounds);
+
+
+static const AudioTrack* get_sound(AssetId name)
+{
+    return find_asset(sounds, sound_index, name);
 }
 
 
-Microseconds Platform::Speaker::track_length(const char* name)
+Microseconds Platform::Speaker::track_length(AssetId name)
 {
     if (const auto music = find_music(name)) {
-        return (music->length_ * (sizeof(u32))) / 0.016f;
+        return music->samples_ / 0.016f;
     }
 
     if (const auto sound = get_sound(name)) {
-        return sound->length_ / 0.016f;
+        return sound->samples_ / 0.016f;
     }
 
     return 0;
 }
 
 
-namespace detail {
-template <std::size_t... Is> struct seq {
-};
-template <std::size_t N, std::size_t... Is>
-struct gen_seq : gen_seq<N - 1, N - 1, Is...> {
-};
-template <std::size_t... Is> struct gen_seq<0, Is...> : seq<Is...> {
-};
-
-
-template <class Generator, std::size_t... Is>
-constexpr auto generate_array_helper(Generator g, seq<Is...>)
-    -> std::array<decltype(g(std::size_t{}, sizeof...(Is))), sizeof...(Is)>
-{
-    return {{g(Is, sizeof...(Is))...}};
-}
-
-template <std::size_t tcount, class Generator>
-constexpr auto generate_array(Generator g)
-    -> decltype(generate_array_helper(g, gen_seq<tcount>{}))
-{
-    return generate_array_helper(g, gen_seq<tcount>{});
-}
-} // namespace detail
-
-
-auto make_volume_lut = [](float scale) {
-    return detail::generate_array<256>(
-        [scale](std::size_t curr, std::size_t total) -> s8 {
-            const auto real = (s8)((u8)curr);
-            return real * scale;
-        });
-};
-
-
-// Each table entry contains the whole number space of a signed 8-bit value,
-// scaled by a fraction.
-static constexpr std::array<VolumeScaleLUT, 20> volume_scale_LUTs = {
-    {{make_volume_lut(0.05f)}, {make_volume_lut(0.10f)},
-     {make_volume_lut(0.15f)}, {make_volume_lut(0.20f)},
-     {make_volume_lut(0.25f)}, {make_volume_lut(0.30f)},
-     {make_volume_lut(0.35f)}, {make_volume_lut(0.40f)},
-     {make_volume_lut(0.45f)}, {make_volume_lut(0.50f)},
-     {make_volume_lut(0.55f)}, {make_volume_lut(0.60f)},
-     {make_volume_lut(0.65f)}, {make_volume_lut(0.70f)},
-     {make_volume_lut(0.75f)}, {make_volume_lut(0.80f)},
-     {make_volume_lut(0.85f)}, {make_volume_lut(0.90f)},
-     {make_volume_lut(0.95f)}, {make_volume_lut(1.0f)}},
-};
-
-
 static const VolumeScaleLUT* get_volume_lut(Float volume)
 {
-    return &volume_scale_LUTs[volume * (volume_scale_LUTs.size() - 1)];
+    return &volume_scale_LUTs[volume_level(volume)];
 }
 
 
@@ -2322,12 +2306,12 @@ set_sound_volume(ActiveSoundInfo& sound, Float left_volume, Float right_volume)
 }
 
 
-static std::optional<ActiveSoundInfo> make_sound(const char* name)
+static std::optional<ActiveSoundInfo> make_sound(AssetId name)
 {
     if (auto sound = get_sound(name)) {
         return ActiveSoundInfo{0,
                                sound->length_,
-                               sound->data_,
+                               sound->data(),
                                0,
                                &volume_scale_LUTs[19],
                                &volume_scale_LUTs[19]};
@@ -2347,13 +2331,13 @@ template <typename F> auto modify_audio(F&& callback)
 }
 
 
-bool Platform::Speaker::is_sound_playing(const char* name)
+bool Platform::Speaker::is_sound_playing(AssetId name)
 {
     if (auto sound = get_sound(name)) {
         bool playing = false;
         modify_audio([&] {
             for (const auto& info : snd_ctx.active_sounds) {
-                if ((s8*)sound->data_ == info.data_) {
+                if (sound->data() == info.data_) {
                     playing = true;
                     return;
                 }
@@ -2366,13 +2350,13 @@ bool Platform::Speaker::is_sound_playing(const char* name)
 }
 
 
-bool Platform::Speaker::is_music_playing(const char* name)
+bool Platform::Speaker::is_music_playing(AssetId name)
 {
     bool playing = false;
 
     if (auto track = find_music(name)) {
         modify_audio([&] {
-            if (track->data_ == snd_ctx.music_track) {
+            if (track->words() == snd_ctx.music_track) {
                 playing = true;
             }
         });
@@ -2391,28 +2375,7 @@ void Platform::Speaker::set_position(const Vec2<Float>& position)
 }
 
 
-static void add_sound(Buffer<ActiveSoundInfo, 3>& sounds,
-                      const ActiveSoundInfo& info)
-{
-    if (not sounds.full()) {
-        sounds.push_back(info);
-    } else {
-        ActiveSoundInfo* lowest = sounds.begin();
-        for (auto it = sounds.begin(); it not_eq sounds.end(); ++it) {
-            if (it->priority_ < lowest->priority_) {
-                lowest = it;
-            }
-        }
-
-        if (lowest not_eq sounds.end() and lowest->priority_ < info.priority_) {
-            sounds.erase(lowest);
-            sounds.push_back(info);
-        }
-    }
-}
-
-
-void Platform::Speaker::play_sound(const char* name,
+void Platform::Speaker::play_sound(AssetId name,
                                    int priority,
                                    std::optional<Vec2<Float>> position)
 {
@@ -2426,45 +2389,17 @@ void Platform::Speaker::play_sound(const char* name,
             const auto dist =
                 distance(*position, spatialized_audio_listener_pos);
 
-            if (dist < 48) {
-                set_sound_volume(*info, 1.f, 1.f);
-            } else {
-                const Float distance_scale = 0.0005f;
-
-                const auto inv_sqr_intensity =
-                    1.f / (distance_scale * ((dist / 4) * dist));
-
-                auto l_vol = inv_sqr_intensity;
-                auto r_vol = inv_sqr_intensity;
-
-                // Currently disabled, used for stereo sound effects
-                // const auto dir =
-                //     direction(spatialized_audio_listener_pos, *position);
-                // const auto attenuation = 1.f - inv_sqr_intensity;
-                // const auto partial_attenuation = attenuation / 2.f;
-
-                // l_vol -= partial_attenuation * dir.x;
-                // r_vol += partial_attenuation * dir.x;
-
-                // if (r_vol < 0 and l_vol > r_vol) {
-                //     l_vol += r_vol;
-                // }
-
-                // if (l_vol < 0 and l_vol > r_vol) {
-                //     r_vol += l_vol;
-                // }
-
-                l_vol = clamp(l_vol, 0.f, 1.f);
-                r_vol = clamp(r_vol, 0.f, 1.f);
-
-                set_sound_volume(*info, l_vol, r_vol);
-            }
+            // The stereo mixer would support panning, but we currently play
+            // sound effects centered.
+            const auto levels = stereo_levels(spatial_volume(dist), 0.f);
 
+            info->l_volume_lut_ = &volume_scale_LUTs[levels.left_];
+            info->r_volume_lut_ = &volume_scale_LUTs[levels.right_];
         } else {
             set_sound_volume(*info, 1.f, 1.f);
         }
 
-        modify_audio([&] { add_sound(snd_ctx.active_sounds, *info); });
+        modify_audio([&] { add_voice(snd_ctx.active_sounds, *info); });
     }
 }
 
@@ -2474,9 +2409,12 @@ static void clear_music()
     // The audio interrupt handler can be smaller and simpler if we use a track
     // of empty bytes to represent scenarios where music is not playing, rather
     // than adding another if condition to the audio isr.
-    snd_ctx.music_track = reinterpret_cast<const AudioSample*>(null_music);
-    snd_ctx.music_track_length = null_music_len - 1;
+    snd_ctx.music_track = null_music;
+    snd_ctx.music_track_length = null_music_len;
     snd_ctx.music_track_pos = 0;
+    snd_ctx.music_block_remaining = 0;
+    snd_ctx.music_adpcm = true;
+    snd_ctx.music_half = false;
 }
 
 
@@ -2492,7 +2430,7 @@ void Platform::Speaker::stop_music()
 }
 
 
-static void play_music(const char* name, Microseconds offset)
+static void play_music(AssetId name, Microseconds offset)
 {
     const auto track = find_music(name);
     if (track == nullptr) {
@@ -2501,21 +2439,56 @@ static void play_music(const char* name, Microseconds offset)
 
     const Microseconds sample_offset = offset * 0.016f; // NOTE: because 16kHz
 
+    if (not track->adpcm_) {
+        // Four samples to a word, and the isr reads two words at a time.
+        const int pos = ((sample_offset % track->samples_) / 8) * 2;
+
+        modify_audio([&] {
+            snd_ctx.music_track_length = track->length_;
+            snd_ctx.music_track = track->words();
+            snd_ctx.music_track_pos = pos;
+            snd_ctx.music_adpcm = false;
+            snd_ctx.music_half = false;
+        });
+
+        return;
+    }
+
+    // Seek to the block containing the offset, then decode up to the word
+    // containing the offset, before handing the track to the audio isr.
+    const auto words = track->words();
+    const int word = (sample_offset % track->samples_) / 8;
+    const int block = word / adpcm::block_words;
+
+    int pos = block * (adpcm::block_words + 1);
+    auto state = adpcm::read_header(words[pos++]);
+    for (int i = 0; i < word % adpcm::block_words; ++i) {
+        adpcm::skip_word(state, words[pos++]);
+    }
+
+    const int block_end =
+        std::min(track->length_, (block + 1) * (adpcm::block_words + 1));
+
     modify_audio([&] {
         snd_ctx.music_track_length = track->length_;
-        snd_ctx.music_track = track->data_;
-        snd_ctx.music_track_pos = (sample_offset / 4) % track->length_;
+        snd_ctx.music_track = words;
+        snd_ctx.music_track_pos = pos;
+        snd_ctx.music_block_remaining = block_end - pos;
+        snd_ctx.music_state = state;
+        snd_ctx.music_adpcm = true;
+        snd_ctx.music_half = false;
     });
 }
 
 
-void Platform::Speaker::play_music(const char* name, Microseconds offset)
+void Platform::Speaker::play_music(AssetId name, Microseconds offset)
 {
     // NOTE: The sound sample needs to be mono, and 8-bit signed. To export this
     // format from Audacity, convert the tracks to mono via the Tracks dropdown,
     // and then export as raw, in the format 8-bit signed.
     //
-    // Also, important to convert the sound file frequency to 16kHz.
+    // Also, important to convert the sound file frequency to 16kHz. Then
+    // convert the track to adpcm, with build/encode_adpcm.py.
 
     this->stop_music();
 
@@ -2532,9 +2505,9 @@ void Platform::Speaker::play_music(const char* name, Microseconds offset)
     // chip, as well as the audio interrupts, when playing new sounds? Does
     // disabling the audio interrupts when queueing a new sound effect cause
     // audio artifacts, because the sound chip is not receiving samples?
-    play_sound("footstep1", 0);
-    play_sound("footstep2", 0);
-    play_sound("footstep3", 0);
+    play_sound("footstep1"_asset, 0);
+    play_sound("footstep2"_asset, 0);
+    play_sound("footstep3"_asset, 0);
 }
 
 
@@ -2574,16 +2547,10 @@ Platform::Speaker::Speaker()
     alignas(4) AudioSample mixing_buffer_l[4];
     alignas(4) AudioSample mixing_buffer_r[4];
 
-    // NOTE: audio tracks in ROM should therefore have four byte alignment!
-    *((u32*)mixing_buffer_l) =
-        ((u32*)(snd_ctx.music_track))[snd_ctx.music_track_pos++];
+    music_fill_half(snd_ctx, mixing_buffer_l);
 
     *((u32*)mixing_buffer_r) = *((u32*)mixing_buffer_l);
 
-    if (UNLIKELY(snd_ctx.music_track_pos > snd_ctx.music_track_length)) {
-        snd_ctx.music_track_pos = 0;
-    }
-
     for (auto it = snd_ctx.active_sounds.begin();
          it not_eq snd_ctx.active_sounds.end();) {
         if (UNLIKELY(it->position_ + 4 >= it->length_)) {
@@ -2609,13 +2576,7 @@ Platform::Speaker::Speaker()
 {
     alignas(4) AudioSample mixing_buffer[4];
 
-    // NOTE: audio tracks in ROM should therefore have four byte alignment!
-    *((u32*)mixing_buffer) =
-        ((u32*)(snd_ctx.music_track))[snd_ctx.music_track_pos++];
-
-    if (UNLIKELY(snd_ctx.music_track_pos > snd_ctx.music_track_length)) {
-        snd_ctx.music_track_pos = 0;
-    }
+    music_fill_half(snd_ctx, mixing_buffer);
 
     for (auto it = snd_ctx.active_sounds.begin();
          it not_eq snd_ctx.active_sounds.end();) {
@@ -2717,15 +2678,33 @@ void Platform::on_watchdog_timeout(WatchdogCallback callback)
 
 
 const char* Platform::load_file_contents(const char* folder,
-                                         const char* filename) const
+                                         const char* filename,
+                                         u32* size) const
 {
-    for (auto& file : files) {
-        if (str_cmp(file.name_, filename) == 0 and
-            str_cmp(file.root_, folder) == 0) {
-            return reinterpret_cast<const char*>(file.data_);
-        }
+    const auto i = file_index.find(asset_path_hash(folder, filename));
+    if (i == -1) {
+        return nullptr;
     }
-    return nullptr;
+
+    const auto result = reinterpret_cast<const char*>(files[i].data_);
+
+    // The rom only holds text files, so the terminator marks the end.
+    if (size) {
+        *size = str_len(result);
+    }
+
+    return result;
+}
+
+
+bool Platform::write_file_contents(const char* folder,
+                                   const char* filename,
+                                   const void* data,
+                                   u32 length,
+                                   bool append)
+{
+    // Files live in the rom.
+    return false;
 }
 
 
@@ -2849,6 +2828,13 @@ void Platform::enable_expanded_glyph_mode(bool enabled)
 
 static void audio_start()
 {
+    std::copy(std::begin(adpcm::step_table_init),
+              std::end(adpcm::step_table_init),
+              adpcm::step_table);
+    std::copy(std::begin(adpcm::index_table_init),
+              std::end(adpcm::index_table_init),
+              adpcm::index_table);
+
     clear_music();
 
     REG_SOUNDCNT_H =
@@ -2943,7 +2929,7 @@ Platform::Platform()
         info(*this, "SRAM write failed, falling back to FLASH");
     }
 
-    glyph_table.emplace(allocate_dynamic<GlyphTable>(*this));
+    glyph_table.emplace(allocate_dynamic<GlyphTable>(*this, "glyph-table"));
     if (not glyph_table) {
         error(*this, "failed to allocate glyph table");
         restart();
@@ -3131,63 +3117,55 @@ static volatile int chinese_checksum_2 = 30;
 static volatile int chinese_checksum_3 = 8;
 
 
-bool Platform::overlay_texture_exists(const char* name)
+bool Platform::overlay_texture_exists(AssetId name)
 {
-    for (auto& info : overlay_textures) {
-
-        if (str_cmp(name, info.name_) == 0) {
-            return true;
-        }
-    }
-
-    return false;
+    return find_asset(overlay_textures, overlay_texture_index, name);
 }
 
 
-bool Platform::load_overlay_texture(const char* name)
+bool Platform::load_overlay_texture(AssetId name)
 {
-    for (auto& info : overlay_textures) {
+    const auto found =
+        find_asset(overlay_textures, overlay_texture_index, name);
 
-        if (str_cmp(name, info.name_) == 0) {
+    if (found) {
+        auto& info = *found;
 
-            current_overlay_texture = &info;
+        current_overlay_texture = &info;
 
-            init_palette(current_overlay_texture, overlay_palette, true);
+        init_palette(current_overlay_texture, overlay_palette, true);
 
-            for (int i = 0; i < 16; ++i) {
-                auto from = Color::from_bgr_hex_555(overlay_palette[i]);
-                if (not overlay_was_faded) {
-                    MEM_BG_PALETTE[16 + i] = from.bgr_hex_555();
-                } else {
-                    const auto c = nightmode_adjust(real_color(last_color));
-                    MEM_BG_PALETTE[16 + i] = blend(from, c, last_fade_amt);
-                }
+        for (int i = 0; i < 16; ++i) {
+            auto from = Color::from_bgr_hex_555(overlay_palette[i]);
+            if (not overlay_was_faded) {
+                MEM_BG_PALETTE[16 + i] = from.bgr_hex_555();
+            } else {
+                const auto c = nightmode_adjust(real_color(last_color));
+                MEM_BG_PALETTE[16 + i] = blend(from, c, last_fade_amt);
             }
+        }
 
-            if (validate_overlay_texture_size(*this, info.tile_data_length_)) {
-                memcpy16((void*)&MEM_SCREENBLOCKS[sbb_overlay_texture][0],
-                         info.tile_data_,
-                         info.tile_data_length_ / 2);
-            }
+        if (validate_overlay_texture_size(*this, tile_data_size(info))) {
+            load_tile_data(info, &MEM_SCREENBLOCKS[sbb_overlay_texture][0]);
+        }
 
-            if (get_gflag(GlobalFlag::glyph_mode)) {
-                for (auto& gm : ::glyph_table->obj_->mappings_) {
-                    gm.reference_count_ = -1;
-                }
+        if (get_gflag(GlobalFlag::glyph_mode)) {
+            for (auto& gm : ::glyph_table->obj_->mappings_) {
+                gm.reference_count_ = -1;
             }
+        }
 
-            if (str_cmp(name, "overlay") == 0) {
-                int checksum = chinese_noncommercial_text_checksum();
+        if (name.hash_ == "overlay"_asset.hash_) {
+            int checksum = chinese_noncommercial_text_checksum();
 
-                if (checksum not_eq chinese_checksum_1 + chinese_checksum_2 +
-                                        chinese_checksum_3) {
-                    while (true) {
-                    }
+            if (checksum not_eq chinese_checksum_1 + chinese_checksum_2 +
+                                    chinese_checksum_3) {
+                while (true) {
                 }
             }
-
-            return true;
         }
+
+        return true;
     }
 
     return false;
@@ -3349,7 +3327,7 @@ void Platform::fill_overlay(u16 tile)
     const u32 fill_word = tile_info | (tile_info << 16);
 
     u32* const mem = (u32*)overlay_back_buffer;
-    overlay_back_buffer_changed = true;
+    overlay_dirty_rows = ~0;
 
     for (unsigned i = 0; i < (sizeof(ScreenBlock) / (sizeof(u32))); ++i) {
         mem[i] = fill_word;
@@ -3365,6 +3343,13 @@ void Platform::fill_overlay(u16 tile)
 
 static void set_overlay_tile(Platform& pfrm, u16 x, u16 y, u16 val, int palette)
 {
+    const u16 entry = val | SE_PALBANK(palette);
+
+    if (overlay_back_buffer[x + y * 32] == entry) {
+        // Leave the row clean. Text and banners often rewrite the same tiles.
+        return;
+    }
+
     if (get_gflag(GlobalFlag::glyph_mode)) {
         // This is where we handle the reference count for mapped glyphs. If
         // we are overwriting a glyph with different tile, then we can
@@ -3407,8 +3392,8 @@ static void set_overlay_tile(Platform& pfrm, u16 x, u16 y, u16 val, int palette)
         }
     }
 
-    overlay_back_buffer[x + y * 32] = val | SE_PALBANK(palette);
-    overlay_back_buffer_changed = true;
+    overlay_back_buffer[x + y * 32] = entry;
+    overlay_dirty_rows |= 1u << y;
 }
 
 
@@ -3491,6 +3476,37 @@ void Platform::set_tile(u16 x, u16 y, TileDesc glyph, const FontColors& colors)
 }
 
 
+void Platform::set_tiles(u16 x, u16 y, const TileDesc* tiles, u32 count)
+{
+    if (x > 31 or y > 31) {
+        return;
+    }
+
+    count = std::min(count, u32(32 - x));
+
+    if (get_gflag(GlobalFlag::glyph_mode)) {
+        // Glyphs need their reference counts updated, tile by tile.
+        for (u32 i = 0; i < count; ++i) {
+            set_overlay_tile(*this, x + i, y, tiles[i], 1);
+        }
+        return;
+    }
+
+    auto row = overlay_back_buffer + x + y * 32;
+    bool changed = false;
+
+    for (u32 i = 0; i < count; ++i) {
+        const u16 entry = tiles[i] | SE_PALBANK(1);
+        changed |= row[i] not_eq entry;
+        row[i] = entry;
+    }
+
+    if (changed) {
+        overlay_dirty_rows |= 1u << y;
+    }
+}
+
+
 void Platform::set_tile(Layer layer, u16 x, u16 y, u16 val)
 {
     switch (layer) {
@@ -4386,6 +4402,13 @@ struct RemoteConsoleState {
     std::optional<DynamicMemory<ConsoleLine>> rx_in_progress_;
     Buffer<DynamicMemory<ConsoleLine>, 4> rx_full_lines_;
 
+    // The serial isr must not allocate or free memory, as it may interrupt the
+    // game while the game's in the middle of updating the size class arena
+    // (see allocate_dynamic()). So we allocate lines outside of the isr: when
+    // the isr finishes a line, it swaps in the spare, and readline() replaces
+    // the spare.
+    std::optional<DynamicMemory<ConsoleLine>> rx_spare_;
+
     std::optional<DynamicMemory<ConsoleLine>> tx_msg_;
 };
 
@@ -4415,8 +4438,6 @@ static void uart_serial_isr()
         REG_SIODATA8 = *((*state.tx_msg_)->end() - 1);
         (*state.tx_msg_)->pop_back();
         return;
-    } else if (state.tx_msg_ and (*state.tx_msg_)->empty()) {
-        state.tx_msg_.reset();
     }
 
     // FIXME: I'm not seeing the receive_ready flag for some reason, but this
@@ -4432,9 +4453,12 @@ static void uart_serial_isr()
     ++multiplayer_comms.rx_message_count;
 
     if (data == '\r') {
-        if (state.rx_in_progress_) {
+        if (state.rx_in_progress_ and not state.rx_full_lines_.full()) {
             state.rx_full_lines_.push_back(std::move(*state.rx_in_progress_));
             state.rx_in_progress_.reset();
+            std::swap(state.rx_in_progress_, state.rx_spare_);
+        } else if (state.rx_in_progress_) {
+            (*state.rx_in_progress_)->clear();
         }
     } else if (data == 8 /* ASCII backspace */ or
                data == 0x7f /* Strange char used by picocom as a backspace */) {
@@ -4442,12 +4466,12 @@ static void uart_serial_isr()
             (*state.rx_in_progress_)->pop_back();
         }
     } else {
-        if (not state.rx_in_progress_) {
-            state.rx_in_progress_ = allocate_dynamic<ConsoleLine>(*::platform);
-        }
-
         if (state.rx_in_progress_) {
             (*state.rx_in_progress_)->push_back(data);
+        } else {
+            // No spare line yet, the game hasn't called readline() since the
+            // last one.
+            ++multiplayer_comms.rx_loss;
         }
     }
 
@@ -4457,7 +4481,12 @@ static void uart_serial_isr()
 
 static void start_remote_console(Platform& pfrm)
 {
-    ::remote_console_state = allocate_dynamic<RemoteConsoleState>(pfrm);
+    ::remote_console_state = allocate_dynamic<RemoteConsoleState>(pfrm, "console");
+
+    auto& state = **::remote_console_state;
+    state.rx_in_progress_ = allocate_dynamic<ConsoleLine>(pfrm, "console-rx");
+    state.rx_spare_ = allocate_dynamic<ConsoleLine>(pfrm, "console-rx");
+    state.tx_msg_ = allocate_dynamic<ConsoleLine>(pfrm, "console-tx");
 
     irqEnable(IRQ_SERIAL);
 
@@ -4481,12 +4510,27 @@ auto Platform::RemoteConsole::readline() -> std::optional<Line>
 {
     auto& state = **::remote_console_state;
 
+    if (not state.rx_spare_) {
+        auto spare = allocate_dynamic<ConsoleLine>(*::platform, "console-rx");
+
+        irqDisable(IRQ_SERIAL);
+        if (not state.rx_in_progress_) {
+            state.rx_in_progress_ = std::move(spare);
+        } else {
+            state.rx_spare_ = std::move(spare);
+        }
+        irqEnable(IRQ_SERIAL);
+    }
+
     if (not state.rx_full_lines_.empty()) {
+        irqDisable(IRQ_SERIAL);
         auto ret = std::move(*state.rx_full_lines_.begin());
-
         state.rx_full_lines_.erase(state.rx_full_lines_.begin());
+        irqEnable(IRQ_SERIAL);
 
-        return *ret;
+        Line line = *ret;
+
+        return line;
     }
     return {};
 }
@@ -4502,7 +4546,10 @@ bool Platform::RemoteConsole::printline(const char* text, bool show_prompt)
         return false;
     }
 
-    state.tx_msg_ = allocate_dynamic<ConsoleLine>(*::platform);
+    // NOTE: We reuse the same line for each message, see rx_spare_.
+    if (not state.tx_msg_) {
+        return false;
+    }
 
     std::optional<char> first_char;
 
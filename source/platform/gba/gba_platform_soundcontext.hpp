@@ -2,12 +2,8 @@
 
 
 #include "memory/buffer.hpp"
-
-
-using VolumeScaleLUT = std::array<s8, 256>;
-
-
-using AudioSample = s8;
+#include "platform/adpcm.hpp"
+#include "platform/audioMixer.hpp"
 
 
 struct ActiveSoundInfo {
@@ -24,7 +20,68 @@ struct SoundContext {
     // Only three sounds will play at a time... hey, sound mixing's expensive!
     Buffer<ActiveSoundInfo, 3> active_sounds;
 
-    const AudioSample* music_track = nullptr;
+    // Music tracks are adpcm blocks (see adpcm.hpp), or, for tracks that
+    // haven't been converted yet, eight bit pcm. The length and position count
+    // 32 bit words, including block headers.
+    const u32* music_track = nullptr;
     s32 music_track_length = 0;
     s32 music_track_pos = 0;
+    bool music_adpcm = true;
+
+    // Words left to decode in the current block. When zero, the next word is a
+    // block header.
+    s32 music_block_remaining = 0;
+    adpcm::State music_state;
+
+    // For isrs that mix four samples at a time, the second half of the last
+    // eight samples decoded.
+    alignas(4) AudioSample music_pending[4];
+    bool music_half = false;
 };
+
+
+// Decodes the next eight samples of music into out, looping back to the start
+// of the track after its last block. Out must be word aligned.
+inline void music_fill(SoundContext& ctx, AudioSample* out)
+{
+    auto& pos = ctx.music_track_pos;
+
+    if (UNLIKELY(not ctx.music_adpcm)) {
+        if (pos + 2 > ctx.music_track_length) {
+            pos = 0;
+        }
+        ((u32*)out)[0] = ctx.music_track[pos++];
+        ((u32*)out)[1] = ctx.music_track[pos++];
+        return;
+    }
+
+    if (UNLIKELY(ctx.music_block_remaining == 0)) {
+        if (pos >= ctx.music_track_length) {
+            pos = 0;
+        }
+        ctx.music_state = adpcm::read_header(ctx.music_track[pos++]);
+
+        const s32 left = ctx.music_track_length - pos;
+        ctx.music_block_remaining =
+            left < adpcm::block_words ? left : adpcm::block_words;
+    }
+
+    --ctx.music_block_remaining;
+
+    adpcm::decode_word(ctx.music_state, ctx.music_track[pos++], out);
+}
+
+
+// Like music_fill(), but for isrs that mix four samples at a time.
+inline void music_fill_half(SoundContext& ctx, AudioSample* out)
+{
+    if (ctx.music_half) {
+        *((u32*)out) = *((u32*)ctx.music_pending);
+    } else {
+        alignas(4) AudioSample decoded[8];
+        music_fill(ctx, decoded);
+        *((u32*)out) = ((u32*)decoded)[0];
+        *((u32*)ctx.music_pending) = ((u32*)decoded)[1];
+    }
+    ctx.music_half = not ctx.music_half;
+}
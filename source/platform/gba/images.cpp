@@ -122,17 +122,28 @@ struct TextureData {
     const unsigned short* palette_data_;
     u32 tile_data_length_;
     u32 palette_data_length_;
+
+    // Set for images run through compress_image.py. The tile data then starts
+    // with a compression header (see compression.hpp), and tile_data_length_
+    // is the compressed length.
+    bool compressed_;
 };
 
 
 #define STR(X) #X
 #define TEXTURE_INFO(NAME)                                                     \
     {                                                                          \
-        STR(NAME), NAME##Tiles, NAME##Pal, NAME##TilesLen, NAME##PalLen        \
+        STR(NAME), NAME##Tiles, NAME##Pal, NAME##TilesLen, NAME##PalLen, false \
+    }
+
+#define COMPRESSED_TEXTURE_INFO(NAME)                                          \
+    {                                                                          \
+        STR(NAME), NAME##Tiles, NAME##Pal, NAME##TilesLen, NAME##PalLen, true  \
     }
 
 
-static const TextureData sprite_textures[] = {
+
+static constexpr TextureData sprite_textures[] = {
 
     TEXTURE_INFO(spritesheet_intro_clouds),
 //;
@@ -165,40 +176,40 @@ static const TextureData sprite_textures[] = {
 };
 
 
-static const TextureData tile_textures[] = {
+static constexpr TextureData tile_textures[] = {
 
-    TEXTURE_INFO(title_1_flattened),
+    COMPRESSED_TEXTURE_INFO(title_1_flattened),
 //;
-    TEXTURE_INFO(title_2_flattened),
+    COMPRESSED_TEXTURE_INFO(title_2_flattened),
 //;
-    TEXTURE_INFO(ending_scene_flattened),
+    COMPRESSED_TEXTURE_INFO(ending_scene_flattened),
 //;
-    TEXTURE_INFO(ending_scene_2_flattened),
+    COMPRESSED_TEXTURE_INFO(ending_scene_2_flattened),
 //;
-    TEXTURE_INFO(launch_flattened),
+    COMPRESSED_TEXTURE_INFO(launch_flattened),
 //;
-    TEXTURE_INFO(tilesheet_intro_cutscene_flattened),
+    COMPRESSED_TEXTURE_INFO(tilesheet_intro_cutscene_flattened),
 //;
-    TEXTURE_INFO(tilesheet),
+    COMPRESSED_TEXTURE_INFO(tilesheet),
 //;
-    TEXTURE_INFO(tilesheet2),
+    COMPRESSED_TEXTURE_INFO(tilesheet2),
 //;
-    TEXTURE_INFO(tilesheet3),
+    COMPRESSED_TEXTURE_INFO(tilesheet3),
 //;
-    TEXTURE_INFO(tilesheet4),
+    COMPRESSED_TEXTURE_INFO(tilesheet4),
 //;
-    TEXTURE_INFO(tilesheet_top),
+    COMPRESSED_TEXTURE_INFO(tilesheet_top),
 //;
-    TEXTURE_INFO(tilesheet2_top),
+    COMPRESSED_TEXTURE_INFO(tilesheet2_top),
 //;
-    TEXTURE_INFO(tilesheet3_top),
+    COMPRESSED_TEXTURE_INFO(tilesheet3_top),
 //;
-    TEXTURE_INFO(tilesheet4_top),
+    COMPRESSED_TEXTURE_INFO(tilesheet4_top),
 //
 };
 
 
-static const TextureData overlay_textures[] = {
+static constexpr TextureData overlay_textures[] = {
 
     TEXTURE_INFO(overlay),
 //;
@@ -222,30 +233,35 @@ static const TextureData overlay_textures[] = {
 //;
     TEXTURE_INFO(death_text_french),
 //;
-    TEXTURE_INFO(old_poster_flattened),
+    COMPRESSED_TEXTURE_INFO(old_poster_flattened),
 //;
-    TEXTURE_INFO(old_poster_chinese_flattened),
+    COMPRESSED_TEXTURE_INFO(old_poster_chinese_flattened),
 //;
-    TEXTURE_INFO(old_poster_russian_flattened),
+    COMPRESSED_TEXTURE_INFO(old_poster_russian_flattened),
 //;
-    TEXTURE_INFO(old_poster_italian_flattened),
+    COMPRESSED_TEXTURE_INFO(old_poster_italian_flattened),
 //;
-    TEXTURE_INFO(old_poster_french_flattened),
+    COMPRESSED_TEXTURE_INFO(old_poster_french_flattened),
 //;
-    TEXTURE_INFO(blaster_info_flattened),
+    COMPRESSED_TEXTURE_INFO(blaster_info_flattened),
 //;
-    TEXTURE_INFO(seed_packet_flattened),
+    COMPRESSED_TEXTURE_INFO(seed_packet_flattened),
 //;
-    TEXTURE_INFO(seed_packet_chinese_flattened),
+    COMPRESSED_TEXTURE_INFO(seed_packet_chinese_flattened),
 //;
-    TEXTURE_INFO(seed_packet_russian_flattened),
+    COMPRESSED_TEXTURE_INFO(seed_packet_russian_flattened),
 //;
-    TEXTURE_INFO(seed_packet_italian_flattened),
+    COMPRESSED_TEXTURE_INFO(seed_packet_italian_flattened),
 //;
-    TEXTURE_INFO(seed_packet_french_flattened),
+    COMPRESSED_TEXTURE_INFO(seed_packet_french_flattened),
 //;
-    TEXTURE_INFO(overlay_network_flattened),
+    COMPRESSED_TEXTURE_INFO(overlay_network_flattened),
 //
 };
 
+
+static constexpr auto sprite_texture_index = make_asset_index(sprite_textures);
+static constexpr auto tile_texture_index = make_asset_index(tile_textures);
+static constexpr auto overlay_texture_index = make_asset_index(overlay_textures);
+
 // clang-format on
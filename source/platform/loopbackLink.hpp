@@ -0,0 +1,296 @@
+#pragma once
+
+
+#include "memory/buffer.hpp"
+#include "number/random.hpp"
+#include "platform.hpp"
+
+
+// A simulated link between two NetworkPeers running in the same process. The
+// link emulates the gameboy advance serial cable: each side may shift at most
+// one max_message_size frame across the wire per message interval, and frames
+// queue up in a small transmit ring when the game sends faster than that. On
+// top of the bandwidth limit, the link can add latency, jitter, and random
+// frame loss, so that we can test multiplayer code under a realistic link
+// budget, without a second device.
+//
+// Frames arrive in the order that they were sent. Jitter delays a frame, but
+// never lets it overtake an earlier one, same as the serial link and tcp.
+class LoopbackLink {
+public:
+    using NetworkPeer = Platform::NetworkPeer;
+
+    static constexpr const u32 frame_size = NetworkPeer::max_message_size;
+
+    struct Config {
+        // The gba multiplayer code shifts out one 16 bit word roughly every
+        // two milliseconds (see multiplayer_schedule_master_tx()), so a twelve
+        // byte message takes six transfers.
+        Microseconds message_interval_ = 6 * 2044;
+
+        Microseconds latency_ = 0;
+        Microseconds jitter_ = 0;
+
+        int drop_percent_ = 0;
+
+        rng::LinearGenerator seed_ = 1;
+    };
+
+    enum Side { host, guest, side_count };
+
+
+    LoopbackLink()
+    {
+        configure(Config{});
+    }
+
+
+    LoopbackLink(const Config& config)
+    {
+        configure(config);
+    }
+
+
+    void configure(const Config& config)
+    {
+        config_ = config;
+        rng_ = config.seed_;
+    }
+
+
+    const Config& config() const
+    {
+        return config_;
+    }
+
+
+    void attach(Side side)
+    {
+        channels_[side] = Channel{};
+        attached_[side] = true;
+    }
+
+
+    void detach(Side side)
+    {
+        attached_[side] = false;
+    }
+
+
+    bool is_connected() const
+    {
+        return attached_[host] and attached_[guest];
+    }
+
+
+    // Queue a message for transmission. Like the gba implementation, if the
+    // transmit ring is full, we drop the oldest queued message to make room.
+    bool send(Side side, const NetworkPeer::Message& message)
+    {
+        if (message.length_ > frame_size or not is_connected()) {
+            return false;
+        }
+
+        auto& ch = channels_[side];
+
+        if (ch.tx_queue_.full()) {
+            ch.tx_queue_.erase(ch.tx_queue_.begin());
+            ++ch.tx_loss_;
+        }
+
+        Frame frame;
+        frame.data_.fill(byte(0));
+        __builtin_memcpy(frame.data_.data(), message.data_, message.length_);
+
+        ch.tx_queue_.push_back(frame);
+
+        return true;
+    }
+
+
+    // Advance the simulated link by delta. The owner of the link should call
+    // this once per frame, not once per peer.
+    void update(Microseconds delta)
+    {
+        for (int side = 0; side < side_count; ++side) {
+            step(channels_[side], channels_[other(Side(side))], delta);
+        }
+    }
+
+
+    // Called at the start of each NetworkPeer::update(), discards the bytes
+    // consumed by the previous round of polling.
+    void compact(Side side)
+    {
+        auto& ch = channels_[side];
+
+        const u32 remaining = ch.rx_buffer_.size() - ch.rx_consumed_;
+        for (u32 i = 0; i < remaining; ++i) {
+            ch.rx_buffer_[i] = ch.rx_buffer_[ch.rx_consumed_ + i];
+        }
+        while (ch.rx_buffer_.size() > remaining) {
+            ch.rx_buffer_.pop_back();
+        }
+
+        ch.rx_consumed_ = 0;
+    }
+
+
+    std::optional<NetworkPeer::Message> poll_message(Side side)
+    {
+        auto& ch = channels_[side];
+
+        if (ch.rx_consumed_ >= ch.rx_buffer_.size()) {
+            return {};
+        }
+
+        return NetworkPeer::Message{ch.rx_buffer_.data() + ch.rx_consumed_,
+                                    ch.rx_buffer_.size() - ch.rx_consumed_};
+    }
+
+
+    void poll_consume(Side side, u32 length)
+    {
+        channels_[side].rx_consumed_ += length;
+    }
+
+
+    // Link saturation measures the proportion of transmit slots, since the
+    // previous call to stats(), that carried a message.
+    NetworkPeer::Stats stats(Side side)
+    {
+        auto& ch = channels_[side];
+
+        int saturation = 0;
+        if (ch.slot_count_) {
+            saturation = (100 * ch.busy_slot_count_) / ch.slot_count_;
+        }
+
+        ch.slot_count_ = 0;
+        ch.busy_slot_count_ = 0;
+
+        return {ch.tx_count_,
+                ch.rx_count_,
+                ch.tx_loss_,
+                ch.rx_loss_,
+                saturation};
+    }
+
+
+private:
+    struct Frame {
+        std::array<byte, frame_size> data_;
+    };
+
+    struct InFlight {
+        Frame frame_;
+        Microseconds remaining_;
+    };
+
+    static constexpr const int tx_ring_size = 32;
+    static constexpr const int rx_ring_size = 64;
+
+    struct Channel {
+        // Outgoing messages, waiting for a transmit slot.
+        Buffer<Frame, tx_ring_size> tx_queue_;
+
+        // Messages on the wire, waiting out the link latency.
+        Buffer<InFlight, rx_ring_size> in_flight_;
+
+        // Received bytes, waiting for the receiver to poll them.
+        Buffer<byte, rx_ring_size * frame_size> rx_buffer_;
+        u32 rx_consumed_ = 0;
+
+        Microseconds slot_timer_ = 0;
+
+        int tx_count_ = 0;
+        int rx_count_ = 0;
+        int tx_loss_ = 0;
+        int rx_loss_ = 0;
+
+        int slot_count_ = 0;
+        int busy_slot_count_ = 0;
+    };
+
+
+    static Side other(Side side)
+    {
+        return side == host ? guest : host;
+    }
+
+
+    void step(Channel& tx, Channel& rx, Microseconds delta)
+    {
+        if (not is_connected()) {
+            return;
+        }
+
+        for (auto& f : tx.in_flight_) {
+            f.remaining_ -= delta;
+        }
+
+        tx.slot_timer_ += delta;
+
+        while (tx.slot_timer_ >= config_.message_interval_) {
+            tx.slot_timer_ -= config_.message_interval_;
+
+            ++tx.slot_count_;
+
+            if (tx.tx_queue_.empty()) {
+                continue;
+            }
+
+            ++tx.busy_slot_count_;
+            ++tx.tx_count_;
+
+            const auto frame = *tx.tx_queue_.begin();
+            tx.tx_queue_.erase(tx.tx_queue_.begin());
+
+            if (config_.drop_percent_ and
+                rng::choice<100>(rng_) < config_.drop_percent_) {
+                ++rx.rx_loss_;
+                continue;
+            }
+
+            // NOTE: slot_timer_ now holds the time elapsed since this transmit
+            // slot came around, which we subtract from the frame's delay.
+            Microseconds delay = config_.latency_ - tx.slot_timer_;
+            if (config_.jitter_ > 0) {
+                delay += (s64(rng::get(rng_)) * config_.jitter_) >> 15;
+            }
+
+            if (not tx.in_flight_.empty() and
+                tx.in_flight_.back().remaining_ > delay) {
+                delay = tx.in_flight_.back().remaining_;
+            }
+
+            if (not tx.in_flight_.push_back({frame, delay})) {
+                ++rx.rx_loss_;
+            }
+        }
+
+        while (not tx.in_flight_.empty() and
+               tx.in_flight_.begin()->remaining_ <= 0) {
+
+            auto& frame = tx.in_flight_.begin()->frame_;
+
+            if (rx.rx_buffer_.size() + frame_size >
+                rx.rx_buffer_.capacity()) {
+                ++rx.rx_loss_;
+            } else {
+                for (auto b : frame.data_) {
+                    rx.rx_buffer_.push_back(b);
+                }
+                ++rx.rx_count_;
+            }
+
+            tx.in_flight_.erase(tx.in_flight_.begin());
+        }
+    }
+
+
+    Config config_;
+    rng::LinearGenerator rng_;
+    Channel channels_[side_count];
+    bool attached_[side_count] = {false, false};
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 
+#include "assetId.hpp"
 #include "dateTime.hpp"
 #include "function.hpp"
 #include "graphics/contrast.hpp"
@@ -187,6 +188,12 @@ public:
     // fades. Custom colored text will not be faded.
     void set_tile(u16 x, u16 y, TileDesc glyph, const FontColors& colors);
 
+    // Writes count overlay tiles along row y, starting at column x. Same as
+    // calling set_tile() for each tile, but lets the platform check bounds and
+    // mark the row for copying once, rather than for every tile. (On the gba,
+    // glyphs still go tile by tile, to keep their reference counts.)
+    void set_tiles(u16 x, u16 y, const TileDesc* tiles, u32 count);
+
     // This function is not necessarily implemented efficiently, may in fact be
     // very slow.
     TileDesc get_tile(Layer layer, u16 x, u16 y);
@@ -197,16 +204,18 @@ public:
     void set_overlay_origin(Float x, Float y);
 
 
-    void load_sprite_texture(const char* name);
-    void load_tile0_texture(const char* name);
-    void load_tile1_texture(const char* name);
-    bool load_overlay_texture(const char* name);
+    void load_sprite_texture(AssetId name);
+    void load_tile0_texture(AssetId name);
+    void load_tile1_texture(AssetId name);
+    bool load_overlay_texture(AssetId name);
 
-    bool overlay_texture_exists(const char* name);
+    bool overlay_texture_exists(AssetId name);
 
     // Sleep halts the game for an amount of time equal to some number
     // of game updates. Given that the game should be running at
-    // 60fps, one update equals 1/60 of a second.
+    // 60fps, one update equals 1/60 of a second. Sleep blocks everything,
+    // including input and the network, so for hit-stop in gameplay code, use
+    // Game::freeze() instead.
     using Frame = u32;
     void sleep(Frame frames);
 
@@ -234,8 +243,21 @@ public:
     bool read_save_data(void* buffer, u32 data_length, u32 offset);
 
 
+    // Returns the file's contents, null terminated, or nullptr if the file
+    // doesn't exist. If size is not null, stores the file's length, not
+    // counting the terminator.
     const char* load_file_contents(const char* folder,
-                                   const char* filename) const;
+                                   const char* filename,
+                                   u32* size = nullptr) const;
+
+
+    // Writes, or appends to, a file in one of the resource folders. Returns
+    // false on platforms without a writable filesystem.
+    bool write_file_contents(const char* folder,
+                             const char* filename,
+                             const void* data,
+                             u32 length,
+                             bool append = false);
 
 
     // Scratch buffers are sort of a blunt instrument. Designed for uncommon
@@ -311,6 +333,9 @@ public:
     public:
         static constexpr u32 sprite_limit = 128;
 
+        // Sprites with the same rotation and scale share a transform.
+        static constexpr u32 affine_transform_limit = 32;
+
         void draw(const Sprite& spr);
 
         void clear();
@@ -420,6 +445,17 @@ public:
             return states_;
         }
 
+        // Replaces the key states that poll() read, e.g. with key states
+        // from a replay file. Pass the states that the previous frame saw, so
+        // that key transitions still work.
+        void override_state(const RestoreState& prev, const RestoreState& state)
+        {
+            for (u32 i = 0; i < state.size(); ++i) {
+                prev_[i] = prev[i];
+                states_[i] = state[i];
+            }
+        }
+
         void restore_state(const RestoreState& state)
         {
             // NOTE: we're assigning both the current and previous state to the
@@ -500,10 +536,10 @@ public:
         // music such that all tracks are either looped or non-looping, and I
         // decided to make tracks loop. If you want music to stop when finished,
         // stop it yourself.
-        void play_music(const char* name, Microseconds offset);
+        void play_music(AssetId name, Microseconds offset);
         void stop_music();
 
-        bool is_music_playing(const char* name);
+        bool is_music_playing(AssetId name);
 
         // A platform's speaker may only have the resources to handle a limited
         // number of overlapping sounds. For such platforms, currently running
@@ -513,15 +549,15 @@ public:
         // If you pass in an optional position, platforms that support spatial
         // audio will attenuate the sound based on distance to the listener (the
         // camera center);
-        void play_sound(const char* name,
+        void play_sound(AssetId name,
                         int priority,
                         std::optional<Vec2<Float>> position = {});
-        bool is_sound_playing(const char* name);
+        bool is_sound_playing(AssetId name);
 
         // Updates the listener position for spatialized audio, if supported.
         void set_position(const Vec2<Float>& position);
 
-        Microseconds track_length(const char* sound_or_music_name);
+        Microseconds track_length(AssetId sound_or_music_name);
 
     private:
         friend class Platform;
@@ -749,6 +785,17 @@ inline void draw_image(Platform& pfrm,
 }
 
 
+// Sets every tile in a row of the overlay, e.g. for a banner.
+inline void fill_overlay_row(Platform& pfrm, u16 y, TileDesc tile)
+{
+    TileDesc row[32];
+    for (auto& t : row) {
+        t = tile;
+    }
+    pfrm.set_tiles(0, y, row, 32);
+}
+
+
 #ifdef __BLINDJUMP_ENABLE_LOGS
 #ifdef __GBA__
 // #pragma message "Warning: logging can wear down Flash memory, be careful using this on physical hardware!"
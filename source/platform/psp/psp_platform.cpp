@@ -99,9 +99,9 @@ extern "C" {
 #include "../../../build/psp/stub.hpp"
 
 
-const ImageData* find_image(const char* name)
+const ImageData* find_image(AssetId name)
 {
-    StringBuffer<64> str_name = name;
+    StringBuffer<64> str_name = name.name_;
     for (auto& entry : image_table) {
         if (str_name == entry.name_) {
             return &entry;
@@ -360,7 +360,7 @@ load_pixel(const u8* img_data, u32 img_size, int img_height, int x, int y)
 }
 
 
-void Platform::load_sprite_texture(const char* name)
+void Platform::load_sprite_texture(AssetId name)
 {
     auto img_data = find_image(name);
     if (not img_data) {
@@ -504,7 +504,7 @@ void load_map_texture(Platform& pfrm,
 static g2dColor clear_color;
 
 
-void Platform::load_tile0_texture(const char* name)
+void Platform::load_tile0_texture(AssetId name)
 {
     // if (str_cmp(name, "title_1_flattened")) {
     //     while (true) ;
@@ -519,7 +519,7 @@ void Platform::load_tile0_texture(const char* name)
                      map0_image_ram,
                      img_data->data_,
                      img_data->size_,
-                     strstr(name, "_flattened"));
+                     strstr(name.name_, "_flattened"));
 
     const auto tile_block = 60 / 12;
     const auto block_offset = 60 % 12;
@@ -527,7 +527,7 @@ void Platform::load_tile0_texture(const char* name)
 }
 
 
-void Platform::load_tile1_texture(const char* name)
+void Platform::load_tile1_texture(AssetId name)
 {
     auto img_data = find_image(name);
     if (not img_data) {
@@ -558,15 +558,15 @@ static g2dColor default_text_foreground_color;
 static g2dColor default_text_background_color;
 
 
-bool Platform::overlay_texture_exists(const char* name)
+bool Platform::overlay_texture_exists(AssetId name)
 {
     return find_image(name);
 }
 
 
-bool Platform::load_overlay_texture(const char* name)
+bool Platform::load_overlay_texture(AssetId name)
 {
-    StringBuffer<64> str_name = name;
+    StringBuffer<64> str_name = name.name_;
 
     auto img_data = find_image(name);
     if (not img_data) {
@@ -748,6 +748,14 @@ u16 Platform::get_tile(Layer layer, u16 x, u16 y)
 }
 
 
+void Platform::set_tiles(u16 x, u16 y, const TileDesc* tiles, u32 count)
+{
+    for (u32 i = 0; i < count; ++i) {
+        set_tile(Layer::overlay, x + i, y, tiles[i]);
+    }
+}
+
+
 static FontColors font_extra_palettes[16];
 static u32 font_extra_palette_write_index = 0;
 
@@ -808,15 +816,33 @@ const char* Platform::get_opt(char opt)
 
 
 const char* Platform::load_file_contents(const char* folder,
-                                         const char* filename) const
+                                         const char* filename,
+                                         u32* size) const
 {
-    for (auto& file : files) {
-        if (str_cmp(file.name_, filename) == 0 and
-            str_cmp(file.root_, folder) == 0) {
-            return reinterpret_cast<const char*>(file.data_);
-        }
+    const auto i = file_index.find(asset_path_hash(folder, filename));
+    if (i == -1) {
+        return nullptr;
     }
-    return nullptr;
+
+    const auto result = reinterpret_cast<const char*>(files[i].data_);
+
+    // The rom only holds text files, so the terminator marks the end.
+    if (size) {
+        *size = str_len(result);
+    }
+
+    return result;
+}
+
+
+bool Platform::write_file_contents(const char* folder,
+                                   const char* filename,
+                                   const void* data,
+                                   u32 length,
+                                   bool append)
+{
+    // TODO...
+    return false;
 }
 
 
@@ -998,6 +1024,14 @@ Platform::DeltaClock::TimePoint Platform::DeltaClock::sample() const
 }
 
 
+Microseconds Platform::DeltaClock::duration(TimePoint t1, TimePoint t2)
+{
+    // sample() returns ticks since the last reset(), and the rtc ticks once per
+    // microsecond.
+    return t2 - t1;
+}
+
+
 Platform::DeltaClock::~DeltaClock()
 {
 }
@@ -1578,7 +1612,7 @@ Platform::Speaker::Speaker()
 }
 
 
-void Platform::Speaker::play_sound(const char* name,
+void Platform::Speaker::play_sound(AssetId name,
                                    int priority,
                                    std::optional<Vec2<Float>> position)
 {
@@ -1586,7 +1620,7 @@ void Platform::Speaker::play_sound(const char* name,
 }
 
 
-bool Platform::Speaker::is_sound_playing(const char* name)
+bool Platform::Speaker::is_sound_playing(AssetId name)
 {
     // TODO
     return false;
@@ -1599,14 +1633,14 @@ void Platform::Speaker::set_position(const Vec2<Float>& position)
 }
 
 
-Microseconds Platform::Speaker::track_length(const char* sound_or_music_name)
+Microseconds Platform::Speaker::track_length(AssetId sound_or_music_name)
 {
     // TODO
     return 0;
 }
 
 
-void Platform::Speaker::play_music(const char* name, Microseconds offset)
+void Platform::Speaker::play_music(AssetId name, Microseconds offset)
 {
     // TODO
 }
@@ -1618,7 +1652,7 @@ void Platform::Speaker::stop_music()
 }
 
 
-bool Platform::Speaker::is_music_playing(const char* name)
+bool Platform::Speaker::is_music_playing(AssetId name)
 {
     // TODO
     return false;
@@ -4,6 +4,12 @@
 
 #ifdef __GBA__
 #define SCRATCH_BUFFER_SIZE 2000
+#elif defined(__BLINDJUMP_MAP_WIDTH) and defined(__BLINDJUMP_MAP_HEIGHT)
+// The pathfinder allocates a couple of structures proportional to the map size
+// from scratch buffers, so builds configured with larger maps (see tileMap.hpp)
+// scale the buffers along with the map area.
+#define SCRATCH_BUFFER_SIZE                                                    \
+    (4000 * ((__BLINDJUMP_MAP_WIDTH * __BLINDJUMP_MAP_HEIGHT + 319) / 320))
 #else
 #define SCRATCH_BUFFER_SIZE 4000
 #endif // __GBA__
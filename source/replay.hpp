@@ -0,0 +1,224 @@
+#pragma once
+
+#include "number/endian.hpp"
+#include "number/numeric.hpp"
+#include "platform/key.hpp"
+#include <algorithm>
+#include <optional>
+
+
+// A session is fully determined by the state that the game started from (the
+// save data, and the rng seeds), plus, for each frame, the key states and the
+// delta time passed to Game::update(). A replay file holds a ReplayHeader,
+// followed by save_size_ bytes of save data, followed by an encoded stream of
+// frames (see ReplayEncoder), ending with a zero byte.
+//
+// See start.cpp, which records and replays sessions, and reports update and
+// render times for the replayed frames.
+struct ReplayHeader {
+    static constexpr const u32 magic_val = 0x31524a42; // "BJR1"
+
+    host_u32 magic_;
+    host_u32 save_size_;
+    host_s32 critical_state_;
+    host_s32 utility_state_;
+};
+
+
+using ReplayKeys = u16;
+static_assert(int(Key::count) <= 16);
+
+
+struct ReplayFrame {
+    ReplayKeys keys_;
+    Microseconds delta_;
+};
+
+
+// Frame deltas hover around the same value, and the keys rarely change from one
+// frame to the next, so we store the difference from the previous frame's
+// delta, as a zigzag encoded varint, shifted left by two bits to make room for
+// a tag. The tag says whether the key states changed, in which case the next
+// two bytes hold the new states. Most frames take one or two bytes.
+//
+// A record never starts with a zero byte, which marks the end of the stream. A
+// replay cut short, e.g. by a crash, has no end marker, so the decoder stops at
+// the end of the data as well, and drops a trailing partial record.
+class ReplayEncoder {
+public:
+    static constexpr const u32 max_frame_size = 10 + sizeof(ReplayKeys);
+
+    enum Tag : u8 { end, same_keys, new_keys };
+
+    // Writes the frame to out, and returns the number of bytes written.
+    u32 encode(const ReplayFrame& frame, u8* out)
+    {
+        const s64 diff = s64(frame.delta_) - prev_.delta_;
+        const u64 zigzag = diff < 0 ? (u64(-diff) << 1) - 1 : u64(diff) << 1;
+
+        const bool keys_changed = frame.keys_ not_eq prev_.keys_;
+
+        u64 value = (zigzag << 2) | (keys_changed ? new_keys : same_keys);
+
+        u32 written = 0;
+        do {
+            u8 byte = value & 0x7f;
+            value >>= 7;
+            if (value) {
+                byte |= 0x80;
+            }
+            out[written++] = byte;
+        } while (value);
+
+        if (keys_changed) {
+            out[written++] = frame.keys_ & 0xff;
+            out[written++] = frame.keys_ >> 8;
+        }
+
+        prev_ = frame;
+
+        return written;
+    }
+
+private:
+    ReplayFrame prev_ = {0, 0};
+};
+
+
+class ReplayDecoder {
+public:
+    ReplayDecoder(const u8* data, const u8* end) : pos_(data), end_(end)
+    {
+    }
+
+    // Returns nothing at the end of the stream.
+    std::optional<ReplayFrame> next()
+    {
+        if (pos_ == end_ or *pos_ == ReplayEncoder::end) {
+            return {};
+        }
+
+        u64 value = 0;
+        for (int shift = 0;; shift += 7) {
+            if (pos_ == end_ or shift > 63) {
+                pos_ = end_;
+                return {};
+            }
+            const u8 byte = *pos_++;
+            value |= u64(byte & 0x7f) << shift;
+            if (not(byte & 0x80)) {
+                break;
+            }
+        }
+
+        const u64 zigzag = value >> 2;
+        const s64 diff =
+            (zigzag & 1) ? -s64(zigzag >> 1) - 1 : s64(zigzag >> 1);
+
+        prev_.delta_ += diff;
+
+        if ((value & 3) == ReplayEncoder::new_keys) {
+            if (end_ - pos_ < 2) {
+                pos_ = end_;
+                return {};
+            }
+            prev_.keys_ = pos_[0] | (pos_[1] << 8);
+            pos_ += 2;
+        }
+
+        return prev_;
+    }
+
+private:
+    const u8* pos_;
+    const u8* end_;
+    ReplayFrame prev_ = {0, 0};
+};
+
+
+// Counts durations in buckets that widen with the duration, each bucket
+// spanning an eighth of a power of two, so that percentiles come out within
+// about twelve percent of the actual value, whether we're timing a desktop pc
+// or a gameboy. Fits in a scratch buffer.
+class FrameTimeHistogram {
+public:
+    static constexpr const int sub_buckets = 8;
+    static constexpr const int bucket_count = sub_buckets * 22;
+
+
+    static constexpr int bucket(u32 value)
+    {
+        if (value < sub_buckets) {
+            return value;
+        }
+
+        const int exp = 31 - __builtin_clz(value);
+        const int sub = (value >> (exp - 3)) & (sub_buckets - 1);
+
+        return std::min(sub_buckets * (exp - 2) + sub, bucket_count - 1);
+    }
+
+
+    // The largest value that falls into a bucket.
+    static constexpr u32 bucket_limit(int index)
+    {
+        if (index < sub_buckets) {
+            return index;
+        }
+
+        const int exp = index / sub_buckets + 2;
+        const u32 sub = index % sub_buckets;
+
+        return ((sub_buckets + sub + 1) << (exp - 3)) - 1;
+    }
+
+
+    void record(Microseconds duration)
+    {
+        const u32 value = std::max(duration, 0);
+
+        ++counts_[bucket(value)];
+        ++count_;
+        max_ = std::max(max_, value);
+    }
+
+
+    // The duration that pct percent of recorded durations fall at or below,
+    // rounded up to the edge of its bucket.
+    u32 percentile(int pct) const
+    {
+        if (count_ == 0) {
+            return 0;
+        }
+
+        const u64 target = (u64(count_) * pct + 99) / 100;
+
+        u64 seen = 0;
+        for (int i = 0; i < bucket_count; ++i) {
+            seen += counts_[i];
+            if (seen >= target and seen) {
+                return std::min(bucket_limit(i), max_);
+            }
+        }
+
+        return max_;
+    }
+
+
+    u32 count() const
+    {
+        return count_;
+    }
+
+
+    u32 max() const
+    {
+        return max_;
+    }
+
+
+private:
+    u32 counts_[bucket_count] = {};
+    u32 count_ = 0;
+    u32 max_ = 0;
+};
@@ -710,6 +710,149 @@ struct LexicalDefRelocatable : public LexicalDef {
 }; static_assert(sizeof(LexicalDefRelocatable) == sizeof(LexicalDef));
 
 
+// Let bindings, resolved by the compiler to a fixed slot in the current
+// function's operand stack frame. The slot is relative to the top of the
+// operand stack upon entry into the function, i.e. the first value pushed by
+// the function body occupies slot zero. Unlike LexicalVarLoad, local slots
+// require no lookup and no allocation.
+struct LoadLocal {
+    Header header_;
+    u8 slot_;
+
+    static const char* name()
+    {
+        return "LOAD_LOCAL";
+    }
+
+    static constexpr Opcode op()
+    {
+        return 46;
+    }
+};
+
+
+// Pops the top of the operand stack, and writes the value into a local slot.
+struct StoreLocal {
+    Header header_;
+    u8 slot_;
+
+    static const char* name()
+    {
+        return "STORE_LOCAL";
+    }
+
+    static constexpr Opcode op()
+    {
+        return 47;
+    }
+};
+
+
+// Superinstruction, generated by the optimizer from a LoadVar followed by a
+// Funcall.
+struct FuncallVar {
+    Header header_;
+    host_u16 name_offset_;
+    u8 argc_;
+
+    static const char* name()
+    {
+        return "FUNCALL_VAR";
+    }
+
+    static constexpr Opcode op()
+    {
+        return 48;
+    }
+};
+
+
+// The optimizer pads over removed instructions with Nops, and then squeezes
+// them out of the bytecode before finishing. The vm will nonetheless skip over
+// any Nop that it encounters.
+struct Nop {
+    Header header_;
+
+    static const char* name()
+    {
+        return "NOP";
+    }
+
+    static constexpr Opcode op()
+    {
+        return 49;
+    }
+};
+
+
+
+// Returns the size of an instruction in bytes, or zero for the fatal opcode or
+// an unrecognized opcode.
+inline int instruction_size(Header* inst)
+{
+    switch (inst->op_) {
+    case Fatal::op():
+        return 0;
+
+    case PushString::op():
+        return sizeof(PushString) + ((PushString*)inst)->length_;
+
+#define MATCH(NAME)                                                            \
+    case NAME::op():                                                           \
+        return sizeof(NAME);
+
+        MATCH(LoadVar)
+        MATCH(LoadVarRelocatable)
+        MATCH(PushSymbol)
+        MATCH(PushSymbolRelocatable)
+        MATCH(PushNil)
+        MATCH(Push0)
+        MATCH(Push1)
+        MATCH(Push2)
+        MATCH(PushInteger)
+        MATCH(PushSmallInteger)
+        MATCH(JumpIfFalse)
+        MATCH(Jump)
+        MATCH(SmallJumpIfFalse)
+        MATCH(SmallJump)
+        MATCH(PushLambda)
+        MATCH(TailCall)
+        MATCH(TailCall1)
+        MATCH(TailCall2)
+        MATCH(TailCall3)
+        MATCH(Funcall)
+        MATCH(Funcall1)
+        MATCH(Funcall2)
+        MATCH(Funcall3)
+        MATCH(PushList)
+        MATCH(Pop)
+        MATCH(Ret)
+        MATCH(EarlyRet)
+        MATCH(Dup)
+        MATCH(MakePair)
+        MATCH(First)
+        MATCH(Rest)
+        MATCH(Arg)
+        MATCH(Arg0)
+        MATCH(Arg1)
+        MATCH(Arg2)
+        MATCH(PushThis)
+        MATCH(Not)
+        MATCH(LexicalDef)
+        MATCH(LexicalDefRelocatable)
+        MATCH(LexicalFramePush)
+        MATCH(LexicalFramePop)
+        MATCH(LexicalVarLoad)
+        MATCH(LoadLocal)
+        MATCH(StoreLocal)
+        MATCH(FuncallVar)
+        MATCH(Nop)
+#undef MATCH
+    }
+
+    return 0;
+}
+
 
 // Just a utility intended for the compiler, not to be used by the vm.
 inline Header* load_instruction(ScratchBuffer& buffer, int index)
@@ -717,73 +860,19 @@ inline Header* load_instruction(ScratchBuffer& buffer, int index)
     int offset = 0;
 
     while (true) {
-        switch (buffer.data_[offset]) {
-        case Fatal::op():
-            return nullptr;
+        auto inst = (Header*)(buffer.data_ + offset);
+        const auto size = instruction_size(inst);
 
-        case PushString::op():
-            if (index == 0) {
-                return (Header*)(buffer.data_ + offset);
-            } else {
-                index--;
-                offset += sizeof(PushString) +
-                    ((PushString*)(buffer.data_ + offset))->length_;
-            }
-            break;
+        if (size == 0) {
+            return nullptr;
+        }
 
-#define MATCH(NAME)                                                            \
-    case NAME::op():                                                           \
-        if (index == 0) {                                                      \
-            return (Header*)(buffer.data_ + offset);                           \
-        } else {                                                               \
-            index--;                                                           \
-            offset += sizeof(NAME);                                            \
-        }                                                                      \
-        break;
-
-            MATCH(LoadVar)
-            MATCH(LoadVarRelocatable)
-            MATCH(PushSymbol)
-            MATCH(PushSymbolRelocatable)
-            MATCH(PushNil)
-            MATCH(Push0)
-            MATCH(Push1)
-            MATCH(Push2)
-            MATCH(PushInteger)
-            MATCH(PushSmallInteger)
-            MATCH(JumpIfFalse)
-            MATCH(Jump)
-            MATCH(SmallJumpIfFalse)
-            MATCH(SmallJump)
-            MATCH(PushLambda)
-            MATCH(TailCall)
-            MATCH(TailCall1)
-            MATCH(TailCall2)
-            MATCH(TailCall3)
-            MATCH(Funcall)
-            MATCH(Funcall1)
-            MATCH(Funcall2)
-            MATCH(Funcall3)
-            MATCH(PushList)
-            MATCH(Pop)
-            MATCH(Ret)
-            MATCH(EarlyRet)
-            MATCH(Dup)
-            MATCH(MakePair)
-            MATCH(First)
-            MATCH(Rest)
-            MATCH(Arg)
-            MATCH(Arg0)
-            MATCH(Arg1)
-            MATCH(Arg2)
-            MATCH(PushThis)
-            MATCH(Not)
-            MATCH(LexicalDef)
-            MATCH(LexicalDefRelocatable)
-            MATCH(LexicalFramePush)
-            MATCH(LexicalFramePop)
-            MATCH(LexicalVarLoad)
+        if (index == 0) {
+            return inst;
         }
+
+        --index;
+        offset += size;
     }
     return nullptr;
 }
@@ -1,6 +1,8 @@
 #include "bytecode.hpp"
 #include "lisp.hpp"
+#include "memory/buffer.hpp"
 #include "number/endian.hpp"
+#include "platform/platform.hpp"
 
 
 namespace lisp {
@@ -10,13 +12,62 @@ Value* make_bytecode_function(Value* bytecode);
 
 
 u16 symbol_offset(const char* symbol);
+const char* symbol_from_offset(u16 offset);
+
+
+// Let bindings in compiled functions live in operand stack slots. While
+// compiling, we keep track of the operand stack depth, relative to the
+// beginning of the function, so that we can resolve each let variable to a
+// fixed slot.
+struct LocalScope {
+
+    // Let bindings captured by a nested lambda cannot live on the stack, and
+    // instead go through the interpreter's lexical bindings. We still record
+    // them in the scope, as such a binding may shadow a local slot.
+    static constexpr u8 dynamic_slot = 255;
+
+    struct Binding {
+        const char* name_;
+        u8 slot_;
+    };
+
+    Buffer<Binding, 32> bindings_;
+
+    const Binding* find(const char* name) const
+    {
+        for (int i = bindings_.size() - 1; i > -1; --i) {
+            if (bindings_[i].name_ == name) {
+                return &bindings_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    const Binding* find_local(const char* name) const
+    {
+        auto binding = find(name);
+        if (binding and binding->slot_ not_eq dynamic_slot) {
+            return binding;
+        }
+        return nullptr;
+    }
+
+    void truncate(u32 size)
+    {
+        while (bindings_.size() > size) {
+            bindings_.pop_back();
+        }
+    }
+};
 
 
 int compile_impl(ScratchBuffer& buffer,
                  int write_pos,
                  Value* code,
                  int jump_offset,
-                 bool tail_expr);
+                 bool tail_expr,
+                 LocalScope& scope,
+                 int stack_depth);
 
 
 template <typename Instruction>
@@ -38,11 +89,32 @@ static Instruction* append(ScratchBuffer& buffer, int& write_pos)
 }
 
 
+int compile_integer(ScratchBuffer& buffer, int write_pos, s32 value)
+{
+    if (value == 0) {
+        append<instruction::Push0>(buffer, write_pos);
+    } else if (value == 1) {
+        append<instruction::Push1>(buffer, write_pos);
+    } else if (value == 2) {
+        append<instruction::Push2>(buffer, write_pos);
+    } else if (value < 127 and value > -127) {
+        append<instruction::PushSmallInteger>(buffer, write_pos)->value_ =
+            value;
+    } else {
+        append<instruction::PushInteger>(buffer, write_pos)->value_.set(value);
+    }
+
+    return write_pos;
+}
+
+
 int compile_lambda(ScratchBuffer& buffer,
                    int write_pos,
                    Value* code,
                    int jump_offset)
 {
+    LocalScope scope;
+
     bool first = true;
 
     auto lat = code;
@@ -60,8 +132,13 @@ int compile_lambda(ScratchBuffer& buffer,
 
         bool tail_expr = lat->cons().cdr() == get_nil();
 
-        write_pos = compile_impl(
-            buffer, write_pos, lat->cons().car(), jump_offset, tail_expr);
+        write_pos = compile_impl(buffer,
+                                 write_pos,
+                                 lat->cons().car(),
+                                 jump_offset,
+                                 tail_expr,
+                                 scope,
+                                 0);
 
         lat = lat->cons().cdr();
     }
@@ -75,10 +152,12 @@ int compile_lambda(ScratchBuffer& buffer,
 int compile_quoted(ScratchBuffer& buffer,
                    int write_pos,
                    Value* code,
-                   bool tail_expr)
+                   bool tail_expr,
+                   LocalScope& scope)
 {
     if (code->type() == Value::Type::integer) {
-        write_pos = compile_impl(buffer, write_pos, code, 0, tail_expr);
+        write_pos =
+            compile_impl(buffer, write_pos, code, 0, tail_expr, scope, 0);
     } else if (code->type() == Value::Type::symbol) {
         auto inst = append<instruction::PushSymbol>(buffer, write_pos);
         inst->name_offset_.set(symbol_offset(code->symbol().name_));
@@ -92,7 +171,7 @@ int compile_quoted(ScratchBuffer& buffer,
                 break;
             }
             write_pos = compile_quoted(
-                buffer, write_pos, code->cons().car(), tail_expr);
+                buffer, write_pos, code->cons().car(), tail_expr, scope);
 
             code = code->cons().cdr();
 
@@ -113,11 +192,52 @@ int compile_quoted(ScratchBuffer& buffer,
 }
 
 
+// Returns true if the symbol appears anywhere within code.
+static bool references(Value* code, const char* name)
+{
+    while (code->type() == Value::Type::cons) {
+        if (references(code->cons().car(), name)) {
+            return true;
+        }
+        code = code->cons().cdr();
+    }
+
+    return code->type() == Value::Type::symbol and code->symbol().name_ == name;
+}
+
+
+// Returns true if a lambda nested within code refers to the symbol. A let
+// binding captured by a lambda may outlive the function's stack frame.
+static bool captured(Value* code, const char* name)
+{
+    if (code->type() not_eq Value::Type::cons) {
+        return false;
+    }
+
+    auto fn = code->cons().car();
+    if (fn->type() == Value::Type::symbol and
+        str_cmp(fn->symbol().name_, "lambda") == 0) {
+        return references(code->cons().cdr(), name);
+    }
+
+    while (code->type() == Value::Type::cons) {
+        if (captured(code->cons().car(), name)) {
+            return true;
+        }
+        code = code->cons().cdr();
+    }
+
+    return false;
+}
+
+
 int compile_let(ScratchBuffer& buffer,
                 int write_pos,
                 Value* code,
                 int jump_offset,
-                bool tail_expr)
+                bool tail_expr,
+                LocalScope& scope,
+                int stack_depth)
 {
     if (code->type() not_eq Value::Type::cons) {
         while (true)
@@ -125,20 +245,63 @@ int compile_let(ScratchBuffer& buffer,
         // TODO: raise error
     }
 
-    append<instruction::LexicalFramePush>(buffer, write_pos);
+    auto is_binding = [](Value* val) {
+        return val->type() == Value::Type::cons and
+               val->cons().car()->type() == Value::Type::symbol and
+               val->cons().cdr()->type() == Value::Type::cons;
+    };
+
+    // We can store the let bindings in operand stack slots, so long as no
+    // nested lambda captures any of the variables.
+    bool use_slots = true;
+    int binding_count = 0;
+
+    foreach (code->cons().car(), [&](Value* val) {
+        if (is_binding(val)) {
+            ++binding_count;
+            if (captured(code, val->cons().car()->symbol().name_)) {
+                use_slots = false;
+            }
+        }
+    })
+        ;
+
+    if (stack_depth + binding_count >= LocalScope::dynamic_slot or
+        scope.bindings_.size() + binding_count > scope.bindings_.capacity()) {
+        use_slots = false;
+    }
+
+    const auto scope_size = scope.bindings_.size();
+
+    int depth = stack_depth;
+
+    if (not use_slots) {
+        append<instruction::LexicalFramePush>(buffer, write_pos);
+    }
 
     foreach (code->cons().car(), [&](Value* val) {
-        if (val->type() == Value::Type::cons) {
+        if (is_binding(val)) {
             auto sym = val->cons().car();
             auto bind = val->cons().cdr();
-            if (sym->type() == Value::Type::symbol and
-                bind->type() == Value::Type::cons) {
-
-                write_pos = compile_impl(
-                    buffer, write_pos, bind->cons().car(), jump_offset, false);
 
+            write_pos = compile_impl(buffer,
+                                     write_pos,
+                                     bind->cons().car(),
+                                     jump_offset,
+                                     false,
+                                     scope,
+                                     depth);
+
+            if (use_slots) {
+                // The value simply stays on the operand stack.
+                scope.bindings_.push_back({sym->symbol().name_, (u8)depth});
+                ++depth;
+            } else {
                 auto inst = append<instruction::LexicalDef>(buffer, write_pos);
                 inst->name_offset_.set(symbol_offset(sym->symbol().name_));
+
+                scope.bindings_.push_back(
+                    {sym->symbol().name_, LocalScope::dynamic_slot});
             }
         }
     })
@@ -146,27 +309,89 @@ int compile_let(ScratchBuffer& buffer,
 
     code = code->cons().cdr();
 
+    if (code == get_nil()) {
+        append<instruction::PushNil>(buffer, write_pos);
+    }
+
+    bool first = true;
+
     while (code not_eq get_nil()) {
 
+        if (not first) {
+            append<instruction::Pop>(buffer, write_pos);
+        } else {
+            first = false;
+        }
+
         bool tail = tail_expr and code->cons().cdr() == get_nil();
 
-        write_pos = compile_impl(
-            buffer, write_pos, code->cons().car(), jump_offset, tail);
+        write_pos = compile_impl(buffer,
+                                 write_pos,
+                                 code->cons().car(),
+                                 jump_offset,
+                                 tail,
+                                 scope,
+                                 depth);
 
         code = code->cons().cdr();
     }
 
-    append<instruction::LexicalFramePop>(buffer, write_pos);
+    scope.truncate(scope_size);
+
+    if (use_slots) {
+        if (depth > stack_depth) {
+            // Move the result into the first slot, and discard the rest.
+            append<instruction::StoreLocal>(buffer, write_pos)->slot_ =
+                stack_depth;
+
+            for (int i = stack_depth + 1; i < depth; ++i) {
+                append<instruction::Pop>(buffer, write_pos);
+            }
+        }
+    } else {
+        append<instruction::LexicalFramePop>(buffer, write_pos);
+    }
 
     return write_pos;
 }
 
 
+// If the expression assigns a let binding stored in a local slot, i.e.
+// (set 'var value), returns the binding.
+static const LocalScope::Binding*
+set_local_target(Value* fn, Value* args, LocalScope& scope)
+{
+    if (fn->type() not_eq Value::Type::symbol or
+        str_cmp(fn->symbol().name_, "set") not_eq 0) {
+        return nullptr;
+    }
+
+    if (args->type() not_eq Value::Type::cons or
+        args->cons().cdr()->type() not_eq Value::Type::cons or
+        args->cons().cdr()->cons().cdr() not_eq get_nil()) {
+        return nullptr;
+    }
+
+    auto target = args->cons().car();
+    if (target->type() == Value::Type::cons and
+        target->cons().car()->type() == Value::Type::symbol and
+        str_cmp(target->cons().car()->symbol().name_, "'") == 0 and
+        target->cons().cdr()->type() == Value::Type::symbol) {
+
+        return scope.find_local(target->cons().cdr()->symbol().name_);
+    }
+
+    return nullptr;
+}
+
+
 int compile_impl(ScratchBuffer& buffer,
                  int write_pos,
                  Value* code,
                  int jump_offset,
-                 bool tail_expr)
+                 bool tail_expr,
+                 LocalScope& scope,
+                 int stack_depth)
 {
     if (code->type() == Value::Type::nil) {
 
@@ -174,22 +399,8 @@ int compile_impl(ScratchBuffer& buffer,
 
     } else if (code->type() == Value::Type::integer) {
 
-        if (code->integer().value_ == 0) {
-            append<instruction::Push0>(buffer, write_pos);
-        } else if (code->integer().value_ == 1) {
-            append<instruction::Push1>(buffer, write_pos);
-        } else if (code->integer().value_ == 2) {
-            append<instruction::Push2>(buffer, write_pos);
-        } else if (code->integer().value_ < 127 and
-                   code->integer().value_ > -127) {
-
-            append<instruction::PushSmallInteger>(buffer, write_pos)->value_ =
-                code->integer().value_;
+        write_pos = compile_integer(buffer, write_pos, code->integer().value_);
 
-        } else {
-            append<instruction::PushInteger>(buffer, write_pos)
-                ->value_.set(code->integer().value_);
-        }
     } else if (code->type() == Value::Type::string) {
         const auto str = code->string().value();
         const auto len = str_len(str);
@@ -235,6 +446,9 @@ int compile_impl(ScratchBuffer& buffer,
                 break;
             }
 
+        } else if (auto local = scope.find_local(code->symbol().name_)) {
+            append<instruction::LoadLocal>(buffer, write_pos)->slot_ =
+                local->slot_;
         } else {
             append<instruction::LoadVar>(buffer, write_pos)
                 ->name_offset_.set(symbol_offset(code->symbol().name_));
@@ -249,8 +463,13 @@ int compile_impl(ScratchBuffer& buffer,
         if (fn->type() == Value::Type::symbol and
             str_cmp(fn->symbol().name_, "let") == 0) {
 
-            write_pos = compile_let(
-                buffer, write_pos, lat->cons().cdr(), jump_offset, tail_expr);
+            write_pos = compile_let(buffer,
+                                    write_pos,
+                                    lat->cons().cdr(),
+                                    jump_offset,
+                                    tail_expr,
+                                    scope,
+                                    stack_depth);
 
         } else if (fn->type() == Value::Type::symbol and
                    str_cmp(fn->symbol().name_, "if") == 0) {
@@ -261,8 +480,13 @@ int compile_impl(ScratchBuffer& buffer,
                     ; // TODO: raise error!
             }
 
-            write_pos = compile_impl(
-                buffer, write_pos, lat->cons().car(), jump_offset, false);
+            write_pos = compile_impl(buffer,
+                                     write_pos,
+                                     lat->cons().car(),
+                                     jump_offset,
+                                     false,
+                                     scope,
+                                     stack_depth);
 
             auto jne = append<instruction::JumpIfFalse>(buffer, write_pos);
 
@@ -279,15 +503,25 @@ int compile_impl(ScratchBuffer& buffer,
                 }
             }
 
-            write_pos = compile_impl(
-                buffer, write_pos, true_branch, jump_offset, tail_expr);
+            write_pos = compile_impl(buffer,
+                                     write_pos,
+                                     true_branch,
+                                     jump_offset,
+                                     tail_expr,
+                                     scope,
+                                     stack_depth);
 
             auto jmp = append<instruction::Jump>(buffer, write_pos);
 
             jne->offset_.set(write_pos - jump_offset);
 
-            write_pos = compile_impl(
-                buffer, write_pos, false_branch, jump_offset, tail_expr);
+            write_pos = compile_impl(buffer,
+                                     write_pos,
+                                     false_branch,
+                                     jump_offset,
+                                     tail_expr,
+                                     scope,
+                                     stack_depth);
 
             jmp->offset_.set(write_pos - jump_offset);
 
@@ -303,27 +537,43 @@ int compile_impl(ScratchBuffer& buffer,
 
             auto lambda = append<instruction::PushLambda>(buffer, write_pos);
 
-            // TODO: compile multiple nested expressions! FIXME... pretty broken.
-            write_pos = compile_impl(buffer,
-                                     write_pos,
-                                     lat->cons().car(),
-                                     jump_offset + write_pos,
-                                     false);
-
-            append<instruction::Ret>(buffer, write_pos);
+            // Jumps within the nested lambda are relative to the beginning of
+            // the nested lambda. The nested lambda executes in its own stack
+            // frame, and cannot see our local slots.
+            write_pos = compile_lambda(buffer, write_pos, lat, write_pos);
 
             lambda->lambda_end_.set(write_pos - jump_offset);
 
         } else if (fn->type() == Value::Type::symbol and
                    str_cmp(fn->symbol().name_, "'") == 0) {
 
-            write_pos =
-                compile_quoted(buffer, write_pos, lat->cons().cdr(), tail_expr);
+            write_pos = compile_quoted(
+                buffer, write_pos, lat->cons().cdr(), tail_expr, scope);
         } else if (fn->type() == Value::Type::symbol and
                    str_cmp(fn->symbol().name_, "`") == 0) {
             while (true)
                 ;
             // TODO: Implement quasiquote for compiled code.
+        } else if (auto local =
+                       set_local_target(fn, lat->cons().cdr(), scope)) {
+
+            // (set 'var value), where var is a let binding stored in a local
+            // slot.
+            auto value = lat->cons().cdr()->cons().cdr()->cons().car();
+
+            write_pos = compile_impl(buffer,
+                                     write_pos,
+                                     value,
+                                     jump_offset,
+                                     false,
+                                     scope,
+                                     stack_depth);
+
+            append<instruction::StoreLocal>(buffer, write_pos)->slot_ =
+                local->slot_;
+
+            append<instruction::PushNil>(buffer, write_pos);
+
         } else {
             u8 argc = 0;
 
@@ -336,8 +586,13 @@ int compile_impl(ScratchBuffer& buffer,
                     break;
                 }
 
-                write_pos = compile_impl(
-                    buffer, write_pos, lat->cons().car(), jump_offset, false);
+                write_pos = compile_impl(buffer,
+                                         write_pos,
+                                         lat->cons().car(),
+                                         jump_offset,
+                                         false,
+                                         scope,
+                                         stack_depth + argc);
 
                 lat = lat->cons().cdr();
 
@@ -379,8 +634,13 @@ int compile_impl(ScratchBuffer& buffer,
                 append<instruction::Not>(buffer, write_pos);
             } else {
 
-                write_pos =
-                    compile_impl(buffer, write_pos, fn, jump_offset, false);
+                write_pos = compile_impl(buffer,
+                                         write_pos,
+                                         fn,
+                                         jump_offset,
+                                         false,
+                                         scope,
+                                         stack_depth + argc);
 
                 if (tail_expr) {
                     switch (argc) {
@@ -434,277 +694,710 @@ int compile_impl(ScratchBuffer& buffer,
 void live_values(::Function<24, void(Value&)> callback);
 
 
-class PeepholeOptimizer {
+// Optimizes a compiled function, along with any nested lambda definitions.
+// Each pass makes a single linear scan over the bytecode, rewriting
+// instructions in place. When a pass replaces a sequence of instructions with
+// something shorter, it pads over the leftover bytes with Nops. Then, the
+// final pass squeezes the Nops out of the bytecode and relocates all of the
+// jumps.
+//
+// NOTE: constant folding assumes that nobody rebinds the builtin arithmetic
+// operators.
+class Optimizer {
 public:
-    template <typename U, typename T>
-    void replace(ScratchBuffer& code_buffer, U& dest, T& source, u32& code_size)
+    Optimizer(ScratchBuffer& code, int code_size, ScratchBuffer& jump_targets)
+        : code_(code), code_size_(code_size), jump_targets_(jump_targets)
     {
-        static_assert(sizeof dest > sizeof source);
-        memcpy(&dest, &source, sizeof source);
+    }
+
+
+    int run()
+    {
+        if (not validate()) {
+            return code_size_;
+        }
+
+        thread_jumps();
 
+        const int max_pending_jumps = mark_jump_targets();
 
-        auto diff = (sizeof dest) - (sizeof source);
-        const int start = ((u8*)&dest - (u8*)code_buffer.data_) + sizeof source;
+        fold();
+        dedup_integers();
 
-        for (u32 i = start; i < code_size - diff; ++i) {
-            code_buffer.data_[i] = code_buffer.data_[i + diff];
+        if (max_pending_jumps > max_fixups) {
+            // We do not have enough space to relocate all of the jumps. The vm
+            // is able to step over Nops, so the bytecode is still usable.
+            return code_size_;
         }
 
-        code_size -= diff;
+        return compact();
+    }
+
+
+private:
+    static constexpr int max_lambda_depth = 16;
+    static constexpr int max_fixups = 32;
 
-        fixup_jumps(code_buffer, start, -diff);
+
+    instruction::Header* at(int offset)
+    {
+        return (instruction::Header*)(code_.data_ + offset);
     }
 
 
-    u32 run(ScratchBuffer& code_buffer, u32 code_size)
+    // Invokes callback(offset, instruction, lambda_start) for each instruction
+    // in the function, including nested lambdas. The callback may rewrite the
+    // current instruction, and instructions preceding it, so long as the
+    // rewritten code does not extend past the end of the current instruction.
+    template <typename F> void walk(F&& callback)
     {
-        int index = 0;
+        using namespace instruction;
+
+        Buffer<int, max_lambda_depth> lambdas;
+        lambdas.push_back(0);
+
+        int offset = 0;
+
         while (true) {
-            using namespace instruction;
-            auto inst = load_instruction(code_buffer, index);
+            auto inst = at(offset);
+            const auto op = inst->op_;
+            const auto size = instruction_size(inst);
 
-            switch (inst->op_) {
+            callback(offset, inst, lambdas.back());
+
+            switch (op) {
             case PushLambda::op():
-                // FIXME! We do not support optimization yet when there are
-                // nested lambda definitions, we need to carefully adjust the
-                // jump instruction coordinates in these cases, as jumps are
-                // relative to the beginning of the lambda.
-                return code_size;
+                lambdas.push_back(offset + sizeof(PushLambda));
+                break;
 
             case Ret::op():
-                goto TOP;
-
-            default:
-                ++index;
+                if (lambdas.size() == 1) {
+                    return;
+                }
+                lambdas.pop_back();
                 break;
             }
+
+            offset += size;
         }
+    }
 
-    TOP:
-        index = 0;
 
-        while (true) {
-            using namespace instruction;
+    // Make sure that we understand every instruction in the buffer before
+    // rewriting anything.
+    bool validate()
+    {
+        using namespace instruction;
 
-            auto inst = load_instruction(code_buffer, index);
-            switch (inst->op_) {
-            case Ret::op():
-                return code_size;
+        int depth = 0;
+        int offset = 0;
 
-            case PushLambda::op():
-                return code_size;
-
-            case PushSmallInteger::op(): {
-                if (index > 0) {
-                    auto prev = load_instruction(code_buffer, index - 1);
-                    if (prev->op_ == PushSmallInteger::op()) {
-                        if (((PushSmallInteger*)prev)->value_ ==
-                            ((PushSmallInteger*)inst)->value_) {
-
-                            Dup d;
-                            d.header_.op_ = Dup::op();
-                            replace(code_buffer,
-                                    *(PushSmallInteger*)inst,
-                                    d,
-                                    code_size);
-                            goto TOP;
-                        }
-                    } else if (prev->op_ == Dup::op()) {
-                        int backtrack = index - 2;
-                        while (backtrack > 0) {
-                            auto it = load_instruction(code_buffer, backtrack);
-                            if (it->op_ == Dup::op()) {
-                                --backtrack;
-                            } else if (it->op_ == PushSmallInteger::op()) {
-                                if (((PushSmallInteger*)it)->value_ ==
-                                    ((PushSmallInteger*)inst)->value_) {
-
-                                    Dup d;
-                                    d.header_.op_ = Dup::op();
-                                    replace(code_buffer,
-                                            *(PushSmallInteger*)inst,
-                                            d,
-                                            code_size);
-                                    // code_size -= sizeof(PushSmallInteger) - sizeof(Dup);
-                                    goto TOP;
-                                }
-                            } else {
-                                break;
-                            }
-                        }
-                    }
+        while (offset < code_size_) {
+            auto inst = at(offset);
+            const auto size = instruction_size(inst);
+
+            if (size == 0) {
+                return false;
+            }
+
+            if (inst->op_ == PushLambda::op()) {
+                if (++depth == max_lambda_depth) {
+                    return false;
                 }
-                ++index;
-                break;
+            } else if (inst->op_ == Ret::op()) {
+                if (depth == 0) {
+                    return offset + size == code_size_;
+                }
+                --depth;
             }
 
-            case SmallJump::op(): {
-                SmallJump* sj = (SmallJump*)inst;
-                if (code_buffer.data_[sj->offset_] == Ret::op() or
-                    code_buffer.data_[sj->offset_] == EarlyRet::op()) {
-                    // A jump to a return instruction can be replaced with a return
-                    // instruction.
-                    EarlyRet r;
-                    r.header_.op_ = EarlyRet::op();
-                    replace(code_buffer, *sj, r, code_size);
-                    goto TOP;
+            offset += size;
+        }
+
+        return false;
+    }
+
+
+    static bool is_jump(instruction::Header* inst)
+    {
+        using namespace instruction;
+
+        switch (inst->op_) {
+        case Jump::op():
+        case SmallJump::op():
+        case JumpIfFalse::op():
+        case SmallJumpIfFalse::op():
+            return true;
+        }
+
+        return false;
+    }
+
+
+    // Jump offsets are relative to the beginning of the enclosing lambda.
+    static int jump_offset(instruction::Header* inst)
+    {
+        using namespace instruction;
+
+        switch (inst->op_) {
+        case Jump::op():
+            return ((Jump*)inst)->offset_.get();
+
+        case JumpIfFalse::op():
+            return ((JumpIfFalse*)inst)->offset_.get();
+
+        case SmallJump::op():
+            return ((SmallJump*)inst)->offset_;
+
+        case SmallJumpIfFalse::op():
+            return ((SmallJumpIfFalse*)inst)->offset_;
+        }
+
+        return 0;
+    }
+
+
+    static void set_jump_offset(instruction::Header* inst, int offset)
+    {
+        using namespace instruction;
+
+        switch (inst->op_) {
+        case Jump::op():
+            ((Jump*)inst)->offset_.set(offset);
+            break;
+
+        case JumpIfFalse::op():
+            ((JumpIfFalse*)inst)->offset_.set(offset);
+            break;
+
+        case SmallJump::op():
+            ((SmallJump*)inst)->offset_ = offset;
+            break;
+
+        case SmallJumpIfFalse::op():
+            ((SmallJumpIfFalse*)inst)->offset_ = offset;
+            break;
+        }
+    }
+
+
+    static bool is_control_flow(instruction::Header* inst)
+    {
+        using namespace instruction;
+
+        switch (inst->op_) {
+        case PushLambda::op():
+        case Ret::op():
+        case EarlyRet::op():
+        case TailCall::op():
+        case TailCall1::op():
+        case TailCall2::op():
+        case TailCall3::op():
+            return true;
+        }
+
+        return is_jump(inst);
+    }
+
+
+    // Instructions that push a value onto the operand stack, without any other
+    // side effects.
+    static bool is_pure_push(instruction::Header* inst)
+    {
+        using namespace instruction;
+
+        switch (inst->op_) {
+        case LoadVar::op():
+        case LoadLocal::op():
+        case PushNil::op():
+        case Push0::op():
+        case Push1::op():
+        case Push2::op():
+        case PushInteger::op():
+        case PushSmallInteger::op():
+        case PushSymbol::op():
+        case PushString::op():
+        case PushThis::op():
+        case Arg0::op():
+        case Arg1::op():
+        case Arg2::op():
+        case Dup::op():
+            return true;
+        }
+
+        return false;
+    }
+
+
+    static bool integer_value(instruction::Header* inst, s32& result)
+    {
+        using namespace instruction;
+
+        switch (inst->op_) {
+        case Push0::op():
+            result = 0;
+            return true;
+
+        case Push1::op():
+            result = 1;
+            return true;
+
+        case Push2::op():
+            result = 2;
+            return true;
+
+        case PushSmallInteger::op():
+            result = ((PushSmallInteger*)inst)->value_;
+            return true;
+
+        case PushInteger::op():
+            result = ((PushInteger*)inst)->value_.get();
+            return true;
+        }
+
+        return false;
+    }
+
+
+    // Overwrite the bytes in the range [begin, end) with Nops.
+    void pad(int begin, int end)
+    {
+        for (int i = begin; i < end; ++i) {
+            code_.data_[i] = instruction::Nop::op();
+        }
+    }
+
+
+    int skip_nops(int offset)
+    {
+        while (at(offset)->op_ == instruction::Nop::op()) {
+            ++offset;
+        }
+        return offset;
+    }
+
+
+    // Retarget jumps that land on unconditional jumps, replace jumps to return
+    // instructions with returns, remove jumps to the next instruction, and
+    // shrink jumps to the one byte form where possible.
+    void thread_jumps()
+    {
+        using namespace instruction;
+
+        walk([this](int offset, Header* inst, int lambda_start) {
+            if (not is_jump(inst)) {
+                return;
+            }
+
+            const bool conditional = inst->op_ == JumpIfFalse::op() or
+                                     inst->op_ == SmallJumpIfFalse::op();
+
+            const int size = instruction_size(inst);
+
+            int target = skip_nops(lambda_start + jump_offset(inst));
+
+            // Jumps only go forwards, so chains of jumps cannot loop. Limit
+            // the length anyway, just in case.
+            for (int i = 0; i < 8; ++i) {
+                auto dest = at(target);
+                if (dest->op_ == Jump::op() or dest->op_ == SmallJump::op()) {
+                    target = skip_nops(lambda_start + jump_offset(dest));
                 } else {
-                    ++index;
+                    break;
                 }
-                break;
             }
 
-            case PushInteger::op(): {
-                if (index > 0) {
-                    auto prev = load_instruction(code_buffer, index - 1);
-                    if (prev->op_ == PushInteger::op()) {
-                        if (((PushInteger*)prev)->value_.get() ==
-                            ((PushInteger*)inst)->value_.get()) {
-
-                            Dup d;
-                            d.header_.op_ = Dup::op();
-                            replace(
-                                code_buffer, *(PushInteger*)inst, d, code_size);
-                            goto TOP;
-                        }
-                    } else if (prev->op_ == Dup::op()) {
-                        int backtrack = index - 2;
-                        while (backtrack > 0) {
-                            auto it = load_instruction(code_buffer, backtrack);
-                            if (it->op_ == Dup::op()) {
-                                --backtrack;
-                            } else if (it->op_ == PushInteger::op()) {
-                                if (((PushInteger*)it)->value_.get() ==
-                                    ((PushInteger*)inst)->value_.get()) {
-
-                                    Dup d;
-                                    d.header_.op_ = Dup::op();
-                                    replace(code_buffer,
-                                            *(PushInteger*)inst,
-                                            d,
-                                            code_size);
-                                    goto TOP;
-                                }
-                            } else {
-                                break;
-                            }
-                        }
-                    }
+            if (not conditional) {
+                const auto dest = at(target)->op_;
+                if (dest == Ret::op() or dest == EarlyRet::op()) {
+                    inst->op_ = EarlyRet::op();
+                    pad(offset + sizeof(EarlyRet), offset + size);
+                    return;
                 }
-                ++index;
-                break;
-            }
 
-            case Jump::op():
-                if (((Jump*)inst)->offset_.get() < 255) {
-                    SmallJump j;
-                    j.header_.op_ = SmallJump::op();
-                    j.offset_ = ((Jump*)inst)->offset_.get();
-                    replace(code_buffer, *(Jump*)inst, j, code_size);
-                    goto TOP;
+                if (target == skip_nops(offset + size)) {
+                    pad(offset, offset + size);
+                    return;
                 }
-                ++index;
-                break;
+            }
 
-            case JumpIfFalse::op():
-                if (((JumpIfFalse*)inst)->offset_.get() < 255) {
-                    SmallJumpIfFalse j;
-                    j.header_.op_ = SmallJumpIfFalse::op();
-                    j.offset_ = ((JumpIfFalse*)inst)->offset_.get();
-                    replace(code_buffer, *(JumpIfFalse*)inst, j, code_size);
-                    goto TOP;
+            const int rel = target - lambda_start;
+
+            if (rel < 255) {
+                if (inst->op_ == Jump::op()) {
+                    inst->op_ = SmallJump::op();
+                    pad(offset + sizeof(SmallJump), offset + size);
+                } else if (inst->op_ == JumpIfFalse::op()) {
+                    inst->op_ = SmallJumpIfFalse::op();
+                    pad(offset + sizeof(SmallJumpIfFalse), offset + size);
                 }
-                ++index;
-                break;
+                set_jump_offset(inst, rel);
+            } else if (inst->op_ == Jump::op() or
+                       inst->op_ == JumpIfFalse::op()) {
+                set_jump_offset(inst, rel);
+            } else {
+                // The threaded jump does not fit in a small jump, keep the
+                // original target.
+            }
+        });
+    }
 
-            default:
-                index++;
-                break;
+
+    // Counts, for each offset in the bytecode, the number of jumps landing
+    // there. Returns the maximum number of forward jumps (including the ends
+    // of lambda definitions) that span any single instruction.
+    int mark_jump_targets()
+    {
+        using namespace instruction;
+
+        auto& targets = jump_targets_.data_;
+
+        for (int i = 0; i < code_size_; ++i) {
+            targets[i] = 0;
+        }
+
+        auto mark = [&targets](int offset) {
+            if ((u8)targets[offset] < 255) {
+                ++targets[offset];
+            }
+        };
+
+        walk([&](int, Header* inst, int lambda_start) {
+            if (is_jump(inst)) {
+                mark(lambda_start + jump_offset(inst));
+            } else if (inst->op_ == PushLambda::op()) {
+                mark(lambda_start + ((PushLambda*)inst)->lambda_end_.get());
+            }
+        });
+
+        int pending = 0;
+        int max_pending = 0;
+
+        walk([&](int offset, Header* inst, int) {
+            // NOTE: the target count saturates, so we may overestimate.
+            pending -= (u8)targets[offset];
+
+            if (is_jump(inst) or inst->op_ == PushLambda::op()) {
+                ++pending;
+                if (pending > max_pending) {
+                    max_pending = pending;
+                }
             }
+        });
+
+        return max_pending;
+    }
+
+
+    bool is_jump_target(int offset)
+    {
+        return jump_targets_.data_[offset];
+    }
+
+
+    using History = Buffer<int, 4>;
+
+
+    // (<op> <integer> <integer>), for +, -, *, and /.
+    bool fold_arithmetic(History& history, int offset)
+    {
+        using namespace instruction;
+
+        if (history.size() < 3) {
+            return false;
         }
+
+        const int start = history[history.size() - 3];
+
+        auto fn = at(history.back());
+        if (fn->op_ not_eq LoadVar::op()) {
+            return false;
+        }
+
+        s32 lhs;
+        s32 rhs;
+        if (not integer_value(at(start), lhs) or
+            not integer_value(at(history[history.size() - 2]), rhs)) {
+            return false;
+        }
+
+        auto name = symbol_from_offset(((LoadVar*)fn)->name_offset_.get());
+
+        s32 result;
+
+        if (str_cmp(name, "+") == 0) {
+            result = (u32)lhs + (u32)rhs;
+        } else if (str_cmp(name, "-") == 0) {
+            result = (u32)lhs - (u32)rhs;
+        } else if (str_cmp(name, "*") == 0) {
+            result = (u32)lhs * (u32)rhs;
+        } else if (str_cmp(name, "/") == 0 and rhs not_eq 0 and rhs not_eq -1) {
+            result = lhs / rhs;
+        } else {
+            return false;
+        }
+
+        int write_pos = start;
+        write_pos = compile_integer(code_, write_pos, result);
+        pad(write_pos, offset + sizeof(Funcall2));
+
+        history.pop_back();
+        history.pop_back();
+        history.pop_back();
+        history.push_back(start);
+
+        return true;
     }
 
 
-    // We have just inserted/removed an instruction, and now need to scan
-    // through the bytecode, and adjust the offsets of local jumps within the
-    // lambda definition.
-    void
-    fixup_jumps(ScratchBuffer& code_buffer, int inflection_point, int size_diff)
+    // LoadVar followed by Funcall.
+    bool fuse_funcall(History& history, int offset, instruction::Header* inst)
     {
-        int index = 0;
-        int depth = 0;
+        using namespace instruction;
 
-        struct LambdaInfo {
-            int start_ = 0;
-        };
+        if (history.empty() or at(history.back())->op_ not_eq LoadVar::op()) {
+            return false;
+        }
 
-        Buffer<LambdaInfo, 15> function_stack;
-        function_stack.push_back({0});
+        u8 argc = 0;
 
-        while (true) {
-            using namespace instruction;
+        switch (inst->op_) {
+        case Funcall::op():
+            argc = ((Funcall*)inst)->argc_;
+            break;
+
+        case Funcall1::op():
+            argc = 1;
+            break;
+
+        case Funcall2::op():
+            argc = 2;
+            break;
+
+        case Funcall3::op():
+            argc = 3;
+            break;
+
+        default:
+            return false;
+        }
+
+        const int end = offset + instruction_size(inst);
+        const int start = history.back();
+        const auto name_offset = ((LoadVar*)at(start))->name_offset_.get();
+
+        auto fused = (FuncallVar*)at(start);
+        fused->header_.op_ = FuncallVar::op();
+        fused->name_offset_.set(name_offset);
+        fused->argc_ = argc;
+
+        pad(start + sizeof(FuncallVar), end);
+
+        return true;
+    }
+
+
+    // Constant folding, superinstructions, and removal of pushes immediately
+    // followed by pops. We only match sequences of instructions within a
+    // straight line block of code, where no jumps land in the middle of the
+    // sequence.
+    void fold()
+    {
+        using namespace instruction;
+
+        History history;
+
+        walk([&](int offset, Header* inst, int) {
+            if (is_jump_target(offset)) {
+                history.clear();
+            }
 
-            auto inst = load_instruction(code_buffer, index);
             switch (inst->op_) {
-            case PushLambda::op():
-                ++depth;
-                if (((PushLambda*)inst)->lambda_end_.get() > inflection_point) {
-                    auto end = ((PushLambda*)inst)->lambda_end_.get();
-                    ((PushLambda*)inst)->lambda_end_.set(end + size_diff);
-                }
-                ++index;
-                break;
+            case Nop::op():
+                return;
 
-            case Ret::op():
-                if (depth == 0) {
+            case TailCall2::op():
+                // A tail call to a builtin function is just a regular call,
+                // so we can fold tail calls too.
+                if (fold_arithmetic(history, offset)) {
                     return;
                 }
-                --depth;
-                ++index;
                 break;
 
-            case Jump::op():
-                if (((Jump*)inst)->offset_.get() > inflection_point) {
-                    auto offset = ((Jump*)inst)->offset_.get();
-                    ((Jump*)inst)->offset_.set(offset + size_diff);
+            case Funcall2::op():
+                if (fold_arithmetic(history, offset)) {
+                    return;
                 }
-                ++index;
-                break;
+                [[fallthrough]];
 
-            case JumpIfFalse::op():
-                if (((JumpIfFalse*)inst)->offset_.get() > inflection_point) {
-                    auto offset = ((JumpIfFalse*)inst)->offset_.get();
-                    ((JumpIfFalse*)inst)->offset_.set(offset + size_diff);
+            case Funcall::op():
+            case Funcall1::op():
+            case Funcall3::op():
+                if (fuse_funcall(history, offset, inst)) {
+                    return;
                 }
-                ++index;
                 break;
 
-            case SmallJump::op():
-                if (((SmallJump*)inst)->offset_ > inflection_point) {
-                    auto offset = ((SmallJump*)inst)->offset_;
-                    ((SmallJump*)inst)->offset_ = offset + size_diff;
+            case Pop::op():
+                if (not history.empty() and is_pure_push(at(history.back()))) {
+                    pad(history.back(), offset + sizeof(Pop));
+                    history.pop_back();
+                    return;
                 }
-                ++index;
                 break;
+            }
+
+            if (is_control_flow(inst)) {
+                history.clear();
+                return;
+            }
+
+            if (history.full()) {
+                history.erase(history.begin());
+            }
+
+            history.push_back(offset);
+        });
+    }
+
+
+    // Replace repeated pushes of the same integer with Dup instructions.
+    void dedup_integers()
+    {
+        using namespace instruction;
 
-            case SmallJumpIfFalse::op():
-                if (((SmallJumpIfFalse*)inst)->offset_ > inflection_point) {
-                    auto offset = ((SmallJumpIfFalse*)inst)->offset_;
-                    ((SmallJumpIfFalse*)inst)->offset_ = offset + size_diff;
+        bool known = false;
+        s32 value = 0;
+
+        walk([&](int offset, Header* inst, int) {
+            if (is_jump_target(offset)) {
+                known = false;
+            }
+
+            switch (inst->op_) {
+            case Nop::op():
+            case Dup::op():
+                return;
+            }
+
+            s32 current;
+            if (not integer_value(inst, current)) {
+                known = false;
+                return;
+            }
+
+            const int size = instruction_size(inst);
+
+            if (known and current == value and size > (int)sizeof(Dup)) {
+                inst->op_ = Dup::op();
+                pad(offset + sizeof(Dup), offset + size);
+            } else {
+                known = true;
+                value = current;
+            }
+        });
+    }
+
+
+    struct Fixup {
+        u16 position_; // Position of the jump instruction, after compaction.
+        u16 target_;   // Jump destination, before compaction.
+        u16 base_;     // Start of the enclosing lambda, after compaction.
+    };
+
+
+    // Remove all of the Nops. Jumps only go forwards, so we can relocate them
+    // by keeping track of pending jumps, and filling in the new offsets upon
+    // reaching each destination.
+    int compact()
+    {
+        using namespace instruction;
+
+        struct Frame {
+            int old_start_;
+            int new_start_;
+        };
+
+        Buffer<Frame, max_lambda_depth> lambdas;
+        lambdas.push_back({0, 0});
+
+        Buffer<Fixup, max_fixups> fixups;
+
+        int read = 0;
+        int write = 0;
+
+        while (true) {
+            for (auto it = fixups.begin(); it not_eq fixups.end();) {
+                if (it->target_ == read) {
+                    auto inst = at(it->position_);
+                    const int offset = write - it->base_;
+                    if (inst->op_ == PushLambda::op()) {
+                        ((PushLambda*)inst)->lambda_end_.set(offset);
+                    } else {
+                        set_jump_offset(inst, offset);
+                    }
+                    it = fixups.erase(it);
+                } else {
+                    ++it;
                 }
-                ++index;
-                break;
+            }
 
-            default:
-                ++index;
-                break;
+            auto inst = at(read);
+            const auto op = inst->op_;
+            const int size = instruction_size(inst);
+
+            if (op == Nop::op()) {
+                ++read;
+                continue;
+            }
+
+            auto& frame = lambdas.back();
+
+            if (is_jump(inst)) {
+                fixups.push_back({(u16)write,
+                                  (u16)(frame.old_start_ + jump_offset(inst)),
+                                  (u16)frame.new_start_});
+            } else if (op == PushLambda::op()) {
+                const auto end = ((PushLambda*)inst)->lambda_end_.get();
+                fixups.push_back({(u16)write,
+                                  (u16)(frame.old_start_ + end),
+                                  (u16)frame.new_start_});
+            }
+
+            for (int i = 0; i < size; ++i) {
+                code_.data_[write + i] = code_.data_[read + i];
+            }
+
+            read += size;
+            write += size;
+
+            if (op == PushLambda::op()) {
+                lambdas.push_back({read, write});
+            } else if (op == Ret::op()) {
+                if (lambdas.size() == 1) {
+                    break;
+                }
+                lambdas.pop_back();
             }
         }
+
+        // The compiler finds the end of a bytecode buffer by searching for
+        // trailing Fatal opcodes, so we need to clear out the leftover space.
+        for (int i = write; i < code_size_; ++i) {
+            code_.data_[i] = Fatal::op();
+        }
+
+        return write;
     }
+
+
+    ScratchBuffer& code_;
+    const int code_size_;
+    ScratchBuffer& jump_targets_;
 };
 
 
-void compile(Platform& pfrm, Value* code)
+void compile(Platform& pfrm, Value* code, bool optimize)
 {
     // We will be rendering all of our compiled code into this buffer.
     push_op(make_databuffer(pfrm));
@@ -737,9 +1430,10 @@ void compile(Platform& pfrm, Value* code)
 
     write_pos = compile_lambda(*buffer, write_pos, code, 0);
 
-    write_pos = PeepholeOptimizer().run(
-        *fn->function().bytecode_impl_.databuffer()->data_buffer().value(),
-        write_pos);
+    if (optimize) {
+        auto jump_targets = pfrm.make_scratch_buffer();
+        write_pos = Optimizer(*buffer, write_pos, *jump_targets).run();
+    }
 
     // std::cout << "compilation finished, bytes used: " << write_pos <<
     // std::endl;
@@ -39,6 +39,7 @@ union ValueMemory {
     DataBuffer data_buffer_;
     String string_;
     Character character_;
+    Vector vector_;
     __Reserved __reserved_;
 };
 
@@ -52,6 +53,9 @@ static HEAP_DATA ValueMemory value_pool_data[VALUE_POOL_SIZE];
 static Value* value_pool = nullptr;
 
 
+static GcStats gc_stats_;
+
+
 void value_pool_init()
 {
     for (int i = 0; i < VALUE_POOL_SIZE; ++i) {
@@ -72,6 +76,7 @@ Value* value_pool_alloc()
     if (value_pool) {
         auto ret = value_pool;
         value_pool = ret->heap_node().next_;
+        ++gc_stats_.live_;
         return (Value*)ret;
     }
     return nullptr;
@@ -86,6 +91,8 @@ void value_pool_free(Value* value)
 
     value->heap_node().next_ = value_pool;
     value_pool = value;
+
+    --gc_stats_.live_;
 }
 
 
@@ -95,8 +102,9 @@ struct Context {
     using Interns = char[string_intern_table_size];
 
     Context(Platform& pfrm)
-        : operand_stack_(allocate_dynamic<OperandStack>(pfrm)),
-          interns_(allocate_dynamic<Interns>(pfrm)), pfrm_(pfrm)
+        : operand_stack_(allocate_dynamic<OperandStack>(pfrm, "lisp-stack")),
+          interns_(allocate_dynamic<Interns>(pfrm, "lisp-interns")),
+          pfrm_(pfrm)
     {
         if (not operand_stack_ or not interns_) {
             pfrm_.fatal("pointer compression test failed");
@@ -114,6 +122,7 @@ struct Context {
     Value* nil_ = nullptr;
     Value* oom_ = nullptr;
     Value* string_buffer_ = nullptr;
+    Value* vector_buffer_ = nullptr;
     Value* globals_tree_ = nullptr;
 
     Value* lexical_bindings_ = nullptr;
@@ -122,7 +131,10 @@ struct Context {
     const IntegralConstant* constants_ = nullptr;
     u16 constants_count_ = 0;
 
+    SetVarHook set_var_hook_ = nullptr;
+
     int string_intern_pos_ = 0;
+    u16 vector_buffer_pos_ = 0;
     int eval_depth_ = 0;
     int interp_entry_count_ = 0;
 
@@ -789,6 +801,188 @@ Value* make_string(Platform& pfrm, const char* string)
 }
 
 
+static const u32 vector_buffer_capacity =
+    SCRATCH_BUFFER_SIZE / sizeof(CompressedPtr);
+
+
+// Allocates a vector across multiple data buffers (see Vector).
+static Value* make_spanning_vector(Platform& pfrm, u32 size, Value* init)
+{
+    const u32 chunks =
+        (size + vector_buffer_capacity - 1) / vector_buffer_capacity;
+
+    if (pfrm.scratch_buffers_remaining() < (int)chunks + 1) {
+        run_gc();
+        if (pfrm.scratch_buffers_remaining() < (int)chunks + 1) {
+            return make_error(Error::Code::out_of_memory, L_NIL);
+        }
+    }
+
+    push_op(init); // gc protect
+
+    auto table = make_databuffer(pfrm);
+    if (table == bound_context->oom_) {
+        pop_op(); // init
+        return table;
+    }
+    push_op(table);
+
+    // The table holds the only references to the element buffers, and the gc
+    // doesn't look inside of data buffers, so keep them on the stack until the
+    // vector exists.
+    for (u32 i = 0; i < chunks; ++i) {
+        auto chunk = make_databuffer(pfrm);
+        if (chunk == bound_context->oom_) {
+            for (u32 j = 0; j < i + 2; ++j) {
+                pop_op();
+            }
+            return chunk;
+        }
+        push_op(chunk);
+
+        const auto ptr = compr(chunk);
+        __builtin_memcpy(table->data_buffer().value()->data_ +
+                             i * sizeof(CompressedPtr),
+                         &ptr,
+                         sizeof ptr);
+    }
+
+    auto val = alloc_value();
+
+    for (u32 i = 0; i < chunks + 2; ++i) {
+        pop_op();
+    }
+
+    if (val == nullptr) {
+        return bound_context->oom_;
+    }
+
+    val->hdr_.type_ = Value::Type::vector;
+    val->hdr_.mode_bits_ = (u8)Vector::ModeBits::spanning;
+    val->vector().data_buffer_ = compr(table);
+    val->vector().offset_ = 0;
+    val->vector().size_ = size;
+
+    for (u32 i = 0; i < size; ++i) {
+        val->vector().set(i, init);
+    }
+
+    return val;
+}
+
+
+Value* make_vector(Platform& pfrm, u32 size, Value* init)
+{
+    if (size > std::numeric_limits<u16>::max()) {
+        return make_error(Error::Code::out_of_memory, L_NIL);
+    }
+
+    if (size > vector_buffer_capacity) {
+        return make_spanning_vector(pfrm, size, init);
+    }
+
+    push_op(init); // gc protect
+
+    auto buffer = bound_context->vector_buffer_;
+
+    if (buffer == L_NIL or
+        bound_context->vector_buffer_pos_ + size > vector_buffer_capacity) {
+
+        buffer = make_databuffer(pfrm);
+        if (buffer == bound_context->oom_) {
+            pop_op(); // init
+            return buffer;
+        }
+
+        bound_context->vector_buffer_ = buffer;
+        bound_context->vector_buffer_pos_ = 0;
+    }
+
+    push_op(buffer); // In case alloc_value() runs the gc.
+    auto val = alloc_value();
+    pop_op(); // buffer
+    pop_op(); // init
+
+    if (val == nullptr) {
+        return bound_context->oom_;
+    }
+
+    val->hdr_.type_ = Value::Type::vector;
+    val->hdr_.mode_bits_ = (u8)Vector::ModeBits::packed;
+    val->vector().data_buffer_ = compr(buffer);
+    val->vector().offset_ = bound_context->vector_buffer_pos_;
+    val->vector().size_ = size;
+
+    bound_context->vector_buffer_pos_ += size;
+
+    for (u32 i = 0; i < size; ++i) {
+        val->vector().set(i, init);
+    }
+
+    return val;
+}
+
+
+// Shrink a vector to its first size elements. If the vector happens to be the
+// most recent allocation in the vector buffer, we can hand back the unused
+// space.
+static void vector_truncate(Value* vec, u16 size)
+{
+    auto& v = vec->vector();
+
+    if (dcompr(v.data_buffer_) == bound_context->vector_buffer_ and
+        v.offset_ + v.size_ == bound_context->vector_buffer_pos_) {
+        bound_context->vector_buffer_pos_ = v.offset_ + size;
+    }
+
+    v.size_ = size;
+}
+
+
+// Returns the data buffer holding the element buffer for a spanning vector.
+static Value* vector_chunk(Vector& v, u16 chunk)
+{
+    CompressedPtr result;
+    __builtin_memcpy(&result,
+                     dcompr(v.data_buffer_)->data_buffer().value()->data_ +
+                         chunk * sizeof(CompressedPtr),
+                     sizeof result);
+
+    return dcompr(result);
+}
+
+
+static char* vector_element(Vector& v, u16 index)
+{
+    if (v.spanning()) {
+        auto chunk = vector_chunk(v, index / vector_buffer_capacity);
+        return chunk->data_buffer().value()->data_ +
+               (index % vector_buffer_capacity) * sizeof(CompressedPtr);
+    }
+
+    return dcompr(v.data_buffer_)->data_buffer().value()->data_ +
+           (v.offset_ + index) * sizeof(CompressedPtr);
+}
+
+
+// NOTE: The elements are not necessarily aligned within the data buffer, so we
+// copy them in and out bytewise.
+Value* Vector::get(u16 index)
+{
+    CompressedPtr result;
+    __builtin_memcpy(&result, vector_element(*this, index), sizeof result);
+
+    return dcompr(result);
+}
+
+
+void Vector::set(u16 index, Value* value)
+{
+    const auto ptr = compr(value);
+    __builtin_memcpy(vector_element(*this, index), &ptr, sizeof ptr);
+}
+
+
 void set_list(Value* list, u32 position, Value* value)
 {
     while (position--) {
@@ -872,6 +1066,24 @@ Value* get_op(u32 offset)
 }
 
 
+u16 operand_stack_size()
+{
+    return bound_context->operand_stack_->size();
+}
+
+
+Value* load_local(u16 frame_base, u8 slot)
+{
+    return (*bound_context->operand_stack_)[frame_base + slot];
+}
+
+
+void store_local(u16 frame_base, u8 slot, Value* value)
+{
+    (*bound_context->operand_stack_)[frame_base + slot] = value;
+}
+
+
 void lexical_frame_push()
 {
     bound_context->lexical_bindings_ =
@@ -1096,10 +1308,21 @@ Value* set_var(Value* symbol, Value* val)
     }
 
     globals_tree_insert(symbol, val);
+
+    if (bound_context->set_var_hook_) {
+        bound_context->set_var_hook_(symbol->symbol().name_);
+    }
+
     return get_nil();
 }
 
 
+void set_var_hook(SetVarHook hook)
+{
+    bound_context->set_var_hook_ = hook;
+}
+
+
 bool is_boolean_true(Value* val)
 {
     switch (val->type()) {
@@ -1263,6 +1486,17 @@ void format_impl(Value* value, Printer& p, int depth)
         p.put_str(")");
         break;
 
+    case lisp::Value::Type::vector:
+        p.put_str("#(");
+        for (int i = 0; i < value->vector().size_; ++i) {
+            if (i > 0) {
+                p.put_str(" ");
+            }
+            format_impl(value->vector().get(i), p, depth + 1);
+        }
+        p.put_str(")");
+        break;
+
     case lisp::Value::Type::function:
         p.put_str("<lambda>");
         break;
@@ -1335,6 +1569,23 @@ static void gc_mark_value(Value* value)
         gc_mark_value(dcompr(value->string().data_buffer_));
         break;
 
+    case Value::Type::vector:
+        // Mark the vector first, in case the vector contains itself.
+        value->hdr_.mark_bit_ = true;
+        gc_mark_value(dcompr(value->vector().data_buffer_));
+        if (value->vector().spanning()) {
+            const int chunks =
+                (value->vector().size_ + vector_buffer_capacity - 1) /
+                vector_buffer_capacity;
+            for (int i = 0; i < chunks; ++i) {
+                gc_mark_value(vector_chunk(value->vector(), i));
+            }
+        }
+        for (int i = 0; i < value->vector().size_; ++i) {
+            gc_mark_value(value->vector().get(i));
+        }
+        break;
+
     case Value::Type::error:
         gc_mark_value(dcompr(value->error().context_));
         break;
@@ -1453,6 +1704,7 @@ static void invoke_finalizer(Value* value)
         DataBuffer::finalizer,
         String::finalizer,
         Character::finalizer,
+        Vector::finalizer,
         __Reserved::finalizer,
     };
 
@@ -1473,6 +1725,10 @@ static int gc_sweep()
         bound_context->string_buffer_ = L_NIL;
     }
 
+    if (not bound_context->vector_buffer_->hdr_.mark_bit_) {
+        bound_context->vector_buffer_ = L_NIL;
+    }
+
     int collect_count = 0;
 
     for (int i = 0; i < VALUE_POOL_SIZE; ++i) {
@@ -1509,7 +1765,21 @@ void live_values(::Function<24, void(Value&)> callback)
 
 static int run_gc()
 {
-    return gc_mark(), gc_sweep();
+    const int collected = (gc_mark(), gc_sweep());
+
+    ++gc_stats_.runs_;
+    gc_stats_.last_collected_ = collected;
+    gc_stats_.total_collected_ += collected;
+
+    return collected;
+}
+
+
+GcStats gc_stats()
+{
+    auto result = gc_stats_;
+    result.pool_size_ = VALUE_POOL_SIZE;
+    return result;
 }
 
 
@@ -1906,6 +2176,24 @@ u32 read(const char* code)
             // list now at stack top.
             return i;
 
+        case '#':
+            if (code[i + 1] not_eq '(') {
+                goto READ_SYMBOL;
+            }
+            // Vector syntax: the reader rewrites #(a b c) as (vector a b c),
+            // so vector literals work the same way in the interpreter and in
+            // compiled functions.
+            i += 2;
+            pop_op(); // nil
+            i += read_list(code + i);
+            if (get_op0()->type() not_eq Value::Type::error) {
+                Protected sym(make_symbol("vector"));
+                auto lat = make_cons(sym, get_op0());
+                pop_op(); // result of read_list()
+                push_op(lat);
+            }
+            return i;
+
         case ';':
             while (true) {
                 if (code[i] == '\0' or code[i] == '\r' or code[i] == '\n') {
@@ -2290,6 +2578,42 @@ Platform* interp_get_pfrm()
 }
 
 
+// Parses the arguments to range or vrange: (end), (start end), or
+// (start end incr). Returns an error value on failure.
+static Value* range_bounds(int argc, int& start, int& end, int& incr)
+{
+    if (argc == 1) {
+
+        L_EXPECT_OP(0, integer);
+
+        start = 0;
+        end = get_op0()->integer().value_;
+
+    } else if (argc == 2) {
+
+        L_EXPECT_OP(1, integer);
+        L_EXPECT_OP(0, integer);
+
+        start = get_op1()->integer().value_;
+        end = get_op0()->integer().value_;
+
+    } else if (argc == 3) {
+
+        L_EXPECT_OP(2, integer);
+        L_EXPECT_OP(1, integer);
+        L_EXPECT_OP(0, integer);
+
+        start = get_op(2)->integer().value_;
+        end = get_op1()->integer().value_;
+        incr = get_op0()->integer().value_;
+    } else {
+        return lisp::make_error(lisp::Error::Code::invalid_argc, L_NIL);
+    }
+
+    return nullptr;
+}
+
+
 void init(Platform& pfrm)
 {
     if (bound_context) {
@@ -2311,6 +2635,7 @@ void init(Platform& pfrm)
     bound_context->oom_->error().context_ = compr(bound_context->nil_);
 
     bound_context->string_buffer_ = bound_context->nil_;
+    bound_context->vector_buffer_ = bound_context->nil_;
     bound_context->macros_ = bound_context->nil_;
 
 
@@ -2376,6 +2701,21 @@ void init(Platform& pfrm)
                 return lat;
             }));
 
+    set_var("vector", make_function([](int argc) {
+                auto result = make_vector(bound_context->pfrm_, argc, L_NIL);
+                if (result->type() == Value::Type::error) {
+                    return result;
+                }
+                for (int i = 0; i < argc; ++i) {
+                    auto val = get_op((argc - 1) - i);
+                    if (val->type() == Value::Type::error) {
+                        return val;
+                    }
+                    result->vector().set(i, val);
+                }
+                return result;
+            }));
+
     set_var("arg", make_function([](int argc) {
                 L_EXPECT_ARGC(argc, 1);
                 L_EXPECT_OP(0, integer);
@@ -2438,6 +2778,7 @@ void init(Platform& pfrm)
 
                 case Value::Type::count:
                 case Value::Type::__reserved:
+                case Value::Type::vector:
                 case Value::Type::character:
                 case Value::Type::nil:
                 case Value::Type::heap_node:
@@ -2504,6 +2845,20 @@ void init(Platform& pfrm)
                 return result;
             }));
 
+    set_var("vfill", make_function([](int argc) {
+                L_EXPECT_ARGC(argc, 2);
+                L_EXPECT_OP(1, integer);
+
+                if (get_op1()->integer().value_ < 0) {
+                    return make_error(Error::Code::invalid_argument_type,
+                                      L_NIL);
+                }
+
+                return make_vector(bound_context->pfrm_,
+                                   get_op1()->integer().value_,
+                                   get_op0());
+            }));
+
     set_var("gen", make_function([](int argc) {
                 L_EXPECT_ARGC(argc, 2);
                 L_EXPECT_OP(1, integer);
@@ -2529,6 +2884,10 @@ void init(Platform& pfrm)
                     return make_integer(0);
                 }
 
+                if (get_op0()->type() == Value::Type::vector) {
+                    return make_integer(get_op0()->vector().size_);
+                }
+
                 L_EXPECT_OP(0, cons);
 
                 return make_integer(length(get_op0()));
@@ -2643,33 +3002,8 @@ void init(Platform& pfrm)
                 int end = 0;
                 int incr = 1;
 
-                if (argc == 1) {
-
-                    L_EXPECT_OP(0, integer);
-
-                    start = 0;
-                    end = get_op0()->integer().value_;
-
-                } else if (argc == 2) {
-
-                    L_EXPECT_OP(1, integer);
-                    L_EXPECT_OP(0, integer);
-
-                    start = get_op1()->integer().value_;
-                    end = get_op0()->integer().value_;
-
-                } else if (argc == 3) {
-
-                    L_EXPECT_OP(2, integer);
-                    L_EXPECT_OP(1, integer);
-                    L_EXPECT_OP(0, integer);
-
-                    start = get_op(2)->integer().value_;
-                    end = get_op1()->integer().value_;
-                    incr = get_op0()->integer().value_;
-                } else {
-                    return lisp::make_error(lisp::Error::Code::invalid_argc,
-                                            L_NIL);
+                if (auto err = range_bounds(argc, start, end, incr)) {
+                    return err;
                 }
 
                 if (incr == 0) {
@@ -2685,6 +3019,34 @@ void init(Platform& pfrm)
                 return lat.result();
             }));
 
+    set_var("vrange", make_function([](int argc) {
+                int start = 0;
+                int end = 0;
+                int incr = 1;
+
+                if (auto err = range_bounds(argc, start, end, incr)) {
+                    return err;
+                }
+
+                int count = 0;
+                if (incr > 0 and end > start) {
+                    count = (end - start + incr - 1) / incr;
+                }
+
+                auto result = make_vector(bound_context->pfrm_, count, L_NIL);
+                if (result->type() == Value::Type::error) {
+                    return result;
+                }
+
+                push_op(result); // gc protect
+                for (int i = 0; i < count; ++i) {
+                    result->vector().set(i, make_integer(start + i * incr));
+                }
+                pop_op(); // result
+
+                return result;
+            }));
+
     set_var("unbind", make_function([](int argc) {
                 L_EXPECT_ARGC(argc, 1);
                 L_EXPECT_OP(0, symbol);
@@ -2717,6 +3079,7 @@ void init(Platform& pfrm)
             case Value::Type::data_buffer: return "databuffer";
             case Value::Type::string: return "string";
             case Value::Type::character: return "character";
+            case Value::Type::vector: return "vector";
             case Value::Type::count:
             case Value::Type::__reserved:
             case Value::Type::heap_node:
@@ -2760,9 +3123,41 @@ void init(Platform& pfrm)
 
     set_var("filter", make_function([](int argc) {
                 L_EXPECT_ARGC(argc, 2);
-                L_EXPECT_OP(0, cons);
                 L_EXPECT_OP(1, function);
 
+                if (get_op0()->type() == Value::Type::vector) {
+                    auto fn = get_op1();
+                    auto input = get_op0();
+                    const auto len = input->vector().size_;
+
+                    auto result =
+                        make_vector(bound_context->pfrm_, len, L_NIL);
+                    if (result->type() == Value::Type::error) {
+                        return result;
+                    }
+
+                    push_op(result); // gc protect
+
+                    u16 count = 0;
+                    for (int i = 0; i < len; ++i) {
+                        push_op(input->vector().get(i));
+                        funcall(fn, 1);
+                        if (is_boolean_true(get_op0())) {
+                            result->vector().set(count++,
+                                                 input->vector().get(i));
+                        }
+                        pop_op(); // funcall result
+                    }
+
+                    pop_op(); // gc unprotect
+
+                    vector_truncate(result, count);
+
+                    return result;
+                }
+
+                L_EXPECT_OP(0, cons);
+
                 auto fn = get_op1();
                 Value* result = make_cons(L_NIL, L_NIL);
                 auto prev = result;
@@ -2821,6 +3216,45 @@ void init(Platform& pfrm)
                 return get_nil(); // TODO: return error
             }
 
+            if (get_op(argc - 2)->type() == Value::Type::vector) {
+                Buffer<Value*, 6> inp_vecs;
+
+                for (int i = 0; i < argc - 1; ++i) {
+                    L_EXPECT_OP(i, vector);
+                    inp_vecs.push_back(get_op(i));
+                }
+
+                const auto len = inp_vecs[0]->vector().size_;
+                for (auto& v : inp_vecs) {
+                    if (v->vector().size_ not_eq len) {
+                        return get_nil(); // return error instead!
+                    }
+                }
+
+                auto fn = get_op(argc - 1);
+
+                auto result = make_vector(bound_context->pfrm_, len, L_NIL);
+                if (result->type() == Value::Type::error) {
+                    return result;
+                }
+
+                push_op(result); // protect from the gc
+
+                for (int index = 0; index < len; ++index) {
+                    for (auto& v : reversed(inp_vecs)) {
+                        push_op(v->vector().get(index));
+                    }
+                    funcall(fn, inp_vecs.size());
+
+                    result->vector().set(index, get_op0());
+                    pop_op();
+                }
+
+                pop_op(); // the protected result vector
+
+                return result;
+            }
+
             for (int i = 0; i < argc - 1; ++i) {
                 L_EXPECT_OP(i, cons);
                 inp_lats.push_back(get_op(i));
@@ -2883,6 +3317,37 @@ void init(Platform& pfrm)
 
     set_var("select", make_function([](int argc) {
                 L_EXPECT_ARGC(argc, 2);
+
+                if (get_op0()->type() == Value::Type::vector) {
+                    L_EXPECT_OP(1, vector);
+
+                    auto input = get_op1();
+                    auto selection = get_op0();
+
+                    const auto len = input->vector().size_;
+                    if (len not_eq selection->vector().size_) {
+                        return get_nil();
+                    }
+
+                    auto result =
+                        make_vector(bound_context->pfrm_, len, L_NIL);
+                    if (result->type() == Value::Type::error) {
+                        return result;
+                    }
+
+                    u16 count = 0;
+                    for (int i = 0; i < len; ++i) {
+                        if (is_boolean_true(selection->vector().get(i))) {
+                            result->vector().set(count++,
+                                                 input->vector().get(i));
+                        }
+                    }
+
+                    vector_truncate(result, count);
+
+                    return result;
+                }
+
                 L_EXPECT_OP(0, cons);
                 L_EXPECT_OP(1, cons);
 
@@ -2891,30 +3356,53 @@ void init(Platform& pfrm)
                     return get_nil();
                 }
 
+                // Walk both lists in step, rather than indexing into them,
+                // which would be quadratic.
                 auto input_list = get_op1();
                 auto selection_list = get_op0();
 
-                auto result = get_nil();
-                for (int i = len - 1; i > -1; --i) {
-                    if (is_boolean_true(get_list(selection_list, i))) {
-                        push_op(result);
-                        auto next = make_cons(get_list(input_list, i), result);
-                        result = next;
-                        pop_op(); // result
+                ListBuilder result;
+                while (selection_list not_eq get_nil()) {
+                    if (is_boolean_true(selection_list->cons().car())) {
+                        result.push_back(input_list->cons().car());
                     }
+                    selection_list = selection_list->cons().cdr();
+                    input_list = input_list->cons().cdr();
                 }
 
-                return result;
+                return result.result();
             }));
 
     set_var("gc",
             make_function([](int argc) { return make_integer(run_gc()); }));
 
+    set_var("gc-stats", make_function([](int argc) {
+                const auto stats = gc_stats();
+
+                ListBuilder list;
+                list.push_back(make_integer(stats.live_));
+                list.push_back(make_integer(stats.pool_size_));
+                list.push_back(make_integer(stats.runs_));
+                list.push_back(make_integer(stats.last_collected_));
+                list.push_back(make_integer(stats.total_collected_));
+
+                return list.result();
+            }));
+
     set_var("get", make_function([](int argc) {
                 L_EXPECT_ARGC(argc, 2);
-                L_EXPECT_OP(1, cons);
                 L_EXPECT_OP(0, integer);
 
+                if (get_op1()->type() == Value::Type::vector) {
+                    const auto index = get_op0()->integer().value_;
+                    if (index < 0 or index >= get_op1()->vector().size_) {
+                        return get_nil();
+                    }
+                    return get_op1()->vector().get(index);
+                }
+
+                L_EXPECT_OP(1, cons);
+
                 return get_list(get_op1(), get_op0()->integer().value_);
             }));
 
@@ -3302,6 +3790,40 @@ void init(Platform& pfrm)
                         i += sizeof(LexicalVarLoad);
                         break;
 
+                    case LoadLocal::op():
+                        out += LoadLocal::name();
+                        out += "(";
+                        out += to_string<10>(*(data->data_ + i + 1));
+                        out += ")";
+                        i += sizeof(LoadLocal);
+                        break;
+
+                    case StoreLocal::op():
+                        out += StoreLocal::name();
+                        out += "(";
+                        out += to_string<10>(*(data->data_ + i + 1));
+                        out += ")";
+                        i += sizeof(StoreLocal);
+                        break;
+
+                    case FuncallVar::op():
+                        out += FuncallVar::name();
+                        out += "(";
+                        out += symbol_from_offset(
+                            ((FuncallVar*)(data->data_ + i))
+                                ->name_offset_.get());
+                        out += ", ";
+                        out += to_string<10>(
+                            ((FuncallVar*)(data->data_ + i))->argc_);
+                        out += ")";
+                        i += sizeof(FuncallVar);
+                        break;
+
+                    case Nop::op():
+                        out += Nop::name();
+                        i += sizeof(Nop);
+                        break;
+
                     case Ret::op(): {
                         if (depth == 0) {
                             out += "RET\r\n";
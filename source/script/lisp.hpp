@@ -57,6 +57,7 @@ struct ValueHeader {
         data_buffer,
         string,
         character,
+        vector,
         __reserved,
         count,
     };
@@ -343,6 +344,44 @@ struct UserData {
 };
 
 
+// A fixed-length array of values, with constant time indexing. The elements
+// live in a data buffer shared with other vectors. Like strings, the
+// interpreter allocates vectors sequentially within a data buffer, and only
+// reclaims the space when all of the vectors in the buffer have been collected.
+//
+// A vector too large for one data buffer spans several. Its data buffer then
+// holds pointers to buffers of its own, each one filled with elements, besides
+// possibly the last.
+struct Vector {
+    ValueHeader hdr_;
+    CompressedPtr data_buffer_;
+    u16 offset_; // Index of the first element within the data buffer.
+    u16 size_;
+
+    enum class ModeBits {
+        packed,
+        spanning,
+    };
+
+    static ValueHeader::Type type()
+    {
+        return ValueHeader::Type::vector;
+    }
+
+    bool spanning() const
+    {
+        return hdr_.mode_bits_ == (u8)ModeBits::spanning;
+    }
+
+    Value* get(u16 index);
+    void set(u16 index, Value* value);
+
+    static void finalizer(Value*)
+    {
+    }
+};
+
+
 struct __Reserved {
     ValueHeader hdr_;
 
@@ -442,6 +481,11 @@ struct Value {
         return *reinterpret_cast<Character*>(this);
     }
 
+    Vector& vector()
+    {
+        return *reinterpret_cast<Vector*>(this);
+    }
+
     template <typename T> T& expect()
     {
         if (this->type() == T::type()) {
@@ -474,6 +518,7 @@ Value* make_symbol(const char* name,
 Value* make_databuffer(Platform& pfrm);
 Value* make_string(Platform& pfrm, const char* str);
 Value* make_character(Platform& pfrm, utf8::Codepoint cp);
+Value* make_vector(Platform& pfrm, u32 size, Value* init);
 
 
 void get_interns(::Function<24, void(const char*)> callback);
@@ -518,6 +563,13 @@ Value* set_var(Value* sym, Value* value);
 Value* get_var(Value* sym);
 
 
+// Called with the (interned) name of each global variable that the interpreter
+// assigns, so that the host can invalidate anything that it derived from the
+// variable's previous value.
+using SetVarHook = void (*)(const char* name);
+void set_var_hook(SetVarHook hook);
+
+
 // Provided for convenience.
 inline Value* set_var(const char* name, Value* value)
 {
@@ -550,7 +602,29 @@ void eval(Value* code);
 
 
 // Parameter should be a function. Result on operand stack.
-void compile(Platform& pfrm, Value* code);
+void compile(Platform& pfrm, Value* code, bool optimize = true);
+
+
+// Selects how the bytecode vm dispatches instructions. Threaded dispatch falls
+// back to a switch statement on compilers without computed gotos. The counted
+// mode also tallies executed instructions, for benchmarking.
+enum class VmDispatch { threaded, switched, counted };
+void vm_dispatch(VmDispatch mode);
+u64 vm_instruction_count();
+
+
+struct GcStats {
+    // Values allocated from the interpreter's value pool.
+    u32 live_ = 0;
+    u32 pool_size_ = 0;
+
+    u32 runs_ = 0;
+    u32 last_collected_ = 0;
+    u32 total_collected_ = 0;
+};
+
+
+GcStats gc_stats();
 
 
 // Load code from a portable bytecode module. Result on operand stack.
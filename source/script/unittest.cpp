@@ -1,12 +1,14 @@
+#include "bytecode.hpp"
 #include "lisp.hpp"
 #include "platform/platform.hpp"
 
 
+#include <chrono>
 #include <fstream>
 #include <iostream>
 
 
-static lisp::Value* function_test()
+static bool function_test()
 {
     using namespace lisp;
 
@@ -20,11 +22,11 @@ static lisp::Value* function_test()
     push_op(make_integer(48));
     funcall(get_var("double"), 1);
 
-    L_EXPECT_OP(0, integer);
-
-    if (get_op(0)->integer().value_ not_eq 48 * 2) {
+    if (get_op(0)->type() not_eq Value::Type::integer or
+        get_op(0)->integer().value_ not_eq 48 * 2) {
         std::cout << "funcall test result check failed!" << std::endl;
-        return L_NIL;
+        pop_op();
+        return false;
     }
 
     // if (bound_context->operand_stack_.size() not_eq 1) {
@@ -37,11 +39,11 @@ static lisp::Value* function_test()
 
     std::cout << "funcall test passed!" << std::endl;
 
-    return L_NIL;
+    return true;
 }
 
 
-static lisp::Value* arithmetic_test()
+static bool arithmetic_test()
 {
     using namespace lisp;
 
@@ -49,25 +51,27 @@ static lisp::Value* arithmetic_test()
     push_op(make_integer(96));
     funcall(get_var("-"), 2);
 
-    L_EXPECT_OP(0, integer);
+    const bool ok = get_op(0)->type() == Value::Type::integer and
+                    get_op(0)->integer().value_ == 48 - 96;
+    pop_op();
 
-    if (get_op(0)->integer().value_ not_eq 48 - 96) {
+    if (not ok) {
         std::cout << "bad arithmetic!" << std::endl;
-        return L_NIL;
+        return false;
     }
 
     std::cout << "arithmetic test passed!" << std::endl;
 
-    return L_NIL;
+    return true;
 }
 
 
-static void intern_test()
+static bool intern_test()
 {
     auto initial = lisp::intern("blah");
     if (str_cmp("blah", initial) not_eq 0) {
         std::cout << "interpreter intern failed" << std::endl;
-        return;
+        return false;
     }
 
     // Intern some other junk. We want to re-intern the initial string (above),
@@ -76,14 +80,17 @@ static void intern_test()
     // table.
     if (str_cmp(lisp::intern("dskjflfs"), "dskjflfs") not_eq 0) {
         std::cout << "intern failed" << std::endl;
+        return false;
     }
 
     if (lisp::intern("blah") not_eq initial) {
         std::cout << "string intern leak" << std::endl;
-        return;
+        return false;
     }
 
     std::cout << "intern test passed!" << std::endl;
+
+    return true;
 }
 
 class Printer : public lisp::Printer {
@@ -95,7 +102,404 @@ public:
 };
 
 
-void do_tests()
+class StringPrinter : public lisp::Printer {
+public:
+    void put_str(const char* str) override
+    {
+        str_ += str;
+    }
+
+    std::string str_;
+};
+
+
+// Sample functions for the bytecode optimizer test. We compile each sample
+// with and without optimization, and make sure that both versions produce the
+// same result, and that the optimized version compiles to the expected
+// instructions (padding aside).
+static const struct OptimizerSample {
+    const char* function_;
+    const char* call_;
+    const char* optimized_;
+} optimizer_samples[] = {
+    {"(lambda (+ 1 2))", "(f)", "PUSH_SMALL_INTEGER RET"},
+    {"(lambda (* (- 500 2) (/ 12 4)))", "(f)", "PUSH_INTEGER RET"},
+    {"(lambda (- 3 (/ 7 2)) (- 200 -100))", "(f)", "PUSH_INTEGER RET"},
+    {"(lambda (+ $0 (* 2 3)))",
+     "(f 4)",
+     "ARG0 PUSH_SMALL_INTEGER LOAD_VAR TAILCALL2 RET"},
+    {"(lambda 1 2 'a (cons $0 $0))", "(f 3)", "ARG0 ARG0 MAKE_PAIR RET"},
+    {"(lambda (list 300 300 300 (if $0 300 200)))",
+     "(f 1)",
+     "PUSH_INTEGER DUP DUP ARG0 JUMP_SMALL_IF_FALSE PUSH_INTEGER JUMP_SMALL "
+     "PUSH_INTEGER LOAD_VAR TAILCALL RET"},
+    {"(lambda (if $0 (if $1 1 2) (if $1 3 4)))",
+     "(f nil 1)",
+     "ARG0 JUMP_SMALL_IF_FALSE ARG1 JUMP_SMALL_IF_FALSE PUSH_1 EARLY_RET "
+     "PUSH_2 EARLY_RET ARG1 JUMP_SMALL_IF_FALSE PUSH_SMALL_INTEGER EARLY_RET "
+     "PUSH_SMALL_INTEGER RET"},
+    {"(lambda (let ((a $0) (b (+ $0 1))) (set 'a 5) (+ a b)))",
+     "(f 2)",
+     "ARG0 ARG0 PUSH_1 FUNCALL_VAR PUSH_SMALL_INTEGER STORE_LOCAL LOAD_LOCAL "
+     "LOAD_LOCAL LOAD_VAR TAILCALL2 STORE_LOCAL POP RET"},
+    {"(lambda (let ((n $0) (acc $1))"
+     "  (if (> n 0) ((this) (- n 1) (+ acc n)) acc)))",
+     "(f 200 0)",
+     "ARG0 ARG1 LOAD_LOCAL PUSH_0 FUNCALL_VAR JUMP_SMALL_IF_FALSE LOAD_LOCAL "
+     "PUSH_1 FUNCALL_VAR LOAD_LOCAL LOAD_LOCAL FUNCALL_VAR PUSH_THIS "
+     "TAILCALL2 JUMP_SMALL LOAD_LOCAL STORE_LOCAL POP RET"},
+    {"(lambda (if (< $0 2) $0 (+ ((this) (- $0 1)) ((this) (- $0 2)))))",
+     "(f 15)",
+     "ARG0 PUSH_2 FUNCALL_VAR JUMP_SMALL_IF_FALSE ARG0 EARLY_RET ARG0 PUSH_1 "
+     "FUNCALL_VAR PUSH_THIS FUNCALL_1 ARG0 PUSH_2 FUNCALL_VAR PUSH_THIS "
+     "FUNCALL_1 LOAD_VAR TAILCALL2 RET"},
+    {"(lambda ((lambda (if $0 (cons $0 ((this) (cdr $0))))) $0))",
+     "(f '(1 2 3))",
+     "ARG0 PUSH_LAMBDA ARG0 JUMP_SMALL_IF_FALSE ARG0 ARG0 CDR PUSH_THIS "
+     "FUNCALL_1 MAKE_PAIR EARLY_RET PUSH_NIL RET TAILCALL1 RET"},
+    {"(lambda (let ((x $0))"
+     "  (lambda (let ((y (+ x 1))) (if (> y 2) (* y 2) (- y 2))))))",
+     "((f 7))",
+     "LEXICAL_FRAME_PUSH ARG0 LEXICAL_DEF PUSH_LAMBDA LOAD_VAR PUSH_1 "
+     "FUNCALL_VAR LOAD_LOCAL PUSH_2 FUNCALL_VAR JUMP_SMALL_IF_FALSE LOAD_LOCAL "
+     "PUSH_2 LOAD_VAR TAILCALL2 JUMP_SMALL LOAD_LOCAL PUSH_2 LOAD_VAR "
+     "TAILCALL2 STORE_LOCAL RET LEXICAL_FRAME_POP RET"},
+};
+
+
+static lisp::Value* compile_sample(Platform& pfrm,
+                                   const char* code,
+                                   bool optimize)
+{
+    using namespace lisp;
+
+    auto fn = dostring(code, [](Value& err) {});
+    push_op(fn);
+    compile(pfrm, dcompr(fn->function().lisp_impl_.code_), optimize);
+    auto result = get_op0();
+    pop_op();
+    pop_op();
+
+    return result;
+}
+
+
+static const char* instruction_name(lisp::instruction::Header* inst)
+{
+    using namespace lisp::instruction;
+
+    switch (inst->op_) {
+    case EarlyRet::op():
+        return "EARLY_RET";
+
+#define MATCH(NAME)                                                            \
+    case NAME::op():                                                           \
+        return NAME::name();
+
+        MATCH(LoadVar)
+        MATCH(LoadVarRelocatable)
+        MATCH(PushSymbol)
+        MATCH(PushSymbolRelocatable)
+        MATCH(PushString)
+        MATCH(PushNil)
+        MATCH(Push0)
+        MATCH(Push1)
+        MATCH(Push2)
+        MATCH(PushInteger)
+        MATCH(PushSmallInteger)
+        MATCH(JumpIfFalse)
+        MATCH(Jump)
+        MATCH(SmallJumpIfFalse)
+        MATCH(SmallJump)
+        MATCH(PushLambda)
+        MATCH(TailCall)
+        MATCH(TailCall1)
+        MATCH(TailCall2)
+        MATCH(TailCall3)
+        MATCH(Funcall)
+        MATCH(Funcall1)
+        MATCH(Funcall2)
+        MATCH(Funcall3)
+        MATCH(PushList)
+        MATCH(Pop)
+        MATCH(Ret)
+        MATCH(Dup)
+        MATCH(MakePair)
+        MATCH(First)
+        MATCH(Rest)
+        MATCH(Arg)
+        MATCH(Arg0)
+        MATCH(Arg1)
+        MATCH(Arg2)
+        MATCH(PushThis)
+        MATCH(Not)
+        MATCH(LexicalDef)
+        MATCH(LexicalDefRelocatable)
+        MATCH(LexicalFramePush)
+        MATCH(LexicalFramePop)
+        MATCH(LexicalVarLoad)
+        MATCH(LoadLocal)
+        MATCH(StoreLocal)
+        MATCH(FuncallVar)
+        MATCH(Nop)
+#undef MATCH
+    }
+
+    return "?";
+}
+
+
+// Returns the number of instructions in a compiled function, including
+// padding, and appends the names of the instructions, besides padding, to
+// listing.
+static int disassemble(lisp::Value* fn, std::string& listing)
+{
+    using namespace lisp;
+
+    auto data = fn->function().bytecode_impl_.databuffer()->data_buffer();
+    auto offset = fn->function().bytecode_impl_.bytecode_offset();
+
+    int count = 0;
+    int depth = 0;
+
+    for (int i = offset->integer().value_; i < SCRATCH_BUFFER_SIZE;) {
+        auto inst = (instruction::Header*)(data.value()->data_ + i);
+
+        ++count;
+
+        if (inst->op_ not_eq instruction::Nop::op()) {
+            if (not listing.empty()) {
+                listing += ' ';
+            }
+            listing += instruction_name(inst);
+        }
+
+        if (inst->op_ == instruction::PushLambda::op()) {
+            ++depth;
+        } else if (inst->op_ == instruction::Ret::op()) {
+            if (depth-- == 0) {
+                break;
+            }
+        }
+
+        const auto size = instruction::instruction_size(inst);
+        if (size == 0) {
+            break;
+        }
+        i += size;
+    }
+
+    return count;
+}
+
+
+static bool optimizer_test(Platform& pfrm)
+{
+    using namespace lisp;
+
+    bool passed = true;
+
+    for (auto& sample : optimizer_samples) {
+        std::string results[2];
+        int counts[2];
+        std::chrono::nanoseconds elapsed[2];
+
+        for (int optimize = 0; optimize < 2; ++optimize) {
+            auto fn = compile_sample(pfrm, sample.function_, optimize);
+            set_var("f", fn);
+
+            std::string listing;
+            counts[optimize] = disassemble(fn, listing);
+
+            if (optimize and listing not_eq sample.optimized_) {
+                std::cout << sample.function_ << std::endl
+                          << "  expected: " << sample.optimized_ << std::endl
+                          << "  got:      " << listing << std::endl;
+                passed = false;
+            }
+
+            StringPrinter p;
+            format(dostring(sample.call_, [](Value& err) {}), p);
+            results[optimize] = p.str_;
+
+            static const int iterations = 100;
+
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; ++i) {
+                dostring(sample.call_, [](Value& err) {});
+            }
+            elapsed[optimize] = std::chrono::steady_clock::now() - start;
+        }
+
+        std::cout << sample.function_ << std::endl
+                  << "  instructions: " << counts[0] << " -> " << counts[1]
+                  << ", time: " << elapsed[0].count() / 1000 << "us -> "
+                  << elapsed[1].count() / 1000 << "us" << std::endl;
+
+        if (results[0] not_eq results[1]) {
+            std::cout << "  result mismatch: " << results[0]
+                      << " != " << results[1] << std::endl;
+            passed = false;
+        }
+    }
+
+    set_var("f", get_nil());
+
+    if (passed) {
+        std::cout << "optimizer test passed!" << std::endl;
+    }
+
+    return passed;
+}
+
+
+// Each vector sample should produce the same printed result as the equivalent
+// list expression.
+static const struct VectorSample {
+    const char* vector_;
+    const char* expected_;
+} vector_samples[] = {
+    {"#(1 2 (+ 1 2))", "#(1 2 3)"},
+    {"(length (vrange 300))", "300"},
+    {"(get (vrange 2500) 2400)", "2400"},
+    {"(length (map + (vrange 2500) (vrange 2500)))", "2500"},
+    {"(get (filter (lambda (> $0 2200)) (vrange 2500)) 0)", "2201"},
+    {"(get (vrange 10 20) 5)", "15"},
+    {"(get #(1 2) 2)", "'()"},
+    {"(vfill 3 'a)", "#(a a a)"},
+    {"(vrange 0 10 3)", "#(0 3 6 9)"},
+    {"(map + (vrange 3) #(10 20 30))", "#(10 21 32)"},
+    {"(filter (lambda (> $0 2)) (vrange 6))", "#(3 4 5)"},
+    {"(select #(1 2 3) #(1 nil 1))", "#(1 3)"},
+    {"(select '(1 2 3) '(1 nil 1))", "'(1 3)"},
+    {"((compile (lambda #($0 $0))) 4)", "#(4 4)"},
+};
+
+
+static bool vector_test()
+{
+    using namespace lisp;
+
+    bool passed = true;
+
+    for (auto& sample : vector_samples) {
+        StringPrinter p;
+        format(dostring(sample.vector_, [](Value& err) {}), p);
+
+        if (p.str_ not_eq sample.expected_) {
+            std::cout << sample.vector_ << ": expected " << sample.expected_
+                      << ", got " << p.str_ << std::endl;
+            passed = false;
+        }
+    }
+
+    if (passed) {
+        std::cout << "vector test passed!" << std::endl;
+    }
+
+    return passed;
+}
+
+
+static bool gc_stats_test()
+{
+    using namespace lisp;
+
+    const auto before = gc_stats();
+
+    set_var("gc-test-list", make_list(100));
+    const auto allocated = gc_stats();
+
+    set_var("gc-test-list", get_nil());
+    dostring("(gc)", [](Value& err) {});
+    const auto collected = gc_stats();
+
+    if (allocated.live_ < before.live_ + 100 or
+        collected.runs_ not_eq allocated.runs_ + 1 or
+        collected.last_collected_ < 100 or
+        collected.live_ > allocated.live_ - 100 or
+        collected.pool_size_ < collected.live_) {
+        std::cout << "gc stats test failed!" << std::endl;
+        return false;
+    }
+
+    std::cout << "gc stats test passed!" << std::endl;
+
+    return true;
+}
+
+
+// Bytecode vm benchmarks. Each benchmark defines a compiled function f, and
+// then calls it repeatedly.
+static const struct VmBenchmark {
+    const char* name_;
+    const char* setup_;
+    const char* call_;
+} vm_benchmarks[] = {
+    {"fib",
+     "(set 'f (compile (lambda"
+     "  (if (< $0 2) $0 (+ (f (- $0 1)) (f (- $0 2)))))))",
+     "(f 15)"},
+    {"list building",
+     "(set 'f (compile (lambda"
+     "  (if (> $0 0) ((this) (- $0 1) (cons $0 $1)) $1))))",
+     "(f 1000 nil)"},
+    {"map over range",
+     "(set 'f (compile (lambda (map (lambda (+ $0 1)) (range $0)))))",
+     "(f 1000)"},
+    {"map over vrange",
+     "(set 'f (compile (lambda (map (lambda (+ $0 1)) (vrange $0)))))",
+     "(f 1000)"},
+};
+
+
+static void vm_benchmark()
+{
+    using namespace lisp;
+
+    static const int iterations = 20;
+
+    for (auto& benchmark : vm_benchmarks) {
+        dostring(benchmark.setup_, [](Value& err) {});
+
+        vm_dispatch(VmDispatch::counted);
+        dostring(benchmark.call_, [](Value& err) {});
+        const auto instructions = vm_instruction_count() * iterations;
+
+        std::cout << benchmark.name_ << ": " << instructions
+                  << " instructions" << std::endl;
+
+        static const struct {
+            const char* name_;
+            VmDispatch mode_;
+        } modes[] = {
+            {"switch", VmDispatch::switched},
+            {"threaded", VmDispatch::threaded},
+        };
+
+        for (auto& mode : modes) {
+            vm_dispatch(mode.mode_);
+
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; ++i) {
+                dostring(benchmark.call_, [](Value& err) {});
+            }
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+
+            std::cout << "  " << mode.name_ << ": "
+                      << (u64)(instructions / elapsed.count())
+                      << " instructions/s" << std::endl;
+        }
+    }
+
+    vm_dispatch(VmDispatch::threaded);
+    set_var("f", get_nil());
+}
+
+
+// Returns false if any of the tests failed.
+bool do_tests(Platform& pfrm)
 {
     auto lat = lisp::make_list(9);
 
@@ -105,9 +509,22 @@ void do_tests()
     Printer p;
     lisp::format(lisp::get_list(lisp::get_var("L"), 4), p);
 
-    intern_test();
-    function_test();
-    arithmetic_test();
+    bool ok = true;
+
+    ok &= intern_test();
+    ok &= function_test();
+    ok &= arithmetic_test();
+    ok &= optimizer_test(pfrm);
+    ok &= vector_test();
+    ok &= gc_stats_test();
+
+    vm_benchmark();
+
+    if (not ok) {
+        std::cout << "some tests failed!" << std::endl;
+    }
+
+    return ok;
 }
 
 
@@ -159,6 +576,10 @@ int main(int argc, char** argv)
 
     lisp::dostring(utilities, [](lisp::Value& err) {});
 
+    if (argc > 1 and std::string(argv[1]) == "--test") {
+        return do_tests(pfrm) ? 0 : 1;
+    }
+
     const char* prompt = ">> ";
 
     std::string line;
@@ -1,6 +1,7 @@
 #include "bytecode.hpp"
 #include "lisp.hpp"
 #include "number/endian.hpp"
+#include "util.hpp"
 
 
 namespace lisp {
@@ -23,6 +24,11 @@ void lexical_frame_pop();
 void lexical_frame_store(Value* kvp);
 
 
+u16 operand_stack_size();
+Value* load_local(u16 frame_base, u8 slot);
+void store_local(u16 frame_base, u8 slot, Value* value);
+
+
 template <typename Instruction>
 Instruction* read(ScratchBuffer& buffer, int& pc)
 {
@@ -32,12 +38,114 @@ Instruction* read(ScratchBuffer& buffer, int& pc)
 }
 
 
-void vm_execute(Platform& pfrm, Value* code_buffer, const int start_offset)
+// Direct threaded dispatch relies on the labels-as-values extension, supported
+// by gcc and clang. With direct threading, each instruction handler jumps
+// straight to the handler for the next instruction, rather than returning to a
+// central switch statement.
+#if defined(__GNUC__) and not defined(LISP_VM_NO_THREADED_DISPATCH)
+#define LISP_VM_THREADED_DISPATCH
+#endif
+
+
+#define LISP_VM_INSTRUCTIONS(X)                                                \
+    X(Fatal)                                                                   \
+    X(LoadVar)                                                                 \
+    X(PushNil)                                                                 \
+    X(PushInteger)                                                             \
+    X(PushSmallInteger)                                                        \
+    X(Push0)                                                                   \
+    X(Push1)                                                                   \
+    X(Push2)                                                                   \
+    X(PushSymbol)                                                              \
+    X(PushList)                                                                \
+    X(Funcall)                                                                 \
+    X(Funcall1)                                                                \
+    X(Funcall2)                                                                \
+    X(Funcall3)                                                                \
+    X(Jump)                                                                    \
+    X(SmallJump)                                                               \
+    X(JumpIfFalse)                                                             \
+    X(SmallJumpIfFalse)                                                        \
+    X(PushLambda)                                                              \
+    X(Pop)                                                                     \
+    X(Dup)                                                                     \
+    X(Ret)                                                                     \
+    X(MakePair)                                                                \
+    X(First)                                                                   \
+    X(Rest)                                                                    \
+    X(Arg)                                                                     \
+    X(TailCall)                                                                \
+    X(TailCall1)                                                               \
+    X(TailCall2)                                                               \
+    X(TailCall3)                                                               \
+    X(PushThis)                                                                \
+    X(Arg0)                                                                    \
+    X(Arg1)                                                                    \
+    X(Arg2)                                                                    \
+    X(EarlyRet)                                                                \
+    X(Not)                                                                     \
+    X(LexicalDef)                                                              \
+    X(LexicalFramePush)                                                        \
+    X(LexicalFramePop)                                                         \
+    X(PushString)                                                              \
+    X(LoadLocal)                                                               \
+    X(StoreLocal)                                                              \
+    X(FuncallVar)                                                              \
+    X(Nop)
+
+
+#ifdef LISP_VM_THREADED_DISPATCH
+#define VM_OP(INST)                                                            \
+    case INST::op():                                                           \
+    op_##INST
+#define VM_DISPATCH()                                                          \
+    if constexpr (threaded) {                                                  \
+        goto* dispatch_table[code_data[pc]];                                   \
+    } else {                                                                   \
+        break;                                                                 \
+    }
+#else
+#define VM_OP(INST) case INST::op()
+#define VM_DISPATCH() break
+#endif
+
+
+static VmDispatch vm_dispatch_mode = VmDispatch::threaded;
+static u64 vm_instructions_executed = 0;
+
+
+void vm_dispatch(VmDispatch mode)
+{
+    vm_dispatch_mode = mode;
+    vm_instructions_executed = 0;
+}
+
+
+u64 vm_instruction_count()
+{
+    return vm_instructions_executed;
+}
+
+
+// The handler labels go unused in the switch based instantiations. Label
+// addresses, and computed gotos, are a gcc extension, which -pedantic warns
+// about.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-label"
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+
+template <bool threaded, bool counted>
+static void vm_run(Platform& pfrm, Value* code_buffer, const int start_offset)
 {
     int pc = start_offset;
 
     auto& code = *code_buffer->data_buffer().value();
 
+    // Fetch opcodes through a local, rather than reloading the buffer pointer
+    // from the code value each time.
+    const u8* const code_data = (const u8*)code.data_;
+
     int nested_scope = 0;
 
     // If we are within a let expression, and we want to optimize out a
@@ -51,110 +159,143 @@ void vm_execute(Platform& pfrm, Value* code_buffer, const int start_offset)
         }
     };
 
+    // Local slots for let bindings begin immediately after the function's
+    // arguments.
+    const u16 frame_base = operand_stack_size();
+
+    // A recursive tail call reuses the current frame. Discard the previous
+    // arguments, along with any let bindings stored in local slots.
+    auto unwind_frame = [frame_base](u8 argc) {
+        while (operand_stack_size() > frame_base - argc) {
+            pop_op();
+        }
+    };
+
     using namespace instruction;
 
-TOP:
+#ifdef LISP_VM_THREADED_DISPATCH
+    // Each handler jumps through the table to the next instruction's handler.
+    // The table covers every possible byte value, unknown opcodes land on the
+    // Fatal handler.
+    [[maybe_unused]] static void* dispatch_table[256];
+
+    if constexpr (threaded) {
+        if (UNLIKELY(dispatch_table[0] == nullptr)) {
+            for (auto& entry : dispatch_table) {
+                entry = &&op_Fatal;
+            }
+#define VM_TABLE_ENTRY(INST) dispatch_table[INST::op()] = &&op_##INST;
+            LISP_VM_INSTRUCTIONS(VM_TABLE_ENTRY)
+#undef VM_TABLE_ENTRY
+        }
+    }
+#endif
+
     while (true) {
 
-        switch ((Opcode)code.data_[pc]) {
-        case JumpIfFalse::op(): {
+        if constexpr (counted) {
+            ++vm_instructions_executed;
+        }
+
+        switch ((Opcode)code_data[pc]) {
+        VM_OP(JumpIfFalse): {
             auto inst = read<JumpIfFalse>(code, pc);
             if (not is_boolean_true(get_op0())) {
                 pc = start_offset + inst->offset_.get();
             }
             pop_op();
-            break;
         }
+        VM_DISPATCH();
 
-        case Jump::op(): {
+        VM_OP(Jump): {
             auto inst = read<Jump>(code, pc);
             pc = start_offset + inst->offset_.get();
-            break;
         }
+        VM_DISPATCH();
 
-        case SmallJumpIfFalse::op(): {
+        VM_OP(SmallJumpIfFalse): {
             auto inst = read<SmallJumpIfFalse>(code, pc);
             if (not is_boolean_true(get_op0())) {
                 pc = start_offset + inst->offset_;
             }
             pop_op();
-            break;
         }
+        VM_DISPATCH();
 
-        case SmallJump::op(): {
+        VM_OP(SmallJump): {
             auto inst = read<SmallJump>(code, pc);
             pc = start_offset + inst->offset_;
-            break;
         }
+        VM_DISPATCH();
 
-        case LoadVar::op(): {
+        VM_OP(LoadVar): {
             auto inst = read<LoadVar>(code, pc);
             push_op(
                 get_var_stable(symbol_from_offset(inst->name_offset_.get())));
-            break;
         }
+        VM_DISPATCH();
 
-        case Dup::op(): {
+        VM_OP(Dup): {
             read<Dup>(code, pc);
             push_op(get_op0());
-            break;
         }
+        VM_DISPATCH();
 
-        case Not::op(): {
+        VM_OP(Not): {
             read<Not>(code, pc);
             auto input = get_op0();
             pop_op();
             push_op(make_integer(not is_boolean_true(input)));
-            break;
         }
+        VM_DISPATCH();
 
-        case PushNil::op():
+        VM_OP(PushNil):
             read<PushNil>(code, pc);
             push_op(get_nil());
-            break;
+            VM_DISPATCH();
 
-        case PushInteger::op(): {
+        VM_OP(PushInteger): {
             auto inst = read<PushInteger>(code, pc);
             push_op(make_integer(inst->value_.get()));
-            break;
         }
+        VM_DISPATCH();
 
-        case Push0::op():
+        VM_OP(Push0):
             read<Push0>(code, pc);
             push_op(make_integer(0));
-            break;
+            VM_DISPATCH();
 
-        case Push1::op():
+        VM_OP(Push1):
             read<Push1>(code, pc);
             push_op(make_integer(1));
-            break;
+            VM_DISPATCH();
 
-        case Push2::op():
+        VM_OP(Push2):
             read<Push2>(code, pc);
             push_op(make_integer(2));
-            break;
+            VM_DISPATCH();
 
-        case PushSmallInteger::op(): {
+        VM_OP(PushSmallInteger): {
             auto inst = read<PushSmallInteger>(code, pc);
             push_op(make_integer(inst->value_));
-            break;
         }
+        VM_DISPATCH();
 
-        case PushSymbol::op(): {
+        VM_OP(PushSymbol): {
             auto inst = read<PushSymbol>(code, pc);
             push_op(make_symbol(symbol_from_offset(inst->name_offset_.get()),
                                 Symbol::ModeBits::stable_pointer));
-            break;
         }
+        VM_DISPATCH();
 
-        case PushString::op(): {
+        VM_OP(PushString): {
             auto inst = read<PushString>(code, pc);
             push_op(make_string(pfrm, code.data_ + pc));
             pc += inst->length_;
-            break;
         }
+        VM_DISPATCH();
 
-        case TailCall::op(): {
+        VM_OP(TailCall): {
 
             Protected fn(get_op0());
 
@@ -177,8 +318,8 @@ TOP:
 
                 if (argc == 0) {
                     unwind_lexical_scope();
+                    unwind_frame(0);
                     pc = start_offset;
-                    goto TOP;
                 } else {
                     // TODO: perform TCO for N-arg function
                     funcall(fn, argc);
@@ -190,10 +331,10 @@ TOP:
                 funcall(fn, argc);
             }
 
-            break;
         }
+        VM_DISPATCH();
 
-        case TailCall1::op(): {
+        VM_OP(TailCall1): {
             read<TailCall1>(code, pc);
             Protected fn(get_op0());
 
@@ -209,22 +350,21 @@ TOP:
 
                 pop_op(); // function on stack
                 pop_op(); // argument
-                pop_op(); // previous arg
+                unwind_frame(1);
 
                 push_op(arg);
 
                 unwind_lexical_scope();
                 pc = start_offset;
-                goto TOP;
 
             } else {
                 pop_op();
                 funcall(fn, 1);
             }
-            break;
         }
+        VM_DISPATCH();
 
-        case TailCall2::op(): {
+        VM_OP(TailCall2): {
             read<TailCall2>(code, pc);
             Protected fn(get_op0());
 
@@ -242,24 +382,22 @@ TOP:
                 pop_op(); // function on stack
                 pop_op(); // arg
                 pop_op(); // arg
-                pop_op(); // prev arg
-                pop_op(); // prev arg
+                unwind_frame(2);
 
                 push_op(arg1);
                 push_op(arg0);
 
                 unwind_lexical_scope();
                 pc = start_offset;
-                goto TOP;
 
             } else {
                 pop_op();
                 funcall(fn, 2);
             }
-            break;
         }
+        VM_DISPATCH();
 
-        case TailCall3::op(): {
+        VM_OP(TailCall3): {
             read<TailCall3>(code, pc);
             Protected fn(get_op0());
 
@@ -277,9 +415,7 @@ TOP:
                 pop_op(); // arg
                 pop_op(); // arg
                 pop_op(); // arg
-                pop_op(); // prev arg
-                pop_op(); // prev arg
-                pop_op(); // prev arg
+                unwind_frame(3);
 
                 push_op(arg2);
                 push_op(arg1);
@@ -287,75 +423,85 @@ TOP:
 
                 unwind_lexical_scope();
                 pc = start_offset;
-                goto TOP;
 
             } else {
                 pop_op();
                 funcall(fn, 3);
             }
-            break;
         }
+        VM_DISPATCH();
 
-        case Funcall::op(): {
+        VM_OP(Funcall): {
             Protected fn(get_op0());
             auto argc = read<Funcall>(code, pc)->argc_;
             pop_op();
             funcall(fn, argc);
-            break;
         }
+        VM_DISPATCH();
 
-        case Funcall1::op(): {
+        VM_OP(Funcall1): {
             read<Funcall1>(code, pc);
             Protected fn(get_op0());
             pop_op();
             funcall(fn, 1);
-            break;
         }
+        VM_DISPATCH();
 
-        case Funcall2::op(): {
+        VM_OP(Funcall2): {
             read<Funcall2>(code, pc);
             Protected fn(get_op0());
             pop_op();
             funcall(fn, 2);
-            break;
         }
+        VM_DISPATCH();
 
-        case Funcall3::op(): {
+        VM_OP(Funcall3): {
             read<Funcall3>(code, pc);
             Protected fn(get_op0());
             pop_op();
             funcall(fn, 3);
-            break;
         }
+        VM_DISPATCH();
 
-        case Arg::op(): {
+        VM_OP(FuncallVar): {
+            auto inst = read<FuncallVar>(code, pc);
+            auto name = symbol_from_offset(inst->name_offset_.get());
+            funcall(get_var_stable(name), inst->argc_);
+        }
+        VM_DISPATCH();
+
+        VM_OP(Nop):
+            read<Nop>(code, pc);
+            VM_DISPATCH();
+
+        VM_OP(Arg): {
             read<Arg>(code, pc);
             auto arg_num = get_op0();
             auto arg = get_arg(arg_num->integer().value_);
             pop_op();
             push_op(arg);
-            break;
         }
+        VM_DISPATCH();
 
-        case Arg0::op(): {
+        VM_OP(Arg0): {
             read<Arg0>(code, pc);
             push_op(get_arg(0));
-            break;
         }
+        VM_DISPATCH();
 
-        case Arg1::op(): {
+        VM_OP(Arg1): {
             read<Arg1>(code, pc);
             push_op(get_arg(1));
-            break;
         }
+        VM_DISPATCH();
 
-        case Arg2::op(): {
+        VM_OP(Arg2): {
             read<Arg2>(code, pc);
             push_op(get_arg(2));
-            break;
         }
+        VM_DISPATCH();
 
-        case MakePair::op(): {
+        VM_OP(MakePair): {
             read<MakePair>(code, pc);
             auto car = get_op1();
             auto cdr = get_op0();
@@ -363,10 +509,10 @@ TOP:
             pop_op();
             pop_op();
             push_op(cons);
-            break;
         }
+        VM_DISPATCH();
 
-        case First::op(): {
+        VM_OP(First): {
             read<First>(code, pc);
             auto arg = get_op0();
             pop_op();
@@ -375,10 +521,10 @@ TOP:
             } else {
                 push_op(make_error(Error::Code::invalid_argument_type, L_NIL));
             }
-            break;
         }
+        VM_DISPATCH();
 
-        case Rest::op(): {
+        VM_OP(Rest): {
             read<Rest>(code, pc);
             auto arg = get_op0();
             pop_op();
@@ -387,19 +533,19 @@ TOP:
             } else {
                 push_op(make_error(Error::Code::invalid_argument_type, L_NIL));
             }
-            break;
         }
+        VM_DISPATCH();
 
-        case Pop::op():
+        VM_OP(Pop):
             read<Pop>(code, pc);
             pop_op();
-            break;
+            VM_DISPATCH();
 
-        case EarlyRet::op():
-        case Ret::op():
+        VM_OP(EarlyRet):
+        VM_OP(Ret):
             return;
 
-        case PushLambda::op(): {
+        VM_OP(PushLambda): {
             auto inst = read<PushLambda>(code, pc);
             auto offset = make_integer(pc);
             if (offset->type() == lisp::Value::Type::integer) {
@@ -414,10 +560,10 @@ TOP:
                 push_op(offset);
             }
             pc = start_offset + inst->lambda_end_.get();
-            break;
         }
+        VM_DISPATCH();
 
-        case PushList::op(): {
+        VM_OP(PushList): {
             auto list_size = read<PushList>(code, pc)->element_count_;
             Protected lat(make_list(list_size));
             for (int i = 0; i < list_size; ++i) {
@@ -427,16 +573,16 @@ TOP:
                 pop_op();
             }
             push_op(lat);
-            break;
         }
+        VM_DISPATCH();
 
-        case PushThis::op(): {
+        VM_OP(PushThis): {
             push_op(get_this());
             read<PushThis>(code, pc);
-            break;
         }
+        VM_DISPATCH();
 
-        case LexicalDef::op(): {
+        VM_OP(LexicalDef): {
             auto inst = read<LexicalDef>(code, pc);
             Protected sym(
                 make_symbol(symbol_from_offset(inst->name_offset_.get()),
@@ -449,31 +595,66 @@ TOP:
 
             lexical_frame_store(pair);
             pop_op();
-            break;
         }
+        VM_DISPATCH();
 
-        case LexicalFramePush::op(): {
+        VM_OP(LexicalFramePush): {
             read<LexicalFramePush>(code, pc);
             lexical_frame_push();
             ++nested_scope;
-            break;
         }
+        VM_DISPATCH();
 
-        case LexicalFramePop::op(): {
+        VM_OP(LexicalFramePop): {
             read<LexicalFramePop>(code, pc);
             lexical_frame_pop();
             --nested_scope;
-            break;
         }
+        VM_DISPATCH();
+
+        VM_OP(LoadLocal): {
+            auto inst = read<LoadLocal>(code, pc);
+            push_op(load_local(frame_base, inst->slot_));
+        }
+        VM_DISPATCH();
+
+        VM_OP(StoreLocal): {
+            auto inst = read<StoreLocal>(code, pc);
+            store_local(frame_base, inst->slot_, get_op0());
+            pop_op();
+        }
+        VM_DISPATCH();
 
         default:
-        case Fatal::op():
+        VM_OP(Fatal):
             while (true)
                 ;
-            break;
         }
     }
 }
 
 
+
+
+#pragma GCC diagnostic pop
+
+
+void vm_execute(Platform& pfrm, Value* code_buffer, const int start_offset)
+{
+    switch (vm_dispatch_mode) {
+    case VmDispatch::threaded:
+        vm_run<true, false>(pfrm, code_buffer, start_offset);
+        break;
+
+    case VmDispatch::switched:
+        vm_run<false, false>(pfrm, code_buffer, start_offset);
+        break;
+
+    case VmDispatch::counted:
+        vm_run<false, true>(pfrm, code_buffer, start_offset);
+        break;
+    }
+}
+
+
 } // namespace lisp
@@ -0,0 +1,336 @@
+#pragma once
+
+#include "platform/platform.hpp"
+#include <algorithm>
+#include <array>
+#include <new>
+
+
+// Small objects, allocated through allocate_dynamic(), used to each occupy an
+// entire scratch buffer. The arena carves scratch buffers into slabs of
+// fixed-size cells, one size class per slab, so that, for example, a couple
+// dozen sixty-four byte objects share a single scratch buffer. Objects too
+// large for any of the size classes still receive a whole scratch buffer.
+//
+// The arena also collects allocation telemetry: live counts and high water
+// marks for each size class, and for each call site. Callers of
+// allocate_dynamic() name their call site with a tag string.
+//
+// NOTE: The arena has no destructor, and holds no Rc<> members, so that objects
+// with static storage, like the lisp interpreter's context, may safely release
+// memory while the program exits. Instead, each slab keeps its own scratch
+// buffer alive, with a reference stored in the buffer's first few bytes.
+class SizeClassArena {
+public:
+    static constexpr const int class_count = 3;
+
+    // We track a slab's cells with a 64 bit mask.
+    static constexpr const u32 max_cells = 64;
+
+    static constexpr const u32 cell_align = 8;
+
+    static constexpr const int slab_count = 8;
+
+    static constexpr const int site_count = 16;
+
+
+    static constexpr u32 class_size(int size_class)
+    {
+        constexpr const u32 sizes[class_count] = {64, 256, 1024};
+        return sizes[size_class];
+    }
+
+
+    static constexpr u32 cells_per_slab(int size_class)
+    {
+        // Leave room to align the first cell, plus the slab's self-reference.
+        constexpr const u32 usable =
+            sizeof ScratchBuffer::data_ - (cell_align - 1) - cell_align;
+
+        return std::min(max_cells, usable / class_size(size_class));
+    }
+
+
+    // The smallest size class that fits an object, or -1, if the object needs
+    // a whole scratch buffer. We skip size classes with just one cell per slab
+    // (e.g. the 1k class on the gba, with its 2k scratch buffers), as they'd
+    // save nothing over a whole buffer.
+    static constexpr int size_class(u32 size, u32 align)
+    {
+        if (align > cell_align) {
+            return -1;
+        }
+
+        for (int i = 0; i < class_count; ++i) {
+            if (size <= class_size(i) and cells_per_slab(i) > 1) {
+                return i;
+            }
+        }
+
+        return -1;
+    }
+
+
+    struct Counter {
+        u16 live_ = 0;
+        u16 high_water_ = 0;
+
+        void inc()
+        {
+            if (++live_ > high_water_) {
+                high_water_ = live_;
+            }
+        }
+
+        void dec()
+        {
+            --live_;
+        }
+    };
+
+
+    struct ClassStats {
+        Counter cells_;
+        Counter slabs_;
+    };
+
+
+    struct SiteStats {
+        const char* tag_ = nullptr;
+        Counter allocs_;
+    };
+
+
+    // Returns memory to the arena when destroyed. Belongs to a DynamicMemory
+    // (see bulkAllocator.hpp).
+    class Handle {
+    public:
+        Handle() = default;
+
+        Handle(s8 slab, u8 cell, s8 site)
+            : slab_(slab), cell_(cell), site_(site), engaged_(true)
+        {
+        }
+
+        Handle(const Handle&) = delete;
+
+        Handle(Handle&& other)
+            : slab_(other.slab_), cell_(other.cell_), site_(other.site_),
+              engaged_(other.engaged_)
+        {
+            other.engaged_ = false;
+        }
+
+        Handle& operator=(Handle&& other);
+
+        ~Handle();
+
+    private:
+        s8 slab_ = -1;
+        u8 cell_ = 0;
+        s8 site_ = -1;
+        bool engaged_ = false;
+    };
+
+
+    struct Allocation {
+        ScratchBufferPtr buffer_;
+        void* mem_;
+        std::size_t size_;
+        Handle handle_;
+    };
+
+
+    Allocation alloc(Platform& pfrm, int size_class, const char* tag)
+    {
+        const s8 site = this->site(tag);
+        if (site not_eq -1) {
+            sites_[site].allocs_.inc();
+        }
+
+        if (size_class not_eq -1) {
+            for (auto& slab : slabs_) {
+                if (slab.class_ == size_class and
+                    slab.used_ not_eq full_mask(size_class)) {
+                    return take(slab, site);
+                }
+            }
+
+            for (auto& slab : slabs_) {
+                if (slab.class_ == -1) {
+                    return take(create_slab(pfrm, slab, size_class), site);
+                }
+            }
+
+            // The slab table is full. Fall back to a whole scratch buffer.
+        }
+
+        auto buffer = pfrm.make_scratch_buffer();
+        buffers_.inc();
+
+        void* mem = buffer->data_;
+        return {buffer, mem, sizeof buffer->data_, Handle(-1, 0, site)};
+    }
+
+
+    void release(s8 slab_index, u8 cell, s8 site)
+    {
+        if (site not_eq -1) {
+            sites_[site].allocs_.dec();
+        }
+
+        if (slab_index == -1) {
+            buffers_.dec();
+            return;
+        }
+
+        auto& slab = slabs_[slab_index];
+        auto& stats = classes_[slab.class_];
+
+        slab.used_ &= ~(u64(1) << cell);
+        stats.cells_.dec();
+
+        if (slab.used_ == 0) {
+            stats.slabs_.dec();
+            slab.class_ = -1;
+
+            // Drop the slab's reference to itself. If nobody else holds onto
+            // the buffer, it returns to the platform's scratch buffer pool.
+            slab.self_->~ScratchBufferPtr();
+            slab.self_ = nullptr;
+        }
+    }
+
+
+    // Scratch buffers allocated whole, through allocate_dynamic().
+    const Counter& buffer_stats() const
+    {
+        return buffers_;
+    }
+
+
+    const ClassStats& class_stats(int size_class) const
+    {
+        return classes_[size_class];
+    }
+
+
+    template <typename F> void for_each_site(F&& callback) const
+    {
+        for (int i = 0; i < site_count_; ++i) {
+            callback(sites_[i]);
+        }
+    }
+
+
+private:
+    struct Slab {
+        ScratchBufferPtr* self_ = nullptr;
+        char* cells_ = nullptr;
+        u64 used_ = 0;
+        s8 class_ = -1;
+    };
+
+
+    static constexpr u64 full_mask(int size_class)
+    {
+        return cells_per_slab(size_class) == 64
+                   ? ~u64(0)
+                   : (u64(1) << cells_per_slab(size_class)) - 1;
+    }
+
+
+    Slab& create_slab(Platform& pfrm, Slab& slab, int size_class)
+    {
+        static_assert(sizeof(ScratchBufferPtr) <= cell_align and
+                      alignof(ScratchBufferPtr) <= cell_align);
+
+        auto buffer = pfrm.make_scratch_buffer();
+
+        const auto addr = reinterpret_cast<uintptr_t>(buffer->data_);
+        char* const start = reinterpret_cast<char*>(
+            (addr + cell_align - 1) & ~uintptr_t(cell_align - 1));
+
+        slab.self_ = new (start) ScratchBufferPtr(buffer);
+        slab.cells_ = start + cell_align;
+        slab.used_ = 0;
+        slab.class_ = size_class;
+
+        classes_[size_class].slabs_.inc();
+
+        return slab;
+    }
+
+
+    Allocation take(Slab& slab, s8 site)
+    {
+        const u8 cell = __builtin_ctzll(~slab.used_);
+        slab.used_ |= u64(1) << cell;
+
+        classes_[slab.class_].cells_.inc();
+
+        const auto size = class_size(slab.class_);
+
+        return {*slab.self_,
+                slab.cells_ + cell * size,
+                size,
+                Handle(s8(&slab - slabs_.data()), cell, site)};
+    }
+
+
+    // NOTE: We key call sites by the tag's address, rather than comparing
+    // strings, to keep allocation cheap. Tags should be string literals. A
+    // literal repeated in two translation units may count as two separate
+    // sites, which is harmless.
+    s8 site(const char* tag)
+    {
+        for (int i = 0; i < site_count_; ++i) {
+            if (sites_[i].tag_ == tag) {
+                return i;
+            }
+        }
+
+        if (site_count_ == site_count) {
+            return -1;
+        }
+
+        sites_[site_count_].tag_ = tag;
+        return site_count_++;
+    }
+
+
+    std::array<Slab, slab_count> slabs_;
+    std::array<ClassStats, class_count> classes_;
+    std::array<SiteStats, site_count> sites_;
+    Counter buffers_;
+    s8 site_count_ = 0;
+};
+
+
+inline SizeClassArena size_class_arena;
+
+
+inline SizeClassArena::Handle&
+SizeClassArena::Handle::operator=(Handle&& other)
+{
+    if (engaged_) {
+        size_class_arena.release(slab_, cell_, site_);
+    }
+
+    slab_ = other.slab_;
+    cell_ = other.cell_;
+    site_ = other.site_;
+    engaged_ = other.engaged_;
+
+    other.engaged_ = false;
+
+    return *this;
+}
+
+
+inline SizeClassArena::Handle::~Handle()
+{
+    if (engaged_) {
+        size_class_arena.release(slab_, cell_, site_);
+    }
+}
@@ -1,8 +1,229 @@
 #include "blind_jump/game.hpp"
+#include "bulkAllocator.hpp"
 #include "globals.hpp"
+#include "localization.hpp"
+#include "number/random.hpp"
+#include "replay.hpp"
 #include "transformGroup.hpp"
 
 
+////////////////////////////////////////////////////////////////////////////////
+//
+// Replays
+//
+// Launch with the record option (see Platform::get_opt()) to record a session
+// to replays/<name>, and with the replay option to play one back. Playback
+// substitutes the recorded keys and deltas for the live ones, and reports how
+// long each frame's update and render took, so that replay files of expensive
+// scenes, e.g. boss fights, serve as performance regression tests. See
+// build/run_replays.py, which checks the replays in replays/ against their
+// frame time budgets.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+using KeyStates = Platform::Keyboard::RestoreState;
+
+
+static ReplayKeys replay_keys(const KeyStates& states)
+{
+    ReplayKeys result = 0;
+    for (u32 i = 0; i < states.size(); ++i) {
+        if (states[i]) {
+            result |= 1 << i;
+        }
+    }
+    return result;
+}
+
+
+static KeyStates key_states(ReplayKeys keys)
+{
+    KeyStates result;
+    for (u32 i = 0; i < result.size(); ++i) {
+        result.set(i, keys & (1 << i));
+    }
+    return result;
+}
+
+
+class ReplayRecorder {
+public:
+    ReplayRecorder(Platform& pf, const char* name, Game& game)
+        : pf_(pf), name_(name)
+    {
+        ReplayHeader header;
+        header.magic_.set(ReplayHeader::magic_val);
+        header.save_size_.set(sizeof(PersistentData));
+        header.critical_state_.set(rng::critical_state);
+        header.utility_state_.set(rng::utility_state);
+
+        ok_ = pf.write_file_contents(
+                  "replays", name, &header, sizeof header) and
+              pf.write_file_contents("replays",
+                                     name,
+                                     &game.persistent_data(),
+                                     sizeof(PersistentData),
+                                     true);
+
+        if (not ok_) {
+            error(pf, "failed to create replay file");
+        }
+    }
+
+    void record(ReplayKeys keys, Microseconds delta)
+    {
+        if (buffer_.size() + ReplayEncoder::max_frame_size >
+            buffer_.capacity()) {
+            flush();
+        }
+
+        u8 frame[ReplayEncoder::max_frame_size];
+        const auto length = encoder_.encode({keys, delta}, frame);
+
+        for (u32 i = 0; i < length; ++i) {
+            buffer_.push_back(frame[i]);
+        }
+    }
+
+    void finish()
+    {
+        buffer_.push_back(ReplayEncoder::end);
+        flush();
+    }
+
+private:
+    void flush()
+    {
+        if (ok_) {
+            ok_ = pf_.write_file_contents(
+                "replays", name_, buffer_.data(), buffer_.size(), true);
+        }
+        buffer_.clear();
+    }
+
+    Platform& pf_;
+    const char* name_;
+    bool ok_;
+    ReplayEncoder encoder_;
+    Buffer<u8, 512> buffer_;
+};
+
+
+struct ReplayPlayback {
+    ReplayPlayback(const u8* frames, const u8* end) : decoder_(frames, end)
+    {
+    }
+
+    PersistentData save_;
+    rng::LinearGenerator critical_state_;
+    rng::LinearGenerator utility_state_;
+
+    ReplayDecoder decoder_;
+    KeyStates prev_keys_;
+
+    // Playback saves the game as usual, e.g. when the player reaches the next
+    // level. We put back the player's own save data afterwards.
+    std::optional<PersistentData> save_backup_;
+
+    FrameTimeHistogram update_times_;
+    FrameTimeHistogram render_times_;
+};
+
+
+static std::optional<ReplayRecorder> replay_recorder;
+static std::optional<DynamicMemory<ReplayPlayback>> replay_playback;
+
+
+static void load_replay(Platform& pf, const char* name)
+{
+    u32 size = 0;
+    auto data = reinterpret_cast<const u8*>(
+        pf.load_file_contents("replays", name, &size));
+
+    if (not data) {
+        error(pf, "missing replay file");
+        return;
+    }
+
+    const auto end = data + size;
+
+    ReplayHeader header;
+    if (size < sizeof header) {
+        error(pf, "replay file truncated");
+        return;
+    }
+    memcpy(&header, data, sizeof header);
+
+    // The save data layout changes between versions of the game, and may
+    // differ between platforms.
+    if (header.magic_.get() not_eq ReplayHeader::magic_val or
+        header.save_size_.get() not_eq sizeof(PersistentData)) {
+        error(pf, "replay file does not match this build");
+        return;
+    }
+
+    data += sizeof header;
+
+    if (u32(end - data) < sizeof(PersistentData)) {
+        error(pf, "replay file truncated");
+        return;
+    }
+
+    auto playback = allocate_dynamic<ReplayPlayback>(
+        pf, "replay", data + sizeof(PersistentData), end);
+
+    memcpy(&playback->save_, data, sizeof(PersistentData));
+    playback->critical_state_ = header.critical_state_.get();
+    playback->utility_state_ = header.utility_state_.get();
+
+    PersistentData backup;
+    if (pf.read_save_data(&backup, sizeof backup, 0)) {
+        playback->save_backup_ = backup;
+    }
+
+    replay_playback = std::move(playback);
+}
+
+
+static void report_frame_times(Platform& pf,
+                               const char* label,
+                               const FrameTimeHistogram& times)
+{
+    StringBuffer<96> line = label;
+    line += " us: p50 ";
+    line += to_string<10>(times.percentile(50));
+    line += ", p99 ";
+    line += to_string<10>(times.percentile(99));
+    line += ", max ";
+    line += to_string<10>(times.max());
+    line += " (";
+    line += to_string<10>(times.count());
+    line += " frames)";
+
+    info(pf, line.c_str());
+    pf.remote_console().printline(line.c_str(), false);
+}
+
+
+static void finish_replay(Platform& pf)
+{
+    auto& playback = **replay_playback;
+
+    report_frame_times(pf, "update", playback.update_times_);
+    report_frame_times(pf, "render", playback.render_times_);
+
+    if (playback.save_backup_) {
+        pf.write_save_data(
+            &*playback.save_backup_, sizeof(PersistentData), 0);
+    }
+
+    replay_playback.reset();
+
+    pf.soft_exit();
+}
+
+
 class UpdateTask : public Platform::Task {
 public:
     UpdateTask(Synchronized<Game>* game, Platform* pf);
@@ -27,10 +248,39 @@ void UpdateTask::run()
         game_->acquire([this](Game& game) {
             pf_->keyboard().poll();
 
-            const auto delta = pf_->delta_clock().reset();
+            auto delta = pf_->delta_clock().reset();
+
+            if (UNLIKELY(static_cast<bool>(replay_playback))) {
+                auto& playback = **replay_playback;
+
+                auto frame = playback.decoder_.next();
+                if (not frame) {
+                    finish_replay(*pf_);
+                    return;
+                }
+
+                const auto keys = key_states(frame->keys_);
+                pf_->keyboard().override_state(playback.prev_keys_, keys);
+                playback.prev_keys_ = keys;
+
+                delta = frame->delta_;
+            }
+
+            if (UNLIKELY(static_cast<bool>(replay_recorder))) {
+                replay_recorder->record(
+                    replay_keys(pf_->keyboard().dump_state()), delta);
+            }
+
+            const auto start = pf_->delta_clock().sample();
 
             game.update(*pf_, delta);
 
+            if (UNLIKELY(static_cast<bool>(replay_playback))) {
+                (*replay_playback)
+                    ->update_times_.record(Platform::DeltaClock::duration(
+                        start, pf_->delta_clock().sample()));
+            }
+
             pf_->network_peer().update();
         });
     } else {
@@ -57,7 +307,19 @@ void blind_jump_main_loop(Platform& pf)
 
     globals().emplace<BlindJumpGlobalData>();
 
-    Synchronized<Game> game(pf, pf);
+    if (auto name = pf.get_opt('p')) {
+        load_replay(pf, name);
+    }
+
+    Synchronized<Game> game(
+        pf, pf, replay_playback ? &(*replay_playback)->save_ : nullptr);
+
+    if (replay_playback) {
+        rng::critical_state = (*replay_playback)->critical_state_;
+        rng::utility_state = (*replay_playback)->utility_state_;
+    } else if (auto name = pf.get_opt('r')) {
+        game.acquire([&](Game& gm) { replay_recorder.emplace(pf, name, gm); });
+    }
 
     UpdateTask update(&game, &pf);
     pf.push_task(&update);
@@ -67,9 +329,23 @@ void blind_jump_main_loop(Platform& pf)
         pf.feed_watchdog();
 
         pf.screen().clear();
-        game.acquire([&](Game& gm) { gm.render(pf); });
+        game.acquire([&](Game& gm) {
+            const auto start = pf.delta_clock().sample();
+
+            gm.render(pf);
+
+            if (UNLIKELY(static_cast<bool>(replay_playback))) {
+                (*replay_playback)
+                    ->render_times_.record(Platform::DeltaClock::duration(
+                        start, pf.delta_clock().sample()));
+            }
+        });
         pf.screen().display();
     }
+
+    if (replay_recorder) {
+        replay_recorder->finish();
+    }
 }
 
 
@@ -26,6 +26,12 @@ public:
 
     virtual StatePtr update(Platform& platform, Game& game, Microseconds delta);
 
+    // Called each frame before update(), in real time, so it keeps running
+    // while the game is frozen (see Game::freeze()). For things that shouldn't
+    // stall during hit-stop, like the network.
+    virtual void
+    realtime_update(Platform& platform, Game& game, Microseconds delta);
+
     State()
     {
     }
@@ -1,4 +1,5 @@
 #include "tileMap.hpp"
+#include "bulkAllocator.hpp"
 
 
 u16 TileMap::index(u16 x, u16 y) const
@@ -23,3 +24,85 @@ u8 TileMap::get_tile(s32 x, s32 y) const
     }
     return data_[TileMap::index(x, y)];
 }
+
+
+void cell_automata_advance(TileMap& map,
+                           TileMap& workspace,
+                           int death_limit,
+                           int birth_limit)
+{
+    map.for_each([&](const u8& tile, int x, int y) {
+        u8 count = 0;
+        auto collect = [&](int x, int y) {
+            if (map.get_tile(x, y) == Tile::none) {
+                count++;
+            }
+        };
+        collect(x - 1, y - 1);
+        collect(x + 1, y - 1);
+        collect(x - 1, y + 1);
+        collect(x + 1, y + 1);
+        collect(x - 1, y);
+        collect(x + 1, y);
+        collect(x, y - 1);
+        collect(x, y + 1);
+        if (tile == Tile::none) {
+            if (count < birth_limit) {
+                workspace.set_tile(x, y, Tile::plate);
+            } else {
+                workspace.set_tile(x, y, Tile::none);
+            }
+        } else {
+            if (count > death_limit) {
+                workspace.set_tile(x, y, Tile::none);
+            } else {
+                workspace.set_tile(x, y, Tile::plate);
+            }
+        }
+    });
+    workspace.for_each(
+        [&](const u8& tile, int x, int y) { map.set_tile(x, y, tile); });
+}
+
+
+u32 flood_fill(Platform& pfrm, TileMap& map, u8 replace, TIdx x, TIdx y)
+{
+    using Coord = Vec2<s8>;
+
+    ScratchBufferBulkAllocator mem(pfrm);
+
+    auto stack = mem.alloc<Buffer<Coord, TileMap::width * TileMap::height>>();
+
+    if (UNLIKELY(not stack)) {
+        pfrm.fatal("fatal error in floodfill");
+    }
+
+    const u8 target = map.get_tile(x, y);
+
+    u32 count = 0;
+
+    const auto action = [&](const Coord& c, TIdx x_off, TIdx y_off) {
+        const TIdx x = c.x + x_off;
+        const TIdx y = c.y + y_off;
+        if (x > 0 and x < TileMap::width and y > 0 and y < TileMap::height) {
+            if (map.get_tile(x, y) == target) {
+                map.set_tile(x, y, replace);
+                stack->push_back({x, y});
+                count += 1;
+            }
+        }
+    };
+
+    action({x, y}, 0, 0);
+
+    while (not stack->empty()) {
+        Coord c = stack->back();
+        stack->pop_back();
+        action(c, -1, 0);
+        action(c, 0, 1);
+        action(c, 0, -1);
+        action(c, 1, 0);
+    }
+
+    return count;
+}
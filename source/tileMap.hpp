@@ -31,16 +31,35 @@ struct Tile {
     };
 };
 
+// NOTE: The default map dimensions, sixteen by twenty, are the limits of the
+// GBA hardware: each map tile covers four by three 8x8 tiles, and the whole map
+// needs to fit within a single 64x64 tile background. Desktop builds may
+// configure larger maps (see the MAP_WIDTH and MAP_HEIGHT cmake options).
+#ifndef __BLINDJUMP_MAP_WIDTH
+#define __BLINDJUMP_MAP_WIDTH 16
+#endif
+
+#ifndef __BLINDJUMP_MAP_HEIGHT
+#define __BLINDJUMP_MAP_HEIGHT 20
+#endif
+
+
 class TileMap {
 public:
-    // NOTE: The tilemap constants here are sixteen and twenty, due to limits of
-    // the GBA hardware, but could be bumped up for Desktop releases.
-    static constexpr u16 width = 16;
-    static constexpr u16 height = 20;
+    static constexpr u16 width = __BLINDJUMP_MAP_WIDTH;
+    static constexpr u16 height = __BLINDJUMP_MAP_HEIGHT;
     static constexpr u16 tile_count{width * height};
 
     using Index = s8;
 
+    static_assert(width <= 127 and height <= 127,
+                  "Tile coordinates must fit within a TileMap::Index");
+
+#ifdef __GBA__
+    static_assert(width == 16 and height == 20,
+                  "The gba map layers cannot display larger maps");
+#endif
+
     TileMap()
     {
         TileMap::for_each([](u8& tile, int, int) { tile = Tile::none; });
@@ -83,6 +102,24 @@ private:
 using TIdx = TileMap::Index;
 
 
+class Platform;
+
+
+// One step of the cellular automaton that shapes randomly generated levels.
+// An empty tile fills in when fewer than birth_limit of its eight neighbors
+// are empty, and a filled tile empties when more than death_limit of its
+// neighbors are empty. Over a few steps, random noise coalesces into blobs.
+void cell_automata_advance(TileMap& map,
+                           TileMap& workspace,
+                           int death_limit,
+                           int birth_limit);
+
+
+// Replaces the tile at x, y, and every tile of the same kind connected to it,
+// with replace. Returns the number of tiles replaced.
+u32 flood_fill(Platform& pfrm, TileMap& map, u8 replace, TIdx x, TIdx y);
+
+
 template <typename Format = Float>
 inline Vec2<Format> to_world_coord(const Vec2<TIdx>& tc)
 {
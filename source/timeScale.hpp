@@ -0,0 +1,60 @@
+#pragma once
+
+#include "number/numeric.hpp"
+
+
+// Hit-stop and slow motion. Game::update() passes each frame's delta through
+// apply(), and runs the game simulation on the result, while input, audio,
+// rendering, and the network carry on in real time. Gameplay code used to
+// pause the game with Platform::sleep(), which stalled all of those things
+// too.
+class TimeScale {
+public:
+    // Holds the simulation still for duration. Freezes don't add up: a second
+    // freeze only extends the first one, so that a burst of hits, e.g. a few
+    // enemies dying at once, doesn't stall the game.
+    void freeze(Microseconds duration)
+    {
+        freeze_ = std::max(freeze_, duration);
+    }
+
+    // Runs the simulation at scale times normal speed, for the next duration
+    // of real time.
+    void dilate(Float scale, Microseconds duration)
+    {
+        scale_ = scale;
+        dilation_ = duration;
+    }
+
+    bool frozen() const
+    {
+        return freeze_ > 0;
+    }
+
+    // Returns the game time that passes during delta real time. Zero, while
+    // frozen.
+    Microseconds apply(Microseconds delta)
+    {
+        if (freeze_ > 0) {
+            if (delta <= freeze_) {
+                freeze_ -= delta;
+                return 0;
+            }
+            delta -= freeze_;
+            freeze_ = 0;
+        }
+
+        if (dilation_ > 0) {
+            const auto dilated = std::min(delta, dilation_);
+            dilation_ -= dilated;
+            return Microseconds(dilated * scale_) + (delta - dilated);
+        }
+
+        return delta;
+    }
+
+private:
+    Microseconds freeze_ = 0;
+    Microseconds dilation_ = 0;
+    Float scale_ = 1.f;
+};
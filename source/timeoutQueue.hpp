@@ -0,0 +1,200 @@
+#pragma once
+
+#include <optional>
+
+#include "memory/buffer.hpp"
+#include "memory/pool.hpp"
+#include "number/numeric.hpp"
+
+
+// Holds callbacks until a deadline. The queue keeps its own clock, and stores
+// each timeout as a binary min-heap entry keyed on an absolute deadline, so
+// advancing time costs nothing until a timeout actually expires: a frame with
+// no expired timeouts performs a single comparison, and each expired timeout
+// costs one heap pop.
+//
+// The callbacks themselves live in an object pool, so that the heap only
+// shuffles small entries around, rather than moving Function objects.
+template <typename Callback, u32 capacity> class TimeoutQueue {
+public:
+    struct Stats {
+        // The most timeouts ever pending at once.
+        u16 high_water_ = 0;
+
+        // The number of timeouts rejected because the queue was full.
+        u16 overflow_count_ = 0;
+    };
+
+
+    // Identifies a pending timeout, see cancel().
+    using Id = u32;
+
+
+    TimeoutQueue() = default;
+    TimeoutQueue(const TimeoutQueue&) = delete;
+
+
+    ~TimeoutQueue()
+    {
+        for (auto& entry : heap_) {
+            pool_.post(entry.callback_);
+        }
+    }
+
+
+    // Returns nothing if the queue is full.
+    std::optional<Id> push(Microseconds timeout, const Callback& callback)
+    {
+        auto cb = pool_.get(callback);
+        if (cb == nullptr) {
+            if (stats_.overflow_count_ < 65535) {
+                ++stats_.overflow_count_;
+            }
+            return {};
+        }
+
+        const Id id = seq_++;
+
+        heap_.push_back({clock_ + u32(timeout > 0 ? timeout : 0), id, cb});
+        sift_up(heap_.size() - 1);
+
+        if (heap_.size() > stats_.high_water_) {
+            stats_.high_water_ = heap_.size();
+        }
+
+        return id;
+    }
+
+
+    // Removes a timeout without running it. Returns false if the timeout
+    // already ran, or was cancelled. A linear search, but the queue is small,
+    // and cancellation is rare.
+    bool cancel(Id id)
+    {
+        for (u32 i = 0; i < heap_.size(); ++i) {
+            if (heap_[i].seq_ not_eq id) {
+                continue;
+            }
+
+            pool_.post(heap_[i].callback_);
+
+            heap_[i] = heap_.back();
+            heap_.pop_back();
+
+            // The entry that took the cancelled one's place may belong either
+            // above or below it.
+            if (i < heap_.size()) {
+                sift_down(i);
+                sift_up(i);
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+
+    // Advances the clock, and calls invoke for each expired timeout, in order
+    // of deadline. Callbacks may push new timeouts while we're invoking them;
+    // any that are already due run within the same call.
+    template <typename F> void update(Microseconds delta, F&& invoke)
+    {
+        clock_ += delta;
+
+        while (not heap_.empty() and expired(heap_[0])) {
+            auto cb = heap_[0].callback_;
+
+            heap_[0] = heap_.back();
+            heap_.pop_back();
+            if (not heap_.empty()) {
+                sift_down(0);
+            }
+
+            invoke(*cb);
+            pool_.post(cb);
+        }
+    }
+
+
+    u32 size() const
+    {
+        return heap_.size();
+    }
+
+
+    const Stats& stats() const
+    {
+        return stats_;
+    }
+
+
+private:
+    struct Entry {
+        // NOTE: Deadlines wrap around after ~71 minutes, which is fine, as we
+        // compare them as signed differences, and no timeout lasts anywhere
+        // near that long.
+        u32 deadline_;
+        u32 seq_;
+        Callback* callback_;
+    };
+
+
+    bool expired(const Entry& e) const
+    {
+        return s32(e.deadline_ - clock_) <= 0;
+    }
+
+
+    // Timeouts with the same deadline fire in the order that they were
+    // pushed.
+    static bool before(const Entry& lhs, const Entry& rhs)
+    {
+        const s32 diff = lhs.deadline_ - rhs.deadline_;
+        return diff < 0 or (diff == 0 and s32(lhs.seq_ - rhs.seq_) < 0);
+    }
+
+
+    void sift_up(u32 i)
+    {
+        while (i > 0) {
+            const u32 parent = (i - 1) / 2;
+            if (not before(heap_[i], heap_[parent])) {
+                break;
+            }
+            std::swap(heap_[i], heap_[parent]);
+            i = parent;
+        }
+    }
+
+
+    void sift_down(u32 i)
+    {
+        const u32 count = heap_.size();
+
+        while (true) {
+            const u32 left = 2 * i + 1;
+            const u32 right = left + 1;
+
+            u32 min = i;
+            if (left < count and before(heap_[left], heap_[min])) {
+                min = left;
+            }
+            if (right < count and before(heap_[right], heap_[min])) {
+                min = right;
+            }
+            if (min == i) {
+                break;
+            }
+            std::swap(heap_[i], heap_[min]);
+            i = min;
+        }
+    }
+
+
+    ObjectPool<Callback, capacity> pool_;
+    Buffer<Entry, capacity> heap_;
+    u32 clock_ = 0;
+    u32 seq_ = 0;
+    Stats stats_;
+};
@@ -0,0 +1,339 @@
+#include "platform/gba/gba_platform_soundcontext.hpp"
+#include "check.hpp"
+
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+
+// Host-side checks for the adpcm music decoder (see platform/adpcm.hpp), and
+// for music_fill(), which the gba's audio isrs use to play adpcm tracks.
+
+
+using Samples = std::vector<AudioSample>;
+
+
+struct Track {
+    std::vector<u32> words_;
+
+    // The samples that the encoder expects the track to decode to.
+    Samples decoded_;
+};
+
+
+// Lays out blocks the same way as build/encode_adpcm.py.
+static Track encode(const Samples& samples)
+{
+    Track result;
+    adpcm::State state;
+
+    for (u32 i = 0; i < samples.size(); i += 8) {
+        if (i % adpcm::block_samples == 0) {
+            result.words_.push_back(adpcm::make_header(state));
+        }
+        u32 word = 0;
+        for (u32 j = 0; j < 8; ++j) {
+            const auto sample = i + j < samples.size() ? samples[i + j] : 0;
+            word |= adpcm::encode(state, sample) << (j * 4);
+            result.decoded_.push_back(state.predictor_ >> 8);
+        }
+        result.words_.push_back(word);
+    }
+
+    return result;
+}
+
+
+static u32 test_rng = 7;
+
+
+static int test_random(int limit)
+{
+    test_rng = 1664525 * test_rng + 1013904223;
+    return (test_rng >> 8) % limit;
+}
+
+
+static AudioSample clamp_sample(double value)
+{
+    return std::lround(std::fmax(-128, std::fmin(127, value)));
+}
+
+
+static Samples sine(u32 length, double hz, double amplitude)
+{
+    Samples result(length);
+    for (u32 i = 0; i < length; ++i) {
+        const double t = double(i) / 16000;
+        result[i] = clamp_sample(amplitude * std::sin(2 * M_PI * hz * t));
+    }
+    return result;
+}
+
+
+// A few tones and a bit of noise, with an envelope, roughly like the game's
+// music.
+static Samples music_like(u32 length)
+{
+    Samples result(length);
+    for (u32 i = 0; i < length; ++i) {
+        const double t = double(i) / 16000;
+        const double envelope = 0.6 + 0.4 * std::sin(2 * M_PI * 0.5 * t);
+        const double tones = 30 * std::sin(2 * M_PI * 110 * t) +
+                             20 * std::sin(2 * M_PI * 330 * t) +
+                             12 * std::sin(2 * M_PI * 1250 * t);
+        result[i] = clamp_sample(envelope * tones + test_random(9) - 4);
+    }
+    return result;
+}
+
+
+static Samples noise(u32 length, int amplitude)
+{
+    Samples result(length);
+    for (auto& sample : result) {
+        sample = test_random(amplitude * 2 + 1) - amplitude;
+    }
+    return result;
+}
+
+
+static double snr(const Samples& original, const Samples& decoded)
+{
+    double signal = 0;
+    double error = 0;
+    for (u32 i = 0; i < original.size(); ++i) {
+        signal += double(original[i]) * original[i];
+        const double diff = original[i] - decoded[i];
+        error += diff * diff;
+    }
+    return 10 * std::log10(signal / error);
+}
+
+
+// What halving the size of the pcm tracks without adpcm would sound like:
+// keep the high four bits of each sample.
+static Samples four_bit_pcm(const Samples& samples)
+{
+    Samples result;
+    for (auto sample : samples) {
+        result.push_back((sample & ~0xf) | 8);
+    }
+    return result;
+}
+
+
+// Plays a track through music_fill(), as the gba's audio isr does, and checks
+// the output against the encoder, through a couple of loops of the track.
+static bool playback_test(const Samples& samples)
+{
+    const auto track = encode(samples);
+
+    SoundContext ctx;
+    ctx.music_track = track.words_.data();
+    ctx.music_track_length = track.words_.size();
+
+    const u32 length = track.decoded_.size();
+
+    for (u32 i = 0; i < length * 2 + 800; i += 8) {
+        AudioSample out[8];
+        music_fill(ctx, out);
+        for (u32 j = 0; j < 8; ++j) {
+            if (out[j] not_eq track.decoded_[(i + j) % length]) {
+                std::cout << "adpcm test failed: playback at " << i + j
+                          << " of " << length << std::endl;
+                return false;
+            }
+        }
+    }
+
+    // The four sample isrs.
+    ctx.music_track_pos = 0;
+    ctx.music_block_remaining = 0;
+    for (u32 i = 0; i < length + 400; i += 4) {
+        AudioSample out[4];
+        music_fill_half(ctx, out);
+        for (u32 j = 0; j < 4; ++j) {
+            if (out[j] not_eq track.decoded_[(i + j) % length]) {
+                std::cout << "adpcm test failed: half playback at " << i + j
+                          << std::endl;
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+// Tracks that are still eight bit pcm play back unchanged, four samples to a
+// word, and loop at the last whole pair of words.
+static bool pcm_playback_test()
+{
+    const auto samples = music_like(800);
+
+    std::vector<u32> words(samples.size() / 4);
+    __builtin_memcpy(words.data(), samples.data(), words.size() * 4);
+
+    SoundContext ctx;
+    ctx.music_track = words.data();
+    ctx.music_track_length = words.size();
+    ctx.music_adpcm = false;
+
+    for (u32 i = 0; i < samples.size() * 2 + 400; i += 4) {
+        alignas(4) AudioSample out[4];
+        music_fill_half(ctx, out);
+        for (u32 j = 0; j < 4; ++j) {
+            if (out[j] not_eq samples[(i + j) % samples.size()]) {
+                std::cout << "adpcm test failed: pcm playback at " << i + j
+                          << std::endl;
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+// Starting from any block header decodes the same samples as decoding from the
+// start of the track.
+static bool seek_test(const Samples& samples)
+{
+    const auto track = encode(samples);
+
+    bool ok = true;
+
+    const u32 stride = adpcm::block_words + 1;
+
+    for (u32 block = 0; block * stride < track.words_.size(); ++block) {
+        auto state = adpcm::read_header(track.words_[block * stride]);
+
+        const u32 end =
+            std::min<u32>(track.words_.size(), (block + 1) * stride);
+        for (u32 w = block * stride + 1; w < end; ++w) {
+            AudioSample out[8];
+            adpcm::decode_word(state, track.words_[w], out);
+
+            const u32 sample = (w - block - 1) * 8;
+            for (int j = 0; j < 8; ++j) {
+                ok &= out[j] == track.decoded_[sample + j];
+            }
+        }
+    }
+
+    return check("seek", ok);
+}
+
+
+bool adpcm_test()
+{
+    bool ok = true;
+
+    ok &= check("header", [] {
+        adpcm::State state{-1234, 88};
+        const auto read = adpcm::read_header(adpcm::make_header(state));
+        return read.predictor_ == -1234 and read.index_ == 88;
+    }());
+
+    // Zeroed words decode to silence, which is how the gba plays no music.
+    ok &= check("silence", [] {
+        adpcm::State state = adpcm::read_header(0);
+        for (int i = 0; i < 100; ++i) {
+            AudioSample out[8];
+            adpcm::decode_word(state, 0, out);
+            for (auto sample : out) {
+                if (sample not_eq 0) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }());
+
+    // The extremes of the sample range, where the predictor clamps.
+    Samples square;
+    for (int i = 0; i < 2000; ++i) {
+        square.push_back((i / 16) % 2 ? 127 : -128);
+    }
+    ok &= playback_test(square);
+
+    for (u32 length : {8u, 800u, 4096u, 4104u, 20000u}) {
+        ok &= playback_test(music_like(length));
+        ok &= seek_test(music_like(length));
+    }
+
+    ok &= pcm_playback_test();
+
+    const auto tone = sine(16000, 440, 100);
+    ok &= check("sine snr", snr(tone, encode(tone).decoded_) > 25);
+
+    if (ok) {
+        std::cout << "adpcm test passed!" << std::endl;
+    }
+
+    return ok;
+}
+
+
+// Reports decoder throughput, and the signal to noise ratio of a few signals
+// decoded from adpcm, measured against the original eight bit pcm, next to the
+// simplest way to fit the pcm in the same space.
+void adpcm_benchmark()
+{
+    using Clock = std::chrono::steady_clock;
+
+    const u32 length = 16000 * 30;
+
+    const auto track = encode(music_like(length));
+
+    SoundContext ctx;
+    ctx.music_track = track.words_.data();
+    ctx.music_track_length = track.words_.size();
+
+    static const int iters = 10;
+
+    s32 checksum = 0;
+
+    const auto start = Clock::now();
+
+    for (int i = 0; i < iters; ++i) {
+        for (u32 j = 0; j < length; j += 8) {
+            alignas(4) AudioSample out[8];
+            music_fill(ctx, out);
+            checksum += out[j & 7];
+        }
+    }
+
+    const auto stop = Clock::now();
+
+    const double seconds =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+            .count() /
+        1e9;
+
+    const double rate = double(length) * iters / seconds;
+
+    std::cout << "adpcm decode: " << u64(rate / 1e6) << " Msamples/s, "
+              << u64(rate / 16000) << "x realtime (" << checksum << ")"
+              << std::endl;
+
+    auto report = [](const char* name, const Samples& samples) {
+        const auto track = encode(samples);
+        std::cout << "adpcm snr (" << name
+                  << "): " << snr(samples, track.decoded_) << " dB, 4 bit pcm "
+                  << snr(samples, four_bit_pcm(samples)) << " dB, "
+                  << samples.size() << " -> " << track.words_.size() * 4
+                  << " bytes" << std::endl;
+    };
+
+    report("sine 440Hz", sine(length, 440, 100));
+    report("sine 440Hz quiet", sine(length, 440, 12));
+    // At four samples per cycle, the step size can't keep up with a loud tone,
+    // so adpcm comes out a couple of dB behind 4 bit pcm here.
+    report("sine 4kHz", sine(length, 4000, 100));
+    report("music-like", music_like(length));
+    report("noise", noise(length, 40));
+}
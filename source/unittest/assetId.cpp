@@ -0,0 +1,63 @@
+#include "assetId.hpp"
+
+
+#include <iostream>
+#include <string>
+
+
+struct TestAsset {
+    const char* name_;
+    int value_;
+};
+
+
+static constexpr TestAsset test_assets[] = {
+    {"explosion1", 0}, {"explosion2", 1}, {"typewriter", 2}, {"footstep1", 3},
+    {"footstep2", 4},  {"footstep3", 5},  {"footstep4", 6},  {"open_book", 7},
+    {"dropitem", 8},   {"openbag", 9},    {"blaster", 10},   {"tw_bell", 11},
+    {"select", 12},    {"laser1", 13},    {"scroll", 14},    {"creak", 15},
+    {"dodge", 16},     {"heart", 17},     {"click", 18},     {"thud", 19},
+    {"coin", 20},      {"bell", 21},      {"pop", 22},       {"msg", 23}};
+
+
+static constexpr auto test_index = make_asset_index(test_assets);
+
+
+// The index resolves literals at compile time.
+static_assert(find_asset(test_assets, test_index, "laser1"_asset)->value_ ==
+              13);
+
+
+bool asset_id_test()
+{
+    for (auto& asset : test_assets) {
+        // Build the name at runtime, as a script would.
+        const std::string name = asset.name_;
+
+        auto found = find_asset(test_assets, test_index, name.c_str());
+        if (found not_eq &asset) {
+            std::cout << "asset index failed to find " << name << std::endl;
+            return false;
+        }
+
+        const std::string missing = name + "_";
+        if (find_asset(test_assets, test_index, missing.c_str())) {
+            std::cout << "asset index found missing asset " << missing
+                      << std::endl;
+            return false;
+        }
+    }
+
+    static constexpr const char* files[][2] = {{"scripts", "init.lisp"},
+                                               {"strings", "english.txt"}};
+
+    if (asset_path_hash(files[0][0], files[0][1]) not_eq
+        asset_hash("scripts/init.lisp")) {
+        std::cout << "asset path hash mismatch" << std::endl;
+        return false;
+    }
+
+    std::cout << "asset id test passed!" << std::endl;
+
+    return true;
+}
@@ -0,0 +1,203 @@
+#include "platform/desktop/assetPack.hpp"
+#include "check.hpp"
+
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+
+// Host-side checks for the desktop asset archive (see assetPack.hpp). We write
+// a few made up assets to a pack, map it the way the platform does, and read
+// the assets back. Then we damage the pack in a few ways, and check that the
+// platform refuses to map it.
+
+
+using Kind = asset_pack::Kind;
+
+
+static asset_pack::Item
+make_item(Kind kind, u32 hash, std::vector<u8> data, u32 w = 0, u32 h = 0)
+{
+    asset_pack::Item item{};
+    item.entry_.kind_ = kind;
+    item.entry_.hash_ = hash;
+    item.entry_.width_ = w;
+    item.entry_.height_ = h;
+    item.data_ = std::move(data);
+    return item;
+}
+
+
+static std::vector<asset_pack::Item> test_items()
+{
+    static const char script[] = "(print 'hello)";
+
+    std::vector<u8> pixels(4 * 3 * 4);
+    for (u32 i = 0; i < pixels.size(); ++i) {
+        pixels[i] = i;
+    }
+
+    std::vector<asset_pack::Item> items;
+    items.push_back(make_item(Kind::sound,
+                              asset_hash("laser1"),
+                              {0x01, 0x80, 0x7f, 0xff, 0x00}));
+    items.push_back(make_item(Kind::file,
+                              asset_path_hash("scripts", "test.lisp"),
+                              {script, script + sizeof script}));
+    items.push_back(make_item(Kind::image, asset_hash("tile0"), pixels, 4, 3));
+    items.push_back(make_item(Kind::sound, asset_hash("click"), {}));
+
+    return items;
+}
+
+
+static std::string pack_path()
+{
+    return (std::filesystem::temp_directory_path() / "bj_test_assets.pack")
+        .string();
+}
+
+
+static bool write_file(const std::vector<u8>& data)
+{
+    std::ofstream out(pack_path(), std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(data.data()), data.size());
+    return bool(out);
+}
+
+
+static bool round_trip_test(const std::vector<u8>& archive)
+{
+    bool ok = check("wrote pack", write_file(archive));
+
+    AssetPack pack;
+    ok &= check("opened", pack.open(pack_path()));
+
+    const auto expected = test_items();
+
+    for (auto& item : expected) {
+        auto entry = pack.find(item.entry_.kind_, item.entry_.hash_);
+        ok &= check("found", entry not_eq nullptr);
+        if (not entry) {
+            continue;
+        }
+        ok &= check("size", entry->size_ == item.data_.size());
+        ok &= check("aligned", entry->offset_ % 16 == 0);
+        ok &= check("contents",
+                    item.data_.empty() or
+                        std::memcmp(pack.data(*entry),
+                                    item.data_.data(),
+                                    item.data_.size()) == 0);
+    }
+
+    auto image = pack.image("tile0");
+    ok &= check("image dimensions",
+                image and image->width_ == 4 and image->height_ == 3);
+
+    auto script = pack.file("scripts", "test.lisp");
+    ok &= check("file", script and std::string(script) == "(print 'hello)");
+
+    ok &= check("missing", not pack.sound("explosion1") and
+                               not pack.file("scripts", "init.lisp") and
+                               not pack.find(Kind::image, asset_hash("click")));
+
+    return ok;
+}
+
+
+// Each of these would otherwise hand out pointers past the end of the mapping.
+static bool corrupt_test(const std::vector<u8>& archive)
+{
+    auto entry_at = [](std::vector<u8>& data, u32 index) {
+        return reinterpret_cast<asset_pack::Entry*>(
+            data.data() + sizeof(asset_pack::Header) +
+            index * sizeof(asset_pack::Entry));
+    };
+
+    auto opens = [](const std::vector<u8>& data) {
+        AssetPack pack;
+        return write_file(data) and pack.open(pack_path());
+    };
+
+    bool ok = true;
+
+    {
+        // Entries sort by kind, so the file comes first, then the image.
+        auto data = archive;
+        data.resize(entry_at(data, 1)->offset_ + 2);
+        ok &= check("truncated", not opens(data));
+    }
+
+    {
+        auto data = archive;
+        entry_at(data, 0)->offset_ = data.size() + 16;
+        entry_at(data, 0)->size_ = 0;
+        ok &= check("offset past end", not opens(data));
+    }
+
+    {
+        auto data = archive;
+        entry_at(data, 1)->size_ = ~u64(0) - 8;
+        ok &= check("size overflows", not opens(data));
+    }
+
+    {
+        auto data = archive;
+        entry_at(data, 1)->height_ = 0x40000001;
+        ok &= check("image too big", not opens(data));
+    }
+
+    {
+        auto data = archive;
+        auto file = entry_at(data, 0);
+        data[file->offset_ + file->size_ - 1] = '!';
+        ok &= check("unterminated file", not opens(data));
+    }
+
+    {
+        auto data = archive;
+        u32 count = 1000;
+        std::memcpy(data.data() + 8, &count, sizeof count);
+        ok &= check("entry table past end", not opens(data));
+    }
+
+    {
+        auto data = archive;
+        data[0] = 0;
+        ok &= check("magic", not opens(data));
+    }
+
+    ok &= check("still opens", opens(archive));
+
+    return ok;
+}
+
+
+bool asset_pack_test()
+{
+    std::string error;
+    const auto archive = asset_pack::write(test_items(), error);
+
+    bool ok = check("write", not archive.empty() and error.empty());
+
+    auto duplicate = test_items();
+    duplicate.push_back(duplicate.front());
+    ok &= check("collision",
+                asset_pack::write(duplicate, error).empty() and
+                    not error.empty());
+
+    if (ok) {
+        ok &= round_trip_test(archive);
+        ok &= corrupt_test(archive);
+    }
+
+    std::filesystem::remove(pack_path());
+
+    if (ok) {
+        std::cout << "asset pack test passed!" << std::endl;
+    }
+
+    return ok;
+}
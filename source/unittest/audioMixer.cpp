@@ -0,0 +1,366 @@
+#include "platform/gba/gba_platform_soundcontext.hpp"
+
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+
+// The gba's stereo mixing interrupt handler (see
+// audio_update_spatialized_stereo_isr() in gba_platform.cpp), minus the
+// hardware registers. Each call produces four frames. We check that the
+// portable AudioMixer produces the same samples.
+namespace reference {
+
+
+void audio_update_isr(SoundContext& snd_ctx, AudioSample* l, AudioSample* r)
+{
+    alignas(4) AudioSample mixing_buffer_l[4];
+    alignas(4) AudioSample mixing_buffer_r[4];
+
+    music_fill_half(snd_ctx, mixing_buffer_l);
+
+    *((u32*)mixing_buffer_r) = *((u32*)mixing_buffer_l);
+
+    for (auto it = snd_ctx.active_sounds.begin();
+         it not_eq snd_ctx.active_sounds.end();) {
+        if (it->position_ + 4 >= it->length_) {
+            it = snd_ctx.active_sounds.erase(it);
+        } else {
+            for (int i = 0; i < 4; ++i) {
+                mixing_buffer_r[i] +=
+                    (*it->r_volume_lut_)[(u8)it->data_[it->position_]];
+                mixing_buffer_l[i] +=
+                    (*it->l_volume_lut_)[(u8)it->data_[it->position_]];
+                ++it->position_;
+            }
+            ++it;
+        }
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        l[i] = mixing_buffer_l[i];
+        r[i] = mixing_buffer_r[i];
+    }
+}
+
+
+} // namespace reference
+
+
+static u32 test_rng = 3;
+
+
+static u32 test_random()
+{
+    test_rng = 1664525 * test_rng + 1013904223;
+    return test_rng >> 16;
+}
+
+
+static std::vector<AudioSample> random_sound(u32 length)
+{
+    std::vector<AudioSample> result(length);
+    for (auto& sample : result) {
+        sample = test_random();
+    }
+    return result;
+}
+
+
+static bool kernel_test()
+{
+    // Every possible sample value, plus an odd-sized random tail, so that the
+    // simd kernels also run their scalar cleanup loop.
+    std::vector<AudioSample> input;
+    for (int i = 0; i < 256; ++i) {
+        input.push_back(i);
+    }
+    for (auto sample : random_sound(1000 + 13)) {
+        input.push_back(sample);
+    }
+
+    for (int level = 0; level < volume_levels; ++level) {
+        std::vector<s16> expected(input.size(), 7);
+        std::vector<s16> result(input.size(), 7);
+
+        for (u32 i = 0; i < input.size(); ++i) {
+            expected[i] += volume_scale_LUTs[level][(u8)input[i]];
+        }
+
+        mix_scaled_scalar(result.data(), input.data(), input.size(), level);
+        if (result not_eq expected) {
+            std::cout << "scalar kernel mismatch at level " << level
+                      << std::endl;
+            return false;
+        }
+
+#ifdef AUDIO_MIXER_SIMD
+        std::fill(result.begin(), result.end(), 7);
+        mix_scaled_simd(result.data(), input.data(), input.size(), level);
+        if (result not_eq expected) {
+            std::cout << AUDIO_MIXER_SIMD << " kernel mismatch at level "
+                      << level << std::endl;
+            return false;
+        }
+#endif
+    }
+
+    return true;
+}
+
+
+template <AudioMixKernel kernel> static bool mixer_test(const char* name)
+{
+    static const int sound_count = 6;
+    static const u32 music_length = 10000;
+
+    std::vector<AudioSample> sounds[sound_count];
+    for (auto& sound : sounds) {
+        sound = random_sound(200 + test_random() % 3000);
+    }
+
+    // The gba plays an adpcm track, which we encode from random samples. The
+    // portable mixer gets the samples that the encoder expects the track to
+    // decode to.
+    static std::vector<u32> track;
+    static AudioSample music[music_length];
+    if (track.empty()) {
+        adpcm::State state;
+        for (u32 i = 0; i < music_length; i += 8) {
+            if (i % adpcm::block_samples == 0) {
+                track.push_back(adpcm::make_header(state));
+            }
+            u32 word = 0;
+            for (u32 j = 0; j < 8; ++j) {
+                word |= adpcm::encode(state, test_random()) << (j * 4);
+                music[i + j] = state.predictor_ >> 8;
+            }
+            track.push_back(word);
+        }
+    }
+
+    SoundContext snd_ctx;
+    snd_ctx.music_track = track.data();
+    snd_ctx.music_track_length = track.size();
+
+    AudioMixer<3, kernel> mixer;
+    mixer.play_music(music, music_length);
+
+    static const u32 block_sizes[] = {4, 8, 64, 128, 36};
+
+    u32 frame = 0;
+
+    for (int step = 0; step < 2000; ++step) {
+        // Start a couple of sounds now and then, with random priorities, so
+        // that voices get stolen.
+        if (test_random() % 4 == 0) {
+            auto& sound = sounds[test_random() % sound_count];
+
+            const auto levels = stereo_levels(Float(test_random() % 101) / 100,
+                                              Float(test_random() % 201) / 100 -
+                                                  1);
+
+            ActiveSoundInfo info{0,
+                                 s32(sound.size()),
+                                 sound.data(),
+                                 s32(test_random() % 4),
+                                 &volume_scale_LUTs[levels.left_],
+                                 &volume_scale_LUTs[levels.right_]};
+
+            const bool reference_played =
+                add_voice(snd_ctx.active_sounds, info);
+
+            const bool played = mixer.play(
+                sound.data(), sound.size(), info.priority_, levels);
+
+            if (reference_played not_eq played) {
+                std::cout << name << " mixer voice mismatch at frame " << frame
+                          << std::endl;
+                return false;
+            }
+        }
+
+        const u32 count = block_sizes[step % 5];
+
+        s16 left[128];
+        s16 right[128];
+        mixer.mix(left, right, count);
+
+        for (u32 i = 0; i < count; i += 4) {
+            AudioSample l[4];
+            AudioSample r[4];
+            reference::audio_update_isr(snd_ctx, l, r);
+
+            for (int j = 0; j < 4; ++j) {
+                if (AudioSample(left[i + j]) not_eq l[j] or
+                    AudioSample(right[i + j]) not_eq r[j]) {
+                    std::cout << name << " mixer mismatch at frame "
+                              << frame + i + j << std::endl;
+                    return false;
+                }
+            }
+        }
+
+        frame += count;
+    }
+
+    return true;
+}
+
+
+static bool ring_test()
+{
+    AudioRing<256> ring;
+
+    u32 next_write = 0;
+    u32 next_read = 0;
+    bool filled = false;
+
+    // Writes and reads of different sizes, so that the indices wrap around the
+    // ring, and the ring fills up now and then.
+    for (int round = 0; round < 100; ++round) {
+        AudioFrame frames[100];
+        for (int i = 0; i < 100; ++i) {
+            frames[i] = {s16(next_write + i), s16(-(next_write + i))};
+        }
+        const u32 written = ring.write(frames, 100);
+        filled |= written < 100;
+        next_write += written;
+
+        AudioFrame out[70];
+        const u32 count = ring.read(out, 70);
+        for (u32 i = 0; i < count; ++i) {
+            if (out[i].left_ not_eq s16(next_read + i) or
+                out[i].right_ not_eq s16(-(next_read + i))) {
+                std::cout << "audio ring mismatch" << std::endl;
+                return false;
+            }
+        }
+        next_read += count;
+
+        if (ring.size() not_eq next_write - next_read) {
+            std::cout << "audio ring size mismatch" << std::endl;
+            return false;
+        }
+    }
+
+    if (not filled) {
+        std::cout << "audio ring never filled up" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+// A sound too short to fill a chunk doesn't take a voice, rather than reading
+// past the end of its samples.
+static bool short_sound_test()
+{
+    AudioMixer<4> mixer;
+
+    const AudioSample sound[4] = {10, 20, 30, 40};
+
+    bool ok = not mixer.play(sound, 0, 1) and not mixer.play(sound, 3, 1);
+    ok &= mixer.play(sound, 4, 1);
+
+    s16 left[8];
+    s16 right[8];
+    mixer.mix(left, right, 8);
+
+    ok &= mixer.active_voices() == 0;
+
+    if (not ok) {
+        std::cout << "audio mixer short sound mismatch" << std::endl;
+    }
+
+    return ok;
+}
+
+
+bool audio_mixer_test()
+{
+    bool ok = true;
+
+    ok &= kernel_test();
+    ok &= mixer_test<mix_scaled_scalar>("scalar");
+    ok &= mixer_test<mix_scaled>("default");
+    ok &= ring_test();
+    ok &= short_sound_test();
+
+    if (ok) {
+        std::cout << "audio mixer test passed!" << std::endl;
+    }
+
+    return ok;
+}
+
+
+// Reports mixed frames per second, with 4, 16, and 64 voices playing, for the
+// scalar and simd kernels.
+template <u32 voices, AudioMixKernel kernel>
+static void audio_mixer_benchmark(const char* name)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static const u32 sound_length = 1 << 16;
+    static const u32 block = 256;
+    static const int iters = 2000;
+
+    static std::vector<AudioSample> sound;
+    if (sound.empty()) {
+        sound = random_sound(sound_length);
+    }
+
+    AudioMixer<voices, kernel> mixer;
+
+    s16 left[block];
+    s16 right[block];
+
+    s64 checksum = 0;
+    u64 frames = 0;
+
+    const auto start = Clock::now();
+
+    for (int i = 0; i < iters; ++i) {
+        // Restart any sounds that finished.
+        while (mixer.active_voices() < voices) {
+            const auto v = mixer.active_voices();
+            mixer.play(sound.data() + v * 61,
+                       sound_length - v * 61,
+                       0,
+                       {u8(v % volume_levels), u8((v * 7) % volume_levels)});
+        }
+
+        mixer.mix(left, right, block);
+        checksum += left[i % block] + right[(i * 3) % block];
+        frames += block;
+    }
+
+    const auto stop = Clock::now();
+
+    const double seconds =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+            .count() /
+        1e9;
+
+    std::cout << "audio mixer (" << name << ", " << voices
+              << " voices): " << u64(frames / seconds) << " frames/s, "
+              << u64(frames * voices / seconds) << " voice samples/s ("
+              << checksum << ")" << std::endl;
+}
+
+
+void audio_mixer_benchmark()
+{
+    audio_mixer_benchmark<4, mix_scaled_scalar>("scalar");
+    audio_mixer_benchmark<16, mix_scaled_scalar>("scalar");
+    audio_mixer_benchmark<64, mix_scaled_scalar>("scalar");
+
+#ifdef AUDIO_MIXER_SIMD
+    audio_mixer_benchmark<4, mix_scaled_simd>(AUDIO_MIXER_SIMD);
+    audio_mixer_benchmark<16, mix_scaled_simd>(AUDIO_MIXER_SIMD);
+    audio_mixer_benchmark<64, mix_scaled_simd>(AUDIO_MIXER_SIMD);
+#endif
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstring>
+#include <iostream>
+
+
+// Prints the location of a check that failed, and returns the condition, so
+// that tests can accumulate results, with ok &= check(...).
+inline bool check(const char* what,
+                  bool condition,
+                  const char* file = __builtin_FILE(),
+                  int line = __builtin_LINE())
+{
+    if (not condition) {
+        const char* name = std::strrchr(file, '/');
+        std::cout << (name ? name + 1 : file) << ":" << line
+                  << ": check failed: " << what << std::endl;
+    }
+    return condition;
+}
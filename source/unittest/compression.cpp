@@ -0,0 +1,262 @@
+#include "compression.hpp"
+
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+
+// Host-side checks for the image decompressor (see compression.hpp). The
+// encoders below are simple greedy versions of the ones in
+// build/compress_image.py, enough to produce valid streams to decode.
+
+
+using Bytes = std::vector<u8>;
+
+
+static void put_header(Bytes& out, compression::Format format, u32 size)
+{
+    out.push_back(static_cast<u8>(format));
+    out.push_back(size & 0xff);
+    out.push_back((size >> 8) & 0xff);
+    out.push_back((size >> 16) & 0xff);
+}
+
+
+static Bytes lz77_compress(const Bytes& data, u32 min_disp)
+{
+    Bytes out;
+    put_header(out, compression::Format::lz77, data.size());
+
+    u32 pos = 0;
+    while (pos < data.size()) {
+        const auto flag_index = out.size();
+        out.push_back(0);
+
+        for (int bit = 0; bit < 8 and pos < data.size(); ++bit) {
+            u32 best_len = 0;
+            u32 best_disp = 0;
+
+            for (u32 disp = min_disp; disp <= 4096 and disp <= pos; ++disp) {
+                u32 len = 0;
+                while (len < 18 and pos + len < data.size() and
+                       data[pos + len - disp] == data[pos + len]) {
+                    ++len;
+                }
+                if (len > best_len) {
+                    best_len = len;
+                    best_disp = disp;
+                    if (len == 18) {
+                        break;
+                    }
+                }
+            }
+
+            if (best_len >= 3) {
+                out[flag_index] |= 0x80 >> bit;
+                const u32 d = best_disp - 1;
+                out.push_back(((best_len - 3) << 4) | (d >> 8));
+                out.push_back(d & 0xff);
+                pos += best_len;
+            } else {
+                out.push_back(data[pos++]);
+            }
+        }
+    }
+
+    return out;
+}
+
+
+static Bytes rle_compress(const Bytes& data)
+{
+    Bytes out;
+    put_header(out, compression::Format::rle, data.size());
+
+    u32 pos = 0;
+    while (pos < data.size()) {
+        u32 run = 1;
+        while (pos + run < data.size() and run < 130 and
+               data[pos + run] == data[pos]) {
+            ++run;
+        }
+
+        if (run >= 3) {
+            out.push_back(0x80 | (run - 3));
+            out.push_back(data[pos]);
+            pos += run;
+        } else {
+            u32 count = 0;
+            while (pos + count < data.size() and count < 128) {
+                const auto p = pos + count;
+                if (p + 2 < data.size() and data[p] == data[p + 1] and
+                    data[p] == data[p + 2]) {
+                    break;
+                }
+                ++count;
+            }
+            out.push_back(count - 1);
+            out.insert(out.end(), &data[pos], &data[pos] + count);
+            pos += count;
+        }
+    }
+
+    return out;
+}
+
+
+static u32 test_rng = 5;
+
+
+static u8 test_random(u32 limit)
+{
+    test_rng = 1664525 * test_rng + 1013904223;
+    return (test_rng >> 8) % limit;
+}
+
+
+// Something like 4bpp tile data: runs of a few colors, with repeated tiles.
+static Bytes tile_like_data(u32 size)
+{
+    Bytes result;
+    while (result.size() < size) {
+        if (result.size() > 64 and test_random(3) == 0) {
+            const u32 from = result.size() - 32 * (1 + test_random(2));
+            for (u32 i = 0; i < 32 and result.size() < size; ++i) {
+                result.push_back(result[from + i]);
+            }
+        } else {
+            const u8 color = test_random(4) * 0x11;
+            const u32 run = 1 + test_random(12);
+            for (u32 i = 0; i < run and result.size() < size; ++i) {
+                result.push_back(color);
+            }
+        }
+    }
+    return result;
+}
+
+
+static Bytes random_data(u32 size)
+{
+    Bytes result(size);
+    for (auto& b : result) {
+        b = test_random(256);
+    }
+    return result;
+}
+
+
+static bool round_trip(const char* what, const Bytes& data, const Bytes& packed)
+{
+    if (compression::decompressed_size(packed.data()) not_eq data.size()) {
+        std::cout << "compression test failed: " << what << " size"
+                  << std::endl;
+        return false;
+    }
+
+    // Fill with a sentinel, to catch writes past the end, and so that we can
+    // check that an odd length output preserves the last halfword's high
+    // byte.
+    std::vector<u16> out(data.size() / 2 + 2, 0xa5a5);
+
+    if (not compression::decompress(packed.data(), out.data())) {
+        std::cout << "compression test failed: " << what << " format"
+                  << std::endl;
+        return false;
+    }
+
+    const auto bytes = reinterpret_cast<const u8*>(out.data());
+
+    if (memcmp(bytes, data.data(), data.size()) not_eq 0 or
+        bytes[data.size()] not_eq 0xa5 or
+        out[(data.size() + 1) / 2] not_eq 0xa5a5) {
+        std::cout << "compression test failed: " << what << " ("
+                  << data.size() << " bytes)" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+bool compression_test()
+{
+    bool ok = true;
+
+    for (u32 size : {0u, 1u, 2u, 3u, 17u, 18u, 19u, 255u, 1000u, 4097u}) {
+        for (auto& data : {tile_like_data(size), random_data(size)}) {
+            ok &= round_trip("lz77", data, lz77_compress(data, 2));
+            ok &= round_trip("lz77 overlap", data, lz77_compress(data, 1));
+            ok &= round_trip("rle", data, rle_compress(data));
+        }
+    }
+
+    // Runs longer than one rle record, and an lz77 copy from the byte just
+    // written.
+    const Bytes runs(1000, 0x77);
+    ok &= round_trip("rle runs", runs, rle_compress(runs));
+    ok &= round_trip("lz77 runs", runs, lz77_compress(runs, 1));
+
+    const Bytes unknown{0x40, 1, 0, 0, 0};
+    u16 out[2];
+    ok &= not compression::decompress(unknown.data(), out);
+
+    if (ok) {
+        std::cout << "compression test passed!" << std::endl;
+    }
+
+    return ok;
+}
+
+
+// Reports decompression throughput for tile-like data the size of a tileset,
+// next to a plain copy.
+void compression_benchmark()
+{
+    using Clock = std::chrono::steady_clock;
+
+    static const u32 size = 14208;
+    static const int iters = 2000;
+
+    const auto data = tile_like_data(size);
+
+    const Bytes lz = lz77_compress(data, 2);
+    const Bytes rle = rle_compress(data);
+
+    std::vector<u16> out(size / 2 + 1);
+
+    auto bench = [&](const char* name, const Bytes* packed) {
+        const auto start = Clock::now();
+
+        for (int i = 0; i < iters; ++i) {
+            if (packed) {
+                compression::decompress(packed->data(), out.data());
+            } else {
+                memcpy(out.data(), data.data(), size);
+            }
+            // Keep the compiler from dropping the loop.
+            asm volatile("" : : "r"(out.data()) : "memory");
+        }
+
+        const auto stop = Clock::now();
+
+        const double seconds =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+                .count() /
+            1e9;
+
+        std::cout << "decompress (" << name << "): "
+                  << u64(double(size) * iters / seconds / (1 << 20))
+                  << " MB/s";
+        if (packed) {
+            std::cout << ", " << size << " -> " << packed->size() << " bytes";
+        }
+        std::cout << std::endl;
+    };
+
+    bench("lz77", &lz);
+    bench("rle", &rle);
+    bench("memcpy", nullptr);
+}
@@ -0,0 +1,472 @@
+#include "blind_jump/highscoreSync.hpp"
+#include "platform/loopbackLink.hpp"
+#include "check.hpp"
+
+
+#include <arpa/inet.h>
+#include <chrono>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+
+// Host-side checks for DataStreams (see dataStream.hpp): two Platforms,
+// whose NetworkPeers talk over a LoopbackLink, stream buffers to each other.
+// The benchmark also runs the peers over a localhost tcp connection, the way
+// that the desktop NetworkPeer talks to another game.
+
+
+static const Microseconds frame = 16667;
+
+
+static LoopbackLink loopback;
+static Platform* host_platform;
+
+
+// Connected sockets for each side, when the peers talk over tcp instead.
+static int tcp_sockets[LoopbackLink::side_count] = {-1, -1};
+
+
+static bool tcp()
+{
+    return tcp_sockets[LoopbackLink::host] not_eq -1;
+}
+
+
+static LoopbackLink::Side side(const Platform::NetworkPeer* peer)
+{
+    return peer == &host_platform->network_peer() ? LoopbackLink::host
+                                                  : LoopbackLink::guest;
+}
+
+
+// The parts of the NetworkPeer interface that DataStreams uses, routed over the
+// loopback link.
+
+
+bool Platform::NetworkPeer::is_connected() const
+{
+    return tcp() or loopback.is_connected();
+}
+
+
+bool Platform::NetworkPeer::is_host() const
+{
+    return side(this) == LoopbackLink::host;
+}
+
+
+Platform::NetworkPeer::Interface Platform::NetworkPeer::interface() const
+{
+    return tcp() ? internet : serial_cable;
+}
+
+
+bool Platform::NetworkPeer::send_message(const Message& message)
+{
+    if (tcp()) {
+        return ::send(tcp_sockets[side(this)],
+                      message.data_,
+                      message.length_,
+                      0) == ssize_t(message.length_);
+    }
+    return loopback.send(side(this), message);
+}
+
+
+// NOTE: Other tests define their own Sessions, hence the namespace.
+namespace {
+
+
+struct Sink : DataStreams::Sink {
+    std::vector<byte> data_;
+    u16 completed_ = 0;
+    bool reject_ = false;
+
+    byte* accept(u16 stream_id, u32 length) override
+    {
+        if (reject_) {
+            return nullptr;
+        }
+        data_.assign(length, byte(0));
+        return data_.data();
+    }
+
+    void complete(u16 stream_id) override
+    {
+        completed_ = stream_id;
+    }
+};
+
+
+struct Endpoint {
+    Platform pfrm_;
+    DataStreams streams_;
+    std::vector<byte> tcp_received_;
+
+
+    // Like net_event::poll_messages(), but we only care about streams.
+    void receive()
+    {
+        const auto s = side(&pfrm_.network_peer());
+
+        if (tcp()) {
+            receive_tcp(s);
+            return;
+        }
+
+        loopback.compact(s);
+
+        while (auto msg = loopback.poll_message(s)) {
+            if (msg->length_ < LoopbackLink::frame_size) {
+                break;
+            }
+
+            dispatch(msg->data_);
+
+            loopback.poll_consume(s, LoopbackLink::frame_size);
+        }
+    }
+
+
+    // Reads whatever has arrived, like the desktop NetworkPeer::update().
+    void receive_tcp(LoopbackLink::Side s)
+    {
+        byte buffer[1024];
+        ssize_t received;
+        while ((received = recv(
+                    tcp_sockets[s], buffer, sizeof buffer, MSG_DONTWAIT)) >
+               0) {
+            tcp_received_.insert(
+                tcp_received_.end(), buffer, buffer + received);
+        }
+
+        u32 pos = 0;
+        while (pos + LoopbackLink::frame_size <= tcp_received_.size()) {
+            dispatch(tcp_received_.data() + pos);
+            pos += LoopbackLink::frame_size;
+        }
+        tcp_received_.erase(tcp_received_.begin(),
+                            tcp_received_.begin() + pos);
+    }
+
+
+    void dispatch(const byte* data)
+    {
+        net_event::Header header;
+        __builtin_memcpy(&header, data, sizeof header);
+
+        switch (header.message_type_) {
+#define HANDLE_MESSAGE(MESSAGE_TYPE)                                           \
+    case net_event::MESSAGE_TYPE::mt: {                                        \
+        net_event::MESSAGE_TYPE m;                                             \
+        __builtin_memcpy(&m, data, sizeof m);                                  \
+        streams_.receive(pfrm_, m);                                            \
+        break;                                                                 \
+    }
+            HANDLE_MESSAGE(DataStreamAvail)
+            HANDLE_MESSAGE(DataStreamReadRequest)
+            HANDLE_MESSAGE(DataStreamReadResponse)
+            HANDLE_MESSAGE(DataStreamDoneReading)
+#undef HANDLE_MESSAGE
+
+        default:
+            break;
+        }
+    }
+};
+
+
+struct Session {
+    Endpoint host_;
+    Endpoint guest_;
+
+    Session(const LoopbackLink::Config& config)
+    {
+        loopback.configure(config);
+        loopback.attach(LoopbackLink::host);
+        loopback.attach(LoopbackLink::guest);
+        host_platform = &host_.pfrm_;
+    }
+};
+
+
+} // namespace
+
+
+// Runs both endpoints until the sender finishes, or we give up. Returns the
+// number of frames that the transfer took.
+static int run(Endpoint& sender, Endpoint& receiver, int max_frames)
+{
+    for (int i = 0; i < max_frames; ++i) {
+        sender.streams_.update(sender.pfrm_, frame);
+        receiver.streams_.update(receiver.pfrm_, frame);
+
+        loopback.update(frame);
+
+        sender.receive();
+        receiver.receive();
+
+        if (not sender.streams_.sending()) {
+            return i + 1;
+        }
+    }
+    return max_frames;
+}
+
+
+static std::vector<byte> make_data(u32 length)
+{
+    std::vector<byte> data(length);
+    for (u32 i = 0; i < length; ++i) {
+        data[i] = byte(i * 7 + i / 256);
+    }
+    return data;
+}
+
+
+// A few kilobytes, over a clean link, then a link that drops messages.
+static bool round_trip_test()
+{
+    bool ok = true;
+
+    for (int drop_percent : {0, 20}) {
+        LoopbackLink::Config config;
+        config.latency_ = milliseconds(30);
+        config.jitter_ = milliseconds(10);
+        config.drop_percent_ = drop_percent;
+        config.seed_ = 7;
+
+        Session session(config);
+
+        Sink sink;
+        session.guest_.streams_.set_sink(&sink);
+
+        const auto data = make_data(3000);
+        ok &= check("send", session.host_.streams_.send(5, data.data(), 3000));
+        ok &= check("one at a time",
+                    not session.host_.streams_.send(6, data.data(), 3000));
+
+        const auto frames = run(session.host_, session.guest_, 60 * 120);
+
+        ok &= check("finished", not session.host_.streams_.sending());
+        ok &= check("completed", sink.completed_ == 5);
+        ok &= check("contents", sink.data_ == data);
+        ok &= check("receiver idle", not session.guest_.streams_.receiving());
+
+        if (drop_percent == 0) {
+            // Three hundred chunks, at forty messages per second, plus some
+            // requests. No more than about ten seconds.
+            ok &= check("throughput", frames < 60 * 10);
+        }
+    }
+
+    return ok;
+}
+
+
+static bool rejected_test()
+{
+    Session session({});
+
+    Sink sink;
+    sink.reject_ = true;
+    session.guest_.streams_.set_sink(&sink);
+
+    const auto data = make_data(100);
+    session.host_.streams_.send(1, data.data(), 100);
+
+    run(session.host_, session.guest_, 120);
+
+    bool ok = check("rejected", not session.guest_.streams_.receiving() and
+                                    session.host_.streams_.sending());
+
+    // The sender announces the stream again, so the receiver may change its
+    // mind.
+    sink.reject_ = false;
+    run(session.host_, session.guest_, 60 * 10);
+
+    ok &= check("accepted later", sink.completed_ == 1 and sink.data_ == data);
+
+    return ok;
+}
+
+
+static bool highscore_test()
+{
+    Session session({});
+
+    PersistentData::HighScores host_scores;
+    PersistentData::HighScores guest_scores;
+    for (int i = 0; i < 8; ++i) {
+        host_scores[i].set(1000 - i * 100);
+        guest_scores[i].set(i < 4 ? 950 - i * 200 : 0);
+    }
+
+    HighscoreSync host_sync(host_scores);
+    HighscoreSync guest_sync(guest_scores);
+    session.host_.streams_.set_sink(&host_sync);
+    session.guest_.streams_.set_sink(&guest_sync);
+
+    bool ok = check("nothing received", not host_sync.peer_highscores());
+
+    host_sync.send(session.host_.streams_);
+    guest_sync.send(session.guest_.streams_);
+
+    for (int i = 0; i < 60 * 10; ++i) {
+        run(session.host_, session.guest_, 1);
+        if (not session.host_.streams_.sending() and
+            not session.guest_.streams_.sending()) {
+            break;
+        }
+    }
+
+    auto host_peer = host_sync.peer_highscores();
+    auto guest_peer = guest_sync.peer_highscores();
+
+    ok &= check("received", host_peer and guest_peer);
+    if (not ok) {
+        return false;
+    }
+
+    // Each side sees the other's table, and keeps its own.
+    for (int i = 0; i < 8; ++i) {
+        const Score host = 1000 - i * 100;
+        const Score guest = i < 4 ? 950 - i * 200 : 0;
+        ok &= check("host table", host_scores[i].get() == host);
+        ok &= check("guest table", guest_scores[i].get() == guest);
+        ok &= check("host's peer", (*host_peer)[i].get() == guest);
+        ok &= check("guest's peer", (*guest_peer)[i].get() == host);
+    }
+
+    return ok;
+}
+
+
+bool data_stream_test()
+{
+    bool ok = true;
+
+    ok &= round_trip_test();
+    ok &= rejected_test();
+    ok &= highscore_test();
+
+    if (ok) {
+        std::cout << "data stream test passed!" << std::endl;
+    }
+
+    return ok;
+}
+
+
+// Connects the two sides over localhost, with Nagle's algorithm off, as sfml
+// does for the desktop NetworkPeer.
+static bool tcp_connect()
+{
+    const int listener = socket(AF_INET, SOCK_STREAM, 0);
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    socklen_t len = sizeof addr;
+
+    if (listener < 0 or bind(listener, (sockaddr*)&addr, sizeof addr) or
+        ::listen(listener, 1) or
+        getsockname(listener, (sockaddr*)&addr, &len)) {
+        close(listener);
+        return false;
+    }
+
+    const int guest = socket(AF_INET, SOCK_STREAM, 0);
+    if (::connect(guest, (sockaddr*)&addr, sizeof addr)) {
+        close(guest);
+        close(listener);
+        return false;
+    }
+
+    const int host = accept(listener, nullptr, nullptr);
+    close(listener);
+
+    if (host < 0) {
+        close(guest);
+        return false;
+    }
+
+    const int on = 1;
+    setsockopt(host, IPPROTO_TCP, TCP_NODELAY, &on, sizeof on);
+    setsockopt(guest, IPPROTO_TCP, TCP_NODELAY, &on, sizeof on);
+
+    tcp_sockets[LoopbackLink::host] = host;
+    tcp_sockets[LoopbackLink::guest] = guest;
+
+    return true;
+}
+
+
+static void tcp_disconnect()
+{
+    for (auto& fd : tcp_sockets) {
+        close(fd);
+        fd = -1;
+    }
+}
+
+
+// Streams a buffer one way, and reports throughput in game time, which the
+// per-frame message budget limits, and the cpu time spent per kilobyte, in
+// the stream layer and the transport.
+void data_stream_benchmark()
+{
+    using Clock = std::chrono::steady_clock;
+
+    static const u32 length = 16 * 1024;
+
+    const auto data = make_data(length);
+
+    auto transfer = [&](const char* name, const LoopbackLink::Config& config) {
+        Session session(config);
+
+        Sink sink;
+        session.guest_.streams_.set_sink(&sink);
+        session.host_.streams_.send(1, data.data(), length);
+
+        const auto start = Clock::now();
+        const auto frames = run(session.host_, session.guest_, 60 * 600);
+        const auto stop = Clock::now();
+
+        const double us =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+                .count() /
+            1000.0;
+
+        const double game_seconds = frames * double(frame) / 1e6;
+
+        std::cout << "data stream (" << name << "): " << length
+                  << " bytes in " << frames << " frames, "
+                  << u32(length / game_seconds) << " bytes/s, " << us / 16
+                  << " us cpu per KB"
+                  << (sink.data_ == data ? "" : ", CORRUPT") << std::endl;
+    };
+
+    transfer("serial loopback", {});
+
+    LoopbackLink::Config lossy;
+    lossy.latency_ = milliseconds(30);
+    lossy.jitter_ = milliseconds(10);
+    lossy.drop_percent_ = 10;
+    lossy.seed_ = 7;
+    transfer("serial loopback, 10% loss", lossy);
+
+    if (tcp_connect()) {
+        transfer("tcp localhost", {});
+        tcp_disconnect();
+    } else {
+        std::cout << "data stream (tcp localhost): failed to connect"
+                  << std::endl;
+    }
+}
@@ -0,0 +1,228 @@
+#include "number/fixed.hpp"
+#include "number/numeric.hpp"
+
+
+#include <cmath>
+#include <iostream>
+
+
+// Host-side checks for the fixed-point Float (see fixed.hpp). We build the
+// tests with Float defined as a float, and instantiate Fixed explicitly, so
+// that we can compare the two side by side.
+
+
+using Fx = Fixed<16, 16>;
+
+
+static const double fx_epsilon = 1.0 / Fx::one;
+
+
+static u32 test_rng = 42;
+
+
+static double test_random(double low, double high)
+{
+    test_rng = 1664525 * test_rng + 1013904223;
+    return low + (high - low) * ((test_rng >> 8) / double(1 << 24));
+}
+
+
+static bool check(const char* what, double error, double bound)
+{
+    if (error > bound) {
+        std::cout << what << " failed! error " << error << " exceeds "
+                  << bound << std::endl;
+        return false;
+    }
+    return true;
+}
+
+
+static bool arithmetic_test()
+{
+    bool ok = true;
+
+    for (int i = 0; i < 10000 and ok; ++i) {
+        const double a = test_random(-150, 150);
+        const double b = test_random(-150, 150);
+
+        const Fx fa = a;
+        const Fx fb = b;
+
+        // Each operand carries up to half an epsilon of rounding error.
+        ok &= check("add", std::abs(double(fa + fb) - (a + b)), fx_epsilon);
+        ok &= check("sub", std::abs(double(fa - fb) - (a - b)), fx_epsilon);
+        ok &= check("mul",
+                    std::abs(double(fa * fb) - a * b),
+                    fx_epsilon * (1 + std::abs(a) + std::abs(b)));
+
+        if (std::abs(b) > 1) {
+            ok &= check("div",
+                        std::abs(double(fa / fb) - a / b),
+                        fx_epsilon * (1 + std::abs(a / b)));
+        }
+
+        const int n = int(test_random(-100, 100));
+        ok &= check("mul int", std::abs(double(fa * n) - double(fa) * n), 0);
+    }
+
+    ok &= check("int conversion", std::abs(int(Fx(-2.75f)) - -2), 0);
+    ok &= check("int conversion", std::abs(int(Fx(2.75f)) - 2), 0);
+
+    if (ok) {
+        std::cout << "fixed arithmetic test passed!" << std::endl;
+    }
+
+    return ok;
+}
+
+
+static bool sqrt_test()
+{
+    bool ok = true;
+
+    double float_error = 0;
+
+    for (int i = 0; i < 10000 and ok; ++i) {
+        const double x = test_random(0, 32000);
+
+        const double expected = std::sqrt(double(Fx(x)));
+
+        ok &= check("sqrt", std::abs(double(sqrt_approx(Fx(x))) - expected),
+                    fx_epsilon);
+
+        const double approx = sqrt_approx(float(x));
+        float_error =
+            std::max(float_error, std::abs(approx - expected) / expected);
+    }
+
+    for (int i = 0; i < 10000 and ok; ++i) {
+        // Well beyond 181 pixels, where squaring a coordinate would overflow.
+        const double x = test_random(-600, 600);
+        const double y = test_random(-600, 600);
+
+        const double expected = std::hypot(double(Fx(x)), double(Fx(y)));
+
+        ok &= check("hypot",
+                    std::abs(double(hypot_approx(Fx(x), Fx(y))) - expected),
+                    fx_epsilon);
+    }
+
+    if (ok) {
+        std::cout << "fixed sqrt test passed! (for reference, float "
+                  << "sqrt_approx relative error: " << float_error << ")"
+                  << std::endl;
+    }
+
+    return ok;
+}
+
+
+// A stripped down version of the game's movement code: an entity that chases a
+// target around the map, with speeds in pixels per microsecond, a friction
+// term applied with interpolate(), and frame times that vary, as they would on
+// real hardware.
+template <typename F> struct Chaser {
+    Vec2<F> position_{F(100), F(100)};
+    Vec2<F> target_{F(300), F(200)};
+    F speed_ = 0;
+
+    void update(Microseconds dt, int frame)
+    {
+        const auto angle = s16(frame * 300);
+        target_.x = F(320) + F(cosine(angle)) / 128;
+        target_.y = F(240) + F(sine(angle)) / 128;
+
+        if (frame % 60 == 0) {
+            speed_ = F(1.5f);
+        }
+        speed_ = interpolate(F(0), speed_, 0.000000175f * dt);
+
+        const auto vec = target_ - position_;
+        const auto mag = hypot_approx(vec.x, vec.y);
+
+        if (mag > F(1)) {
+            const auto dir = vec / mag;
+            position_ = position_ + dir * (speed_ * 0.000054f * dt);
+        }
+    }
+};
+
+
+static Microseconds test_frame_time(int frame)
+{
+    return 16667 + ((frame * 7919) % 2001) - 1000;
+}
+
+
+static bool simulation_test()
+{
+    static const int frames = 60 * 60;
+
+    Chaser<float> reference;
+    Chaser<Fx> fixed;
+    Chaser<Fx> replay;
+
+    double max_error = 0;
+    double reference_travel = 0;
+    double fixed_travel = 0;
+
+    for (int frame = 0; frame < frames; ++frame) {
+        const auto dt = test_frame_time(frame);
+
+        const auto ref_prev = reference.position_;
+        const auto fx_prev = fixed.position_;
+
+        reference.update(dt, frame);
+        fixed.update(dt, frame);
+        replay.update(dt, frame);
+
+        reference_travel +=
+            double(hypot_approx(reference.position_.x - ref_prev.x,
+                                reference.position_.y - ref_prev.y));
+        fixed_travel += double(hypot_approx(fixed.position_.x - fx_prev.x,
+                                            fixed.position_.y - fx_prev.y));
+
+        const auto& ref = reference.position_;
+        const double dx = double(fixed.position_.x) - double(ref.x);
+        const double dy = double(fixed.position_.y) - double(ref.y);
+        max_error = std::max(max_error, std::hypot(dx, dy));
+
+        if (fixed.position_.x.raw() not_eq replay.position_.x.raw() or
+            fixed.position_.y.raw() not_eq replay.position_.y.raw()) {
+            std::cout << "fixed simulation is not deterministic!" << std::endl;
+            return false;
+        }
+    }
+
+    // Speeds in pixels per microsecond sit near the bottom of the 16.16
+    // range, so the fixed build's entities move at a slightly different
+    // speed. Bound the drift, so that we notice if it gets worse.
+    const double speed_error =
+        std::abs(fixed_travel - reference_travel) / reference_travel;
+
+    std::cout << "fixed simulation: max position error " << max_error
+              << "px, speed error " << speed_error * 100 << "%" << std::endl;
+
+    bool ok = true;
+    ok &= check("simulation speed", speed_error, 0.05);
+    ok &= check("simulation position", max_error, 8);
+
+    if (ok) {
+        std::cout << "fixed simulation test passed!" << std::endl;
+    }
+
+    return ok;
+}
+
+
+bool fixed_test()
+{
+    bool ok = true;
+
+    ok &= arithmetic_test();
+    ok &= sqrt_test();
+    ok &= simulation_test();
+
+    return ok;
+}
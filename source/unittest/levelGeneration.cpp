@@ -0,0 +1,124 @@
+#include "number/random.hpp"
+#include "path.hpp"
+#include "wallCollision.hpp"
+
+
+#include <chrono>
+#include <iostream>
+
+
+// Level generation, and the map screen's pathfinder, both scale with the map
+// area. The build configures the map size (see MAP_WIDTH and MAP_HEIGHT), so
+// to compare map areas, run the benchmarks from a few differently configured
+// builds.
+
+
+// The same steps as Game::seed_map() and Game::regenerate_map(), minus entity
+// placement, with the cellular automaton settings from init.lisp.
+static bool generate(Platform& pfrm,
+                     TileMap& tiles,
+                     TileMap& workspace,
+                     WallField& field,
+                     rng::LinearGenerator& rng)
+{
+    tiles.for_each([&](u8& t, int, int) {
+        t = rng::choice<int(Tile::sand)>(rng);
+    });
+
+    for (int i = 0; i < 2; ++i) {
+        cell_automata_advance(tiles, workspace, 4, 5);
+    }
+
+    tiles.for_each([&](u8& tile, int x, int y) {
+        if (x == 0 or x == TileMap::width - 1 or y == 0 or
+            y == TileMap::height - 1) {
+            tile = Tile::none;
+        }
+        workspace.set_tile(x, y, tile ? 1 : 0);
+    });
+
+    for (int tries = 0; tries < 1000; ++tries) {
+        const auto x = rng::choice(TileMap::width, rng);
+        const auto y = rng::choice(TileMap::height, rng);
+        if (workspace.get_tile(x, y)) {
+            flood_fill(pfrm, workspace, 2, x, y);
+            workspace.for_each([&](u8 t, TIdx x, TIdx y) {
+                if (t not_eq 2) {
+                    tiles.set_tile(x, y, Tile::none);
+                }
+            });
+
+            field.build(tiles);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+void level_generation_benchmark()
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto us = [](auto d) {
+        return double(
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(d)
+                       .count()) /
+               1000;
+    };
+
+    Platform pfrm;
+    rng::LinearGenerator rng = 3;
+
+    TileMap tiles;
+    TileMap workspace;
+    WallField field;
+
+    static const int levels = 1000;
+
+    int generated = 0;
+
+    const auto gen_start = Clock::now();
+    for (int i = 0; i < levels; ++i) {
+        generated += generate(pfrm, tiles, workspace, field, rng);
+    }
+    const auto gen_stop = Clock::now();
+
+    // The map screen runs eight pathfinder iterations per frame, from the
+    // player to the exit. Find a path between the two floor tiles furthest
+    // apart in scan order.
+    std::optional<PathCoord> start;
+    PathCoord end;
+    tiles.for_each([&](u8 t, TIdx x, TIdx y) {
+        if (t) {
+            if (not start) {
+                start = PathCoord{u8(x), u8(y)};
+            }
+            end = PathCoord{u8(x), u8(y)};
+        }
+    });
+
+    int frames = 0;
+    Clock::duration path_time{};
+
+    if (start) {
+        IncrementalPathfinder pathfinder(pfrm, tiles, *start, end);
+
+        bool incomplete = true;
+        while (incomplete) {
+            const auto frame_start = Clock::now();
+            pathfinder.compute(pfrm, 8, &incomplete);
+            path_time += Clock::now() - frame_start;
+            ++frames;
+        }
+    }
+
+    std::cout << "level generation " << TileMap::width << "x"
+              << TileMap::height << " (" << TileMap::tile_count
+              << " tiles): " << us(gen_stop - gen_start) / levels
+              << " us per level (" << levels - generated << " empty), "
+              << "pathfinder " << (frames ? us(path_time) / frames : 0)
+              << " us per frame, for " << frames << " frames" << std::endl;
+}
@@ -0,0 +1,244 @@
+#include "platform/loopbackLink.hpp"
+#include "check.hpp"
+
+
+#include <iostream>
+#include <limits>
+
+
+// Host-side checks for the simulated serial link (see loopbackLink.hpp). Two
+// peers exchange numbered, timestamped messages over the link, and we check
+// what arrives on the other side.
+
+
+using Link = LoopbackLink;
+
+
+static const Microseconds frame = 16667;
+
+
+struct Peer {
+    Link::Side side_;
+
+    u32 sent_ = 0;
+    u32 received_ = 0;
+    u32 last_received_ = 0;
+    bool in_order_ = true;
+
+    Microseconds min_latency_ = std::numeric_limits<Microseconds>::max();
+    Microseconds max_latency_ = 0;
+
+
+    void send(Link& link, Microseconds now)
+    {
+        byte data[Link::frame_size] = {};
+        data[0] = byte(0xaa); // Messages of all zeroes may go missing.
+        ++sent_;
+        __builtin_memcpy(data + 1, &sent_, sizeof sent_);
+        __builtin_memcpy(data + 5, &now, sizeof now);
+
+        link.send(side_, {data, sizeof data});
+    }
+
+
+    // Polls the way that the desktop NetworkPeer::update() does.
+    void receive(Link& link, Microseconds now)
+    {
+        link.compact(side_);
+
+        while (auto msg = link.poll_message(side_)) {
+            if (msg->length_ < Link::frame_size) {
+                break;
+            }
+
+            u32 seq;
+            Microseconds sent;
+            __builtin_memcpy(&seq, msg->data_ + 1, sizeof seq);
+            __builtin_memcpy(&sent, msg->data_ + 5, sizeof sent);
+
+            if (seq <= last_received_) {
+                in_order_ = false;
+            }
+            last_received_ = seq;
+            ++received_;
+
+            min_latency_ = std::min(min_latency_, now - sent);
+            max_latency_ = std::max(max_latency_, now - sent);
+
+            link.poll_consume(side_, Link::frame_size);
+        }
+    }
+};
+
+
+struct Session {
+    Link link_;
+    Peer peers_[Link::side_count] = {{Link::host}, {Link::guest}};
+    Microseconds now_ = 0;
+
+
+    Session(const Link::Config& config) : link_(config)
+    {
+        link_.attach(Link::host);
+        link_.attach(Link::guest);
+    }
+
+
+    // Runs the link for some number of frames, with each peer sending
+    // messages_per_frame messages each frame, then a second of silence, so
+    // that everything in flight arrives.
+    void run(int frames, int messages_per_frame)
+    {
+        for (int i = 0; i < frames + 60; ++i) {
+            for (auto& peer : peers_) {
+                for (int j = 0; i < frames and j < messages_per_frame; ++j) {
+                    peer.send(link_, now_);
+                }
+            }
+
+            link_.update(frame);
+            now_ += frame;
+
+            for (auto& peer : peers_) {
+                peer.receive(link_, now_);
+            }
+        }
+    }
+
+
+    // Messages that one peer sent, as seen by the other.
+    const Peer& receiver(Link::Side sender) const
+    {
+        return peers_[sender == Link::host ? Link::guest : Link::host];
+    }
+};
+
+
+// A perfect link delivers everything, in order, within a frame or so.
+static bool clean_link_test()
+{
+    Session session({});
+    session.run(600, 1);
+
+    bool ok = true;
+
+    for (auto side : {Link::host, Link::guest}) {
+        const auto& rx = session.receiver(side);
+        const auto stats = session.link_.stats(side);
+
+        ok &= check("clean delivery", rx.received_ == 600);
+        ok &= check("clean order", rx.in_order_);
+        ok &= check("clean latency", rx.max_latency_ <= 2 * frame);
+        ok &= check("clean stats",
+                    stats.transmit_count_ == 600 and
+                        stats.transmit_loss_ == 0 and
+                        stats.receive_loss_ == 0);
+    }
+
+    return ok;
+}
+
+
+// Latency, jitter, and loss: every message either arrives, in order, no
+// sooner than the latency allows, or counts as lost.
+static bool lossy_link_test()
+{
+    Link::Config config;
+    config.latency_ = milliseconds(40);
+    config.jitter_ = milliseconds(15);
+    config.drop_percent_ = 20;
+    config.seed_ = 42;
+
+    Session session(config);
+    session.run(3000, 1);
+
+    bool ok = true;
+
+    for (auto side : {Link::host, Link::guest}) {
+        const auto& tx = session.peers_[side];
+        const auto& rx = session.receiver(side);
+        const auto stats = session.link_.stats(
+            side == Link::host ? Link::guest : Link::host);
+
+        ok &= check("lossy accounting",
+                    rx.received_ + stats.receive_loss_ == tx.sent_);
+        ok &= check("lossy drop rate",
+                    stats.receive_loss_ > 500 and stats.receive_loss_ < 700);
+        ok &= check("lossy order", rx.in_order_);
+        ok &= check("lossy min latency",
+                    rx.min_latency_ >=
+                        config.latency_ - config.message_interval_);
+        ok &= check("lossy max latency",
+                    rx.max_latency_ <=
+                        config.latency_ + config.jitter_ + 3 * frame);
+    }
+
+    return ok;
+}
+
+
+// Sending faster than the link's bandwidth overflows the transmit ring, which
+// drops the oldest messages, and saturates the link.
+static bool saturated_link_test()
+{
+    Session session({});
+    session.run(300, 3);
+
+    bool ok = true;
+
+    for (auto side : {Link::host, Link::guest}) {
+        const auto& tx = session.peers_[side];
+        const auto& rx = session.receiver(side);
+        const auto stats = session.link_.stats(side);
+
+        ok &= check("saturated loss", stats.transmit_loss_ > 0);
+        ok &= check("saturated accounting",
+                    rx.received_ + stats.transmit_loss_ == tx.sent_);
+        ok &= check("saturated order", rx.in_order_);
+
+        // Roughly one message every six serial transfers.
+        const Microseconds elapsed = (300 + 60) * frame;
+        const auto capacity =
+            elapsed / session.link_.config().message_interval_;
+        ok &= check("saturated bandwidth",
+                    rx.received_ <= u32(capacity) and
+                        rx.received_ > u32(capacity * 3 / 4));
+    }
+
+    return ok;
+}
+
+
+static bool detached_test()
+{
+    Link link;
+    link.attach(Link::host);
+
+    byte data[Link::frame_size] = {byte(0xaa)};
+
+    bool ok = check("detached send", not link.send(Link::host, {data, 12}));
+
+    link.attach(Link::guest);
+    ok &= check("attached send", link.send(Link::host, {data, 12}));
+    ok &= check("oversized send",
+                not link.send(Link::host, {data, Link::frame_size + 1}));
+
+    return ok;
+}
+
+
+bool loopback_link_test()
+{
+    bool ok = true;
+
+    ok &= clean_link_test();
+    ok &= lossy_link_test();
+    ok &= saturated_link_test();
+    ok &= detached_test();
+
+    if (ok) {
+        std::cout << "loopback link test passed!" << std::endl;
+    }
+
+    return ok;
+}
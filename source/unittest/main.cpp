@@ -0,0 +1,67 @@
+#include <iostream>
+#include <string>
+
+
+bool fixed_test();
+bool wall_collision_test();
+bool size_class_arena_test();
+bool audio_mixer_test();
+bool asset_id_test();
+bool asset_pack_test();
+bool replay_test();
+bool palette_cache_test();
+bool compression_test();
+bool adpcm_test();
+bool sprite_budget_test();
+bool time_scale_test();
+bool loopback_link_test();
+bool data_stream_test();
+bool timeout_queue_test();
+void wall_collision_benchmark();
+void level_generation_benchmark();
+void audio_mixer_benchmark();
+void palette_cache_benchmark();
+void compression_benchmark();
+void adpcm_benchmark();
+void sprite_budget_benchmark();
+void data_stream_benchmark();
+
+
+// Pass --benchmark to run the benchmarks after the tests.
+int main(int argc, char** argv)
+{
+    bool ok = true;
+
+    ok &= fixed_test();
+    ok &= wall_collision_test();
+    ok &= size_class_arena_test();
+    ok &= audio_mixer_test();
+    ok &= asset_id_test();
+    ok &= asset_pack_test();
+    ok &= replay_test();
+    ok &= palette_cache_test();
+    ok &= compression_test();
+    ok &= adpcm_test();
+    ok &= sprite_budget_test();
+    ok &= time_scale_test();
+    ok &= loopback_link_test();
+    ok &= data_stream_test();
+    ok &= timeout_queue_test();
+
+    if (argc > 1 and std::string(argv[1]) == "--benchmark") {
+        wall_collision_benchmark();
+        level_generation_benchmark();
+        audio_mixer_benchmark();
+        palette_cache_benchmark();
+        compression_benchmark();
+        adpcm_benchmark();
+        sprite_budget_benchmark();
+        data_stream_benchmark();
+    }
+
+    if (not ok) {
+        std::cout << "some tests failed!" << std::endl;
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,335 @@
+#include "graphics/paletteCache.hpp"
+#include "check.hpp"
+
+
+#include <chrono>
+#include <iostream>
+#include <set>
+
+
+// Host-side checks for the sprite palette cache (see paletteCache.hpp), with
+// the same bank range as the gba.
+
+
+using TestCache = PaletteCache<3, 16>;
+
+
+static ColorConstant test_color(int i)
+{
+    return custom_color(0x101010 * (i + 1));
+}
+
+
+static bool reuse_test()
+{
+    TestCache cache;
+
+    bool ok = true;
+
+    const auto first = cache.acquire(ColorConstant::spanish_crimson, 200);
+    ok &= check("first mix fills", first.bank_ >= 3 and first.fill_);
+
+    const auto again = cache.acquire(ColorConstant::spanish_crimson, 200);
+    ok &= check("hit", again.bank_ == first.bank_ and not again.fill_);
+
+    const auto other = cache.acquire(ColorConstant::spanish_crimson, 201);
+    ok &= check("amount distinguishes mixes",
+                other.fill_ and other.bank_ not_eq first.bank_);
+
+    // Mixes stay cached across frames.
+    for (int i = 0; i < 10; ++i) {
+        cache.next_frame();
+    }
+    const auto later = cache.acquire(ColorConstant::spanish_crimson, 200);
+    ok &= check("hit after frames",
+                later.bank_ == first.bank_ and not later.fill_);
+
+    cache.invalidate();
+    const auto refill = cache.acquire(ColorConstant::spanish_crimson, 200);
+    ok &= check("invalidate", refill.fill_);
+
+    return ok;
+}
+
+
+static bool exhaustion_test()
+{
+    TestCache cache;
+
+    bool ok = true;
+
+    // Fill every bank in one frame.
+    std::set<int> banks;
+    int mix_banks[TestCache::bank_count];
+    for (int i = 0; i < TestCache::bank_count; ++i) {
+        const auto r = cache.acquire(test_color(i), 128);
+        ok &= check("fill", r.fill_ and r.bank_ >= 3 and r.bank_ < 16);
+        banks.insert(r.bank_);
+        mix_banks[i] = r.bank_;
+    }
+    ok &= check("distinct banks", banks.size() == TestCache::bank_count);
+
+    const auto full = cache.acquire(test_color(100), 128);
+    ok &= check("no bank while all are in use", full.bank_ == 0);
+
+    // The next frame uses all but two of the mixes. A new mix must not take
+    // one of the banks used this frame.
+    cache.next_frame();
+    for (int i = 2; i < TestCache::bank_count; ++i) {
+        ok &= check("hit", not cache.acquire(test_color(i), 128).fill_);
+    }
+
+    const auto a = cache.acquire(test_color(100), 128);
+    const auto b = cache.acquire(test_color(101), 128);
+    const auto c = cache.acquire(test_color(102), 128);
+
+    ok &= check("reuse banks from the previous frame",
+                a.fill_ and b.fill_ and a.bank_ not_eq b.bank_ and
+                    (a.bank_ == mix_banks[0] or a.bank_ == mix_banks[1]) and
+                    (b.bank_ == mix_banks[0] or b.bank_ == mix_banks[1]));
+    ok &= check("out of banks", c.bank_ == 0);
+
+    // The evicted mixes are gone, the rest remain.
+    cache.next_frame();
+    cache.next_frame();
+    ok &= check("evicted", cache.acquire(test_color(0), 128).fill_);
+    ok &= check("kept", not cache.acquire(test_color(5), 128).fill_);
+
+    return ok;
+}
+
+
+static bool lru_test()
+{
+    TestCache cache;
+
+    bool ok = true;
+
+    // Fill the banks a few frames apart, so that none of them are on screen.
+    for (int i = 0; i < TestCache::bank_count; ++i) {
+        cache.acquire(test_color(i), 64);
+        cache.next_frame();
+        cache.next_frame();
+    }
+
+    // Touch the oldest mix, so that the second oldest becomes the oldest.
+    cache.acquire(test_color(0), 64);
+    cache.next_frame();
+    cache.next_frame();
+
+    ok &= check("miss", cache.acquire(test_color(50), 64).fill_);
+    ok &= check("recently used mix kept",
+                not cache.acquire(test_color(0), 64).fill_);
+    ok &= check("oldest mix evicted", cache.acquire(test_color(1), 64).fill_);
+
+    return ok;
+}
+
+
+// More mixes than banks, drawn in the same order each frame. The cache evicts
+// the mixes drawn last in the oldest frame, and keeps the ones drawn first.
+static bool draw_order_test()
+{
+    TestCache cache;
+
+    bool ok = true;
+
+    for (int i = 0; i < TestCache::bank_count; ++i) {
+        cache.acquire(test_color(i), 32);
+    }
+    cache.next_frame();
+
+    const auto a = cache.acquire(test_color(50), 32);
+    const auto b = cache.acquire(test_color(51), 32);
+    ok &= check("draw order misses", a.fill_ and b.fill_);
+
+    cache.next_frame();
+
+    const int last = TestCache::bank_count - 1;
+    ok &= check("first drawn kept",
+                not cache.acquire(test_color(0), 32).fill_ and
+                    not cache.acquire(test_color(last - 2), 32).fill_);
+    ok &= check("last drawn evicted",
+                cache.acquire(test_color(last), 32).fill_ and
+                    cache.acquire(test_color(last - 1), 32).fill_);
+
+    return ok;
+}
+
+
+// Many mixes coming and going, checked against a simple model.
+static bool churn_test()
+{
+    TestCache cache;
+
+    int bank_mix[16];
+    for (auto& m : bank_mix) {
+        m = -1;
+    }
+
+    u32 rng = 3;
+    bool ok = true;
+
+    for (int frame = 0; frame < 2000 and ok; ++frame) {
+        std::set<int> used_banks;
+
+        for (int i = 0; i < 8; ++i) {
+            rng = 1664525 * rng + 1013904223;
+            const int mix = (rng >> 8) % 24;
+
+            const auto r = cache.acquire(test_color(mix), 255);
+            if (r.bank_ == 0) {
+                continue;
+            }
+
+            if (r.fill_) {
+                ok &= check("no rewrite of a bank in use",
+                            used_banks.count(r.bank_) == 0);
+                bank_mix[r.bank_] = mix;
+            } else {
+                ok &= check("hit matches model", bank_mix[r.bank_] == mix);
+            }
+
+            used_banks.insert(r.bank_);
+        }
+
+        cache.next_frame();
+    }
+
+    return ok;
+}
+
+
+bool palette_cache_test()
+{
+    bool ok = true;
+
+    ok &= reuse_test();
+    ok &= exhaustion_test();
+    ok &= lru_test();
+    ok &= draw_order_test();
+    ok &= churn_test();
+
+    if (ok) {
+        std::cout << "palette cache test passed!" << std::endl;
+    }
+
+    return ok;
+}
+
+
+// The allocator that the gba used before the cache, for comparison: a linear
+// scan for the mix, and on a miss, the next bank not used in the previous
+// frame, counting up from the first bank each frame.
+struct LinearPaletteScan {
+    struct Info {
+        ColorConstant color_ = ColorConstant::null;
+        u8 amount_ = 0;
+        bool locked_ = false;
+        bool used_ = false;
+    } info_[16];
+
+    int counter_ = 3;
+
+    TestCache::Result acquire(ColorConstant k, u8 amount)
+    {
+        for (int i = 3; i < 16; ++i) {
+            auto& info = info_[i];
+            if (info.color_ == k and info.amount_ == amount) {
+                info.locked_ = true;
+                info.used_ = true;
+                return {i, false};
+            }
+        }
+
+        while (counter_ < 16 and info_[counter_].locked_) {
+            ++counter_;
+        }
+
+        if (counter_ == 16) {
+            for (int i = 3; i < 16; ++i) {
+                if (info_[i].locked_ and not info_[i].used_) {
+                    counter_ = i;
+                    break;
+                }
+            }
+            if (counter_ == 16) {
+                return {0, false};
+            }
+        }
+
+        info_[counter_] = {k, amount, true, true};
+        return {counter_++, true};
+    }
+
+    void next_frame()
+    {
+        counter_ = 3;
+        for (auto& info : info_) {
+            if (not info.used_) {
+                info.locked_ = false;
+            }
+            info.used_ = false;
+        }
+    }
+};
+
+
+// A scene with a number of mixes, e.g. injured enemies flashing on and off,
+// with a random ten of them on screen in any frame. Reports the time per
+// lookup, and how many lookups had to blend a palette, or failed to get a bank.
+// Both allocators rewrite banks that the previous frame showed, when pressed
+// for space. The old allocator wrote them right away, which flickered; the gba
+// now defers the writes until it swaps in the new frame's sprites.
+template <typename Allocator>
+static void palette_cache_benchmark(const char* name, int mixes)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static const int frames = 200000;
+    static const int per_frame = 10;
+
+    Allocator allocator;
+
+    u32 rng = 11;
+    u64 lookups = 0;
+    u64 fills = 0;
+    u64 failures = 0;
+
+    const auto start = Clock::now();
+
+    for (int frame = 0; frame < frames; ++frame) {
+        rng = 1664525 * rng + 1013904223;
+        const int skip = (rng >> 8) % mixes;
+
+        for (int i = 0; i < per_frame; ++i) {
+            const auto r =
+                allocator.acquire(test_color((skip + i) % mixes), 128);
+            fills += r.fill_;
+            failures += r.bank_ == 0;
+            ++lookups;
+        }
+
+        allocator.next_frame();
+    }
+
+    const auto stop = Clock::now();
+
+    const double ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+            .count();
+
+    std::cout << "palette lookup (" << name << ", " << mixes
+              << " mixes): " << ns / lookups
+              << " ns per draw, " << fills << " blends, " << failures
+              << " failures, in " << lookups << " draws" << std::endl;
+}
+
+
+void palette_cache_benchmark()
+{
+    for (int mixes : {12, 16, 24}) {
+        palette_cache_benchmark<TestCache>("cache", mixes);
+        palette_cache_benchmark<LinearPaletteScan>("linear scan", mixes);
+    }
+}
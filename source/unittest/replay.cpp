@@ -0,0 +1,182 @@
+#include "replay.hpp"
+
+
+#include <iostream>
+#include <vector>
+
+
+static u32 test_rng = 7;
+
+
+static u32 test_random(u32 limit)
+{
+    test_rng = 1664525 * test_rng + 1013904223;
+    return (test_rng >> 8) % limit;
+}
+
+
+static bool round_trip_test()
+{
+    std::vector<ReplayFrame> frames;
+
+    // Mostly steady ~60fps deltas with jitter, the occasional stall, and keys
+    // that change every so often.
+    ReplayKeys keys = 0;
+    for (int i = 0; i < 5000; ++i) {
+        if (test_random(20) == 0) {
+            keys = test_random(1 << 16);
+        }
+
+        Microseconds delta = 16000 + test_random(1000);
+        if (test_random(500) == 0) {
+            delta = 2000000 + test_random(100000);
+        }
+
+        frames.push_back({keys, delta});
+    }
+
+    // Include the extremes.
+    frames.push_back({0xffff, 0});
+    frames.push_back({0, 0x7fffffff});
+    frames.push_back({1, 0});
+
+    ReplayEncoder encoder;
+    std::vector<u8> stream;
+
+    for (auto& frame : frames) {
+        u8 buffer[ReplayEncoder::max_frame_size];
+        const auto length = encoder.encode(frame, buffer);
+
+        if (length == 0 or length > ReplayEncoder::max_frame_size or
+            buffer[0] == ReplayEncoder::end) {
+            std::cout << "replay encoder produced a bad record" << std::endl;
+            return false;
+        }
+
+        stream.insert(stream.end(), buffer, buffer + length);
+    }
+
+    stream.push_back(ReplayEncoder::end);
+
+    ReplayDecoder decoder(stream.data(), stream.data() + stream.size());
+
+    for (auto& frame : frames) {
+        auto decoded = decoder.next();
+        if (not decoded or decoded->keys_ not_eq frame.keys_ or
+            decoded->delta_ not_eq frame.delta_) {
+            std::cout << "replay round trip mismatch" << std::endl;
+            return false;
+        }
+    }
+
+    if (decoder.next()) {
+        std::cout << "replay decoder read past the end" << std::endl;
+        return false;
+    }
+
+    // Jitter of up to a millisecond fits in two bytes, plus two for keys on
+    // the frames where they change.
+    if (stream.size() > frames.size() * 5 / 2) {
+        std::cout << "replay stream larger than expected: " << stream.size()
+                  << " bytes for " << frames.size() << " frames" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+// A recording cut short has no end marker, and may end partway through a
+// record. The decoder returns the complete records, and nothing past the end.
+static bool truncated_test()
+{
+    ReplayEncoder encoder;
+    std::vector<u8> stream;
+    std::vector<u32> record_ends;
+
+    for (int i = 0; i < 4; ++i) {
+        u8 buffer[ReplayEncoder::max_frame_size];
+        const auto length =
+            encoder.encode({ReplayKeys(i), Microseconds(16000 << i)}, buffer);
+        stream.insert(stream.end(), buffer, buffer + length);
+        record_ends.push_back(stream.size());
+    }
+
+    for (u32 size = 0; size <= stream.size(); ++size) {
+        ReplayDecoder decoder(stream.data(), stream.data() + size);
+
+        u32 expected = 0;
+        while (expected < record_ends.size() and
+               record_ends[expected] <= size) {
+            ++expected;
+        }
+
+        u32 decoded = 0;
+        while (decoder.next()) {
+            ++decoded;
+        }
+
+        if (decoded not_eq expected) {
+            std::cout << "replay decoder misread a stream truncated to "
+                      << size << " bytes" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+static bool histogram_test()
+{
+    for (u32 value : {0u, 1u, 7u, 8u, 9u, 15u, 16u, 100u, 16666u, 1000000u}) {
+        const auto index = FrameTimeHistogram::bucket(value);
+        if (value > FrameTimeHistogram::bucket_limit(index) or
+            (index > 0 and
+             value <= FrameTimeHistogram::bucket_limit(index - 1))) {
+            std::cout << "histogram bucket bounds wrong for " << value
+                      << std::endl;
+            return false;
+        }
+    }
+
+    FrameTimeHistogram histogram;
+
+    if (histogram.percentile(50) not_eq 0) {
+        std::cout << "empty histogram percentile not zero" << std::endl;
+        return false;
+    }
+
+    for (int i = 1; i <= 1000; ++i) {
+        histogram.record(i * 100);
+    }
+
+    auto within = [](u32 actual, u32 expected) {
+        return actual >= expected and actual <= expected + expected / 8;
+    };
+
+    if (not within(histogram.percentile(50), 50000) or
+        not within(histogram.percentile(99), 99000) or
+        histogram.percentile(100) not_eq 100000 or
+        histogram.max() not_eq 100000 or histogram.count() not_eq 1000) {
+        std::cout << "histogram percentiles wrong: p50 "
+                  << histogram.percentile(50) << ", p99 "
+                  << histogram.percentile(99) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+bool replay_test()
+{
+    if (not round_trip_test() or not truncated_test() or
+        not histogram_test()) {
+        return false;
+    }
+
+    std::cout << "replay test passed!" << std::endl;
+
+    return true;
+}
@@ -0,0 +1,125 @@
+#include "bulkAllocator.hpp"
+#include "memory/buffer.hpp"
+#include "check.hpp"
+
+
+#include <iostream>
+#include <vector>
+
+
+// Host-side checks for the size class arena (see sizeClassArena.hpp), built
+// against the scratch buffer pool in script/bootstrap.cpp.
+
+
+struct SmallObject {
+    u32 data_[12];
+};
+
+
+struct LargeObject {
+    char data_[1500];
+};
+
+
+static const char* const small_tag = "test-small";
+static const char* const large_tag = "test-large";
+
+
+static SizeClassArena::SiteStats site_stats(const char* tag)
+{
+    SizeClassArena::SiteStats result;
+    size_class_arena.for_each_site([&](const SizeClassArena::SiteStats& s) {
+        if (s.tag_ == tag) {
+            result = s;
+        }
+    });
+    return result;
+}
+
+
+bool size_class_arena_test()
+{
+    Platform pfrm;
+
+    bool ok = true;
+
+    const auto small_class =
+        SizeClassArena::size_class(sizeof(SmallObject), alignof(SmallObject));
+
+    ok &= check("small class", small_class == 0);
+
+    const int per_slab = SizeClassArena::cells_per_slab(small_class);
+    const int count = per_slab + per_slab / 2;
+
+    const auto initial_buffers = pfrm.scratch_buffers_remaining();
+
+    {
+        std::vector<DynamicMemory<SmallObject>> objects;
+
+        for (int i = 0; i < count; ++i) {
+            objects.push_back(allocate_dynamic<SmallObject>(pfrm, small_tag));
+            for (auto& word : objects.back()->data_) {
+                word = i;
+            }
+        }
+
+        // Two slabs, rather than one scratch buffer per object.
+        ok &= check("slab count",
+                    pfrm.scratch_buffers_remaining() == initial_buffers - 2);
+
+        ok &= check("live cells",
+                    size_class_arena.class_stats(small_class).cells_.live_ ==
+                        count);
+
+        ok &= check("site count", site_stats(small_tag).allocs_.live_ == count);
+
+        for (int i = 0; i < count; ++i) {
+            for (auto& word : objects[i]->data_) {
+                if (word not_eq u32(i)) {
+                    return check("overlapping cells", false);
+                }
+            }
+        }
+
+        // Freeing every object in the second slab returns its buffer.
+        while (int(objects.size()) > per_slab) {
+            objects.pop_back();
+        }
+        ok &= check("slab release",
+                    pfrm.scratch_buffers_remaining() == initial_buffers - 1);
+
+        // Reassigning a DynamicMemory releases the memory that it held.
+        objects[0] = allocate_dynamic<SmallObject>(pfrm, small_tag);
+        ok &= check("move assign",
+                    size_class_arena.class_stats(small_class).cells_.live_ ==
+                        per_slab);
+    }
+
+    ok &= check("all released",
+                pfrm.scratch_buffers_remaining() == initial_buffers);
+
+    ok &= check("class stats",
+                size_class_arena.class_stats(small_class).cells_.live_ == 0 and
+                    size_class_arena.class_stats(small_class)
+                            .cells_.high_water_ == count);
+
+    ok &= check("site stats",
+                site_stats(small_tag).allocs_.live_ == 0 and
+                    site_stats(small_tag).allocs_.high_water_ == count);
+
+    {
+        auto large = allocate_dynamic<LargeObject>(pfrm, large_tag);
+
+        ok &= check("large object", large and
+                                        size_class_arena.buffer_stats().live_ ==
+                                            1);
+    }
+
+    ok &= check("large release", size_class_arena.buffer_stats().live_ == 0);
+
+    if (ok) {
+        std::cout << "size class arena test passed!" << std::endl;
+    }
+
+    return ok;
+}
@@ -0,0 +1,296 @@
+#include "graphics/spriteBudget.hpp"
+#include "check.hpp"
+
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+
+// Host-side checks for the sprite budget (see spriteBudget.hpp), with the
+// gba's limits.
+
+
+using TestBudget = SpriteBudget<192>;
+
+
+static const u32 sprite_limit = 128;
+static const u32 affine_limit = 32;
+
+
+static Sprite make_sprite(Sprite::Size size, int id)
+{
+    Sprite spr;
+    spr.set_size(size);
+    spr.set_texture_index(id);
+    return spr;
+}
+
+
+// Draws the budget, returning the texture indices that made it to the screen,
+// in draw order.
+static std::vector<int> draw(TestBudget& budget, u32* dropped = nullptr)
+{
+    std::vector<int> result;
+    const auto d =
+        budget.draw(sprite_limit, affine_limit, [&](const Sprite& spr) {
+            result.push_back(spr.get_texture_index());
+        });
+    if (dropped) {
+        *dropped = d;
+    }
+    return result;
+}
+
+
+static bool fits_test()
+{
+    TestBudget budget;
+
+    std::vector<Sprite> sprites;
+    for (int i = 0; i < 64; ++i) {
+        sprites.push_back(make_sprite(Sprite::Size::w32_h32, i));
+    }
+
+    Sprite hidden = make_sprite(Sprite::Size::w32_h32, 100);
+    hidden.set_alpha(Sprite::Alpha::transparent);
+
+    for (auto& spr : sprites) {
+        budget.push(spr, SpritePriority::decoration);
+    }
+    budget.push(hidden, SpritePriority::player);
+
+    u32 dropped = 1;
+    const auto drawn = draw(budget, &dropped);
+
+    bool ok = check("all fit", drawn.size() == 64 and dropped == 0);
+    for (int i = 0; i < 64 and ok; ++i) {
+        ok &= check("draw order", drawn[i] == i);
+    }
+
+    // The budget starts over each frame.
+    ok &= check("cleared", draw(budget).empty());
+
+    return ok;
+}
+
+
+static bool priority_test()
+{
+    TestBudget budget;
+
+    // Decoration first in draw order, the way that Game::render() draws
+    // effects, then the player, then shadows. Too many to fit.
+    std::vector<Sprite> decoration;
+    for (int i = 0; i < 60; ++i) {
+        decoration.push_back(make_sprite(Sprite::Size::w32_h32, i));
+    }
+    const auto player = make_sprite(Sprite::Size::w32_h32, 200);
+    const auto boss = make_sprite(Sprite::Size::w32_h32, 201);
+    const auto shot = make_sprite(Sprite::Size::w16_h32, 202);
+    std::vector<Sprite> shadows;
+    for (int i = 0; i < 10; ++i) {
+        shadows.push_back(make_sprite(Sprite::Size::w16_h32, 300 + i));
+    }
+
+    for (auto& spr : decoration) {
+        budget.push(spr, SpritePriority::decoration);
+    }
+    budget.push(shot, SpritePriority::projectile);
+    budget.push(player, SpritePriority::player);
+    budget.push(boss, SpritePriority::boss);
+    for (auto& spr : shadows) {
+        budget.push(spr, SpritePriority::actor);
+    }
+
+    // 120 + 1 + 2 + 2 + 10 = 135 hardware sprites, so we need to drop four
+    // decoration sprites.
+    u32 dropped = 0;
+    const auto drawn = draw(budget, &dropped);
+
+    bool ok = true;
+    ok &= check("dropped count", dropped == 4);
+    ok &= check("drawn count", drawn.size() == 56 + 13);
+
+    // Everything besides decoration survives, and the order is unchanged.
+    ok &= check("order", drawn[55] == 55 and drawn[56] == 202 and
+                             drawn[57] == 200 and drawn[58] == 201 and
+                             drawn[59] == 300 and drawn.back() == 309);
+
+    return ok;
+}
+
+
+static bool affine_test()
+{
+    TestBudget budget;
+
+    // Forty rotated decoration sprites, only eight distinct rotations, so
+    // they share matrices.
+    std::vector<Sprite> sprites;
+    for (int i = 0; i < 40; ++i) {
+        auto spr = make_sprite(Sprite::Size::w16_h32, i);
+        spr.set_rotation(1000 * (i % 8 + 1));
+        sprites.push_back(spr);
+    }
+    for (auto& spr : sprites) {
+        budget.push(spr, SpritePriority::decoration);
+    }
+
+    u32 dropped = 1;
+    bool ok = check("shared matrices",
+                    draw(budget, &dropped).size() == 40 and dropped == 0);
+
+    // Forty distinct rotations, and a rotated player sprite at the end of the
+    // draw order. The player gets a matrix, and eight decoration sprites miss
+    // out.
+    sprites.clear();
+    for (int i = 0; i < 40; ++i) {
+        auto spr = make_sprite(Sprite::Size::w16_h32, i);
+        spr.set_rotation(100 * (i + 1));
+        sprites.push_back(spr);
+    }
+    auto player = make_sprite(Sprite::Size::w16_h32, 200);
+    player.set_scale({10, 10});
+
+    for (auto& spr : sprites) {
+        budget.push(spr, SpritePriority::decoration);
+    }
+    budget.push(player, SpritePriority::player);
+
+    const auto drawn = draw(budget, &dropped);
+    ok &= check("out of matrices", drawn.size() == 32 and dropped == 9);
+    ok &= check("player kept", drawn.back() == 200);
+
+    return ok;
+}
+
+
+// Shadows draw after every other sprite, in the order pushed, and sorting the
+// other sprites leaves them alone, the way that Game::render() layers the
+// overworld by y position.
+static bool layer_test()
+{
+    TestBudget budget;
+
+    std::vector<Sprite> sprites;
+    for (int i = 0; i < 6; ++i) {
+        auto spr = make_sprite(Sprite::Size::w16_h32, i);
+        spr.set_position({0, Float(i * 10)});
+        sprites.push_back(spr);
+    }
+    std::vector<Sprite> shadows;
+    for (int i = 0; i < 3; ++i) {
+        shadows.push_back(make_sprite(Sprite::Size::w16_h32, 100 + i));
+    }
+
+    budget.push(sprites[0], SpritePriority::decoration);
+    budget.push_shadow(shadows[0], SpritePriority::actor);
+
+    const auto sorted = budget.size();
+    for (int i = 1; i < 6; ++i) {
+        budget.push(sprites[i], SpritePriority::actor);
+    }
+    budget.push_shadow(shadows[1], SpritePriority::actor);
+    budget.push_shadow(shadows[2], SpritePriority::actor);
+
+    budget.sort(sorted, [](const Sprite& l, const Sprite& r) {
+        return l.get_position().y > r.get_position().y;
+    });
+
+    return check("layers",
+                 draw(budget) ==
+                     std::vector<int>({0, 5, 4, 3, 2, 1, 100, 101, 102}));
+}
+
+
+// Sprites and shadows share the buffer, and anything past its capacity counts
+// as dropped.
+static bool overflow_test()
+{
+    SpriteBudget<8> budget;
+
+    const auto spr = make_sprite(Sprite::Size::w16_h32, 0);
+    for (int i = 0; i < 6; ++i) {
+        budget.push(spr, SpritePriority::decoration);
+    }
+    for (int i = 0; i < 4; ++i) {
+        budget.push_shadow(spr, SpritePriority::actor);
+    }
+
+    u32 drawn = 0;
+    const auto dropped =
+        budget.draw(sprite_limit, affine_limit, [&](const Sprite&) {
+            ++drawn;
+        });
+
+    return check("overflow", drawn == 8 and dropped == 2);
+}
+
+
+bool sprite_budget_test()
+{
+    bool ok = true;
+
+    ok &= fits_test();
+    ok &= priority_test();
+    ok &= affine_test();
+    ok &= layer_test();
+    ok &= overflow_test();
+
+    if (ok) {
+        std::cout << "sprite budget test passed!" << std::endl;
+    }
+
+    return ok;
+}
+
+
+// Time per frame to budget a scene that fits, and a crowded scene that
+// doesn't, with some rotated sprites.
+void sprite_budget_benchmark()
+{
+    using Clock = std::chrono::steady_clock;
+
+    static const int frames = 20000;
+
+    for (int count : {60, 150}) {
+        std::vector<Sprite> sprites;
+        for (int i = 0; i < count; ++i) {
+            auto spr = make_sprite(i % 3 ? Sprite::Size::w16_h32
+                                         : Sprite::Size::w32_h32,
+                                   i);
+            if (i % 10 == 0) {
+                spr.set_rotation(500 * (i % 7));
+            }
+            sprites.push_back(spr);
+        }
+
+        TestBudget budget;
+
+        u64 drawn = 0;
+        u64 dropped = 0;
+
+        const auto start = Clock::now();
+
+        for (int frame = 0; frame < frames; ++frame) {
+            for (int i = 0; i < count; ++i) {
+                budget.push(sprites[i], SpritePriority(i % 6));
+            }
+            dropped += budget.draw(sprite_limit,
+                                   affine_limit,
+                                   [&](const Sprite&) { ++drawn; });
+        }
+
+        const auto stop = Clock::now();
+
+        const double ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+                .count();
+
+        std::cout << "sprite budget (" << count
+                  << " sprites): " << ns / frames << " ns per frame, "
+                  << drawn / frames << " drawn, " << dropped / frames
+                  << " dropped" << std::endl;
+    }
+}
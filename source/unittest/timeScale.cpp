@@ -0,0 +1,86 @@
+#include "timeScale.hpp"
+#include "check.hpp"
+
+
+#include <iostream>
+
+
+// Host-side checks for hit-stop and slow motion (see timeScale.hpp).
+
+
+static const Microseconds frame = 16667;
+
+
+bool time_scale_test()
+{
+    bool ok = true;
+
+    {
+        TimeScale ts;
+        ok &= check("passthrough", ts.apply(frame) == frame);
+        ok &= check("not frozen", not ts.frozen());
+    }
+
+    {
+        // Five frames of hit-stop, then the game carries on, including the
+        // part of a frame left over at the end of the freeze.
+        TimeScale ts;
+        ts.freeze(frame * 5 - 100);
+
+        int stopped = 0;
+        while (ts.frozen()) {
+            const auto dt = ts.apply(frame);
+            if (dt == 0) {
+                ++stopped;
+            } else {
+                ok &= check("remainder", dt == 100);
+            }
+        }
+        ok &= check("freeze frames", stopped == 4);
+        ok &= check("after freeze", ts.apply(frame) == frame);
+    }
+
+    {
+        // Overlapping freezes extend, rather than add up.
+        TimeScale ts;
+        ts.freeze(frame * 4);
+        ts.freeze(frame * 2);
+        ts.apply(frame);
+        ts.freeze(frame * 6);
+
+        int stopped = 0;
+        while (ts.frozen()) {
+            ts.apply(frame);
+            ++stopped;
+        }
+        ok &= check("overlapping freezes", stopped == 6);
+    }
+
+    {
+        // Half speed, for two and a half frames of real time.
+        TimeScale ts;
+        ts.dilate(0.5f, frame * 2 + frame / 2);
+
+        ok &= check("dilated", ts.apply(frame) == frame / 2);
+        ok &= check("dilated", ts.apply(frame) == frame / 2);
+        const auto rest = frame - frame / 2;
+        ok &= check("dilation ends",
+                    ts.apply(frame) == (frame / 2) / 2 + rest);
+        ok &= check("after dilation", ts.apply(frame) == frame);
+    }
+
+    {
+        // Slow motion doesn't count down during a freeze.
+        TimeScale ts;
+        ts.dilate(0.5f, frame);
+        ts.freeze(frame);
+        ok &= check("freeze first", ts.apply(frame) == 0);
+        ok &= check("then dilate", ts.apply(frame) == frame / 2);
+    }
+
+    if (ok) {
+        std::cout << "time scale test passed!" << std::endl;
+    }
+
+    return ok;
+}
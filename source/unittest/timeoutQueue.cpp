@@ -0,0 +1,187 @@
+#include "timeoutQueue.hpp"
+#include "number/random.hpp"
+#include "check.hpp"
+
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+
+// Host-side checks for the deferred callback queue (see timeoutQueue.hpp). The
+// callbacks are plain ints, which the tests record as they fire.
+
+
+using Queue = TimeoutQueue<int, 64>;
+
+
+struct Fired {
+    int value_;
+    u32 time_; // Milliseconds since the start of the test.
+};
+
+
+// Runs the queue in one millisecond steps.
+static std::vector<Fired> run(Queue& q, u32 duration_ms, u32 start = 0)
+{
+    std::vector<Fired> result;
+    for (u32 t = start + 1; t <= start + duration_ms; ++t) {
+        q.update(milliseconds(1), [&](int& v) { result.push_back({v, t}); });
+    }
+    return result;
+}
+
+
+// Timeouts fire in order of deadline, no sooner than their deadline, and ties
+// fire in the order that they were pushed.
+static bool ordering_test()
+{
+    Queue q;
+
+    rng::LinearGenerator rng = 5;
+
+    std::vector<Fired> expected;
+    for (int i = 0; i < 64; ++i) {
+        const u32 delay = 1 + rng::choice<20>(rng);
+        q.push(milliseconds(delay), i);
+        expected.push_back({i, delay});
+    }
+
+    bool ok = check("full",
+                    not q.push(1, 64) and q.stats().overflow_count_ == 1);
+    ok &= check("high water", q.stats().high_water_ == 64);
+
+    std::stable_sort(
+        expected.begin(), expected.end(), [](auto& lhs, auto& rhs) {
+            return lhs.time_ < rhs.time_;
+        });
+
+    const auto fired = run(q, 30);
+
+    ok &= check("all fired", fired.size() == 64 and q.size() == 0);
+    for (u32 i = 0; i < fired.size() and ok; ++i) {
+        ok &= check("order", fired[i].value_ == expected[i].value_);
+        ok &= check("on time", fired[i].time_ == expected[i].time_);
+    }
+
+    return ok;
+}
+
+
+// A callback may push more timeouts. Any that are already due run within the
+// same update.
+static bool reentrant_test()
+{
+    Queue q;
+    q.push(milliseconds(1), 0);
+
+    std::vector<int> fired;
+    q.update(milliseconds(1), [&](int& v) {
+        fired.push_back(v);
+        if (v < 3) {
+            q.push(0, v + 1);
+        }
+        if (v == 0) {
+            q.push(milliseconds(5), 10);
+        }
+    });
+
+    bool ok = check("chained",
+                    fired == std::vector<int>({0, 1, 2, 3}) and q.size() == 1);
+
+    ok &= check("chained later", run(q, 5).size() == 1 and q.size() == 0);
+
+    return ok;
+}
+
+
+static bool cancel_test()
+{
+    Queue q;
+
+    std::vector<Queue::Id> ids;
+    for (int i = 0; i < 16; ++i) {
+        ids.push_back(*q.push(milliseconds(i + 1), i));
+    }
+
+    // Cancel from the root, a leaf, and the middle of the heap.
+    bool ok = check("cancel first", q.cancel(ids[0]));
+    ok &= check("cancel last", q.cancel(ids[15]));
+    ok &= check("cancel middle", q.cancel(ids[7]));
+    ok &= check("cancel twice", not q.cancel(ids[7]));
+    ok &= check("size", q.size() == 13);
+
+    // The pool gets the cancelled callbacks back.
+    for (int i = 0; i < 64 - 13; ++i) {
+        ok &= check("refill", bool(q.push(seconds(1), 100)));
+    }
+    ok &= check("refilled", not q.push(seconds(1), 100));
+
+    const auto fired = run(q, 16);
+
+    std::vector<int> values;
+    for (auto& f : fired) {
+        values.push_back(f.value_);
+    }
+    ok &= check("remaining order",
+                values == std::vector<int>(
+                              {1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14}));
+
+    ok &= check("cancel fired", not q.cancel(ids[1]));
+
+    return ok;
+}
+
+
+// The queue's clock wraps after about 71 minutes. Timeouts that straddle the
+// wrap still fire on time, and in order.
+static bool wraparound_test()
+{
+    Queue q;
+
+    // Run the clock up to a few milliseconds short of 2^32 microseconds.
+    const u32 wrap_ms = 0xffffffff / 1000;
+    u32 now_ms = 0;
+    while (now_ms + 1000 < wrap_ms - 5) {
+        q.update(seconds(1), [](int&) {});
+        now_ms += 1000;
+    }
+    while (now_ms < wrap_ms - 5) {
+        q.update(milliseconds(1), [](int&) {});
+        ++now_ms;
+    }
+
+    q.push(milliseconds(20), 2);
+    q.push(milliseconds(3), 0);
+    q.push(milliseconds(10), 1);
+
+    const auto fired = run(q, 25, now_ms);
+
+    bool ok = check("wrap fired", fired.size() == 3);
+    for (u32 i = 0; i < fired.size() and ok; ++i) {
+        ok &= check("wrap order", fired[i].value_ == int(i));
+    }
+    ok &= check("wrap timing",
+                fired.size() == 3 and fired[0].time_ == now_ms + 3 and
+                    fired[1].time_ == now_ms + 10 and
+                    fired[2].time_ == now_ms + 20);
+
+    return ok;
+}
+
+
+bool timeout_queue_test()
+{
+    bool ok = true;
+
+    ok &= ordering_test();
+    ok &= reentrant_test();
+    ok &= cancel_test();
+    ok &= wraparound_test();
+
+    if (ok) {
+        std::cout << "timeout queue test passed!" << std::endl;
+    }
+
+    return ok;
+}
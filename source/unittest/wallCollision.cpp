@@ -0,0 +1,190 @@
+#include "memory/buffer.hpp"
+#include "wallCollision.hpp"
+
+
+#include <chrono>
+#include <iostream>
+
+
+// The original wall collision routine, which gathered the walls around an
+// entity and tested the entity against each of them. We keep it here, to check
+// that the WallField returns identical results.
+namespace reference {
+
+
+using Wall = Vec2<s32>;
+using WallAdjacencyVector = Buffer<Wall, 16>;
+
+
+template <typename T>
+WallAdjacencyVector adjacent_walls(TileMap& tiles, const T& entity)
+{
+    WallAdjacencyVector v;
+    Vec2<s32> pos = entity.get_position().template cast<s32>();
+    pos.y += 2;
+
+    const Vec2<TIdx> tile_coords = to_tile_coord(pos);
+
+    auto check_wall = [&](TIdx x, TIdx y) {
+        if (not is_walkable(tiles.get_tile(x, y))) {
+            v.push_back(to_world_coord<s32>({x, y}));
+        }
+    };
+
+    for (TIdx x = tile_coords.x - 1; x < tile_coords.x + 2; ++x) {
+        for (TIdx y = tile_coords.y - 1; y < tile_coords.y + 2; ++y) {
+            check_wall(x, y);
+        }
+    }
+
+    return v;
+}
+
+
+template <typename T>
+WallCollisions check_wall_collisions(TileMap& tiles, T& entity)
+{
+    auto adjacency_vector = adjacent_walls(tiles, entity);
+
+    Vec2<s32> pos = entity.get_position().template cast<s32>();
+    pos.y += 2;
+
+    WallCollisions result;
+
+    for (const auto& wall : adjacency_vector) {
+        if ((pos.x - 16 + 6 < (wall.x + 32) and (pos.x - 16 + 6 > (wall.x))) and
+            (abs((pos.y - 16 + 16) - wall.y) <= 13)) {
+            result.left = true;
+        }
+        if ((pos.x - 16 + 26 > (wall.x) and
+             (pos.x - 16 + 26 < (wall.x + 32))) and
+            (abs((pos.y - 16 + 16) - wall.y) <= 13)) {
+            result.right = true;
+        }
+        if (((pos.y - 16 + 22 < (wall.y + 26)) and
+             (pos.y - 16 + 22 > (wall.y))) and
+            (abs((pos.x - 16) - wall.x) <= 16)) {
+            result.up = true;
+        }
+        if (((pos.y - 16 + 36 > wall.y) and (pos.y - 16 + 36 < wall.y + 26)) and
+            (abs((pos.x - 16) - wall.x) <= 16)) {
+            result.down = true;
+        }
+    }
+
+    return result;
+}
+
+
+} // namespace reference
+
+
+struct TestEntity {
+    Vec2<Float> position_;
+
+    const Vec2<Float>& get_position() const
+    {
+        return position_;
+    }
+};
+
+
+static u32 test_rng = 7;
+
+
+static u32 test_random()
+{
+    test_rng = 1664525 * test_rng + 1013904223;
+    return test_rng >> 16;
+}
+
+
+bool wall_collision_test()
+{
+    static const int map_count = 16;
+    static const int margin = 48;
+
+    for (int map = 0; map < map_count; ++map) {
+        TileMap tiles;
+
+        // A mix of densities, from mostly walls to mostly floor.
+        const u32 density = 2 + map % 6;
+        tiles.for_each([&](u8& tile, int, int) {
+            tile = test_random() % density ? Tile::sand : Tile::none;
+        });
+
+        WallField field;
+        field.build(tiles);
+
+        for (int y = -margin; y < TileMap::height * 24 + margin; ++y) {
+            for (int x = -margin; x < TileMap::width * 32 + margin; ++x) {
+                TestEntity e{{Float(x), Float(y)}};
+
+                const auto expected = reference::check_wall_collisions(tiles, e);
+                const auto result = check_wall_collisions(field, e);
+
+                if (expected.left not_eq result.left or
+                    expected.right not_eq result.right or
+                    expected.up not_eq result.up or
+                    expected.down not_eq result.down) {
+                    std::cout << "wall collision mismatch at " << x << ", " << y
+                              << " (map " << map << ")" << std::endl;
+                    return false;
+                }
+            }
+        }
+    }
+
+    std::cout << "wall collision test passed!" << std::endl;
+
+    return true;
+}
+
+
+// Reports the time to build the wall field, and the time per collision check,
+// for the configured map dimensions. The build time should grow linearly with
+// the map area, while the time per check should stay flat.
+void wall_collision_benchmark()
+{
+    using Clock = std::chrono::steady_clock;
+
+    TileMap tiles;
+    tiles.for_each([&](u8& tile, int, int) {
+        tile = test_random() % 3 ? Tile::sand : Tile::none;
+    });
+
+    static const int build_iters = 1000;
+
+    WallField field;
+
+    const auto build_start = Clock::now();
+    for (int i = 0; i < build_iters; ++i) {
+        field.build(tiles);
+    }
+    const auto build_stop = Clock::now();
+
+    static const int check_iters = 1000000;
+
+    const int map_w = TileMap::width * 32;
+    const int map_h = TileMap::height * 24;
+
+    int collisions = 0;
+
+    const auto check_start = Clock::now();
+    for (int i = 0; i < check_iters; ++i) {
+        TestEntity e{{Float((i * 7) % map_w), Float((i * 13) % map_h)}};
+        collisions += check_wall_collisions(field, e).any();
+    }
+    const auto check_stop = Clock::now();
+
+    const auto ns = [](auto d) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+    };
+
+    std::cout << "wall field " << TileMap::width << "x" << TileMap::height
+              << " (" << TileMap::tile_count << " tiles): "
+              << ns(build_stop - build_start) / build_iters << " ns to build, "
+              << double(ns(check_stop - check_start)) / check_iters
+              << " ns per check (" << collisions << " collisions)"
+              << std::endl;
+}
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "memory/buffer.hpp"
+#include "bitvector.hpp"
 #include "tileMap.hpp"
 
 
@@ -17,69 +17,102 @@ struct WallCollisions {
 };
 
 
-using Wall = Vec2<s32>;
-using WallAdjacencyVector = Buffer<Wall, 16>;
+// A bit-packed copy of the map's walkable tiles, built once per level, after
+// the game finishes generating the map. Entities query the field every frame,
+// so rather than gathering the walls in each entity's neighborhood and testing
+// the entity against every one of them, check_wall_collisions() works out, for
+// each edge of the entity, the small range of tiles that could possibly
+// collide, and reads their bits directly.
+class WallField {
+public:
+    void build(const TileMap& tiles)
+    {
+        tiles.for_each([&](u8 tile, int x, int y) {
+            walkable_.set(x + y * TileMap::width, is_walkable(tile));
+        });
+    }
 
 
-template <typename T>
-WallAdjacencyVector adjacent_walls(TileMap& tiles, const T& entity)
-{
-    WallAdjacencyVector v;
-    Vec2<s32> pos = entity.get_position().template cast<s32>();
-    pos.y += 2;
+    // Like TileMap::get_tile(), everything outside of the map counts as a
+    // wall.
+    bool solid(s32 x, s32 y) const
+    {
+        if (x < 0 or y < 0 or x > TileMap::width - 1 or
+            y > TileMap::height - 1) {
+            return true;
+        }
+        return not walkable_.get(x + y * TileMap::width);
+    }
 
-    const Vec2<TIdx> tile_coords = to_tile_coord(pos);
 
-    auto check_wall = [&](TIdx x, TIdx y) {
-        if (not is_walkable(tiles.get_tile(x, y))) {
-            v.push_back(to_world_coord<s32>({x, y}));
+    // Returns true if any wall tile, within one tile of center, has its world
+    // coordinate origin inside the rectangle [x0, x1] by [y0, y1].
+    bool any_solid(const Vec2<TIdx>& center,
+                   s32 x0,
+                   s32 x1,
+                   s32 y0,
+                   s32 y1) const
+    {
+        const s32 tx0 = std::max(ceil_div(x0, 32), s32(center.x - 1));
+        const s32 tx1 = std::min(floor_div(x1, 32), s32(center.x + 1));
+        const s32 ty0 = std::max(ceil_div(y0, 24), s32(center.y - 1));
+        const s32 ty1 = std::min(floor_div(y1, 24), s32(center.y + 1));
+
+        for (s32 y = ty0; y <= ty1; ++y) {
+            for (s32 x = tx0; x <= tx1; ++x) {
+                if (solid(x, y)) {
+                    return true;
+                }
+            }
         }
-    };
 
-    // A four by four block around the entity should be a large enough region to
-    // check for wall collisions.
-    for (TIdx x = tile_coords.x - 1; x < tile_coords.x + 2; ++x) {
-        for (TIdx y = tile_coords.y - 1; y < tile_coords.y + 2; ++y) {
-            check_wall(x, y);
-        }
+        return false;
     }
 
-    return v;
-}
+private:
+    static s32 floor_div(s32 n, s32 d)
+    {
+        return n / d - (n % d < 0);
+    }
+
+    static s32 ceil_div(s32 n, s32 d)
+    {
+        return -floor_div(-n, d);
+    }
+
+    // NOTE: Zero-initialized, i.e. all walls, same as an empty TileMap.
+    Bitvector<TileMap::tile_count> walkable_;
+};
 
 
 template <typename T>
-WallCollisions check_wall_collisions(TileMap& tiles, T& entity)
+WallCollisions check_wall_collisions(const WallField& field, T& entity)
 {
-    auto adjacency_vector = adjacent_walls(tiles, entity);
-
     Vec2<s32> pos = entity.get_position().template cast<s32>();
     pos.y += 2;
 
+    // We only consider walls in the three by three block of tiles around the
+    // entity, which is a large enough region to check for wall collisions.
+    const Vec2<TIdx> center = to_tile_coord(pos);
+
+    // The bounds below describe where a wall tile's origin would need to be,
+    // for the tile to overlap the corresponding edge of the entity. The
+    // original code tested the entity against each wall tile, with comparisons
+    // like pos.x - 10 < wall.x + 32, and the bounds here are just those
+    // comparisons, rearranged in terms of the wall coordinate.
     WallCollisions result;
 
-    for (const auto& wall : adjacency_vector) {
-        // FIXME: this edge collision code is junk left over from the original
-        // codebase.
-        if ((pos.x - 16 + 6 < (wall.x + 32) and (pos.x - 16 + 6 > (wall.x))) and
-            (abs((pos.y - 16 + 16) - wall.y) <= 13)) {
-            result.left = true;
-        }
-        if ((pos.x - 16 + 26 > (wall.x) and
-             (pos.x - 16 + 26 < (wall.x + 32))) and
-            (abs((pos.y - 16 + 16) - wall.y) <= 13)) {
-            result.right = true;
-        }
-        if (((pos.y - 16 + 22 < (wall.y + 26)) and
-             (pos.y - 16 + 22 > (wall.y))) and
-            (abs((pos.x - 16) - wall.x) <= 16)) {
-            result.up = true;
-        }
-        if (((pos.y - 16 + 36 > wall.y) and (pos.y - 16 + 36 < wall.y + 26)) and
-            (abs((pos.x - 16) - wall.x) <= 16)) {
-            result.down = true;
-        }
-    }
+    result.left = field.any_solid(
+        center, pos.x - 41, pos.x - 11, pos.y - 13, pos.y + 13);
+
+    result.right =
+        field.any_solid(center, pos.x - 21, pos.x + 9, pos.y - 13, pos.y + 13);
+
+    result.up =
+        field.any_solid(center, pos.x - 32, pos.x, pos.y - 19, pos.y + 5);
+
+    result.down =
+        field.any_solid(center, pos.x - 32, pos.x, pos.y - 5, pos.y + 19);
 
     return result;
 }